@@ -86,6 +86,17 @@ limitations under the License.
 /* Change log: */
 /* Last changes:
 
+ As from V0.3.1:
+    Testing the tuner code with SILABS_SAT_TUNER_CODE in all wrapper functions.
+     When SINGLE_CHIP_SAT_TUNER is defined, this is a compile-time constant and the other tuners are not tested at run time.
+    In SiLabs_SAT_Tuner_SW_Init: selecting SINGLE_CHIP_SAT_TUNER by default.
+    In SiLabs_SAT_Tuner_Select_Tuner: refusing any tuner other than SINGLE_CHIP_SAT_TUNER.
+    SILABS_SAT_TUNER_CODE evaluates silabs_tuner, and SiLabs_SAT_Tuner_Sub and SiLabs_SAT_Tuner_SelectRF use their parameters,
+     to avoid unused parameter warnings in single-chip builds.
+
+ As from V0.3.0:
+    In SiLabs_SAT_Tuner_Select_Tuner: counting all transactions of the selected tuner in the L0_STATS_TUNER i2c statistics category.
+
  As from V0.2.9:
     Adding RDA SAT tuner support for RDA16110E (compiled if SAT_TUNER_RDA16110E is defined, using '0x16110E' as the sat_tuner_code)
  
@@ -263,6 +274,9 @@ signed   int   SiLabs_SAT_Tuner_SW_Init        (SILABS_SAT_TUNER_Context *silabs
     L1_RF_RDA16110E_Init                (silabs_tuner->RDA16110E_Tuner[i], add);
   }
 #endif /* SAT_TUNER_RDA16110E */
+#ifdef    SINGLE_CHIP_SAT_TUNER
+  sat_tuner_code = SINGLE_CHIP_SAT_TUNER;
+#endif /* SINGLE_CHIP_SAT_TUNER */
   if (sat_tuner_code != 0) {
     SiLabs_SAT_Tuner_Select_Tuner (silabs_tuner, sat_tuner_code, 0);
   } else {
@@ -275,6 +289,13 @@ signed   int   SiLabs_SAT_Tuner_SW_Init        (SILABS_SAT_TUNER_Context *silabs
 }
 signed   int   SiLabs_SAT_Tuner_Select_Tuner   (SILABS_SAT_TUNER_Context *silabs_tuner, signed   int sat_tuner_code, signed   int tuner_index) {
   SiTRACE_X("Select SAT Tuner with code 0x%x[%d]\n", sat_tuner_code, tuner_index);
+#ifdef    SINGLE_CHIP_SAT_TUNER
+  /* 0xA201727 is also accepted, as it selects the AV2018 driver for an AV2017 */
+  if ( (sat_tuner_code != SINGLE_CHIP_SAT_TUNER) && (sat_tuner_code != 0xA201727) ) {
+    SiERROR("SiLabs_SAT_Tuner_Select_Tuner: tuner not matching SINGLE_CHIP_SAT_TUNER !\n");
+    return (silabs_tuner->sat_tuner_code<<8)+silabs_tuner->tuner_index;
+  }
+#endif /* SINGLE_CHIP_SAT_TUNER */
 #ifdef    SAT_TUNER_AV2012
   if (sat_tuner_code               == 0xA2012 ) {
     silabs_tuner->sat_tuner_code = sat_tuner_code;
@@ -378,15 +399,17 @@ signed   int   SiLabs_SAT_Tuner_Select_Tuner   (SILABS_SAT_TUNER_Context *silabs
 #endif /* SAT_TUNER_RDA16110E */
   if (silabs_tuner->sat_tuner_code != 0) {
     SiTRACE("Selected SAT tuner with code %04x[%d] (i2c address 0x%02x)\n", silabs_tuner->sat_tuner_code, silabs_tuner->tuner_index, silabs_tuner->i2c->address);
+    L0_StatsCategory(silabs_tuner->i2c, L0_STATS_TUNER);
   } else {
     SiTRACE("NO SAT tuner\n");
   }
   return (silabs_tuner->sat_tuner_code<<8)+silabs_tuner->tuner_index;
 }
 signed   int   SiLabs_SAT_Tuner_Sub            (SILABS_SAT_TUNER_Context *silabs_tuner, signed   int sat_tuner_sub) {
+  silabs_tuner = silabs_tuner; /* To avoid compiler warning if not used */
   SiTRACE_X("Select SAT Tuner sub %d\n", sat_tuner_sub);
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D ) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D ) {
     if (sat_tuner_sub > 0) {
       silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->sub = 1;
     } else {
@@ -408,73 +431,73 @@ signed   int   SiLabs_SAT_Tuner_HW_Init        (SILABS_SAT_TUNER_Context *silabs
   return_code = -1;
   SiTRACE("SiLabs_SAT_Tuner_HW_Init silabs_tuner->sat_tuner_code 0x%x, %ld\n", silabs_tuner->sat_tuner_code,silabs_tuner->sat_tuner_code);
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for AV2012 at i2c 0x%02x\n", silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_AV2012_InitAfterReset(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for AV2017 at i2c 0x%02x\n", silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_AV2017_InitAfterReset(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for AV2018 at i2c 0x%02x\n", silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_AV2018_InitAfterReset(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for CUSTOMSAT at i2c 0x%02x\n", silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_CUSTOMSAT_InitAfterReset(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for MAX2112 at i2c 0x%02x\n", silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_MAX2112_InitAfterReset(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for NXP20142 at i2c 0x%02x\n", silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_NXP20142_InitAfterReset(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA5812 at i2c 0x%02x\n", silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA5812_InitAfterReset(silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA5815 at i2c 0x%02x\n", silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA5815_InitAfterReset(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA5815M at i2c 0x%02x\n", silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA5815M_InitAfterReset(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA5816 at i2c 0x%02x\n", silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA5816S_InitAfterReset(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA5816 at i2c 0x%02x\n", silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA5816SD_InitAfterReset(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) {
     SiTRACE("SiLabs_SAT_Tuner_HW_Init for RDA16110E at i2c 0x%02x\n", silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_RDA16110E_InitAfterReset(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]);
   }
@@ -483,285 +506,285 @@ signed   int   SiLabs_SAT_Tuner_HW_Init        (SILABS_SAT_TUNER_Context *silabs
 }
 signed   int   SiLabs_SAT_Tuner_HW_Connect     (SILABS_SAT_TUNER_Context *silabs_tuner, CONNECTION_TYPE connection_mode) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L0_Connect(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L0_Connect(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L0_Connect(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L0_Connect(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L0_Connect(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L0_Connect(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L0_Connect(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L0_Connect(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return L0_Connect(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return L0_Connect(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L0_Connect(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L0_Connect(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return L0_Connect(silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return L0_Connect(silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return L0_Connect(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return L0_Connect(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return L0_Connect(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return L0_Connect(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return L0_Connect(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return L0_Connect(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return L0_Connect(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return L0_Connect(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return L0_Connect(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return L0_Connect(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_bytes_trace    (SILABS_SAT_TUNER_Context *silabs_tuner, unsigned char track_mode) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_Wakeup         (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_Wakeup(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_Wakeup(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_Wakeup(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_Wakeup(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_Wakeup(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_Wakeup(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Wakeup(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Wakeup(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return 0; }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_Wakeup(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_Wakeup(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return 0; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return L1_RF_RDA5815_Wakeup(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return L1_RF_RDA5815_Wakeup(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return L1_RF_RDA5815M_Wakeup(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return L1_RF_RDA5815M_Wakeup(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return L1_RF_RDA5816S_Wakeup(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return L1_RF_RDA5816S_Wakeup(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return L1_RF_RDA5816SD_Wakeup(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return L1_RF_RDA5816SD_Wakeup(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return L1_RF_RDA16110E_Wakeup(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return L1_RF_RDA16110E_Wakeup(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_Standby        (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_Standby(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_Standby(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_Standby(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_Standby(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_Standby(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_Standby(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Standby(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Standby(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return 0; }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_Standby(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_Standby(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return 0; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return L1_RF_RDA5815_Standby(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return L1_RF_RDA5815_Standby(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return L1_RF_RDA5815M_Standby(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return L1_RF_RDA5815M_Standby(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return L1_RF_RDA5816S_Standby(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return L1_RF_RDA5816S_Standby(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return L1_RF_RDA5816SD_Standby(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return L1_RF_RDA5816SD_Standby(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return L1_RF_RDA16110E_Standby(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return L1_RF_RDA16110E_Standby(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_StandbyWithClk (SILABS_SAT_TUNER_Context *silabs_tuner) {
   /* Only call SiLabs_SAT_Tuner_Standby if the SAT tuner can still generate a clock while in standby */
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
  /* <porting> Call SiLabs_TER_Tuner_Standby here only if the SAT tuner will keep its clock ON while set to Standby mode. Otherwise, return -1 */
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return SiLabs_SAT_Tuner_Standby(silabs_tuner); }
 #endif /* SAT_TUNER_CUSTOMSAT */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_ClockOff       (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return 0; }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return 0; }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return 0; }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return 0; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return 0; }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return 0; }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return 0; }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return 0; }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return 0; }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_ClockOn        (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return 0; }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return 0; }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return 0; }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return 0; }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return 0; }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return 0; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return 0; }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return 0; }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return 0; }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return 0; }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return 0; }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
 signed   int   SiLabs_SAT_Tuner_PowerDown      (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return 0; }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return 0; }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return 0; }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return 0; }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return 0; }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return 0; }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return 0; }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return 0; }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return 0; }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return 0; }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return 0; }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return 0; }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return 0; }
 #endif /* SAT_TUNER_RDA16110E */
   return -1;
 }
@@ -810,141 +833,143 @@ signed   int   SiLabs_SAT_Tuner_Possible_Tuners(SILABS_SAT_TUNER_Context *silabs
 }
 signed   int   SiLabs_SAT_Tuner_Tune           (SILABS_SAT_TUNER_Context *silabs_tuner, unsigned long freq_khz) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_Tune(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_Tune(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_Tune(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_Tune(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_Tune(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_Tune(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Tune(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Tune(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return L1_RF_MAX2112_Tune(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return L1_RF_MAX2112_Tune(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_Tune(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_Tune(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812)  { return L1_RF_RDA5812_Tune (silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index],  freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812)  { return L1_RF_RDA5812_Tune (silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index],  freq_khz);}
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815)  { return L1_RF_RDA5815_Tune (silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index],  freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815)  { return L1_RF_RDA5815_Tune (silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index],  freq_khz);}
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150)  { return L1_RF_RDA5815M_Tune (silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index],  freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150)  { return L1_RF_RDA5815M_Tune (silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index],  freq_khz);}
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816)  { return L1_RF_RDA5816S_Tune(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816)  { return L1_RF_RDA5816S_Tune(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D)  { return L1_RF_RDA5816SD_Tune(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D)  { return L1_RF_RDA5816SD_Tune(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E)  { return L1_RF_RDA16110E_Tune(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], freq_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E)  { return L1_RF_RDA16110E_Tune(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], freq_khz);}
 #endif /* SAT_TUNER_RDA16110E */
   return 0;
 }
 signed   int   SiLabs_SAT_Tuner_SelectRF       (SILABS_SAT_TUNER_Context *silabs_tuner, unsigned char rf_chn)   {
+  silabs_tuner = silabs_tuner; /* To avoid compiler warning if not used */
+  rf_chn       = rf_chn;       /* To avoid compiler warning if not used */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D)  { return L1_RF_RDA5816SD_RfSel(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], rf_chn);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D)  { return L1_RF_RDA5816SD_RfSel(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], rf_chn);}
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E)  { return L1_RF_RDA16110E_RfSel(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], rf_chn);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E)  { return L1_RF_RDA16110E_RfSel(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], rf_chn);}
 #endif /* SAT_TUNER_RDA16110E */
   return 0;
 }
 signed   int   SiLabs_SAT_Tuner_LPF            (SILABS_SAT_TUNER_Context *silabs_tuner, unsigned long lpf_khz ) {
   SiTRACE("SiLabs_SAT_Tuner_LPF lpf_khz %ld (silabs_tuner->sat_tuner_code 0x%x)\n", lpf_khz, silabs_tuner->sat_tuner_code);
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_LPF(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_LPF(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_LPF(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_LPF(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_LPF(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_LPF(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_LPF(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_LPF(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return L1_RF_MAX2112_LPF(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return L1_RF_MAX2112_LPF(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_LPF(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_LPF(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812)  { return L1_RF_RDA5812_LPF (silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812)  { return L1_RF_RDA5812_LPF (silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815)  { return L1_RF_RDA5815_LPF (silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815)  { return L1_RF_RDA5815_LPF (silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150)  { return L1_RF_RDA5815M_LPF (silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150)  { return L1_RF_RDA5815M_LPF (silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index],  lpf_khz);}
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816)  { return L1_RF_RDA5816S_LPF(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816)  { return L1_RF_RDA5816S_LPF(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D)  { return L1_RF_RDA5816SD_LPF(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D)  { return L1_RF_RDA5816SD_LPF(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E)  { return L1_RF_RDA16110E_LPF(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], lpf_khz);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E)  { return L1_RF_RDA16110E_LPF(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], lpf_khz);}
 #endif /* SAT_TUNER_RDA16110E */
   return 0;
 }
 signed   int   SiLabs_SAT_Tuner_LoopThrough    (SILABS_SAT_TUNER_Context *silabs_tuner, signed   int  loop_through_enabled ) {
   SiTRACE("SiLabs_SAT_Tuner_LoopThrough loop_through_enabled %d (silabs_tuner->sat_tuner_code 0x%x)\n", loop_through_enabled, silabs_tuner->sat_tuner_code);
 #ifdef    SAT_TUNER_AV2012_future
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_LoopThrough(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_LoopThrough(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017_future
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_LoopThrough(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_LoopThrough(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_LoopThrough(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_LoopThrough(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], loop_through_enabled);}
 #endif /* SAT_TUNER_AV2018 */
   return 0;
 }
 signed   int   SiLabs_SAT_Tuner_Get_RF         (SILABS_SAT_TUNER_Context *silabs_tuner) {
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_Get_RF(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_Get_RF(silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_Get_RF(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_Get_RF(silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_Get_RF(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_Get_RF(silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Get_RF(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_Get_RF(silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return L1_RF_MAX2112_Get_RF(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return L1_RF_MAX2112_Get_RF(silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_Get_RF(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_Get_RF(silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return L1_RF_RDA5812_Get_RF(silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return L1_RF_RDA5812_Get_RF(silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return L1_RF_RDA5815_Get_RF(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return L1_RF_RDA5815_Get_RF(silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return L1_RF_RDA5815M_Get_RF(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return L1_RF_RDA5815M_Get_RF(silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return L1_RF_RDA5816S_Get_RF(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return L1_RF_RDA5816S_Get_RF(silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return L1_RF_RDA5816SD_Get_RF(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return L1_RF_RDA5816SD_Get_RF(silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return L1_RF_RDA16110E_Get_RF(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return L1_RF_RDA16110E_Get_RF(silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]); }
 #endif /* SAT_TUNER_RDA16110E */
   return silabs_tuner->RF;
 }
@@ -953,28 +978,28 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   SiTRACE("SiLabs_SAT_Tuner_Status\n");
   return_code = -1;
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) {
     return_code = 0;
     silabs_tuner->RF       = silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->RF;
     silabs_tuner->lpf_khz  = silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index]->LPF;
   }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) {
     return_code = 0;
     silabs_tuner->RF       = silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->RF;
     silabs_tuner->lpf_khz  = silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index]->LPF;
   }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) {
     return_code = 0;
     silabs_tuner->RF       = silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->RF;
     silabs_tuner->lpf_khz  = silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index]->LPF;
   }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) {
     return_code = 0;
     /* Keep the rssi line below in this code only if the rssi is directly retrieved from the SAT tuner */
     silabs_tuner->rssi     = L1_RF_CUSTOMSAT_RSSI  (silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], 0);
@@ -983,14 +1008,14 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) {
     return_code = 0;
     silabs_tuner->RF       = silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->RF;
     silabs_tuner->lpf_khz  = silabs_tuner->MAX2112_Tuner[silabs_tuner->tuner_index]->LPF;
   }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_NXP20142_RSSI  (silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->NXP20142_Tuner[silabs_tuner->tuner_index]->RF;
@@ -998,7 +1023,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) {
     return_code = 0;
     silabs_tuner->rssi     = 0;
     silabs_tuner->RF       = silabs_tuner->RDA5812_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1006,7 +1031,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_RDA5815_RSSI  (silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->RDA5815_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1014,7 +1039,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_RDA5815M_RSSI  (silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->RDA5815M_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1022,7 +1047,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_RDA5816S_RSSI  (silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->RDA5816S_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1030,7 +1055,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_RDA5816SD_RSSI  (silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1038,7 +1063,7 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
   }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) {
     return_code = 0;
     silabs_tuner->rssi     = L1_RF_RDA16110E_RSSI  (silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], 0);
     silabs_tuner->RF       = silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index]->RF;
@@ -1054,40 +1079,40 @@ signed   int   SiLabs_SAT_Tuner_Status         (SILABS_SAT_TUNER_Context *silabs
 const char*          SiLabs_SAT_Tuner_Tag            (SILABS_SAT_TUNER_Context *silabs_tuner) {
   SiTRACE("SiLabs_SAT_Tuner_Tag\n");
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) { return L1_RF_AV2012_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) { return L1_RF_AV2012_TAG_TEXT(); }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) { return L1_RF_AV2017_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) { return L1_RF_AV2017_TAG_TEXT(); }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) { return L1_RF_AV2018_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) { return L1_RF_AV2018_TAG_TEXT(); }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_CUSTOMSAT
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) { return L1_RF_CUSTOMSAT_TAG_TEXT(); }
 #endif /* SAT_TUNER_CUSTOMSAT */
 #ifdef    SAT_TUNER_MAX2112
-  if (silabs_tuner->sat_tuner_code == 0x2112) { return L1_RF_MAX2112_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x2112) { return L1_RF_MAX2112_TAG_TEXT(); }
 #endif /* SAT_TUNER_MAX2112 */
 #ifdef    SAT_TUNER_NXP20142
-  if (silabs_tuner->sat_tuner_code == 0x20142) { return L1_RF_NXP20142_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x20142) { return L1_RF_NXP20142_TAG_TEXT(); }
 #endif /* SAT_TUNER_NXP20142 */
 #ifdef    SAT_TUNER_RDA5812
-  if (silabs_tuner->sat_tuner_code == 0x5812) { return L1_RF_RDA5812_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5812) { return L1_RF_RDA5812_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA5812 */
 #ifdef    SAT_TUNER_RDA5815
-  if (silabs_tuner->sat_tuner_code == 0x5815) { return L1_RF_RDA5815_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5815) { return L1_RF_RDA5815_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA5815 */
 #ifdef    SAT_TUNER_RDA5815M
-  if (silabs_tuner->sat_tuner_code == 0x58150) { return L1_RF_RDA5815M_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58150) { return L1_RF_RDA5815M_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA5815M */
 #ifdef    SAT_TUNER_RDA5816S
-  if (silabs_tuner->sat_tuner_code == 0x5816) { return L1_RF_RDA5816S_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x5816) { return L1_RF_RDA5816S_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA5816S */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) { return L1_RF_RDA5816SD_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) { return L1_RF_RDA5816SD_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) { return L1_RF_RDA16110E_TAG_TEXT(); }
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) { return L1_RF_RDA16110E_TAG_TEXT(); }
 #endif /* SAT_TUNER_RDA16110E */
   return "unknown tuner_code";
 }
@@ -1096,38 +1121,38 @@ signed   int   SiLabs_SAT_Tuner_RSSI_From_AGC  (SILABS_SAT_TUNER_Context *silabs
   SiTRACE("SiLabs_SAT_Tuner_RSSI_From_AGC agc %d\n", agc);
   return_code = -1000;
 #ifdef    SAT_TUNER_AV2012
-  if (silabs_tuner->sat_tuner_code == 0xA2012) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2012) {
     silabs_tuner->rssi     = L1_RF_AV2012_RSSI  (silabs_tuner->AV2012_Tuner[silabs_tuner->tuner_index], agc);
     return silabs_tuner->rssi;
   }
 #endif /* SAT_TUNER_AV2012 */
 #ifdef    SAT_TUNER_AV2017
-  if (silabs_tuner->sat_tuner_code == 0xA2017) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2017) {
     silabs_tuner->rssi     = L1_RF_AV2017_RSSI  (silabs_tuner->AV2017_Tuner[silabs_tuner->tuner_index], agc);
     return silabs_tuner->rssi;
   }
 #endif /* SAT_TUNER_AV2017 */
 #ifdef    SAT_TUNER_AV2018
-  if (silabs_tuner->sat_tuner_code == 0xA2018) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0xA2018) {
     silabs_tuner->rssi     = L1_RF_AV2018_RSSI  (silabs_tuner->AV2018_Tuner[silabs_tuner->tuner_index], agc);
     return silabs_tuner->rssi;
   }
 #endif /* SAT_TUNER_AV2018 */
 #ifdef    SAT_TUNER_RDA5816SD
-  if (silabs_tuner->sat_tuner_code == 0x58165D) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x58165D) {
     silabs_tuner->rssi     = L1_RF_RDA5816SD_RSSI_from_AGC  (silabs_tuner->RDA5816SD_Tuner[silabs_tuner->tuner_index], agc);
     return silabs_tuner->rssi;
   }
 #endif /* SAT_TUNER_RDA5816SD */
 #ifdef    SAT_TUNER_RDA16110E
-  if (silabs_tuner->sat_tuner_code == 0x16110E) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == 0x16110E) {
     silabs_tuner->rssi     = L1_RF_RDA16110E_RSSI_from_AGC  (silabs_tuner->RDA16110E_Tuner[silabs_tuner->tuner_index], agc);
     return silabs_tuner->rssi;
   }
 #endif /* SAT_TUNER_RDA16110E */
 #ifdef    SAT_TUNER_CUSTOMSAT
   /* Keep this in the code only if the rssi is retrieved based on the agc level. Otherwise, return -1 */
-  if (silabs_tuner->sat_tuner_code == SAT_TUNER_CUSTOMSAT_CODE) {
+  if (SILABS_SAT_TUNER_CODE(silabs_tuner) == SAT_TUNER_CUSTOMSAT_CODE) {
     silabs_tuner->rssi     = L1_RF_CUSTOMSAT_RSSI  (silabs_tuner->CUSTOMSAT_Tuner[silabs_tuner->tuner_index], agc);
     return_code = silabs_tuner->rssi;
   }
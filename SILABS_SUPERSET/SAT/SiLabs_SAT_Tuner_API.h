@@ -49,6 +49,15 @@ limitations under the License.
  #endif /* SAT_TUNER_AV2012 */
 #endif /* SAT_TUNER_SILABS */
 
+/* Single-chip specialization: when SINGLE_CHIP_SAT_TUNER is defined at project level with the SAT tuner code  */
+/*  (i.e. -DSINGLE_CHIP_SAT_TUNER=0xA2018), the tuner code tests are compile-time constants, and each wrapper   */
+/*  function only keeps the calls to the selected tuner.                                                       */
+#ifdef    SINGLE_CHIP_SAT_TUNER
+ #define SILABS_SAT_TUNER_CODE(silabs_tuner)   ((void)(silabs_tuner), (SINGLE_CHIP_SAT_TUNER)) /* silabs_tuner evaluated to avoid unused parameter warnings */
+#else  /* SINGLE_CHIP_SAT_TUNER */
+ #define SILABS_SAT_TUNER_CODE(silabs_tuner)   ((silabs_tuner)->sat_tuner_code)
+#endif /* SINGLE_CHIP_SAT_TUNER */
+
 #include "Silabs_L0_API.h"
 
 /* Including header files for selected tuners */
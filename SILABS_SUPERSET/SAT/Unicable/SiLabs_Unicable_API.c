@@ -22,6 +22,13 @@ limitations under the License.
 /*-----------------------------------------------------------------------------------------------------------*/
 /* Change log:
 
+  As from 2026/10/19 (V2.6):
+    <improvement>[unicable/multi_receivers]
+      In SiLabs_Unicable_API_send_message: using system_wait instead of inline loops for the 18V settling time and the ODU reaction time.
+       This only makes the wait a sleep where system_wait sleeps (msleep with LINUX_KERNEL_DRIVER); it remains a busy wait otherwise.
+       The function is still blocking for the duration of one message; sharing the cable between receivers is handled by
+       SiLabs_API_L3_Wrapper_Unicable_Scheduler.c, which sends one message at a time and does not block between messages.
+
   As from 2019/10/30 (V2.5):
     <improvement>[unicable II/bank]
       In SiLabs_Unicable_API_Tune: setting option_bit to 1 if bank > 8 (only possible in Unicable II)
@@ -288,7 +295,7 @@ signed int   SiLabs_Unicable_API_send_message           (SILABS_Unicable_Context
   unicable->f_lnb_voltage (unicable->callback, 18);
   SiTRACE("LNB voltage set to 18 volts  after %d ms\n", system_time() - start_time );
   /* EN50494: 4 ms < td < 22 ms              */
-  while (system_time() < start_time + 5) {};
+  if (system_time() < start_time + 5) { system_wait(start_time + 5 - system_time()); }
 
   if (diseqc_prepared) {
     /* Trigger the DiSEqC message now                                            */
@@ -312,8 +319,8 @@ signed int   SiLabs_Unicable_API_send_message           (SILABS_Unicable_Context
   SiTRACE("LNB voltage set 13 volts     after %d ms\n", system_time() - start_time );
 
   start_time = system_time();
-  /* Wait for the Unicable equipment to react */
-  while (system_time() < start_time + unicable_change_time) { /* Wait for the time required by the upper layer */};
+  /* Wait for the Unicable equipment to react (for the time required by the upper layer) */
+  if (unicable_change_time > 0) { system_wait(unicable_change_time); }
 
   SiTRACE("Unicable message returning   after %d ms\n", system_time() - start_time );
   return 1;
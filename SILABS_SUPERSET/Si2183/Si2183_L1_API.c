@@ -27,6 +27,9 @@ limitations under the License.
 **************************************************************************************/
 /* Change log:
 
+ As from V0.3.5.2:
+   <improvement>[command/engine] In Si2183_L1_API_Patch: sending the patch bytes with the L0 command engine (L0_Patch).
+
  As from V0.2.5.0:
    <New_feature>[Config/DriveTS] In Si2183_L1_API_Init: setting TS property default strength and shape values, such that they can be
      controlled using SiLabs_API_TS_Strength_Shape and not get overwritten when calling Si2183_storeUserProperties.
@@ -232,24 +235,16 @@ unsigned char    Si2183_L1_API_Init      (L1_Si2183_Context *api, signed   int a
   Porting:    May not be required for the final application, can be removed if not used.
  ***********************************************************************************************************************/
 unsigned char    Si2183_L1_API_Patch     (L1_Si2183_Context *api, signed   int iNbBytes, unsigned char *pucDataBuffer) {
-    signed   int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2183 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2183_L1_API_Patch error writing bytes: %s\n", Si2183_L1_API_ERROR_TEXT(ERROR_Si2183_LOADING_FIRMWARE) );
-      return ERROR_Si2183_LOADING_FIRMWARE;
-    }
-
-    res = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2183_ERROR) {
-      SiTRACE("Si2183_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2183_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2183_POLLING_RESPONSE;
+      SiTRACE("Si2183_L1_API_Patch error 0x%02x: %s\n", res, Si2183_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2183_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2183_L1_CheckStatus function
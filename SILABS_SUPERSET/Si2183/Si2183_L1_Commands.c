@@ -27,6 +27,14 @@ limitations under the License.
 **************************************************************************************/
 /* Change log:
 
+ As from V0.3.5.2:
+   <improvement>[command/engine] Si2183_pollForCTS and Si2183_pollForResponse use the L0 command engine (L0_PollForCTS, L0_PollForResponse),
+     shared with the TER tuners. The debug bytes are now always read when the err bit is set, and the error byte is available in i2c->cmd_error.
+   <new_feature>[command/engine] Adding Si2183_sendCommand, used by all commands writing their bytes then polling the response.
+   <improvement>[command/engine] BAD_PROPERTY trace: tracing the property code (set_property.prop) instead of the property value (set_property.data).
+   <compatibility>[command/engine] The L0 command engine return values are returned unchanged as Si2183 error codes.
+     A compilation error is generated if the Si2183 error codes no longer match the L0_COMMAND_xxx codes.
+
  As from V0.3.3.1: Adding GSE_LITE value in possible DVBS2_STATUS.STREAM_TYPE values
 
  As from V0.3.3.0: In Si2183_convert_to_uint and  Si2183_convert_to_int: adding a set of parenthesis to shift all bytes
@@ -132,6 +140,17 @@ As from V0.1.3.0:
 #define   DEBUG_RANGE_CHECK
 #include "Si2183_Platform_Definition.h"
 
+/* The L0 command engine return values are returned unchanged as Si2183 error codes: the values must match */
+#if    (NO_Si2183_ERROR               != L0_COMMAND_NO_ERROR) \
+   || (ERROR_Si2183_SENDING_COMMAND  != L0_COMMAND_SENDING_COMMAND) \
+   || (ERROR_Si2183_CTS_TIMEOUT      != L0_COMMAND_CTS_TIMEOUT) \
+   || (ERROR_Si2183_ERR              != L0_COMMAND_ERR) \
+   || (ERROR_Si2183_POLLING_CTS      != L0_COMMAND_POLLING_CTS) \
+   || (ERROR_Si2183_POLLING_RESPONSE != L0_COMMAND_POLLING_RESPONSE) \
+   || (ERROR_Si2183_LOADING_FIRMWARE != L0_COMMAND_LOADING_FIRMWARE)
+  "If you get a compilation error on this line, it means that the Si2183 error codes no longer match the L0_COMMAND_xxx codes of Silabs_L0_API.h. Please map the L0_COMMAND_xxx codes in Si2183_pollForResponse, Si2183_sendCommand, Si2183_L1_API_Patch and Si2183_LoadFirmware!";
+#endif
+
 /******   conversion functions, used to fill command response fields ***************************************************
   These functions provide compatibility with 8 bytes processing on some compilers
  ***********************************************************************************************************************/
@@ -172,30 +191,13 @@ unsigned char Si2183_CurrentResponseStatus (L1_Si2183_Context *api, unsigned cha
               Used to check the CTS bit until it is set before sending the next command
   Comments:   The status byte definition being identical for all commands,
               using this function to fill the status structure helps reducing the code size
-              max timeout = 1000 ms
+              polled by the L0 command engine (L0_PollForCTS), max timeout = L0_COMMAND_TIMEOUT_MS
 
   Returns:   1 if the CTS bit is set, 0 otherwise
  ***********************************************************************************************************************/
 unsigned char Si2183_pollForCTS (L1_Si2183_Context *api)
 {
-  unsigned char rspByteBuffer[1];
-  unsigned int start_time;
-
-  start_time = system_time();
-
-  while (system_time() - start_time <1000)  { /* wait a maximum of 1000ms */
-    if (L0_ReadCommandBytes(api->i2c, 1, rspByteBuffer) != 1) {
-      SiTRACE("Si2183_pollForCTS ERROR reading byte 0!\n");
-      return ERROR_Si2183_POLLING_CTS;
-    }
-    /* return OK if CTS set */
-    if (rspByteBuffer[0] & 0x80) {
-      return NO_Si2183_ERROR;
-    }
-  }
-
-  SiTRACE("Si2183_pollForCTS ERROR CTS Timeout!\n");
-  return ERROR_Si2183_CTS_TIMEOUT;
+  return L0_PollForCTS(api->i2c);
 }
 
 /***********************************************************************************************************************
@@ -204,7 +206,7 @@ unsigned char Si2183_pollForCTS (L1_Si2183_Context *api)
               Used to retrieve the command response in the provided buffer
   Comments:   The status byte definition being identical for all commands,
               using this function to fill the status structure helps reducing the code size
-              max timeout = 1000 ms
+              polled by the L0 command engine (L0_PollForResponse), max timeout = L0_COMMAND_TIMEOUT_MS
 
   Parameter:  nbBytes          the number of response bytes to read
   Parameter:  pByteBuffer      a buffer into which bytes will be stored
@@ -212,55 +214,48 @@ unsigned char Si2183_pollForCTS (L1_Si2183_Context *api)
  ***********************************************************************************************************************/
 unsigned char Si2183_pollForResponse (L1_Si2183_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer)
 {
-  unsigned char debugBuffer[7];
-  unsigned int start_time;
-
-  start_time = system_time();
+  unsigned char error_code;
 
-  while (system_time() - start_time <1000)  { /* wait a maximum of 1000ms */
-    if ((unsigned int)L0_ReadCommandBytes(api->i2c, nbBytes, pByteBuffer) != nbBytes) {
-      SiTRACE("Si2183_pollForResponse ERROR reading byte 0!\n");
-      return ERROR_Si2183_POLLING_RESPONSE;
-    }
-    /* return response err flag if CTS set */
-    if (pByteBuffer[0] & 0x80)  {
-      /* for debug purpose, read and trace 2 bytes in case the error bit is set */
-      if (pByteBuffer[0] & 0x40)  {
-        L0_ReadCommandBytes(api->i2c, 7, &(debugBuffer[0]) );
+  error_code = L0_PollForResponse(api->i2c, nbBytes, pByteBuffer);
+  if ((error_code != NO_Si2183_ERROR) && (error_code != ERROR_Si2183_ERR)) {
+    return error_code;
+  }
   #ifdef   SiTRACES
-/* debug bytes codes
-  STATUS_ERR                   0x40
-  ERROR_NONE                   0x00
-  ERROR_BAD_COMMAND            0x10
-  ERROR_BAD_ARG1               0x11
-  ERROR_BAD_ARG2               0x12
-  ERROR_BAD_ARG3               0x13
-  ERROR_BAD_ARG4               0x14
-  ERROR_BAD_ARG5               0x15
-  ERROR_BAD_ARG6               0x16
-  ERROR_BAD_ARG7               0x17
-  ERROR_BAD_STANDARD           0x18
-  ERROR_BAD_PROPERTY           0x20
-  ERROR_BAD_BOOTMODE           0x30
-  ERROR_BAD_PATCH              0x31
-  ERROR_BAD_NVM                0x32
-*/
-        SiTRACE("Si2183 debug bytes 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x\n", debugBuffer[0], debugBuffer[1], debugBuffer[2], debugBuffer[3], debugBuffer[4], debugBuffer[5], debugBuffer[6]);
-        if ( pByteBuffer[1] == 0x10) { SiTRACE("BAD_COMMAND\n");  }
-        if ((pByteBuffer[1] >= 0x10) && (pByteBuffer[1] <= 0x17)) { SiTRACE("BAD_ARG%d\n",pByteBuffer[1]&0x0f);            }
-        if ( pByteBuffer[1] == 0x18) { SiTRACE("BAD_STANDARD (not supported by part '%02d')\n", api->rsp->part_info.part); }
-        if ( pByteBuffer[1] == 0x20) { SiTRACE("BAD_PROPERTY 0x%04x\n", api->cmd->set_property.data); }
-        if ( pByteBuffer[1] == 0x30) { SiTRACE("BAD_BOOTMODE\n"); }
-        if ( pByteBuffer[1] == 0x31) { SiTRACE("BAD_PATCH\n");    }
-        if ( pByteBuffer[1] == 0x32) { SiTRACE("BAD_NVM\n");      }
-  #endif /* SiTRACES */
-      }
-      return Si2183_CurrentResponseStatus(api, pByteBuffer[0]);
-    }
+  if (error_code == ERROR_Si2183_ERR) {
+    if (api->i2c->cmd_error == 0x18) { SiTRACE("BAD_STANDARD (not supported by part '%02d')\n", api->rsp->part_info.part); }
+    if (api->i2c->cmd_error == 0x20) { SiTRACE("BAD_PROPERTY 0x%04x\n", api->cmd->set_property.prop); }
   }
+  #endif /* SiTRACES */
+  return Si2183_CurrentResponseStatus(api, pByteBuffer[0]);
+}
+/***********************************************************************************************************************
+  Si2183_sendCommand function
+  Use:        command sending function
+              Used to send a command and retrieve its response in the provided buffer
+  Comments:   The command is written and its response polled by the L0 command engine (L0_SendCommand),
+              max timeout = L0_COMMAND_TIMEOUT_MS
+
+  Parameter:  nbCmdBytes       the number of command bytes
+  Parameter:  cmdByteBuffer    a buffer containing the command bytes
+  Parameter:  nbRspBytes       the number of response bytes to read
+  Parameter:  rspByteBuffer    a buffer into which response bytes will be stored
+  Returns:    0 if no error, an error code otherwise
+ ***********************************************************************************************************************/
+unsigned char Si2183_sendCommand (L1_Si2183_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer)
+{
+  unsigned char error_code;
 
-  SiTRACE("Si2183_pollForResponse ERROR CTS Timeout!\n");
-  return ERROR_Si2183_CTS_TIMEOUT;
+  error_code = L0_SendCommand(api->i2c, nbCmdBytes, cmdByteBuffer, nbRspBytes, rspByteBuffer);
+  if ((error_code != NO_Si2183_ERROR) && (error_code != ERROR_Si2183_ERR)) {
+    return error_code;
+  }
+  #ifdef   SiTRACES
+  if (error_code == ERROR_Si2183_ERR) {
+    if (api->i2c->cmd_error == 0x18) { SiTRACE("BAD_STANDARD (not supported by part '%02d')\n", api->rsp->part_info.part); }
+    if (api->i2c->cmd_error == 0x20) { SiTRACE("BAD_PROPERTY 0x%04x\n", api->cmd->set_property.prop); }
+  }
+  #endif /* SiTRACES */
+  return Si2183_CurrentResponseStatus(api, rspByteBuffer[0]);
 }
 
 #ifdef    Si2183_CONFIG_CLKIO_CMD
@@ -294,14 +289,9 @@ unsigned char Si2183_L1_CONFIG_CLKIO              (L1_Si2183_Context *api,
                                          ( pre_driver_str & Si2183_CONFIG_CLKIO_CMD_PRE_DRIVER_STR_MASK ) << Si2183_CONFIG_CLKIO_CMD_PRE_DRIVER_STR_LSB|
                                          ( driver_str     & Si2183_CONFIG_CLKIO_CMD_DRIVER_STR_MASK     ) << Si2183_CONFIG_CLKIO_CMD_DRIVER_STR_LSB    );
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing CONFIG_CLKIO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling CONFIG_CLKIO response\n");
+      SiTRACE("Error sending CONFIG_CLKIO command\n");
       return error_code;
     }
 
@@ -385,14 +375,9 @@ unsigned char Si2183_L1_CONFIG_PINS               (L1_Si2183_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( gpio1_mode & Si2183_CONFIG_PINS_CMD_GPIO1_MODE_MASK ) << Si2183_CONFIG_PINS_CMD_GPIO1_MODE_LSB|
                                          ( gpio1_read & Si2183_CONFIG_PINS_CMD_GPIO1_READ_MASK ) << Si2183_CONFIG_PINS_CMD_GPIO1_READ_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 3, cmdByteBuffer) != 3) {
-      SiTRACE("Error writing CONFIG_PINS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 3, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling CONFIG_PINS response\n");
+      SiTRACE("Error sending CONFIG_PINS command\n");
       return error_code;
     }
 
@@ -431,14 +416,9 @@ unsigned char Si2183_L1_DD_BER                    (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_BER_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( rst & Si2183_DD_BER_CMD_RST_MASK ) << Si2183_DD_BER_CMD_RST_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_BER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_BER response\n");
+      SiTRACE("Error sending DD_BER command\n");
       return error_code;
     }
 
@@ -475,14 +455,9 @@ unsigned char Si2183_L1_DD_CBER                   (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_CBER_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( rst & Si2183_DD_CBER_CMD_RST_MASK ) << Si2183_DD_CBER_CMD_RST_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_CBER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_CBER response\n");
+      SiTRACE("Error sending DD_CBER command\n");
       return error_code;
     }
 
@@ -548,14 +523,9 @@ unsigned char Si2183_L1_DD_DISEQC_SEND            (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ( ( msg_byte5  & Si2183_DD_DISEQC_SEND_CMD_MSG_BYTE5_MASK  ) << Si2183_DD_DISEQC_SEND_CMD_MSG_BYTE5_LSB );
     cmdByteBuffer[7] = (unsigned char) ( ( msg_byte6  & Si2183_DD_DISEQC_SEND_CMD_MSG_BYTE6_MASK  ) << Si2183_DD_DISEQC_SEND_CMD_MSG_BYTE6_LSB );
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DD_DISEQC_SEND bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_DISEQC_SEND response\n");
+      SiTRACE("Error sending DD_DISEQC_SEND command\n");
       return error_code;
     }
 
@@ -588,14 +558,9 @@ unsigned char Si2183_L1_DD_DISEQC_STATUS          (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_DISEQC_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( listen & Si2183_DD_DISEQC_STATUS_CMD_LISTEN_MASK ) << Si2183_DD_DISEQC_STATUS_CMD_LISTEN_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_DISEQC_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 5, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 5, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_DISEQC_STATUS response\n");
+      SiTRACE("Error sending DD_DISEQC_STATUS command\n");
       return error_code;
     }
 
@@ -660,14 +625,9 @@ unsigned char Si2183_L1_DD_EXT_AGC_SAT            (L1_Si2183_Context *api,
     cmdByteBuffer[4] = (unsigned char) ( ( agc_1_min   & Si2183_DD_EXT_AGC_SAT_CMD_AGC_1_MIN_MASK   ) << Si2183_DD_EXT_AGC_SAT_CMD_AGC_1_MIN_LSB  );
     cmdByteBuffer[5] = (unsigned char) ( ( agc_2_min   & Si2183_DD_EXT_AGC_SAT_CMD_AGC_2_MIN_MASK   ) << Si2183_DD_EXT_AGC_SAT_CMD_AGC_2_MIN_LSB  );
 
-    if (L0_WriteCommandBytes(api->i2c, 6, cmdByteBuffer) != 6) {
-      SiTRACE("Error writing DD_EXT_AGC_SAT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 6, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_EXT_AGC_SAT response\n");
+      SiTRACE("Error sending DD_EXT_AGC_SAT command\n");
       return error_code;
     }
 
@@ -728,14 +688,9 @@ unsigned char Si2183_L1_DD_EXT_AGC_TER            (L1_Si2183_Context *api,
     cmdByteBuffer[4] = (unsigned char) ( ( agc_1_min   & Si2183_DD_EXT_AGC_TER_CMD_AGC_1_MIN_MASK   ) << Si2183_DD_EXT_AGC_TER_CMD_AGC_1_MIN_LSB  );
     cmdByteBuffer[5] = (unsigned char) ( ( agc_2_min   & Si2183_DD_EXT_AGC_TER_CMD_AGC_2_MIN_MASK   ) << Si2183_DD_EXT_AGC_TER_CMD_AGC_2_MIN_LSB  );
 
-    if (L0_WriteCommandBytes(api->i2c, 6, cmdByteBuffer) != 6) {
-      SiTRACE("Error writing DD_EXT_AGC_TER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 6, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_EXT_AGC_TER response\n");
+      SiTRACE("Error sending DD_EXT_AGC_TER command\n");
       return error_code;
     }
 
@@ -774,14 +729,9 @@ unsigned char Si2183_L1_DD_FER                    (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_FER_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( rst & Si2183_DD_FER_CMD_RST_MASK ) << Si2183_DD_FER_CMD_RST_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_FER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_FER response\n");
+      SiTRACE("Error sending DD_FER command\n");
       return error_code;
     }
 
@@ -820,14 +770,9 @@ unsigned char Si2183_L1_DD_GET_REG                (L1_Si2183_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( reg_code_mid & Si2183_DD_GET_REG_CMD_REG_CODE_MID_MASK ) << Si2183_DD_GET_REG_CMD_REG_CODE_MID_LSB);
     cmdByteBuffer[3] = (unsigned char) ( ( reg_code_msb & Si2183_DD_GET_REG_CMD_REG_CODE_MSB_MASK ) << Si2183_DD_GET_REG_CMD_REG_CODE_MSB_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing DD_GET_REG bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 5, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 4, cmdByteBuffer, 5, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_GET_REG response\n");
+      SiTRACE("Error sending DD_GET_REG command\n");
       return error_code;
     }
 
@@ -875,14 +820,9 @@ unsigned char Si2183_L1_DD_MP_DEFAULTS            (L1_Si2183_Context *api,
     cmdByteBuffer[3] = (unsigned char) ( ( mp_c_mode & Si2183_DD_MP_DEFAULTS_CMD_MP_C_MODE_MASK ) << Si2183_DD_MP_DEFAULTS_CMD_MP_C_MODE_LSB);
     cmdByteBuffer[4] = (unsigned char) ( ( mp_d_mode & Si2183_DD_MP_DEFAULTS_CMD_MP_D_MODE_MASK ) << Si2183_DD_MP_DEFAULTS_CMD_MP_D_MODE_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 5, cmdByteBuffer) != 5) {
-      SiTRACE("Error writing DD_MP_DEFAULTS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 5, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 5, cmdByteBuffer, 5, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_MP_DEFAULTS response\n");
+      SiTRACE("Error sending DD_MP_DEFAULTS command\n");
       return error_code;
     }
 
@@ -921,14 +861,9 @@ unsigned char Si2183_L1_DD_PER                    (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_PER_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( rst & Si2183_DD_PER_CMD_RST_MASK ) << Si2183_DD_PER_CMD_RST_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_PER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_PER response\n");
+      SiTRACE("Error sending DD_PER command\n");
       return error_code;
     }
 
@@ -991,7 +926,7 @@ unsigned char Si2183_L1_DD_RESTART_EXT            (L1_Si2183_Context *api,
   #ifdef   DEBUG_RANGE_CHECK
     if ((freq_plan        > Si2183_DD_RESTART_EXT_CMD_FREQ_PLAN_MAX       ) ) {error_code++; SiTRACE("\nOut of range: ");}; SiTRACE("FREQ_PLAN %d "       , freq_plan        );
     if ((freq_plan_ts_clk > Si2183_DD_RESTART_EXT_CMD_FREQ_PLAN_TS_CLK_MAX) ) {error_code++; SiTRACE("\nOut of range: ");}; SiTRACE("FREQ_PLAN_TS_CLK %d ", freq_plan_ts_clk );
-    SiTRACE("TUNED_RF_FREQ %ld "   , tuned_rf_freq    );
+    SiTRACE("TUNED_RF_FREQ %ld "   , tuned_rf_freq    );
     if (error_code) {
       SiTRACE("%d out of range parameters\n", error_code);
       return ERROR_Si2183_PARAMETER_OUT_OF_RANGE;
@@ -1009,14 +944,9 @@ unsigned char Si2183_L1_DD_RESTART_EXT            (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( tuned_rf_freq    & Si2183_DD_RESTART_EXT_CMD_TUNED_RF_FREQ_MASK    ) << Si2183_DD_RESTART_EXT_CMD_TUNED_RF_FREQ_LSB   )>>16);
     cmdByteBuffer[7] = (unsigned char) ((( tuned_rf_freq    & Si2183_DD_RESTART_EXT_CMD_TUNED_RF_FREQ_MASK    ) << Si2183_DD_RESTART_EXT_CMD_TUNED_RF_FREQ_LSB   )>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DD_RESTART_EXT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_RESTART_EXT response\n");
+      SiTRACE("Error sending DD_RESTART_EXT command\n");
       return error_code;
     }
 
@@ -1057,14 +987,9 @@ unsigned char Si2183_L1_DD_SET_REG                (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( value        & Si2183_DD_SET_REG_CMD_VALUE_MASK        ) << Si2183_DD_SET_REG_CMD_VALUE_LSB       )>>16);
     cmdByteBuffer[7] = (unsigned char) ((( value        & Si2183_DD_SET_REG_CMD_VALUE_MASK        ) << Si2183_DD_SET_REG_CMD_VALUE_LSB       )>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DD_SET_REG bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_SET_REG response\n");
+      SiTRACE("Error sending DD_SET_REG command\n");
       return error_code;
     }
 
@@ -1090,14 +1015,9 @@ unsigned char Si2183_L1_DD_SSI_SQI                (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_SSI_SQI_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( tuner_rssi & Si2183_DD_SSI_SQI_CMD_TUNER_RSSI_MASK ) << Si2183_DD_SSI_SQI_CMD_TUNER_RSSI_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_SSI_SQI bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_SSI_SQI response\n");
+      SiTRACE("Error sending DD_SSI_SQI command\n");
       return error_code;
     }
 
@@ -1134,14 +1054,9 @@ unsigned char Si2183_L1_DD_STATUS                 (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DD_STATUS_CMD_INTACK_MASK ) << Si2183_DD_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 8, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 8, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_STATUS response\n");
+      SiTRACE("Error sending DD_STATUS command\n");
       return error_code;
     }
 
@@ -1214,7 +1129,7 @@ unsigned char Si2183_L1_DD_TS_PINS                (L1_Si2183_Context *api,
       if (demod_role       == Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_CHANNEL_BONDING_OFF ) {SiTRACE(" DEMOD_ROLE  CHANNEL_BONDING_OFF  "   ); }
       if (demod_role       == Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_SLAVE               ) {SiTRACE(" DEMOD_ROLE  SLAVE                "   ); }
       if (demod_role       == Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_SLAVE_BRIDGE        ) {SiTRACE(" DEMOD_ROLE  SLAVE_BRIDGE         "   ); }
-    SiTRACE("MASTER_FREQ  %ld  ", master_freq);
+    SiTRACE("MASTER_FREQ  %ld  ", master_freq);
     if (error_code) {
       SiTRACE("%d out of range parameters\n", error_code);
       return ERROR_Si2183_PARAMETER_OUT_OF_RANGE;
@@ -1237,14 +1152,9 @@ unsigned char Si2183_L1_DD_TS_PINS                (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( master_freq           & Si2183_DD_TS_PINS_CMD_MASTER_FREQ_MASK           ) << Si2183_DD_TS_PINS_CMD_MASTER_FREQ_LSB          )>>16);
     cmdByteBuffer[7] = (unsigned char) ((( master_freq           & Si2183_DD_TS_PINS_CMD_MASTER_FREQ_MASK           ) << Si2183_DD_TS_PINS_CMD_MASTER_FREQ_LSB          )>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DD_TS_PINS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_TS_PINS response\n");
+      SiTRACE("Error sending DD_TS_PINS command\n");
       return error_code;
     }
 
@@ -1283,14 +1193,9 @@ unsigned char Si2183_L1_DD_UNCOR                  (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DD_UNCOR_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( rst & Si2183_DD_UNCOR_CMD_RST_MASK ) << Si2183_DD_UNCOR_CMD_RST_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DD_UNCOR bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DD_UNCOR response\n");
+      SiTRACE("Error sending DD_UNCOR command\n");
       return error_code;
     }
 
@@ -1317,14 +1222,9 @@ unsigned char Si2183_L1_DEMOD_INFO                (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_DEMOD_INFO_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing DEMOD_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 6, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 6, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DEMOD_INFO response\n");
+      SiTRACE("Error sending DEMOD_INFO command\n");
       return error_code;
     }
 
@@ -1376,14 +1276,9 @@ unsigned char Si2183_L1_DOWNLOAD_DATASET_CONTINUE (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ( ( data5 & Si2183_DOWNLOAD_DATASET_CONTINUE_CMD_DATA5_MASK ) << Si2183_DOWNLOAD_DATASET_CONTINUE_CMD_DATA5_LSB);
     cmdByteBuffer[7] = (unsigned char) ( ( data6 & Si2183_DOWNLOAD_DATASET_CONTINUE_CMD_DATA6_MASK ) << Si2183_DOWNLOAD_DATASET_CONTINUE_CMD_DATA6_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DOWNLOAD_DATASET_CONTINUE bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DOWNLOAD_DATASET_CONTINUE response\n");
+      SiTRACE("Error sending DOWNLOAD_DATASET_CONTINUE command\n");
       return error_code;
     }
 
@@ -1434,14 +1329,9 @@ unsigned char Si2183_L1_DOWNLOAD_DATASET_START    (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ( ( data3            & Si2183_DOWNLOAD_DATASET_START_CMD_DATA3_MASK            ) << Si2183_DOWNLOAD_DATASET_START_CMD_DATA3_LSB           );
     cmdByteBuffer[7] = (unsigned char) ( ( data4            & Si2183_DOWNLOAD_DATASET_START_CMD_DATA4_MASK            ) << Si2183_DOWNLOAD_DATASET_START_CMD_DATA4_LSB           );
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DOWNLOAD_DATASET_START bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DOWNLOAD_DATASET_START response\n");
+      SiTRACE("Error sending DOWNLOAD_DATASET_START command\n");
       return error_code;
     }
 
@@ -1483,14 +1373,9 @@ unsigned char Si2183_L1_DVBC2_CTRL                (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( tuned_rf_freq & Si2183_DVBC2_CTRL_CMD_TUNED_RF_FREQ_MASK ) << Si2183_DVBC2_CTRL_CMD_TUNED_RF_FREQ_LSB)>>16);
     cmdByteBuffer[7] = (unsigned char) ((( tuned_rf_freq & Si2183_DVBC2_CTRL_CMD_TUNED_RF_FREQ_MASK ) << Si2183_DVBC2_CTRL_CMD_TUNED_RF_FREQ_LSB)>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DVBC2_CTRL bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_CTRL response\n");
+      SiTRACE("Error sending DVBC2_CTRL command\n");
       return error_code;
     }
 
@@ -1526,14 +1411,9 @@ unsigned char Si2183_L1_DVBC2_DS_INFO             (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( ds_index_or_id        & Si2183_DVBC2_DS_INFO_CMD_DS_INDEX_OR_ID_MASK        ) << Si2183_DVBC2_DS_INFO_CMD_DS_INDEX_OR_ID_LSB       );
     cmdByteBuffer[2] = (unsigned char) ( ( ds_select_index_or_id & Si2183_DVBC2_DS_INFO_CMD_DS_SELECT_INDEX_OR_ID_MASK ) << Si2183_DVBC2_DS_INFO_CMD_DS_SELECT_INDEX_OR_ID_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 3, cmdByteBuffer) != 3) {
-      SiTRACE("Error writing DVBC2_DS_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 8, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 3, cmdByteBuffer, 8, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_DS_INFO response\n");
+      SiTRACE("Error sending DVBC2_DS_INFO command\n");
       return error_code;
     }
 
@@ -1578,14 +1458,9 @@ unsigned char Si2183_L1_DVBC2_DS_PLP_SELECT       (L1_Si2183_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( id_sel_mode & Si2183_DVBC2_DS_PLP_SELECT_CMD_ID_SEL_MODE_MASK ) << Si2183_DVBC2_DS_PLP_SELECT_CMD_ID_SEL_MODE_LSB);
     cmdByteBuffer[3] = (unsigned char) ( ( ds_id       & Si2183_DVBC2_DS_PLP_SELECT_CMD_DS_ID_MASK       ) << Si2183_DVBC2_DS_PLP_SELECT_CMD_DS_ID_LSB      );
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing DVBC2_DS_PLP_SELECT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 4, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_DS_PLP_SELECT response\n");
+      SiTRACE("Error sending DVBC2_DS_PLP_SELECT command\n");
       return error_code;
     }
 
@@ -1624,14 +1499,9 @@ unsigned char Si2183_L1_DVBC2_PLP_INFO            (L1_Si2183_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( plp_info_ds_mode & Si2183_DVBC2_PLP_INFO_CMD_PLP_INFO_DS_MODE_MASK ) << Si2183_DVBC2_PLP_INFO_CMD_PLP_INFO_DS_MODE_LSB);
     cmdByteBuffer[3] = (unsigned char) ( ( ds_index         & Si2183_DVBC2_PLP_INFO_CMD_DS_INDEX_MASK         ) << Si2183_DVBC2_PLP_INFO_CMD_DS_INDEX_LSB        );
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing DVBC2_PLP_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 4, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_PLP_INFO response\n");
+      SiTRACE("Error sending DVBC2_PLP_INFO command\n");
       return error_code;
     }
 
@@ -1670,14 +1540,9 @@ unsigned char Si2183_L1_DVBC2_STATUS              (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBC2_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBC2_STATUS_CMD_INTACK_MASK ) << Si2183_DVBC2_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBC2_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 16, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 16, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_STATUS response\n");
+      SiTRACE("Error sending DVBC2_STATUS command\n");
       return error_code;
     }
 
@@ -1727,14 +1592,9 @@ unsigned char Si2183_L1_DVBC2_SYS_INFO            (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_DVBC2_SYS_INFO_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing DVBC2_SYS_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 16, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 16, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC2_SYS_INFO response\n");
+      SiTRACE("Error sending DVBC2_SYS_INFO command\n");
       return error_code;
     }
 
@@ -1781,14 +1641,9 @@ unsigned char Si2183_L1_DVBC_STATUS               (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBC_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBC_STATUS_CMD_INTACK_MASK ) << Si2183_DVBC_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBC_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 9, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 9, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBC_STATUS response\n");
+      SiTRACE("Error sending DVBC_STATUS command\n");
       return error_code;
     }
 
@@ -1848,7 +1703,7 @@ unsigned char Si2183_L1_DVBS2_PLS_INIT            (L1_Si2183_Context *api,
     SiTRACE("Si2183 DVBS2_PLS_INIT ");
   #ifdef   DEBUG_RANGE_CHECK
     if ((pls_detection_mode > Si2183_DVBS2_PLS_INIT_CMD_PLS_DETECTION_MODE_MAX) ) {error_code++; SiTRACE("\nOut of range: ");}; SiTRACE("PLS_DETECTION_MODE %d ", pls_detection_mode );
-    if ((pls                > Si2183_DVBS2_PLS_INIT_CMD_PLS_MAX               ) ) {error_code++; SiTRACE("\nOut of range: ");}; SiTRACE("PLS %ld "               , pls                );
+    if ((pls                > Si2183_DVBS2_PLS_INIT_CMD_PLS_MAX               ) ) {error_code++; SiTRACE("\nOut of range: ");}; SiTRACE("PLS %ld "               , pls                );
     if (error_code) {
       SiTRACE("%d out of range parameters\n", error_code);
       return ERROR_Si2183_PARAMETER_OUT_OF_RANGE;
@@ -1865,14 +1720,9 @@ unsigned char Si2183_L1_DVBS2_PLS_INIT            (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( pls                & Si2183_DVBS2_PLS_INIT_CMD_PLS_MASK                ) << Si2183_DVBS2_PLS_INIT_CMD_PLS_LSB               )>>16);
     cmdByteBuffer[7] = (unsigned char) ((( pls                & Si2183_DVBS2_PLS_INIT_CMD_PLS_MASK                ) << Si2183_DVBS2_PLS_INIT_CMD_PLS_LSB               )>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing DVBS2_PLS_INIT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBS2_PLS_INIT response\n");
+      SiTRACE("Error sending DVBS2_PLS_INIT command\n");
       return error_code;
     }
 
@@ -1917,14 +1767,9 @@ unsigned char Si2183_L1_DVBS2_STATUS              (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBS2_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBS2_STATUS_CMD_INTACK_MASK ) << Si2183_DVBS2_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBS2_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 13, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 13, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBS2_STATUS response\n");
+      SiTRACE("Error sending DVBS2_STATUS command\n");
       return error_code;
     }
 
@@ -2016,14 +1861,9 @@ unsigned char Si2183_L1_DVBS2_STREAM_INFO         (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBS2_STREAM_INFO_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( isi_index & Si2183_DVBS2_STREAM_INFO_CMD_ISI_INDEX_MASK ) << Si2183_DVBS2_STREAM_INFO_CMD_ISI_INDEX_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBS2_STREAM_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBS2_STREAM_INFO response\n");
+      SiTRACE("Error sending DVBS2_STREAM_INFO command\n");
       return error_code;
     }
 
@@ -2064,14 +1904,9 @@ unsigned char Si2183_L1_DVBS2_STREAM_SELECT       (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( stream_id       & Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_ID_MASK       ) << Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_ID_LSB      );
     cmdByteBuffer[2] = (unsigned char) ( ( stream_sel_mode & Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_SEL_MODE_MASK ) << Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_SEL_MODE_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 3, cmdByteBuffer) != 3) {
-      SiTRACE("Error writing DVBS2_STREAM_SELECT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 3, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBS2_STREAM_SELECT response\n");
+      SiTRACE("Error sending DVBS2_STREAM_SELECT command\n");
       return error_code;
     }
 
@@ -2109,14 +1944,9 @@ unsigned char Si2183_L1_DVBS_STATUS               (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBS_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBS_STATUS_CMD_INTACK_MASK ) << Si2183_DVBS_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBS_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 10, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 10, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBS_STATUS response\n");
+      SiTRACE("Error sending DVBS_STATUS command\n");
       return error_code;
     }
 
@@ -2185,14 +2015,9 @@ unsigned char Si2183_L1_DVBT2_FEF                 (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( fef_tuner_flag     & Si2183_DVBT2_FEF_CMD_FEF_TUNER_FLAG_MASK     ) << Si2183_DVBT2_FEF_CMD_FEF_TUNER_FLAG_LSB    |
                                          ( fef_tuner_flag_inv & Si2183_DVBT2_FEF_CMD_FEF_TUNER_FLAG_INV_MASK ) << Si2183_DVBT2_FEF_CMD_FEF_TUNER_FLAG_INV_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBT2_FEF bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 12, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 12, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT2_FEF response\n");
+      SiTRACE("Error sending DVBT2_FEF command\n");
       return error_code;
     }
 
@@ -2226,14 +2051,9 @@ unsigned char Si2183_L1_DVBT2_PLP_INFO            (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBT2_PLP_INFO_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( plp_index & Si2183_DVBT2_PLP_INFO_CMD_PLP_INDEX_MASK ) << Si2183_DVBT2_PLP_INFO_CMD_PLP_INDEX_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBT2_PLP_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 13, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 13, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT2_PLP_INFO response\n");
+      SiTRACE("Error sending DVBT2_PLP_INFO command\n");
       return error_code;
     }
 
@@ -2299,14 +2119,9 @@ unsigned char Si2183_L1_DVBT2_PLP_SELECT          (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( plp_id          & Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_MASK          ) << Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_LSB         );
     cmdByteBuffer[2] = (unsigned char) ( ( plp_id_sel_mode & Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_SEL_MODE_MASK ) << Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_SEL_MODE_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 3, cmdByteBuffer) != 3) {
-      SiTRACE("Error writing DVBT2_PLP_SELECT bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 3, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT2_PLP_SELECT response\n");
+      SiTRACE("Error sending DVBT2_PLP_SELECT command\n");
       return error_code;
     }
 
@@ -2339,14 +2154,9 @@ unsigned char Si2183_L1_DVBT2_STATUS              (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBT2_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBT2_STATUS_CMD_INTACK_MASK ) << Si2183_DVBT2_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBT2_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 15, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 15, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT2_STATUS response\n");
+      SiTRACE("Error sending DVBT2_STATUS command\n");
       return error_code;
     }
 
@@ -2400,14 +2210,9 @@ unsigned char Si2183_L1_DVBT2_TX_ID               (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_DVBT2_TX_ID_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing DVBT2_TX_ID bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 8, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 8, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT2_TX_ID response\n");
+      SiTRACE("Error sending DVBT2_TX_ID command\n");
       return error_code;
     }
 
@@ -2449,14 +2254,9 @@ unsigned char Si2183_L1_DVBT_STATUS               (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_DVBT_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_DVBT_STATUS_CMD_INTACK_MASK ) << Si2183_DVBT_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DVBT_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 13, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 13, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT_STATUS response\n");
+      SiTRACE("Error sending DVBT_STATUS command\n");
       return error_code;
     }
 
@@ -2502,14 +2302,9 @@ unsigned char Si2183_L1_DVBT_TPS_EXTRA            (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_DVBT_TPS_EXTRA_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing DVBT_TPS_EXTRA bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 6, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 6, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DVBT_TPS_EXTRA response\n");
+      SiTRACE("Error sending DVBT_TPS_EXTRA command\n");
       return error_code;
     }
 
@@ -2559,14 +2354,9 @@ unsigned char Si2183_L1_EXIT_BOOTLOADER           (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( func   & Si2183_EXIT_BOOTLOADER_CMD_FUNC_MASK   ) << Si2183_EXIT_BOOTLOADER_CMD_FUNC_LSB  |
                                          ( ctsien & Si2183_EXIT_BOOTLOADER_CMD_CTSIEN_MASK ) << Si2183_EXIT_BOOTLOADER_CMD_CTSIEN_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing EXIT_BOOTLOADER bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling EXIT_BOOTLOADER response\n");
+      SiTRACE("Error sending EXIT_BOOTLOADER command\n");
       return error_code;
     }
 
@@ -2603,14 +2393,9 @@ unsigned char Si2183_L1_GET_PROPERTY              (L1_Si2183_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( prop     & Si2183_GET_PROPERTY_CMD_PROP_MASK     ) << Si2183_GET_PROPERTY_CMD_PROP_LSB    );
     cmdByteBuffer[3] = (unsigned char) ((( prop     & Si2183_GET_PROPERTY_CMD_PROP_MASK     ) << Si2183_GET_PROPERTY_CMD_PROP_LSB    )>>8);
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing GET_PROPERTY bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 4, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling GET_PROPERTY response\n");
+      SiTRACE("Error sending GET_PROPERTY command\n");
       return error_code;
     }
 
@@ -2637,14 +2422,9 @@ unsigned char Si2183_L1_GET_REV                   (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_GET_REV_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing GET_REV bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 13, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 13, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling GET_REV response\n");
+      SiTRACE("Error sending GET_REV command\n");
       return error_code;
     }
 
@@ -2734,14 +2514,9 @@ unsigned char Si2183_L1_ISDBT_AC_BITS             (L1_Si2183_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( byte_read_offset & Si2183_ISDBT_AC_BITS_CMD_BYTE_READ_OFFSET_MASK ) << Si2183_ISDBT_AC_BITS_CMD_BYTE_READ_OFFSET_LSB);
     cmdByteBuffer[2] = (unsigned char) ( ( freeze_buffer    & Si2183_ISDBT_AC_BITS_CMD_FREEZE_BUFFER_MASK    ) << Si2183_ISDBT_AC_BITS_CMD_FREEZE_BUFFER_LSB   );
 
-    if (L0_WriteCommandBytes(api->i2c, 3, cmdByteBuffer) != 3) {
-      SiTRACE("Error writing ISDBT_AC_BITS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 16, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 3, cmdByteBuffer, 16, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling ISDBT_AC_BITS response\n");
+      SiTRACE("Error sending ISDBT_AC_BITS command\n");
       return error_code;
     }
 
@@ -2791,14 +2566,9 @@ unsigned char Si2183_L1_ISDBT_LAYER_INFO          (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_ISDBT_LAYER_INFO_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( layer_index & Si2183_ISDBT_LAYER_INFO_CMD_LAYER_INDEX_MASK ) << Si2183_ISDBT_LAYER_INFO_CMD_LAYER_INDEX_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing ISDBT_LAYER_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 3, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 3, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling ISDBT_LAYER_INFO response\n");
+      SiTRACE("Error sending ISDBT_LAYER_INFO command\n");
       return error_code;
     }
 
@@ -2837,14 +2607,9 @@ unsigned char Si2183_L1_ISDBT_STATUS              (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_ISDBT_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_ISDBT_STATUS_CMD_INTACK_MASK ) << Si2183_ISDBT_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing ISDBT_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 14, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 14, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling ISDBT_STATUS response\n");
+      SiTRACE("Error sending ISDBT_STATUS command\n");
       return error_code;
     }
 
@@ -2912,14 +2677,9 @@ unsigned char Si2183_L1_MCNS_STATUS               (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_MCNS_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_MCNS_STATUS_CMD_INTACK_MASK ) << Si2183_MCNS_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing MCNS_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 10, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 10, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling MCNS_STATUS response\n");
+      SiTRACE("Error sending MCNS_STATUS command\n");
       return error_code;
     }
 
@@ -2960,14 +2720,9 @@ unsigned char Si2183_L1_PART_INFO                 (L1_Si2183_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2183_PART_INFO_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing PART_INFO bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 14, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 1, cmdByteBuffer, 14, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling PART_INFO response\n");
+      SiTRACE("Error sending PART_INFO command\n");
       return error_code;
     }
 
@@ -3111,14 +2866,9 @@ unsigned char Si2183_L1_RSSI_ADC                  (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_RSSI_ADC_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( on_off & Si2183_RSSI_ADC_CMD_ON_OFF_MASK ) << Si2183_RSSI_ADC_CMD_ON_OFF_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing RSSI_ADC bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 2, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 2, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling RSSI_ADC response\n");
+      SiTRACE("Error sending RSSI_ADC command\n");
       return error_code;
     }
 
@@ -3162,14 +2912,9 @@ unsigned char Si2183_L1_SCAN_CTRL                 (L1_Si2183_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( tuned_rf_freq & Si2183_SCAN_CTRL_CMD_TUNED_RF_FREQ_MASK ) << Si2183_SCAN_CTRL_CMD_TUNED_RF_FREQ_LSB)>>16);
     cmdByteBuffer[7] = (unsigned char) ((( tuned_rf_freq & Si2183_SCAN_CTRL_CMD_TUNED_RF_FREQ_MASK ) << Si2183_SCAN_CTRL_CMD_TUNED_RF_FREQ_LSB)>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing SCAN_CTRL bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling SCAN_CTRL response\n");
+      SiTRACE("Error sending SCAN_CTRL command\n");
       return error_code;
     }
 
@@ -3201,14 +2946,9 @@ unsigned char Si2183_L1_SCAN_STATUS               (L1_Si2183_Context *api,
     cmdByteBuffer[0] = Si2183_SCAN_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2183_SCAN_STATUS_CMD_INTACK_MASK ) << Si2183_SCAN_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing SCAN_STATUS bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 11, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 2, cmdByteBuffer, 11, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling SCAN_STATUS response\n");
+      SiTRACE("Error sending SCAN_STATUS command\n");
       return error_code;
     }
 
@@ -3249,14 +2989,9 @@ unsigned char Si2183_L1_SET_PROPERTY              (L1_Si2183_Context *api,
     cmdByteBuffer[4] = (unsigned char) ( ( data     & Si2183_SET_PROPERTY_CMD_DATA_MASK     ) << Si2183_SET_PROPERTY_CMD_DATA_LSB    );
     cmdByteBuffer[5] = (unsigned char) ((( data     & Si2183_SET_PROPERTY_CMD_DATA_MASK     ) << Si2183_SET_PROPERTY_CMD_DATA_LSB    )>>8);
 
-    if (L0_WriteCommandBytes(api->i2c, 6, cmdByteBuffer) != 6) {
-      SiTRACE("Error writing SET_PROPERTY bytes!\n");
-      return ERROR_Si2183_SENDING_COMMAND;
-    }
-
-    error_code = Si2183_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2183_sendCommand(api, 6, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling SET_PROPERTY response\n");
+      SiTRACE("Error sending SET_PROPERTY command\n");
       return error_code;
     }
 
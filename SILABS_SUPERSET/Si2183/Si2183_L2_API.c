@@ -26,6 +26,38 @@ limitations under the License.
    Date: November 06 2015
 **************************************************************************************/
 /* Change log:
+ As from V0.3.5.2:
+    <new_feature>[INIT/Warm_attach] In Si2183_PowerUpWithPatch: if WARM_ATTACH is defined and api->warm_attach is set,
+       attaching to a demodulator already running the expected firmware (Si2183_WarmAttach), without reset nor download.
+       The running firmware is compared (GET_REV) with a snapshot taken after the last full init (Si2183_WarmAttach_Snapshot),
+       and propShadow is rebuilt using GET_PROPERTY reads or restored from the snapshot.
+       The snapshot build identifier (Si2183_WARM_ATTACH_BUILD) is a fixed string by default, for reproducible builds.
+       The build date and time are only used when Si2183_WARM_ATTACH_BUILD_STAMP is defined.
+    <improvement>[SPI/spidev] In Si2183_LoadFirmwareSPI and Si2183_LoadFirmwareSPI_Split: passing the host SPI configuration
+       (clock polarity and bit order, from spi_clk_pola and spi_data_order) to L0_EnableSPI.
+       With LINUX_SPIDEV_Capability, spi_buffer_size is set to L0_SPIDEV_MESSAGE_SIZE.
+    <correction>[SPI/split] In Si2183_LoadFirmwareSPI_Split: never reading split_list[-1], stopping on the first L0 error
+       and sending the trailing bytes up to nbBytes.
+       Sending the bytes up to the last split point first when the trailing bytes do not fit in the SPI buffer.
+    <new_feature>[FW/container] In Si2183_PowerUpWithPatch: if FW_CONTAINER is defined, the firmware is selected from the
+       mapped firmware container (see SiLabs_FW_Container.c) based on PART_INFO, before the compiled-in tables.
+       If FW_CONTAINER_ONLY is defined, the compiled-in tables are not included anymore.
+       Adding Si2183_FW_Container_Build, to create a container file from the compiled-in tables.
+    <new_feature>[I2C/statistics] In Si2183_LoadFirmware and Si2183_LoadFirmware_16: counting the download transactions
+       in the L0_STATS_FIRMWARE i2c statistics category.
+    <improvement>[command/engine] In Si2183_LoadFirmware and Si2183_LoadFirmware_16: downloading the lines with the L0 command engine
+       (L0_LoadFirmware/L0_LoadFirmware_16, also counting the transactions in the L0_STATS_FIRMWARE category).
+    <new_feature>[lock/adaptive_timeout] In Si2183_L2_lock_to_carrier and Si2183_L2_Channel_Seek_Next (not blind):
+       if ADAPTIVE_LOCK_TIMEOUT is defined, using lockTimeoutMax_ms/lockTimeoutMin_ms (learned by the L3) when lower than
+       the default values. Every lockTimeoutVerify learned timeouts, the wait goes on up to the default max lock time,
+       and a lock obtained after the learned timeout is counted in nbLearnedMisses.
+       lockTime_ms stores the duration of the last successful lock.
+    <improvement>[switch/profiling] In Si2183_L2_switch_to_standard: planning the minimal action list from the switch flags and
+       the front-end state (switch_state). The TER tuner LO injection, LIF amplitude and FEF mode are only applied when they change,
+       and DD_RESTART is only done if the demod was initialized, configured or woken up or if DD_MODE differs from the value in use.
+       The planned actions, the avoided steps and the duration of each step are stored in switch_plan (the PROFILING text is built from it).
+       Adding Si2183_L2_Switch_Invalidate, Si2183_L2_Switch_Step_Name, Si2183_L2_Switch_Text and the 'demod switch_plan' test command.
+
  As from V0.3.5.1:
       <correction>[flags] Re-adding 'endif DEMOD_DVB-T2 ' following Si2183_TerAutoDetectOff (mistakenly removed as from v0.3.1.0)
         No big impact, but this created an inconsistent naming in 'define/endif' sequence, and
@@ -572,6 +604,7 @@ limitations under the License.
   #define SiTRACE(...)        SiTraceFunction(SiLEVEL, api->i2c->tag, __FILE__, __LINE__, __func__     ,__VA_ARGS__)
 #endif /* SiTRACES */
 
+#ifndef   FW_CONTAINER_ONLY
 #ifdef    DEMOD_ISDB_T
 #ifdef    Si2180_A55_COMPATIBLE
  /* This is only used for Si2180 parts, since the FW contains no T2/C2/S2 */
@@ -673,6 +706,7 @@ limitations under the License.
  #define   Si2167B_FIRMWARE_FOR_x22_PARTS         Si2167B_PATCH_2_2b10
 #endif /* Si2167B_22_COMPATIBLE */
 /* End of   compatibility with previous parts */
+#endif /* FW_CONTAINER_ONLY */
 
 #define Si2183_BYTES_PER_LINE 8
 
@@ -1475,6 +1509,13 @@ signed   int Si2183_PowerUpWithPatch    (L1_Si2183_Context *api)
   return_code = NO_Si2183_ERROR;
   fw_loaded   = 0;
 
+#ifdef    WARM_ATTACH
+  if ( (api->warm_attach != Si2183_WARM_ATTACH_OFF) && (api->load_control == Si2183_SKIP_NONE) ) {
+    if (Si2183_WarmAttach(api) == NO_Si2183_ERROR) { return NO_Si2183_ERROR; }
+    SiTRACE("Si2183_PowerUpWithPatch: warm-attach not possible, doing a full init\n");
+  }
+  api->warm_attached = 0;
+#endif /* WARM_ATTACH */
   if (!(api->load_control & Si2183_SKIP_POWERUP      )) {
     /* Before patching, set POWER_UP values for 'RESET' and 'BOOTLOADER' */
     api->cmd->power_up.reset = Si2183_POWER_UP_CMD_RESET_RESET;
@@ -1528,6 +1569,13 @@ signed   int Si2183_PowerUpWithPatch    (L1_Si2183_Context *api)
         fw_loaded++; SiERROR ("Loaded FW table\n");
       }
     }
+#ifdef    FW_CONTAINER
+    /* Load FW from the firmware container */
+    if (!fw_loaded) {
+      if ( (api->load_control & Si2183_SKIP_POWERUP) == 0 ) { fw_loaded = Si2183_LoadFirmware_Container(api); }
+      if (fw_loaded < 0) { return ERROR_Si2183_LOADING_FIRMWARE; }
+    }
+#endif /* FW_CONTAINER */
 
     SiLOGS ("api->spi_download %d\n",api->spi_download);
     /* Check part info values and load the proper firmware */
@@ -2278,6 +2326,314 @@ signed   int Si2183_PowerUpWithPatch    (L1_Si2183_Context *api)
 
   return NO_Si2183_ERROR;
 }
+#ifdef    FW_CONTAINER
+/************************************************************************************************************************
+  NAME: Si2183_LoadFirmware_Container
+  DESCRIPTION: Selects the firmware matching the PART_INFO values in the firmware container and loads it.
+  If no container is mapped yet and FW_CONTAINER_PATH is defined, the container is mapped on the first call.
+  In SPI mode, a SPI image is preferred if available.
+
+  Parameter:  pointer to Si2183 Context, with part_info already retrieved
+  Returns:    1 if a firmware has been loaded, 0 if there is no matching image, -1 in case of a loading error
+************************************************************************************************************************/
+signed   int Si2183_LoadFirmware_Container (L1_Si2183_Context *api)
+{
+  SILABS_FW_Container  *container;
+  SILABS_FW_Entry      *entry;
+  const unsigned char  *data;
+  unsigned char         chiprev;
+  signed   int          return_code;
+#ifdef    FW_DOWNLOAD_OVER_SPI
+  unsigned int          split_list[FW_CONTAINER_MAX_SPLITS];
+  unsigned int          num_split;
+#endif /* FW_DOWNLOAD_OVER_SPI */
+  container = &FW_Container_Context;
+  entry     = NULL;
+#ifdef    FW_CONTAINER_PATH
+  if ( (container->base == NULL) & (!container->attempted) ) { SiLabs_FW_Container_Open(container, FW_CONTAINER_PATH); }
+#endif /* FW_CONTAINER_PATH */
+  if (container->base == NULL) { return 0; }
+  chiprev = api->rsp->part_info.chiprev + 0x40;
+#ifdef    FW_DOWNLOAD_OVER_SPI
+  if (api->spi_download) {
+    entry = SiLabs_FW_Container_Find(container, api->rsp->part_info.part, chiprev, api->rsp->part_info.romid, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild, FW_CONTAINER_FORMAT_SPI);
+  }
+  if (entry != NULL) {
+    SiTRACE("Updating FW via SPI for 'Si21%2d NVM%c_%cb%d' using container image '%s'\n", api->rsp->part_info.part, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild, entry->name );
+    data = SiLabs_FW_Container_Data(container, entry);
+    if (entry->num_split) {
+      num_split   = SiLabs_FW_Container_Splits(container, entry, split_list, FW_CONTAINER_MAX_SPLITS);
+      return_code = Si2183_LoadFirmwareSPI_Split(api, (unsigned char*)data, (signed int)entry->lines, entry->spi_key, entry->spi_num, num_split, split_list);
+    } else {
+      return_code = Si2183_LoadFirmwareSPI      (api, (unsigned char*)data, (signed int)entry->lines, entry->spi_key, entry->spi_num);
+    }
+  } else
+#endif /* FW_DOWNLOAD_OVER_SPI */
+  {
+    entry = SiLabs_FW_Container_Find(container, api->rsp->part_info.part, chiprev, api->rsp->part_info.romid, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild, FW_CONTAINER_FORMAT_I2C_16);
+    if (entry == NULL) {
+      entry = SiLabs_FW_Container_Find(container, api->rsp->part_info.part, chiprev, api->rsp->part_info.romid, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild, FW_CONTAINER_FORMAT_I2C_8);
+    }
+    if (entry == NULL) {
+      SiTRACE("No container image for 'Si21%2d-%c ROM%d NVM%c_%cb%d'\n", api->rsp->part_info.part, chiprev, api->rsp->part_info.romid, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild );
+      return 0;
+    }
+    SiTRACE("Updating FW for 'Si21%2d NVM%c_%cb%d' using container image '%s'\n", api->rsp->part_info.part, api->rsp->part_info.pmajor, api->rsp->part_info.pminor, api->rsp->part_info.pbuild, entry->name );
+    data = SiLabs_FW_Container_Data(container, entry);
+    if (entry->format == FW_CONTAINER_FORMAT_I2C_16) {
+      return_code = Si2183_LoadFirmware_16(api, (firmware_struct*)data, (signed int)entry->lines);
+    } else {
+      return_code = Si2183_LoadFirmware   (api, (unsigned char  *)data, (signed int)entry->lines);
+    }
+  }
+  if (return_code != NO_Si2183_ERROR) {
+    SiTRACE ("Si2183_LoadFirmware_Container error 0x%02x: %s\n", return_code, Si2183_L1_API_ERROR_TEXT(return_code) );
+    return -1;
+  }
+#ifdef    DEMOD_DVB_S_S2_DSS
+  if (entry->flags & FW_CONTAINER_FLAG_MIS) { api->MIS_capability=1; }
+#endif /* DEMOD_DVB_S_S2_DSS */
+  return 1;
+}
+/************************************************************************************************************************
+  NAME: Si2183_FW_Container_Build
+  DESCRIPTION: Writes a firmware container file with all firmware images compiled in the application.
+  The PART_INFO keys of each image are those used for the same image in Si2183_PowerUpWithPatch.
+  The 'part' and 'chiprev' keys are set to FW_CONTAINER_ANY, since several parts share the same images.
+
+  Parameter:  path, the container file path
+  Returns:    the number of images written, 0 in case of an error
+************************************************************************************************************************/
+signed   int Si2183_FW_Container_Build     (const char *path)
+{
+  SILABS_FW_Image images[FW_CONTAINER_MAX_ENTRIES];
+  signed   int    nb;
+  nb = 0;
+  memset(images, 0, sizeof(images));
+#define   FW_CONTAINER_IMAGE(_name_, _romid_, _pmajor_, _pminor_, _pbuild_, _format_, _flags_, _data_, _size_, _lines_) \
+  images[nb].name    = _name_;   images[nb].part   = FW_CONTAINER_ANY; images[nb].chiprev = FW_CONTAINER_ANY; \
+  images[nb].romid   = _romid_;  images[nb].pmajor = _pmajor_;         images[nb].pminor  = _pminor_;         images[nb].pbuild = _pbuild_; \
+  images[nb].format  = _format_; images[nb].flags  = _flags_; \
+  images[nb].data    = (const unsigned char*)(_data_); images[nb].size = _size_; images[nb].lines = _lines_; \
+  nb++;
+#define   FW_CONTAINER_IMAGE_16(_name_, _romid_, _pmajor_, _pminor_, _pbuild_, _flags_, _table_) \
+  FW_CONTAINER_IMAGE(_name_, _romid_, _pmajor_, _pminor_, _pbuild_, FW_CONTAINER_FORMAT_I2C_16, _flags_, _table_, sizeof(_table_), sizeof(_table_)/sizeof(firmware_struct))
+#ifdef    Si2180_FIRMWARE_FOR_x55_PARTS
+  FW_CONTAINER_IMAGE_16("Si2180_5_8b3"  , 1, '5', '5',  1, 0                    , Si2180_FIRMWARE_FOR_x55_PARTS);
+#endif /* Si2180_FIRMWARE_FOR_x55_PARTS */
+#ifdef    Si2180_FIRMWARE_FOR_x50_PARTS
+  FW_CONTAINER_IMAGE_16("Si2180_5_3b5"  , 0, '5', '0',  3, 0                    , Si2180_FIRMWARE_FOR_x50_PARTS);
+#endif /* Si2180_FIRMWARE_FOR_x50_PARTS */
+#ifdef    Si2183_FIRMWARE_FOR_x63_PARTS
+  FW_CONTAINER_IMAGE_16("Si2183_x63"    , 2, '6', '3',  1, FW_CONTAINER_FLAG_MIS, Si2183_FIRMWARE_FOR_x63_PARTS);
+#endif /* Si2183_FIRMWARE_FOR_x63_PARTS */
+#ifdef    Si2183_SPI_FIRMWARE_FOR_x60_PARTS
+  FW_CONTAINER_IMAGE("Si2183_SPI_x60"   , 2, '6', '0',  1, FW_CONTAINER_FORMAT_SPI, FW_CONTAINER_FLAG_MIS, Si2183_SPI_FIRMWARE_FOR_x60_PARTS, sizeof(Si2183_SPI_FIRMWARE_FOR_x60_PARTS), sizeof(Si2183_SPI_FIRMWARE_FOR_x60_PARTS));
+  images[nb-1].spi_key    = 0xaa;
+  images[nb-1].spi_num    = 3;
+  images[nb-1].split_list = Si2183_SPI_SPLIT_LIST_FOR_x60_PARTS;
+  images[nb-1].num_split  = sizeof(Si2183_SPI_SPLIT_LIST_FOR_x60_PARTS)/(sizeof(unsigned int));
+#endif /* Si2183_SPI_FIRMWARE_FOR_x60_PARTS */
+#ifdef    Si2183_FIRMWARE_FOR_x60_PARTS
+  FW_CONTAINER_IMAGE_16("Si2183_x60"    , 2, '6', '0',  1, FW_CONTAINER_FLAG_MIS, Si2183_FIRMWARE_FOR_x60_PARTS);
+#endif /* Si2183_FIRMWARE_FOR_x60_PARTS */
+#ifdef    Si2183_FIRMWARE_FOR_x5B_PARTS
+  FW_CONTAINER_IMAGE("Si2183_x5B"       , 2, '5', 'B',  0, FW_CONTAINER_FORMAT_I2C_8, FW_CONTAINER_FLAG_MIS, Si2183_FIRMWARE_FOR_x5B_PARTS, sizeof(Si2183_FIRMWARE_FOR_x5B_PARTS), sizeof(Si2183_FIRMWARE_FOR_x5B_PARTS)/8);
+#endif /* Si2183_FIRMWARE_FOR_x5B_PARTS */
+#ifdef    Si2183_FIRMWARE_FOR_x55_PARTS
+  FW_CONTAINER_IMAGE_16("Si2183_x55"    , 1, '5', '5',  1, FW_CONTAINER_FLAG_MIS, Si2183_FIRMWARE_FOR_x55_PARTS);
+#endif /* Si2183_FIRMWARE_FOR_x55_PARTS */
+#ifdef    Si2183_FIRMWARE_FOR_x50_PARTS
+  FW_CONTAINER_IMAGE_16("Si2183_x50"    , 0, '5', '0',  3, 0                    , Si2183_FIRMWARE_FOR_x50_PARTS);
+#endif /* Si2183_FIRMWARE_FOR_x50_PARTS */
+#ifdef    Si2164_FIRMWARE_FOR_x40_PARTS
+  FW_CONTAINER_IMAGE_16("Si2164_x40"    , 1, '4', '0',  2, 0                    , Si2164_FIRMWARE_FOR_x40_PARTS);
+#endif /* Si2164_FIRMWARE_FOR_x40_PARTS */
+#undef    FW_CONTAINER_IMAGE_16
+#undef    FW_CONTAINER_IMAGE
+  /* SiLabs_FW_Container_Write returns 0 if there is no compiled-in firmware */
+  if (SiLabs_FW_Container_Write(path, images, nb) == 0) { return 0; }
+  return nb;
+}
+#endif /* FW_CONTAINER */
+#ifdef    WARM_ATTACH
+/************************************************************************************************************************
+  NAME: Si2183_WarmAttach_Checksum
+  DESCRIPTION: Computes the checksum of a warm-attach snapshot (all fields before 'checksum')
+  Parameter:  pointer to a Si2183_WARM_Snapshot
+  Returns:    the checksum value
+************************************************************************************************************************/
+unsigned long Si2183_WarmAttach_Checksum    (Si2183_WARM_Snapshot *snapshot)
+{
+  const unsigned char *bytes;
+  unsigned long        sum;
+  unsigned long        i;
+  bytes = (const unsigned char*)snapshot;
+  sum   = 0x2183;
+  for (i = 0; i < (unsigned long)((const unsigned char*)&(snapshot->checksum) - bytes); i++) {
+    sum = (((sum << 5) | (sum >> 27)) ^ bytes[i]) & 0xffffffffUL;
+  }
+  return sum;
+}
+/************************************************************************************************************************
+  NAME: Si2183_WarmAttach_Snapshot
+  DESCRIPTION: Stores in api->warm the information required for a later warm-attach:
+   PART_INFO and GET_REV values from the last full init, media and current propShadow values.
+  The application can then store api->warm (in a file or in a memory surviving the process) and
+   restore it in api->warm before the next init.
+
+  Parameter:  pointer to Si2183 Context, after a successful Si2183_Init
+  Returns:    1 if ok, 0 if the demodulator was not initialized
+************************************************************************************************************************/
+signed   int Si2183_WarmAttach_Snapshot    (L1_Si2183_Context *api)
+{
+  if (api->rsp->get_rev.cmpmajor == 0) { return 0; }
+  memset(&(api->warm), 0, sizeof(Si2183_WARM_Snapshot));
+  api->warm.magic       = Si2183_WARM_SNAPSHOT_MAGIC;
+  api->warm.size        = sizeof(Si2183_WARM_Snapshot);
+  strncpy(api->warm.build, Si2183_WARM_ATTACH_BUILD, Si2183_WARM_BUILD_SIZE - 1);
+  api->warm.part        = api->rsp->part_info.part;
+  api->warm.chiprev     = api->rsp->part_info.chiprev;
+  api->warm.romid       = api->rsp->part_info.romid;
+  api->warm.pmajor      = api->rsp->part_info.pmajor;
+  api->warm.pminor      = api->rsp->part_info.pminor;
+  api->warm.pbuild      = api->rsp->part_info.pbuild;
+  api->warm.pn          = api->rsp->get_rev.pn;
+  api->warm.fwmajor     = api->rsp->get_rev.fwmajor;
+  api->warm.fwminor     = api->rsp->get_rev.fwminor;
+  api->warm.patch       = api->rsp->get_rev.patch;
+  api->warm.cmpmajor    = api->rsp->get_rev.cmpmajor;
+  api->warm.cmpminor    = api->rsp->get_rev.cmpminor;
+  api->warm.cmpbuild    = api->rsp->get_rev.cmpbuild;
+  api->warm.rev_chiprev = api->rsp->get_rev.chiprev;
+  api->warm.mcm_die     = api->rsp->get_rev.mcm_die;
+  api->warm.media       = api->media;
+  memcpy(&(api->warm.prop), api->propShadow, sizeof(Si2183_PropObj));
+  api->warm.checksum    = Si2183_WarmAttach_Checksum(&(api->warm));
+  return 1;
+}
+/************************************************************************************************************************
+  NAME: Si2183_WarmAttach_Valid
+  DESCRIPTION: Checks that api->warm contains a snapshot taken by the same code (same Si2183_WARM_ATTACH_BUILD)
+  Parameter:  pointer to Si2183 Context
+  Returns:    1 if the snapshot can be used, 0 otherwise
+************************************************************************************************************************/
+signed   int Si2183_WarmAttach_Valid       (L1_Si2183_Context *api)
+{
+  char build[Si2183_WARM_BUILD_SIZE];
+  if (api->warm.magic    != Si2183_WARM_SNAPSHOT_MAGIC            ) { return 0; }
+  if (api->warm.size     != sizeof(Si2183_WARM_Snapshot)          ) { return 0; }
+  if (api->warm.checksum != Si2183_WarmAttach_Checksum(&(api->warm))) { return 0; }
+  memset(build, 0, Si2183_WARM_BUILD_SIZE);
+  strncpy(build, Si2183_WARM_ATTACH_BUILD, Si2183_WARM_BUILD_SIZE - 1);
+  if (memcmp(build, api->warm.build, Si2183_WARM_BUILD_SIZE) != 0) { return 0; }
+  return 1;
+}
+/************************************************************************************************************************
+  NAME: Si2183_WarmAttach_Read_Properties
+  DESCRIPTION: Rebuilds propShadow from the values currently used by the running firmware.
+  All properties known by Si2183_PackProperty are read using GET_PROPERTY, in all property groups.
+
+  Parameter:  pointer to Si2183 Context
+  Returns:    the number of properties read, -1 in case of error
+************************************************************************************************************************/
+signed   int Si2183_WarmAttach_Read_Properties (L1_Si2183_Context *api)
+{
+  const unsigned int groups[] = { 0x0003, 0x0004, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018 };
+  unsigned int       prop_code;
+  signed   int       data;
+  signed   int       g;
+  signed   int       i;
+  signed   int       nb;
+  nb = 0;
+  for (g = 0; g < (signed int)(sizeof(groups)/sizeof(groups[0])); g++) {
+    for (i = 0; i < 0x20; i++) {
+      prop_code = (groups[g] << 8) + i;
+      /* Only reading properties known by the code */
+      if (Si2183_PackProperty(api->propShadow, prop_code, &data) != NO_Si2183_ERROR) { continue; }
+      if (Si2183_L1_GetProperty(api, prop_code, &data) != NO_Si2183_ERROR) {
+        SiTRACE("Si2183_WarmAttach_Read_Properties: GET_PROPERTY 0x%04x failed\n", prop_code);
+        return -1;
+      }
+      Si2183_UnpackProperty(api->propShadow, prop_code, data);
+      nb++;
+    }
+  }
+  return nb;
+}
+/************************************************************************************************************************
+  NAME: Si2183_WarmAttach
+  DESCRIPTION: Attaches to a demodulator already running the firmware which would be loaded by Si2183_PowerUpWithPatch,
+   without reset nor firmware download.
+  The running firmware is identified using GET_REV, and compared with the snapshot stored in api->warm
+   during the last full init (see Si2183_WarmAttach_Snapshot).
+  A GET_PROPERTY is used to check that the firmware is running (it fails in bootloader mode).
+  propShadow is then rebuilt, depending on api->warm_attach:
+   Si2183_WARM_ATTACH_READ     : using GET_PROPERTY reads of all properties
+   Si2183_WARM_ATTACH_SNAPSHOT : using the snapshot values, checked with the DD_MODE value read from the part
+
+  Parameter:  pointer to Si2183 Context
+  Returns:    NO_Si2183_ERROR if attached, an error code if a full init is required
+************************************************************************************************************************/
+signed   int Si2183_WarmAttach              (L1_Si2183_Context *api)
+{
+  signed   int return_code;
+  signed   int data;
+  signed   int expected;
+  api->warm_attached = 0;
+  api->warm_reads    = 0;
+  if (!Si2183_WarmAttach_Valid(api)) {
+    SiTRACE("Si2183_WarmAttach: no valid snapshot\n");
+    return ERROR_Si2183_INCOMPATIBLE_PART;
+  }
+  if ((return_code = Si2183_L1_GET_REV(api)) != NO_Si2183_ERROR) {
+    SiTRACE("Si2183_WarmAttach: GET_REV error 0x%02x: %s\n", return_code, Si2183_L1_API_ERROR_TEXT(return_code) );
+    return return_code;
+  }
+  if ( (api->rsp->get_rev.pn       != api->warm.pn         )
+     | (api->rsp->get_rev.fwmajor  != api->warm.fwmajor    )
+     | (api->rsp->get_rev.fwminor  != api->warm.fwminor    )
+     | (api->rsp->get_rev.patch    != api->warm.patch      )
+     | (api->rsp->get_rev.cmpmajor != api->warm.cmpmajor   )
+     | (api->rsp->get_rev.cmpminor != api->warm.cmpminor   )
+     | (api->rsp->get_rev.cmpbuild != api->warm.cmpbuild   )
+     | (api->rsp->get_rev.chiprev  != api->warm.rev_chiprev)
+     | (api->rsp->get_rev.mcm_die  != api->warm.mcm_die    ) ) {
+    SiTRACE("Si2183_WarmAttach: running 'FW_%c_%cb%d', expected 'FW_%c_%cb%d'\n", api->rsp->get_rev.cmpmajor, api->rsp->get_rev.cmpminor, api->rsp->get_rev.cmpbuild, api->warm.cmpmajor, api->warm.cmpminor, api->warm.cmpbuild);
+    return ERROR_Si2183_INCOMPATIBLE_PART;
+  }
+  /* GET_PROPERTY is only answered by the application firmware */
+  if ((return_code = Si2183_L1_GetProperty(api, Si2183_DD_MODE_PROP_CODE, &data)) != NO_Si2183_ERROR) {
+    SiTRACE("Si2183_WarmAttach: firmware not running (GET_PROPERTY error 0x%02x)\n", return_code);
+    return return_code;
+  }
+  api->warm_reads++;
+  if (api->warm_attach == Si2183_WARM_ATTACH_SNAPSHOT) {
+    memcpy(api->propShadow, &(api->warm.prop), sizeof(Si2183_PropObj));
+    Si2183_PackProperty(api->propShadow, Si2183_DD_MODE_PROP_CODE, &expected);
+    if (data != expected) {
+      SiTRACE("Si2183_WarmAttach: DD_MODE 0x%04x differs from the snapshot (0x%04x)\n", data, expected);
+      return ERROR_Si2183_INCOMPATIBLE_PART;
+    }
+  } else {
+    Si2183_storePropertiesDefaults (api->propShadow);
+    if ((return_code = Si2183_WarmAttach_Read_Properties(api)) < 0) { return ERROR_Si2183_ERR; }
+    api->warm_reads = api->warm_reads + return_code;
+  }
+  /* PART_INFO is not available once the firmware runs, restoring the values from the snapshot */
+  api->rsp->part_info.part    = api->warm.part;
+  api->rsp->part_info.chiprev = api->warm.chiprev;
+  api->rsp->part_info.romid   = api->warm.romid;
+  api->rsp->part_info.pmajor  = api->warm.pmajor;
+  api->rsp->part_info.pminor  = api->warm.pminor;
+  api->rsp->part_info.pbuild  = api->warm.pbuild;
+  api->media                  = api->warm.media;
+  api->cmd->power_up.reset    = Si2183_POWER_UP_CMD_RESET_RESUME;
+  api->warm_attached = 1;
+  SiTRACE("Si2183_WarmAttach: attached to Si21%02d running 'FW_%c_%cb%d' (%d GET_PROPERTY reads)\n", api->warm.part, api->warm.cmpmajor, api->warm.cmpminor, api->warm.cmpbuild, api->warm_reads);
+  return NO_Si2183_ERROR;
+}
+#endif /* WARM_ATTACH */
 /************************************************************************************************************************
   NAME: Si2183_PowerUpUsingBroadcastI2C
   DESCRIPTION: This is similar to PowerUpWithPatch() for demod_count demods but it uses the I2C Broadcast
@@ -2380,36 +2736,17 @@ signed   int Si2183_PowerUpUsingBroadcastI2C    (L1_Si2183_Context *demods[], si
 signed   int Si2183_LoadFirmware        (L1_Si2183_Context *api, unsigned char fw_table[], signed   int nbLines)
 {
     signed   int return_code;
-    signed   int line;
     signed   int load_start_ms;
     return_code = NO_Si2183_ERROR;
 
     SiTRACE ("Si2183_LoadFirmware starting...\n");
     SiTRACE ("Si2183_LoadFirmware nbLines %d\n", nbLines);
     load_start_ms = system_time();
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2183_BYTES_PER_LINE fw bytes to Si2183 */
-        if ((return_code = Si2183_L1_API_Patch(api, Si2183_BYTES_PER_LINE, fw_table + Si2183_BYTES_PER_LINE*line)) != NO_Si2183_ERROR)
-      {
-          SiTraceConfiguration((char*)"traces resume");
-          SiTRACE("Si2183_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2183_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          SiTraceConfiguration((char*)"traces resume");
-          return ERROR_Si2183_LOADING_FIRMWARE;
-        }
-        if (line==0) {
-          if (system_time() - load_start_ms > 200) {
-            SiERROR ("Si2183_LoadFirmware line 1 took too much time!\n");
-          }
-          SiTRACE ("Si2183_LoadFirmware line 1 took %4d ms\n", system_time() - load_start_ms);
-      }
-        if (line==3) {SiTraceConfiguration((char*)"traces suspend");}
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2183_BYTES_PER_LINE, nbLines)) != NO_Si2183_ERROR) {
+      SiTRACE("Si2183_LoadFirmware error 0x%02x: %s\n", return_code, Si2183_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2183_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration((char*)"traces resume");
     api->i2c_download_ms = system_time() - load_start_ms;
     SiTRACE ("Si2183_LoadFirmware took %4d ms\n", api->i2c_download_ms);
     /* Storing Properties startup configuration in propShadow                              */
@@ -2434,30 +2771,17 @@ signed   int Si2183_LoadFirmware        (L1_Si2183_Context *api, unsigned char f
 signed   int Si2183_LoadFirmware_16     (L1_Si2183_Context *api, firmware_struct fw_table[], signed   int nbLines)
 {
     signed   int return_code;
-    signed   int line;
     signed   int load_start_ms;
     return_code = NO_Si2183_ERROR;
 
     SiTRACE ("Si2183_LoadFirmware_16 starting...\n");
     SiTRACE ("Si2183_LoadFirmware_16 nbLines %d\n", nbLines);
     load_start_ms = system_time();
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++) {
-      if (fw_table[line].firmware_len > 0)  /* don't download if length is 0 , e.g. dummy firmware */
-    {
-        /* send firmware_len bytes (up to 16) to Si2183 */
-        if ((return_code = Si2183_L1_API_Patch(api, fw_table[line].firmware_len, fw_table[line].firmware_table)) != NO_Si2183_ERROR)
-        {
-          SiTRACE("Si2183_LoadFirmware_16 error 0x%02x patching line %d: %s\n", return_code, line, Si2183_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          return ERROR_Si2183_LOADING_FIRMWARE;
-        }
-        if (line==3) {SiTraceConfiguration("traces suspend");}
-    }
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware_16(api->i2c, fw_table, nbLines)) != NO_Si2183_ERROR) {
+      SiTRACE("Si2183_LoadFirmware_16 error 0x%02x: %s\n", return_code, Si2183_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2183_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces resume");
     api->i2c_download_ms = system_time() - load_start_ms;
     SiTRACE ("Si2183_LoadFirmware_16 took %4d ms\n", api->i2c_download_ms);
     /* Storing Properties startup configuration in propShadow                              */
@@ -2487,6 +2811,7 @@ signed   int Si2183_LoadFirmwareSPI     (L1_Si2183_Context *api, unsigned char f
     signed   int return_code;
     signed   int load_start_ms;
     signed   int fw_index;
+    unsigned char spi_config;
 
 //  #define   SPI_DEBUGGING
   #ifdef    SPI_DEBUGGING
@@ -2503,7 +2828,10 @@ signed   int Si2183_LoadFirmwareSPI     (L1_Si2183_Context *api, unsigned char f
           because all settings are handled internally to the Cypress FW.
           This needs to be adapted to each SPI setup
     */
-    if ( L0_EnableSPI(0x00) == 0) {
+    spi_config = 0x00;
+    if (api->spi_clk_pola   == Si2183_SPI_LINK_CMD_SPI_CLK_POLA_FALLING  ) { spi_config = spi_config | L0_SPI_CONFIG_CLK_FALLING; }
+    if (api->spi_data_order == Si2183_SPI_LINK_CMD_SPI_DATA_DIR_LSB_FIRST) { spi_config = spi_config | L0_SPI_CONFIG_LSB_FIRST;   }
+    if ( L0_EnableSPI(spi_config) == 0) {
       SiERROR ("SPI can't be enabled. It's not supported by the L0!\n");
       return ERROR_Si2183_LOADING_FIRMWARE;
     }
@@ -2599,6 +2927,7 @@ signed   int Si2183_LoadFirmwareSPI_Split(L1_Si2183_Context *api, unsigned char
     signed   int return_code;
     signed   int load_start_ms;
     signed   int fw_index;
+    unsigned char spi_config;
     unsigned int i;
 
 //  #define   SPI_DEBUGGING
@@ -2616,7 +2945,10 @@ signed   int Si2183_LoadFirmwareSPI_Split(L1_Si2183_Context *api, unsigned char
           because all settings are handled internally to the Cypress FW.
           This needs to be adapted to each SPI setup
     */
-    if ( L0_EnableSPI(0x00) == 0) {
+    spi_config = 0x00;
+    if (api->spi_clk_pola   == Si2183_SPI_LINK_CMD_SPI_CLK_POLA_FALLING  ) { spi_config = spi_config | L0_SPI_CONFIG_CLK_FALLING; }
+    if (api->spi_data_order == Si2183_SPI_LINK_CMD_SPI_DATA_DIR_LSB_FIRST) { spi_config = spi_config | L0_SPI_CONFIG_LSB_FIRST;   }
+    if ( L0_EnableSPI(spi_config) == 0) {
       SiERROR ("SPI can't be enabled. It's not supported by the L0!\n");
       return ERROR_Si2183_LOADING_FIRMWARE;
     }
@@ -2659,16 +2991,21 @@ signed   int Si2183_LoadFirmwareSPI_Split(L1_Si2183_Context *api, unsigned char
     }
  #endif /* SPI_DEBUGGING */
 
-    /* Send SPI bytes, using max available buffer size */
-    for (i=0; i< num_split; i++) {
-      if (split_list[i]-fw_index > api->spi_buffer_size) {
+    /* Send SPI bytes, using max available buffer size. Portions are only ended at split points */
+    for (i=0; (i< num_split) && (return_code == 0); i++) {
+      if ( (i > 0) && (split_list[i]-fw_index > api->spi_buffer_size) && (split_list[i-1] > (unsigned int)fw_index) ) {
         return_code = L0_LoadSPIoverGPIF(fw_table+fw_index, split_list[i-1]-fw_index);
         fw_index = split_list[i-1];
       }
+    }
+     /* If the trailing SPI bytes do not fit in the SPI buffer, send them up to the last split point first */
+    if ( (return_code == 0) && (num_split > 0) && (nbBytes - fw_index > (signed int)api->spi_buffer_size) && (split_list[num_split-1] > (unsigned int)fw_index) ) {
+      return_code = L0_LoadSPIoverGPIF(fw_table+fw_index, split_list[num_split-1]-fw_index);
+      fw_index = split_list[num_split-1];
     }
      /* Send trailing SPI bytes */
-    if (split_list[i-1]-fw_index > 0) {
-      return_code = L0_LoadSPIoverGPIF(fw_table+fw_index, split_list[i-1]-fw_index);
+    if ( (return_code == 0) && (nbBytes > fw_index) ) {
+      return_code = L0_LoadSPIoverGPIF(fw_table+fw_index, nbBytes-fw_index);
     }
 
     api->spi_download_ms = system_time() - load_start_ms;
@@ -3077,6 +3414,16 @@ char          Si2183_L2_SW_Init            (Si2183_L2_Context *front_end
     front_end->handshakeUsed       = 0; /* set to '0' by default for compatibility with previous versions */
     front_end->handshakeOn         = 0;
     front_end->handshakePeriod_ms  = 1000;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    front_end->lockTimeoutMax_ms   = 0;
+    front_end->lockTimeoutMin_ms   = 0;
+    front_end->lockTimeoutVerify   = 0;
+    front_end->lockTimeoutExtended = 0;
+    front_end->lockTime_ms         = -1;
+    front_end->nbLearnedTimeouts   = 0;
+    front_end->nbLearnedVerified   = 0;
+    front_end->nbLearnedMisses     = 0;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
 #ifdef    TERRESTRIAL_FRONT_END
     front_end->tuner_ter = &(front_end->tuner_terObj);
     front_end->TER_init_done        = 0;
@@ -3115,6 +3462,8 @@ char          Si2183_L2_SW_Init            (Si2183_L2_Context *front_end
 #endif /* UNICABLE_COMPATIBLE */
 #endif /* SATELLITE_FRONT_END */
     front_end->callback        = p_context;
+    front_end->switch_plan.count = 0;
+    Si2183_L2_Switch_Invalidate(front_end);
 #ifdef    SiTRACE
     if (Si2183_L2_Infos(front_end, front_end->demod->msg))  {SiTRACE("%s\n", front_end->demod->msg);}
 #endif /* SiTRACE */
@@ -3126,7 +3475,11 @@ char          Si2183_L2_SW_Init            (Si2183_L2_Context *front_end
     front_end->demod->fw_table = NULL;
     front_end->demod->nbSpiBytes = 0;
     front_end->demod->spi_table = NULL;
+#ifdef    LINUX_SPIDEV_Capability
+    front_end->demod->spi_buffer_size = L0_SPIDEV_MESSAGE_SIZE; /* One SPI_IOC_MESSAGE ioctl per FW portion */
+#else  /* LINUX_SPIDEV_Capability */
     front_end->demod->spi_buffer_size = 2048;  /* Needs to be at least 1024 for the current FW portions. Contact SiLabs in case you need a smaller size */
+#endif /* LINUX_SPIDEV_Capability */
     /* <porting> if not allowed to use dynamic memory allocation, comment the following lines. */
     front_end->demod->fw_table = (firmware_struct*)realloc(front_end->demod->fw_table , sizeof(firmware_struct)*front_end->demod->nbLines);
     front_end->demod->spi_table = (unsigned char *)realloc(front_end->demod->spi_table, sizeof(unsigned char)*front_end->demod->nbSpiBytes);
@@ -3169,6 +3522,7 @@ signed   int  Si2183_L2_Set_Index_and_Tag  (Si2183_L2_Context *front_end, unsign
 signed   int  Si2183_L2_SILENT             (Si2183_L2_Context *front_end, signed   int silent)
 {
   SiTRACE ("Si2183_L2_SILENT: silent %d\n", silent);
+  front_end->switch_state.standard = -1; /* A DD_RESTART will be required */
   if (silent) {
     /* turn all possible I/Os to tristate, to allow using another demod */
     /* AGC settings when not used */
@@ -3354,6 +3708,11 @@ signed   int  Si2183_L2_communication_check(Si2183_L2_Context *front_end)
   Parameter: new_standard the wanted standard to switch to
   Behavior: This function positions a set of flags to easily decide what needs to be done to
               switch between standards.
+            The flags and the front-end state (front_end->switch_state) are then used to plan the minimal action list
+              (front_end->switch_plan.actions). The TER tuner settings and the DD_RESTART are only planned if they differ
+              from the current state, such that switching between related standards (DVB-T/T2, DVB-S/S2, DVB-C/C2)
+              only applies what changes.
+            The duration of each step is stored in front_end->switch_plan.step_ms.
 ************************************************************************************************************************/
 signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsigned char new_standard, unsigned char force_full_init)
 {
@@ -3394,35 +3753,55 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   signed   int res;
   signed   int ret;
 
-#ifdef    PROFILING
-  signed   int start;
+  Si2183_Switch_Plan  *plan;
+  Si2183_Switch_State *state;
+  unsigned int  actions;
+  unsigned int  usual;
+  signed   int  new_media;
+  signed   int  dd_mode;
+  signed   int  dd_mode_applied;
+  signed   int  step;
 #ifdef    TERRESTRIAL_FRONT_END
-  signed   int ter_tuner_delay   = 0;
+  signed   int  ter_lo;
+  signed   int  ter_lif_amp;
+  signed   int  ter_fef;
 #endif /* TERRESTRIAL_FRONT_END */
-#ifdef    SATELLITE_FRONT_END
-  signed   int sat_tuner_delay   = 0;
-#endif /* SATELLITE_FRONT_END */
-  signed   int dtv_demod_delay   = 0;
+
+#ifdef    PROFILING
+  signed   int start;
+  signed   int now;
   signed   int switch_start;
   char *sequence;
   sequence = front_end->demod->msg;
 #ifdef    TERRESTRIAL_FRONT_END
-  #define TER_DELAY  ter_tuner_delay=ter_tuner_delay+system_time()-start;start=system_time();
+  #define TER_DELAY(step)  now=system_time(); plan->step_ms[step]+=now-start; plan->ter_ms+=now-start; start=now;
 #endif /* TERRESTRIAL_FRONT_END */
 #ifdef    SATELLITE_FRONT_END
-  #define SAT_DELAY  sat_tuner_delay=sat_tuner_delay+system_time()-start;start=system_time();
+  #define SAT_DELAY(step)  now=system_time(); plan->step_ms[step]+=now-start; plan->sat_ms+=now-start; start=now;
 #endif /* SATELLITE_FRONT_END */
-  #define DTV_DELAY  dtv_demod_delay=dtv_demod_delay+system_time()-start;start=system_time();
+  #define DTV_DELAY(step)  now=system_time(); plan->step_ms[step]+=now-start; plan->dtv_ms+=now-start; start=now;
 #else
 #ifdef    TERRESTRIAL_FRONT_END
-  #define TER_DELAY
+  #define TER_DELAY(step)
 #endif /* TERRESTRIAL_FRONT_END */
 #ifdef    SATELLITE_FRONT_END
-  #define SAT_DELAY
+  #define SAT_DELAY(step)
 #endif /* SATELLITE_FRONT_END */
-  #define DTV_DELAY
+  #define DTV_DELAY(step)
 #endif /* PROFILING */
   ret = 1;
+  plan  = &(front_end->switch_plan);
+  state = &(front_end->switch_state);
+  plan->from     = front_end->previous_standard;
+  plan->to       = new_standard;
+  plan->actions  = 0;
+  plan->skipped  = 0;
+  for (step = 0; step < Si2183_SWITCH_STEPS; step++) { plan->step_ms[step] = 0; }
+  plan->ter_ms   = 0;
+  plan->sat_ms   = 0;
+  plan->dtv_ms   = 0;
+  plan->total_ms = 0;
+  plan->count++;
 #ifdef    PROFILING
   start = switch_start = system_time();
   SiTRACE("%s->%s\n", Si2183_standardName(front_end->previous_standard), Si2183_standardName(new_standard) );
@@ -3442,6 +3821,8 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   if (front_end->previous_standard == 200)                           {force_full_init = 1;}
   /* If this function is called for the first time, force a full init */
   if ( (front_end->first_init_done == 0) && (force_full_init == 0) ) {force_full_init = 1;}
+  /* When forced, or if properties are always downloaded, do not rely on the front-end state */
+  if ( (force_full_init) || (front_end->demod->propertyWriteMode == Si2183_DOWNLOAD_ALWAYS) ) { Si2183_L2_Switch_Invalidate(front_end); }
   /* ------------------------------------------------------------ */
   /* Set Previous Flags                                           */
   /* Setting flags representing the previous state                */
@@ -3728,9 +4109,84 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   SiTRACE(" %s-->%s switch flags    dtv_demod_already_used %d, dtv_demod_needed %d, dtv_demod_sleep_request %d, dtv_demod_sleeping %d\n", Si2183_standardName(front_end->previous_standard), Si2183_standardName(new_standard),
                                     dtv_demod_already_used,    dtv_demod_needed,    dtv_demod_sleep_request,    dtv_demod_sleeping   );
   /* ------------------------------------------------------------ */
+  /* Plan the minimal action list                                 */
+  /* Power and clock steps are planned from the flags above.      */
+  /* TER tuner settings (LO injection, LIF amplitude, FEF mode)   */
+  /*  are only planned if they differ from the front-end state.   */
+  /* 'usual' holds the steps previously applied on each standard  */
+  /*  change, to count the steps avoided by the planning.         */
+  /* The DD_RESTART is planned once DD_MODE is known.             */
+  /* ------------------------------------------------------------ */
+  actions   = 0;
+  usual     = 0;
+  new_media = Si2183_Media(front_end->demod, new_standard);
+  if (dtv_demod_sleep_request == 1)                             { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_STANDBY    ); }
+#ifdef    SATELLITE_FRONT_END
+  if ((sat_tuner_already_used == 1) & (sat_tuner_needed == 0) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_TUNER_STANDBY); }
+  if ((sat_tuner_already_used == 0) & (sat_tuner_needed == 1) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_TUNER_WAKEUP ); }
+  if  (sat_clock_needed)                                        { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_CLOCK_ON     ); }
+#endif /* SATELLITE_FRONT_END */
+#ifdef    TERRESTRIAL_FRONT_END
+  if ((ter_tuner_already_used == 1) & (ter_tuner_needed == 0) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_STANDBY); }
+  if ((ter_tuner_already_used == 0) & (ter_tuner_needed == 1) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_WAKEUP ); }
+  if  (ter_clock_needed)                                        { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_CLOCK_ON     ); }
+  /* The TER tuner settings are re-applied after a TER tuner standby, init or wake up */
+  if (actions & (Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_STANDBY) | Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_WAKEUP)) ) {
+    state->ter_lo      = -1;
+    state->ter_lif_amp = -1;
+    state->ter_fef     = -1;
+  }
+  ter_lo      = -1;
+  ter_lif_amp = -1;
+  ter_fef     = -1;
+  if (new_standard == Si2183_DD_MODE_PROP_MODULATION_ANALOG) {
+    ter_lo = 1;
+    if (front_end->previous_standard != new_standard) { usual |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LO_INJECTION); }
+  }
+  if ( (dtv_demod_needed == 1) && (new_media == Si2183_TERRESTRIAL) ) {
+    ter_lo = 0;
+    switch (new_standard) {
+      case Si2183_DD_MODE_PROP_MODULATION_DVBT :
+      case Si2183_DD_MODE_PROP_MODULATION_DVBC2:
+      case Si2183_DD_MODE_PROP_MODULATION_DVBT2: { ter_lif_amp = 0; break; }
+      case Si2183_DD_MODE_PROP_MODULATION_MCNS :
+      case Si2183_DD_MODE_PROP_MODULATION_DVBC : { ter_lif_amp = 1; break; }
+      default: break;
+    }
+    if (front_end->previous_standard != new_standard) {
+      usual |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LO_INJECTION);
+      if (ter_lif_amp != -1) { usual |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LIF_AMP); }
+    }
+#ifdef    DEMOD_DVB_T2
+    ter_fef = (new_standard == Si2183_DD_MODE_PROP_MODULATION_DVBT2);
+    usual  |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_FEF);
+#endif /* DEMOD_DVB_T2 */
+  }
+  if ( (ter_lo      != -1) && (ter_lo      != state->ter_lo     ) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LO_INJECTION); }
+  if ( (ter_lif_amp != -1) && (ter_lif_amp != state->ter_lif_amp) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LIF_AMP     ); }
+  if ( (ter_fef     != -1) && (ter_fef     != state->ter_fef    ) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_FEF         ); }
+#endif /* TERRESTRIAL_FRONT_END */
+  if (dtv_demod_needed == 1) {
+    if (front_end->Si2183_init_done == 0) {
+      actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_INIT);
+    } else if ((dtv_demod_sleeping == 1) | (dtv_demod_sleep_request == 1) ) {
+      actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_WAKEUP);
+    }
+#ifdef    TERRESTRIAL_FRONT_END
+    if ( (new_media == Si2183_TERRESTRIAL) && (front_end->TER_init_done == 0) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_CONFIGURE); }
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    SATELLITE_FRONT_END
+    if ( (new_media == Si2183_SATELLITE  ) && (front_end->SAT_init_done == 0) ) { actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_CONFIGURE); }
+#endif /* SATELLITE_FRONT_END */
+    usual |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DD_RESTART);
+  }
+  plan->actions |= actions;
+  plan->skipped |= usual & ~actions & ~Si2183_SWITCH_ACTION(Si2183_SWITCH_DD_RESTART);
+  SiTRACE(" %s-->%s switch plan     actions 0x%04x, skipped 0x%04x\n", Si2183_standardName(front_end->previous_standard), Si2183_standardName(new_standard), actions, plan->skipped);
+  /* ------------------------------------------------------------ */
   /* Sleep dtv demodulator if requested                           */
   /* ------------------------------------------------------------ */
-  if (dtv_demod_sleep_request == 1) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_STANDBY)) {
     SiTRACE("Sleep DTV demod\n");
 #ifdef    DEMOD_DVB_T2
     /* To avoid issues with the FEF pin when switching from T2 to ANALOG, set the demodulator for DVB-T/non auto detect reception before POWER_DOWN */
@@ -3761,8 +4217,9 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
     Si2183_STANDBY (front_end->demod);
     dtv_demod_sleeping = 1;
     dtv_demod_state    = 0;
+    state->standard    = -1;
     SiTRACE(" %s-->%s switch now   dtv_demod_sleeping %d\n", Si2183_standardName(front_end->previous_standard), Si2183_standardName(new_standard), dtv_demod_sleeping   );
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_DEMOD_STANDBY)
   }
 
   /* ------------------------------------------------------------ */
@@ -3771,7 +4228,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   if (dtv_demod_needed == 1) {
     Si2183_prepare_DD_MODE (front_end, new_standard);
   }
-  front_end->demod->media = Si2183_Media(front_end->demod, new_standard);
+  front_end->demod->media = new_media;
 
   /* ------------------------------------------------------------ */
   /* Allow i2c traffic to reach the tuners                        */
@@ -3781,7 +4238,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
    #else  /* INDIRECT_I2C_CONNECTION */
     SiTRACE("Connect tuners i2c\n");
     Si2183_L2_Tuner_I2C_Enable(front_end);
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_I2C)
     i2c_connected = 1;
    #endif /* INDIRECT_I2C_CONNECTION */
 
@@ -3790,7 +4247,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   /* Sleep Sat Tuner                                              */
   /* Sleep satellite   tuner if transition from '1' to '0'        */
   /* ------------------------------------------------------------ */
-  if ((sat_tuner_already_used == 1) & (sat_tuner_needed == 0) ) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_TUNER_STANDBY)) {
    #ifdef    INDIRECT_I2C_CONNECTION
     SiTRACE("Connect SAT tuner i2c to put it in sleep mode?\n");
     if (sat_i2c_connected==0) {
@@ -3798,7 +4255,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
       front_end->f_SAT_tuner_enable(front_end->callback);
       sat_i2c_connected++;
     }
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_I2C)
    #endif /* INDIRECT_I2C_CONNECTION */
     SiTRACE("Sleep satellite tuner\n");
     #ifdef    SAT_TUNER_CLOCK_OFF
@@ -3819,7 +4276,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
     }
     sat_tuner_state = 0;
     #endif /* SAT_TUNER_STANDBY */
-    SAT_DELAY
+    SAT_DELAY(Si2183_SWITCH_SAT_TUNER_STANDBY)
   }
 #endif /* SATELLITE_FRONT_END */
 #ifdef    TERRESTRIAL_FRONT_END
@@ -3827,14 +4284,14 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   /* Sleep Ter Tuner                                              */
   /* Sleep terrestrial tuner  if transition from '1' to '0'       */
   /* ------------------------------------------------------------ */
-  if ((ter_tuner_already_used == 1) & (ter_tuner_needed == 0) ) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_STANDBY)) {
    #ifdef    INDIRECT_I2C_CONNECTION
     if (ter_i2c_connected==0) {
       SiTRACE("-- I2C -- Connect TER tuner i2c to sleep it\n");
       front_end->f_TER_tuner_enable(front_end->callback);
       ter_i2c_connected++;
     }
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_I2C)
    #endif /* INDIRECT_I2C_CONNECTION */
     SiTRACE("Sleep terrestrial tuner\n");
     #ifdef    TER_TUNER_CLOCK_OFF
@@ -3859,7 +4316,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
     }
     ter_tuner_state = 0;
     #endif /* TER_TUNER_STANDBY */
-    TER_DELAY
+    TER_DELAY(Si2183_SWITCH_TER_TUNER_STANDBY)
   }
 #endif /* TERRESTRIAL_FRONT_END */
 
@@ -3868,14 +4325,14 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   /* Wakeup Sat Tuner                                             */
   /* Wake up satellite   tuner if transition from '0' to '1'      */
   /* ------------------------------------------------------------ */
-  if ((sat_tuner_already_used == 0) & (sat_tuner_needed == 1)) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_TUNER_WAKEUP)) {
    #ifdef    INDIRECT_I2C_CONNECTION
     if (sat_i2c_connected==0) {
       SiTRACE("-- I2C -- Connect SAT tuner i2c to init/wakeup it\n");
       front_end->f_SAT_tuner_enable(front_end->callback);
       sat_i2c_connected++;
     }
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_I2C)
    #endif /* INDIRECT_I2C_CONNECTION */
     if (front_end->SAT_tuner_init_done==0) {
       SiTRACE("Init satellite tuner\n");
@@ -3896,13 +4353,13 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
       #endif /* SAT_TUNER_WAKEUP */
     }
     sat_tuner_state = 1;
-    SAT_DELAY
+    SAT_DELAY(Si2183_SWITCH_SAT_TUNER_WAKEUP)
   }
   /* ------------------------------------------------------------ */
   /* If the satellite tuner's clock is required, activate it      */
   /* ------------------------------------------------------------ */
   SiTRACE("sat_clock_needed %d\n",sat_clock_needed);
-  if (sat_clock_needed) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_SAT_CLOCK_ON)) {
     #ifdef    SAT_TUNER_CLOCK_ON
      #ifdef    INDIRECT_I2C_CONNECTION
       if (sat_i2c_connected==0) {
@@ -3910,7 +4367,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
         front_end->f_SAT_tuner_enable(front_end->callback);
         sat_i2c_connected++;
       }
-      DTV_DELAY
+      DTV_DELAY(Si2183_SWITCH_I2C)
      #endif /* INDIRECT_I2C_CONNECTION */
     if (front_end->demod->tuner_sat_clock_control != Si2183_CLOCK_ALWAYS_OFF) {
       SiTRACE("Turn satellite tuner clock on\n");
@@ -3930,7 +4387,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
       #endif /* SAT_TUNER_STANDBY_WITH_CLOCK */
     }
     #endif /* SAT_TUNER_CLOCK_ON */
-    SAT_DELAY
+    SAT_DELAY(Si2183_SWITCH_SAT_CLOCK_ON)
   }
 #endif /* SATELLITE_FRONT_END */
 
@@ -3939,14 +4396,14 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   /* Wakeup Ter Tuner                                             */
   /* Wake up terrestrial tuner if transition from '0' to '1'      */
   /* ------------------------------------------------------------ */
-  if ((ter_tuner_already_used == 0) & (ter_tuner_needed == 1)) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_TUNER_WAKEUP)) {
    #ifdef    INDIRECT_I2C_CONNECTION
     if (ter_i2c_connected==0) {
       SiTRACE("-- I2C -- Connect TER tuner i2c to init/wakeup it\n");
       front_end->f_TER_tuner_enable(front_end->callback);
       ter_i2c_connected++;
     }
-    DTV_DELAY
+    DTV_DELAY(Si2183_SWITCH_I2C)
    #endif /* INDIRECT_I2C_CONNECTION */
     /* Do a full init of the Ter Tuner only if it has not been already done */
     if (front_end->TER_tuner_init_done==0) {
@@ -3978,13 +4435,13 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
       front_end->TER_tuner_config_done =1;
     }
     ter_tuner_state = 1;
-    TER_DELAY
+    TER_DELAY(Si2183_SWITCH_TER_TUNER_WAKEUP)
   }
     /* ------------------------------------------------------------ */
     /* If the terrestrial tuner's clock is required, activate it    */
     /* ------------------------------------------------------------ */
   SiTRACE("ter_clock_needed %d\n",ter_clock_needed);
-  if (ter_clock_needed) {
+  if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_CLOCK_ON)) {
     SiTRACE("Turn terrestrial tuner clock on\n");
     #ifdef    TER_TUNER_CLOCK_ON
      #ifdef    INDIRECT_I2C_CONNECTION
@@ -3993,7 +4450,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
         front_end->f_TER_tuner_enable(front_end->callback);
         ter_i2c_connected++;
       }
-      DTV_DELAY
+      DTV_DELAY(Si2183_SWITCH_I2C)
      #endif /* INDIRECT_I2C_CONNECTION */
     if (front_end->demod->tuner_ter_clock_control != Si2183_CLOCK_ALWAYS_OFF) {
       SiTRACE("Terrestrial tuner CLOCK ON\n");
@@ -4007,18 +4464,23 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
       if (front_end->demod->media != Si2183_TERRESTRIAL ) {
         if ( (res = TER_TUNER_STANDBY_WITH_CLOCK(front_end->tuner_ter)) != -1 ) {
           SiTRACE("Terrestrial tuner STANDBY (unused) to save power, while the TER clock is kept on\n");
-          ter_tuner_state = 0;
+          ter_tuner_state    = 0;
+          state->ter_lo      = -1;
+          state->ter_lif_amp = -1;
+          state->ter_fef     = -1;
         }
       }
       #endif /* TER_TUNER_STANDBY_WITH_CLOCK */
     }
     #endif /* TER_TUNER_CLOCK_ON */
-    TER_DELAY
+    TER_DELAY(Si2183_SWITCH_TER_CLOCK_ON)
   }
-  if ((front_end->previous_standard != new_standard) && (ter_tuner_state == 1) && (new_standard == Si2183_DD_MODE_PROP_MODULATION_ANALOG)) {
+  if ((actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LO_INJECTION)) && (ter_tuner_state == 1) && (new_standard == Si2183_DD_MODE_PROP_MODULATION_ANALOG)) {
   #ifdef    TER_TUNER_ATV_LO_INJECTION
    TER_TUNER_ATV_LO_INJECTION(front_end->tuner_ter);
   #endif /* TER_TUNER_ATV_LO_INJECTION */
+   state->ter_lo = ter_lo;
+   TER_DELAY(Si2183_SWITCH_TER_LO_INJECTION)
   }
 #endif /* TERRESTRIAL_FRONT_END */
 
@@ -4028,40 +4490,33 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   if ((front_end->previous_standard != new_standard) & (dtv_demod_needed == 1)) {
     SiTRACE("Store demod standard (%d)\n", new_standard);
     front_end->demod->standard = new_standard;
-    DTV_DELAY
+  }
 #ifdef    TERRESTRIAL_FRONT_END
-    if ( (front_end->demod->media == Si2183_TERRESTRIAL) && (ter_tuner_state == 1) ) {
+  if ( (dtv_demod_needed == 1) && (front_end->demod->media == Si2183_TERRESTRIAL) && (ter_tuner_state == 1) ) {
+    if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LO_INJECTION)) {
     #ifdef    TER_TUNER_DTV_LO_INJECTION
      TER_TUNER_DTV_LO_INJECTION(front_end->tuner_ter);
     #endif /* TER_TUNER_DTV_LO_INJECTION */
+      state->ter_lo = ter_lo;
+      TER_DELAY(Si2183_SWITCH_TER_LO_INJECTION)
+    }
+    if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_LIF_AMP)) {
     #ifdef    TER_TUNER_DTV_LIF_OUT_AMP
-    /* Adjusting LIF signal for cable or terrestrial reception */
-      switch (new_standard) {
-        case Si2183_DD_MODE_PROP_MODULATION_DVBT :
-        case Si2183_DD_MODE_PROP_MODULATION_DVBC2:
-        case Si2183_DD_MODE_PROP_MODULATION_DVBT2:
-        {
-          TER_TUNER_DTV_LIF_OUT_AMP(front_end->tuner_ter, 0);
-          break;
-        }
-       case Si2183_DD_MODE_PROP_MODULATION_MCNS :
-       case Si2183_DD_MODE_PROP_MODULATION_DVBC : {
-          TER_TUNER_DTV_LIF_OUT_AMP(front_end->tuner_ter, 1);
-         break;
-       }
-       default: break;
-      }
+    /* Adjusting LIF signal for cable (1) or terrestrial (0) reception */
+      TER_TUNER_DTV_LIF_OUT_AMP(front_end->tuner_ter, ter_lif_amp);
     #endif /* TER_TUNER_DTV_LIF_OUT_AMP */
+      state->ter_lif_amp = ter_lif_amp;
+      TER_DELAY(Si2183_SWITCH_TER_LIF_AMP)
     }
-#endif /* TERRESTRIAL_FRONT_END */
   }
+#endif /* TERRESTRIAL_FRONT_END */
   /* ------------------------------------------------------------ */
   /* Wakeup Dtv Demod                                             */
   /*  if it has been put in 'standby mode' and is needed          */
   /* ------------------------------------------------------------ */
   if (front_end->Si2183_init_done) {
     SiTRACE("dtv_demod_sleeping %d\n", dtv_demod_sleeping);
-    if ((dtv_demod_sleeping == 1) & (dtv_demod_needed == 1) ) {
+    if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_WAKEUP)) {
       if (dtv_demod_already_used == 0) {
         SiTRACE("Take DTV demod out of SILENT mode\n");
         Si2183_L2_SILENT(front_end, 0);
@@ -4075,6 +4530,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
           ret = 0; goto return_after_disabling_I2c;
         }
       }
+      DTV_DELAY(Si2183_SWITCH_DEMOD_WAKEUP)
     }
   }
   /* ------------------------------------------------------------ */
@@ -4084,7 +4540,7 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   if (dtv_demod_needed == 1) {
     /* Do the 'first init' only the first time, plus if requested  */
     /* (when 'force' flag is 1, Si2183_init_done is set to '0')   */
-    if (!front_end->Si2183_init_done) {
+    if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_INIT)) {
       SiTRACE("Init demod\n");
       if (Si2183_Init(front_end->demod) == NO_Si2183_ERROR) {
         front_end->Si2183_init_done = 1;
@@ -4099,12 +4555,13 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
         SiERROR("Demod init failed!\n");
         ret = 0; goto return_after_disabling_I2c;
       }
+      DTV_DELAY(Si2183_SWITCH_DEMOD_INIT)
     }
     dtv_demod_state = 1;
 #ifdef    TERRESTRIAL_FRONT_END
     if (front_end->demod->media == Si2183_TERRESTRIAL) {
       SiTRACE("front_end->demod->media Si2183_TERRESTRIAL\n");
-      if (front_end->TER_init_done == 0) {
+      if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_CONFIGURE)) {
         SiTRACE("Configure demod for TER\n");
         if (Si2183_Configure(front_end->demod) == NO_Si2183_ERROR) {
           /* set dd_mode.modulation again, as it is overwritten by Si2183_Configure */
@@ -4115,35 +4572,31 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
           SiERROR("Demod TER configuration failed !\n");
           ret = 0; goto return_after_disabling_I2c;
         }
+        DTV_DELAY(Si2183_SWITCH_DEMOD_CONFIGURE)
       }
-      DTV_DELAY
 #ifdef    DEMOD_DVB_T2
-      if (ter_tuner_state == 1) {
+      if ( (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_TER_FEF)) && (ter_tuner_state == 1) ) {
        #ifdef    INDIRECT_I2C_CONNECTION
         if (ter_i2c_connected==0) {
           SiTRACE("-- I2C -- Connect TER tuner i2c to set the FEF mode\n");
           front_end->f_TER_tuner_enable(front_end->callback);
           ter_i2c_connected++;
         }
-        DTV_DELAY
+        DTV_DELAY(Si2183_SWITCH_I2C)
        #endif /* INDIRECT_I2C_CONNECTION */
         /* ------------------------------------------------------------ */
-        /* Manage FEF mode in TER tuner                                 */
+        /* Manage FEF mode in TER tuner ('1' only for DVB-T2)           */
         /* ------------------------------------------------------------ */
-        if (new_standard == Si2183_DD_MODE_PROP_MODULATION_DVBT2) {
-          Si2183_L2_TER_FEF_SETUP (front_end, 1);
-        } else {
-          Si2183_L2_TER_FEF_SETUP (front_end, 0);
-        }
+        Si2183_L2_TER_FEF_SETUP (front_end, ter_fef);
+        TER_DELAY(Si2183_SWITCH_TER_FEF)
       }
 #endif /* DEMOD_DVB_T2 */
-      TER_DELAY
     }
 #endif /* TERRESTRIAL_FRONT_END */
 #ifdef    SATELLITE_FRONT_END
     if (front_end->demod->media == Si2183_SATELLITE  ) {
       SiTRACE("front_end->demod->media Si2183_SATELLITE\n");
-      if (front_end->SAT_init_done == 0) {
+      if (actions & Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_CONFIGURE)) {
         SiTRACE("Configure demod for SAT\n");
         if (Si2183_Configure(front_end->demod) == NO_Si2183_ERROR) {
           /* set dd_mode.modulation again, as it is overwritten by Si2183_Configure */
@@ -4154,18 +4607,34 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
           SiERROR("Demod SAT configuration failed !\n");
           ret = 0; goto return_after_disabling_I2c;
         }
+        DTV_DELAY(Si2183_SWITCH_DEMOD_CONFIGURE)
       }
     }
 #endif /* SATELLITE_FRONT_END */
     front_end->demod->prop->dd_mode.invert_spectrum = Si2183_L2_Set_Invert_Spectrum(front_end);
-    if (Si2183_L1_SetProperty2(front_end->demod, Si2183_DD_MODE_PROP_CODE)==0) {
-      Si2183_L1_DD_RESTART(front_end->demod);
+    /* DD_RESTART only if the demod state changed or if DD_MODE differs from the value in use  */
+    /*  (i.e. no DD_RESTART between DVB-T and DVB-T2 or between DVB-S and DVB-S2 in auto mode) */
+    Si2183_PackProperty(front_end->demod->prop      , Si2183_DD_MODE_PROP_CODE, &dd_mode        );
+    Si2183_PackProperty(front_end->demod->propShadow, Si2183_DD_MODE_PROP_CODE, &dd_mode_applied);
+    if ( (actions & ( Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_STANDBY) | Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_WAKEUP)
+                    | Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_INIT   ) | Si2183_SWITCH_ACTION(Si2183_SWITCH_DEMOD_CONFIGURE) ) )
+       || (state->standard == -1) || (dd_mode != dd_mode_applied) ) {
+      plan->actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DD_RESTART);
+      if (Si2183_L1_SetProperty2(front_end->demod, Si2183_DD_MODE_PROP_CODE)==0) {
+        Si2183_L1_DD_RESTART(front_end->demod);
+        state->standard = new_standard;
+      } else {
+        SiTRACE("Demod restart failed !\n");
+        state->standard = -1;
+        ret = 0; goto return_after_disabling_I2c;
+      }
+      DTV_DELAY(Si2183_SWITCH_DD_RESTART)
     } else {
-      SiTRACE("Demod restart failed !\n");
-      ret = 0; goto return_after_disabling_I2c;
+      SiTRACE("DD_MODE 0x%04x already in use, no DD_RESTART\n", dd_mode);
+      plan->skipped  |= Si2183_SWITCH_ACTION(Si2183_SWITCH_DD_RESTART);
+      state->standard = new_standard;
     }
   }
-  DTV_DELAY
 
   /* ------------------------------------------------------------ */
   /* update value of previous_standard to prepare next call       */
@@ -4182,6 +4651,16 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   SiTRACE("sat_tuner_state %d   sat_clock_state %d\n", sat_tuner_state, sat_clock_state);
 #endif /* SATELLITE_FRONT_END */
   SiTRACE("dtv_demod_state %d\n", dtv_demod_state);
+  state->media     = front_end->demod->media;
+  state->demod     = dtv_demod_state;
+#ifdef    TERRESTRIAL_FRONT_END
+  state->ter_tuner = ter_tuner_state;
+  state->ter_clock = ter_clock_state;
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    SATELLITE_FRONT_END
+  state->sat_tuner = sat_tuner_state;
+  state->sat_clock = sat_clock_state;
+#endif /* SATELLITE_FRONT_END */
 
   if (force_full_init > 1) {
     SiTRACE("........force_full_init 0x%02x; launching a second run..............\n", force_full_init);
@@ -4213,37 +4692,112 @@ signed   int  Si2183_L2_switch_to_standard (Si2183_L2_Context *front_end, unsign
   if (sat_i2c_connected) {
     SiTRACE("-- I2C -- Disconnect SAT tuner i2c\n");
     front_end->f_SAT_tuner_disable(front_end->callback);
-    DTV_DELAY
+    plan->actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_I2C);
+    DTV_DELAY(Si2183_SWITCH_I2C)
   }
   #endif /* SATELLITE_FRONT_END */
   #ifdef    TERRESTRIAL_FRONT_END
   if (ter_i2c_connected) {
     SiTRACE("-- I2C -- Disconnect TER tuner i2c\n");
     front_end->f_TER_tuner_disable(front_end->callback);
-    DTV_DELAY
+    plan->actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_I2C);
+    DTV_DELAY(Si2183_SWITCH_I2C)
   }
   #endif /* TERRESTRIAL_FRONT_END */
   #else  /* INDIRECT_I2C_CONNECTION */
   if (i2c_connected) {
     SiTRACE("Disconnect tuners i2c\n");
     Si2183_L2_Tuner_I2C_Disable(front_end);
-    DTV_DELAY
+    plan->actions |= Si2183_SWITCH_ACTION(Si2183_SWITCH_I2C);
+    DTV_DELAY(Si2183_SWITCH_I2C)
   }
   #endif /* INDIRECT_I2C_CONNECTION */
+  plan->result = ret;
 #ifdef    PROFILING
-  snprintf(sequence,1000, "%s","");
+  plan->total_ms = system_time()-switch_start;
+  Si2183_L2_Switch_Text(front_end, sequence, 1000);
+  SiTRACE("%s", sequence);
+#endif /* PROFILING */
+  SiTRACE("Si2183_switch_to_standard complete\n\n\n");
+  return ret;
+}
+/************************************************************************************************************************
+  Si2183_L2_Switch_Invalidate function
+  Use:      front-end state reset function
+            Used to force all steps at the next Si2183_L2_switch_to_standard, after a HW reset or when
+             the parts have been controlled without Si2183_L2_switch_to_standard
+  Parameter: front_end, a pointer to the Si2183 front-end context
+************************************************************************************************************************/
+void          Si2183_L2_Switch_Invalidate  (Si2183_L2_Context *front_end)
+{
+  front_end->switch_state.standard    = -1;
+  front_end->switch_state.ter_lo      = -1;
+  front_end->switch_state.ter_lif_amp = -1;
+  front_end->switch_state.ter_fef     = -1;
+}
+/************************************************************************************************************************
+  Si2183_L2_Switch_Step_Name function
+  Use:      switch step text function
+            Used to retrieve the name of a Si2183_L2_switch_to_standard step
+  Parameter: step, a Si2183_SWITCH_xxx value
+************************************************************************************************************************/
+const char   *Si2183_L2_Switch_Step_Name   (signed   int step)
+{
+  switch (step) {
+    case Si2183_SWITCH_DEMOD_STANDBY    : return "demod_standby"    ;
+    case Si2183_SWITCH_SAT_TUNER_STANDBY: return "sat_tuner_standby";
+    case Si2183_SWITCH_TER_TUNER_STANDBY: return "ter_tuner_standby";
+    case Si2183_SWITCH_SAT_TUNER_WAKEUP : return "sat_tuner_wakeup" ;
+    case Si2183_SWITCH_SAT_CLOCK_ON     : return "sat_clock_on"     ;
+    case Si2183_SWITCH_TER_TUNER_WAKEUP : return "ter_tuner_wakeup" ;
+    case Si2183_SWITCH_TER_CLOCK_ON     : return "ter_clock_on"     ;
+    case Si2183_SWITCH_TER_LO_INJECTION : return "ter_lo_injection" ;
+    case Si2183_SWITCH_TER_LIF_AMP      : return "ter_lif_amp"      ;
+    case Si2183_SWITCH_DEMOD_WAKEUP     : return "demod_wakeup"     ;
+    case Si2183_SWITCH_DEMOD_INIT       : return "demod_init"       ;
+    case Si2183_SWITCH_DEMOD_CONFIGURE  : return "demod_configure"  ;
+    case Si2183_SWITCH_TER_FEF          : return "ter_fef"          ;
+    case Si2183_SWITCH_DD_RESTART       : return "dd_restart"       ;
+    case Si2183_SWITCH_I2C              : return "i2c"              ;
+    default                             : break;
+  }
+  return "unknown";
+}
+/************************************************************************************************************************
+  Si2183_L2_Switch_Text function
+  Use:      switch profiling text function
+            Used to display the actions and per-step durations of the last Si2183_L2_switch_to_standard
+  Parameter: front_end, a pointer to the Si2183 front-end context
+  Parameter: text, a buffer to store the text
+  Parameter: size, the text buffer size
+  Returns:  the text length
+************************************************************************************************************************/
+signed   int  Si2183_L2_Switch_Text        (Si2183_L2_Context *front_end, char *text, signed   int size)
+{
+  Si2183_Switch_Plan *plan;
+  signed   int        step;
+  plan = &(front_end->switch_plan);
+  snprintf(text, size, "%s->%s ", Si2183_standardName(plan->from), Si2183_standardName(plan->to));
 #ifdef    TERRESTRIAL_FRONT_END
-  STRING_APPEND_SAFE(sequence,1000, "| TER: %4d ms ", ter_tuner_delay);
+  STRING_APPEND_SAFE(text, size, "| TER: %4d ms ", plan->ter_ms);
 #endif /* TERRESTRIAL_FRONT_END */
 #ifdef    SATELLITE_FRONT_END
-  STRING_APPEND_SAFE(sequence,1000, "| SAT: %4d ms ", sat_tuner_delay);
+  STRING_APPEND_SAFE(text, size, "| SAT: %4d ms ", plan->sat_ms);
 #endif /* SATELLITE_FRONT_END */
-  STRING_APPEND_SAFE(sequence,1000, "| DTV: %4d ms ", dtv_demod_delay);
-  STRING_APPEND_SAFE(sequence,1000, "| (%5d ms) "   , system_time()-switch_start);
-  SiTRACE("%s\n", sequence);
-#endif /* PROFILING */
-  SiTRACE("Si2183_switch_to_standard complete\n\n\n");
-  return ret;
+  STRING_APPEND_SAFE(text, size, "| DTV: %4d ms ", plan->dtv_ms);
+  STRING_APPEND_SAFE(text, size, "| (%5d ms) "   , plan->total_ms);
+  STRING_APPEND_SAFE(text, size, "| actions:");
+  for (step = 0; step < Si2183_SWITCH_STEPS; step++) {
+    if (plan->actions & Si2183_SWITCH_ACTION(step)) { STRING_APPEND_SAFE(text, size, " %s(%d)", Si2183_L2_Switch_Step_Name(step), plan->step_ms[step]); }
+  }
+  if (plan->skipped) {
+    STRING_APPEND_SAFE(text, size, " | skipped:");
+    for (step = 0; step < Si2183_SWITCH_STEPS; step++) {
+      if (plan->skipped & Si2183_SWITCH_ACTION(step)) { STRING_APPEND_SAFE(text, size, " %s", Si2183_L2_Switch_Step_Name(step)); }
+    }
+  }
+  STRING_APPEND_SAFE(text, size, "%s", "\n");
+  return (signed int)strlen(text);
 }
 /************************************************************************************************************************
   Si2183_lock_to_carrier function
@@ -4292,6 +4846,9 @@ signed   int   Si2183_L2_lock_to_carrier   (Si2183_L2_Context *front_end
   signed   int new_lock;
   signed   int max_lock_time_ms;
   signed   int min_lock_time_ms;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  signed   int default_max_lock_time_ms;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
 #ifdef    DEMOD_DVB_S_S2_DSS
   signed   int isi_id;
   signed   int lpf_khz;
@@ -4422,6 +4979,22 @@ signed   int   Si2183_L2_lock_to_carrier   (Si2183_L2_Context *front_end
     }
   }
 
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  /* Use the learned lock times if lower than the default ones. After a learned timeout, keep the default max lock time */
+  default_max_lock_time_ms = max_lock_time_ms;
+  if (new_lock == 1) {
+    front_end->lockTimeoutExtended = 0;
+  }
+  front_end->lockTime_ms = -1;
+  if ( (front_end->lockTimeoutMax_ms > 0) && (front_end->lockTimeoutMax_ms < max_lock_time_ms) && (front_end->lockTimeoutExtended == 0) ) {
+    max_lock_time_ms = front_end->lockTimeoutMax_ms;
+  }
+  if ( (front_end->lockTimeoutMin_ms > 0) && (front_end->lockTimeoutMin_ms < min_lock_time_ms) ) {
+    min_lock_time_ms = front_end->lockTimeoutMin_ms;
+  }
+  SiTRACE ("Si2183_lock_to_carrier min_lock_time_ms %d max_lock_time_ms %d (default %d)\n", min_lock_time_ms, max_lock_time_ms, default_max_lock_time_ms);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+
   /* change settings only if not testing the relock time upon a reset (activated if freq<0) */
   if ( (freq >= 0 ) && (new_lock == 1) ) {
 #ifdef    DEMOD_DVB_S_S2_DSS
@@ -4875,9 +5448,24 @@ signed   int   Si2183_L2_lock_to_carrier   (Si2183_L2_Context *front_end
     /* timeout management (this should never happen if timeout values are correctly set) */
     searchDelay = system_time() - front_end->searchStartTime;
     if (searchDelay >= max_lock_time_ms) {
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+      if (max_lock_time_ms < default_max_lock_time_ms) {
+        front_end->nbLearnedTimeouts++;
+        if ( (front_end->lockTimeoutVerify > 0) && ( (front_end->nbLearnedTimeouts % front_end->lockTimeoutVerify) == 0) ) {
+          SiTRACE ("Si2183_lock_to_carrier learned timeout(%d) after %d ms, verifying up to %d ms\n", max_lock_time_ms, searchDelay, default_max_lock_time_ms);
+          front_end->nbLearnedVerified++;
+          front_end->lockTimeoutExtended = 1;
+          max_lock_time_ms = default_max_lock_time_ms;
+        }
+      }
+      if (searchDelay >= max_lock_time_ms) {
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
       SiTRACE ("Si2183_lock_to_carrier timeout(%d) after %d ms\n", max_lock_time_ms, searchDelay);
       goto exit_lock;
       break;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+      }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
     }
 
     if (front_end->handshakeUsed == 1) {
@@ -4911,8 +5499,15 @@ signed   int   Si2183_L2_lock_to_carrier   (Si2183_L2_Context *front_end
     Si2183_L1_DD_BER  (front_end->demod, Si2183_DD_BER_CMD_RST_CLEAR  );
     Si2183_L1_DD_UNCOR(front_end->demod, Si2183_DD_UNCOR_CMD_RST_CLEAR);
     SiTRACE ("Si2183_lock_to_carrier 'lock'  took %3d ms\n"        , searchDelay);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    front_end->lockTime_ms = searchDelay;
+    if (front_end->lockTimeoutExtended) {
+      SiTRACE ("Si2183_lock_to_carrier lock after the learned timeout (%d ms)\n", front_end->lockTimeoutMax_ms);
+      front_end->nbLearnedMisses++;
+    }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
 #ifdef    DEMOD_DVB_T2
-    plp_index = plp_index;
+    plp_index = plp_index;
 #ifdef    SiTRACES
     if (front_end->demod->rsp->dd_status.modulation == Si2183_DD_MODE_PROP_MODULATION_DVBT2) {
       Si2183_L1_DVBT2_STATUS   (front_end->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK);
@@ -5282,6 +5877,7 @@ signed   int  Si2183_L2_TER_FEF            (Si2183_L2_Context *front_end, signed
 {
   front_end = front_end; /* To avoid compiler warning if not used */
   SiTRACE("Si2183_L2_TER_FEF %d \n",fef);
+  front_end->switch_state.ter_fef = -1; /* Set by Si2183_L2_TER_FEF_SETUP only */
 
   #ifdef    L1_RF_TER_TUNER_DTV_AGC_AUTO_FREEZE
     SiTRACE("TER tuner: AUTO_AGC_FREEZE\n");
@@ -5346,6 +5942,7 @@ signed   int  Si2183_L2_TER_FEF_SETUP      (Si2183_L2_Context *front_end, signed
   #endif /* L1_RF_TER_TUNER_FEF_MODE_SLOW_NORMAL_AGC */
 
   Si2183_L2_TER_FEF(front_end, fef);
+  front_end->switch_state.ter_fef = fef;
 
   SiTRACE("Si2183_L2_TER_FEF_SETUP done\n");
   return 1;
@@ -5762,7 +6359,7 @@ signed   int  Si2183_L2_Channel_Seek_Init  (Si2183_L2_Context *front_end, signed
   if (front_end->demod->rsp->get_rev.mcm_die == Si2183_GET_REV_RESPONSE_MCM_DIE_DIE_A) {
       SiTRACE(" die A");
   } else if (front_end->demod->rsp->get_rev.mcm_die == Si2183_GET_REV_RESPONSE_MCM_DIE_DIE_B) {
-      SiTRACE(" die B");
+      SiTRACE(" die B");
   }
   SiTRACE(" Running FW %c_%cb%d\n", front_end->demod->rsp->get_rev.cmpmajor
          , front_end->demod->rsp->get_rev.cmpminor
@@ -6087,6 +6684,9 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
     signed   int  max_lock_time_ms;
     signed   int  min_lock_time_ms;
     signed   int  max_decision_time_ms;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    signed   int  default_max_lock_time_ms;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
     signed   int  blind_mode;
     signed   int  skip_resume;
     signed   int  start_resume;
@@ -6205,6 +6805,20 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
       }
     }
     SiTRACE("blindscan : max_lock_time_ms %d\n", max_lock_time_ms);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    /* In not blind mode, use the learned lock times if lower than the default ones */
+    default_max_lock_time_ms = max_lock_time_ms;
+    front_end->lockTime_ms   = -1;
+    if (blind_mode == 0) {
+      if ( (front_end->lockTimeoutMax_ms > 0) && (front_end->lockTimeoutMax_ms < max_lock_time_ms) && (front_end->lockTimeoutExtended == 0) ) {
+        max_lock_time_ms = front_end->lockTimeoutMax_ms;
+      }
+      if ( (front_end->lockTimeoutMin_ms > 0) && (front_end->lockTimeoutMin_ms < min_lock_time_ms) ) {
+        min_lock_time_ms = front_end->lockTimeoutMin_ms;
+      }
+      SiTRACE("Seek_Next : learned min_lock_time_ms %d max_lock_time_ms %d\n", min_lock_time_ms, max_lock_time_ms);
+    }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
 
     seekStartTime = system_time();
 
@@ -6313,6 +6927,12 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
         SiTRACE   ("Si2183_L2_Channel_Seek_Next 'reset' took %3d ms\n", system_time() - front_end->ddRestartTime);
         /* In non-blind mode, the time-out reference is the last DD_RESTART or DVBC2_CTRL */
         front_end->timeoutStartTime = system_time();
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+        if (front_end->lockTimeoutExtended) {
+          front_end->lockTimeoutExtended = 0;
+          if ( (front_end->lockTimeoutMax_ms > 0) && (front_end->lockTimeoutMax_ms < max_lock_time_ms) ) { max_lock_time_ms = front_end->lockTimeoutMax_ms; }
+        }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
         /* as we will not lock in less than min_lock_time_ms, wait a while... */
         system_wait(min_lock_time_ms);
       }
@@ -6352,6 +6972,9 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
             /* Check PCL to refine the max_lock_time_ms value if the standard has been detected */
             if   (front_end->demod->rsp->dd_status.pcl        == Si2183_DD_STATUS_RESPONSE_PCL_LOCKED) {
               if (front_end->demod->rsp->dd_status.modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT ) { max_lock_time_ms = Si2183_DVBT_MAX_LOCK_TIME ;}
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+              if ( (front_end->lockTimeoutMax_ms > 0) && (front_end->lockTimeoutMax_ms < max_lock_time_ms) && (front_end->lockTimeoutExtended == 0) ) { max_lock_time_ms = front_end->lockTimeoutMax_ms; }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             }
           }
           if ( (front_end->demod->rsp->dd_status.dl  == Si2183_DD_STATUS_RESPONSE_DL_NO_LOCK  ) & ( front_end->demod->rsp->dd_status.rsqstat_bit5   == Si2183_DD_STATUS_RESPONSE_RSQSTAT_BIT5_CHANGE    ) ) {
@@ -6377,6 +7000,9 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
               *freq         = front_end->detected_rf;
               decisionDelay = system_time() - front_end->ddRestartTime; front_end->cumulativeScanTime = front_end->cumulativeScanTime + decisionDelay; front_end->nbDecisions++;
               SiTRACE ("DVB-T  lock at %10d after %7d ms. Delay from DD_RESTART %4d ms AGC2 %3d\n", (front_end->detected_rf)/1000, searchDelay, decisionDelay, api->rsp->dd_ext_agc_ter.agc_2_level);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+              front_end->lockTime_ms = decisionDelay;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             }
 #endif /* DEMOD_DVB_T */
 #ifdef    DEMOD_DVB_T2
@@ -6397,6 +7023,9 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
               front_end->detected_rf = seek_freq + front_end->demod->rsp->dvbt2_status.afc_freq*1000;
               decisionDelay = system_time() - front_end->ddRestartTime; front_end->cumulativeScanTime = front_end->cumulativeScanTime + decisionDelay; front_end->nbDecisions++;
               SiTRACE ("DVB-T2 lock at %10d after %7d ms. Delay from DD_RESTART %4d ms AGC2 %3d\n", (front_end->detected_rf)/1000, searchDelay, decisionDelay, api->rsp->dd_ext_agc_ter.agc_2_level);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+              front_end->lockTime_ms = decisionDelay;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
               switch (front_end->demod->prop->dd_mode.bw) {
                 case Si2183_DD_MODE_PROP_BW_BW_1D7MHZ : { *bandwidth_Hz =                                    1700000; break; }
                 default                               : { *bandwidth_Hz = front_end->demod->prop->dd_mode.bw*1000000; break; }
@@ -6406,6 +7035,9 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
             }
 #endif /* DEMOD_DVB_T2 */
 #ifdef    DEMOD_DVB_T
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+            if (front_end->lockTimeoutExtended) { front_end->nbLearnedMisses++; front_end->lockTimeoutExtended = 0; }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             /* Set min seek_freq for next seek */
             front_end->rangeMin = seek_freq + front_end->seekBWHz;
             /* Return 1 to signal that the Si2183 is locked on a valid channel */
@@ -6445,7 +7077,13 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
               *freq         = front_end->detected_rf;
               decisionDelay = system_time() - front_end->ddRestartTime; front_end->cumulativeScanTime = front_end->cumulativeScanTime + decisionDelay; front_end->nbDecisions++;
               SiTRACE ("ISDB-T  lock at %10d after %7d ms. Delay from DD_RESTART %4d ms AGC2 %3d\n", (front_end->detected_rf)/1000, searchDelay, decisionDelay, api->rsp->dd_ext_agc_ter.agc_2_level);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+              front_end->lockTime_ms = decisionDelay;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             }
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+            if (front_end->lockTimeoutExtended) { front_end->nbLearnedMisses++; front_end->lockTimeoutExtended = 0; }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             /* Set min seek_freq for next seek */
             front_end->rangeMin = seek_freq + front_end->seekBWHz;
             /* Return 1 to signal that the Si2183 is locked on a valid channel */
@@ -6506,6 +7144,10 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
             *bandwidth_Hz   = front_end->demod->prop->dd_mode.bw*1000000;
             *freq           = front_end->demod->rsp->dvbc2_status.rf_freq;
             SiTRACE ("DVB-C2  rf_freq %10ld start_frequency_hz %10ld c2_bandwidth_hz %10ld front_end->seekBWHz %d. front_end->rangeMin %10d\n", front_end->demod->rsp->dvbc2_status.rf_freq, front_end->demod->rsp->dvbc2_sys_info.start_frequency_hz, front_end->demod->rsp->dvbc2_sys_info.c2_bandwidth_hz, front_end->seekBWHz, front_end->rangeMin );
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+            front_end->lockTime_ms = decisionDelay;
+            if (front_end->lockTimeoutExtended) { front_end->nbLearnedMisses++; front_end->lockTimeoutExtended = 0; }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
             /* Set min seek_freq for next seek */
             front_end->rangeMin = front_end->demod->rsp->dvbc2_sys_info.start_frequency_hz + front_end->demod->rsp->dvbc2_sys_info.c2_bandwidth_hz + front_end->demod->prop->dd_mode.bw*1000000/2;
             /* Return 1 to signal that the Si2183 is locked on a valid channel */
@@ -6517,6 +7159,17 @@ signed   int  Si2183_L2_Channel_Seek_Next  (Si2183_L2_Context *front_end
 
         /* timeout management (this should only trigger if the channel is very difficult, i.e. when pcl = 1 and dl = 0 until the timeout) */
         timeoutDelay = system_time() - front_end->timeoutStartTime;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+        if ( (timeoutDelay >= max_lock_time_ms) && (max_lock_time_ms < default_max_lock_time_ms) ) {
+          front_end->nbLearnedTimeouts++;
+          if ( (front_end->lockTimeoutVerify > 0) && ( (front_end->nbLearnedTimeouts % front_end->lockTimeoutVerify) == 0) ) {
+            SiTRACE ("----------- Learned timeout at %10d after %7d ms, verifying up to %d ms\n", seek_freq, timeoutDelay, default_max_lock_time_ms);
+            front_end->nbLearnedVerified++;
+            front_end->lockTimeoutExtended = 1;
+            max_lock_time_ms = default_max_lock_time_ms;
+          }
+        }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
         if (timeoutDelay >= max_lock_time_ms) {
           decisionDelay = system_time() - front_end->ddRestartTime; front_end->cumulativeTimeoutTime = front_end->cumulativeTimeoutTime + decisionDelay; front_end->nbTimeouts++;
           SiTRACE ("----------- Timeout from  %10d after %7d ms. Delay from DD_RESTART %4d ms\n", seek_freq, timeoutDelay, decisionDelay);
@@ -7863,6 +8516,7 @@ demod spi_download <enable/disable> <api_send_option> : enable/disable SPI downl
 demod spi_regs                         : displays SPI registers\n\
 demod health_check                     : displays registers interesting for health checking\n\
 demod handshake  infos                 : displays current handshake settings\n\
+demod switch_plan                      : displays the actions and step durations of the last switch_to_standard\n\
 demod handshake  used   <0/1>          : controls front_end->handshakeUsed\n\
 demod handshake  period <period_ms>    : controls front_end->handshakePeriod\n\
 demod clock_mode ter <clock_mode>      : controls front_end->demod->tuner_ter_clock_input\n\
@@ -7902,6 +8556,11 @@ demod c2 all                           : displays the c2 dataslice and plp info
   }
   else if (strcmp_nocase(target,"demod"     ) == 0) {
     if (strcmp_nocase(cmd,"help"        ) == 0) { return Si2183_L2_Test(front_end, "help", cmd, sub_cmd, dval, retdval, rettxt); }
+    if (strcmp_nocase(cmd,"switch_plan" ) == 0) {
+      Si2183_L2_Switch_Text(front_end, *rettxt, 1000);
+      *retdval = (double)front_end->switch_plan.total_ms;
+      return 1;
+    }
     if (strcmp_nocase(cmd,"setProperty" ) == 0) {
       if (sscanf(sub_cmd,"%x",&i) == 0) {
         SiERROR("TestPipe demod setProperty <hex_property_code> <hex_value>\n");
@@ -8838,6 +9497,7 @@ demod c2 all                           : displays the c2 dataslice and plp info
     return 0;
   }
   else if (strcmp_nocase(target,"ter_tuner" ) == 0) {
+    Si2183_L2_Switch_Invalidate(front_end); /* The TER tuner settings may be changed by the test commands */
 #ifdef    DEMOD_DVB_T
    #ifdef    INDIRECT_I2C_CONNECTION
     front_end->f_TER_tuner_enable(front_end->callback);
@@ -25,6 +25,13 @@ limitations under the License.
    Date: May 21 2015
 **************************************************************************************/
 /* Change log:
+ As from V0.3.5.2:
+    <new_feature>[INIT/Warm_attach] Adding Si2183_WarmAttach* prototypes and Si2183_WARM_ATTACH_BUILD (if WARM_ATTACH)
+    <new_feature>[FW/container] Adding Si2183_LoadFirmware_Container and Si2183_FW_Container_Build prototypes (if FW_CONTAINER)
+    <new_feature>[lock/adaptive_timeout] Adding lockTimeout* and lockTime_ms members in Si2183_L2_Context (if ADAPTIVE_LOCK_TIMEOUT)
+    <new_feature>[switch/profiling] Adding Si2183_Switch_State and Si2183_Switch_Plan, with switch_state and switch_plan members in Si2183_L2_Context,
+      the Si2183_SWITCH_xxx step defines and the Si2183_L2_Switch_Invalidate, Si2183_L2_Switch_Step_Name and Si2183_L2_Switch_Text prototypes.
+
  As from V0.3.5.1:
     <correction>[prototype] Adding Si2183_L2_Health_Check prototype
 
@@ -134,6 +141,56 @@ limitations under the License.
 #define Si2183_USE_TER_CLOCK        0x20
 #define Si2183_USE_SAT_CLOCK        0x40
 
+/* Steps of Si2183_L2_switch_to_standard. Each step is a bit in the plan actions (Si2183_SWITCH_ACTION) and an index in step_ms */
+#define Si2183_SWITCH_DEMOD_STANDBY        0  /* demod standby (and SILENT mode if not needed)   */
+#define Si2183_SWITCH_SAT_TUNER_STANDBY    1  /* SAT tuner clock off and standby                  */
+#define Si2183_SWITCH_TER_TUNER_STANDBY    2  /* TER tuner clock off and standby                  */
+#define Si2183_SWITCH_SAT_TUNER_WAKEUP     3  /* SAT tuner init or wake up                        */
+#define Si2183_SWITCH_SAT_CLOCK_ON         4
+#define Si2183_SWITCH_TER_TUNER_WAKEUP     5  /* TER tuner init or wake up (and config)           */
+#define Si2183_SWITCH_TER_CLOCK_ON         6
+#define Si2183_SWITCH_TER_LO_INJECTION     7  /* TER tuner ATV or DTV LO injection                */
+#define Si2183_SWITCH_TER_LIF_AMP          8  /* TER tuner LIF output amplitude (TER or cable)    */
+#define Si2183_SWITCH_DEMOD_WAKEUP         9  /* demod wake up (or exit from SILENT mode)         */
+#define Si2183_SWITCH_DEMOD_INIT          10  /* demod init (including the FW download)           */
+#define Si2183_SWITCH_DEMOD_CONFIGURE     11  /* demod configuration for the TER or SAT media     */
+#define Si2183_SWITCH_TER_FEF             12  /* TER tuner FEF mode                               */
+#define Si2183_SWITCH_DD_RESTART          13  /* DD_MODE setting and DD_RESTART                   */
+#define Si2183_SWITCH_I2C                 14  /* tuner i2c pass-through connections               */
+#define Si2183_SWITCH_STEPS               15
+#define Si2183_SWITCH_ACTION(step)        (1<<(step))
+
+/* Front-end state, as used by Si2183_L2_switch_to_standard to plan the minimal action list.               */
+/* The standard, media and property set are those of the demod, the power states those of each part.       */
+/* The TER tuner settings and the demod standard are set to -1 when unknown, to force the related steps.   */
+typedef struct _Si2183_Switch_State {
+   signed   int                standard;        /* standard applied with the last DD_RESTART, -1 if unknown (standby, SILENT, init) */
+   signed   int                media;           /* media of the last switch                                                         */
+   signed   int                demod;           /* 1 if the demod is active                                                         */
+   signed   int                ter_tuner;       /* 1 if the TER tuner is active                                                     */
+   signed   int                ter_clock;       /* 1 if the TER tuner clock is on                                                   */
+   signed   int                sat_tuner;       /* 1 if the SAT tuner is active                                                     */
+   signed   int                sat_clock;       /* 1 if the SAT tuner clock is on                                                   */
+   signed   int                ter_lo;          /* TER tuner LO injection (0: DTV, 1: ATV), -1 if unknown                           */
+   signed   int                ter_lif_amp;     /* TER tuner LIF output amplitude (0: TER, 1: cable), -1 if unknown                 */
+   signed   int                ter_fef;         /* TER tuner FEF mode set by Si2183_L2_TER_FEF_SETUP, -1 if unknown                 */
+} Si2183_Switch_State;
+
+/* Actions and per-step durations of the last Si2183_L2_switch_to_standard */
+typedef struct _Si2183_Switch_Plan {
+   signed   int                from;            /* previous standard                                                                */
+   signed   int                to;              /* new standard                                                                     */
+   unsigned int                actions;         /* Si2183_SWITCH_ACTION(step) for each planned step                                 */
+   unsigned int                skipped;         /* Si2183_SWITCH_ACTION(step) for each step avoided thanks to the front-end state   */
+   signed   int                step_ms[Si2183_SWITCH_STEPS];
+   signed   int                ter_ms;          /* TER tuner part of the switch time                                                */
+   signed   int                sat_ms;          /* SAT tuner part of the switch time                                                */
+   signed   int                dtv_ms;          /* demod and i2c part of the switch time                                            */
+   signed   int                total_ms;
+   signed   int                result;          /* Si2183_L2_switch_to_standard return value                                        */
+   unsigned long               count;           /* number of switches since Si2183_L2_SW_Init                                       */
+} Si2183_Switch_Plan;
+
 #ifdef    INDIRECT_I2C_CONNECTION
   typedef signed   int  (*Si2183_INDIRECT_I2C_FUNC)  (void*);
 #endif /* INDIRECT_I2C_CONNECTION */
@@ -215,8 +272,20 @@ typedef struct _Si2183_L2_Context {
    signed   int                nbTimeouts;
    signed   int                nbDecisions;
    unsigned char               handshakeOn;
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+   signed   int                lockTimeoutMax_ms;   /* Learned max lock time, used when > 0 and below the default value                  */
+   signed   int                lockTimeoutMin_ms;   /* Learned min lock time, used when > 0 and below the default value                  */
+   signed   int                lockTimeoutVerify;   /* Every lockTimeoutVerify learned timeouts, the wait goes on up to the default value */
+   signed   int                lockTimeoutExtended; /* Set when the current lock attempt continues after the learned timeout            */
+   signed   int                lockTime_ms;         /* Duration of the last successful lock, -1 if the last attempt failed               */
+   unsigned long               nbLearnedTimeouts;   /* Number of lock attempts reaching the learned timeout                              */
+   unsigned long               nbLearnedVerified;   /* Number of learned timeouts followed by a wait up to the default value             */
+   unsigned long               nbLearnedMisses;     /* Number of locks obtained after the learned timeout (while verifying)              */
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
    signed   int                center_rf;
    unsigned int                misc_infos;
+   Si2183_Switch_State         switch_state;       /* Front-end state after the last Si2183_L2_switch_to_standard */
+   Si2183_Switch_Plan          switch_plan;        /* Actions and durations of the last Si2183_L2_switch_to_standard */
 } Si2183_L2_Context;
 
 /* firmware_struct needs to be declared to allow loading the FW in 16 bytes mode */
@@ -228,6 +297,10 @@ typedef struct firmware_struct {
 } firmware_struct;
 #endif /* __FIRMWARE_STRUCT__ */
 
+#ifdef    FW_CONTAINER
+  #include "SiLabs_FW_Container.h"
+#endif /* FW_CONTAINER */
+
 signed   int   Si2183_Init                      (L1_Si2183_Context *api);
 signed   int   Si2183_Media                     (L1_Si2183_Context *api, signed   int modulation);
 signed   int   Si2183_Configure                 (L1_Si2183_Context *api);
@@ -239,6 +312,28 @@ signed   int   Si2183_LoadFirmware_16           (L1_Si2183_Context *api, firmwar
 signed   int   Si2183_LoadFirmwareSPI           (L1_Si2183_Context *api, unsigned char  *fw_table, signed   int nbBytes, unsigned char pbl_key,  unsigned char pbl_num);
 signed   int   Si2183_LoadFirmwareSPI_Split     (L1_Si2183_Context *api, unsigned char  *fw_table, signed   int nbBytes, unsigned char pbl_key,  unsigned char pbl_num , unsigned int num_split, unsigned int *split_list);
 #endif /* FW_DOWNLOAD_OVER_SPI */
+#ifdef    FW_CONTAINER
+signed   int   Si2183_LoadFirmware_Container    (L1_Si2183_Context *api);
+signed   int   Si2183_FW_Container_Build        (const char *path);
+#endif /* FW_CONTAINER */
+#ifdef    WARM_ATTACH
+/* Si2183_WARM_ATTACH_BUILD identifies the code which loaded the FW. A snapshot from another build forces a full init.
+    The FW and patch versions are checked separately (GET_REV), so the default value only changes with this L2 API version,
+    and builds are reproducible. Define it at project level (i.e. to the application version) to be more selective,
+    or define Si2183_WARM_ATTACH_BUILD_STAMP to use the build date and time (any rebuild then forces a full init). */
+#ifndef   Si2183_WARM_ATTACH_BUILD
+ #ifdef    Si2183_WARM_ATTACH_BUILD_STAMP
+  #define Si2183_WARM_ATTACH_BUILD __DATE__ " " __TIME__
+ #else  /* Si2183_WARM_ATTACH_BUILD_STAMP */
+  #define Si2183_WARM_ATTACH_BUILD "Si2183_L2 V0.3.5.2"
+ #endif /* Si2183_WARM_ATTACH_BUILD_STAMP */
+#endif /* Si2183_WARM_ATTACH_BUILD */
+unsigned long  Si2183_WarmAttach_Checksum       (Si2183_WARM_Snapshot *snapshot);
+signed   int   Si2183_WarmAttach_Snapshot       (L1_Si2183_Context *api);
+signed   int   Si2183_WarmAttach_Valid          (L1_Si2183_Context *api);
+signed   int   Si2183_WarmAttach_Read_Properties(L1_Si2183_Context *api);
+signed   int   Si2183_WarmAttach                (L1_Si2183_Context *api);
+#endif /* WARM_ATTACH */
 signed   int   Si2183_StartFirmware             (L1_Si2183_Context *api);
 signed   int   Si2183_STANDBY                   (L1_Si2183_Context *api);
 signed   int   Si2183_WAKEUP                    (L1_Si2183_Context *api);
@@ -278,6 +373,9 @@ signed   int   Si2183_L2_Set_Index_and_Tag        (Si2183_L2_Context   *front_en
 void           Si2183_L2_HW_Connect               (Si2183_L2_Context   *front_end, CONNECTION_TYPE mode);
     /*  Locking and status functions */
 signed   int   Si2183_L2_switch_to_standard       (Si2183_L2_Context   *front_end, unsigned char new_standard, unsigned char force_full_init);
+void           Si2183_L2_Switch_Invalidate        (Si2183_L2_Context   *front_end);
+const char    *Si2183_L2_Switch_Step_Name         (signed   int step);
+signed   int   Si2183_L2_Switch_Text              (Si2183_L2_Context   *front_end, char *text, signed   int size);
 signed   int   Si2183_L2_lock_to_carrier          (Si2183_L2_Context   *front_end
                                  ,  signed   int  standard
                                  ,  signed   int  freq
@@ -26,6 +26,10 @@ limitations under the License.
 **************************************************************************************/
 /* Change log:
 
+ As from V0.3.5.2:
+  <new_feature>[INIT/Warm_attach] Adding Si2183_WARM_Snapshot and warm-attach fields in L1_Si2183_Context (when WARM_ATTACH is defined)
+    These are used to resume control of a demodulator already running the expected firmware, without reset nor download.
+
  As from V0.1.3.0:
   <new_feature>[Broadcast_i2c/demods] Adding '#defines' for broadcast i2c
   <new_feature>[DVB-S2/Multiple_Input_Stream] Adding MIS_capability field in L1_Si2183_Context
@@ -118,6 +122,41 @@ typedef struct  {
 /* define the tuner broadcast address for common patch download. */
 #define Si2183_BROADCAST_ADDRESS 0xCC
 
+#ifdef    WARM_ATTACH
+/* The following defines are used to select the warm-attach mode */
+#define Si2183_WARM_ATTACH_OFF      0   /* always do a full init (reset + FW download)                               */
+#define Si2183_WARM_ATTACH_READ     1   /* propShadow rebuilt using GET_PROPERTY reads of all properties             */
+#define Si2183_WARM_ATTACH_SNAPSHOT 2   /* propShadow restored from the snapshot, DD_MODE checked with GET_PROPERTY  */
+#define Si2183_WARM_SNAPSHOT_MAGIC  0x5357524dUL
+#define Si2183_WARM_BUILD_SIZE      32
+
+/* Structure used to store the state required to attach to a running demodulator.
+    PART_INFO is only available in bootloader mode, so it can't be read once the firmware runs and needs to be stored. */
+typedef struct _Si2183_WARM_Snapshot {
+  unsigned long   magic;
+  unsigned long   size;                                 /* sizeof(Si2183_WARM_Snapshot)                              */
+  char            build[Si2183_WARM_BUILD_SIZE];        /* Si2183_WARM_ATTACH_BUILD value of the code which loaded the FW */
+  unsigned char   part;                                 /* PART_INFO values from the last full init                  */
+  unsigned char   chiprev;
+  unsigned char   romid;
+  unsigned char   pmajor;
+  unsigned char   pminor;
+  unsigned char   pbuild;
+  unsigned char   pn;                                   /* GET_REV values of the firmware started during the last full init */
+  unsigned char   fwmajor;
+  unsigned char   fwminor;
+  unsigned char   cmpmajor;
+  unsigned char   cmpminor;
+  unsigned char   cmpbuild;
+  unsigned char   rev_chiprev;
+  unsigned char   mcm_die;
+  unsigned int    patch;
+  int             media;
+  Si2183_PropObj  prop;                                 /* propShadow values when the snapshot was taken             */
+  unsigned long   checksum;                             /* checksum of all previous fields                           */
+} Si2183_WARM_Snapshot;
+#endif /* WARM_ATTACH */
+
 typedef struct _L1_Si2183_Context {
   L0_Context                 *i2c;
   L0_Context                  i2cObj;
@@ -175,6 +214,12 @@ typedef struct _L1_Si2183_Context {
   firmware_struct   *fw_table;
   unsigned int       nbSpiBytes;
   unsigned char     *spi_table;
+#ifdef    WARM_ATTACH
+  unsigned char         warm_attach;             /* Si2183_WARM_ATTACH_OFF/READ/SNAPSHOT                 */
+  unsigned char         warm_attached;           /* 1 if the last PowerUpWithPatch attached to the running FW */
+  unsigned int          warm_reads;              /* GET_PROPERTY reads done during the last warm-attach  */
+  Si2183_WARM_Snapshot  warm;
+#endif /* WARM_ATTACH */
 
 } L1_Si2183_Context;
 
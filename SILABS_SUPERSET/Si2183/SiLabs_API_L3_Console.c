@@ -22,6 +22,10 @@ limitations under the License.
 /*************************************************************************************************************/
 /* Change log:
 
+  As from V2.8.1:
+   <new_feature>[I2C/statistics] Adding 'i2c_stats' and 'i2c_stats_reset' options, to display/reset the L0 i2c statistics
+     (transactions, bytes, errors and latency histograms per bus, per i2c address and per caller category).
+
   As from V2.7.9:
    <new_feature>[T2/Signaling] Adding 'T2_signaling_on'/'T2_signaling_off' options to control T2 signaling tracing upon lock.
 
@@ -435,13 +439,10 @@ signed   int  last_plp_id         ;
 signed   int  last_T2_base_lite   ;
 signed   int  last_data_slice_id  ;
 signed   int  last_carrier_index  ;
-signed   int  demod_code[4];
-signed   int  demod_add [4];
-char          demod_string_0[100];
-char          demod_string_1[100];
-char          demod_string_2[100];
-char          demod_string_3[100];
-char         *demod_string[4];
+signed   int  demod_code[AUTO_DETECT_DEMOD_COUNT];
+signed   int  demod_add [AUTO_DETECT_DEMOD_COUNT];
+char          demod_string_buffer[AUTO_DETECT_DEMOD_COUNT][100];
+char         *demod_string[AUTO_DETECT_DEMOD_COUNT];
 signed   int  clock_source;
 signed   int  clock_input;
 signed   int  clock_freq;
@@ -2484,6 +2485,23 @@ signed   int  Silabs_bytes_trace               (void)
   front_end               = &(FrontEnd_Table[fe]);
   return trackMode;
 }
+/************************************************************************************************************************
+  Silabs_i2c_stats function
+  Use:        console application i2c statistics function
+              Used to display the L0 i2c statistics, optionally resetting them
+************************************************************************************************************************/
+signed   int  Silabs_i2c_stats                 (signed   int reset)
+{
+  static char statsBuffer[(L0_STATS_MAX_DEVICES*L0_STATS_CATEGORIES + 2)*200];
+  signed   int lines;
+  lines = L0_StatsText(statsBuffer, sizeof(statsBuffer));
+  printf("%s", statsBuffer);
+  if (reset) {
+    L0_StatsReset();
+    printf("i2c statistics cleared\n");
+  }
+  return lines;
+}
 /************************************************************************************************************************
   Silabs_help function
   Use:        console application help function
@@ -2572,6 +2590,8 @@ USB            : connect i2c in USB  mode  \n\
 CUST           : connect i2c in CUST mode  \n\
 trace          : toggle L0 traces\n\
 traces         : manage L0 traces (use 'traces' then 'help' for details)\n\
+i2c_stats      : display the i2c statistics per bus, i2c address and caller category\n\
+i2c_stats_reset: display and clear the i2c statistics\n\
 ");
   printf("\
  ------  Digital TV demodulator ------\n\
@@ -3006,6 +3026,8 @@ signed   int  Silabs_demoloop                  (const char *demo_cmd)
     else if (strcmp_nocase(entry, "traceLevel")==0) { Silabs_UserInput_traceLevel();       return 1;}
 #endif /* SiTRACES */
     else if (strcmp_nocase(entry, "trace"    )==0) { printf("%d\n", Silabs_bytes_trace()); return 1;}
+    else if (strcmp_nocase(entry, "i2c_stats")==0) { Silabs_i2c_stats(0);                 return 1;}
+    else if (strcmp_nocase(entry, "i2c_stats_reset")==0) { Silabs_i2c_stats(1);           return 1;}
     else if (strcmp_nocase(entry, "minimal"  )==0) { full_menu = 0; return 1;}
     else if (strcmp_nocase(entry, "full"     )==0) { full_menu = 1; return 1;}
 #ifdef    DEMOD_DVB_T2
@@ -3250,10 +3272,7 @@ signed   int  main (int argc, char *argv[])
   iimsg        = iimsgTmpBuffer;
   init_calls   = iimsgBigBuffer;
   ucMyBuffer   = ucBufferArea;
-  demod_string[0] = &demod_string_0[0];
-  demod_string[1] = &demod_string_1[0];
-  demod_string[2] = &demod_string_2[0];
-  demod_string[3] = &demod_string_3[0];
+  for (res = 0; res < AUTO_DETECT_DEMOD_COUNT; res++) { demod_string[res] = &demod_string_buffer[res][0]; }
 
   argc=argc; /* To avoid compiler warning */
   argv=argv; /* To avoid compiler warning */
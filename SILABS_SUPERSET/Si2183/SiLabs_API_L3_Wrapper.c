@@ -23,6 +23,72 @@ limitations under the License.
 /* Change log: */
 /* Last  changes:
 
+  As from V2.8.1:
+    <new_feature>[SAT/Unicable/Multi_receivers] In Silabs_API_Test: adding 'unicable_scheduler' target, to test the Unicable user band scheduler.
+    <new_feature>[SAT/DiSEqC] In Silabs_API_Test: adding 'diseqc_queue' target, to test the non-blocking DiSEqC queue.
+    <new_feature>[Status/Multi_process] In Silabs_API_Test: adding 'status_board' target, to test the shared-memory status board.
+    <new_feature>[SIMU/benchmark] In Silabs_API_Test: adding 'benchmark' target, to run the emulator-backed benchmark scenarios.
+    <new_feature>[T2/C2/MPLP] When PLP_DIRECTORY is defined:
+      In SiLabs_API_Get_PLP_ID_and_TYPE and SiLabs_API_Get_PLP_Group_Id: using the PLP directory of the current multiplex.
+      In SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next: invalidating the PLP directory.
+      In Silabs_API_Test: adding 'plp_directory' target, to list the PLPs and test PLP hops.
+    <new_feature>[S2X/MULTISTREAM] When STREAM_DIRECTORY is defined:
+      In SiLabs_API_Get_Stream_Info: using the stream directory of the current transponder.
+      In SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next: invalidating the stream directory.
+      In Silabs_API_Test: adding 'stream_directory' target, to list the ISIs and test stream switches.
+    <new_feature>[power_consumption/Power_manager] When POWER_MANAGER is defined:
+      In SiLabs_API_switch_to_standard: notifying the power manager of the standard changes.
+      In Silabs_API_Test: adding 'power_manager' target, to configure and monitor the power manager.
+    <new_feature>[INIT/Warm_attach] When WARM_ATTACH is defined:
+      Adding SiLabs_API_Warm_Attach, SiLabs_API_Warm_Attached, SiLabs_API_Warm_Save and SiLabs_API_Warm_Load,
+       to restart an application without resetting the parts nor downloading the firmware again.
+    <new_feature>[scan/not_blind] When RSSI_PRESCREEN is defined:
+      In SiLabs_API_Channel_Seek_Init: sweeping the TER tuner RSSI over the scan range to select the candidate steps.
+      In SiLabs_API_Channel_Seek_Next: running the demodulator seek only on the candidate steps.
+      In SiLabs_API_Channel_Seek_End:  ending the pre-screen.
+      In Silabs_API_Test: adding 'rssi_prescreen' target, to configure the pre-screen and check its statistics.
+    <new_feature>[lock/adaptive_timeout] When ADAPTIVE_LOCK_TIMEOUT is defined:
+      In SiLabs_API_lock_to_carrier and SiLabs_API_Channel_Seek_Next: using the learned lock timeouts and recording the lock times.
+      In Silabs_API_Test: adding 'lock_timeout' target, to configure, save and load the lock time statistics.
+    <new_feature>[Status/Export] When STATUS_EXPORT is defined:
+      In Silabs_API_Test: adding 'status_export' target, to read the status as a binary export and render it as text.
+    <new_feature>[ATV/scan] When ATV_PARALLEL_SCAN is defined:
+      In Silabs_API_Test: adding 'atv_scan' target, to scan ATV channels with the TER tuners of several front-ends.
+    <new_feature>[multi_front_end/registry] Adding SiLabs_API_Connected_Front_End, to find the front-end providing a tuner's
+       i2c pass-through, used in SiLabs_API_TER_Tuner_I2C_Enable/Disable and SiLabs_API_SAT_Tuner_I2C_Enable/Disable.
+      When FRONTEND_REGISTRY is defined:
+      In SiLabs_API_SW_Init: using the registry handle as the default TER/SAT tuner I2C connection of registered front-ends.
+      In SiLabs_API_Connected_Front_End: retrieving registered front-ends from their handle, without searching FrontEnd_Table.
+      In Silabs_API_Test: adding 'registry' target, to manage the front-end registry.
+    <improvement>[dual/triple/quad/Broadcast_i2c] In SiLabs_API_Demods_Broadcast_I2C: broadcasting by groups of FRONT_END_COUNT
+       demodulators, to allow more than FRONT_END_COUNT front-ends.
+    <correction>[SAT/DiSEqC] In Silabs_API_Test: 'diseqc_queue' target: using SiLabs_DiSEqC_Queue_Of, as for the other add-ons.
+    <correction>[INIT/discovery] In SiLabs_API_Auto_Detect_Demods: limiting the waits for CTS to 100 ms, to avoid hanging on a stuck bus.
+      Using AUTO_DETECT_DEMOD_COUNT for the number of probed addresses and the size of the result arrays.
+    <new_feature>[INIT/discovery] When HW_DISCOVERY is defined:
+      In Silabs_API_Test: adding 'discovery' target, to discover the parts on all buses and init front-ends from the topology.
+    <improvement>[switch/profiling] In SiLabs_API_TER_Tuner_Init and SiLabs_API_Demod_Standby: resetting the Si2183 front-end state
+       used by Si2183_L2_switch_to_standard to plan the minimal action list.
+    <new_feature>[INIT/single_chip] Testing the demodulator code with SILABS_DEMOD_CHIP in the wrapper functions
+      (except in SiLabs_API_TER_Tuner and SiLabs_API_Demods_Kickstart, which also need to detect the front-ends not initialized).
+      When SINGLE_CHIP_DEMOD is defined, this is a compile-time constant, such that only the selected L2 calls are compiled
+       in the lock, status and tune functions.
+      In SiLabs_API_SW_Init: refusing any chip other than SINGLE_CHIP_DEMOD.
+      SILABS_DEMOD_CHIP evaluates front_end, to avoid unused parameter warnings in single-chip builds.
+    <new_feature>[TS_Crossbar/Router] When TS_CROSSBAR is defined:
+      In Silabs_API_Test: adding 'ts_router' target, to route front-ends to the TS ports of several duals.
+    <new_feature>[Channel_Bonding/Supervisor] When CHANNEL_BONDING is defined:
+      In Silabs_API_Test: adding 'bonding' target, to monitor the bonding legs and to change their roles when a leg is degraded.
+    <new_feature>[TS/adaptive_clock] When ADAPTIVE_TS_CLOCK is defined:
+      In SiLabs_API_Demod_status_selection: adapting the TS clock to the TS bitrate reported by DD_STATUS.
+      In SiLabs_API_lock_to_carrier: restoring the application TS settings before locking.
+      In Silabs_API_Test: adding 'ts_clock' target.
+    <new_feature>[STATUS/extended] When EXTENDED_STATUS is defined:
+      In SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next: invalidating the extended status plan.
+      In Silabs_API_Test: adding 'extended_status' target, to get all DVB-T streams, ISDB-T layers or DVB-T2 PLPs in one snapshot.
+    <improvement>[lock/handshake] In SiLabs_API_lock_to_carrier: invalidating the directories and status plan, applying the learned
+       lock timeouts and restoring the TS settings only for a new lock, not when the call resumes a lock with the handshake.
+
   As from V2.8.0:
     <improvement>[CNR] Correction of CNR reported by demodulator in DVB-T and ISDB-T to better match gaussian CNR level of test equipment.
     <improvement>[SAT/Unicable/Swap] Adding swap_detection_done flag in SILABS_FE_Context (only for SAT and Unicable).
@@ -1021,7 +1087,7 @@ signed   int  Silabs_standardCode                   (SILABS_FE_Context* front_en
 {
   front_end = front_end; /* to avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (standard) {
 #ifdef    DEMOD_DVB_T
       case SILABS_DVB_T : return Si2183_DD_MODE_PROP_MODULATION_DVBT;
@@ -1066,7 +1132,7 @@ signed   int  Silabs_constelCode                    (SILABS_FE_Context* front_en
 {
   front_end = front_end; /* to avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (constel) {
       case SILABS_QAMAUTO : return  0;
       case SILABS_QAM16   : return  7;
@@ -1104,7 +1170,7 @@ signed   int  Silabs_streamCode                     (SILABS_FE_Context* front_en
   stream    = stream;    /* to avoid compiler warning if not used */
 #ifdef    DEMOD_DVB_T
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (stream) {
       case SILABS_HP : return Si2183_DVBT_HIERARCHY_PROP_STREAM_HP   ;
       case SILABS_LP : return Si2183_DVBT_HIERARCHY_PROP_STREAM_LP   ;
@@ -1127,7 +1193,7 @@ signed   int  Silabs_plptypeCode                    (SILABS_FE_Context* front_en
   front_end = front_end; /* to avoid compiler warning if not used */
   plp_type  = plp_type ; /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (plp_type) {
 #ifdef    DEMOD_DVB_T2
       case SILABS_PLP_TYPE_COMMON     : return Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON    ;
@@ -1154,7 +1220,7 @@ signed   int  Silabs_fftCode                        (SILABS_FE_Context* front_en
 #ifdef    DEMOD_DVB_T
 #endif /* DEMOD_DVB_T */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (fft) {
 #ifdef    DEMOD_DVB_T
       case SILABS_FFT_MODE_2K : return Si2183_DVBT_STATUS_RESPONSE_FFT_MODE_2K;
@@ -1193,7 +1259,7 @@ signed   int  Silabs_giCode                         (SILABS_FE_Context* front_en
   front_end = front_end; /* to avoid compiler warning if not used */
   gi        = gi;        /* to avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (gi) {
 #ifdef    DEMOD_DVB_T
       case SILABS_GUARD_INTERVAL_1_32  : return Si2183_DVBT_STATUS_RESPONSE_GUARD_INT_1_32;
@@ -1236,7 +1302,7 @@ signed   int  Silabs_giCode                         (SILABS_FE_Context* front_en
 signed   int  Silabs_coderateCode                   (SILABS_FE_Context* front_end,    signed   int                  coderate)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (coderate) {
 #ifdef    DEMOD_DVB_T
       case SILABS_CODERATE_1_2 : return Si2183_DVBT_STATUS_RESPONSE_RATE_HP_1_2;
@@ -1281,7 +1347,7 @@ signed   int  Silabs_coderateCode                   (SILABS_FE_Context* front_en
 signed   int  Silabs_hierarchyCode                  (SILABS_FE_Context* front_end,    CUSTOM_Hierarchy_Enum         hierarchy)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (hierarchy) {
 #ifdef    DEMOD_DVB_T
       case SILABS_HIERARCHY_NONE : return Si2183_DVBT_STATUS_RESPONSE_HIERARCHY_NONE;
@@ -1308,7 +1374,7 @@ signed   int  Silabs_pilotPatternCode               (SILABS_FE_Context* front_en
   pilot_pattern   = pilot_pattern  ; /* To avoid compiler warning */
 #ifdef    Si2183_COMPATIBLE
 #ifdef    DEMOD_DVB_T2
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (pilot_pattern) {
       case SILABS_PILOT_PATTERN_PP1 : return Si2183_DVBT2_STATUS_RESPONSE_PILOT_PATTERN_PP1;
       case SILABS_PILOT_PATTERN_PP2 : return Si2183_DVBT2_STATUS_RESPONSE_PILOT_PATTERN_PP2;
@@ -1338,7 +1404,7 @@ signed   int  Silabs_T2VersionCode                  (SILABS_FE_Context* front_en
   t2_version      = t2_version     ; /* To avoid compiler warning */
 #ifdef    Si2183_COMPATIBLE
 #ifdef    DEMOD_DVB_T2
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (t2_version) {
       case SILABS_T2_VERSION_1_1_1 : return Si2183_DVBT2_STATUS_RESPONSE_T2_VERSION_1_1_1;
       case SILABS_T2_VERSION_1_2_1 : return Si2183_DVBT2_STATUS_RESPONSE_T2_VERSION_1_2_1;
@@ -1512,7 +1578,7 @@ signed   int  Silabs_transmissionCode               (SILABS_FE_Context* front_en
 signed   int  Custom_standardCode                   (SILABS_FE_Context* front_end,    signed   int standard)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (standard) {
 #ifdef    DEMOD_DVB_T
       case Si2183_DD_MODE_PROP_MODULATION_DVBT : return SILABS_DVB_T ;
@@ -1553,7 +1619,7 @@ signed   int  Custom_standardCode                   (SILABS_FE_Context* front_en
 signed   int  Custom_constelCode                    (SILABS_FE_Context* front_end,    signed   int constel)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (constel) {
       case  0: return SILABS_QAMAUTO ;
       case  7: return SILABS_QAM16   ;
@@ -1591,7 +1657,7 @@ signed   int  Custom_streamCode                     (SILABS_FE_Context* front_en
   stream    = stream;    /* To avoid compiler warning if not supported */
 #ifdef    DEMOD_DVB_T
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (stream) {
       case Si2183_DVBT_HIERARCHY_PROP_STREAM_HP: return SILABS_HP;
       case Si2183_DVBT_HIERARCHY_PROP_STREAM_LP: return SILABS_LP;
@@ -1615,7 +1681,7 @@ signed   int  Custom_plptypeCode                    (SILABS_FE_Context* front_en
   plp_type  = plp_type;    /* To avoid compiler warning if not supported */
 #ifdef    DEMOD_DVB_T2
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (plp_type) {
       case Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON    : return SILABS_PLP_TYPE_COMMON;
       case Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_DATA_TYPE1: return SILABS_PLP_TYPE_DATA_TYPE1;
@@ -1639,7 +1705,7 @@ signed   int  Custom_fftCode                        (SILABS_FE_Context* front_en
   front_end = front_end; /* To avoid compiler warning if not supported */
   fft       = fft;       /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (fft) {
 #ifdef    DEMOD_DVB_T
       case Si2183_DVBT_STATUS_RESPONSE_FFT_MODE_2K  : return SILABS_FFT_MODE_2K ;
@@ -1676,7 +1742,7 @@ signed   int  Custom_giCode                         (SILABS_FE_Context* front_en
   front_end = front_end; /* To avoid compiler warning if not supported */
   gi        = gi;        /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (gi) {
 #ifdef    DEMOD_DVB_T
       case Si2183_DVBT_STATUS_RESPONSE_GUARD_INT_1_32   : return SILABS_GUARD_INTERVAL_1_32  ;
@@ -1721,7 +1787,7 @@ signed   int  Custom_coderateCode                   (SILABS_FE_Context* front_en
   front_end = front_end; /* To avoid compiler warning if not supported */
   coderate  = coderate;  /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (coderate) {
       case 1  : return SILABS_CODERATE_1_2;
       case 2  : return SILABS_CODERATE_2_3;
@@ -1768,7 +1834,7 @@ signed   int  Custom_hierarchyCode                  (SILABS_FE_Context* front_en
   hierarchy = hierarchy; /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
 #ifdef    DEMOD_DVB_T
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (hierarchy) {
       case Si2183_DVBT_STATUS_RESPONSE_HIERARCHY_NONE : return SILABS_HIERARCHY_NONE;
       case Si2183_DVBT_STATUS_RESPONSE_HIERARCHY_ALFA1: return SILABS_HIERARCHY_ALFA1;
@@ -1794,7 +1860,7 @@ signed   int  Custom_pilotPatternCode               (SILABS_FE_Context* front_en
   pilot_pattern   = pilot_pattern  ; /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
 #ifdef    DEMOD_DVB_T2
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (pilot_pattern) {
       case Si2183_DVBT2_STATUS_RESPONSE_PILOT_PATTERN_PP1: return SILABS_PILOT_PATTERN_PP1;
       case Si2183_DVBT2_STATUS_RESPONSE_PILOT_PATTERN_PP2: return SILABS_PILOT_PATTERN_PP2;
@@ -1824,7 +1890,7 @@ signed   int  Custom_T2VersionCode                  (SILABS_FE_Context* front_en
   t2_version      = t2_version     ; /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
 #ifdef    DEMOD_DVB_T2
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (t2_version) {
       case Si2183_DVBT2_STATUS_RESPONSE_T2_VERSION_1_1_1: return SILABS_T2_VERSION_1_1_1;
       case Si2183_DVBT2_STATUS_RESPONSE_T2_VERSION_1_2_1: return SILABS_T2_VERSION_1_2_1;
@@ -2377,7 +2443,7 @@ signed   int  SiLabs_API_Demod_status_selection     (SILABS_FE_Context* front_en
   if (front_end->standard == SILABS_SLEEP ) {status->standard = SILABS_SLEEP; return 0;}
 
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     status->demod_die = front_end->Si2183_FE->demod->rsp->get_rev.mcm_die;
     /* Mimick Si2167 clock_mode register values */
     switch (front_end->Si2183_FE->demod->cmd->start_clk.clk_mode) {
@@ -2398,6 +2464,9 @@ signed   int  SiLabs_API_Demod_status_selection     (SILABS_FE_Context* front_en
       status->TS_clock_kHz    = front_end->Si2183_FE->demod->rsp->dd_status.ts_clk_freq*10;
       status->demod_lock      = front_end->Si2183_FE->demod->rsp->dd_status.pcl;
       status->fec_lock        = front_end->Si2183_FE->demod->rsp->dd_status.dl;
+#ifdef    ADAPTIVE_TS_CLOCK
+      SiLabs_TS_Clock_Update(SiLabs_TS_Clock_Of(front_end), status->fec_lock, status->TS_bitrate_kHz, status->TS_clock_kHz);
+#endif /* ADAPTIVE_TS_CLOCK */
       if (status->fec_lock) {
         if ( Si2183_L1_DD_UNCOR  (front_end->Si2183_FE->demod, Si2183_DD_UNCOR_CMD_RST_RUN) != NO_Si2183_ERROR ) return 0;
         status->uncorrs            = (front_end->Si2183_FE->demod->rsp->dd_uncor.uncor_msb<<8) + front_end->Si2183_FE->demod->rsp->dd_uncor.uncor_lsb;
@@ -3135,7 +3204,7 @@ signed   int  SiLabs_API_TER_Tuner_status           (SILABS_FE_Context* front_en
   tuner_ter = NULL;
   SiTRACE("API CALL STATUS: SiLabs_API_TER_Tuner_status (front_end, &status);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip == 0x2183   ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
+  if (SILABS_DEMOD_CHIP(front_end) == 0x2183   ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
 #endif /* Si2183_COMPATIBLE */
   if (tuner_ter == NULL) {
       SiTRACE("No tuner_ter defined, SiLabs_API_TER_Tuner_status can't be executed!\n");
@@ -3177,7 +3246,7 @@ signed   int  SiLabs_API_TER_Tuner_Loop_Through     (SILABS_FE_Context* front_en
   tuner_ter = NULL;
   SiTRACE("API CALL STATUS: SiLabs_API_TER_Tuner_Loop_Through (front_end, &status);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip == 0x2183   ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
+  if (SILABS_DEMOD_CHIP(front_end) == 0x2183   ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
 #endif /* Si2183_COMPATIBLE */
   if (tuner_ter == NULL) {
     SiTRACE("No tuner_ter defined, SiLabs_API_TER_Tuner_Loop_Through can't be executed!\n");
@@ -3233,7 +3302,7 @@ signed   int  SiLabs_API_SAT_Tuner_status           (SILABS_FE_Context* front_en
   sat_tuner = NULL;
   SiTRACE("API CALL STATUS: SiLabs_API_SAT_Tuner_status (front_end, &status);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { sat_tuner = front_end->Si2183_FE->tuner_sat; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { sat_tuner = front_end->Si2183_FE->tuner_sat; }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SAT_TUNER_SILABS */
   front_end = front_end; /* To avoid compiler warning */
@@ -3655,6 +3724,13 @@ signed   char SiLabs_API_SW_Init                    (SILABS_FE_Context *front_en
     chip = front_end->chip;
   }
   SiTRACE("chip '%d' ('%X')\n", chip, chip);
+#ifdef    SINGLE_CHIP_DEMOD
+  if (chip != SINGLE_CHIP_DEMOD) {
+    SiTRACE("chip '%X' not supported: this code only supports '%X' (SINGLE_CHIP_DEMOD)\n", chip, SINGLE_CHIP_DEMOD);
+    SiERROR("SiLabs_API_SW_Init: chip not matching SINGLE_CHIP_DEMOD !\n");
+    return 0;
+  }
+#endif /* SINGLE_CHIP_DEMOD */
   front_end->standard = -1;
   front_end->active_TS_mode = SILABS_TS_PARALLEL;
 #ifdef    USB_Capability
@@ -3682,6 +3758,12 @@ signed   char SiLabs_API_SW_Init                    (SILABS_FE_Context *front_en
       front_end->SAT_tuner_I2C_connection = i;
     }
   }
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) {
+    front_end->TER_tuner_I2C_connection = front_end->registry_handle;
+    front_end->SAT_tuner_I2C_connection = front_end->registry_handle;
+  }
+#endif /* FRONTEND_REGISTRY */
   SiTRACE("Default front_end->TER_tuner_I2C_connection: %d\n", front_end->TER_tuner_I2C_connection );
   SiTRACE("Default front_end->SAT_tuner_I2C_connection: %d\n", front_end->SAT_tuner_I2C_connection );
 #endif /* INDIRECT_I2C_CONNECTION */
@@ -3821,7 +3903,7 @@ signed   int  SiLabs_API_Set_Index_and_Tag          (SILABS_FE_Context* front_en
   SiTRACE("API CALL CONFIG: SiLabs_API_Set_Index_and_Tag (front_end, %d, %s);\n", index, tag);
   front_end->fe_index = index;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183  ) { L2_tag_len = Si2183_L2_Set_Index_and_Tag(front_end->Si2183_FE, index, tag); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183  ) { L2_tag_len = Si2183_L2_Set_Index_and_Tag(front_end->Si2183_FE, index, tag); }
 #endif /* Si2183_COMPATIBLE */
   snprintf(front_end->tag, SILABS_TAG_SIZE, "%s %*s", tag, (int)(strlen(tag) +1 - L2_tag_len), " ");
 
@@ -3895,6 +3977,44 @@ signed   int  SiLabs_API_SAT_tuner_I2C_connection   (SILABS_FE_Context *front_en
   front_end->SAT_tuner_I2C_connection = fe_index;
   return front_end->SAT_tuner_I2C_connection;
 }
+#ifdef    INDIRECT_I2C_CONNECTION
+/************************************************************************************************************************
+  SiLabs_API_Connected_Front_End function
+  Use:        Tuner I2C passthrough retrieval function
+              Used to find the front-end whose demodulator passthrough connects a tuner, from its TER or SAT I2C connection value
+  Behavior:   The connection value is either 100 (tuner directly connected), a FrontEnd_Table index or
+               (when FRONTEND_REGISTRY is defined) the handle of a front-end of the same registry.
+              Registered front-ends are retrieved from their handle, other front-ends are searched in FrontEnd_Table.
+  Parameter:  front_end, a pointer to the SILABS_FE_Context of the tuner
+  Parameter:  connection, the TER_tuner_I2C_connection or SAT_tuner_I2C_connection value
+  Parameter:  requester, a pointer to store the FrontEnd_Table index or registry handle of front_end (for traces)
+  Return:     a pointer to the connecting front-end (front_end itself for direct connections), NULL if no match
+************************************************************************************************************************/
+SILABS_FE_Context *SiLabs_API_Connected_Front_End   (SILABS_FE_Context *front_end,    signed   int connection, signed   int *requester)
+{
+  signed   int fe;
+  *requester = -1;
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { *requester = front_end->registry_handle; }
+#endif /* FRONTEND_REGISTRY */
+  if (*requester < 0) {
+    for (fe=0; fe< FRONT_END_COUNT; fe++) {
+      if ( front_end  == &(FrontEnd_Table[fe]) ) { *requester = fe; break; }
+    }
+  }
+  if (*requester < 0) { return NULL; }
+  /* 100 is a special value to allow having tuners connected directly. */
+  if (connection == 100) { return front_end; }
+#ifdef    FRONTEND_REGISTRY
+  if (connection >= FE_REGISTRY_HANDLE_BASE) {
+    if (front_end->registry == NULL) { return NULL; }
+    return SiLabs_FE_Registry_Get(front_end->registry, connection);
+  }
+#endif /* FRONTEND_REGISTRY */
+  if ( (connection >= 0) && (connection < FRONT_END_COUNT) ) { return &(FrontEnd_Table[connection]); }
+  return NULL;
+}
+#endif /* INDIRECT_I2C_CONNECTION */
 /************************************************************************************************************************
   SiLabs_API_Handshake_Setup function
   Use:        handshake setup function
@@ -3911,7 +4031,7 @@ signed   int  SiLabs_API_Handshake_Setup            (SILABS_FE_Context *front_en
   handshake_mode      = handshake_mode;      /* To avoid compiler warning if not used */
   handshake_period_ms = handshake_period_ms; /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183  ) { front_end->Si2183_FE->handshakeUsed  = handshake_mode; front_end->Si2183_FE->handshakePeriod_ms  = handshake_period_ms; return handshake_mode*handshake_period_ms; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183  ) { front_end->Si2183_FE->handshakeUsed  = handshake_mode; front_end->Si2183_FE->handshakePeriod_ms  = handshake_period_ms; return handshake_mode*handshake_period_ms; }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("SiLabs_API_Handshake_Setup not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
   return 0;
@@ -3938,7 +4058,7 @@ signed   int  SiLabs_API_SPI_Setup                  (SILABS_FE_Context *front_en
   front_end->SPI_Setup_data_pin    = data_pin;
   front_end->SPI_Setup_data_order  = data_order;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->demod->spi_send_option = send_option;
     if (send_option != 0x00) {
       front_end->Si2183_FE->demod->spi_download    = 1;
@@ -3959,28 +4079,35 @@ signed   int  SiLabs_API_SPI_Setup                  (SILABS_FE_Context *front_en
   Parameter:  front_end, a pointer to the SILABS_FE_Context context
   Parameter:  phase, a flag indicating the broadcast state
   Parameter:  front_end_count, the number of demodulators to init
+              If front_end_count is above FRONT_END_COUNT, the FW is broadcast to groups of FRONT_END_COUNT demodulators.
 ************************************************************************************************************************/
 signed   int  SiLabs_API_Demods_Broadcast_I2C       (SILABS_FE_Context *front_ends[], signed   int front_end_count)
 {
   signed   int i;
 #ifdef    Si2183_COMPATIBLE
+  signed   int first;
+  signed   int count;
   L1_Si2183_Context *Si2183_demods[FRONT_END_COUNT];
 #endif /* Si2183_COMPATIBLE */
   SiTRACE_X("API CALL INIT  : SiLabs_API_Demods_Broadcast_I2C         (front_ends, %d);\n", front_end_count);
   i = 0;
 #ifdef    Si2183_COMPATIBLE
   if (front_ends[0]->chip == 0x2183  ) {
-    /* Store all demodulator pointers in a table */
-    for ( i=0; i< front_end_count; i++ )  { Si2183_demods[i] = front_ends[i]->Si2183_FE->demod; }
-    /* Download FW in all demodulators using 'broadcast i2c' mode */
-    if (Si2183_PowerUpUsingBroadcastI2C( Si2183_demods, front_end_count) == 0) {
-    /* Set all demodulator flags to avoid FW download when calling 'switch_to_standard' */
-      for ( i=0; i< front_end_count; i++ )  {
-        front_ends[i]->Si2183_FE->first_init_done     = 1;
-        front_ends[i]->Si2183_FE->Si2183_init_done    = 1;
+    for ( first=0; first< front_end_count; first = first + count ) {
+      count = front_end_count - first;
+      if (count > FRONT_END_COUNT) { count = FRONT_END_COUNT; }
+      /* Store the demodulator pointers of this group in a table */
+      for ( i=0; i< count; i++ )  { Si2183_demods[i] = front_ends[first + i]->Si2183_FE->demod; }
+      /* Download FW in all demodulators of this group using 'broadcast i2c' mode */
+      if (Si2183_PowerUpUsingBroadcastI2C( Si2183_demods, count) != 0) { break; }
+      /* Set all demodulator flags to avoid FW download when calling 'switch_to_standard' */
+      for ( i=0; i< count; i++ )  {
+        front_ends[first + i]->Si2183_FE->first_init_done     = 1;
+        front_ends[first + i]->Si2183_FE->Si2183_init_done    = 1;
       }
-      Silabs_multiple_front_end_init_done = i;
     }
+    i = first;
+    if (i > 0) { Silabs_multiple_front_end_init_done = i; }
   }
 #endif /* Si2183_COMPATIBLE */
   front_ends         = front_ends;         /* To avoid compiler warning if not used */
@@ -4021,7 +4148,7 @@ signed   int  SiLabs_API_XTAL_Capacitance           (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL CONFIG: SiLabs_API_XTAL_Capacitance        (front_end, %d);\n", xtal_capacitance);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183  ) { front_end->Si2183_FE->demod->cmd->start_clk.tune_cap = xtal_capacitance; return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183  ) { front_end->Si2183_FE->demod->cmd->start_clk.tune_cap = xtal_capacitance; return 1; }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("SiLabs_API_XTAL_Capacitance not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
   return 0;
@@ -4038,7 +4165,7 @@ signed   int  SiLabs_API_TER_Possible_Tuners        (SILABS_FE_Context *front_en
 {
 #ifdef   SILABS_TER_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_Possible_Tuners(front_end->Si2183_FE->tuner_ter, tunerList); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_Possible_Tuners(front_end->Si2183_FE->tuner_ter, tunerList); }
 #endif /* Si2183_COMPATIBLE */
 #else  /* SILABS_TER_TUNER_API */
   front_end = front_end; /* To avoid compiler warning if not used */
@@ -4063,7 +4190,7 @@ signed   int  SiLabs_API_Select_TER_Tuner           (SILABS_FE_Context *front_en
   front_end->Select_TER_Tuner_ter_tuner_index = ter_tuner_index;
 #ifdef   SILABS_TER_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_Select_Tuner (front_end->Si2183_FE->tuner_ter,  ter_tuner_code, ter_tuner_index); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_Select_Tuner (front_end->Si2183_FE->tuner_ter,  ter_tuner_code, ter_tuner_index); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SILABS_TER_TUNER_API */
   return 0;
@@ -4080,7 +4207,7 @@ void*         SiLabs_API_TER_Tuner                  (SILABS_FE_Context *front_en
   SiTRACE("API CALL TER   : SiLabs_API_TER_Tuner         (front_end);\n");
 #ifdef   SILABS_TER_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return front_end->Si2183_FE->tuner_ter; }
+  if (front_end->chip ==   0x2183 ) { return front_end->Si2183_FE->tuner_ter; } /* run-time test: 0 until SiLabs_API_SW_Init */
 #endif /* Si2183_COMPATIBLE */
 #else  /* SILABS_TER_TUNER_API */
   front_end = front_end;             /* To avoid compiler warning if not used */
@@ -4100,7 +4227,7 @@ signed   int  SiLabs_API_TER_Address                (SILABS_FE_Context *front_en
   front_end->TER_Address_add  = add;
 #ifdef   SILABS_TER_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_Set_Address(front_end->Si2183_FE->tuner_ter,  add); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_Set_Address(front_end->Si2183_FE->tuner_ter,  add); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SILABS_TER_TUNER_API */
   return 0;
@@ -4163,7 +4290,7 @@ signed   int  SiLabs_API_TER_Tuner_ClockConfig      (SILABS_FE_Context *front_en
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    TER_TUNER_SILABS
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { tuner_ter = front_end->Si2183_FE->tuner_ter; }
 #endif /* Si2183_COMPATIBLE */
   if (tuner_ter == NULL) {
     SiTRACE("No tuner_ter defined, SiLabs_API_TER_Tuner_ClockConfig can't be executed!\n");
@@ -4188,7 +4315,7 @@ signed   int  SiLabs_API_TER_Clock_Options          (SILABS_FE_Context *front_en
   clockOptions  = clockOptions; /* To avoid compiler warning if not used */
   snprintf(clockOptions, 1000, "%s", "");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     snprintf(clockOptions, 1000, "%s", "Si2183 clock options:\n");
     STRING_APPEND_SAFE(clockOptions,1000, "clock_source  (Xtal_clock:%d, TER_Tuner_clock:%d, SAT_Tuner_clock:%d)\n", Si2183_Xtal_clock, Si2183_TER_Tuner_clock, Si2183_SAT_Tuner_clock);
     STRING_APPEND_SAFE(clockOptions,1000, "clock_input   (CLK_CLKIO:%d, CLK_XTAL_IN:%d,  XTAL(driven by the Si2183):%d)\n", 44, 33, 32);
@@ -4220,7 +4347,7 @@ signed   int  SiLabs_API_TER_Clock                  (SILABS_FE_Context *front_en
   front_end->TER_Clock_clock_control = clock_control;
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183  ) { return Si2183_L2_TER_Clock  (front_end->Si2183_FE , clock_source, clock_input, clock_freq, clock_control); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183  ) { return Si2183_L2_TER_Clock  (front_end->Si2183_FE , clock_source, clock_input, clock_freq, clock_control); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_Clock not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4240,7 +4367,7 @@ signed   int  SiLabs_API_TER_FEF_Options            (SILABS_FE_Context *front_en
   fefOptions     = fefOptions;       /* To avoid compiler warning if not used */
   snprintf(fefOptions,1000, "%s", "");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     snprintf(fefOptions,1000, "%s", "(Si2183 FEF options)\n");
     STRING_APPEND_SAFE(fefOptions,1000, " fef mode      (SLOW_NORMAL_AGC:0, FREEZE_PIN:1, SLOW_INITIAL_AGC:2)\n");
     STRING_APPEND_SAFE(fefOptions,1000, " fef pin       (Unused:0x0, MP_A:0xa, MP_B:0xb, MP_C:0xc, MP_D:0xd)\n" );
@@ -4269,7 +4396,7 @@ signed   int  SiLabs_API_TER_FEF_Config             (SILABS_FE_Context *front_en
   front_end->TER_FEF_Config_fef_level      = fef_level;
 #ifdef    DEMOD_DVB_T2
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_TER_FEF_CONFIG (front_end->Si2183_FE, fef_mode, fef_pin, fef_level); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_TER_FEF_CONFIG (front_end->Si2183_FE, fef_mode, fef_pin, fef_level); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* DEMOD_DVB_T2 */
   SiTRACE("SiLabs_API_TER_FEF not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4289,7 +4416,7 @@ signed   int  SiLabs_API_TER_AGC_Options            (SILABS_FE_Context *front_en
   agcOptions     = agcOptions;       /* To avoid compiler warning if not used */
   snprintf(agcOptions,1000, "%s", "");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     snprintf(agcOptions,1000, "%s", "(Si2183 AGC options)\n");
     STRING_APPEND_SAFE(agcOptions,1000, " agc mode      (Unused:0x0, MP_A:0xa, MP_B:0xb, MP_C:0xc, MP_D:0xd)\n");
     STRING_APPEND_SAFE(agcOptions,1000, " agc inversion (0: not_inverted, 1: inverted)\n");
@@ -4319,7 +4446,7 @@ signed   int  SiLabs_API_TER_AGC                    (SILABS_FE_Context *front_en
   front_end->TER_AGC_agc2_inversion = agc2_inversion;
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_TER_AGC (front_end->Si2183_FE, agc1_mode, agc1_inversion, agc2_mode, agc2_inversion); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_TER_AGC (front_end->Si2183_FE, agc1_mode, agc1_inversion, agc2_mode, agc2_inversion); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_AGC not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4339,7 +4466,7 @@ signed   int  SiLabs_API_TER_Tuner_AGC_Input        (SILABS_FE_Context *front_en
   front_end->TER_Tuner_AGC_Input_dtv_agc_source = dtv_agc_source;
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { front_end->Si2183_FE->demod->TER_tuner_agc_input = dtv_agc_source; return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->Si2183_FE->demod->TER_tuner_agc_input = dtv_agc_source; return 1;}
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_Tuner_AGC_Input not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4359,7 +4486,7 @@ signed   int  SiLabs_API_TER_Tuner_GPIOs            (SILABS_FE_Context *front_en
   SiTRACE("API CALL CONFIG: SiLabs_API_TER_Tuner_GPIOs (front_end, %d, %d);\n", gpio1_mode, gpio2_mode);
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { SiLabs_TER_Tuner_GPIOS ( front_end->Si2183_FE->tuner_ter, gpio1_mode, gpio2_mode); return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { SiLabs_TER_Tuner_GPIOS ( front_end->Si2183_FE->tuner_ter, gpio1_mode, gpio2_mode); return 1;}
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_Tuner_GPIOs not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4379,7 +4506,7 @@ signed   int  SiLabs_API_TER_Tuner_FEF_Input        (SILABS_FE_Context *front_en
   front_end->TER_Tuner_FEF_Input_dtv_fef_freeze_input = dtv_fef_freeze_input;
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_DTV_FEF_SOURCE(front_end->Si2183_FE->tuner_ter, dtv_fef_freeze_input); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_DTV_FEF_SOURCE(front_end->Si2183_FE->tuner_ter, dtv_fef_freeze_input); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_Tuner_FEF_Input not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4399,7 +4526,7 @@ signed   int  SiLabs_API_TER_Tuner_IF_Output        (SILABS_FE_Context *front_en
   front_end->TER_Tuner_IF_Output_dtv_out_type = dtv_out_type;
 #ifdef    TERRESTRIAL_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { front_end->Si2183_FE->demod->TER_tuner_if_output = dtv_out_type; return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->Si2183_FE->demod->TER_tuner_if_output = dtv_out_type; return 1;}
 #endif /* Si2183_COMPATIBLE */
 #endif /* TERRESTRIAL_FRONT_END */
   SiTRACE("SiLabs_API_TER_Tuner_IF_Output not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4417,7 +4544,7 @@ signed   int  SiLabs_API_SAT_Possible_Tuners        (SILABS_FE_Context *front_en
 {
 #ifdef   SILABS_SAT_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_SAT_Tuner_Possible_Tuners(front_end->Si2183_FE->tuner_sat, tunerList); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_SAT_Tuner_Possible_Tuners(front_end->Si2183_FE->tuner_sat, tunerList); }
 #endif /* Si2183_COMPATIBLE */
 #else  /* SILABS_SAT_TUNER_API */
   front_end = front_end; /* To avoid compiler warning if not used */
@@ -4442,7 +4569,7 @@ signed   int  SiLabs_API_Select_SAT_Tuner           (SILABS_FE_Context *front_en
   front_end->Select_SAT_Tuner_sat_tuner_index = sat_tuner_index;
 #ifdef   SILABS_SAT_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_SAT_Tuner_Select_Tuner (front_end->Si2183_FE->tuner_sat,  sat_tuner_code, sat_tuner_index); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_SAT_Tuner_Select_Tuner (front_end->Si2183_FE->tuner_sat,  sat_tuner_code, sat_tuner_index); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SILABS_SAT_TUNER_API */
   return 0;
@@ -4461,7 +4588,7 @@ signed   int  SiLabs_API_SAT_Tuner_Sub              (SILABS_FE_Context *front_en
   front_end->Select_SAT_Tuner_sat_tuner_sub   = sat_tuner_sub;
 #ifdef   SILABS_SAT_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_SAT_Tuner_Sub (front_end->Si2183_FE->tuner_sat,  sat_tuner_sub); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_SAT_Tuner_Sub (front_end->Si2183_FE->tuner_sat,  sat_tuner_sub); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SILABS_SAT_TUNER_API */
   return 0;
@@ -4479,7 +4606,7 @@ signed   int  SiLabs_API_SAT_Address                (SILABS_FE_Context *front_en
   front_end->SAT_Address_add = add;
 #ifdef   SILABS_SAT_TUNER_API
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_SAT_Tuner_Set_Address(front_end->Si2183_FE->tuner_sat,  add); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_SAT_Tuner_Set_Address(front_end->Si2183_FE->tuner_sat,  add); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SILABS_SAT_TUNER_API */
   return 0;
@@ -4499,7 +4626,7 @@ signed   int  SiLabs_API_SAT_Clock_Options          (SILABS_FE_Context *front_en
   clockOptions  = clockOptions; /* To avoid compiler warning if not used */
   snprintf(clockOptions, 1000, "%s", "");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     snprintf(clockOptions, 1000, "%s", "Si2183 clock options:\n");
     STRING_APPEND_SAFE(clockOptions,1000, "clock_source  (Xtal_clock:%d,  TER_Tuner_clock:%d,  SAT_Tuner_clock:%d)\n", Si2183_Xtal_clock, Si2183_TER_Tuner_clock, Si2183_SAT_Tuner_clock);
     STRING_APPEND_SAFE(clockOptions,1000, "clock_input   (CLK_CLKIO:%d,  CLK_XTAL_IN:%d,  XTAL(driven by the Si283):%d)\n", 44, 33, 32);
@@ -4531,7 +4658,7 @@ signed   int  SiLabs_API_SAT_Clock                  (SILABS_FE_Context *front_en
   front_end->SAT_Clock_clock_control = clock_control;
 #ifdef    SATELLITE_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183  ) { return Si2183_L2_SAT_Clock  (front_end->Si2183_FE,  clock_source, clock_input, clock_freq, clock_control); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183  ) { return Si2183_L2_SAT_Clock  (front_end->Si2183_FE,  clock_source, clock_input, clock_freq, clock_control); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SATELLITE_FRONT_END */
   SiTRACE("SiLabs_API_SAT_Clock not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4551,7 +4678,7 @@ signed   int  SiLabs_API_SAT_AGC_Options            (SILABS_FE_Context *front_en
   agcOptions     = agcOptions;       /* To avoid compiler warning if not used */
   snprintf(agcOptions,1000, "%s", "");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     snprintf(agcOptions,1000, "%s", "(Si2183 AGC options)\n");
     STRING_APPEND_SAFE(agcOptions,1000, " agc mode      (Unused:0x0, MP_A:0xa, MP_B:0xb, MP_C:0xc, MP_D:0xd)\n");
     STRING_APPEND_SAFE(agcOptions,1000, " agc inversion (0: not_inverted, 1: inverted)\n");
@@ -4581,7 +4708,7 @@ signed   int  SiLabs_API_SAT_AGC                    (SILABS_FE_Context *front_en
   front_end->SAT_AGC_agc2_inversion = agc2_inversion;
 #ifdef    SATELLITE_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_SAT_AGC (front_end->Si2183_FE, agc1_mode, agc1_inversion, agc2_mode, agc2_inversion); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_SAT_AGC (front_end->Si2183_FE, agc1_mode, agc1_inversion, agc2_mode, agc2_inversion); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SATELLITE_FRONT_END */
   SiTRACE("SiLabs_API_SAT_AGC not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4606,7 +4733,7 @@ signed   int  SiLabs_API_SAT_Spectrum               (SILABS_FE_Context *front_en
   front_end->SAT_Spectrum_spectrum_inversion = spectrum_inversion;
 #ifdef    SATELLITE_FRONT_END
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_SAT_Spectrum(front_end->Si2183_FE, spectrum_inversion); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_SAT_Spectrum(front_end->Si2183_FE, spectrum_inversion); }
 #endif /* Si2183_COMPATIBLE */
 #endif /* SATELLITE_FRONT_END */
   SiTRACE("SiLabs_API_SAT_Spectrum not supporting the current chip '%d'/'0x%x'\n", front_end->chip, front_end->chip);
@@ -4751,7 +4878,7 @@ signed   int  SiLabs_API_Infos                      (SILABS_FE_Context *front_en
     snprintf(infoString,1000, "Call SiLabs_API_SW_Init first!\n");
   } else {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     Si2183_L2_Infos  (front_end->Si2183_FE, infoString);
   }
 #endif /* Si2183_COMPATIBLE */
@@ -4929,7 +5056,7 @@ signed   char  SiLabs_API_HW_Connect                (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL CONFIG: SiLabs_API_HW_Connect           (front_end, %d);\n", connection_mode);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_HW_Connect (front_end->Si2183_FE, connection_mode); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_HW_Connect (front_end->Si2183_FE, connection_mode); }
 #endif /* Si2183_COMPATIBLE */
   L0_Connect(WrapperI2C,    connection_mode);
 #ifdef    SATELLITE_FRONT_END
@@ -5021,7 +5148,7 @@ signed   char SiLabs_API_bytes_trace                (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL TRACE: SiLabs_API_bytes_trace (front_end, %d);\n", track_mode);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->demod->i2c->trackWrite     = track_mode;
     front_end->Si2183_FE->demod->i2c->trackRead      = track_mode;
 #ifdef    TERRESTRIAL_FRONT_END
@@ -5090,7 +5217,7 @@ signed   char SiLabs_API_bytes_trace                (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_communication_check        (SILABS_FE_Context *front_end)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_communication_check (front_end->Si2183_FE); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_communication_check (front_end->Si2183_FE); }
 #endif /* Si2183_COMPATIBLE */
   return 0;
 }
@@ -5117,13 +5244,16 @@ signed   int  SiLabs_API_switch_to_standard         (SILABS_FE_Context *front_en
     }
   }
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { front_end->init_ok = Si2183_L2_switch_to_standard (front_end->Si2183_FE , Silabs_standardCode(front_end, standard), force_full_init);}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->init_ok = Si2183_L2_switch_to_standard (front_end->Si2183_FE , Silabs_standardCode(front_end, standard), force_full_init);}
 #endif /* Si2183_COMPATIBLE */
   if (front_end->init_ok == 0) {
     SiTRACE("Problem switching to %s\n", Silabs_Standard_Text(standard));
   } else {
     front_end->standard = standard;
   }
+#ifdef    POWER_MANAGER
+  SiLabs_Power_Manager_Notify(front_end, standard, front_end->init_ok);
+#endif /* POWER_MANAGER */
   return front_end->init_ok;
 }
 /************************************************************************************************************************
@@ -5138,7 +5268,7 @@ signed   int  SiLabs_API_set_standard               (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL LOCK  : SiLabs_API_set_standard standard %d);\n", standard);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { if (Si2183_L2_switch_to_standard (front_end->Si2183_FE,        Silabs_standardCode(front_end, (CUSTOM_Standard_Enum)standard), 0)) { front_end->standard = standard; return 1;} }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { if (Si2183_L2_switch_to_standard (front_end->Si2183_FE,        Silabs_standardCode(front_end, (CUSTOM_Standard_Enum)standard), 0)) { front_end->standard = standard; return 1;} }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Problem switching to %s\n", Silabs_Standard_Text(standard));
   return 0;
@@ -5162,6 +5292,7 @@ signed   int  SiLabs_API_lock_to_carrier            (SILABS_FE_Context *front_en
 {
   signed   int standard_code;
   signed   int return_value;
+  signed   int new_lock;
 #ifdef    DEMOD_DVB_C
   signed   int constel_code;
 #endif /* DEMOD_DVB_C */
@@ -5174,9 +5305,26 @@ signed   int  SiLabs_API_lock_to_carrier            (SILABS_FE_Context *front_en
 #endif /* SATELLITE_FRONT_END */
   data_slice_id = data_slice_id; /* to avoid compiler warning if not used */
   plp_id        = plp_id;        /* to avoid compiler warning if not used */
+  /* With the lock handshake, the calls following the first one only resume the ongoing lock: the per-lock work is only done for a new lock */
+  new_lock = 1;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { if (front_end->Si2183_FE->handshakeOn) { new_lock = 0; } }
+#endif /* Si2183_COMPATIBLE */
+  new_lock      = new_lock;      /* to avoid compiler warning if not used */
 
   SiTRACE("API CALL LOCK  : SiLabs_API_lock_to_carrier (front_end, %8d, %d, %d, %2d, %9d, %8d, %10d, %4d, %4d, %4d, %4d);\n", standard, freq, bandwidth_Hz, stream, symbol_rate_bps, constellation, polarization, band, data_slice_id, plp_id, T2_lock_mode);
   SiTRACE("SiLabs_API_lock_to_carrier config_code 0x%06x\n", front_end->config_code);
+  if (new_lock) {
+#ifdef    PLP_DIRECTORY
+    SiLabs_PLP_Directory_Invalidate(SiLabs_PLP_Directory_Of(front_end));
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+    SiLabs_Stream_Directory_Invalidate(SiLabs_Stream_Directory_Of(front_end));
+#endif /* STREAM_DIRECTORY */
+#ifdef    EXTENDED_STATUS
+    SiLabs_Extended_Status_Invalidate(SiLabs_Extended_Status_Of(front_end));
+#endif /* EXTENDED_STATUS */
+  }
 
   standard_code = Silabs_standardCode(front_end, standard);
 #ifdef    DEMOD_DVB_C
@@ -5238,8 +5386,17 @@ signed   int  SiLabs_API_lock_to_carrier            (SILABS_FE_Context *front_en
   }
 #endif /* SATELLITE_FRONT_END */
 
+  if (new_lock) {
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    SiLabs_Lock_Timeout_Apply(SiLabs_Lock_Timeout_Of(front_end), standard, constellation, symbol_rate_bps);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    ADAPTIVE_TS_CLOCK
+    /* The new multiplex may need a higher TS clock: back to the application TS settings until the next status */
+    SiLabs_TS_Clock_Restore(SiLabs_TS_Clock_Of(front_end));
+#endif /* ADAPTIVE_TS_CLOCK */
+  }
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     return_value = Si2183_L2_lock_to_carrier  (front_end->Si2183_FE, standard_code, freq
                                   , bandwidth_Hz
 #ifdef    DEMOD_DVB_T
@@ -5257,6 +5414,9 @@ signed   int  SiLabs_API_lock_to_carrier            (SILABS_FE_Context *front_en
                                   , T2_lock_mode
 #endif /* DEMOD_DVB_T2 */
                                     );
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    SiLabs_Lock_Timeout_Record(SiLabs_Lock_Timeout_Of(front_end), return_value);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
     if (return_value == 1) { SiLabs_API_Reset_Uncorrs(front_end); }
     return return_value;
   }
@@ -5275,8 +5435,14 @@ signed   int  SiLabs_API_lock_to_carrier            (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_Tune                       (SILABS_FE_Context *front_end,    signed   int freq)
 {
   SiTRACE("API CALL LOCK  : SiLabs_API_Tune (front_end, %10d);\n", freq);
+#ifdef    PLP_DIRECTORY
+  SiLabs_PLP_Directory_Invalidate(SiLabs_PLP_Directory_Of(front_end));
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  SiLabs_Stream_Directory_Invalidate(SiLabs_Stream_Directory_Of(front_end));
+#endif /* STREAM_DIRECTORY */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     return   Si2183_L2_Tune  (front_end->Si2183_FE, freq );
   }
 #endif /* Si2183_COMPATIBLE */
@@ -5296,7 +5462,7 @@ signed   int  SiLabs_API_Demod_Standby              (SILABS_FE_Context *front_en
   SiTRACE("API CALL LOCK  : SiLabs_API_Demod_Standby (front_end);\n");
   front_end = front_end; /* To avoid compiler warning */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_STANDBY       (front_end->Si2183_FE->demod); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_STANDBY       (front_end->Si2183_FE->demod); Si2183_L2_Switch_Invalidate(front_end->Si2183_FE); return 1; }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Problem switching %d in standby mode\n", front_end->chip);
   return 0;
@@ -5313,7 +5479,7 @@ signed   int  SiLabs_API_Demod_Silent               (SILABS_FE_Context *front_en
   SiTRACE("API CALL LOCK  : SiLabs_API_Demod_Silent (front_end, %d);\n", silent);
   front_end = front_end; /* To avoid compiler warning */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_SILENT (front_end->Si2183_FE, silent); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_SILENT (front_end->Si2183_FE, silent); return 1; }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Problem switching %d in Silent mode\n", front_end->chip);
   return 0;
@@ -5330,7 +5496,7 @@ signed   int  SiLabs_API_Demod_ClockOn              (SILABS_FE_Context *front_en
   SiTRACE("API CALL LOCK  : SiLabs_API_Demod_ClockOn (front_end);\n");
   front_end = front_end; /* To avoid compiler warning */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return 1; }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Problem switching %d Clock On\n", front_end->chip);
   return 0;
@@ -5346,7 +5512,7 @@ signed   int  SiLabs_API_Reset_Uncorrs              (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL LOCK  : SiLabs_API_Reset_Uncorrs (front_end);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L1_DD_UNCOR (front_end->Si2183_FE->demod, Si2183_DD_UNCOR_CMD_RST_CLEAR); return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L1_DD_UNCOR (front_end->Si2183_FE->demod, Si2183_DD_UNCOR_CMD_RST_CLEAR); return 1;}
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Problem resetting %d uncorrs\n", front_end->chip);
   return -1;
@@ -5365,7 +5531,7 @@ signed   int  SiLabs_API_TS_Strength_Shape          (SILABS_FE_Context *front_en
   SiTRACE("API CALL CONFIG: SiLabs_API_TS_Strength_Shape (front_end, %d, %d, %d, %d);\n", serial_strength, serial_shape, parallel_strength, parallel_shape);
   SiTRACE("SiLabs_API_TS_Strength_Shape serial_strength %d, serial_shape %d, parallel_strength %d, parallel_shape %d\n", serial_strength, serial_shape, parallel_strength, parallel_shape);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (serial_strength   <= 15)  { front_end->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_data_strength     = serial_strength;
                                     front_end->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_clk_strength      = serial_strength;
 #ifdef    Si2183_DD_SEC_TS_SETUP_SER_PROP
@@ -5429,7 +5595,7 @@ signed   int  SiLabs_API_TS_Config                  (SILABS_FE_Context *front_en
   SiTRACE("API CALL CONFIG: SiLabs_API_TS_Config (front_end, %d, %d, %d, %d, %d, %d);\n", clock_config, gapped, serial_clk_inv, parallel_clk_inv, ts_err_inv, serial_pin);
   SiTRACE("SiLabs_API_TS_Config clock_config %d, gapped %d, serial_clk_inv %d, parallel_clk_inv %d, ts_err_inv %d, serial_pin %d\n", clock_config, gapped, serial_clk_inv, parallel_clk_inv, ts_err_inv, serial_pin);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
          if (clock_config == 0)     { front_end->Si2183_FE->demod->prop->dd_ts_mode.clock                = Si2183_DD_TS_MODE_PROP_CLOCK_AUTO_ADAPT; }
     else if (clock_config == 1)     { front_end->Si2183_FE->demod->prop->dd_ts_mode.clock                = Si2183_DD_TS_MODE_PROP_CLOCK_AUTO_FIXED; }
     else                            { front_end->Si2183_FE->demod->prop->dd_ts_mode.clock                = Si2183_DD_TS_MODE_PROP_CLOCK_MANUAL;
@@ -5510,7 +5676,7 @@ signed   int  SiLabs_API_TS_Mode                    (SILABS_FE_Context *front_en
     }
 #endif /* USB_Capability */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     switch (ts_mode) {
       case SILABS_TS_SERIAL  : { front_end->Si2183_FE->demod->prop->dd_ts_mode.mode = Si2183_DD_TS_MODE_PROP_MODE_SERIAL  ; break; }
       case SILABS_TS_PARALLEL: { front_end->Si2183_FE->demod->prop->dd_ts_mode.mode = Si2183_DD_TS_MODE_PROP_MODE_PARALLEL;
@@ -5615,7 +5781,7 @@ signed   int  SiLabs_API_Get_TS_Dividers            (SILABS_FE_Context *front_en
   SiTRACE("API CALL INFO : SiLabs_API_Get_TS_Dividers (front_end, &div_a, &div_a);\n");
   *div_a = *div_b = 0;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (Si2183_L1_DEMOD_INFO (front_end->Si2183_FE->demod) == NO_Si2183_ERROR) {
       *div_a = front_end->Si2183_FE->demod->rsp->demod_info.div_a;
       *div_b = front_end->Si2183_FE->demod->rsp->demod_info.div_b;
@@ -5656,7 +5822,7 @@ signed   int  Silabs_API_TS_Tone_Cancel             (SILABS_FE_Context* front_en
     SiTRACE("Dividers for Tone canceller, DIV_A=%d, DIV_B=%d\n", DIV_A, DIV_B);
     SiLabs_API_Tuner_I2C_Enable (front_end);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return_code = SiLabs_TER_Tuner_Tone_Cancel(front_end->Si2183_FE->tuner_ter, DIV_A, DIV_B); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return_code = SiLabs_TER_Tuner_Tone_Cancel(front_end->Si2183_FE->tuner_ter, DIV_A, DIV_B); }
 #endif /* Si2183_COMPATIBLE */
     if (return_code != 0) {
       SiERROR("SiLabs_TER_Tuner_Tone_Cancel failed !\n");
@@ -5677,7 +5843,7 @@ signed   int  SiLabs_API_Tuner_I2C_Enable           (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL LOCK  : SiLabs_API_Tuner_I2C_Enable (front_end);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_Tuner_I2C_Enable (front_end->Si2183_FE); return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_Tuner_I2C_Enable (front_end->Si2183_FE); return 1;}
 #endif /* Si2183_COMPATIBLE */
   return -1;
 }
@@ -5691,7 +5857,7 @@ signed   int  SiLabs_API_Tuner_I2C_Disable          (SILABS_FE_Context *front_en
 {
   SiTRACE("API CALL LOCK  : SiLabs_API_Tuner_I2C_Disable (front_end);\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_Tuner_I2C_Disable (front_end->Si2183_FE); return 0;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_Tuner_I2C_Disable (front_end->Si2183_FE); return 0;}
 #endif /* Si2183_COMPATIBLE */
   return -1;
 }
@@ -5737,16 +5903,24 @@ signed   int  SiLabs_API_Channel_Seek_Init          (SILABS_FE_Context *front_en
                                             signed   int minRSSIdBm,   signed   int maxRSSIdBm,
                                             signed   int minSNRHalfdB, signed   int maxSNRHalfdB)
 {
+  signed   int return_code;
+  return_code = 1;
   SiTRACE("API CALL SEEK  : SiLabs_API_Channel_Seek_Init (front_end, rangeMin %d, rangeMax %d, seekBWHz %d, seekStepHz %d, minSRbps %d, maxSRbps %d, minRSSIdBm %d, maxRSSIdBm %d, minSNRHalfdB %d, maxSNRHalfdB %d);\n", rangeMin, rangeMax, seekBWHz, seekStepHz, minSRbps, maxSRbps, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB);
 #ifdef    UNICABLE_COMPATIBLE
   front_end->unicable->inBlindScan = 1;
 #endif // UNICABLE_COMPATIBLE
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_Channel_Seek_Init (front_end->Si2183_FE,  rangeMin, rangeMax, seekBWHz, seekStepHz, minSRbps, maxSRbps, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    return_code = Si2183_L2_Channel_Seek_Init (front_end->Si2183_FE,  rangeMin, rangeMax, seekBWHz, seekStepHz, minSRbps, maxSRbps, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB);
+#ifdef    RSSI_PRESCREEN
+    if (return_code == 0) { SiLabs_RSSI_Prescreen_Sweep(SiLabs_RSSI_Prescreen_Of(front_end), rangeMin, rangeMax, seekStepHz); }
+#endif /* RSSI_PRESCREEN */
+    return return_code;
+  }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Unknown chip '%d'\n", front_end->chip);
   SiERROR("SiLabs_API_Channel_Seek_Init Unknown chip\n");
-  return 1;
+  return return_code;
 }
 /************************************************************************************************************************
   NAME: SiLabs_API_Channel_Seek_Next
@@ -5757,6 +5931,9 @@ signed   int  SiLabs_API_Channel_Seek_Init          (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_Channel_Seek_Next          (SILABS_FE_Context *front_end,    signed   int *standard, signed   int *freq, signed   int *bandwidth_Hz, signed   int *stream, unsigned int *symbol_rate_bps, signed   int *constellation, signed   int *polarization, signed   int *band, signed   int *num_data_slice, signed   int *num_plp, signed   int *T2_base_lite)
 {
   signed   int seek_result;
+#ifdef    RSSI_PRESCREEN
+  SILABS_RSSI_Prescreen *prescreen;
+#endif /* RSSI_PRESCREEN */
   num_data_slice = num_data_slice;/* to avoid compiler warning if not used */
   num_plp        = num_plp;       /* to avoid compiler warning if not used */
   bandwidth_Hz   = bandwidth_Hz;  /* to avoid compiler warning if not used */
@@ -5768,9 +5945,24 @@ signed   int  SiLabs_API_Channel_Seek_Next          (SILABS_FE_Context *front_en
   seek_result     = -1;
   SiTRACE("API CALL SEEK  : SiLabs_API_Channel_Seek_Next (front_end, &standard, &freq, &bandwidth_Hz, &stream, &symbol_rate_bps, &constellation, &polarization, &band, &num_data_slice, &num_plp, &T2_base_lite);\n");
   SiTRACE("SiLabs_API_Channel_Seek_Next config_code 0x%06x\n", front_end->config_code);
+#ifdef    PLP_DIRECTORY
+  SiLabs_PLP_Directory_Invalidate(SiLabs_PLP_Directory_Of(front_end));
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  SiLabs_Stream_Directory_Invalidate(SiLabs_Stream_Directory_Of(front_end));
+#endif /* STREAM_DIRECTORY */
 
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+#ifdef    RSSI_PRESCREEN
+    /* With the RSSI pre-screen, the L2 seek is done on each candidate step until a channel is found */
+    prescreen   = SiLabs_RSSI_Prescreen_Of(front_end);
+    seek_result = 0;
+    while (SiLabs_RSSI_Prescreen_Range(prescreen)) {
+#endif /* RSSI_PRESCREEN */
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+      SiLabs_Lock_Timeout_Apply_Seek(SiLabs_Lock_Timeout_Of(front_end));
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
       seek_result = Si2183_L2_Channel_Seek_Next (front_end->Si2183_FE, standard, freq
                                            , bandwidth_Hz
 #ifdef    DEMOD_DVB_T
@@ -5788,6 +5980,13 @@ signed   int  SiLabs_API_Channel_Seek_Next          (SILABS_FE_Context *front_en
                                            , T2_base_lite
 #endif /* DEMOD_DVB_T2 */
                                            );
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+      SiLabs_Lock_Timeout_Record(SiLabs_Lock_Timeout_Of(front_end), seek_result);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    RSSI_PRESCREEN
+      if (SiLabs_RSSI_Prescreen_Result(prescreen, seek_result) == 0) { break; }
+    }
+#endif /* RSSI_PRESCREEN */
   }
 #endif /* Si2183_COMPATIBLE */
 #ifdef    SATELLITE_FRONT_END
@@ -5835,7 +6034,7 @@ signed   int  SiLabs_API_Channel_Seek_Abort         (SILABS_FE_Context *front_en
   front_end->unicable->inBlindScan = 0;
 #endif // UNICABLE_COMPATIBLE
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_Channel_Seek_Abort (front_end->Si2183_FE); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_Channel_Seek_Abort (front_end->Si2183_FE); }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Unknown chip '%d'\n", front_end->chip);
   SiERROR("SiLabs_API_Channel_Seek_Abort Unknown chip\n");
@@ -5854,7 +6053,7 @@ signed   int  SiLabs_API_Channel_Lock_Abort         (SILABS_FE_Context *front_en
   front_end->unicable->inBlindScan = 0;
 #endif // UNICABLE_COMPATIBLE
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_Channel_Lock_Abort (front_end->Si2183_FE); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_Channel_Lock_Abort (front_end->Si2183_FE); }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Unknown chip '%d'\n", front_end->chip);
   SiERROR("SiLabs_API_Channel_Lock_Abort Unknown chip\n");
@@ -5872,8 +6071,11 @@ signed   int  SiLabs_API_Channel_Seek_End           (SILABS_FE_Context *front_en
 #ifdef    UNICABLE_COMPATIBLE
   front_end->unicable->inBlindScan = 0;
 #endif // UNICABLE_COMPATIBLE
+#ifdef    RSSI_PRESCREEN
+  SiLabs_RSSI_Prescreen_End(SiLabs_RSSI_Prescreen_Of(front_end));
+#endif /* RSSI_PRESCREEN */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_Channel_Seek_End (front_end->Si2183_FE); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_Channel_Seek_End (front_end->Si2183_FE); }
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Unknown chip '%d'\n", front_end->chip);
   SiERROR("SiLabs_API_Channel_Seek_End Unknown chip\n");
@@ -5894,7 +6096,7 @@ signed   int  SiLabs_API_SAT_AutoDetectCheck        (SILABS_FE_Context *front_en
   detected = -1;
 #ifdef    Si2183_COMPATIBLE
  #ifdef    DEMOD_DVB_S_S2_DSS
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (Si2183_L1_DD_STATUS (front_end->Si2183_FE->demod, Si2183_DD_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) {
       SiERROR("Si2183_L1_DD_STATUS ERROR\n");
       return 0;
@@ -5925,7 +6127,7 @@ signed   int  SiLabs_API_SAT_AutoDetect             (SILABS_FE_Context *front_en
   front_end = front_end; /* To avoid compiler warning if not used */
   on_off    = on_off;    /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (on_off == 0) { Si2183_SatAutoDetectOff(front_end->Si2183_FE); }
     if (on_off == 1) { Si2183_SatAutoDetect   (front_end->Si2183_FE); }
     return front_end->Si2183_FE->auto_detect_SAT;
@@ -5943,7 +6145,7 @@ signed   int  SiLabs_API_SAT_Tuner_Init             (SILABS_FE_Context *front_en
 {
 #ifdef    Si2183_COMPATIBLE
  #ifdef    DEMOD_DVB_S_S2_DSS
-  if (front_end->chip ==   0x2183 ) { SAT_TUNER_INIT(front_end->Si2183_FE->tuner_sat); front_end->Si2183_FE->SAT_tuner_init_done = 1; return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { SAT_TUNER_INIT(front_end->Si2183_FE->tuner_sat); front_end->Si2183_FE->SAT_tuner_init_done = 1; return 1; }
  #endif /* DEMOD_DVB_S_S2_DSS */
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("Unknown chip '%d'\n", front_end->chip);
@@ -5960,7 +6162,7 @@ signed   int  SiLabs_API_SAT_Tuner_Init             (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_SAT_Tuner_SetLPF           (SILABS_FE_Context *front_end,    signed   int lpf_khz)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return Si2183_L2_SAT_LPF (front_end->Si2183_FE , lpf_khz); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return Si2183_L2_SAT_LPF (front_end->Si2183_FE , lpf_khz); }
 #endif /* Si2183_COMPATIBLE */
   return 0;
 }
@@ -5975,7 +6177,7 @@ signed   int  SiLabs_API_SAT_voltage                (SILABS_FE_Context *front_en
 {
   SiTRACE_X("SiLabs_API_SAT_voltage voltage %d, front_end->lnb_chip %d\n", voltage, front_end->lnb_chip );
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { front_end->Si2183_FE->misc_infos = (front_end->Si2183_FE->misc_infos & 0xffffff00) + (voltage); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->Si2183_FE->misc_infos = (front_end->Si2183_FE->misc_infos & 0xffffff00) + (voltage); }
 #endif /* Si2183_COMPATIBLE */
 #ifdef    LNBH21_COMPATIBLE
   if (front_end->lnb_chip ==     21 ) { L1_LNBH21_Voltage(front_end->lnbh21, voltage  ); return 1;}
@@ -6041,8 +6243,8 @@ signed   int  SiLabs_API_SAT_tone                   (SILABS_FE_Context *front_en
   }
   diseqBuffer[0] = 0x00;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { front_end->Si2183_FE->misc_infos = (front_end->Si2183_FE->misc_infos & 0xffff00ff) + (tone << 8); }
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_send_diseqc_sequence (front_end->Si2183_FE , 0, &diseqBuffer[0], cont_tone, 0, 0, 1); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->Si2183_FE->misc_infos = (front_end->Si2183_FE->misc_infos & 0xffff00ff) + (tone << 8); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_send_diseqc_sequence (front_end->Si2183_FE , 0, &diseqBuffer[0], cont_tone, 0, 0, 1); return 1; }
 #endif /* Si2183_COMPATIBLE */
   return -1;
 }
@@ -6092,7 +6294,7 @@ signed   int  SiLabs_API_SAT_prepare_diseqc_sequence(SILABS_FE_Context *front_en
   end_seq         = end_seq;
   *flags          = 0;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { if (Si2183_L2_prepare_diseqc_sequence(front_end->Si2183_FE, sequence_length, sequence_buffer, cont_tone, tone_burst, burst_sel, end_seq) != NO_Si2183_ERROR ) {*flags = 0;} else {*flags = 1;} return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { if (Si2183_L2_prepare_diseqc_sequence(front_end->Si2183_FE, sequence_length, sequence_buffer, cont_tone, tone_burst, burst_sel, end_seq) != NO_Si2183_ERROR ) {*flags = 0;} else {*flags = 1;} return 1; }
 #endif /* Si2183_COMPATIBLE */
   return 0;
 }
@@ -6107,7 +6309,7 @@ signed   int  SiLabs_API_SAT_trigger_diseqc_sequence(SILABS_FE_Context *front_en
   front_end       = front_end;
   flags           = flags;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {Si2183_L2_trigger_diseqc_sequence(front_end->Si2183_FE); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {Si2183_L2_trigger_diseqc_sequence(front_end->Si2183_FE); return 1; }
 #endif /* Si2183_COMPATIBLE */
   return 0;
 }
@@ -6126,7 +6328,7 @@ signed   int  SiLabs_API_SAT_trigger_diseqc_sequence(SILABS_FE_Context *front_en
 signed   int  SiLabs_API_SAT_send_diseqc_sequence   (SILABS_FE_Context *front_end,    signed   int sequence_length, unsigned char *sequence_buffer, unsigned char cont_tone, unsigned char tone_burst, unsigned char burst_sel, unsigned char end_seq)
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_send_diseqc_sequence(front_end->Si2183_FE, sequence_length, sequence_buffer, cont_tone, tone_burst, burst_sel, end_seq); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_send_diseqc_sequence(front_end->Si2183_FE, sequence_length, sequence_buffer, cont_tone, tone_burst, burst_sel, end_seq); return 1; }
 #endif /* Si2183_COMPATIBLE */
   return -1;
 }
@@ -6141,7 +6343,7 @@ signed   int  SiLabs_API_SAT_send_diseqc_sequence   (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_SAT_read_diseqc_reply      (SILABS_FE_Context *front_end,    signed   int *reply_length  , unsigned char *reply_buffer   )
 {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_read_diseqc_reply (front_end->Si2183_FE, reply_length, reply_buffer); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_read_diseqc_reply (front_end->Si2183_FE, reply_length, reply_buffer); return 1; }
 #endif /* Si2183_COMPATIBLE */
   return -1;
 }
@@ -6150,7 +6352,7 @@ signed   int  SiLabs_API_SAT_Tuner_Tune             (SILABS_FE_Context *front_en
   SiTRACE("SiLabs_API_SAT_Tuner_Tune %d\n", freq_kHz);
 
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     L1_RF_SAT_TUNER_Tune(front_end->Si2183_FE->tuner_sat, freq_kHz);
   }
 #endif /* Si2183_COMPATIBLE */
@@ -6162,7 +6364,7 @@ signed   int  SiLabs_API_SAT_Tuner_Standby          (SILABS_FE_Context *front_en
   SiTRACE("SiLabs_API_SAT_Tuner_Standby\n");
 
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     SiLabs_SAT_Tuner_Standby(front_end->Si2183_FE->tuner_sat);
   }
 #endif /* Si2183_COMPATIBLE */
@@ -6174,7 +6376,7 @@ signed   int  SiLabs_API_SAT_Tuner_SelectRF         (SILABS_FE_Context *front_en
   SiTRACE("SiLabs_API_SAT_Tuner_SelectRF %d\n", rf_chn);
   SiLabs_API_SAT_Tuner_I2C_Enable       (front_end);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     SiLabs_SAT_Tuner_SelectRF(front_end->Si2183_FE->tuner_sat, rf_chn);
   }
 #endif /* Si2183_COMPATIBLE */
@@ -6187,7 +6389,7 @@ signed   int  SiLabs_API_SAT_Get_AGC                (SILABS_FE_Context *front_en
   signed   int agc;
   agc = -1;
 #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) {
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
       Si2183_L1_DD_EXT_AGC_SAT (front_end->Si2183_FE->demod,
                                 Si2183_DD_EXT_AGC_SAT_CMD_AGC_1_MODE_NO_CHANGE, 0,
                                 Si2183_DD_EXT_AGC_SAT_CMD_AGC_2_MODE_NO_CHANGE, 0,
@@ -6209,7 +6411,7 @@ signed   int  SiLabs_API_SAT_Unicable_Config        (SILABS_FE_Context *front_en
   front_end->unicable->Fo_kHz_low_band  = Fo_kHz_low_band;
   front_end->unicable->Fo_kHz_high_band = Fo_kHz_high_band;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->unicable_mode               = unicable_mode;
     front_end->Si2183_FE->unicable_spectrum_inversion = unicable_spectrum_inversion;
   }
@@ -6224,7 +6426,7 @@ signed   int  SiLabs_API_SAT_Unicable_Install       (SILABS_FE_Context *front_en
     front_end->lnb_type = UNICABLE_LNB_TYPE_UNICABLE;
     SiTRACE("front_end->lnb_type = UNICABLE_LNB_TYPE_UNICABLE;\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->lnb_type = front_end->lnb_type;
     front_end->Si2183_FE->demod->prop->dd_diseqc_param.sequence_mode = Si2183_DD_DISEQC_PARAM_PROP_SEQUENCE_MODE_NO_GAP;
     Si2183_L1_SetProperty2(front_end->Si2183_FE->demod, Si2183_DD_DISEQC_PARAM_PROP_CODE);
@@ -6238,7 +6440,7 @@ signed   int  SiLabs_API_SAT_Unicable_Uninstall     (SILABS_FE_Context *front_en
   front_end->lnb_type = UNICABLE_LNB_TYPE_NORMAL;
   SiTRACE("front_end->lnb_type = UNICABLE_LNB_TYPE_NORMAL;\n");
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->lnb_type = front_end->lnb_type;
     front_end->Si2183_FE->demod->prop->dd_diseqc_param.sequence_mode = Si2183_DD_DISEQC_PARAM_PROP_SEQUENCE_MODE_GAP;
     Si2183_L1_SetProperty2(front_end->Si2183_FE->demod, Si2183_DD_DISEQC_PARAM_PROP_CODE);
@@ -6261,7 +6463,7 @@ signed   int  SiLabs_API_SAT_Unicable_Tune          (SILABS_FE_Context *front_en
   signed   int L_freq;
   L_freq = SiLabs_Unicable_API_Tune(front_end->unicable, freq_kHz);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->tuner_sat->RF = L_freq;
   }
 #endif /* Si2183_COMPATIBLE */
@@ -6713,29 +6915,20 @@ signed   int  SiLabs_API_SAT_Random_Delay_Shift     (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_SAT_Tuner_I2C_Enable       (SILABS_FE_Context *front_end)
 {
 #ifdef    INDIRECT_I2C_CONNECTION
-  signed   int fe;
   signed   int requester;
-  signed   int connecter;
-  signed   int fe_count;
-  fe_count = FRONT_END_COUNT;
-  for (fe=0; fe< fe_count; fe++) {
-    if ( front_end  == &(FrontEnd_Table[fe]) ) {
-      requester = fe;
-      connecter = front_end->SAT_tuner_I2C_connection;
-      if (connecter == 100) {
-        /* 100 is a special value to allow having tuners connected directly.                                   */
-        /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
-        return 1;
-      }
-      SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Enable  request for front_end %d via front_end %d\n", requester, connecter);
-      if (connecter < fe_count) {
-        if (requester != connecter) {
-      SiTRACE("-- I2C -- Enabling  indirect SAT tuner connection  for front_end %d via front_end %d\n", requester, connecter);
-        }
-        return SiLabs_API_Tuner_I2C_Enable(&(FrontEnd_Table[connecter]) );
-      }
-      break;
+  SILABS_FE_Context *connecter;
+  connecter = SiLabs_API_Connected_Front_End(front_end, front_end->SAT_tuner_I2C_connection, &requester);
+  if (connecter != NULL) {
+    if (front_end->SAT_tuner_I2C_connection == 100) {
+      /* 100 is a special value to allow having tuners connected directly.                                   */
+      /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
+      return 1;
+    }
+    SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Enable  request for front_end %d via front_end %d\n", requester, front_end->SAT_tuner_I2C_connection);
+    if (connecter != front_end) {
+      SiTRACE("-- I2C -- Enabling  indirect SAT tuner connection  for front_end %d via front_end %d\n", requester, front_end->SAT_tuner_I2C_connection);
     }
+    return SiLabs_API_Tuner_I2C_Enable(connecter);
   }
   SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Enable  request failed! Unable to find a match for the caller front_end! (0x%08x)\n", (int)front_end);
   SiERROR("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Enable  request failed! Unable to find a match for the caller front_end!\n");
@@ -6755,29 +6948,20 @@ signed   int  SiLabs_API_SAT_Tuner_I2C_Enable       (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_SAT_Tuner_I2C_Disable      (SILABS_FE_Context *front_end)
 {
 #ifdef    INDIRECT_I2C_CONNECTION
-  signed   int fe;
   signed   int requester;
-  signed   int connecter;
-  signed   int fe_count;
-  fe_count = FRONT_END_COUNT;
-  for (fe=0; fe< fe_count; fe++) {
-    if ( front_end  == &(FrontEnd_Table[fe]) ) {
-      requester = fe;
-      connecter = front_end->SAT_tuner_I2C_connection;
-      if (connecter == 100) {
-        /* 100 is a special value to allow having tuners connected directly.                                   */
-        /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
-        return 1;
-      }
-      SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Disable request for front_end %d via front_end %d\n", requester, connecter);
-      if (connecter < fe_count) {
-        if (requester != connecter) {
-      SiTRACE("-- I2C -- Disabling indirect TER tuner connection for front_end %d via front_end %d\n", requester, connecter);
-        }
-        return SiLabs_API_Tuner_I2C_Disable(&(FrontEnd_Table[connecter]) );
-      }
-      break;
+  SILABS_FE_Context *connecter;
+  connecter = SiLabs_API_Connected_Front_End(front_end, front_end->SAT_tuner_I2C_connection, &requester);
+  if (connecter != NULL) {
+    if (front_end->SAT_tuner_I2C_connection == 100) {
+      /* 100 is a special value to allow having tuners connected directly.                                   */
+      /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
+      return 1;
+    }
+    SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Disable request for front_end %d via front_end %d\n", requester, front_end->SAT_tuner_I2C_connection);
+    if (connecter != front_end) {
+      SiTRACE("-- I2C -- Disabling indirect TER tuner connection for front_end %d via front_end %d\n", requester, front_end->SAT_tuner_I2C_connection);
     }
+    return SiLabs_API_Tuner_I2C_Disable(connecter);
   }
   SiTRACE("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Disable request failed! Unable to find a match for the caller front_end! (0x%08x)\n", (int)front_end);
   SiERROR("-- I2C -- SiLabs_API_SAT_Tuner_I2C_Disable request failed! Unable to find a match for the caller front_end!\n");
@@ -6798,15 +6982,27 @@ signed   int  SiLabs_API_SAT_Tuner_I2C_Disable      (SILABS_FE_Context *front_en
 ************************************************************************************************************************/
 signed   int  SiLabs_API_Get_Stream_Info            (SILABS_FE_Context *front_end,    signed   int  isi_index, signed   int *isi_id, signed   int *isi_constellation, signed   int *isi_code_rate )
 {
+#ifdef    STREAM_DIRECTORY
+  SILABS_Stream_Entry *entry;
+#endif /* STREAM_DIRECTORY */
   front_end         = front_end        ; /* To avoid compiler warning if not used */
   isi_index         = isi_index        ; /* To avoid compiler warning if not used */
   isi_id            = isi_id           ; /* To avoid compiler warning if not used */
   isi_constellation = isi_constellation; /* To avoid compiler warning if not used */
   isi_code_rate     = isi_code_rate    ; /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_S2X
     if (front_end->standard == SILABS_DVB_S2) {
+#ifdef    STREAM_DIRECTORY
+      entry = SiLabs_Stream_Directory_Lookup(SiLabs_Stream_Directory_Of(front_end), isi_index);
+      if (entry != NULL) {
+        *isi_id            = entry->isi_id;
+        *isi_constellation = entry->constellation;
+        *isi_code_rate     = entry->code_rate;
+        return 0;
+      }
+#endif /* STREAM_DIRECTORY */
       if (Si2183_L1_DVBS2_STREAM_INFO(front_end->Si2183_FE->demod, isi_index) != NO_Si2183_ERROR) {
         SiTRACE("Si2183_L1_DVBS2_STREAM_INFO error when checking ISI index %d!\n", isi_index);
         SiERROR("Si2183_L1_DVBS2_STREAM_INFO error!\n");
@@ -6838,7 +7034,7 @@ signed   int  SiLabs_API_Select_Stream              (SILABS_FE_Context *front_en
   stream_id       = stream_id   ; /* To avoid compiler warning if not used */
   stream_sel_mode = 0;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_S2X
     if (stream_id < 0) {
       stream_sel_mode = Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_SEL_MODE_AUTO;
@@ -6873,7 +7069,7 @@ signed   int  SiLabs_API_Get_DVBT_Hierarchy         (SILABS_FE_Context *front_en
   front_end = front_end;        /* To avoid compiler warning if not used */
   hierarchy = hierarchy;        /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (Si2183_L1_DVBT_STATUS(front_end->Si2183_FE->demod, Si2183_DVBT_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) {
       SiTRACE("Si2183_L1_DVBT_STATUS error when checking DVB-T hierarchy!\n");
       SiERROR("Si2183_L1_DVBT_STATUS error!\n");
@@ -6907,7 +7103,7 @@ signed   int  SiLabs_API_Get_DS_ID_Num_PLP_Freq     (SILABS_FE_Context *front_en
   freq_hz   = freq_hz  ; /* To avoid compiler warning if not used */
 #ifdef    DEMOD_DVB_C2
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (front_end->standard == SILABS_DVB_C2) {
       if (Si2183_L1_DVBC2_DS_INFO(front_end->Si2183_FE->demod, ds_index, Si2183_DVBC2_DS_INFO_CMD_DS_SELECT_INDEX_OR_ID_INDEX) != NO_Si2183_ERROR) {
         SiTRACE("Si2183_L1_DVBC2_DS_INFO error when checking DS index %d!\n", ds_index);
@@ -6937,13 +7133,24 @@ signed   int  SiLabs_API_Get_DS_ID_Num_PLP_Freq     (SILABS_FE_Context *front_en
 ************************************************************************************************************************/
 signed   int  SiLabs_API_Get_PLP_ID_and_TYPE        (SILABS_FE_Context *front_end,    signed   int  ds_id, signed   int plp_index, signed   int *plp_id, signed   int *plp_type)
 {
+#ifdef    PLP_DIRECTORY
+  SILABS_PLP_Entry *entry;
+#endif /* PLP_DIRECTORY */
   front_end = front_end; /* To avoid compiler warning if not used */
   plp_index = plp_index; /* To avoid compiler warning if not used */
   ds_id     = ds_id    ; /* To avoid compiler warning if not used */
   plp_id    = plp_id   ; /* To avoid compiler warning if not used */
   plp_type  = plp_type ; /* To avoid compiler warning if not used */
+#ifdef    PLP_DIRECTORY
+  entry = SiLabs_PLP_Directory_Lookup(SiLabs_PLP_Directory_Of(front_end), ds_id, plp_index);
+  if (entry != NULL) {
+    *plp_id   = entry->plp_id;
+    *plp_type = entry->plp_type;
+    return 0;
+  }
+#endif /* PLP_DIRECTORY */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_C2
     if (front_end->standard == SILABS_DVB_C2) {
       if (Si2183_L1_DVBC2_PLP_INFO(front_end->Si2183_FE->demod, plp_index, Si2183_DVBC2_PLP_INFO_CMD_PLP_INFO_DS_MODE_ANY, ds_id) != NO_Si2183_ERROR) {
@@ -6984,11 +7191,21 @@ signed   int  SiLabs_API_Get_PLP_ID_and_TYPE        (SILABS_FE_Context *front_en
 ************************************************************************************************************************/
 signed   int  SiLabs_API_Get_PLP_Group_Id           (SILABS_FE_Context *front_end,    signed   int recall, signed   int plp_index, signed   int *group_id)
 {
+#ifdef    PLP_DIRECTORY
+  SILABS_PLP_Entry *entry;
+#endif /* PLP_DIRECTORY */
   front_end = front_end; /* To avoid compiler warning if not used */
   plp_index = plp_index; /* To avoid compiler warning if not used */
   group_id  = group_id ; /* To avoid compiler warning if not used */
+#ifdef    PLP_DIRECTORY
+  entry = SiLabs_PLP_Directory_Lookup(SiLabs_PLP_Directory_Of(front_end), -1, plp_index);
+  if ( (entry != NULL) && (entry->ds_id == -1) ) {
+    *group_id = entry->group_id;
+    return 0;
+  }
+#endif /* PLP_DIRECTORY */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_T2
     if (front_end->standard == SILABS_DVB_T2) {
       if (recall) {
@@ -7023,7 +7240,7 @@ signed   int  SiLabs_API_Select_PLP                 (SILABS_FE_Context *front_en
   plp_id    = plp_id   ; /* To avoid compiler warning if not used */
   plp_mode  = 0;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_T2
     if (front_end->Si2183_FE->demod->rsp->dd_status.modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) {
       if (plp_id < 0) {
@@ -7093,7 +7310,7 @@ signed   int  SiLabs_API_Get_AC_DATA                (SILABS_FE_Context *front_en
   bit_index     = 0;
   SiTRACE("SiLabs_API_Get_AC_DATA segment %d, filtering %d, read_offfset %d, bit_count %d\n", segment, filtering, read_offset, bit_count);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_ISDB_T
     if (front_end->standard == SILABS_ISDB_T ) {
       front_end->Si2183_FE->demod->prop->isdbt_ac_select.segment_sel = segment;
@@ -7134,7 +7351,7 @@ signed   int  SiLabs_API_TER_AutoDetect             (SILABS_FE_Context *front_en
   front_end = front_end; /* To avoid compiler warning if not used */
   on_off    = on_off;    /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
 #ifdef    DEMOD_DVB_T2
     if (on_off == 0) { Si2183_TerAutoDetectOff(front_end->Si2183_FE); }
     if (on_off == 1) { Si2183_TerAutoDetect   (front_end->Si2183_FE); }
@@ -7157,7 +7374,7 @@ signed   int  SiLabs_API_TER_T2_lock_mode           (SILABS_FE_Context *front_en
   T2_lock_mode = T2_lock_mode; /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
  #ifdef    DEMOD_DVB_T2
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (T2_lock_mode == 0) { front_end->Si2183_FE->demod->prop->dvbt2_mode.lock_mode = Si2183_DVBT2_MODE_PROP_LOCK_MODE_ANY;       }
     if (T2_lock_mode == 1) { front_end->Si2183_FE->demod->prop->dvbt2_mode.lock_mode = Si2183_DVBT2_MODE_PROP_LOCK_MODE_BASE_ONLY; }
     if (T2_lock_mode == 2) { front_end->Si2183_FE->demod->prop->dvbt2_mode.lock_mode = Si2183_DVBT2_MODE_PROP_LOCK_MODE_LITE_ONLY; }
@@ -7181,7 +7398,7 @@ signed   int  SiLabs_API_TER_ISDBT_Monitoring_mode  (SILABS_FE_Context *front_en
   layer_mon    = layer_mon; /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
  #ifdef    DEMOD_ISDB_T
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->TER_ISDBT_Monitoring_mode = layer_mon;
     if (layer_mon == 0x0) { front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon = Si2183_ISDBT_MODE_PROP_LAYER_MON_ALL;     }
     if (layer_mon == 0xA) { front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon = Si2183_ISDBT_MODE_PROP_LAYER_MON_LAYER_A; }
@@ -7214,7 +7431,7 @@ signed   int  SiLabs_API_TER_ISDBT_Layer_Info       (SILABS_FE_Context *front_en
   *nb_seg           = 0;         /* To avoid compiler warning if not used */
 #ifdef    Si2183_COMPATIBLE
  #ifdef    DEMOD_ISDB_T
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (layer == 0xA) { Si2183_L1_ISDBT_LAYER_INFO(front_end->Si2183_FE->demod, Si2183_ISDBT_LAYER_INFO_CMD_LAYER_INDEX_A); }
     if (layer == 0xB) { Si2183_L1_ISDBT_LAYER_INFO(front_end->Si2183_FE->demod, Si2183_ISDBT_LAYER_INFO_CMD_LAYER_INDEX_B); }
     if (layer == 0xC) { Si2183_L1_ISDBT_LAYER_INFO(front_end->Si2183_FE->demod, Si2183_ISDBT_LAYER_INFO_CMD_LAYER_INDEX_C); }
@@ -7233,7 +7450,7 @@ signed   int  SiLabs_API_TER_Tuner_Fine_Tune        (SILABS_FE_Context *front_en
   front_end    = front_end;    /* To avoid compiler warning if not supported */
   offset_500hz = offset_500hz; /* To avoid compiler warning if not supported */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
    #ifdef    Si2173_L1_FINE_TUNE
     Si2173_L1_FINE_TUNE(front_end->Si2183_FE->tuner_ter, 0, offset_500hz);
    #endif /* Si2173_L1_FINE_TUNE */
@@ -7254,7 +7471,7 @@ signed   int  SiLabs_API_TER_Tuner_Init             (SILABS_FE_Context *front_en
 #ifdef    TER_TUNER_INIT
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { TER_TUNER_INIT(front_end->Si2183_FE->tuner_ter); front_end->Si2183_FE->TER_tuner_init_done = 1; return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { TER_TUNER_INIT(front_end->Si2183_FE->tuner_ter); front_end->Si2183_FE->TER_tuner_init_done = 1; Si2183_L2_Switch_Invalidate(front_end->Si2183_FE); return 1; }
 #endif /* Si2183_COMPATIBLE */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
 #endif /* TER_TUNER_INIT */
@@ -7311,7 +7528,7 @@ signed   int  SiLabs_API_TER_Tuner_Text_status      (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
   #endif /* Si2183_COMPATIBLE */
 #endif  /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7325,7 +7542,7 @@ signed   int  SiLabs_API_TER_Tuner_ATV_Text_status  (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_ATV_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_ATV_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7338,7 +7555,7 @@ signed   int  SiLabs_API_TER_Tuner_DTV_Text_status  (SILABS_FE_Context *front_en
   msg       = msg;       /* To avoid compiler warning */
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_DTV_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_DTV_Text_STATUS (front_end->Si2183_FE->tuner_ter , separator, msg); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   return -1;
@@ -7389,7 +7606,7 @@ signed   int  SiLabs_API_TER_Tuner_ATV_Tune         (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip == 0x2183 ) { SiLabs_TER_Tuner_ATVTune (front_end->Si2183_FE->tuner_ter , freq, video_sys, trans, color, invert_signal); }
+    if (SILABS_DEMOD_CHIP(front_end) == 0x2183 ) { SiLabs_TER_Tuner_ATVTune (front_end->Si2183_FE->tuner_ter , freq, video_sys, trans, color, invert_signal); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7401,7 +7618,7 @@ signed   int  SiLabs_API_TER_Tuner_DTV_Tune         (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip == 0x2183 ) { SiLabs_TER_Tuner_DTVTune (front_end->Si2183_FE->tuner_ter , freq, bw, modulation); }
+    if (SILABS_DEMOD_CHIP(front_end) == 0x2183 ) { SiLabs_TER_Tuner_DTVTune (front_end->Si2183_FE->tuner_ter , freq, bw, modulation); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7414,7 +7631,7 @@ signed   int  SiLabs_API_TER_Tuner_SetProperty      (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip == 0x2183 ) { res = SiLabs_TER_Tuner_Set_Property (front_end->Si2183_FE->tuner_ter , prop_code, data); }
+    if (SILABS_DEMOD_CHIP(front_end) == 0x2183 ) { res = SiLabs_TER_Tuner_Set_Property (front_end->Si2183_FE->tuner_ter , prop_code, data); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7429,7 +7646,7 @@ signed   int  SiLabs_API_TER_Tuner_GetProperty      (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip == 0x2183 ) { res = SiLabs_TER_Tuner_Get_Property (front_end->Si2183_FE->tuner_ter , prop_code, data); }
+    if (SILABS_DEMOD_CHIP(front_end) == 0x2183 ) { res = SiLabs_TER_Tuner_Get_Property (front_end->Si2183_FE->tuner_ter , prop_code, data); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7443,7 +7660,7 @@ signed   int  SiLabs_API_TER_Tuner_Block_VCO        (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7456,7 +7673,7 @@ signed   int  SiLabs_API_TER_Tuner_Block_VCO2       (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO2_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO2_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7469,7 +7686,7 @@ signed   int  SiLabs_API_TER_Tuner_Block_VCO3       (SILABS_FE_Context *front_en
   SiLabs_API_TER_Tuner_I2C_Enable (front_end);
 #ifdef    TER_TUNER_SILABS
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO3_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { SiLabs_TER_Tuner_Block_VCO3_Code (front_end->Si2183_FE->tuner_ter , vco_code); }
   #endif /* Si2183_COMPATIBLE */
 #endif /* TER_TUNER_SILABS */
   SiLabs_API_TER_Tuner_I2C_Disable(front_end);
@@ -7480,7 +7697,7 @@ signed   int  SiLabs_API_TER_Tuner_Standby          (SILABS_FE_Context *front_en
   SiTRACE("SiLabs_API_TER_Tuner_Standby\n");
 
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     SiLabs_TER_Tuner_Standby(front_end->Si2183_FE->tuner_ter);
   }
 #endif /* Si2183_COMPATIBLE */
@@ -7499,29 +7716,20 @@ signed   int  SiLabs_API_TER_Tuner_Standby          (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_TER_Tuner_I2C_Enable       (SILABS_FE_Context *front_end)
 {
 #ifdef    INDIRECT_I2C_CONNECTION
-  signed   int fe;
   signed   int requester;
-  signed   int connecter;
-  signed   int fe_count;
-  fe_count = FRONT_END_COUNT;
-  for (fe=0; fe< fe_count; fe++) {
-    if ( front_end  == &(FrontEnd_Table[fe]) ) {
-      requester = fe;
-      connecter = front_end->TER_tuner_I2C_connection;
-      if (connecter == 100) {
-        /* 100 is a special value to allow having tuners connected directly.                                   */
-        /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
-        return 1;
-      }
-      SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Enable  request for front_end %d via front_end %d\n", requester, connecter);
-      if (connecter < fe_count) {
-        if (requester != connecter) {
-      SiTRACE("-- I2C -- Enabling  indirect TER tuner connection  for front_end %d via front_end %d\n", requester, connecter);
-        }
-        return SiLabs_API_Tuner_I2C_Enable(&(FrontEnd_Table[connecter]) );
-      }
-      break;
+  SILABS_FE_Context *connecter;
+  connecter = SiLabs_API_Connected_Front_End(front_end, front_end->TER_tuner_I2C_connection, &requester);
+  if (connecter != NULL) {
+    if (front_end->TER_tuner_I2C_connection == 100) {
+      /* 100 is a special value to allow having tuners connected directly.                                   */
+      /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
+      return 1;
+    }
+    SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Enable  request for front_end %d via front_end %d\n", requester, front_end->TER_tuner_I2C_connection);
+    if (connecter != front_end) {
+      SiTRACE("-- I2C -- Enabling  indirect TER tuner connection  for front_end %d via front_end %d\n", requester, front_end->TER_tuner_I2C_connection);
     }
+    return SiLabs_API_Tuner_I2C_Enable(connecter);
   }
   SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Enable  request failed! Unable to find a match for the caller front_end! (0x%08x)\n", (int)front_end);
   SiERROR("-- I2C -- SiLabs_API_TER_Tuner_I2C_Enable  request failed! Unable to find a match for the caller front_end!\n");
@@ -7541,29 +7749,20 @@ signed   int  SiLabs_API_TER_Tuner_I2C_Enable       (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_TER_Tuner_I2C_Disable      (SILABS_FE_Context *front_end)
 {
 #ifdef    INDIRECT_I2C_CONNECTION
-  signed   int fe;
   signed   int requester;
-  signed   int connecter;
-  signed   int fe_count;
-  fe_count = FRONT_END_COUNT;
-  for (fe=0; fe< fe_count; fe++) {
-    if ( front_end  == &(FrontEnd_Table[fe]) ) {
-      requester = fe;
-      connecter = front_end->TER_tuner_I2C_connection;
-      if (connecter == 100) {
-        /* 100 is a special value to allow having tuners connected directly.                                   */
-        /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
-        return 1;
-      }
-      SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Disable request for front_end %d via front_end %d\n", requester, connecter);
-      if (connecter < fe_count) {
-        if (requester != connecter) {
-      SiTRACE("-- I2C -- Disabling indirect TER tuner connection  for front_end %d via front_end %d\n", requester, connecter);
-        }
-        return SiLabs_API_Tuner_I2C_Disable(&(FrontEnd_Table[connecter]) );
-      }
-      break;
+  SILABS_FE_Context *connecter;
+  connecter = SiLabs_API_Connected_Front_End(front_end, front_end->TER_tuner_I2C_connection, &requester);
+  if (connecter != NULL) {
+    if (front_end->TER_tuner_I2C_connection == 100) {
+      /* 100 is a special value to allow having tuners connected directly.                                   */
+      /* If tuners are connected directly, the i2c pass-through should NOT be closed, to avoid i2c deadlock. */
+      return 1;
+    }
+    SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Disable request for front_end %d via front_end %d\n", requester, front_end->TER_tuner_I2C_connection);
+    if (connecter != front_end) {
+      SiTRACE("-- I2C -- Disabling indirect TER tuner connection  for front_end %d via front_end %d\n", requester, front_end->TER_tuner_I2C_connection);
     }
+    return SiLabs_API_Tuner_I2C_Disable(connecter);
   }
   SiTRACE("-- I2C -- SiLabs_API_TER_Tuner_I2C_Disable request failed! Unable to find a match for the caller front_end! (0x%08x)\n", (int)front_end);
   SiERROR("-- I2C -- SiLabs_API_TER_Tuner_I2C_Disable request failed! Unable to find a match for the caller front_end!\n");
@@ -8528,7 +8727,7 @@ signed   int  SiLabs_API_SAT_PLS_Init               (SILABS_FE_Context *front_en
 #endif /* Si2183_COMPATIBLE */
   SiTRACE("SiLabs_API_SAT_PLS_Init %d\n", pls_init);
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (pls_init < 0) {
       pls_detection_mode = Si2183_DVBS2_PLS_INIT_CMD_PLS_DETECTION_MODE_AUTO  ; pls = 0;
     } else {
@@ -8555,7 +8754,7 @@ signed   int  SiLabs_API_Demods_Kickstart           (void)
   for (fe=0; fe < FRONT_END_COUNT; fe++) {
     front_end  = &(FrontEnd_Table[fe]);
   #ifdef    Si2183_COMPATIBLE
-    if (front_end->chip ==   0x2183 ) {
+    if (front_end->chip ==   0x2183 ) { /* run-time test, to skip the front-ends not initialized */
 #ifdef    SATELLITE_FRONT_END
       front_end->Si2183_FE->demod->cmd->start_clk.clk_mode = front_end->Si2183_FE->demod->tuner_sat_clock_input;
 #endif /* SATELLITE_FRONT_END */
@@ -8635,7 +8834,7 @@ signed   int  SiLabs_API_Cypress_Ports              (SILABS_FE_Context *front_en
 void          SiLabs_API_Demod_reset                (SILABS_FE_Context *front_end)
 {
   #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (Si2183_L1_DD_RESTART  (front_end->Si2183_FE->demod)!=0) {
       SiTRACE("Demod reset failed!\n");
     }
@@ -8646,7 +8845,7 @@ signed   int  SiLabs_API_Store_FW                   (SILABS_FE_Context *front_en
   signed   int stored, line, i; line = i = stored = 0;
 #ifdef    FW_CHANGE_COMPATIBLE
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->demod->nbLines  = nbLines;
     front_end->Si2183_FE->demod->fw_table = (firmware_struct*)realloc(front_end->Si2183_FE->demod->fw_table, sizeof(firmware_struct)*nbLines);
     for (line = 0; line < nbLines; line++) {
@@ -8676,7 +8875,7 @@ signed   int  SiLabs_API_Store_SPI_FW               (SILABS_FE_Context *front_en
   signed   int stored, i; i = stored = 0;
 #ifdef    FW_CHANGE_COMPATIBLE
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     front_end->Si2183_FE->demod->nbSpiBytes  = nbBytes;
     front_end->Si2183_FE->demod->spi_table   = (unsigned char*)realloc(front_end->Si2183_FE->demod->spi_table, sizeof(unsigned char)*nbBytes);
     for (i = 0; i < nbBytes; i++) {    front_end->Si2183_FE->demod->spi_table[i] = spi_table[i]; }
@@ -8698,11 +8897,149 @@ signed   int  SiLabs_API_Store_SPI_FW               (SILABS_FE_Context *front_en
 signed   int  SiLabs_API_Store_TER_TUNER_FW         (SILABS_FE_Context *front_end,    firmware_struct fw_table[], signed   int nbLines) {
   signed   int stored; stored = 0;
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { return SiLabs_TER_Tuner_Store_FW(front_end->Si2183_FE->tuner_ter, fw_table, nbLines); }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return SiLabs_TER_Tuner_Store_FW(front_end->Si2183_FE->tuner_ter, fw_table, nbLines); }
 #endif /* Si2183_COMPATIBLE */
   return stored*nbLines;
 }
-signed   int  SiLabs_API_Auto_Detect_Demods         (L0_Context* i2c, signed   int *Nb_FrontEnd, signed   int demod_code[4], signed   int demod_add[4], char *demod_string[4]) {
+#ifdef    WARM_ATTACH
+/************************************************************************************************************************
+  SiLabs_API_Warm_Attach function
+  Use:        warm-attach selection function
+              Used to select whether the next full init (switch_to_standard with force_full_init set) attaches
+               to a demodulator and TER tuner already running the expected firmware, instead of resetting them
+               and downloading the firmware again.
+              The expected firmware is known from a snapshot taken after the last full init (see SiLabs_API_Warm_Save).
+              If the parts do not match the snapshot, the full init is done as usual.
+  Parameter:  front_end, a pointer to the front_end context
+  Parameter:  mode, Si2183_WARM_ATTACH_OFF (0), Si2183_WARM_ATTACH_READ (1) or Si2183_WARM_ATTACH_SNAPSHOT (2)
+               READ:     the property shadow is rebuilt by reading all properties from the demodulator
+               SNAPSHOT: the property shadow is restored from the snapshot
+  Returns:    the selected mode
+************************************************************************************************************************/
+signed   int  SiLabs_API_Warm_Attach                (SILABS_FE_Context *front_end,    signed   int mode) {
+  SiTRACE("API CALL CONFIG: SiLabs_API_Warm_Attach (front_end, %d);\n", mode);
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    front_end->Si2183_FE->demod->warm_attach = (unsigned char)mode;
+  #ifdef    TERRESTRIAL_FRONT_END
+  #ifdef    TER_TUNER_SILABS
+    front_end->Si2183_FE->tuner_ter->warm_attach = (mode != Si2183_WARM_ATTACH_OFF);
+  #endif /* TER_TUNER_SILABS */
+  #endif /* TERRESTRIAL_FRONT_END */
+  }
+#endif /* Si2183_COMPATIBLE */
+  return mode;
+}
+/************************************************************************************************************************
+  SiLabs_API_Warm_Attached function
+  Use:        warm-attach status function
+              Used to know if the last full init attached to the running parts.
+  Parameter:  front_end, a pointer to the front_end context
+  Returns:    bit 0 set if the demodulator was attached, bit 1 set if the TER tuner was attached
+************************************************************************************************************************/
+signed   int  SiLabs_API_Warm_Attached              (SILABS_FE_Context *front_end) {
+  signed   int attached;
+  attached = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    if (front_end->Si2183_FE->demod->warm_attached    ) { attached = attached + 1; }
+  #ifdef    TERRESTRIAL_FRONT_END
+  #ifdef    TER_TUNER_SILABS
+    if (front_end->Si2183_FE->tuner_ter->warm_attached) { attached = attached + 2; }
+  #endif /* TER_TUNER_SILABS */
+  #endif /* TERRESTRIAL_FRONT_END */
+  }
+#endif /* Si2183_COMPATIBLE */
+  return attached;
+}
+/************************************************************************************************************************
+  SiLabs_API_Warm_Save function
+  Use:        warm-attach snapshot saving function
+              Used after a full init to store the warm-attach snapshot of the front-end in a file.
+              This file is re-loaded by SiLabs_API_Warm_Load after an application restart.
+              Warm-attach needs to be selected (SiLabs_API_Warm_Attach) before the full init, for the TER tuner
+               revision to be stored.
+  Parameter:  front_end, a pointer to the front_end context
+  Parameter:  path, the file name
+  Returns:    1 if saved, 0 otherwise
+************************************************************************************************************************/
+signed   int  SiLabs_API_Warm_Save                  (SILABS_FE_Context *front_end,    const char *path) {
+  SILABS_Warm_File  warm_file;
+  FILE             *file;
+  signed   int      saved;
+  saved = 0;
+  memset(&warm_file, 0, sizeof(warm_file));
+  warm_file.magic = SILABS_WARM_FILE_MAGIC;
+  warm_file.size  = sizeof(warm_file);
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    if (Si2183_WarmAttach_Snapshot(front_end->Si2183_FE->demod) == 0) { SiTRACE("SiLabs_API_Warm_Save: no valid demod snapshot (full init not done?)\n"); return 0; }
+    warm_file.demod = front_end->Si2183_FE->demod->warm;
+  #ifdef    TERRESTRIAL_FRONT_END
+  #ifdef    TER_TUNER_SILABS
+    warm_file.ter_tuner_code = front_end->Si2183_FE->tuner_ter->ter_tuner_code;
+    warm_file.ter_tuner_rev  = front_end->Si2183_FE->tuner_ter->warm_rev;
+  #endif /* TER_TUNER_SILABS */
+  #endif /* TERRESTRIAL_FRONT_END */
+    saved = 1;
+  }
+#endif /* Si2183_COMPATIBLE */
+  if (saved == 0) { return 0; }
+  file = fopen(path, "wb");
+  if (file == NULL) { SiTRACE("SiLabs_API_Warm_Save: can not open '%s'\n", path); return 0; }
+  if (fwrite(&warm_file, sizeof(warm_file), 1, file) != 1) { saved = 0; }
+  fclose(file);
+  SiTRACE("SiLabs_API_Warm_Save: '%s' %s\n", path, saved?"saved":"write error");
+  return saved;
+}
+/************************************************************************************************************************
+  SiLabs_API_Warm_Load function
+  Use:        warm-attach snapshot loading function
+              Used after an application restart, before the first full init, to restore the warm-attach snapshot.
+              The snapshot is only used if its magic, size, checksum and build stamp match this application.
+  Parameter:  front_end, a pointer to the front_end context
+  Parameter:  path, the file name
+  Returns:    1 if loaded, 0 otherwise
+************************************************************************************************************************/
+signed   int  SiLabs_API_Warm_Load                  (SILABS_FE_Context *front_end,    const char *path) {
+  SILABS_Warm_File  warm_file;
+  FILE             *file;
+  signed   int      loaded;
+  loaded = 0;
+  file = fopen(path, "rb");
+  if (file == NULL) { SiTRACE("SiLabs_API_Warm_Load: no '%s' file\n", path); return 0; }
+  if (fread(&warm_file, sizeof(warm_file), 1, file) == 1) { loaded = 1; }
+  fclose(file);
+  if ( (loaded == 0) | (warm_file.magic != SILABS_WARM_FILE_MAGIC) | (warm_file.size != sizeof(warm_file)) ) {
+    SiTRACE("SiLabs_API_Warm_Load: '%s' is not a valid warm-attach file\n", path);
+    return 0;
+  }
+  loaded = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    front_end->Si2183_FE->demod->warm = warm_file.demod;
+    if (Si2183_WarmAttach_Valid(front_end->Si2183_FE->demod) == 0) {
+      SiTRACE("SiLabs_API_Warm_Load: '%s' demod snapshot rejected\n", path);
+      front_end->Si2183_FE->demod->warm.magic = 0;
+      return 0;
+    }
+  #ifdef    TERRESTRIAL_FRONT_END
+  #ifdef    TER_TUNER_SILABS
+    if (warm_file.ter_tuner_code == front_end->Si2183_FE->tuner_ter->ter_tuner_code) {
+      front_end->Si2183_FE->tuner_ter->warm_rev = warm_file.ter_tuner_rev;
+    } else {
+      front_end->Si2183_FE->tuner_ter->warm_rev.major = 0;
+    }
+  #endif /* TER_TUNER_SILABS */
+  #endif /* TERRESTRIAL_FRONT_END */
+    loaded = 1;
+  }
+#endif /* Si2183_COMPATIBLE */
+  SiTRACE("SiLabs_API_Warm_Load: '%s' %s\n", path, loaded?"loaded":"not used");
+  return loaded;
+}
+#endif /* WARM_ATTACH */
+signed   int  SiLabs_API_Auto_Detect_Demods         (L0_Context* i2c, signed   int *Nb_FrontEnd, signed   int demod_code[AUTO_DETECT_DEMOD_COUNT], signed   int demod_add[AUTO_DETECT_DEMOD_COUNT], char *demod_string[AUTO_DETECT_DEMOD_COUNT]) {
   unsigned char replyBytes[16];
   unsigned char START_CLK_Bytes[13] = { 0xc0, 0x12, 0x00, 0x0c, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
   unsigned char POWER_UP_Bytes[8]   = { 0xc0, 0x06, 0x01, 0x0f, 0x00, 0x20, 0x20, 0x01 };
@@ -8716,30 +9053,35 @@ signed   int  SiLabs_API_Auto_Detect_Demods         (L0_Context* i2c, signed   i
   signed   int pminor ;
   signed   int pbuild ;
   signed   int romid  ;
+  signed   int start_time_ms;
 
   *Nb_FrontEnd = 0;
   i2c->indexSize = 0;
-  for (add = 0xC8; add <= 0xCE; add=add+2 ) {
+  for (add = 0xC8; add < 0xC8 + 2*AUTO_DETECT_DEMOD_COUNT; add=add+2 ) {
     demod_code[*Nb_FrontEnd] = demod_add[*Nb_FrontEnd] = 0;
     /* SiTRACE("Auto detecting demod at 0x%02X\n", add); */
     i2c->address = add;
     L0_WriteBytes(i2c, 0x00, sizeof(START_CLK_Bytes), START_CLK_Bytes);
     L0_WriteBytes(i2c, 0x00, sizeof(POWER_UP_Bytes),  POWER_UP_Bytes);
     CTS = 0;
+    start_time_ms = system_time();
     while (CTS == 0) {
       readBytes = L0_ReadBytes (i2c, 0x00, 1, replyBytes);
       if (readBytes == 0) {break;}
       if ( (replyBytes[0] & 0x80) == 0x80 ) { CTS = 1;}
+      if (system_time() - start_time_ms > 100) {break;}
     }
     if (CTS == 0) {
       /* SiTRACE("Read failed at add 0x%02X: no chip at this address\n", add); */
     } else {
       L0_WriteBytes(i2c, 0x00, sizeof(PART_INFO_Bytes),  PART_INFO_Bytes);
       CTS = 0;
+      start_time_ms = system_time();
       while (CTS == 0) {
         readBytes = L0_ReadBytes (i2c, 0x00, 13, replyBytes);
         if (readBytes == 0) {break;}
         if ( (replyBytes[0] & 0x80) == 0x80 ) { CTS = 1;}
+        if (system_time() - start_time_ms > 100) {break;}
       }
       if (CTS == 0) {
         /* SiTRACE("PART_INFO Read failed at add 0x%02X: no chip at this address\n", add); */
@@ -9035,13 +9377,13 @@ signed   int  Silabs_API_Test                       (SILABS_FE_Context *front_en
     }
     if (strcmp_nocase(cmd ,"sat_tag"    ) == 0) {
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { snprintf(*rettxt, 1000, SiLabs_SAT_Tuner_Tag(front_end->Si2183_FE->tuner_sat) ); return 1; }
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { snprintf(*rettxt, 1000, SiLabs_SAT_Tuner_Tag(front_end->Si2183_FE->tuner_sat) ); return 1; }
 #endif /* Si2183_COMPATIBLE */
       snprintf(*rettxt, 1000, "Unknown chip" ); return 1;
     }
 #ifdef    DEMOD_DVB_S2X
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
     if (strcmp_nocase(cmd,"DVB_S2"         ) == 0) {
       if (strcmp_nocase(sub_cmd,"ISI"         ) == 0) {
         Si2183_L1_DVBS2_STATUS(front_end->Si2183_FE->demod, 0);
@@ -9107,8 +9449,95 @@ signed   int  Silabs_API_Test                       (SILABS_FE_Context *front_en
     return SiLabs_Unicable_API_Test(front_end->unicable, target, cmd, sub_cmd, dval, retdval, rettxt);
   }
 #endif /* UNICABLE_COMPATIBLE */
+#ifdef    UNICABLE_SCHEDULER
+  if (strcmp_nocase(target,"unicable_scheduler") == 0) {
+    return SiLabs_Unicable_Scheduler_Test(&Unicable_Scheduler_Context, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* UNICABLE_SCHEDULER */
+#ifdef    DISEQC_QUEUE
+  if (strcmp_nocase(target,"diseqc_queue") == 0) {
+    return SiLabs_DiSEqC_Queue_Test(SiLabs_DiSEqC_Queue_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* DISEQC_QUEUE */
+#ifdef    STATUS_BOARD
+  if (strcmp_nocase(target,"status_board") == 0) {
+    return SiLabs_Status_Board_Test(&Status_Board_Context, front_end, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* STATUS_BOARD */
+#ifdef    SILABS_BENCHMARK
+  if (strcmp_nocase(target,"benchmark") == 0) {
+    return SiLabs_Benchmark_Test(&Benchmark_Context, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* SILABS_BENCHMARK */
+#ifdef    PLP_DIRECTORY
+  if (strcmp_nocase(target,"plp_directory") == 0) {
+    return SiLabs_PLP_Directory_Test(SiLabs_PLP_Directory_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  if (strcmp_nocase(target,"stream_directory") == 0) {
+    return SiLabs_Stream_Directory_Test(SiLabs_Stream_Directory_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* STREAM_DIRECTORY */
+#ifdef    POWER_MANAGER
+  if (strcmp_nocase(target,"power_manager") == 0) {
+    return SiLabs_Power_Manager_Test(SiLabs_Power_Manager_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* POWER_MANAGER */
+#ifdef    RSSI_PRESCREEN
+  if (strcmp_nocase(target,"rssi_prescreen") == 0) {
+    return SiLabs_RSSI_Prescreen_Test(SiLabs_RSSI_Prescreen_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* RSSI_PRESCREEN */
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  if (strcmp_nocase(target,"lock_timeout") == 0) {
+    return SiLabs_Lock_Timeout_Test(SiLabs_Lock_Timeout_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    STATUS_EXPORT
+  if (strcmp_nocase(target,"status_export") == 0) {
+    return SiLabs_Status_Export_Test(SiLabs_Status_Export_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* STATUS_EXPORT */
+#ifdef    ATV_PARALLEL_SCAN
+  if (strcmp_nocase(target,"atv_scan") == 0) {
+    if (ATV_Scan_Context.segment_hz == 0) { SiLabs_ATV_Scan_Init(&ATV_Scan_Context); }
+    return SiLabs_ATV_Scan_Test(&ATV_Scan_Context, front_end, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* ATV_PARALLEL_SCAN */
+#ifdef    FRONTEND_REGISTRY
+  if (strcmp_nocase(target,"registry") == 0) {
+    return SiLabs_FE_Registry_Test(&FE_Registry, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* FRONTEND_REGISTRY */
+#ifdef    HW_DISCOVERY
+  if (strcmp_nocase(target,"discovery") == 0) {
+    if (Discovery_Context.probe_ms == 0) { SiLabs_Discovery_Init(&Discovery_Context); }
+    return SiLabs_Discovery_Test(&Discovery_Context, front_end, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+  if (strcmp_nocase(target,"ts_router") == 0) {
+    return SiLabs_TS_Router_Test(&TS_Router_Context, front_end, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+  if (strcmp_nocase(target,"bonding") == 0) {
+    return SiLabs_Bonding_Supervisor_Test(&Bonding_Supervisor_Context, target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+  if (strcmp_nocase(target,"ts_clock") == 0) {
+    return SiLabs_TS_Clock_Test(SiLabs_TS_Clock_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  if (strcmp_nocase(target,"extended_status") == 0) {
+    return SiLabs_Extended_Status_Test(SiLabs_Extended_Status_Of(front_end), target, cmd, sub_cmd, dval, retdval, rettxt);
+  }
+#endif /* EXTENDED_STATUS */
 #ifdef    Si2183_COMPATIBLE
-  if (front_end->chip ==   0x2183 ) { Si2183_L2_Test(front_end->Si2183_FE, target, cmd, sub_cmd, dval, retdval, rettxt); return 1;}
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_Test(front_end->Si2183_FE, target, cmd, sub_cmd, dval, retdval, rettxt); return 1;}
 #endif /* Si2183_COMPATIBLE */
   snprintf(*rettxt, 1000, "no command implemented so far for '%s', can not process '%s %s %s %f'\n", cmd, target, cmd, sub_cmd, dval);
 
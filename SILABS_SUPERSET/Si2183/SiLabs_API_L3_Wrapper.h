@@ -18,6 +18,27 @@ limitations under the License.
 
 /* Change log:
 
+  As from V2.8.1:
+   <new_feature>[SAT/Unicable/Multi_receivers] Including SiLabs_API_L3_Wrapper_Unicable_Scheduler.h when UNICABLE_SCHEDULER is defined.
+   <new_feature>[SAT/DiSEqC] Including SiLabs_API_L3_Wrapper_DiSEqC_Queue.h when DISEQC_QUEUE is defined.
+   <new_feature>[Status/Multi_process] Including SiLabs_API_L3_Wrapper_Status_Board.h when STATUS_BOARD is defined.
+   <new_feature>[SIMU/benchmark] Including SiLabs_API_L3_Wrapper_Benchmark.h when SILABS_BENCHMARK is defined.
+   <new_feature>[T2/C2/MPLP] Including SiLabs_API_L3_Wrapper_PLP_Directory.h when PLP_DIRECTORY is defined.
+   <new_feature>[S2X/MULTISTREAM] Including SiLabs_API_L3_Wrapper_Stream_Directory.h when STREAM_DIRECTORY is defined.
+   <new_feature>[power_consumption/Power_manager] Including SiLabs_API_L3_Wrapper_Power_Manager.h when POWER_MANAGER is defined.
+   <new_feature>[INIT/Warm_attach] Adding SILABS_Warm_File and the SiLabs_API_Warm_ functions when WARM_ATTACH is defined.
+   <new_feature>[scan/not_blind] Including SiLabs_API_L3_Wrapper_RSSI_Prescreen.h when RSSI_PRESCREEN is defined.
+   <new_feature>[lock/adaptive_timeout] Including SiLabs_API_L3_Wrapper_Lock_Timeout.h when ADAPTIVE_LOCK_TIMEOUT is defined.
+   <new_feature>[Status/Export] Including SiLabs_API_L3_Wrapper_Status_Export.h when STATUS_EXPORT is defined.
+   <new_feature>[ATV/scan] Including SiLabs_API_L3_Wrapper_ATV_Scan.h when ATV_PARALLEL_SCAN is defined.
+   <new_feature>[multi_front_end/registry] Including SiLabs_API_L3_Wrapper_Registry.h when FRONTEND_REGISTRY is defined.
+     Adding registry and registry_handle in SILABS_FE_Context, and SiLabs_API_Connected_Front_End.
+     FRONTEND_REGISTRY requires INDIRECT_I2C_CONNECTION (compilation error otherwise).
+   <new_feature>[INIT/discovery] Including SiLabs_API_L3_Wrapper_Discovery.h when HW_DISCOVERY is defined.
+   <new_feature>[INIT/single_chip] Adding SILABS_DEMOD_CHIP, returning SINGLE_CHIP_DEMOD when defined (single-chip specialization).
+   <new_feature>[TS/adaptive_clock] Including SiLabs_API_L3_Wrapper_TS_Clock.h when ADAPTIVE_TS_CLOCK is defined.
+   <new_feature>[STATUS/extended] Including SiLabs_API_L3_Wrapper_Extended_Status.h when EXTENDED_STATUS is defined.
+
   As from V2.7.5:
    <new_feature>[ISDB-T/Monitoring] Adding TER_ISDBT_Monitoring_layer in SILABS_FE_Context.
 
@@ -159,6 +180,17 @@ extern "C" {
  #define Si2183_COMPATIBLE
 #endif /* SILABS_SUPERSET */
 
+/* <porting> Project customization: single-chip specialization                                         */
+/* For images supporting a single demodulator family, define SINGLE_CHIP_DEMOD at project level with    */
+/*  the chip code (i.e. -DSINGLE_CHIP_DEMOD=0x2183). The chip tests of the wrapper functions then       */
+/*  become compile-time constants, and the compiler only keeps the calls to the selected L2 API.        */
+/* SINGLE_CHIP_TER_TUNER and SINGLE_CHIP_SAT_TUNER do the same for the TER and SAT tuner wrappers.      */
+#ifdef    SINGLE_CHIP_DEMOD
+ #define SILABS_DEMOD_CHIP(front_end)   ((void)(front_end), (SINGLE_CHIP_DEMOD)) /* front_end evaluated to avoid unused parameter warnings */
+#else  /* SINGLE_CHIP_DEMOD */
+ #define SILABS_DEMOD_CHIP(front_end)   ((front_end)->chip)
+#endif /* SINGLE_CHIP_DEMOD */
+
 #ifdef    DEMOD_DVB_T
  #ifndef   TERRESTRIAL_FRONT_END
   #define   TERRESTRIAL_FRONT_END
@@ -630,7 +662,7 @@ typedef struct _SILABS_FE_Context             {
   unsigned int       tuner_ter;
   unsigned int       tuner_sat;
   char               tag[SILABS_TAG_SIZE];
-  unsigned char      fe_index;
+  signed   int       fe_index;
   CUSTOM_TS_Mode_Enum  active_TS_mode;
   CUSTOM_TS_Mux_Input ts_mux_input;
 #ifdef    Si2183_COMPATIBLE
@@ -648,6 +680,10 @@ typedef struct _SILABS_FE_Context             {
   SILABS_ANALOG_SIF_Config     Analog_Sif_Cfg;
   signed   int       TER_tuner_I2C_connection;
   signed   int       SAT_tuner_I2C_connection;
+#ifdef    FRONTEND_REGISTRY
+  struct _SILABS_FE_Registry *registry;  /* NULL if the front-end is not allocated in a front-end registry */
+  signed   int       registry_handle;
+#endif /* FRONTEND_REGISTRY */
   signed   int       I2C_connected;
   unsigned int       config_code;
 #ifdef    SATELLITE_FRONT_END
@@ -746,6 +782,24 @@ typedef struct _SILABS_FE_Context             {
   unsigned char PRBS[10];
 } SILABS_FE_Context;
 
+#ifdef    WARM_ATTACH
+#define SILABS_WARM_FILE_MAGIC 0x4657534cUL
+/* Structure used to store the warm-attach snapshot of one front-end in a file */
+typedef struct _SILABS_Warm_File              {
+  unsigned long                 magic;
+  unsigned long                 size;
+#ifdef    Si2183_COMPATIBLE
+  Si2183_WARM_Snapshot          demod;
+#endif /* Si2183_COMPATIBLE */
+#ifdef    TERRESTRIAL_FRONT_END
+#ifdef    TER_TUNER_SILABS
+  signed   int                  ter_tuner_code;
+  SILABS_TER_TUNER_version_info ter_tuner_rev;
+#endif /* TER_TUNER_SILABS */
+#endif /* TERRESTRIAL_FRONT_END */
+} SILABS_Warm_File;
+#endif /* WARM_ATTACH */
+
 typedef struct _CUSTOM_Status_Struct          {
 /* TODO (mdorval#1#): Add cber in status structure */
   CUSTOM_Standard_Enum standard;
@@ -970,6 +1024,69 @@ extern SILABS_FE_Context *A8297_FE_1;
  #include "SiLabs_API_L3_Wrapper_Channel_Bonding.h"
 #endif /* CHANNEL_BONDING */
 
+#ifdef    UNICABLE_SCHEDULER
+ #include "SiLabs_API_L3_Wrapper_Unicable_Scheduler.h"
+#endif /* UNICABLE_SCHEDULER */
+
+#ifdef    DISEQC_QUEUE
+ #include "SiLabs_API_L3_Wrapper_DiSEqC_Queue.h"
+#endif /* DISEQC_QUEUE */
+
+#ifdef    STATUS_BOARD
+ #include "SiLabs_API_L3_Wrapper_Status_Board.h"
+#endif /* STATUS_BOARD */
+
+#ifdef    SILABS_BENCHMARK
+ #include "SiLabs_API_L3_Wrapper_Benchmark.h"
+#endif /* SILABS_BENCHMARK */
+
+#ifdef    PLP_DIRECTORY
+ #include "SiLabs_API_L3_Wrapper_PLP_Directory.h"
+#endif /* PLP_DIRECTORY */
+
+#ifdef    STREAM_DIRECTORY
+ #include "SiLabs_API_L3_Wrapper_Stream_Directory.h"
+#endif /* STREAM_DIRECTORY */
+
+#ifdef    POWER_MANAGER
+ #include "SiLabs_API_L3_Wrapper_Power_Manager.h"
+#endif /* POWER_MANAGER */
+
+#ifdef    RSSI_PRESCREEN
+ #include "SiLabs_API_L3_Wrapper_RSSI_Prescreen.h"
+#endif /* RSSI_PRESCREEN */
+
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+ #include "SiLabs_API_L3_Wrapper_Lock_Timeout.h"
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+
+#ifdef    STATUS_EXPORT
+ #include "SiLabs_API_L3_Wrapper_Status_Export.h"
+#endif /* STATUS_EXPORT */
+
+#ifdef    ATV_PARALLEL_SCAN
+ #include "SiLabs_API_L3_Wrapper_ATV_Scan.h"
+#endif /* ATV_PARALLEL_SCAN */
+
+#ifdef    FRONTEND_REGISTRY
+ #ifndef   INDIRECT_I2C_CONNECTION
+     "If you get a compilation error on this line, it means that FRONTEND_REGISTRY is defined without INDIRECT_I2C_CONNECTION. Registry handles are used as TER/SAT tuner I2C connection values: please define INDIRECT_I2C_CONNECTION at project level!";
+ #endif /* INDIRECT_I2C_CONNECTION */
+ #include "SiLabs_API_L3_Wrapper_Registry.h"
+#endif /* FRONTEND_REGISTRY */
+
+#ifdef    HW_DISCOVERY
+ #include "SiLabs_API_L3_Wrapper_Discovery.h"
+#endif /* HW_DISCOVERY */
+
+#ifdef    ADAPTIVE_TS_CLOCK
+ #include "SiLabs_API_L3_Wrapper_TS_Clock.h"
+#endif /* ADAPTIVE_TS_CLOCK */
+
+#ifdef    EXTENDED_STATUS
+ #include "SiLabs_API_L3_Wrapper_Extended_Status.h"
+#endif /* EXTENDED_STATUS */
+
 /* Translation functions from 'Custom' values to 'SiLabs' values */
 
 signed   int  Silabs_standardCode                   (SILABS_FE_Context *front_end,    signed   int                  standard);
@@ -1207,13 +1324,25 @@ signed   int  ISDB_T_c_n_100_corrected              (SILABS_FE_Context *front_en
 signed   int  DVBT_c_n_100_corrected                (int constellation, int guard_interval, int code_rate, signed int c_n_100);
 signed   int  SiLabs_API_Store_FW                   (SILABS_FE_Context *front_end,    firmware_struct fw_table[], signed   int  nbLines);
 signed   int  SiLabs_API_Store_SPI_FW               (SILABS_FE_Context *front_end,    unsigned char   fw_table[], signed   int  nbBytes);
-
-signed   int  SiLabs_API_Auto_Detect_Demods         (L0_Context* i2c, signed   int *Nb_FrontEnd, signed   int  demod_code[4], signed   int  demod_add[4], char *demod_string[4]);
+#ifdef    WARM_ATTACH
+signed   int  SiLabs_API_Warm_Attach                (SILABS_FE_Context *front_end,    signed   int  mode);
+signed   int  SiLabs_API_Warm_Attached              (SILABS_FE_Context *front_end);
+signed   int  SiLabs_API_Warm_Save                  (SILABS_FE_Context *front_end,    const char *path);
+signed   int  SiLabs_API_Warm_Load                  (SILABS_FE_Context *front_end,    const char *path);
+#endif /* WARM_ATTACH */
+
+/* SiLabs_API_Auto_Detect_Demods probes the AUTO_DETECT_DEMOD_COUNT demodulator addresses 0xc8, 0xca, ... on a single bus.
+    For more front-ends (several buses, registry), use the discovery service (HW_DISCOVERY). */
+#define AUTO_DETECT_DEMOD_COUNT  4
+signed   int  SiLabs_API_Auto_Detect_Demods         (L0_Context* i2c, signed   int *Nb_FrontEnd, signed   int  demod_code[AUTO_DETECT_DEMOD_COUNT], signed   int  demod_add[AUTO_DETECT_DEMOD_COUNT], char *demod_string[AUTO_DETECT_DEMOD_COUNT]);
 
 signed   int  SiLabs_API_TER_Tuner_I2C_Enable       (SILABS_FE_Context *front_end);
 signed   int  SiLabs_API_TER_Tuner_I2C_Disable      (SILABS_FE_Context *front_end);
 signed   int  SiLabs_API_SAT_Tuner_I2C_Enable       (SILABS_FE_Context *front_end);
 signed   int  SiLabs_API_SAT_Tuner_I2C_Disable      (SILABS_FE_Context *front_end);
+#ifdef    INDIRECT_I2C_CONNECTION
+SILABS_FE_Context *SiLabs_API_Connected_Front_End   (SILABS_FE_Context *front_end,    signed   int connection, signed   int *requester);
+#endif /* INDIRECT_I2C_CONNECTION */
 signed   int  SiLabs_API_Get_Stream_Info            (SILABS_FE_Context *front_end,    signed   int isi_index, signed   int *isi_id, signed   int *isi_constellation, signed   int *isi_code_rate);
 signed   int  SiLabs_API_Select_Stream              (SILABS_FE_Context *front_end,    signed   int stream_id);
 
@@ -0,0 +1,687 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API ATV Scan Functions                                            */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a multi-tuner ATV channel scan coordinator                                    */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_ATV_Channel_Scan_M and SiLabs_ATV_Channel_Scan_PAL sweep the full range on one tuner, and each step
+  blocks in SiXXXX_Tune until ATVINT (channel found) or until the 110 ms ATVINT timeout (no channel).
+  Almost all the scan time is spent waiting for the tuner.
+
+ The ATV scan coordinator uses all analog-capable TER tuners of several front-ends:
+  - the scan range is split in segments (16 MHz by default), initially all 'dirty'.
+  - each idle tuner takes the next dirty segment and scans it with the same steps as the tuner-level scans
+     (1 MHz steps, and the channel width after a channel). Segments are taken in order, so that tuners
+     finishing early take the remaining segments.
+  - the tuners are driven with the non-blocking SiLabs_TER_Tuner_ATV_Scan_Tune/Check functions, all waits
+     being done in parallel in SiLabs_ATV_Scan_Process. The scan time is therefore divided by the number of tuners.
+  - the channels found by all tuners are merged into one channel list, sorted by frequency, with the video system,
+     color system and sound carrier of each channel. Channels found from 2 adjacent segments are merged.
+
+ For an incremental re-scan, SiLabs_ATV_Scan_Rescan marks the segments overlapping a frequency range as dirty and
+  removes their channels. The next scan only covers the dirty segments, keeping all other channels.
+
+ Scan families:
+  ATV_SCAN_FAMILY_M   : system M with NTSC color (sound carrier at 4.5 MHz), as SiLabs_ATV_Channel_Scan_M
+  ATV_SCAN_FAMILY_PAL : negative modulation first (B below 300 MHz, G/H above, PAL color, sound carrier at 5.5 MHz),
+                         then positive modulation (L, SECAM color, sound carrier at 6.5 MHz), as SiLabs_ATV_Channel_Scan_PAL
+
+ The tuners are only accessed from SiLabs_ATV_Scan_Start, SiLabs_ATV_Scan_Process and SiLabs_ATV_Scan_Abort,
+  with the i2c pass-through of their front-end enabled during each access. No other tuner or demodulator
+  operation should be done on these front-ends during the scan.
+
+ Use case:
+    SiLabs_ATV_Scan_Init      (&ATV_Scan_Context);
+    SiLabs_ATV_Scan_Add_Tuner (&ATV_Scan_Context, &(FrontEnd_Table[0]));
+    SiLabs_ATV_Scan_Add_Tuner (&ATV_Scan_Context, &(FrontEnd_Table[1]));
+    SiLabs_ATV_Scan_Config    (&ATV_Scan_Context, ATV_SCAN_FAMILY_PAL, 44000000, 870000000, 0);
+    SiLabs_ATV_Scan_Run       (&ATV_Scan_Context);                          (complete scan)
+    ...
+    SiLabs_ATV_Scan_Rescan    (&ATV_Scan_Context, 470000000, 500000000);
+    SiLabs_ATV_Scan_Run       (&ATV_Scan_Context);                          (scan of the dirty segments only)
+
+  To run the scan in the application's loop: SiLabs_ATV_Scan_Start, then SiLabs_ATV_Scan_Process until it returns 0.
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[ATV/scan] Initial version of the multi-tuner ATV scan coordinator
+   <improvement>[ATV/scan] Pacing the tuner status checks: each tuner is checked ATV_SCAN_SETTLE_MS after its tune, then
+     every ATV_SCAN_POLL_MS, and SiLabs_ATV_Scan_Run waits until the next tuner is due instead of polling the bus.
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   ATV_PARALLEL_SCAN
+  "If you get a compilation error on this line, it means that you included the ATV_Scan code in your project without defining ATV_PARALLEL_SCAN.";
+  "Please define ATV_PARALLEL_SCAN at project-level, or remove the ATV_Scan code from your project";
+#endif /* ATV_PARALLEL_SCAN */
+
+#ifdef    ATV_PARALLEL_SCAN
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "ATV_Scan  "
+#include "SiLabs_API_L3_Wrapper_ATV_Scan.h"
+
+SILABS_ATV_Scan  ATV_Scan_Context;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_TER_Tuner function
+  Use:      TER tuner retrieval
+  Returns:  a pointer to the SiLabs TER tuner of the front-end, NULL if none
+************************************************************************************************************************/
+#ifdef    TER_TUNER_SILABS
+static SILABS_TER_TUNER_Context *SiLabs_ATV_Scan_TER_Tuner (SILABS_FE_Context *front_end) {
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { return front_end->Si2183_FE->tuner_ter; }
+#endif /* Si2183_COMPATIBLE */
+  front_end = front_end; /* To avoid compiler warning */
+  return NULL;
+}
+#endif /* TER_TUNER_SILABS */
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Tune function
+  Use:      Tune request of one tuner, on tuner->freq with tuner->system
+  Returns:  0 if ok, -1 in case of error
+************************************************************************************************************************/
+static signed int SiLabs_ATV_Scan_Tune                 (SILABS_ATV_Scan *scan, SILABS_ATV_Scan_Tuner *tuner) {
+  signed   int return_code;
+  return_code = -1;
+#ifdef    TER_TUNER_SILABS
+  SiLabs_API_TER_Tuner_I2C_Enable (tuner->front_end);
+  return_code = SiLabs_TER_Tuner_ATV_Scan_Tune(SiLabs_ATV_Scan_TER_Tuner(tuner->front_end), tuner->freq, tuner->system);
+  SiLabs_API_TER_Tuner_I2C_Disable(tuner->front_end);
+#endif /* TER_TUNER_SILABS */
+  tuner->state         = ATV_SCAN_TUNER_TUNINT;
+  tuner->start_ms      = system_time();
+  tuner->next_check_ms = tuner->start_ms + ATV_SCAN_SETTLE_MS;
+  tuner->tunes++;
+  scan->tunes++;
+  return return_code;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Error function
+  Use:      Tuner error handling
+            The segment being scanned is set back to dirty, and the tuner is not used until the next SiLabs_ATV_Scan_Start
+************************************************************************************************************************/
+static void       SiLabs_ATV_Scan_Error                (SILABS_ATV_Scan *scan, SILABS_ATV_Scan_Tuner *tuner) {
+  SiERROR("ATV scan: tuner error, the tuner is removed from the scan\n");
+  SiTRACE("ATV scan: fe[%d] tuner error at %ld Hz, segment %d set back to dirty\n", tuner->front_end->fe_index, tuner->freq, tuner->segment);
+  if (tuner->segment >= 0) { scan->segment[tuner->segment].state = ATV_SCAN_SEGMENT_DIRTY; }
+  tuner->segment = -1;
+  tuner->state   = ATV_SCAN_TUNER_DISABLED;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Next function
+  Use:      Move of one tuner to the next frequency of its segment
+            The segment is done when freq is at or above its end. The tuner then continues in the next segment if
+             it is still dirty, as the tuner-level scans would (dirty segments entirely covered by the channel
+             just found are done as well). Otherwise, the tuner is idle and takes the next dirty segment.
+************************************************************************************************************************/
+static void       SiLabs_ATV_Scan_Next                 (SILABS_ATV_Scan *scan, SILABS_ATV_Scan_Tuner *tuner, unsigned long freq) {
+  SILABS_ATV_Scan_Segment *segment;
+  segment = &(scan->segment[tuner->segment]);
+  while (freq >= segment->max_hz) {
+    segment->state = (segment->state == ATV_SCAN_SEGMENT_RESCAN) ? ATV_SCAN_SEGMENT_DIRTY : ATV_SCAN_SEGMENT_CLEAN;
+    segment->scans++;
+    tuner->segments++;
+    if ( (tuner->segment + 1 >= scan->nb_segments) || (scan->segment[tuner->segment + 1].state != ATV_SCAN_SEGMENT_DIRTY) ) {
+      tuner->segment = -1;
+      tuner->state   = ATV_SCAN_TUNER_IDLE;
+      return;
+    }
+    tuner->segment++;
+    segment        = &(scan->segment[tuner->segment]);
+    segment->state = ATV_SCAN_SEGMENT_SCANNING;
+  }
+  tuner->freq   = freq;
+  tuner->system = (scan->family == ATV_SCAN_FAMILY_PAL) ? L1_RF_TER_TUNER_ATV_SCAN_DK : L1_RF_TER_TUNER_ATV_SCAN_M;
+  if (SiLabs_ATV_Scan_Tune(scan, tuner) != 0) { SiLabs_ATV_Scan_Error(scan, tuner); }
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Remove function
+  Use:      Removal of the channels between min_hz (included) and max_hz (excluded)
+  Returns:  the number of removed channels
+************************************************************************************************************************/
+static signed int SiLabs_ATV_Scan_Remove               (SILABS_ATV_Scan *scan, unsigned long min_hz, unsigned long max_hz) {
+  signed   int i;
+  signed   int kept;
+  kept = 0;
+  for (i=0; i<scan->nb_channels; i++) {
+    if ( (scan->channel[i].freq >= min_hz) && (scan->channel[i].freq < max_hz) ) { continue; }
+    if (kept != i) { scan->channel[kept] = scan->channel[i]; }
+    kept++;
+  }
+  i = scan->nb_channels - kept;
+  scan->nb_channels = kept;
+  return i;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Insert function
+  Use:      Insertion of a channel in the sorted channel list
+            A channel closer than ATV_SCAN_SAME_CHANNEL_HZ from a known channel is the same channel found from another
+             segment: the result with the smallest AFC offset is kept.
+  Returns:  the index of the channel, -1 if the list is full
+************************************************************************************************************************/
+static signed int SiLabs_ATV_Scan_Insert               (SILABS_ATV_Scan *scan, SILABS_ATV_Channel *channel) {
+  signed   int i;
+  signed   int pos;
+  pos = scan->nb_channels;
+  for (i=0; i<scan->nb_channels; i++) {
+    if ( (channel->freq + ATV_SCAN_SAME_CHANNEL_HZ > scan->channel[i].freq) && (channel->freq < scan->channel[i].freq + ATV_SCAN_SAME_CHANNEL_HZ) ) {
+      if (abs(channel->afc_khz) < abs(scan->channel[i].afc_khz)) { scan->channel[i] = *channel; }
+      return i;
+    }
+    if ( (pos == scan->nb_channels) && (scan->channel[i].freq > channel->freq) ) { pos = i; }
+  }
+  if (scan->nb_channels >= ATV_SCAN_MAX_CHANNELS) {
+    SiTRACE("ATV scan: channel list full, %ld Hz not stored\n", channel->freq);
+    return -1;
+  }
+  for (i=scan->nb_channels; i>pos; i--) { scan->channel[i] = scan->channel[i-1]; }
+  scan->channel[pos] = *channel;
+  scan->nb_channels++;
+  return pos;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Found function
+  Use:      Channel found by one tuner (ATVINT)
+            The channel is classified as in the tuner-level scans, stored, and the tuner moves after the channel.
+************************************************************************************************************************/
+static void       SiLabs_ATV_Scan_Found                (SILABS_ATV_Scan *scan, SILABS_ATV_Scan_Tuner *tuner, signed   int afc_khz) {
+  SILABS_ATV_Channel channel;
+  unsigned long      increment;
+  channel.freq    = (unsigned long)((signed long)tuner->freq + (signed long)afc_khz*1000);
+  channel.afc_khz = afc_khz;
+  channel.tuner   = (unsigned char)(tuner - scan->tuner);
+  if        (tuner->system == L1_RF_TER_TUNER_ATV_SCAN_M ) {
+    channel.video_sys = SILABS_VIDEO_SYS_M;
+    channel.color     = SILABS_COLOR_PAL_NTSC;
+    increment         = 6000000;
+  } else if (tuner->system == L1_RF_TER_TUNER_ATV_SCAN_DK) {
+    channel.color     = SILABS_COLOR_PAL_NTSC;
+    if (tuner->freq < ATV_SCAN_VHF_MAX_HZ) {
+      channel.video_sys = SILABS_VIDEO_SYS_B;
+      channel.freq      = channel.freq - 500000;
+      increment         = 7000000;
+    } else {
+      channel.video_sys = SILABS_VIDEO_SYS_GH;
+      increment         = 8000000;
+    }
+  } else {
+    channel.video_sys = SILABS_VIDEO_SYS_L;
+    channel.color     = SILABS_COLOR_SECAM;
+    increment         = 8000000;
+  }
+  channel.sound_khz = SiLabs_ATV_Scan_Sound_kHz(channel.video_sys);
+  SiTRACE("ATV scan: fe[%d] %s channel at %ld Hz (afc %d kHz)\n", tuner->front_end->fe_index, SiLabs_ATV_Scan_Video_Sys_Text(channel.video_sys), channel.freq, afc_khz);
+  if (SiLabs_ATV_Scan_Insert(scan, &channel) >= 0) { tuner->channels++; }
+  SiLabs_ATV_Scan_Next(scan, tuner, channel.freq + increment);
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Not_Found function
+  Use:      No channel found by one tuner (TUNINT or ATVINT timeout)
+            In the PAL family, positive modulation is tried after negative modulation, otherwise the tuner moves 1 step.
+************************************************************************************************************************/
+static void       SiLabs_ATV_Scan_Not_Found            (SILABS_ATV_Scan *scan, SILABS_ATV_Scan_Tuner *tuner) {
+  if (tuner->system == L1_RF_TER_TUNER_ATV_SCAN_DK) {
+    tuner->system = L1_RF_TER_TUNER_ATV_SCAN_L;
+    if (SiLabs_ATV_Scan_Tune(scan, tuner) != 0) { SiLabs_ATV_Scan_Error(scan, tuner); }
+    return;
+  }
+  SiLabs_ATV_Scan_Next(scan, tuner, tuner->freq + ATV_SCAN_STEP_HZ);
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Init function
+  Use:      ATV scan coordinator initialization
+            No tuner, default thresholds, M family.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Init                    (SILABS_ATV_Scan *scan) {
+  memset(scan, 0, sizeof(SILABS_ATV_Scan));
+  scan->family          = ATV_SCAN_FAMILY_M;
+  scan->segment_hz      = ATV_SCAN_SEGMENT_HZ;
+  scan->min_rssi_dBm    = ATV_SCAN_MIN_RSSI_DBM;
+  scan->max_rssi_dBm    = ATV_SCAN_MAX_RSSI_DBM;
+  scan->min_snr_half_dB = ATV_SCAN_MIN_SNR_HALF_DB;
+  scan->max_snr_half_dB = ATV_SCAN_MAX_SNR_HALF_DB;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Add_Tuner function
+  Use:      Addition of the TER tuner of a front-end to the scan
+            The tuner capabilities are checked in SiLabs_ATV_Scan_Start.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  the index of the tuner in the scan, -1 if the tuner table is full
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Add_Tuner               (SILABS_ATV_Scan *scan, SILABS_FE_Context *front_end) {
+  SILABS_ATV_Scan_Tuner *tuner;
+  signed   int           i;
+  for (i=0; i<scan->nb_tuners; i++) {
+    if (scan->tuner[i].front_end == front_end) { return i; }
+  }
+  if (scan->nb_tuners >= ATV_SCAN_MAX_TUNERS) { return -1; }
+  tuner = &(scan->tuner[scan->nb_tuners]);
+  memset(tuner, 0, sizeof(SILABS_ATV_Scan_Tuner));
+  tuner->front_end = front_end;
+  tuner->segment   = -1;
+  tuner->state     = ATV_SCAN_TUNER_IDLE;
+  return scan->nb_tuners++;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Config function
+  Use:      Scan range configuration
+            Used to set the scan family and range, and to split the range in segments. All segments are dirty and
+             the channel list is cleared, so that the next scan is a complete scan.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Parameter: family, ATV_SCAN_FAMILY_M or ATV_SCAN_FAMILY_PAL
+  Parameter: range_min, the scan start frequency (Hz)
+  Parameter: range_max, the scan end   frequency (Hz)
+  Parameter: segment_hz, the segment width (0 for ATV_SCAN_SEGMENT_HZ). It is increased if more than ATV_SCAN_MAX_SEGMENTS are needed.
+  Returns:  the number of segments, 0 if the range is empty
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Config                  (SILABS_ATV_Scan *scan, signed   int family, unsigned long range_min, unsigned long range_max, unsigned long segment_hz) {
+  signed   int i;
+  if (scan->running) { SiLabs_ATV_Scan_Abort(scan); }
+  scan->nb_segments = 0;
+  scan->nb_channels = 0;
+  if (range_max <= range_min) { return 0; }
+  if (segment_hz < ATV_SCAN_STEP_HZ) { segment_hz = ATV_SCAN_SEGMENT_HZ; }
+  if ((range_max - range_min + segment_hz - 1)/segment_hz > ATV_SCAN_MAX_SEGMENTS) {
+    segment_hz = (range_max - range_min + ATV_SCAN_MAX_SEGMENTS - 1)/ATV_SCAN_MAX_SEGMENTS;
+    segment_hz = ((segment_hz + ATV_SCAN_STEP_HZ - 1)/ATV_SCAN_STEP_HZ)*ATV_SCAN_STEP_HZ;
+  }
+  scan->family      = (family == ATV_SCAN_FAMILY_PAL) ? ATV_SCAN_FAMILY_PAL : ATV_SCAN_FAMILY_M;
+  scan->range_min   = range_min;
+  scan->range_max   = range_max;
+  scan->segment_hz  = segment_hz;
+  scan->nb_segments = (signed int)((range_max - range_min + segment_hz - 1)/segment_hz);
+  for (i=0; i<scan->nb_segments; i++) {
+    scan->segment[i].min_hz = range_min + i*segment_hz;
+    scan->segment[i].max_hz = (scan->segment[i].min_hz + segment_hz < range_max) ? scan->segment[i].min_hz + segment_hz : range_max;
+    scan->segment[i].state  = ATV_SCAN_SEGMENT_DIRTY;
+    scan->segment[i].scans  = 0;
+  }
+  SiTRACE("ATV scan %s from %ld to %ld Hz: %d segments of %ld Hz\n", (scan->family == ATV_SCAN_FAMILY_PAL) ? "PAL" : "M", range_min, range_max, scan->nb_segments, segment_hz);
+  return scan->nb_segments;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Thresholds function
+  Use:      Scan thresholds configuration, applied from the next SiLabs_ATV_Scan_Start
+            The SNR thresholds are only used by tuners supporting them (not by the Si2157).
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Thresholds              (SILABS_ATV_Scan *scan, signed   int min_rssi_dBm, signed   int max_rssi_dBm, signed   int min_snr_half_dB, signed   int max_snr_half_dB) {
+  scan->min_rssi_dBm    = min_rssi_dBm;
+  scan->max_rssi_dBm    = max_rssi_dBm;
+  scan->min_snr_half_dB = min_snr_half_dB;
+  scan->max_snr_half_dB = max_snr_half_dB;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Rescan function
+  Use:      Incremental re-scan request
+            Used to mark the segments overlapping min_hz..max_hz as dirty, and to remove their channels.
+            A segment being scanned is scanned again once done.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Parameter: min_hz, max_hz, the frequency range to re-scan (max_hz excluded)
+  Returns:  the number of segments to re-scan
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Rescan                  (SILABS_ATV_Scan *scan, unsigned long min_hz, unsigned long max_hz) {
+  SILABS_ATV_Scan_Segment *segment;
+  signed   int             i;
+  signed   int             count;
+  count = 0;
+  for (i=0; i<scan->nb_segments; i++) {
+    segment = &(scan->segment[i]);
+    if ( (segment->max_hz <= min_hz) || (segment->min_hz >= max_hz) ) { continue; }
+    if        (segment->state == ATV_SCAN_SEGMENT_SCANNING) {
+      segment->state = ATV_SCAN_SEGMENT_RESCAN;
+    } else if (segment->state == ATV_SCAN_SEGMENT_CLEAN   ) {
+      segment->state = ATV_SCAN_SEGMENT_DIRTY;
+    }
+    SiLabs_ATV_Scan_Remove(scan, segment->min_hz, segment->max_hz);
+    count++;
+  }
+  SiTRACE("ATV scan: %d segments to re-scan between %ld and %ld Hz\n", count, min_hz, max_hz);
+  return count;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Start function
+  Use:      Scan start
+            Used to configure the ATV scan thresholds in all tuners. Tuners which are not ATV capable are not used.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  the number of tuners used for the scan
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Start                   (SILABS_ATV_Scan *scan) {
+  SILABS_ATV_Scan_Tuner *tuner;
+  signed   int           usable;
+  signed   int           i;
+  usable = 0;
+  for (i=0; i<scan->nb_tuners; i++) {
+    tuner = &(scan->tuner[i]);
+    tuner->segment = -1;
+    tuner->state   = ATV_SCAN_TUNER_DISABLED;
+#ifdef    TER_TUNER_SILABS
+    if (SiLabs_ATV_Scan_TER_Tuner(tuner->front_end) == NULL) { continue; }
+    SiLabs_API_TER_Tuner_I2C_Enable (tuner->front_end);
+    if (SiLabs_TER_Tuner_ATV_Scan_Setup(SiLabs_ATV_Scan_TER_Tuner(tuner->front_end), scan->min_rssi_dBm, scan->max_rssi_dBm, scan->min_snr_half_dB, scan->max_snr_half_dB) == 0) {
+      tuner->state = ATV_SCAN_TUNER_IDLE;
+      usable++;
+    }
+    SiLabs_API_TER_Tuner_I2C_Disable(tuner->front_end);
+#endif /* TER_TUNER_SILABS */
+    if (tuner->state == ATV_SCAN_TUNER_DISABLED) { SiTRACE("ATV scan: fe[%d] TER tuner not ATV capable, not used\n", tuner->front_end->fe_index); }
+  }
+  scan->tunes    = 0;
+  scan->start_ms = system_time();
+  scan->running  = (usable > 0);
+  SiTRACE("ATV scan start with %d tuners\n", usable);
+  return usable;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Process function
+  Use:      Scan processing, non-blocking
+            Used to check all tuners once: idle tuners take the next dirty segment, tuners with ATVINT store their channel
+             and tune the next frequency, tuners with a TUNINT/ATVINT timeout tune the next frequency.
+            A tuner status is only read once its next_check_ms is reached (ATV_SCAN_SETTLE_MS after the tune, then
+             every ATV_SCAN_POLL_MS). scan->next_check_ms is the time at which the next tuner is due.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  1 while the scan is running, 0 when all segments are scanned (or no tuner can be used anymore)
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Process                 (SILABS_ATV_Scan *scan) {
+  SILABS_ATV_Scan_Tuner *tuner;
+  signed   int           afc_khz;
+  signed   int           check;
+  signed   int           next;
+  signed   int           usable;
+  signed   int           busy;
+  signed   int           now;
+  signed   int           i;
+  if (!scan->running) { return 0; }
+  now  = system_time();
+  next = 0;
+  for (i=0; i<scan->nb_tuners; i++) {
+    tuner = &(scan->tuner[i]);
+    if (tuner->state == ATV_SCAN_TUNER_DISABLED) { continue; }
+    if (tuner->segment < 0) {
+      while ( (next < scan->nb_segments) && (scan->segment[next].state != ATV_SCAN_SEGMENT_DIRTY) ) { next++; }
+      if (next >= scan->nb_segments) { continue; }
+      scan->segment[next].state = ATV_SCAN_SEGMENT_SCANNING;
+      tuner->segment            = next;
+      SiLabs_ATV_Scan_Next(scan, tuner, scan->segment[next].min_hz);
+      continue;
+    }
+    if (now < tuner->next_check_ms) { continue; }
+    afc_khz = 0;
+    check   = -1;
+#ifdef    TER_TUNER_SILABS
+    SiLabs_API_TER_Tuner_I2C_Enable (tuner->front_end);
+    check = SiLabs_TER_Tuner_ATV_Scan_Check(SiLabs_ATV_Scan_TER_Tuner(tuner->front_end), &afc_khz);
+    SiLabs_API_TER_Tuner_I2C_Disable(tuner->front_end);
+#endif /* TER_TUNER_SILABS */
+    if (check <  0) { SiLabs_ATV_Scan_Error(scan, tuner); continue; }
+    if (check == 2) { SiLabs_ATV_Scan_Found(scan, tuner, afc_khz); continue; }
+    if (tuner->state == ATV_SCAN_TUNER_TUNINT) {
+      if (check == 1) {
+        tuner->state    = ATV_SCAN_TUNER_ATVINT;
+        tuner->start_ms = system_time();
+      } else if (system_time() - tuner->start_ms > ATV_SCAN_TUNINT_TIMEOUT_MS) {
+        SiTRACE("ATV scan: fe[%d] timeout waiting for TUNINT at %ld Hz\n", tuner->front_end->fe_index, tuner->freq);
+        SiLabs_ATV_Scan_Not_Found(scan, tuner);
+      }
+    } else if (system_time() - tuner->start_ms > ATV_SCAN_ATVINT_TIMEOUT_MS) {
+      SiLabs_ATV_Scan_Not_Found(scan, tuner);
+    }
+    if ( (tuner->segment >= 0) && (tuner->next_check_ms <= now) ) { tuner->next_check_ms = system_time() + ATV_SCAN_POLL_MS; }
+  }
+  /* The scan is over when no tuner is scanning and no dirty segment can be taken */
+  usable = 0;
+  busy   = 0;
+  for (i=0; i<scan->nb_tuners; i++) {
+    if (scan->tuner[i].state   != ATV_SCAN_TUNER_DISABLED) { usable++; }
+    if (scan->tuner[i].segment >= 0                      ) { busy  = 1; }
+  }
+  /* Earliest time at which a scanning tuner is due */
+  scan->next_check_ms = now + ATV_SCAN_POLL_MS;
+  for (i=0; i<scan->nb_tuners; i++) {
+    if (scan->tuner[i].segment <  0                       ) { continue; }
+    if (scan->tuner[i].next_check_ms < scan->next_check_ms) { scan->next_check_ms = scan->tuner[i].next_check_ms; }
+  }
+  for (i=0; (i<scan->nb_segments) && (usable) && (!busy); i++) {
+    if (scan->segment[i].state == ATV_SCAN_SEGMENT_DIRTY) { busy = 1; }
+  }
+  if (!busy) {
+    scan->running = 0;
+    scan->scan_ms = system_time() - scan->start_ms;
+    SiTRACE("ATV scan done in %d ms with %d tuners: %d tunes, %d channels\n", scan->scan_ms, usable, scan->tunes, scan->nb_channels);
+  }
+  return scan->running;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Abort function
+  Use:      Scan abort
+            The segments being scanned are set back to dirty, so that they are scanned by the next SiLabs_ATV_Scan_Run.
+            The channels found so far are kept.
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  the number of segments left dirty
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Abort                   (SILABS_ATV_Scan *scan) {
+  signed   int i;
+  signed   int dirty;
+  for (i=0; i<scan->nb_tuners; i++) {
+    if (scan->tuner[i].segment >= 0) { scan->segment[scan->tuner[i].segment].state = ATV_SCAN_SEGMENT_DIRTY; }
+    scan->tuner[i].segment = -1;
+    if (scan->tuner[i].state != ATV_SCAN_TUNER_DISABLED) { scan->tuner[i].state = ATV_SCAN_TUNER_IDLE; }
+  }
+  dirty = 0;
+  for (i=0; i<scan->nb_segments; i++) {
+    if (scan->segment[i].state != ATV_SCAN_SEGMENT_CLEAN) { scan->segment[i].state = ATV_SCAN_SEGMENT_DIRTY; dirty++; }
+  }
+  if (scan->running) { scan->scan_ms = system_time() - scan->start_ms; }
+  scan->running = 0;
+  SiTRACE("ATV scan aborted, %d segments left to scan\n", dirty);
+  return dirty;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Run function
+  Use:      Blocking scan of all dirty segments
+            Between 2 calls to SiLabs_ATV_Scan_Process, waits until the next tuner is due
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Returns:  the number of channels in the channel list, -1 if no tuner can be used
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Run                     (SILABS_ATV_Scan *scan) {
+  signed   int wait_ms;
+  if (SiLabs_ATV_Scan_Start(scan) == 0) { return -1; }
+  while (SiLabs_ATV_Scan_Process(scan)) {
+    wait_ms = scan->next_check_ms - system_time();
+    if (wait_ms > 0) { system_wait(wait_ms); }
+  }
+  return scan->nb_channels;
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Sound_kHz function
+  Use:      Main sound carrier offset of a video system
+  Parameter: video_sys, a SILABS_VIDEO_SYS_xx value
+  Returns:  the sound carrier offset from the picture carrier, in kHz
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Sound_kHz               (signed   int video_sys) {
+  switch (video_sys) {
+    case SILABS_VIDEO_SYS_M  :
+    case SILABS_VIDEO_SYS_N  : return 4500;
+    case SILABS_VIDEO_SYS_B  :
+    case SILABS_VIDEO_SYS_GH : return 5500;
+    case SILABS_VIDEO_SYS_I  : return 6000;
+    default                  : return 6500;
+  }
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Video_Sys_Text function
+  Use:      Video system text
+  Parameter: video_sys, a SILABS_VIDEO_SYS_xx value
+  Returns:  the video system name
+************************************************************************************************************************/
+const char    *SiLabs_ATV_Scan_Video_Sys_Text          (signed   int video_sys) {
+  switch (video_sys) {
+    case SILABS_VIDEO_SYS_B  : return "B" ;
+    case SILABS_VIDEO_SYS_GH : return "GH";
+    case SILABS_VIDEO_SYS_M  : return "M" ;
+    case SILABS_VIDEO_SYS_N  : return "N" ;
+    case SILABS_VIDEO_SYS_I  : return "I" ;
+    case SILABS_VIDEO_SYS_DK : return "DK";
+    case SILABS_VIDEO_SYS_L  : return "L" ;
+    case SILABS_VIDEO_SYS_LP : return "LP";
+    default                  : return "?" ;
+  }
+}
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Text function
+  Use:      ATV scan text
+            Used to list the configuration, the tuners, the segments and the channel list
+  Parameter: scan, a pointer to the ATV scan coordinator
+  Parameter: text, a buffer to store the text
+  Parameter: size, the buffer size
+  Returns:  the text length
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Text                    (SILABS_ATV_Scan *scan, char *text, signed   int size) {
+  SILABS_ATV_Channel *channel;
+  signed   int        dirty;
+  signed   int        i;
+  signed   int        pos;
+  dirty = 0;
+  for (i=0; i<scan->nb_segments; i++) {
+    if (scan->segment[i].state != ATV_SCAN_SEGMENT_CLEAN) { dirty++; }
+  }
+  pos  = snprintf(text, size, "ATV scan %s%s from %ld to %ld Hz: %d segments of %ld Hz, %d to scan. RSSI %d..%d dBm, SNR %d..%d (0.5 dB)\n"
+    , (scan->family == ATV_SCAN_FAMILY_PAL) ? "PAL" : "M", scan->running ? " (running)" : "", scan->range_min, scan->range_max, scan->nb_segments, scan->segment_hz, dirty
+    , scan->min_rssi_dBm, scan->max_rssi_dBm, scan->min_snr_half_dB, scan->max_snr_half_dB);
+  if (pos < size) {
+    pos += snprintf(text + pos, size - pos, "last scan: %d ms, %d tunes, %d channels\n", scan->scan_ms, scan->tunes, scan->nb_channels);
+  }
+  for (i=0; (i<scan->nb_tuners) && (pos < size); i++) {
+    pos += snprintf(text + pos, size - pos, " tuner %d fe[%d]%s: %d segments, %d tunes, %d channels\n"
+      , i, scan->tuner[i].front_end->fe_index, (scan->tuner[i].state == ATV_SCAN_TUNER_DISABLED) ? " (not used)" : "", scan->tuner[i].segments, scan->tuner[i].tunes, scan->tuner[i].channels);
+  }
+  for (i=0; (i<scan->nb_channels) && (pos < size); i++) {
+    channel = &(scan->channel[i]);
+    pos += snprintf(text + pos, size - pos, " %3d: %9.3f MHz %-2s %-8s sound +%.1f MHz afc %4d kHz (tuner %d)\n"
+      , i, channel->freq/1000000.0, SiLabs_ATV_Scan_Video_Sys_Text(channel->video_sys), (channel->color == SILABS_COLOR_SECAM) ? "SECAM" : (channel->video_sys == SILABS_VIDEO_SYS_M) ? "NTSC" : "PAL"
+      , channel->sound_khz/1000.0, channel->afc_khz, channel->tuner);
+  }
+  return pos;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_ATV_Scan_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the ATV scan coordinator.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_ATV_Scan_Test                    (SILABS_ATV_Scan *scan, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  char         family[8];
+  signed   int min_rssi_dBm;
+  signed   int max_rssi_dBm;
+  signed   int min_snr_half_dB;
+  signed   int max_snr_half_dB;
+  unsigned long range_min;
+  unsigned long range_max;
+  unsigned long segment_hz;
+  signed   int i;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible ATV scan test commands:\n\
+status                            : configuration, tuners and channel list\n\
+tuners             <nb_fe>        : use the TER tuners of front-ends 0 to nb_fe-1 (0: the current front-end only)\n\
+config                            : set the scan range (sub_cmd '<M/PAL> <min_hz> <max_hz> <segment_hz>')\n\
+thresholds                        : set the thresholds (sub_cmd '<min_rssi_dBm> <max_rssi_dBm> <min_snr_half_dB> <max_snr_half_dB>')\n\
+run                               : scan all dirty segments (all segments after 'config'), returns the number of channels\n\
+rescan                            : re-scan a range (sub_cmd '<min_hz> <max_hz>'), returns the number of channels\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = scan->nb_channels;
+    SiLabs_ATV_Scan_Text(scan, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "tuners"             ) == 0) {
+    scan->nb_tuners = 0;
+    if (dval < 1) {
+      SiLabs_ATV_Scan_Add_Tuner(scan, front_end);
+    } else {
+      for (i=0; (i<(signed int)dval) && (i<FRONT_END_COUNT); i++) { SiLabs_ATV_Scan_Add_Tuner(scan, &(FrontEnd_Table[i])); }
+    }
+    *retdval = scan->nb_tuners;
+    SiLabs_ATV_Scan_Text(scan, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "config"             ) == 0) {
+    snprintf(family, sizeof(family), "M");
+    range_min  =  54000000;
+    range_max  = 216000000;
+    segment_hz = 0;
+    sscanf(sub_cmd, "%7s %lu %lu %lu", family, &range_min, &range_max, &segment_hz);
+    *retdval = SiLabs_ATV_Scan_Config(scan, (strcmp_nocase(family, "PAL") == 0) ? ATV_SCAN_FAMILY_PAL : ATV_SCAN_FAMILY_M, range_min, range_max, segment_hz);
+    SiLabs_ATV_Scan_Text(scan, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "thresholds"         ) == 0) {
+    min_rssi_dBm    = ATV_SCAN_MIN_RSSI_DBM;
+    max_rssi_dBm    = ATV_SCAN_MAX_RSSI_DBM;
+    min_snr_half_dB = ATV_SCAN_MIN_SNR_HALF_DB;
+    max_snr_half_dB = ATV_SCAN_MAX_SNR_HALF_DB;
+    sscanf(sub_cmd, "%d %d %d %d", &min_rssi_dBm, &max_rssi_dBm, &min_snr_half_dB, &max_snr_half_dB);
+    *retdval = SiLabs_ATV_Scan_Thresholds(scan, min_rssi_dBm, max_rssi_dBm, min_snr_half_dB, max_snr_half_dB);
+    SiLabs_ATV_Scan_Text(scan, *rettxt, 1000);
+    return 1;
+  }
+  else if ( (strcmp_nocase(cmd, "run"              ) == 0) || (strcmp_nocase(cmd, "rescan") == 0) ) {
+    if (scan->nb_tuners == 0) { SiLabs_ATV_Scan_Add_Tuner(scan, front_end); }
+    if (strcmp_nocase(cmd, "rescan") == 0) {
+      range_min = scan->range_min;
+      range_max = scan->range_max;
+      sscanf(sub_cmd, "%lu %lu", &range_min, &range_max);
+      SiLabs_ATV_Scan_Rescan(scan, range_min, range_max);
+    }
+    *retdval = SiLabs_ATV_Scan_Run(scan);
+    SiLabs_ATV_Scan_Text(scan, *rettxt, 1000);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ATV_PARALLEL_SCAN */
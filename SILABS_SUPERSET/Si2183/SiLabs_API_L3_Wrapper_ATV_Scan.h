@@ -0,0 +1,147 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_ATV_Scan_H_
+#define  _SiLabs_API_L3_Wrapper_ATV_Scan_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[ATV/scan] Adding a multi-tuner ATV scan coordinator via SiLabs_API_L3_Wrapper_ATV_Scan.c/.h
+        The scan range is split in segments scanned in parallel by all analog-capable TER tuners, with a merged channel list.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ATV_SCAN_MAX_TUNERS        FRONT_END_COUNT
+#define ATV_SCAN_MAX_SEGMENTS             64  /* the segment width is increased if the range needs more segments    */
+#define ATV_SCAN_MAX_CHANNELS            128
+#define ATV_SCAN_SEGMENT_HZ         16000000  /* Default segment width, small enough to balance the tuners' load   */
+#define ATV_SCAN_STEP_HZ             1000000  /* step used when no channel is found, as in the tuner-level scans   */
+#define ATV_SCAN_TUNINT_TIMEOUT_MS        36  /* TUNINT  timeout, as in SiXXXX_Tune                                */
+#define ATV_SCAN_ATVINT_TIMEOUT_MS       110  /* ATVINT  timeout, as in SiXXXX_Tune                                */
+#define ATV_SCAN_SETTLE_MS                 5  /* delay between a tune and the first status check of the tuner      */
+#define ATV_SCAN_POLL_MS                   5  /* delay between 2 status checks of the same tuner                   */
+#define ATV_SCAN_VHF_MAX_HZ        300000000  /* B below, G/H above (PAL scan)                                     */
+#define ATV_SCAN_SAME_CHANNEL_HZ     3000000  /* channels closer than this are merged (found from 2 segments)     */
+#define ATV_SCAN_MIN_RSSI_DBM            -70  /* Default thresholds, identical to the tuners' property defaults     */
+#define ATV_SCAN_MAX_RSSI_DBM              0
+#define ATV_SCAN_MIN_SNR_HALF_DB          25
+#define ATV_SCAN_MAX_SNR_HALF_DB          45
+
+/* possible values for the scan family */
+typedef enum  _SILABS_ATV_Scan_Family             {
+  ATV_SCAN_FAMILY_M   = 0, /* system M with NTSC color, as SiLabs_ATV_Channel_Scan_M                           */
+  ATV_SCAN_FAMILY_PAL = 1  /* systems B/GH (PAL) then L (SECAM) on each step, as SiLabs_ATV_Channel_Scan_PAL     */
+} SILABS_ATV_Scan_Family;
+
+/* possible values for the segment states */
+typedef enum  _SILABS_ATV_Scan_Segment_State      {
+  ATV_SCAN_SEGMENT_CLEAN    = 0, /* scanned, its channels are in the channel list                                 */
+  ATV_SCAN_SEGMENT_DIRTY    = 1, /* to be scanned                                                                 */
+  ATV_SCAN_SEGMENT_SCANNING = 2, /* being scanned by a tuner                                                      */
+  ATV_SCAN_SEGMENT_RESCAN   = 3  /* being scanned, and to be scanned again once done                              */
+} SILABS_ATV_Scan_Segment_State;
+
+/* possible values for the tuner states */
+typedef enum  _SILABS_ATV_Scan_Tuner_State        {
+  ATV_SCAN_TUNER_IDLE       = 0,
+  ATV_SCAN_TUNER_TUNINT     = 1, /* waiting for TUNINT                                                            */
+  ATV_SCAN_TUNER_ATVINT     = 2, /* waiting for ATVINT                                                            */
+  ATV_SCAN_TUNER_DISABLED   = 3  /* not ATV capable, or removed after an i2c error                                */
+} SILABS_ATV_Scan_Tuner_State;
+
+/* Structure used to store one analog channel */
+typedef struct _SILABS_ATV_Channel                {
+  unsigned long                 freq;            /* picture carrier frequency (Hz), including the AFC offset        */
+  signed   int                  afc_khz;
+  unsigned char                 video_sys;       /* SILABS_VIDEO_SYS_xx                                             */
+  unsigned char                 color;           /* SILABS_COLOR_xx                                                 */
+  unsigned int                  sound_khz;       /* main sound carrier offset from the picture carrier (kHz)        */
+  unsigned char                 tuner;           /* index of the tuner which found the channel                      */
+} SILABS_ATV_Channel;
+
+/* Structure used to store one segment of the scan range */
+typedef struct _SILABS_ATV_Scan_Segment           {
+  unsigned long                 min_hz;          /* scanned from min_hz (included) to max_hz (excluded)            */
+  unsigned long                 max_hz;
+  unsigned char                 state;           /* SILABS_ATV_Scan_Segment_State                                   */
+  unsigned int                  scans;
+} SILABS_ATV_Scan_Segment;
+
+/* Structure used to store the scan state of one tuner */
+typedef struct _SILABS_ATV_Scan_Tuner             {
+  SILABS_FE_Context            *front_end;
+  unsigned char                 state;           /* SILABS_ATV_Scan_Tuner_State                                     */
+  signed   int                  segment;         /* segment being scanned, -1 if none                              */
+  unsigned long                 freq;            /* frequency currently tuned                                       */
+  signed   int                  system;          /* L1_RF_TER_TUNER_ATV_SCAN_xx currently tried                     */
+  signed   int                  start_ms;        /* start of the current TUNINT or ATVINT wait                      */
+  signed   int                  next_check_ms;   /* the tuner status is not read before this time                   */
+  unsigned int                  tunes;
+  unsigned int                  channels;
+  unsigned int                  segments;
+} SILABS_ATV_Scan_Tuner;
+
+/* Structure used to store the ATV scan coordinator */
+typedef struct _SILABS_ATV_Scan                   {
+  signed   int                  family;          /* SILABS_ATV_Scan_Family                                          */
+  unsigned long                 range_min;
+  unsigned long                 range_max;
+  unsigned long                 segment_hz;
+  signed   int                  min_rssi_dBm;
+  signed   int                  max_rssi_dBm;
+  signed   int                  min_snr_half_dB;
+  signed   int                  max_snr_half_dB;
+  signed   int                  running;
+  signed   int                  start_ms;
+  signed   int                  next_check_ms;   /* earliest next_check_ms of the scanning tuners                   */
+  signed   int                  scan_ms;         /* duration of the last scan (complete or incremental)            */
+  unsigned int                  tunes;           /* number of tunes of the last scan                                */
+  signed   int                  nb_tuners;
+  SILABS_ATV_Scan_Tuner         tuner[ATV_SCAN_MAX_TUNERS];
+  signed   int                  nb_segments;
+  SILABS_ATV_Scan_Segment       segment[ATV_SCAN_MAX_SEGMENTS];
+  signed   int                  nb_channels;
+  SILABS_ATV_Channel            channel[ATV_SCAN_MAX_CHANNELS];
+} SILABS_ATV_Scan;
+
+extern SILABS_ATV_Scan  ATV_Scan_Context;
+
+signed   int   SiLabs_ATV_Scan_Init                    (SILABS_ATV_Scan *scan);
+signed   int   SiLabs_ATV_Scan_Add_Tuner               (SILABS_ATV_Scan *scan, SILABS_FE_Context *front_end);
+signed   int   SiLabs_ATV_Scan_Config                  (SILABS_ATV_Scan *scan, signed   int family, unsigned long range_min, unsigned long range_max, unsigned long segment_hz);
+signed   int   SiLabs_ATV_Scan_Thresholds              (SILABS_ATV_Scan *scan, signed   int min_rssi_dBm, signed   int max_rssi_dBm, signed   int min_snr_half_dB, signed   int max_snr_half_dB);
+signed   int   SiLabs_ATV_Scan_Rescan                  (SILABS_ATV_Scan *scan, unsigned long min_hz, unsigned long max_hz);
+signed   int   SiLabs_ATV_Scan_Start                   (SILABS_ATV_Scan *scan);
+signed   int   SiLabs_ATV_Scan_Process                 (SILABS_ATV_Scan *scan);
+signed   int   SiLabs_ATV_Scan_Abort                   (SILABS_ATV_Scan *scan);
+signed   int   SiLabs_ATV_Scan_Run                     (SILABS_ATV_Scan *scan);
+signed   int   SiLabs_ATV_Scan_Sound_kHz               (signed   int video_sys);
+const char    *SiLabs_ATV_Scan_Video_Sys_Text          (signed   int video_sys);
+signed   int   SiLabs_ATV_Scan_Text                    (SILABS_ATV_Scan *scan, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_ATV_Scan_Test                    (SILABS_ATV_Scan *scan, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_ATV_Scan_H_ */
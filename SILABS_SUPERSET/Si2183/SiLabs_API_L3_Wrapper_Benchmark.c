@@ -0,0 +1,2615 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Benchmark Functions                                           */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains an emulator-backed benchmark of the most common front-end operations         */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ The benchmark runs the actual L1/L2/L3 code on emulated chips, using the L0 SIMU connection:
+  - each demodulator and each TER tuner is emulated as a command-mode chip (CTS polling, PART_INFO, GET_REV,
+     firmware download, SET_PROPERTY, DD_RESTART, DD_STATUS, standard status, SCAN_CTRL/SCAN_STATUS),
+  - register-based parts (SAT tuners, LNB controllers) use the SIMU Byte[] memory,
+     except in the 'discovery' scenario, where they are emulated to check their i2c ack,
+  - in the 'discovery' scenario, the parts behind a demodulator only answer when its i2c pass-through is closed,
+     and several parts behind different demodulators can use the same address,
+  - the bus latency is emulated with L0_SimulatorLatency (per transaction and per byte).
+
+ Scenarios:
+  cold_boot    : SW init and first switch_to_standard (including firmware downloads) of N front-ends
+  switch       : switch_to_standard between all compiled standards
+  switch_matrix: switch_to_standard for each (from, to) pair of compiled standards (and ANALOG and SLEEP), with the
+                  duration, actions and skipped steps of each transition traced as a matrix
+  zap          : lock_to_carrier on successive frequencies, for each compiled standard
+  blindscan    : DVB-S2 blindscan over 1 GHz, with emulated carriers every 47 MHz
+  status_poll  : 1 Hz status polling of 16 front-ends (limited to FRONT_END_COUNT)
+  plp_hop      : PLP changes on a multiple PLP DVB-T2 multiplex using SiLabs_PLP_Hop          (with PLP_DIRECTORY)
+  plp_relock   : the same PLP changes using SiLabs_API_lock_to_carrier, for comparison       (with PLP_DIRECTORY)
+  isi_switch   : ISI changes on a multistream DVB-S2 transponder using SiLabs_Stream_Switch   (with STREAM_DIRECTORY and DEMOD_DVB_S_S2_DSS)
+  isi_relock   : the same ISI changes using SiLabs_API_lock_to_carrier, for comparison       (with STREAM_DIRECTORY and DEMOD_DVB_S_S2_DSS)
+  spi_boot     : same as cold_boot, with SPI firmware downloads on a spidev mock             (with LINUX_SPIDEV_Capability)
+  warm_restart : application restart on running parts, attaching to the running firmware    (with WARM_ATTACH)
+                  'warm_restart' reads all properties, 'warm_snapshot' uses the saved property values
+  power_predict: zap sequence over 4 front-ends managed by the power manager, with pre-warming (with POWER_MANAGER)
+  power_demand : the same zap sequence, with wake-up on demand only, for comparison           (with POWER_MANAGER)
+  ter_scan     : DVB-T2 channel scan over the UHF band by steps of 8 MHz, with a few emulated channels
+  ter_prescan  : the same channel scan, with the RSSI pre-screen                             (with RSSI_PRESCREEN)
+  lock_fixed   : DVB-S2 zaps on frequencies without signal, with the default lock timeout
+  lock_adapt   : the same zaps, with the lock timeout learned from previous locks    (with ADAPTIVE_LOCK_TIMEOUT)
+  status_text  : text rendering of the status of 16 front-ends with SiLabs_API_Text_status_selection (no i2c traffic)
+  status_export: binary export of the same statuses with SiLabs_Status_Export       (with STATUS_EXPORT)
+  status_print : binary export and text rendering with SiLabs_Status_Export_Print   (with STATUS_EXPORT)
+  atv_scan     : ATV system M scan from 54 to 126 MHz with SiLabs_ATV_Channel_Scan_M on one Si2157 (with TER_TUNER_Si2157)
+  atv_parallel : the same scan with the ATV scan coordinator on 4 Si2157    (with TER_TUNER_Si2157 and ATV_PARALLEL_SCAN)
+  atv_rescan   : incremental re-scan of 80 to 90 MHz after a channel change  (with TER_TUNER_Si2157 and ATV_PARALLEL_SCAN)
+  vco_zap      : DVB-T zaps on 8 front-ends in turn, with VCO blocking between the TER tuners
+  registry     : 128 front-ends in a front-end registry (16 boards of 8 on 8 i2c buses), with handle lookups,
+                  grouping and indirect TER tuner i2c connections                      (with FRONTEND_REGISTRY and INDIRECT_I2C_CONNECTION)
+  discovery    : discovery of a board with 3 demodulators and their TER tuners, SAT tuners and LNB controllers,
+                  with a part never reporting CTS                                        (with HW_DISCOVERY)
+  ts_route     : random reroutes of 8 front-ends (4 duals) over 6 TS ports, including shared buses,
+                  checking that the other front-ends are not accessed                    (with TS_CROSSBAR)
+  bonding_failover: bonding supervisor on 3 front-ends, with the signal of each leg fading in turn,
+                  checking the failover, the recovery and that healthy legs are not restarted (with CHANNEL_BONDING)
+  ts_clock     : adaptive TS clocks on 8 front-ends with varying TS bitrates, checking that the clock is always
+                  sufficient and only changes after multiplex rate changes              (with ADAPTIVE_TS_CLOCK)
+  extended_status: per-layer/per-PLP status of 6 front-ends on 3-layer ISDB-T, hierarchical DVB-T and 8-PLP DVB-T2
+                  signals, comparing the i2c cost of the extended status with the existing calls (with EXTENDED_STATUS)
+
+ Each scenario returns one JSON line, with the wall time, the CPU time, the time spent busy-waiting in system_wait,
+  the number of i2c transactions and bytes, the emulated bus time, the number of commands and of CTS polls
+  and the number of firmware bytes.
+  As system_wait is a busy loop, (cpu_ms - wait_ms) is the SW cost.
+
+ Build options:
+  SILABS_BENCHMARK      : compiles this file
+  FRONT_END_COUNT=16    : allows the 16 front-end status_poll scenario
+  SILABS_BENCHMARK_MAIN : adds a standalone 'main' (to link without the console application)
+  BENCHMARK_TER_TUNER   : selects the emulated TER tuner (0x2141 or 0x2157)
+
+ Standalone use:
+    benchmark [-latency <transaction_us> <byte_us>] [-fe <nb_front_ends>] [scenario ...]
+
+ Test pipe use (with the console application):
+    benchmark all
+    benchmark latency 0 (sub_cmd '<transaction_us> <byte_us>')
+    benchmark cold_boot 4
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[SIMU/benchmark] Initial version of the emulator-backed benchmark
+   <new_feature>[T2/MPLP] Emulating DVBT2_PLP_SELECT, DVBT2_PLP_INFO and the num_plp/plp_id fields of DVBT2_STATUS.
+     Adding 'plp_hop' and 'plp_relock' scenarios when PLP_DIRECTORY is defined.
+   <new_feature>[S2X/MULTISTREAM] Emulating DVBS2_STREAM_SELECT, DVBS2_STREAM_INFO and the sis_mis/num_is/isi_id fields of DVBS2_STATUS.
+     Adding 'isi_switch' and 'isi_relock' scenarios when STREAM_DIRECTORY and DEMOD_DVB_S_S2_DSS are defined.
+   <new_feature>[SPI/spidev] Adding a user-space spidev mock and the 'spi_boot' scenario when LINUX_SPIDEV_Capability is defined.
+   <new_feature>[INIT/Warm_attach] Emulating GET_PROPERTY (SET_PROPERTY values are stored, defaults after POWER_UP).
+     Adding SiLabs_Benchmark_FE_Init, to SW init one front-end without re-creating the emulated chips.
+     Adding 'warm_restart' and 'warm_snapshot' scenarios when WARM_ATTACH is defined.
+   <new_feature>[power_consumption/Power_manager] Emulating POWER_DOWN and POWER_UP in 'resume' mode (no firmware download).
+     Adding 'power_predict' and 'power_demand' scenarios when POWER_MANAGER is defined.
+   <new_feature>[scan/not_blind] Emulating TUNER_TUNE_FREQ and TUNER_STATUS (RSSI) in the TER tuners, and the 'no signal'
+     decision of the demodulators on empty TER channels.
+     Adding the 'ter_scan' scenario, and the 'ter_prescan' scenario when RSSI_PRESCREEN is defined.
+   <new_feature>[lock/adaptive_timeout] Emulating a lock time spread (lock_jitter_ms) and DD_RESTARTs without signal.
+     Adding the 'lock_fixed' scenario, and the 'lock_adapt' scenario when ADAPTIVE_LOCK_TIMEOUT is defined.
+   <new_feature>[Status/Export] Adding the 'status_text' scenario, and the 'status_export' and 'status_print' scenarios
+     when STATUS_EXPORT is defined.
+   <new_feature>[ATV/scan] Emulating analog channels in the TER tuners: ATV TUNER_TUNE_FREQ, ATV_VIDEO_MODE, ATVINT and ATV_STATUS.
+     Adding the 'atv_scan' scenario when TER_TUNER_Si2157 is defined, and the 'atv_parallel' and 'atv_rescan' scenarios
+     when ATV_PARALLEL_SCAN is also defined.
+   <new_feature>[VCO_Blocking] Emulating the VCO code in TUNER_STATUS and the TUNER_BLOCKED_VCO/VCO2/VCO3 properties in the TER tuners.
+     Adding the 'vco_zap' scenario.
+   <new_feature>[multi_front_end/registry] Adding SiLabs_Benchmark_FE_Attach, to SW init front-ends outside FrontEnd_Table.
+     Adding the 'registry' scenario when FRONTEND_REGISTRY is defined.
+   <new_feature>[INIT/discovery] Emulating the demodulators i2c pass-through (I2C_PASSTHROUGH), parts behind a pass-through
+     (with several parts at the same address behind different demodulators), register-based parts and absent parts.
+     Adding the 'discovery' scenario when HW_DISCOVERY is defined.
+   <new_feature>[switch/profiling] Adding the 'switch_matrix' scenario, using the Si2183 switch plan to count the skipped steps.
+   <new_feature>[TS_Crossbar/Router] Adding the 'ts_route' scenario when TS_CROSSBAR is defined.
+   <new_feature>[Channel_Bonding/Supervisor] Emulating signal fades (chip->fading) and adding the 'bonding_failover' scenario
+     when CHANNEL_BONDING is defined.
+   <new_feature>[TS/adaptive_clock] Emulating the TS bitrate (chip->ts_kbps) and the TS clock (from DD_TS_MODE/DD_TS_FREQ)
+     in DD_STATUS, and adding the 'ts_clock' scenario when ADAPTIVE_TS_CLOCK is defined.
+   <new_feature>[STATUS/extended] Emulating ISDB-T layers, hierarchical DVB-T, DVB-T2 PLP modulations and BER/PER/FER
+     (bench->layered), and adding the 'extended_status' scenario when EXTENDED_STATUS is defined.
+   <compatibility>[INIT/single_chip] Not compiling the ATV scan scenarios when SINGLE_CHIP_TER_TUNER selects a TER tuner other
+     than the Si2157 (these scenarios switch the TER tuners to the Si2157).
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   SILABS_BENCHMARK
+  "If you get a compilation error on this line, it means that you included the Benchmark code in your project without defining SILABS_BENCHMARK.";
+  "Please define SILABS_BENCHMARK at project-level, or remove the Benchmark code from your project";
+#endif /* SILABS_BENCHMARK */
+
+#ifdef    SILABS_BENCHMARK
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Benchmark "
+#include "SiLabs_API_L3_Wrapper_Benchmark.h"
+
+#ifndef   BENCHMARK_TER_TUNER
+  #ifdef    TER_TUNER_Si2141
+    #define BENCHMARK_TER_TUNER  0x2141
+  #else  /* TER_TUNER_Si2141 */
+    #define BENCHMARK_TER_TUNER  0x2157
+  #endif /* TER_TUNER_Si2141 */
+#endif /* BENCHMARK_TER_TUNER */
+
+#if       (BENCHMARK_TER_TUNER == 0x2141)
+  #define BENCHMARK_TER_PART       41
+  #define BENCHMARK_TER_ROMID    0x61
+#else  /* BENCHMARK_TER_TUNER */
+  #define BENCHMARK_TER_PART       57
+  #define BENCHMARK_TER_ROMID    0x50
+#endif /* BENCHMARK_TER_TUNER */
+
+#ifdef    TER_TUNER_Si2157
+  #ifdef    SINGLE_CHIP_TER_TUNER
+    #if       (SINGLE_CHIP_TER_TUNER == 0x2157)
+      #define BENCHMARK_ATV_TUNER  0x2157
+    #endif /* SINGLE_CHIP_TER_TUNER */
+  #else  /* SINGLE_CHIP_TER_TUNER */
+    #define BENCHMARK_ATV_TUNER  0x2157 /* TER tuner selected in the ATV scan scenarios (not with another SINGLE_CHIP_TER_TUNER) */
+  #endif /* SINGLE_CHIP_TER_TUNER */
+#endif /* TER_TUNER_Si2157 */
+
+#ifndef   BENCHMARK_SAT_TUNER
+  #ifdef    SAT_TUNER_AV2018
+    #define BENCHMARK_SAT_TUNER  0xA2018
+  #else  /* SAT_TUNER_AV2018 */
+    #define BENCHMARK_SAT_TUNER  0x5816
+  #endif /* SAT_TUNER_AV2018 */
+#endif /* BENCHMARK_SAT_TUNER */
+
+SILABS_Benchmark  Benchmark_Context;
+
+#ifdef    SILABS_BENCHMARK_MAIN
+SILABS_FE_Context FrontEnd_Table[FRONT_END_COUNT];
+#endif /* SILABS_BENCHMARK_MAIN */
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Status function
+  Use:      Emulated chip status update
+            Used to compute the lock state after DD_RESTART and to raise scanint when a scan event is ready
+  Returns:  1 if the emulated demodulator is locked
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Chip_Status            (SILABS_Benchmark_Chip *chip) {
+  if ( (chip->scan_event) && (system_time() >= chip->scan_ready_ms) ) { chip->scan_int = 1; }
+  if ( (chip->plp_ready_ms) && (system_time() >= chip->plp_ready_ms) ) { chip->plp_id = chip->plp_target; chip->plp_ready_ms = 0; }
+  if ( (chip->isi_ready_ms) && (system_time() >= chip->isi_ready_ms) ) { chip->isi_id = chip->isi_target; chip->isi_ready_ms = 0; }
+  if ( (chip->restart_ms == 0) || (chip->standby) || (chip->no_signal) || (chip->fading) ) { return 0; }
+  return (system_time() - chip->restart_ms >= chip->lock_after_ms);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Scan_Next function
+  Use:      Emulated blindscan sequencer
+            Used to prepare the next scan event after SCAN_CTRL START or RESUME:
+              DIGITAL_CHANNEL_FOUND for each carrier in the current tuner window,
+              TUNE_REQUEST to move to the next window, ENDED after scan_fmax.
+  Returns:  the next scan_status value
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Scan_Next              (SILABS_Benchmark_Chip *chip) {
+  SILABS_Benchmark *bench;
+  signed   int      i;
+  signed   int      next_khz;
+  bench = chip->bench;
+  chip->scan_int = 0;
+  if (chip->scan_tuned_khz) {
+    for (i=0; i<bench->nb_carriers; i++) {
+      if ( (bench->carrier_khz[i] >  chip->scan_found_khz)
+        && (bench->carrier_khz[i] >= chip->scan_tuned_khz - BENCHMARK_SCAN_WINDOW_KHZ/2)
+        && (bench->carrier_khz[i] <  chip->scan_tuned_khz + BENCHMARK_SCAN_WINDOW_KHZ/2)
+        && (bench->carrier_khz[i] <= chip->scan_fmax_khz) ) {
+        chip->scan_found_khz = chip->scan_freq_khz = bench->carrier_khz[i];
+        chip->scan_symb_rate = 27500;
+        chip->scan_ready_ms  = system_time() + bench->scan_ms;
+        return chip->scan_event = Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_DIGITAL_CHANNEL_FOUND;
+      }
+    }
+    next_khz = chip->scan_tuned_khz + BENCHMARK_SCAN_WINDOW_KHZ;
+  } else {
+    next_khz = chip->scan_found_khz + BENCHMARK_SCAN_WINDOW_KHZ/2;
+  }
+  chip->scan_ready_ms = system_time() + bench->scan_ms;
+  if (next_khz - BENCHMARK_SCAN_WINDOW_KHZ/2 > chip->scan_fmax_khz) {
+    return chip->scan_event = Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_ENDED;
+  }
+  chip->scan_tuned_khz = chip->scan_freq_khz = next_khz;
+  return chip->scan_event = Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_TUNE_REQUEST;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_TER_Signal function
+  Use:      Emulated TER channels
+            Used to know whether a TER frequency carries a signal (all frequencies do when no TER channel is emulated)
+  Returns:  1 if there is a signal at freq_hz, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_TER_Signal             (SILABS_Benchmark *bench, signed   int freq_hz) {
+  signed   int i;
+  if (bench->nb_ter_carriers == 0) { return 1; }
+  for (i=0; i<bench->nb_ter_carriers; i++) {
+    if ( (freq_hz > bench->ter_carrier_hz[i] - 4000000) && (freq_hz < bench->ter_carrier_hz[i] + 4000000) ) { return 1; }
+  }
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_ATV_Carrier function
+  Use:      Emulated analog channels
+            Used to know which analog channel is found by a TER tuner after an ATV TUNER_TUNE_FREQ.
+            The channel must be within the AFC range and use the modulation polarity of the video mode (positive in L/L').
+  Returns:  the index of the analog channel, -1 if none
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_ATV_Carrier            (SILABS_Benchmark_Chip *chip) {
+  SILABS_Benchmark *bench;
+  signed   int      positive;
+  signed   int      i;
+  bench    = chip->bench;
+  positive = (chip->atv_video_sys == SILABS_VIDEO_SYS_L) || (chip->atv_video_sys == SILABS_VIDEO_SYS_LP);
+  for (i=0; i<bench->nb_atv_carriers; i++) {
+    if ( ( (bench->atv_video_sys[i] == SILABS_VIDEO_SYS_L) || (bench->atv_video_sys[i] == SILABS_VIDEO_SYS_LP) ) != positive ) { continue; }
+    if ( (chip->tuned_hz >= bench->atv_carrier_hz[i] - BENCHMARK_ATV_AFC_HZ) && (chip->tuned_hz <= bench->atv_carrier_hz[i] + BENCHMARK_ATV_AFC_HZ) ) { return i; }
+  }
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_VCO_Code function
+  Use:      Emulated TER tuner VCO code
+            Used to return a VCO code depending on the tuned frequency (one code per MHz)
+  Returns:  the VCO code of the emulated TER tuner, 0 if not tuned
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_VCO_Code               (SILABS_Benchmark_Chip *chip) {
+  return (chip->tuned_hz/1000000) & 0x7fff;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Find function
+  Use:      Emulated chip retrieval
+  Returns:  a pointer to the emulated chip at the given address, NULL if none
+************************************************************************************************************************/
+SILABS_Benchmark_Chip *SiLabs_Benchmark_Chip_Find      (SILABS_Benchmark *bench, unsigned char address) {
+  signed   int i;
+  for (i=0; i<bench->nb_chips; i++) {
+    if (bench->chip[i].address == address) { return &(bench->chip[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Behind function
+  Use:      Emulated chip selection
+            Used to find the emulated chip answering at the address of the given chip:
+             chips on the bus always answer, chips behind a demodulator only answer when its i2c pass-through is closed.
+  Returns:  a pointer to the emulated chip answering, NULL if none (NACK)
+************************************************************************************************************************/
+SILABS_Benchmark_Chip *SiLabs_Benchmark_Chip_Behind    (SILABS_Benchmark_Chip *chip) {
+  SILABS_Benchmark *bench;
+  signed   int      i;
+  if (chip->kind == BENCHMARK_CHIP_ABSENT) { return NULL; }
+  if (chip->parent == NULL) { return chip; }
+  bench = chip->bench;
+  for (i=0; i<bench->nb_chips; i++) {
+    if ( (bench->chip[i].address == chip->address) && (bench->chip[i].parent != NULL) && (bench->chip[i].parent->passthru) ) { return &(bench->chip[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Write function
+  Use:      Emulated command-mode chip, command reception (L0_SIMU_WRITE_FUNC)
+            Used to decode the command and prepare the corresponding response
+            Between POWER_UP and EXIT_BOOTLOADER, all writes except the short bootloader commands
+             (EXIT_BOOTLOADER, PART_INFO, GET_REV, POWER_UP) are firmware lines.
+  Returns:  the number of bytes written
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Chip_Write             (void *device, unsigned char address, signed   int indexSize, unsigned char *index, signed   int iNbBytes, unsigned char *pucDataBuffer) {
+  SILABS_Benchmark_Chip *chip;
+  SILABS_Benchmark_Chip *tuner;
+  SILABS_Benchmark_Chip *other;
+  unsigned int           prop;
+  unsigned int           data;
+  signed   int           value;
+  signed   int           locked;
+  signed   int           ts_rate;
+  signed   int           ts_clk;
+  signed   int           i;
+  chip      = (SILABS_Benchmark_Chip*)device;
+  address   = address;   /* To avoid compiler warning */
+  indexSize = indexSize; /* To avoid compiler warning */
+  index     = index;     /* To avoid compiler warning */
+  if (iNbBytes <= 0) { return iNbBytes; }
+  if ((chip = SiLabs_Benchmark_Chip_Behind(chip)) == NULL) { return 0; }
+  if (chip->kind == BENCHMARK_CHIP_REGISTER) { chip->commands++; return iNbBytes; }
+  memset(chip->response, 0, BENCHMARK_RESPONSE_SIZE);
+  chip->busy = chip->bench->busy_polls;
+  chip->commands++;
+  if ( (chip->booting) && ( (iNbBytes >= 8) || ( (pucDataBuffer[0] != 0x01) && (pucDataBuffer[0] != 0x02) && (pucDataBuffer[0] != 0x11) && (pucDataBuffer[0] != 0xc0) ) ) ) {
+    chip->fw_bytes += iNbBytes;
+    return iNbBytes;
+  }
+  locked = SiLabs_Benchmark_Chip_Status(chip);
+  switch (pucDataBuffer[0]) {
+    case 0x01: { /* EXIT_BOOTLOADER */
+      chip->booting = 0;
+      break;
+    }
+    case 0x02: { /* PART_INFO */
+      memcpy(&(chip->response[1]), &(chip->part_info[1]), 12);
+      break;
+    }
+    case 0x11: { /* GET_REV   */
+      memcpy(&(chip->response[1]), &(chip->get_rev[1]), 9);
+      break;
+    }
+    case 0xc0: { /* POWER_UP (demodulator), RESET_HW/POWER_UP/WAKE_UP (tuner), other 0xc0 commands use other subcodes */
+      if (iNbBytes < 2) { break; }
+      if ( (chip->kind == BENCHMARK_CHIP_TUNER) && (pucDataBuffer[1] == 0x05) ) { chip->reset = 1; break; }
+      if ( (chip->kind == BENCHMARK_CHIP_DEMOD) && (pucDataBuffer[1] == Si2183_I2C_PASSTHROUGH_CMD_SUBCODE_CODE) && (iNbBytes > 2) ) {
+        chip->passthru = pucDataBuffer[2] & 0x01;
+      }
+      chip->reset   = 0;
+      chip->standby = 0;
+      if ( (chip->kind == BENCHMARK_CHIP_DEMOD) && (pucDataBuffer[1] == Si2183_POWER_UP_CMD_SUBCODE_CODE) && (iNbBytes > 2) && (pucDataBuffer[2] == Si2183_POWER_UP_CMD_RESET_RESUME) ) {
+        chip->restart_ms = 0; /* the firmware is resumed, a DD_RESTART is required to lock */
+        break;
+      }
+      if ( (pucDataBuffer[1] == Si2183_POWER_UP_CMD_SUBCODE_CODE) || (pucDataBuffer[1] == 0x08) ) {
+        chip->booting    = 1;
+        chip->restart_ms = 0;
+        chip->scan_event = 0;
+        chip->plp_id     = chip->plp_target = chip->plp_ready_ms = 0;
+        chip->isi_id     = chip->isi_target = chip->isi_ready_ms = 0;
+        Si2183_storePropertiesDefaults(&(chip->prop));
+        chip->modulation  = chip->prop.dd_mode.modulation;  /* DD_MODE default, not sent by the host until changed */
+        chip->auto_detect = chip->prop.dd_mode.auto_detect;
+      }
+      break;
+    }
+    default: {
+      if (chip->kind == BENCHMARK_CHIP_TUNER) {
+        if ( (pucDataBuffer[0] == 0x41) && (iNbBytes >= 8) ) { /* TUNER_TUNE_FREQ, counting the VCO codes of the other tuners blocked at tune time */
+          chip->tuned_hz    = pucDataBuffer[4] + (pucDataBuffer[5]<<8) + (pucDataBuffer[6]<<16) + (pucDataBuffer[7]<<24);
+          chip->atv_tuned   = (pucDataBuffer[1] == 0x01); /* mode ATV */
+          chip->atv_tune_ms = system_time();
+          for (i=0; i<chip->bench->nb_chips; i++) {
+            other = &(chip->bench->chip[i]);
+            if ( (other == chip) || (other->kind != BENCHMARK_CHIP_TUNER) || (other->tuned_hz == 0) ) { continue; }
+            value = SiLabs_Benchmark_VCO_Code(other);
+            chip->bench->vco_others++;
+            if ( (chip->blocked_vco[0] == value) || (chip->blocked_vco[1] == value) || (chip->blocked_vco[2] == value) ) { chip->bench->vco_blocked++; }
+          }
+        }
+        if ( (pucDataBuffer[0] == 0x14) && (iNbBytes >= 6) ) { /* SET_PROPERTY, only ATV_VIDEO_MODE and TUNER_BLOCKED_VCO/VCO2/VCO3 are used */
+          prop = pucDataBuffer[2] + (pucDataBuffer[3]<<8);
+          data = pucDataBuffer[4] + (pucDataBuffer[5]<<8);
+          if (prop == 0x0604) {
+            chip->atv_video_sys = data & 0x07;
+            chip->atv_color     = (data >> 4) & 0x01;
+          }
+          if (prop == 0x0504) { chip->blocked_vco[0] = data; }
+          if (prop == 0x0508) { chip->blocked_vco[1] = data; }
+          if (prop == 0x0509) { chip->blocked_vco[2] = data; }
+        }
+        if (pucDataBuffer[0] == 0x52) { /* ATV_STATUS, with the AFC offset of the channel found */
+          value = chip->atv_tuned ? SiLabs_Benchmark_ATV_Carrier(chip) : -1;
+          if (value >= 0) {
+            value = (chip->bench->atv_carrier_hz[value] - chip->tuned_hz)/1000;
+            chip->response[2] = 0x01; /* CHL */
+            chip->response[4] = (unsigned char)( value       & 0xff);
+            chip->response[5] = (unsigned char)((value >> 8) & 0xff);
+          }
+          chip->response[8] = (unsigned char)(chip->atv_video_sys | (chip->atv_color << 4));
+          if ( (iNbBytes >= 2) && (pucDataBuffer[1] & 0x01) ) { chip->atv_tuned = 0; } /* INTACK */
+        }
+        if (pucDataBuffer[0] == 0x42) { /* TUNER_STATUS, with a small RSSI variation on empty channels and a VCO code depending on the frequency */
+          value = SiLabs_Benchmark_TER_Signal(chip->bench, chip->tuned_hz) ? BENCHMARK_TER_RSSI_DBM : BENCHMARK_TER_FLOOR_DBM + (chip->tuned_hz/1000000)%4;
+          chip->response[3] = (unsigned char)(value & 0xff);
+          chip->response[4] = (unsigned char)( chip->tuned_hz        & 0xff);
+          chip->response[5] = (unsigned char)((chip->tuned_hz >>  8) & 0xff);
+          chip->response[6] = (unsigned char)((chip->tuned_hz >> 16) & 0xff);
+          chip->response[7] = (unsigned char)((chip->tuned_hz >> 24) & 0xff);
+          value = SiLabs_Benchmark_VCO_Code(chip);
+          chip->response[10]= (unsigned char)( value       & 0xff);
+          chip->response[11]= (unsigned char)((value >> 8) & 0xff);
+        }
+        break;
+      }
+      switch (pucDataBuffer[0]) {
+        case 0x14: { /* SET_PROPERTY */
+          if (iNbBytes < 6) { break; }
+          prop = pucDataBuffer[2] + (pucDataBuffer[3]<<8);
+          data = pucDataBuffer[4] + (pucDataBuffer[5]<<8);
+          if (prop == Si2183_DD_MODE_PROP_CODE ) {
+            chip->modulation  = (data >> Si2183_DD_MODE_PROP_MODULATION_LSB ) & Si2183_DD_MODE_PROP_MODULATION_MASK;
+            chip->auto_detect = (data >> Si2183_DD_MODE_PROP_AUTO_DETECT_LSB) & Si2183_DD_MODE_PROP_AUTO_DETECT_MASK;
+          }
+          if (prop == Si2183_SCAN_FMAX_PROP_CODE) {
+            chip->scan_fmax_khz = (signed int)(((unsigned long)data*65536)/1000);
+          }
+          Si2183_UnpackProperty(&(chip->prop), prop, (signed int)data);
+          break;
+        }
+        case 0x15: { /* GET_PROPERTY */
+          if (iNbBytes < 4) { break; }
+          prop  = pucDataBuffer[2] + (pucDataBuffer[3]<<8);
+          value = 0;
+          if (Si2183_PackProperty(&(chip->prop), prop, &value) != NO_Si2183_ERROR) { chip->response[0] = 0x40; break; } /* ERR */
+          chip->response[2] = (unsigned char)( value     & 0xff);
+          chip->response[3] = (unsigned char)((value>>8) & 0xff);
+          break;
+        }
+        case 0x13: { /* POWER_DOWN */
+          chip->standby    = 1;
+          chip->restart_ms = 0;
+          break;
+        }
+        case 0x85: { /* DD_RESTART */
+          tuner              = SiLabs_Benchmark_Chip_Find(chip->bench, (unsigned char)(BENCHMARK_TER_ADDRESS + chip->address - BENCHMARK_DEMOD_ADDRESS));
+          chip->no_signal    = (tuner != NULL) && (SiLabs_Benchmark_TER_Signal(chip->bench, tuner->tuned_hz) == 0);
+          chip->no_signal    = chip->no_signal | chip->bench->no_signal;
+          chip->lock_after_ms = chip->bench->lock_ms;
+          if (chip->bench->lock_jitter_ms > 0) {
+            chip->bench->seed   = chip->bench->seed*1103515245 + 12345;
+            chip->lock_after_ms = chip->lock_after_ms + (signed int)((chip->bench->seed >> 16) % (chip->bench->lock_jitter_ms + 1));
+          }
+          chip->restart_ms   = system_time();
+          chip->plp_id       = chip->plp_target;
+          chip->plp_ready_ms = 0;
+          chip->isi_id       = chip->isi_target;
+          chip->isi_ready_ms = 0;
+          break;
+        }
+        case 0x87: { /* DD_STATUS */
+          chip->response[1] = locked ? 0x06 : 0x00;
+          chip->response[2] = locked ? 0x06 : 0x00;
+          if ( (chip->no_signal) && (chip->restart_ms) && (system_time() - chip->restart_ms >= BENCHMARK_NO_SIGNAL_MS) ) {
+            chip->response[2] = 0x20; /* rsqstat_bit5: 'no signal' decision */
+          }
+          if (chip->modulation == Si2183_DD_MODE_PROP_MODULATION_AUTO_DETECT) {
+            if (chip->auto_detect == Si2183_DD_MODE_PROP_AUTO_DETECT_AUTO_DVB_T_T2) {
+              chip->response[3] = Si2183_DD_MODE_PROP_MODULATION_DVBT2;
+            } else {
+              chip->response[3] = Si2183_DD_MODE_PROP_MODULATION_DVBS2;
+            }
+          } else {
+            chip->response[3] = chip->modulation;
+          }
+          ts_rate = chip->ts_kbps ? chip->ts_kbps/10 : 0x0f10;
+          ts_clk  = 0x1388;
+          if (chip->prop.dd_ts_mode.clock == Si2183_DD_TS_MODE_PROP_CLOCK_MANUAL    ) { ts_clk = chip->prop.dd_ts_freq.req_freq_10khz; }
+          if (chip->prop.dd_ts_mode.clock == Si2183_DD_TS_MODE_PROP_CLOCK_AUTO_ADAPT) {
+            ts_clk = (chip->prop.dd_ts_mode.mode == Si2183_DD_TS_MODE_PROP_MODE_PARALLEL) ? (ts_rate + 7)/8 : ts_rate;
+          }
+          chip->response[4] = locked ? (unsigned char)( ts_rate       & 0xff) : 0x00; /* ts_bit_rate (10 kbps unit) */
+          chip->response[5] = locked ? (unsigned char)((ts_rate >> 8) & 0xff) : 0x00;
+          chip->response[6] = locked ? (unsigned char)( ts_clk        & 0xff) : 0x00; /* ts_clk_freq (10 kHz unit)  */
+          chip->response[7] = locked ? (unsigned char)((ts_clk  >> 8) & 0xff) : 0x00;
+          break;
+        }
+        case 0x50:   /* DVBT2_STATUS */
+        case 0x60:   /* DVBS_STATUS  */
+        case 0x70:   /* DVBS2_STATUS */
+        case 0x90:   /* DVBC_STATUS  */
+        case 0x98:   /* MCNS_STATUS  */
+        case 0xa0:   /* DVBT_STATUS  */
+        case 0xa4: { /* ISDBT_STATUS */
+          chip->response[2] = locked ? 0x06 : 0x00;
+          chip->response[3] = locked ? 80   : 0;    /* cnr: 20 dB */
+          if (pucDataBuffer[0] == 0x70) {
+            if (chip->bench->nb_isi) {
+              if (chip->isi_ready_ms) { chip->response[2] = locked ? 0x02 : 0x00; } /* dl is low while switching ISI */
+              chip->response[10] = (unsigned char)(Si2183_DVBS2_STATUS_RESPONSE_SIS_MIS_MIS << Si2183_DVBS2_STATUS_RESPONSE_SIS_MIS_LSB);
+              chip->response[11] = (unsigned char)chip->bench->nb_isi;
+              chip->response[12] = (unsigned char)chip->isi_id;
+            } else {
+              chip->response[10] = (unsigned char)(Si2183_DVBS2_STATUS_RESPONSE_SIS_MIS_SIS << Si2183_DVBS2_STATUS_RESPONSE_SIS_MIS_LSB);
+              chip->response[11] = 1;
+            }
+          }
+          if (pucDataBuffer[0] == 0x50) {
+            if (chip->plp_ready_ms) { chip->response[2] = locked ? 0x02 : 0x00; } /* dl is low while switching PLP */
+            chip->response[10] = (unsigned char)chip->bench->nb_plp;
+            chip->response[13] = (unsigned char)chip->plp_id;
+          }
+          if ( (pucDataBuffer[0] == 0xa0) && (chip->bench->layered) ) { /* hierarchical DVB-T: alpha 1, QAM64, HP 1/2, LP 3/4 */
+            chip->response[8]  = Si2183_DVBT_STATUS_RESPONSE_CONSTELLATION_QAM64;
+            chip->response[9]  = (unsigned char)( (Si2183_DVBT_STATUS_RESPONSE_RATE_HP_1_2 << Si2183_DVBT_STATUS_RESPONSE_RATE_HP_LSB)
+                                                + (Si2183_DVBT_STATUS_RESPONSE_RATE_LP_3_4 << Si2183_DVBT_STATUS_RESPONSE_RATE_LP_LSB) );
+            chip->response[11] = Si2183_DVBT_STATUS_RESPONSE_HIERARCHY_ALFA1;
+          }
+          if ( (pucDataBuffer[0] == 0xa4) && (chip->bench->layered) ) { /* ISDB-T: layer A 1 partial segment, layer B 7 segments, layer C 5 segments */
+            chip->response[9]  = (unsigned char)( (1 << Si2183_ISDBT_STATUS_RESPONSE_NB_SEG_A_LSB) + (7 << Si2183_ISDBT_STATUS_RESPONSE_NB_SEG_B_LSB) );
+            chip->response[10] = (unsigned char)( (5 << Si2183_ISDBT_STATUS_RESPONSE_NB_SEG_C_LSB) + (1 << Si2183_ISDBT_STATUS_RESPONSE_PARTIAL_FLAG_LSB) );
+            chip->response[13] = locked ? (unsigned char)( (1 << Si2183_ISDBT_STATUS_RESPONSE_DL_A_LSB) + (1 << Si2183_ISDBT_STATUS_RESPONSE_DL_B_LSB) + (1 << Si2183_ISDBT_STATUS_RESPONSE_DL_C_LSB) ) : 0x00;
+          }
+          break;
+        }
+        case 0xa5: { /* ISDBT_LAYER_INFO: A QPSK 2/3 il 2, B QAM64 3/4 il 2, C QAM16 1/2 il 1 */
+          if ( (iNbBytes < 2) || (!chip->bench->layered) ) { break; }
+          switch (pucDataBuffer[1]) {
+            case 0 : { chip->response[1] = (unsigned char)(Si2183_ISDBT_LAYER_INFO_RESPONSE_CONSTELLATION_QPSK  + (Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_2_3 << Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_LSB)); chip->response[2] = (unsigned char)(2 + (1 << Si2183_ISDBT_LAYER_INFO_RESPONSE_NB_SEG_LSB)); break; }
+            case 1 : { chip->response[1] = (unsigned char)(Si2183_ISDBT_LAYER_INFO_RESPONSE_CONSTELLATION_QAM64 + (Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_3_4 << Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_LSB)); chip->response[2] = (unsigned char)(2 + (7 << Si2183_ISDBT_LAYER_INFO_RESPONSE_NB_SEG_LSB)); break; }
+            default: { chip->response[1] = (unsigned char)(Si2183_ISDBT_LAYER_INFO_RESPONSE_CONSTELLATION_QAM16 + (Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_1_2 << Si2183_ISDBT_LAYER_INFO_RESPONSE_CODE_RATE_LSB)); chip->response[2] = (unsigned char)(1 + (5 << Si2183_ISDBT_LAYER_INFO_RESPONSE_NB_SEG_LSB)); break; }
+          }
+          break;
+        }
+        case 0x82:   /* DD_BER */
+        case 0x83:   /* DD_PER */
+        case 0x86: { /* DD_FER, the measurements are always complete when locked: 1.0e-7 BER, 1.0e-5 PER, 1.0e-4 FER */
+          if ( (!chip->bench->layered) || (!locked) ) { break; }
+          chip->response[1] = (unsigned char)((pucDataBuffer[0] == 0x82) ? 7 : (pucDataBuffer[0] == 0x83) ? 5 : 4);
+          chip->response[2] = 10;
+          break;
+        }
+        case 0x52: { /* DVBT2_PLP_SELECT, the emulated multiplex carries PLPs 0 to nb_plp-1 */
+          if (iNbBytes < 3) { break; }
+          chip->plp_target = (pucDataBuffer[2] & 0x01) ? pucDataBuffer[1] : 0;
+          if ( (chip->plp_target != chip->plp_id) && (chip->bench->nb_plp) ) { chip->plp_ready_ms = system_time() + chip->bench->plp_ms; }
+          break;
+        }
+        case 0x53: { /* DVBT2_PLP_INFO, data PLPs type 1 in group 1, the last PLP is the common PLP */
+          if ( (iNbBytes < 2) || (pucDataBuffer[1] >= chip->bench->nb_plp) ) { break; }
+          chip->response[1] = pucDataBuffer[1];
+          chip->response[2] = (unsigned char)( (((pucDataBuffer[1] == chip->bench->nb_plp - 1) ? Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON : Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_DATA_TYPE1) << Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_LSB)
+                                             + Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_PAYLOAD_TYPE_TS);
+          chip->response[5] = (unsigned char)(1 << Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_GROUP_ID_LSB_LSB);
+          if (chip->bench->layered) { /* 64K LDPC 3/4, QPSK, 16QAM, 64QAM and 256QAM for PLPs 0, 1, 2, 3, 4, ... */
+            chip->response[5] = (unsigned char)(chip->response[5] + (Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_COD_3_4 << Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_COD_LSB));
+            chip->response[6] = (unsigned char)( (Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_FEC_TYPE_64K_LDPC << Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_FEC_TYPE_LSB)
+                                               + ((pucDataBuffer[1] % 4) << Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_MOD_LSB_LSB) );
+          }
+          break;
+        }
+        case 0x71: { /* DVBS2_STREAM_SELECT, the emulated transponder carries ISIs BENCHMARK_ISI_BASE to BENCHMARK_ISI_BASE+nb_isi-1 */
+          if (iNbBytes < 3) { break; }
+          chip->isi_target = (pucDataBuffer[2] & 0x01) ? pucDataBuffer[1] : BENCHMARK_ISI_BASE;
+          if ( (chip->isi_target != chip->isi_id) && (chip->bench->nb_isi) ) { chip->isi_ready_ms = system_time() + chip->bench->isi_ms; }
+          break;
+        }
+        case 0x72: { /* DVBS2_STREAM_INFO, 8PSK 3/4 for all ISIs */
+          if ( (iNbBytes < 2) || (pucDataBuffer[1] >= chip->bench->nb_isi) ) { break; }
+          chip->response[1] = (unsigned char)(BENCHMARK_ISI_BASE + pucDataBuffer[1]);
+          chip->response[2] = Si2183_DVBS2_STREAM_INFO_RESPONSE_ISI_CONSTELLATION_8PSK;
+          chip->response[3] = Si2183_DVBS2_STREAM_INFO_RESPONSE_ISI_CODE_RATE_3_4;
+          break;
+        }
+        case 0x30: { /* SCAN_STATUS */
+          if ( (chip->scan_event) && (chip->scan_int) ) {
+            chip->response[1] = 0x02;
+            chip->response[3] = (unsigned char)chip->scan_event;
+            chip->response[4] = (unsigned char)( chip->scan_freq_khz       & 0xff);
+            chip->response[5] = (unsigned char)((chip->scan_freq_khz >> 8 ) & 0xff);
+            chip->response[6] = (unsigned char)((chip->scan_freq_khz >> 16) & 0xff);
+            chip->response[7] = (unsigned char)((chip->scan_freq_khz >> 24) & 0xff);
+            chip->response[8] = (unsigned char)( chip->scan_symb_rate       & 0xff);
+            chip->response[9] = (unsigned char)((chip->scan_symb_rate >> 8) & 0xff);
+            chip->response[10]= Si2183_DD_MODE_PROP_MODULATION_DVBS2;
+          } else {
+            chip->response[3] = chip->scan_event ? Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_SEARCHING : Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_IDLE;
+          }
+          if ( (iNbBytes > 1) && (pucDataBuffer[1] & 0x01) ) { chip->scan_int = 0; }
+          break;
+        }
+        case 0x31: { /* SCAN_CTRL */
+          if (iNbBytes < 8) { break; }
+          switch (pucDataBuffer[1] & Si2183_SCAN_CTRL_CMD_ACTION_MASK) {
+            case Si2183_SCAN_CTRL_CMD_ACTION_START : {
+              chip->scan_tuned_khz = 0;
+              chip->scan_found_khz = pucDataBuffer[4] + (pucDataBuffer[5]<<8) + (pucDataBuffer[6]<<16) + (pucDataBuffer[7]<<24);
+              SiLabs_Benchmark_Scan_Next(chip);
+              break;
+            }
+            case Si2183_SCAN_CTRL_CMD_ACTION_RESUME: {
+              if (chip->scan_event == Si2183_SCAN_STATUS_RESPONSE_SCAN_STATUS_ENDED) { break; }
+              SiLabs_Benchmark_Scan_Next(chip);
+              break;
+            }
+            default: {
+              chip->scan_event = 0;
+              chip->scan_int   = 0;
+              break;
+            }
+          }
+          break;
+        }
+        default: {
+          break;
+        }
+      }
+      break;
+    }
+  }
+  return iNbBytes;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Read function
+  Use:      Emulated command-mode chip, response reading (L0_SIMU_READ_FUNC)
+            The first bench->busy_polls reads following a command return 'not CTS'.
+  Returns:  the number of bytes read
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Chip_Read              (void *device, unsigned char address, signed   int indexSize, unsigned char *index, signed   int iNbBytes, unsigned char *pucDataBuffer) {
+  SILABS_Benchmark_Chip *chip;
+  chip      = (SILABS_Benchmark_Chip*)device;
+  address   = address;   /* To avoid compiler warning */
+  indexSize = indexSize; /* To avoid compiler warning */
+  index     = index;     /* To avoid compiler warning */
+  if (iNbBytes <= 0) { return iNbBytes; }
+  if ((chip = SiLabs_Benchmark_Chip_Behind(chip)) == NULL) { return 0; }
+  chip->polls++;
+  memset(pucDataBuffer, 0, iNbBytes);
+  if (chip->kind == BENCHMARK_CHIP_REGISTER) { return iNbBytes; }
+  if (chip->busy > 0) {
+    chip->busy--;
+    chip->busy_polls++;
+    return iNbBytes;
+  }
+  if (chip->reset) {
+    pucDataBuffer[0] = 0xfe;
+    return iNbBytes;
+  }
+  if (chip->kind == BENCHMARK_CHIP_TUNER) {
+    chip->response[0] = 0x81; /* CTS + TUNINT, the tuner is always ready */
+    if ( (chip->atv_tuned) && (system_time() - chip->atv_tune_ms >= BENCHMARK_ATV_MS) && (SiLabs_Benchmark_ATV_Carrier(chip) >= 0) ) {
+      chip->response[0] |= 0x02;  /* ATVINT */
+    }
+  } else {
+    SiLabs_Benchmark_Chip_Status(chip);
+    chip->response[0] = 0x80 | (chip->scan_int ? 0x02 : 0x00) | (chip->response[0] & 0x40); /* keeping ERR */
+  }
+  memcpy(pucDataBuffer, chip->response, (iNbBytes < BENCHMARK_RESPONSE_SIZE) ? iNbBytes : BENCHMARK_RESPONSE_SIZE);
+  return iNbBytes;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Chip_Add function
+  Use:      Emulated chip creation
+            Used to plug an emulated command-mode chip on the SIMU connection at the given address
+  Returns:  1 if ok, 0 if the chip table is full
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Chip_Add               (SILABS_Benchmark *bench, unsigned char address, SILABS_Benchmark_Chip_Kind kind) {
+  SILABS_Benchmark_Chip *chip;
+  if (bench->nb_chips >= BENCHMARK_MAX_CHIPS) { return 0; }
+  chip = &(bench->chip[bench->nb_chips]);
+  memset(chip, 0, sizeof(SILABS_Benchmark_Chip));
+  chip->bench   = bench;
+  chip->address = address;
+  chip->kind    = kind;
+  Si2183_storePropertiesDefaults(&(chip->prop));
+  chip->modulation  = chip->prop.dd_mode.modulation;
+  chip->auto_detect = chip->prop.dd_mode.auto_detect;
+  if (kind == BENCHMARK_CHIP_DEMOD) {
+#ifdef    DEMOD_ISDB_T
+    chip->part_info[ 1] = 2;   /* chiprev 'B' */
+    chip->part_info[ 2] = 83;
+#else  /* DEMOD_ISDB_T */
+    chip->part_info[ 1] = 4;   /* chiprev 'D' */
+    chip->part_info[ 2] = 69;
+#endif /* DEMOD_ISDB_T */
+    chip->part_info[ 3] = '6';
+    chip->part_info[ 4] = '0';
+    chip->part_info[ 5] = 1;
+    chip->part_info[12] = 2;   /* romid */
+    chip->get_rev[1]    = chip->part_info[2];
+    chip->get_rev[2]    = '6';
+    chip->get_rev[3]    = '0';
+    chip->get_rev[6]    = '6';
+    chip->get_rev[7]    = '0';
+    chip->get_rev[8]    = 1;
+    chip->get_rev[9]    = chip->part_info[1];
+  } else if (kind == BENCHMARK_CHIP_TUNER) {
+    chip->part_info[ 1] = 1;   /* chiprev 'A' */
+    chip->part_info[ 2] = BENCHMARK_TER_PART;
+    chip->part_info[ 3] = '1';
+    chip->part_info[ 4] = '1';
+    chip->part_info[ 5] = 12;
+    chip->part_info[12] = BENCHMARK_TER_ROMID;
+    chip->get_rev[1]    = BENCHMARK_TER_PART;
+    chip->get_rev[2]    = '1';
+    chip->get_rev[3]    = '1';
+    chip->get_rev[6]    = '1';
+    chip->get_rev[7]    = '1';
+    chip->get_rev[8]    = 12;
+    chip->get_rev[9]    = 1;
+  }
+  if (!L0_SimulatorDevice(address, chip, SiLabs_Benchmark_Chip_Read, SiLabs_Benchmark_Chip_Write)) { return 0; }
+  bench->nb_chips++;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Init function
+  Use:      Benchmark initialization
+            Used to set the emulated bus latency and the default emulation parameters
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Init                   (SILABS_Benchmark *bench, signed   int transaction_us, signed   int byte_us) {
+  signed   int i;
+  for (i=0; i<bench->nb_chips; i++) { L0_SimulatorDevice(bench->chip[i].address, NULL, NULL, NULL); }
+  memset(bench, 0, sizeof(SILABS_Benchmark));
+  bench->transaction_us = transaction_us;
+  bench->byte_us        = byte_us;
+  bench->busy_polls     = BENCHMARK_BUSY_POLLS;
+  bench->lock_ms        = BENCHMARK_LOCK_MS;
+  bench->scan_ms        = BENCHMARK_SCAN_MS;
+  bench->plp_ms         = BENCHMARK_PLP_MS;
+  bench->isi_ms         = BENCHMARK_ISI_MS;
+  bench->spi_hz         = BENCHMARK_SPI_HZ;
+  for (i=0; i<BENCHMARK_MAX_CARRIERS; i++) {
+    if (975000 + i*47000 > 2150000) { break; }
+    bench->carrier_khz[i] = 975000 + i*47000;
+  }
+  bench->nb_carriers = i;
+  L0_SimulatorLatency(transaction_us, byte_us);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_FE_Attach function
+  Use:      Benchmark front-end SW configuration
+            Used to SW init any front-end, connected to the emulated chips of index chip_index,
+             with its tuners' i2c pass-through via the front-end identified by connection.
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_FE_Attach              (SILABS_Benchmark *bench, SILABS_FE_Context *front_end, signed   int chip_index, signed   int connection) {
+  signed   int       i;
+  bench      = bench;      /* To avoid compiler warning */
+  connection = connection; /* To avoid compiler warning if not used */
+  i          = chip_index;
+  SiLabs_API_Frontend_Chip            (front_end, 0x2183);
+  SiLabs_API_SW_Init                  (front_end, BENCHMARK_DEMOD_ADDRESS + 2*i, BENCHMARK_TER_ADDRESS + 2*i, BENCHMARK_SAT_ADDRESS + 2*i);
+#ifdef    TERRESTRIAL_FRONT_END
+  SiLabs_API_Select_TER_Tuner         (front_end, BENCHMARK_TER_TUNER, 0);
+  SiLabs_API_TER_tuner_I2C_connection (front_end, connection);
+  SiLabs_API_TER_Tuner_ClockConfig    (front_end, 1, 1);
+  SiLabs_API_TER_Clock                (front_end, 1, 44, 24, 2);
+  SiLabs_API_TER_FEF_Config           (front_end, 1, 0xb, 1);
+  SiLabs_API_TER_AGC                  (front_end, 0x0, 0, 0xa, 0);
+  SiLabs_API_TER_Tuner_AGC_Input      (front_end, 1);
+  SiLabs_API_TER_Tuner_FEF_Input      (front_end, 1);
+  SiLabs_API_TER_Tuner_IF_Output      (front_end, 0);
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    SATELLITE_FRONT_END
+  SiLabs_API_Select_SAT_Tuner         (front_end, BENCHMARK_SAT_TUNER, 0);
+  SiLabs_API_SAT_Select_LNB_Chip      (front_end, 25, BENCHMARK_LNB_ADDRESS + 2*i);
+  SiLabs_API_SAT_tuner_I2C_connection (front_end, connection);
+  SiLabs_API_SAT_Clock                (front_end, 1, 44, 24, 2);
+  SiLabs_API_SAT_Spectrum             (front_end, 1);
+  SiLabs_API_SAT_AGC                  (front_end, 0xd, 1, 0x0, 1);
+#endif /* SATELLITE_FRONT_END */
+  SiLabs_API_HW_Connect               (front_end, SIMU);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_FE_Init function
+  Use:      Benchmark front-end SW init
+            Used to SW init one front-end in FrontEnd_Table, connected to the emulated chips of index fe_index.
+            As the emulated chips are not modified, this is also used to emulate an application restart.
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_FE_Init                (SILABS_Benchmark *bench, signed   int fe_index) {
+  char               tag[SILABS_TAG_SIZE];
+  SiLabs_Benchmark_FE_Attach          (bench, &(FrontEnd_Table[fe_index]), fe_index, fe_index);
+  snprintf(tag, SILABS_TAG_SIZE, "fe[%d]", fe_index);
+  SiLabs_API_Set_Index_and_Tag        (&(FrontEnd_Table[fe_index]), fe_index, tag);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Setup function
+  Use:      Benchmark front-ends configuration
+            Used to power-on the emulated chips and to SW init nb_front_ends front-ends in FrontEnd_Table
+  Returns:  the number of configured front-ends (limited to FRONT_END_COUNT)
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Setup                  (SILABS_Benchmark *bench, signed   int nb_front_ends) {
+  signed   int       i;
+  if (nb_front_ends > FRONT_END_COUNT) { nb_front_ends = FRONT_END_COUNT; }
+  if (nb_front_ends < 1              ) { nb_front_ends = 1;               }
+  for (i=0; i<bench->nb_chips; i++) { L0_SimulatorDevice(bench->chip[i].address, NULL, NULL, NULL); }
+  bench->nb_chips = 0;
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_Benchmark_Chip_Add(bench, BENCHMARK_DEMOD_ADDRESS + 2*i, BENCHMARK_CHIP_DEMOD);
+#ifdef    TERRESTRIAL_FRONT_END
+    SiLabs_Benchmark_Chip_Add(bench, BENCHMARK_TER_ADDRESS   + 2*i, BENCHMARK_CHIP_TUNER);
+#endif /* TERRESTRIAL_FRONT_END */
+    SiLabs_Benchmark_FE_Init(bench, i);
+  }
+  bench->nb_front_ends = nb_front_ends;
+  return nb_front_ends;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Start function
+  Use:      Scenario measurement start
+            Used to clear the i2c and emulator counters and to store the start times
+************************************************************************************************************************/
+void           SiLabs_Benchmark_Start                  (SILABS_Benchmark *bench, const char *scenario) {
+  signed   int i;
+  for (i=0; i<bench->nb_chips; i++) {
+    bench->chip[i].commands   = 0;
+    bench->chip[i].polls      = 0;
+    bench->chip[i].busy_polls = 0;
+    bench->chip[i].fw_bytes   = 0;
+  }
+  memset(&(bench->result), 0, sizeof(SILABS_Benchmark_Result));
+  bench->result.scenario = scenario;
+#ifdef    SiTRACES
+  SiTraceConfiguration("traces suspend");
+#endif /* SiTRACES */
+  L0_SimulatorStats(NULL, 1);
+  bench->start_cpu     = clock();
+  bench->start_wall_ms = system_time();
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Stop function
+  Use:      Scenario measurement end
+            Used to collect the counters and to format the result as a JSON line in bench->json
+  Returns:  the number of successful iterations
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Stop                   (SILABS_Benchmark *bench) {
+  SILABS_Benchmark_Result *result;
+  signed   int              i;
+  result = &(bench->result);
+  result->wall_ms = system_time() - bench->start_wall_ms;
+  result->cpu_ms  = (signed int)(((double)(clock() - bench->start_cpu))*1000/CLOCKS_PER_SEC);
+  L0_SimulatorStats(&(result->i2c), 0);
+  result->wait_ms = (signed int)result->i2c.wait_ms;
+  for (i=0; i<bench->nb_chips; i++) {
+    result->commands   += bench->chip[i].commands;
+    result->cts_polls  += bench->chip[i].polls;
+    result->busy_polls += bench->chip[i].busy_polls;
+    result->fw_bytes   += bench->chip[i].fw_bytes;
+  }
+#ifdef    SiTRACES
+  SiTraceConfiguration("traces resume");
+#endif /* SiTRACES */
+  snprintf(bench->json, BENCHMARK_RESULT_SIZE, "{\"scenario\":\"%s\",%s,\"transaction_us\":%d,\"byte_us\":%d,\"iterations\":%d,\"success\":%d,\"wall_ms\":%d,\"cpu_ms\":%d,\"wait_ms\":%d,\"i2c_reads\":%lu,\"i2c_writes\":%lu,\"i2c_bytes_read\":%lu,\"i2c_bytes_written\":%lu,\"i2c_nacks\":%lu,\"bus_time_us\":%lu,\"commands\":%lu,\"cts_polls\":%lu,\"busy_polls\":%lu,\"fw_bytes\":%lu}"
+    , result->scenario, result->params, bench->transaction_us, bench->byte_us, result->iterations, result->success
+    , result->wall_ms, result->cpu_ms, result->wait_ms
+    , result->i2c.reads, result->i2c.writes, result->i2c.bytes_read, result->i2c.bytes_written, result->i2c.nacks, result->i2c.bus_time_us
+    , result->commands, result->cts_polls, result->busy_polls, result->fw_bytes);
+  return result->success;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Cold_Boot function
+  Use:      'cold_boot' scenario
+            SW init and first switch_to_standard (with firmware downloads) of nb_front_ends front-ends
+  Returns:  the number of front-ends successfully started
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Cold_Boot              (SILABS_Benchmark *bench, signed   int nb_front_ends) {
+  signed   int i;
+  signed   int standard;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+#endif /* TERRESTRIAL_FRONT_END */
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  SiLabs_Benchmark_Start(bench, "cold_boot");
+  for (i=0; i<nb_front_ends; i++) {
+    bench->result.iterations++;
+    if (SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), standard, 1) == 1) { bench->result.success++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d", nb_front_ends);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#ifdef    LINUX_SPIDEV_Capability
+/************************************************************************************************************************
+  SiLabs_Benchmark_SPIDEV_ioctl function
+  Use:      User-space spidev mock (L0_SPIDEV_IOCTL_FUNC)
+            Configuration requests are accepted. SPI_IOC_MESSAGE bytes are counted as firmware bytes of the booting
+             demodulator, and the SPI bus time (BENCHMARK_SPI_MESSAGE_US per ioctl + 8 bits per byte at spi_hz)
+             is emulated using system_wait.
+  Returns:  the number of bytes sent for SPI_IOC_MESSAGE, 0 for configuration requests, -1 for unknown requests
+************************************************************************************************************************/
+int            SiLabs_Benchmark_SPIDEV_ioctl           (int fd, unsigned long request, void *arg) {
+  SILABS_Benchmark         *bench;
+  struct spi_ioc_transfer  *xfer;
+  signed   int              n;
+  signed   int              i;
+  signed   int              bytes;
+  fd    = fd; /* To avoid compiler warning */
+  bench = &Benchmark_Context;
+  if (_IOC_TYPE(request) != SPI_IOC_MAGIC) { return -1; }
+  if (_IOC_NR(request)   != 0            ) { return  0; } /* SPI_IOC_WR_MODE, SPI_IOC_WR_LSB_FIRST, SPI_IOC_WR_BITS_PER_WORD, SPI_IOC_WR_MAX_SPEED_HZ */
+  xfer  = (struct spi_ioc_transfer*)arg;
+  n     = _IOC_SIZE(request)/sizeof(struct spi_ioc_transfer);
+  bytes = 0;
+  for (i=0; i<n; i++) { bytes = bytes + xfer[i].len; }
+  for (i=0; i<bench->nb_chips; i++) {
+    if ( (bench->chip[i].kind == BENCHMARK_CHIP_DEMOD) && (bench->chip[i].booting) ) { bench->chip[i].fw_bytes += bytes; }
+  }
+  bench->spi_debt_us = bench->spi_debt_us + BENCHMARK_SPI_MESSAGE_US + (signed int)(((double)bytes)*8*1000000/bench->spi_hz);
+  if (bench->spi_debt_us >= 1000) {
+    system_wait(bench->spi_debt_us/1000);
+    bench->spi_debt_us = bench->spi_debt_us%1000;
+  }
+  return bytes;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_SPI_Boot function
+  Use:      'spi_boot' scenario
+            Same as 'cold_boot', with firmware downloads over SPI, using the Linux spidev backend on the spidev mock.
+            Comparing with 'cold_boot' gives the SPI vs I2C download gain.
+  Returns:  the number of front-ends successfully started
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_SPI_Boot               (SILABS_Benchmark *bench, signed   int nb_front_ends) {
+  L0_SPI_Stats spi;
+  signed   int i;
+  signed   int standard;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+#endif /* TERRESTRIAL_FRONT_END */
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  L0_SPIDEV_Setup(NULL, bench->spi_hz, SiLabs_Benchmark_SPIDEV_ioctl);
+  for (i=0; i<nb_front_ends; i++) {
+#ifdef    Si2183_COMPATIBLE
+    SiLabs_API_SPI_Setup(&(FrontEnd_Table[i]), 0x01, Si2183_SPI_LINK_CMD_SPI_CONF_CLK_DISEQC_CMD, Si2183_SPI_LINK_CMD_SPI_CLK_POLA_RISING, Si2183_SPI_LINK_CMD_SPI_CONF_DATA_MP_C, Si2183_SPI_LINK_CMD_SPI_DATA_DIR_LSB_FIRST);
+#endif /* Si2183_COMPATIBLE */
+  }
+  L0_SPIStats(NULL, 1);
+  bench->spi_debt_us = 0;
+  SiLabs_Benchmark_Start(bench, "spi_boot");
+  for (i=0; i<nb_front_ends; i++) {
+    bench->result.iterations++;
+    if (SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), standard, 1) == 1) { bench->result.success++; }
+  }
+  L0_SPIStats(&spi, 1);
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"spi_hz\":%d,\"spi_bytes\":%lu,\"spi_ioctls\":%lu", nb_front_ends, bench->spi_hz, spi.bytes, spi.messages);
+  L0_SPIDEV_Setup(L0_SPIDEV_DEVICE, L0_SPIDEV_SPEED_HZ, NULL);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* LINUX_SPIDEV_Capability */
+#ifdef    WARM_ATTACH
+/************************************************************************************************************************
+  SiLabs_Benchmark_Warm_Restart function
+  Use:      'warm_restart' and 'warm_snapshot' scenarios
+            nb_front_ends front-ends are first started as in 'cold_boot', and their warm-attach snapshots are saved.
+            An application restart is then emulated (SW init of all front-ends, the emulated chips keep running),
+             and the measured part is the first switch_to_standard after the restart, with warm-attach in 'mode'.
+            Comparing with 'cold_boot' gives the warm-attach gain.
+  Parameter: mode, Si2183_WARM_ATTACH_READ ('warm_restart') or Si2183_WARM_ATTACH_SNAPSHOT ('warm_snapshot')
+  Returns:  the number of front-ends successfully started by attaching to the running demodulator
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Warm_Restart           (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int mode) {
+  SILABS_FE_Context *front_end;
+  char               path[32];
+  signed   int       saved;
+  signed   int       loaded;
+  signed   int       tuners;
+  signed   int       i;
+  signed   int       standard;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+#endif /* TERRESTRIAL_FRONT_END */
+  saved = loaded = tuners = 0;
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  for (i=0; i<nb_front_ends; i++) {
+    front_end = &(FrontEnd_Table[i]);
+    snprintf(path, sizeof(path), "benchmark_warm_%d.bin", i);
+    SiLabs_API_Warm_Attach(front_end, mode); /* no snapshot loaded yet: full init */
+    if (SiLabs_API_switch_to_standard(front_end, standard, 1) == 1) { saved += SiLabs_API_Warm_Save(front_end, path); }
+  }
+  /* Application restart: all SW contexts are initialized again, the parts keep running */
+  for (i=0; i<nb_front_ends; i++) {
+    front_end = &(FrontEnd_Table[i]);
+    snprintf(path, sizeof(path), "benchmark_warm_%d.bin", i);
+    SiLabs_Benchmark_FE_Init(bench, i);
+    SiLabs_API_Warm_Attach(front_end, mode);
+    loaded += SiLabs_API_Warm_Load(front_end, path);
+  }
+  SiLabs_Benchmark_Start(bench, (mode == Si2183_WARM_ATTACH_SNAPSHOT) ? "warm_snapshot" : "warm_restart");
+  for (i=0; i<nb_front_ends; i++) {
+    front_end = &(FrontEnd_Table[i]);
+    bench->result.iterations++;
+    if (SiLabs_API_switch_to_standard(front_end, standard, 1) == 1) {
+      if (SiLabs_API_Warm_Attached(front_end) & 0x01) { bench->result.success++; }
+      if (SiLabs_API_Warm_Attached(front_end) & 0x02) { tuners++; }
+    }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"mode\":%d,\"saved\":%d,\"loaded\":%d,\"tuners_attached\":%d", nb_front_ends, mode, saved, loaded, tuners);
+  for (i=0; i<nb_front_ends; i++) {
+    snprintf(path, sizeof(path), "benchmark_warm_%d.bin", i);
+    remove(path);
+  }
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* WARM_ATTACH */
+#ifdef    POWER_MANAGER
+/************************************************************************************************************************
+  SiLabs_Benchmark_Power_Zap function
+  Use:      'power_predict' and 'power_demand' scenarios
+            'zaps' successive uses of BENCHMARK_POWER_FRONT_ENDS front-ends in a cyclic order, with the power manager
+             putting each front-end in a low power state as soon as it is released (idle_ms = 0).
+            With 'predict' set, the power manager learns the zap sequence and pre-warms the next front-end.
+            The wake-up latencies seen by the application are returned in wake_ms and wake_max_ms.
+  Returns:  the number of successful zaps
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Power_Zap              (SILABS_Benchmark *bench, signed   int zaps, signed   int predict) {
+  SILABS_Power_Manager *pm;
+  signed   int          nb_front_ends;
+  signed   int          standard;
+  signed   int          latency;
+  signed   int          wake_ms;
+  signed   int          wake_max_ms;
+  unsigned long         prewarm_hits;
+  unsigned long         active_ms;
+  unsigned long         total_ms;
+  signed   int          state;
+  signed   int          i;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+#endif /* TERRESTRIAL_FRONT_END */
+  if (zaps < 1) { zaps = 1; }
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, BENCHMARK_POWER_FRONT_ENDS);
+  Power_Manager_Last_Used = NULL;
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), standard, 1);
+    pm = SiLabs_Power_Manager_Of(&(FrontEnd_Table[i]));
+    SiLabs_Power_Manager_Init  (pm, &(FrontEnd_Table[i]));
+    SiLabs_Power_Manager_Config(pm, 0, POWER_MANAGER_WAKE_BUDGET_MS);
+    pm->predict_hits = predict ? POWER_MANAGER_PREDICT_HITS : 0;
+  }
+  SiLabs_Power_Manager_Process();
+  wake_ms = wake_max_ms = 0;
+  SiLabs_Benchmark_Start(bench, predict ? "power_predict" : "power_demand");
+  for (i=0; i<zaps; i++) {
+    pm = &(Power_Manager_Table[i%nb_front_ends]);
+    bench->result.iterations++;
+    latency = SiLabs_Power_Manager_Use(pm, standard);
+    if (latency >= 0) {
+      wake_ms = wake_ms + latency;
+      if (latency > wake_max_ms) { wake_max_ms = latency; }
+      if (SiLabs_API_lock_to_carrier(pm->front_end, standard, 474000000 + i*8000000, 8000000, 0, 0, 0, 0, 0, 0, -1, 0) == 1) { bench->result.success++; }
+    }
+    SiLabs_Power_Manager_Release(pm);
+    SiLabs_Power_Manager_Process();
+  }
+  prewarm_hits = active_ms = total_ms = 0;
+  for (i=0; i<nb_front_ends; i++) {
+    pm = &(Power_Manager_Table[i]);
+    SiLabs_Power_Manager_Set_State(pm, pm->state);
+    prewarm_hits = prewarm_hits + pm->prewarm_hits;
+    active_ms    = active_ms    + pm->residency_ms[POWER_STATE_ACTIVE];
+    for (state=0; state<POWER_STATES; state++) { total_ms = total_ms + pm->residency_ms[state]; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"zaps\":%d,\"idle_state\":\"%s\",\"wake_ms\":%d,\"wake_max_ms\":%d,\"prewarm_hits\":%lu,\"active_pct\":%d"
+    , nb_front_ends, zaps, SiLabs_Power_Manager_State_Text(SiLabs_Power_Manager_Choose(&(Power_Manager_Table[0]))), wake_ms, wake_max_ms, prewarm_hits, total_ms ? (signed int)(active_ms*100/total_ms) : 0);
+  for (i=0; i<nb_front_ends; i++) { SiLabs_Power_Manager_Config(&(Power_Manager_Table[i]), -1, 0); }
+  Power_Manager_Last_Used = NULL;
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* POWER_MANAGER */
+/************************************************************************************************************************
+  SiLabs_Benchmark_Standards function
+  Use:      List of the standards handled by the emulator (DVB-C2 is not emulated)
+  Returns:  the number of standards
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Standards              (signed   int *standards) {
+  signed   int n;
+  n = 0;
+#ifdef    DEMOD_DVB_T
+  standards[n++] = SILABS_DVB_T;
+#endif /* DEMOD_DVB_T */
+#ifdef    DEMOD_DVB_T2
+  standards[n++] = SILABS_DVB_T2;
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_ISDB_T
+  standards[n++] = SILABS_ISDB_T;
+#endif /* DEMOD_ISDB_T */
+#ifdef    DEMOD_DVB_C
+  standards[n++] = SILABS_DVB_C;
+#endif /* DEMOD_DVB_C */
+#ifdef    DEMOD_MCNS
+  standards[n++] = SILABS_MCNS;
+#endif /* DEMOD_MCNS */
+#ifdef    DEMOD_DVB_S_S2_DSS
+  standards[n++] = SILABS_DVB_S;
+  standards[n++] = SILABS_DVB_S2;
+#endif /* DEMOD_DVB_S_S2_DSS */
+  return n;
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Switch function
+  Use:      'switch' scenario
+            switch_to_standard on front-end 0 between all emulated standards, 'loops' times
+  Returns:  the number of successful switches
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Switch                 (SILABS_Benchmark *bench, signed   int loops) {
+  signed   int standards[10];
+  signed   int nb_standards;
+  signed   int i;
+  signed   int loop;
+  if (loops < 1) { loops = 1; }
+  nb_standards = SiLabs_Benchmark_Standards(standards);
+  SiLabs_Benchmark_Setup(bench, 1);
+  SiLabs_API_switch_to_standard(&(FrontEnd_Table[0]), standards[nb_standards-1], 1);
+  SiLabs_Benchmark_Start(bench, "switch");
+  for (loop=0; loop<loops; loop++) {
+    for (i=0; i<nb_standards; i++) {
+      bench->result.iterations++;
+      if (SiLabs_API_switch_to_standard(&(FrontEnd_Table[0]), standards[i], 0) == 1) { bench->result.success++; }
+    }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"standards\":%d,\"loops\":%d", nb_standards, loops);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Switch_Matrix function
+  Use:      'switch_matrix' scenario
+            switch_to_standard on front-end 0 for each (from, to) pair of emulated standards, plus ANALOG and SLEEP.
+            Each transition is measured after a switch to 'from', and its duration, planned actions and skipped steps
+             are traced as one line per transition (using the Si2183 switch plan).
+  Returns:  the number of successful transitions
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Switch_Matrix          (SILABS_Benchmark *bench) {
+  Si2183_Switch_Plan *plan;
+  signed   int standards[12];
+  signed   int nb_standards;
+  signed   int from;
+  signed   int to;
+  signed   int start_ms;
+  signed   int ms;
+  signed   int max_ms;
+  signed   int skipped;
+  signed   int step;
+  nb_standards = SiLabs_Benchmark_Standards(standards);
+#ifdef    TERRESTRIAL_FRONT_END
+  standards[nb_standards++] = SILABS_ANALOG;
+#endif /* TERRESTRIAL_FRONT_END */
+  standards[nb_standards++] = SILABS_SLEEP;
+  max_ms  = 0;
+  skipped = 0;
+  SiLabs_Benchmark_Setup(bench, 1);
+  SiLabs_API_switch_to_standard(&(FrontEnd_Table[0]), standards[0], 1);
+  plan = &(FrontEnd_Table[0].Si2183_FE->switch_plan);
+  SiLabs_Benchmark_Start(bench, "switch_matrix");
+  for (from=0; from<nb_standards; from++) {
+    for (to=0; to<nb_standards; to++) {
+      if (to == from) continue;
+      SiLabs_API_switch_to_standard(&(FrontEnd_Table[0]), standards[from], 0);
+      bench->result.iterations++;
+      start_ms = system_time();
+      if (SiLabs_API_switch_to_standard(&(FrontEnd_Table[0]), standards[to], 0) == 1) { bench->result.success++; }
+      ms = system_time() - start_ms;
+      if (ms > max_ms) { max_ms = ms; }
+      for (step=0; step<Si2183_SWITCH_STEPS; step++) { if (plan->skipped & Si2183_SWITCH_ACTION(step)) { skipped++; } }
+      SiTRACE("switch_matrix %-8s -> %-8s %4d ms actions 0x%04x skipped 0x%04x\n"
+        , Silabs_Standard_Text(standards[from]), Silabs_Standard_Text(standards[to]), ms, plan->actions, plan->skipped);
+    }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"standards\":%d,\"max_ms\":%d,\"skipped_steps\":%d", nb_standards, max_ms, skipped);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Zap function
+  Use:      'zap' scenario
+            lock_to_carrier on front-end 0 on 'zaps' successive frequencies in the given standard
+  Returns:  the number of successful locks
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Zap                    (SILABS_Benchmark *bench, signed   int standard, signed   int zaps) {
+  SILABS_FE_Context *front_end;
+  signed   int       i;
+  signed   int       freq;
+  signed   int       bandwidth_Hz;
+  unsigned int       symbol_rate_bps;
+  if (zaps < 1) { zaps = 1; }
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end = &(FrontEnd_Table[0]);
+  SiLabs_API_switch_to_standard(front_end, standard, 0);
+  SiLabs_Benchmark_Start(bench, "zap");
+  bandwidth_Hz    = 8000000;
+  symbol_rate_bps = 0;
+  for (i=0; i<zaps; i++) {
+    switch (standard) {
+      case SILABS_DVB_S :
+      case SILABS_DVB_S2:
+      case SILABS_DSS   : { freq = 1000000 + i*47000; symbol_rate_bps = 27500000; break; } /* kHz */
+      case SILABS_DVB_C : { freq = 306000000 + i*8000000; symbol_rate_bps = 6900000; break; }
+      case SILABS_MCNS  : { freq = 303000000 + i*6000000; symbol_rate_bps = 5360537; bandwidth_Hz = 6000000; break; }
+      case SILABS_ISDB_T: { freq = 473142857 + i*6000000; bandwidth_Hz = 6000000; break; }
+      default           : { freq = 474000000 + i*8000000; break; }
+    }
+    bench->result.iterations++;
+    if (SiLabs_API_lock_to_carrier(front_end, standard, freq, bandwidth_Hz, 0, symbol_rate_bps, 0, 0, 0, 0, -1, 0) == 1) { bench->result.success++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"standard\":\"%s\",\"lock_ms\":%d", Silabs_Standard_Text(standard), bench->lock_ms);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Blindscan function
+  Use:      'blindscan' scenario
+            DVB-S2 blindscan on front-end 0 between start_khz and stop_khz
+  Returns:  the number of detected carriers
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Blindscan              (SILABS_Benchmark *bench, signed   int start_khz, signed   int stop_khz) {
+  SILABS_FE_Context *front_end;
+  signed   int       standard, freq, bandwidth_Hz, stream, constellation, polarization, band, num_data_slice, num_plp, T2_base_lite;
+  unsigned int       symbol_rate_bps;
+  signed   int       expected;
+  signed   int       i;
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end = &(FrontEnd_Table[0]);
+  expected  = 0;
+  for (i=0; i<bench->nb_carriers; i++) {
+    if ( (bench->carrier_khz[i] >= start_khz) && (bench->carrier_khz[i] <= stop_khz) ) { expected++; }
+  }
+  SiLabs_API_switch_to_standard(front_end, SILABS_DVB_S2, 0);
+  SiLabs_Benchmark_Start(bench, "blindscan");
+  SiLabs_API_Channel_Seek_Init(front_end, start_khz, stop_khz, 0, 0, 1000000, 45000000, 0, 0, 0, 0);
+  while (SiLabs_API_Channel_Seek_Next(front_end, &standard, &freq, &bandwidth_Hz, &stream, &symbol_rate_bps, &constellation, &polarization, &band, &num_data_slice, &num_plp, &T2_base_lite) == 1) {
+    bench->result.iterations++;
+  }
+  SiLabs_API_Channel_Seek_End(front_end);
+  bench->result.success = (bench->result.iterations == expected) ? expected : 0;
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"start_khz\":%d,\"stop_khz\":%d,\"carriers\":%d", start_khz, stop_khz, expected);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Lock_Timeout function
+  Use:      'lock_fixed' and 'lock_adapt' scenarios
+            'learn' DVB-S2 zaps with signal (lock times spread over BENCHMARK_LOCK_JITTER_MS), not measured,
+             followed by 'fails' zaps without signal and 'fails' zaps with signal, measured.
+            With adaptive = 1, the learned lock timeout is used (when ADAPTIVE_LOCK_TIMEOUT is defined).
+  Returns:  the number of zaps with the expected result
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Lock_Timeout           (SILABS_Benchmark *bench, signed   int adaptive, signed   int learn, signed   int fails) {
+  SILABS_FE_Context *front_end;
+  signed   int       i;
+  signed   int       fail_ms;
+  signed   int       start_ms;
+  signed   int       timeout_ms;
+  signed   int       misses;
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end  = &(FrontEnd_Table[0]);
+  timeout_ms = 0;
+  misses     = 0;
+  SiLabs_API_switch_to_standard(front_end, SILABS_DVB_S2, 0);
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  SiLabs_Lock_Timeout_Reset ();
+  SiLabs_Lock_Timeout_Config(adaptive, LOCK_TIMEOUT_PERMILLE, LOCK_TIMEOUT_MARGIN_PCT, LOCK_TIMEOUT_MARGIN_MS, LOCK_TIMEOUT_MIN_SAMPLES, LOCK_TIMEOUT_VERIFY);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+  bench->lock_jitter_ms = BENCHMARK_LOCK_JITTER_MS;
+  bench->seed           = 1;
+  for (i=0; i<learn; i++) {
+    SiLabs_API_lock_to_carrier(front_end, SILABS_DVB_S2, 1000000 + (i%20)*47000, 0, 0, 27500000, 0, 0, 0, 0, -1, 0);
+  }
+  SiLabs_Benchmark_Start(bench, adaptive ? "lock_adapt" : "lock_fixed");
+  bench->no_signal = 1;
+  fail_ms = 0;
+  for (i=0; i<fails; i++) {
+    bench->result.iterations++;
+    start_ms = system_time();
+    if (SiLabs_API_lock_to_carrier(front_end, SILABS_DVB_S2, 1010000 + i*47000, 0, 0, 27500000, 0, 0, 0, 0, -1, 0) == 0) { bench->result.success++; }
+    fail_ms = fail_ms + system_time() - start_ms;
+  }
+  bench->no_signal = 0;
+  for (i=0; i<fails; i++) {
+    bench->result.iterations++;
+    if (SiLabs_API_lock_to_carrier(front_end, SILABS_DVB_S2, 1000000 + i*47000, 0, 0, 27500000, 0, 0, 0, 0, -1, 0) == 1) { bench->result.success++; }
+  }
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  if (Lock_Time_Learning.nb_keys > 0) {
+    SiLabs_Lock_Timeout_Learned(&(Lock_Time_Learning.stats[0]), &timeout_ms, &i);
+    misses = Lock_Time_Learning.stats[0].misses;
+  }
+  SiLabs_Lock_Timeout_Config(1, LOCK_TIMEOUT_PERMILLE, LOCK_TIMEOUT_MARGIN_PCT, LOCK_TIMEOUT_MARGIN_MS, LOCK_TIMEOUT_MIN_SAMPLES, LOCK_TIMEOUT_VERIFY);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+  bench->lock_jitter_ms = 0;
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"learn\":%d,\"fails\":%d,\"fail_ms\":%d,\"timeout_ms\":%d,\"misses\":%d"
+    , learn, fails, (fails > 0) ? fail_ms/fails : 0, adaptive ? timeout_ms : 0, misses);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_TER_Scan function
+  Use:      'ter_scan' and 'ter_prescan' scenarios
+            DVB-T2 channel scan ('not blind' seek) on front-end 0 between start_hz and stop_hz by steps of 8 MHz,
+             with emulated channels on 490, 514, 578, 626, 698 and 746 MHz. All other channels are empty.
+            With prescreen = 1, the RSSI pre-screen is used (when RSSI_PRESCREEN is defined).
+  Returns:  the number of detected channels
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_TER_Scan               (SILABS_Benchmark *bench, signed   int start_hz, signed   int stop_hz, signed   int prescreen) {
+  SILABS_FE_Context *front_end;
+  signed   int       standard, freq, bandwidth_Hz, stream, constellation, polarization, band, num_data_slice, num_plp, T2_base_lite;
+  unsigned int       symbol_rate_bps;
+  signed   int       channels_mhz[6] = {490, 514, 578, 626, 698, 746};
+  signed   int       expected;
+  signed   int       pos;
+  signed   int       i;
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end = &(FrontEnd_Table[0]);
+  expected  = 0;
+  for (i=0; i<6; i++) {
+    bench->ter_carrier_hz[i] = channels_mhz[i]*1000000;
+    if ( (bench->ter_carrier_hz[i] >= start_hz) && (bench->ter_carrier_hz[i] <= stop_hz) ) { expected++; }
+  }
+  bench->nb_ter_carriers = i;
+  SiLabs_API_switch_to_standard(front_end, SILABS_DVB_T2, 0);
+#ifdef    RSSI_PRESCREEN
+  SiLabs_RSSI_Prescreen_Config(SiLabs_RSSI_Prescreen_Of(front_end), prescreen, RSSI_PRESCREEN_THRESHOLD_DBM, RSSI_PRESCREEN_ABOVE_FLOOR_DB, RSSI_PRESCREEN_SETTLE_MS, RSSI_PRESCREEN_NEIGHBORS);
+#endif /* RSSI_PRESCREEN */
+  SiLabs_Benchmark_Start(bench, prescreen ? "ter_prescan" : "ter_scan");
+  SiLabs_API_Channel_Seek_Init(front_end, start_hz, stop_hz, 8000000, 8000000, 0, 0, 0, 0, 0, 0);
+  while (SiLabs_API_Channel_Seek_Next(front_end, &standard, &freq, &bandwidth_Hz, &stream, &symbol_rate_bps, &constellation, &polarization, &band, &num_data_slice, &num_plp, &T2_base_lite) == 1) {
+    bench->result.iterations++;
+  }
+  SiLabs_API_Channel_Seek_End(front_end);
+  bench->result.success = (bench->result.iterations == expected) ? expected : 0;
+  pos = snprintf(bench->result.params, sizeof(bench->result.params), "\"start_mhz\":%d,\"stop_mhz\":%d,\"channels\":%d", start_hz/1000000, stop_hz/1000000, expected);
+#ifdef    RSSI_PRESCREEN
+  if (prescreen) {
+    snprintf(bench->result.params + pos, sizeof(bench->result.params) - pos, ",\"probed\":%d,\"skipped\":%d,\"sweep_ms\":%d"
+      , RSSI_Prescreen_Table[0].probed, RSSI_Prescreen_Table[0].skipped, RSSI_Prescreen_Table[0].sweep_ms);
+  }
+  SiLabs_RSSI_Prescreen_Config(SiLabs_RSSI_Prescreen_Of(front_end), 1, RSSI_PRESCREEN_THRESHOLD_DBM, RSSI_PRESCREEN_ABOVE_FLOOR_DB, RSSI_PRESCREEN_SETTLE_MS, RSSI_PRESCREEN_NEIGHBORS);
+#endif /* RSSI_PRESCREEN */
+  pos = pos; /* To avoid compiler warning if not used */
+  bench->nb_ter_carriers = 0;
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Status_Poll function
+  Use:      'status_poll' scenario
+            1 Hz status polling of nb_front_ends front-ends locked in DVB-T2, during 'seconds'
+            The time left in each 1 s period is spent in system_wait, and therefore counted in wait_ms.
+  Returns:  the number of status reads returning a locked front-end
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Status_Poll            (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int seconds) {
+  CUSTOM_Status_Struct status;
+  signed   int         standard;
+  signed   int         freq;
+  signed   int         i;
+  signed   int         s;
+  signed   int         period_start_ms;
+  signed   int         elapsed_ms;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T2;
+  freq     = 474000000;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+  freq     = 1000000;
+#endif /* TERRESTRIAL_FRONT_END */
+  if (seconds < 1) { seconds = 1; }
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), standard, 1);
+    SiLabs_API_lock_to_carrier   (&(FrontEnd_Table[i]), standard, freq, 8000000, 0, 27500000, 0, 0, 0, 0, -1, 0);
+  }
+  SiLabs_Benchmark_Start(bench, "status_poll");
+  for (s=0; s<seconds; s++) {
+    period_start_ms = system_time();
+    for (i=0; i<nb_front_ends; i++) {
+      bench->result.iterations++;
+      SiLabs_API_FE_status_selection(&(FrontEnd_Table[i]), &status, FE_LOCK_STATE | FE_LEVELS | FE_RATES | FE_SPECIFIC | FE_QUALITY | FE_FREQ);
+      if (status.demod_lock == 1) { bench->result.success++; }
+    }
+    elapsed_ms = system_time() - period_start_ms;
+    if ( (s < seconds - 1) && (elapsed_ms < 1000) ) { system_wait(1000 - elapsed_ms); }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"seconds\":%d", nb_front_ends, seconds);
+  return SiLabs_Benchmark_Stop(bench);
+}
+/************************************************************************************************************************
+  SiLabs_Benchmark_Status_Export function
+  Use:      'status_text', 'status_export' and 'status_print' scenarios
+            The statuses of nb_front_ends front-ends locked in DVB-T2 are read once, then 'renders' times:
+             mode 0: rendered as text with SiLabs_API_Text_status_selection
+             mode 1: exported with SiLabs_Status_Export                            (when STATUS_EXPORT is defined)
+             mode 2: exported with SiLabs_Status_Export, then rendered with SiLabs_Status_Export_Print
+            The CPU time per front-end status and the output size are reported in params.
+  Returns:  the number of status renderings/exports producing an output
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Status_Export          (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int renders, signed   int mode) {
+  static CUSTOM_Status_Struct status[FRONT_END_COUNT];
+  char                 text[1000];
+  unsigned char        buffer[1024];
+  unsigned char        selection;
+  signed   int         standard;
+  signed   int         freq;
+  signed   int         length;
+  signed   int         i;
+  signed   int         r;
+  clock_t              start;
+  double               ns;
+#ifdef    TERRESTRIAL_FRONT_END
+  standard = SILABS_DVB_T2;
+  freq     = 474000000;
+#else  /* TERRESTRIAL_FRONT_END */
+  standard = SILABS_DVB_S2;
+  freq     = 1000000;
+#endif /* TERRESTRIAL_FRONT_END */
+  selection = FE_LOCK_STATE | FE_LEVELS | FE_RATES | FE_SPECIFIC | FE_QUALITY | FE_FREQ;
+  length    = 0;
+  buffer[0] = 0;
+  text[0]   = 0;
+  if (renders < 1) { renders = 1; }
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_API_switch_to_standard (&(FrontEnd_Table[i]), standard, 1);
+    SiLabs_API_lock_to_carrier    (&(FrontEnd_Table[i]), standard, freq, 8000000, 0, 27500000, 0, 0, 0, 0, -1, 0);
+    SiLabs_API_FE_status_selection(&(FrontEnd_Table[i]), &(status[i]), selection);
+  }
+  SiLabs_Benchmark_Start(bench, mode == 0 ? "status_text" : mode == 1 ? "status_export" : "status_print");
+  start = clock();
+  for (r=0; r<renders; r++) {
+    for (i=0; i<nb_front_ends; i++) {
+      bench->result.iterations++;
+      switch (mode) {
+        case 0 : {
+          SiLabs_API_Text_status_selection(&(FrontEnd_Table[i]), &(status[i]), text, selection);
+          length = (text[0] != 0);
+          break;
+        }
+#ifdef    STATUS_EXPORT
+        case 1 : {
+          length = SiLabs_Status_Export(&(FrontEnd_Table[i]), &(status[i]), selection, buffer, sizeof(buffer));
+          break;
+        }
+        case 2 : {
+          length = SiLabs_Status_Export(&(FrontEnd_Table[i]), &(status[i]), selection, buffer, sizeof(buffer));
+          length = SiLabs_Status_Export_Print(buffer, length, text, sizeof(text));
+          break;
+        }
+#endif /* STATUS_EXPORT */
+        default: { length = 0; break; }
+      }
+      if (length > 0) { bench->result.success++; }
+    }
+  }
+  ns = ((double)(clock() - start))*1000000000.0/CLOCKS_PER_SEC/bench->result.iterations;
+  if (mode != 1) { length = (signed int)strlen(text); }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"renders\":%d,\"bytes\":%d,\"ns\":%d", nb_front_ends, renders, length, (signed int)ns);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#ifdef    TERRESTRIAL_FRONT_END
+/************************************************************************************************************************
+  SiLabs_Benchmark_VCO_Zap function
+  Use:      'vco_zap' scenario
+            DVB-T lock_to_carrier on nb_front_ends front-ends in turn, all front-ends being first locked once.
+            At each TER tuner tune, the emulated tuner counts how many of the other tuners' VCO codes it blocks:
+             'blocked' is the total number of blocked codes, 'others' the total number of other tuned tuners.
+  Returns:  the number of successful locks
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_VCO_Zap                (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int zaps) {
+  signed   int i;
+  signed   int z;
+  if (zaps < 1) { zaps = 1; }
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), SILABS_DVB_T, 0);
+    SiLabs_API_lock_to_carrier   (&(FrontEnd_Table[i]), SILABS_DVB_T, 474000000 + i*8000000, 8000000, 0, 0, 0, 0, 0, 0, -1, 0);
+  }
+  SiLabs_Benchmark_Start(bench, "vco_zap");
+  bench->vco_others  = 0;
+  bench->vco_blocked = 0;
+  for (z=0; z<zaps; z++) {
+    i = z%nb_front_ends;
+    bench->result.iterations++;
+    if (SiLabs_API_lock_to_carrier(&(FrontEnd_Table[i]), SILABS_DVB_T, 474000000 + ((z*5)%48)*8000000, 8000000, 0, 0, 0, 0, 0, 0, -1, 0) == 1) { bench->result.success++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"blocked\":%d,\"others\":%d", nb_front_ends, bench->vco_blocked, bench->vco_others);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#ifdef    FRONTEND_REGISTRY
+#ifdef    INDIRECT_I2C_CONNECTION
+/************************************************************************************************************************
+  SiLabs_Benchmark_Registry function
+  Use:      'registry' scenario
+            nb_front_ends front-ends are allocated in a front-end registry, by boards of BENCHMARK_REGISTRY_PER_BOARD
+             front-ends, with 2 boards per i2c bus. As the SIMU connection has a single bus, the front-ends of all boards
+             share the emulated chips of their position on the board.
+            On each board, the odd front-ends use the i2c pass-through of the previous front-end for their TER tuner
+             (dual tuner boards), selected by its registry handle.
+            Each front-end opens and closes its TER tuner i2c pass-through, and the emulated demodulator receiving
+             the I2C_PASSTHROUGH commands is checked. All handles are then retrieved BENCHMARK_REGISTRY_LOOKUPS times
+             and the front-ends of each board and bus are listed.
+  Returns:  the number of front-ends with correct i2c pass-through commands
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Registry               (SILABS_Benchmark *bench, signed   int nb_front_ends) {
+  SILABS_FE_Registry *registry;
+  SILABS_FE_Context  *front_end;
+  char                tag[SILABS_TAG_SIZE];
+  signed   int        handles[BENCHMARK_REGISTRY_PER_BOARD*2];
+  signed   int        slot;
+  signed   int        chip;
+  signed   int        commands;
+  signed   int        boards;
+  signed   int        lookups;
+  signed   int        grouped;
+  signed   int        i;
+  signed   int        l;
+  registry = &FE_Registry;
+  if (nb_front_ends < 1) { nb_front_ends = BENCHMARK_REGISTRY_FRONT_ENDS; }
+  SiLabs_Benchmark_Setup(bench, BENCHMARK_REGISTRY_PER_BOARD);
+  SiLabs_Benchmark_Start(bench, "registry");
+  SiLabs_FE_Registry_Free(registry);
+  for (i=0; i<nb_front_ends; i++) {
+    slot = i%BENCHMARK_REGISTRY_PER_BOARD;
+    handles[0] = SiLabs_FE_Registry_Add(registry, i/(2*BENCHMARK_REGISTRY_PER_BOARD), i/BENCHMARK_REGISTRY_PER_BOARD);
+    front_end  = SiLabs_FE_Registry_Get(registry, handles[0]);
+    if (front_end == NULL) { break; }
+    SiLabs_Benchmark_FE_Attach(bench, front_end, slot, handles[0] - (slot%2));
+    snprintf(tag, SILABS_TAG_SIZE, "fe[%d]", i);
+    SiLabs_API_Set_Index_and_Tag(front_end, (unsigned char)i, tag);
+  }
+  nb_front_ends = registry->count;
+  boards        = (nb_front_ends + BENCHMARK_REGISTRY_PER_BOARD - 1)/BENCHMARK_REGISTRY_PER_BOARD;
+  for (i=0; i<nb_front_ends; i++) {
+    bench->result.iterations++;
+    front_end = SiLabs_FE_Registry_Get(registry, FE_REGISTRY_HANDLE_BASE + i);
+    slot      = i%BENCHMARK_REGISTRY_PER_BOARD;
+    /* The I2C_PASSTHROUGH commands must reach the demodulator of the even front-end of the pair */
+    for (chip=0; chip<bench->nb_chips; chip++) {
+      if (bench->chip[chip].address == BENCHMARK_DEMOD_ADDRESS + 2*(slot - slot%2)) { break; }
+    }
+    commands = (signed int)bench->chip[chip].commands;
+    if ( (SiLabs_API_TER_Tuner_I2C_Enable (front_end) == 1)
+      && (SiLabs_API_TER_Tuner_I2C_Disable(front_end) == 0)
+      && ((signed int)bench->chip[chip].commands == commands + 2) ) { bench->result.success++; }
+  }
+  lookups = 0;
+  for (l=0; l<BENCHMARK_REGISTRY_LOOKUPS; l++) {
+    for (i=0; i<nb_front_ends; i++) {
+      front_end = SiLabs_FE_Registry_Get(registry, FE_REGISTRY_HANDLE_BASE + i);
+      if (SiLabs_FE_Registry_Handle(front_end) == FE_REGISTRY_HANDLE_BASE + i) { lookups++; }
+    }
+  }
+  /* Each board and each bus must list its own front-ends, the first one being the first registered */
+  grouped = 0;
+  for (i=0; i<boards; i++) {
+    l = SiLabs_FE_Registry_Group(registry, FE_REGISTRY_ANY, i, handles, BENCHMARK_REGISTRY_PER_BOARD*2);
+    if ( (l > 0) && (l <= BENCHMARK_REGISTRY_PER_BOARD) && (handles[0] == FE_REGISTRY_HANDLE_BASE + i*BENCHMARK_REGISTRY_PER_BOARD) ) { grouped++; }
+  }
+  for (i=0; i<(boards + 1)/2; i++) {
+    l = SiLabs_FE_Registry_Group(registry, i, FE_REGISTRY_ANY, handles, BENCHMARK_REGISTRY_PER_BOARD*2);
+    if ( (l > 0) && (l <= BENCHMARK_REGISTRY_PER_BOARD*2) && (handles[0] == FE_REGISTRY_HANDLE_BASE + i*BENCHMARK_REGISTRY_PER_BOARD*2) ) { grouped++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"boards\":%d,\"buses\":%d,\"lookups\":%d,\"groups\":%d", nb_front_ends, boards, (boards + 1)/2, lookups, grouped);
+  SiLabs_FE_Registry_Free(registry);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* INDIRECT_I2C_CONNECTION */
+#endif /* FRONTEND_REGISTRY */
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    HW_DISCOVERY
+/************************************************************************************************************************
+  SiLabs_Benchmark_Discovery function
+  Use:      'discovery' scenario
+            Discovery of an emulated board, with its parts at their usual addresses (on a single bus, as the SIMU
+             connection has no notion of bus):
+             - demodulators at 0xc8, 0xca and 0xcc, and a part at 0xce acknowledging but never reporting CTS,
+             - TER tuners at 0xc0 behind 0xc8 and behind 0xca, and at 0xc2 behind 0xcc (nothing at 0xc4),
+             - register-based SAT tuners at 0xc6 behind 0xc8 and at 0x18 behind 0xca,
+             - LNB controllers at 0x10, 0x12 and 0x14 on the bus (nothing at 0x16).
+            The discovered front-ends are then SW initialized in FrontEnd_Table.
+  Returns:  the number of parts found at the expected place (minus the number of unexpected parts)
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Discovery              (SILABS_Benchmark *bench, signed   int probe_ms) {
+  SILABS_Discovery        *discovery;
+  SILABS_Discovery_Device *device;
+  L0_Context               bus;
+  signed   int             parts[16][4] = {     /* discovered kind, address, parent address, emulated kind */
+    { SILABS_DISCOVERY_DEMOD    , 0xc8, 0x00, BENCHMARK_CHIP_DEMOD    },
+    { SILABS_DISCOVERY_DEMOD    , 0xca, 0x00, BENCHMARK_CHIP_DEMOD    },
+    { SILABS_DISCOVERY_DEMOD    , 0xcc, 0x00, BENCHMARK_CHIP_DEMOD    },
+    { SILABS_DISCOVERY_NONE     , 0xce, 0x00, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_TER_TUNER, 0xc0, 0xc8, BENCHMARK_CHIP_TUNER    },
+    { SILABS_DISCOVERY_TER_TUNER, 0xc0, 0xca, BENCHMARK_CHIP_TUNER    },
+    { SILABS_DISCOVERY_TER_TUNER, 0xc2, 0xcc, BENCHMARK_CHIP_TUNER    },
+    { SILABS_DISCOVERY_NONE     , 0xc4, 0x00, BENCHMARK_CHIP_ABSENT   },
+    { SILABS_DISCOVERY_SAT_TUNER, 0xc6, 0xc8, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_SAT_TUNER, 0x18, 0xca, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_LNB      , 0x10, 0x00, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_LNB      , 0x12, 0x00, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_LNB      , 0x14, 0x00, BENCHMARK_CHIP_REGISTER },
+    { SILABS_DISCOVERY_NONE     , 0x16, 0x00, BENCHMARK_CHIP_ABSENT   },
+    { SILABS_DISCOVERY_NONE     , 0x00, 0x00, 0                       },
+    { SILABS_DISCOVERY_NONE     , 0x00, 0x00, 0                       } };
+  signed   int             i;
+  signed   int             j;
+  signed   int             p;
+  discovery = &Discovery_Context;
+  if (probe_ms < 1) { probe_ms = DISCOVERY_PROBE_MS; }
+  for (i=0; i<bench->nb_chips; i++) { L0_SimulatorDevice(bench->chip[i].address, NULL, NULL, NULL); }
+  bench->nb_chips      = 0;
+  bench->nb_front_ends = 0; /* the next scenarios need SiLabs_Benchmark_Setup */
+  for (i=0; parts[i][1] != 0; i++) {
+    SiLabs_Benchmark_Chip_Add(bench, (unsigned char)parts[i][1], (SILABS_Benchmark_Chip_Kind)parts[i][3]);
+    for (j=0; (parts[i][2] != 0) && (j<bench->nb_chips); j++) {
+      if ( (bench->chip[j].kind == BENCHMARK_CHIP_DEMOD) && (bench->chip[j].address == parts[i][2]) ) { bench->chip[bench->nb_chips-1].parent = &(bench->chip[j]); }
+    }
+  }
+  L0_Init   (&bus);
+  L0_Connect(&bus, SIMU);
+  SiLabs_Discovery_Init(discovery);
+  SiLabs_Discovery_Bus (discovery, &bus);
+  discovery->probe_ms = probe_ms;
+#ifdef    SATELLITE_FRONT_END
+  discovery->sat_hint = BENCHMARK_SAT_TUNER;
+#endif /* SATELLITE_FRONT_END */
+  SiLabs_Benchmark_Start(bench, "discovery");
+  SiLabs_Discovery_Run(discovery);
+  for (i=0; (i<discovery->nb_front_ends) && (i<FRONT_END_COUNT); i++) {
+    SiLabs_Discovery_FE_Init(discovery, i, &(FrontEnd_Table[i]));
+  }
+  bench->result.iterations = BENCHMARK_DISCOVERY_DEVICES;
+  for (j=0; j<discovery->nb_devices; j++) {
+    device = &(discovery->device[j]);
+    for (i=0; parts[i][1] != 0; i++) {
+      p = (device->parent >= 0) ? discovery->device[device->parent].address : 0;
+      if ( ((signed int)device->kind == parts[i][0]) && (device->address == parts[i][1]) && (p == parts[i][2]) ) { break; }
+    }
+    if (parts[i][1] != 0) { bench->result.success++; } else { bench->result.success--; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"probe_ms\":%d,\"devices\":%d,\"front_ends\":%d,\"rounds\":%d,\"nacks\":%d,\"timeouts\":%d"
+    , probe_ms, discovery->nb_devices, discovery->nb_front_ends, discovery->rounds, discovery->nacks, discovery->timeouts);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+/************************************************************************************************************************
+  SiLabs_Benchmark_TS_Route function
+  Use:      'ts_route' scenario
+            TS router with 4 duals (8 front-ends) and 6 TS ports:
+              ports 0 to 3: serial, wired to TS1 of each dual
+              port  4     : parallel bus shared by TS2 of duals 0 and 1
+              port  5     : parallel bus shared by TS2 of duals 2 and 3
+            Each reroute moves a random front-end to a free port reachable from its dual (or releases it).
+            A reroute is successful if it only sends DD_TS_PINS to the moved front-end (at most 2 commands).
+            One reroute in 8 requests a port already used, and is successful if refused without any i2c traffic.
+  Returns:  the number of successful reroutes
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_TS_Route               (SILABS_Benchmark *bench, signed   int reroutes) {
+  SILABS_TS_Router      *router;
+  SILABS_TS_Config       serial;
+  SILABS_TS_Config       parallel;
+  SILABS_FE_Context     *fe;
+  unsigned long          commands[BENCHMARK_TS_ROUTE_FRONT_ENDS];
+  signed   int           candidates[2];
+  signed   int           nb_candidates;
+  signed   int           i;
+  signed   int           j;
+  signed   int           r;
+  signed   int           d;
+  signed   int           p;
+  signed   int           port;
+  signed   int           target;
+  signed   int           others;
+  signed   int           conflicts;
+  router = &TS_Router_Context;
+  SiLabs_Benchmark_Setup(bench, BENCHMARK_TS_ROUTE_FRONT_ENDS);
+  memset(&serial,   0, sizeof(serial));
+  memset(&parallel, 0, sizeof(parallel));
+  SiLabs_TS_Crossbar_TS_Mode         (&serial,   SILABS_TS_SERIAL);
+  SiLabs_TS_Crossbar_Serial_Config   (&serial,   7, 0, 7, 0, 0, 0, 0);
+  SiLabs_TS_Crossbar_TS_Mode         (&parallel, SILABS_TS_PARALLEL);
+  SiLabs_TS_Crossbar_Parallel_Config (&parallel, 3, 2, 4, 3);
+  SiLabs_TS_Router_Init(router);
+  for (d=0; d<BENCHMARK_TS_ROUTE_FRONT_ENDS/2; d++) {
+    SiLabs_TS_Router_Add_Dual(router, &(FrontEnd_Table[2*d]), &(FrontEnd_Table[2*d+1]));
+    SiLabs_TS_Router_Wire    (router, SiLabs_TS_Router_Add_Port(router, &serial), d, 1);
+  }
+  SiLabs_TS_Router_Add_Port(router, &parallel);
+  SiLabs_TS_Router_Add_Port(router, &parallel);
+  for (d=0; d<BENCHMARK_TS_ROUTE_FRONT_ENDS/2; d++) {
+    SiLabs_TS_Router_Wire    (router, BENCHMARK_TS_ROUTE_FRONT_ENDS/2 + d/2, d, 2);
+  }
+  /* Initial routes: demod A of each dual on its serial port, demod B of duals 0 and 2 on the parallel buses */
+  for (d=0; d<BENCHMARK_TS_ROUTE_FRONT_ENDS/2; d++) {
+    SiLabs_TS_Router_Request(router, &(FrontEnd_Table[2*d]), d);
+    if (d%2 == 0) { SiLabs_TS_Router_Request(router, &(FrontEnd_Table[2*d+1]), BENCHMARK_TS_ROUTE_FRONT_ENDS/2 + d/2); }
+  }
+  SiLabs_TS_Router_Apply(router);
+  bench->seed = 1;
+  conflicts   = 0;
+  SiLabs_Benchmark_Start(bench, "ts_route");
+  for (r=0; r<reroutes; r++) {
+    bench->seed = bench->seed*1103515245 + 12345;
+    i  = (signed int)((bench->seed >> 16) % BENCHMARK_TS_ROUTE_FRONT_ENDS);
+    fe = &(FrontEnd_Table[i]);
+    for (j=0; j<BENCHMARK_TS_ROUTE_FRONT_ENDS; j++) {
+      commands[j] = SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*j)->commands;
+    }
+    port = SiLabs_TS_Router_Port_Of(router, fe);
+    bench->result.iterations++;
+    if (r%8 == 7) {
+      /* Requesting a port already used by another front-end: refused before any i2c traffic */
+      for (p=0; p<router->nb_ports; p++) { if ( (router->port[p].die >= 0) && (router->port[p].die != i) ) break; }
+      if (SiLabs_TS_Router_Route(router, fe, p) == 0) { conflicts++; }
+      others = 0;
+      for (j=0; j<BENCHMARK_TS_ROUTE_FRONT_ENDS; j++) {
+        if (SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*j)->commands != commands[j]) { others++; }
+      }
+      if ( (others == 0) && (SiLabs_TS_Router_Port_Of(router, fe) == port) ) { bench->result.success++; }
+      continue;
+    }
+    nb_candidates = 0;
+    for (j=0; j<2; j++) {
+      p = router->pad_port[2*(i/2) + j];
+      if ( (p >= 0) && (p != port) && (router->port[p].die < 0) ) { candidates[nb_candidates++] = p; }
+    }
+    target = TS_ROUTER_NO_ROUTE;
+    if (nb_candidates) { target = candidates[(bench->seed >> 8) % nb_candidates]; }
+    if (SiLabs_TS_Router_Route(router, fe, target) == 0) { continue; }
+    others = 0;
+    for (j=0; j<BENCHMARK_TS_ROUTE_FRONT_ENDS; j++) {
+      if ( (j != i) && (SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*j)->commands != commands[j]) ) { others++; }
+    }
+    SiTRACE("ts_route %-10s port %2d -> %2d: %d ms, %d DD_TS_PINS, %d other front-ends accessed\n", fe->tag, port, target, router->last_ms, router->commands, others);
+    if ( (others == 0) && (router->commands <= 2) && (SiLabs_TS_Router_Port_Of(router, fe) == ((target < 0) ? -1 : target)) ) { bench->result.success++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"ports\":%d,\"conflicts\":%d,\"max_ms\":%d,\"total_ms\":%d", router->nb_ports, conflicts, router->max_ms, router->total_ms);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+/************************************************************************************************************************
+  SiLabs_Benchmark_Bonding_Failover function
+  Use:      'bonding_failover' scenario
+            Bonding supervisor on 3 front-ends in DUAL_SINGLE (fe[1] slave, fe[0] bridge, fe[2] master), all locked in DVB-S2.
+            At each event, the signal of one leg fades (the slave, the bridge and the master in turn), then comes back.
+            An event is successful if:
+              the supervisor reaches the expected state (DEGRADED, or DOWN if the master fades) with the expected bitrate,
+              no healthy leg is restarted (hot_roles is used),
+              and the supervisor is back to BONDED with the initial bitrate after the signal comes back.
+  Returns:  the number of successful events
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Bonding_Failover       (SILABS_Benchmark *bench, signed   int events) {
+  SILABS_Bonding_Supervisor *supervisor;
+  SILABS_Benchmark_Chip     *chip;
+  signed   int               restarts[BONDING_MAX_LEGS];
+  signed   int               leg_kbps;
+  signed   int               expected_state;
+  signed   int               expected_kbps;
+  signed   int               initial_kbps;
+  signed   int               others;
+  signed   int               degraded;
+  signed   int               recovered;
+  signed   int               polls;
+  signed   int               e;
+  signed   int               i;
+  signed   int               j;
+  supervisor = &Bonding_Supervisor_Context;
+  SiLabs_Benchmark_Setup(bench, 3);
+  for (i=0; i<3; i++) {
+    SiLabs_API_switch_to_standard(&(FrontEnd_Table[i]), SILABS_DVB_S2, 1);
+    SiLabs_API_lock_to_carrier   (&(FrontEnd_Table[i]), SILABS_DVB_S2, 1000000 + i*47000, 0, 0, 27500000, 0, 0, 0, 0, -1, 0);
+  }
+  /* The roles are applied by SiLabs_Channel_Bonding in the application. Its HW checks need real duals, so it is not called here. */
+  SiLabs_Channel_Bonding_SW_Init(&Channel_Bonding_Context, &(FrontEnd_Table[0]), &(FrontEnd_Table[1]), &(FrontEnd_Table[2]), NULL, SILABS_TS_1, SILABS_TS_1);
+  SiLabs_Bonding_Supervisor_Init(supervisor, &Channel_Bonding_Context, SILABS_DUAL_SINGLE, SILABS_TS_1);
+  supervisor->hot_roles = 1;
+  SiLabs_Bonding_Supervisor_Poll(supervisor);
+  initial_kbps = supervisor->bonded_kbps;
+  leg_kbps     = initial_kbps/supervisor->nb_legs;
+  SiLabs_Benchmark_Start(bench, "bonding_failover");
+  for (e=0; e<events; e++) {
+    i    = e % supervisor->nb_legs;
+    chip = SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*supervisor->leg[i].fe->fe_index);
+    for (j=0; j<supervisor->nb_legs; j++) { restarts[j] = supervisor->leg[j].restarts; }
+    if (i == supervisor->nb_legs - 1) {
+      expected_state = SILABS_BONDING_DOWN;
+      expected_kbps  = 0;
+    } else {
+      expected_state = SILABS_BONDING_DEGRADED;
+      expected_kbps  = (supervisor->nb_legs - 1 - i)*leg_kbps;
+    }
+    bench->result.iterations++;
+    chip->fading = 1;
+    for (polls=0; polls<BENCHMARK_BONDING_MAX_POLLS; polls++) {
+      if (SiLabs_Bonding_Supervisor_Poll(supervisor) == expected_state) break;
+      system_wait(BENCHMARK_BONDING_POLL_MS);
+    }
+    degraded = ((signed int)supervisor->state == expected_state) && (supervisor->bonded_kbps == expected_kbps);
+    others   = 0;
+    for (j=0; j<supervisor->nb_legs; j++) { if ( (j != i) && (supervisor->leg[j].restarts != restarts[j]) ) { others++; } }
+    chip->fading = 0;
+    for (polls=0; polls<BENCHMARK_BONDING_MAX_POLLS; polls++) {
+      system_wait(BENCHMARK_BONDING_POLL_MS);
+      if (SiLabs_Bonding_Supervisor_Poll(supervisor) == SILABS_BONDING_BONDED) break;
+    }
+    recovered = (supervisor->state == SILABS_BONDING_BONDED) && (supervisor->bonded_kbps == initial_kbps);
+    for (j=0; j<supervisor->nb_legs; j++) { if ( (j != i) && (supervisor->leg[j].restarts != restarts[j]) ) { others++; } }
+    SiTRACE("bonding_failover leg %d %s: degraded %d, recovered %d, %d healthy legs restarted, reconfiguration %d ms\n", i, supervisor->leg[i].fe->tag, degraded, recovered, others, supervisor->last_reconfig_ms);
+    if ( (degraded) && (recovered) && (others == 0) ) { bench->result.success++; }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"legs\":%d,\"reconfigurations\":%d,\"max_reconfig_ms\":%d,\"bonded_kbps\":%d"
+    , supervisor->nb_legs, supervisor->reconfigurations, supervisor->max_reconfig_ms, initial_kbps);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+/************************************************************************************************************************
+  SiLabs_Benchmark_TS_Clock function
+  Use:      'ts_clock' scenario
+            Adaptive TS clocks on nb_front_ends front-ends with a serial TS, all locked in DVB-S2.
+            At each step, the TS bitrate of each emulated demodulator moves by up to +/-1% around its multiplex rate,
+             and every 10 steps the multiplex rate of one front-end changes (from 4 to 96 Mbps, max_khz being 100 MHz
+             to also use the AUTO_ADAPT continuous clock). The statuses are then polled.
+            A poll is successful if the TS clock is above the TS bitrate, and if the clock only changes after a
+             multiplex rate change (not because of the +/-1% variations).
+            The average TS efficiency is compared with the efficiency of the default AUTO_FIXED clock (50 MHz) in params.
+  Returns:  the number of successful polls
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_TS_Clock               (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int steps) {
+  CUSTOM_Status_Struct   status;
+  SILABS_TS_Clock       *tsc;
+  SILABS_Benchmark_Chip *chip;
+  signed   int           mux_kbps[7] = {4000, 8000, 15000, 24000, 38560, 60000, 96000};
+  signed   int           base_kbps[FRONT_END_COUNT];
+  signed   int           changed[FRONT_END_COUNT];
+  SILABS_TS_Clock_Mode   mode;
+  signed   int           clock_khz;
+  signed   int           safe;
+  signed   int           efficiency;
+  signed   int           fixed_efficiency;
+  signed   int           changes;
+  signed   int           spurious;
+  signed   int           i;
+  signed   int           s;
+  nb_front_ends = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  bench->seed = 1;
+  for (i=0; i<nb_front_ends; i++) {
+    SiLabs_API_switch_to_standard (&(FrontEnd_Table[i]), SILABS_DVB_S2, 1);
+    SiLabs_API_TS_Mode            (&(FrontEnd_Table[i]), SILABS_TS_SERIAL);
+    SiLabs_API_lock_to_carrier    (&(FrontEnd_Table[i]), SILABS_DVB_S2, 1000000 + i*47000, 0, 0, 27500000, 0, 0, 0, 0, -1, 0);
+    SiLabs_TS_Clock_Config        (SiLabs_TS_Clock_Of(&(FrontEnd_Table[i])), 1, TS_CLOCK_MARGIN_PCT, TS_CLOCK_HYSTERESIS_PCT, TS_CLOCK_DOWN_POLLS, TS_CLOCK_STEP_KHZ, 100000);
+    base_kbps[i] = mux_kbps[i % 7];
+    changed[i]   = 0;     /* first adaptation at the first poll */
+  }
+  efficiency       = 0;
+  fixed_efficiency = 0;
+  changes          = 0;
+  spurious         = 0;
+  SiLabs_Benchmark_Start(bench, "ts_clock");
+  for (s=0; s<steps; s++) {
+    if (s%10 == 9) {
+      bench->seed = bench->seed*1103515245 + 12345;
+      i = (signed int)((bench->seed >> 16) % nb_front_ends);
+      bench->seed = bench->seed*1103515245 + 12345;
+      base_kbps[i] = mux_kbps[(bench->seed >> 16) % 7];
+      changed[i]   = s;
+    }
+    for (i=0; i<nb_front_ends; i++) {
+      tsc  = SiLabs_TS_Clock_Of(&(FrontEnd_Table[i]));
+      chip = SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*i);
+      bench->seed = bench->seed*1103515245 + 12345;
+      chip->ts_kbps = base_kbps[i] + (base_kbps[i]*((signed int)((bench->seed >> 16) % 21) - 10))/1000;
+      clock_khz = tsc->clock_khz;
+      mode      = tsc->mode;
+      bench->result.iterations++;
+      SiLabs_API_Demod_status_selection(&(FrontEnd_Table[i]), &status, FE_LOCK_STATE);
+      safe = (tsc->mode == SILABS_TS_CLOCK_CONTINUOUS) || ( (tsc->mode == SILABS_TS_CLOCK_GAPPED) && (tsc->clock_khz >= status.TS_bitrate_kHz) );
+      if ( (tsc->clock_khz != clock_khz) || (tsc->mode != mode) ) {
+        changes++;
+        /* a reduction is applied down_polls polls after the multiplex rate change */
+        if (s - changed[i] > tsc->down_polls) { spurious++; safe = 0; }
+      }
+      efficiency       += tsc->efficiency_pct;
+      fixed_efficiency += (status.TS_bitrate_kHz*100)/50000;
+      if (safe) { bench->result.success++; }
+    }
+  }
+  if (bench->result.iterations) {
+    efficiency       = efficiency      /bench->result.iterations;
+    fixed_efficiency = fixed_efficiency/bench->result.iterations;
+  }
+  for (i=0; i<nb_front_ends; i++) { SiLabs_TS_Clock_Config(SiLabs_TS_Clock_Of(&(FrontEnd_Table[i])), 0, TS_CLOCK_MARGIN_PCT, TS_CLOCK_HYSTERESIS_PCT, TS_CLOCK_DOWN_POLLS, TS_CLOCK_STEP_KHZ, 0); }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"steps\":%d,\"clock_changes\":%d,\"spurious\":%d,\"efficiency_pct\":%d,\"fixed_efficiency_pct\":%d"
+    , nb_front_ends, steps, changes, spurious, efficiency, fixed_efficiency);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+/************************************************************************************************************************
+  SiLabs_Benchmark_Extended_Status function
+  Use:      'extended_status' scenario
+            nb_front_ends front-ends locked in turn on a 3-layer ISDB-T signal, a hierarchical DVB-T signal and a
+             DVB-T2 multiplex with BENCHMARK_PLP_COUNT PLPs.
+            The per-layer/per-PLP information is first retrieved 'snapshots' times with the existing calls:
+             SiLabs_API_Demod_status_selection (FE_LOCK_STATE | FE_RATES | FE_SPECIFIC), plus
+             SiLabs_API_TER_ISDBT_Layer_Info for each ISDB-T layer, SiLabs_API_Get_DVBT_Hierarchy in DVB-T or
+             SiLabs_API_Get_PLP_ID_and_TYPE for each DVB-T2 PLP.
+            It is then retrieved 'snapshots' times with SiLabs_Extended_Status_Get.
+            A snapshot is successful if all layers/PLPs are returned with the emulated modulations, if the rates of the
+             decoded layer are available and if the plan is built only once. All snapshots fail if the extended
+             status does not use fewer commands than the existing calls.
+            The commands and bytes of both methods are compared in params.
+  Returns:  the number of successful snapshots
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Extended_Status        (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int snapshots) {
+  CUSTOM_Status_Struct    status;
+  SILABS_Extended_Status  extended;
+  SILABS_Extended_Plan   *plan;
+  L0_Simu_Stats           stats;
+  signed   int            standards[3] = {SILABS_ISDB_T, SILABS_DVB_T, SILABS_DVB_T2};
+  signed   int            isdbt_constel[3] = {SILABS_QPSK, SILABS_QAM64, SILABS_QAM16};
+  signed   int            t2_constel[4]    = {SILABS_QPSK, SILABS_QAM16, SILABS_QAM64, SILABS_QAM256};
+  signed   int            auto_detect[FRONT_END_COUNT];
+  unsigned long           legacy_commands;
+  unsigned long           legacy_bytes;
+  unsigned long           extended_commands;
+  unsigned long           extended_bytes;
+  unsigned long           start_commands;
+  unsigned long           start_bytes;
+  signed   int            nb_plp;
+  signed   int            constellation;
+  signed   int            code_rate;
+  signed   int            il;
+  signed   int            nb_seg;
+  signed   int            hierarchy;
+  signed   int            plp_id;
+  signed   int            plp_type;
+  signed   int            measured;
+  signed   int            ok;
+  signed   int            i;
+  signed   int            l;
+  signed   int            s;
+  nb_front_ends  = SiLabs_Benchmark_Setup(bench, nb_front_ends);
+  nb_plp         = bench->nb_plp;
+  bench->nb_plp  = BENCHMARK_PLP_COUNT;
+  bench->layered = 1;
+  for (i=0; i<nb_front_ends; i++) {
+    auto_detect[i] = SiLabs_API_TER_AutoDetect(&(FrontEnd_Table[i]), 2); /* DVB-T and DVB-T2 are locked separately */
+    SiLabs_API_TER_AutoDetect     (&(FrontEnd_Table[i]), 0);
+    SiLabs_API_switch_to_standard (&(FrontEnd_Table[i]), standards[i%3], 1);
+    SiLabs_API_lock_to_carrier    (&(FrontEnd_Table[i]), standards[i%3], 474000000 + i*8000000, 8000000, 0, 0, 0, 0, 0, 0, 0, 0);
+    SiLabs_Extended_Status_Init   (SiLabs_Extended_Status_Of(&(FrontEnd_Table[i])), &(FrontEnd_Table[i]));
+  }
+  SiLabs_Benchmark_Start(bench, "extended_status");
+  /* Existing call sequence */
+  start_commands = 0;
+  for (i=0; i<nb_front_ends; i++) { start_commands += SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*i)->commands; }
+  L0_SimulatorStats(&stats, 0);
+  start_bytes = stats.bytes_read + stats.bytes_written;
+  for (s=0; s<snapshots; s++) {
+    for (i=0; i<nb_front_ends; i++) {
+      SiLabs_API_Demod_status_selection(&(FrontEnd_Table[i]), &status, FE_LOCK_STATE | FE_RATES | FE_SPECIFIC);
+      if (standards[i%3] == SILABS_ISDB_T) {
+        for (l=0xA; l<=0xC; l++) { SiLabs_API_TER_ISDBT_Layer_Info(&(FrontEnd_Table[i]), l, &constellation, &code_rate, &il, &nb_seg); }
+      }
+      if (standards[i%3] == SILABS_DVB_T ) {
+        SiLabs_API_Get_DVBT_Hierarchy(&(FrontEnd_Table[i]), &hierarchy);
+      }
+      if (standards[i%3] == SILABS_DVB_T2) {
+        for (l=0; l<status.num_plp; l++) { SiLabs_API_Get_PLP_ID_and_TYPE(&(FrontEnd_Table[i]), 0, l, &plp_id, &plp_type); }
+      }
+    }
+  }
+  legacy_commands = 0;
+  for (i=0; i<nb_front_ends; i++) { legacy_commands += SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*i)->commands; }
+  legacy_commands = legacy_commands - start_commands;
+  L0_SimulatorStats(&stats, 0);
+  legacy_bytes    = stats.bytes_read + stats.bytes_written - start_bytes;
+  /* Extended status snapshots */
+  start_commands  = start_commands + legacy_commands;
+  start_bytes     = start_bytes    + legacy_bytes;
+  measured        = 0;
+  for (s=0; s<snapshots; s++) {
+    for (i=0; i<nb_front_ends; i++) {
+      plan = SiLabs_Extended_Status_Of(&(FrontEnd_Table[i]));
+      bench->result.iterations++;
+      SiLabs_Extended_Status_Get(plan, &extended);
+      ok = (extended.fec_lock) && (plan->builds == 1);
+      if (standards[i%3] == SILABS_ISDB_T) {
+        ok = ok && (extended.nb_layers == 3);
+        for (l=0; (l<extended.nb_layers) && (l<3); l++) { ok = ok && (extended.layer[l].constellation == isdbt_constel[l]); }
+      }
+      if (standards[i%3] == SILABS_DVB_T ) {
+        ok = ok && (extended.nb_layers == 2) && (extended.layer[0].code_rate == SILABS_CODERATE_1_2) && (extended.layer[1].code_rate == SILABS_CODERATE_3_4);
+      }
+      if (standards[i%3] == SILABS_DVB_T2) {
+        ok = ok && (extended.nb_layers == BENCHMARK_PLP_COUNT);
+        for (l=0; l<extended.nb_layers; l++) { ok = ok && (extended.layer[l].constellation == t2_constel[l%4]); }
+      }
+      for (l=0; l<extended.nb_layers; l++) {
+        if (extended.layer[l].decoded) { ok = ok && (extended.layer[l].ber_mant >= 0) && (extended.layer[l].per_mant >= 0); }
+      }
+      if ( (s == snapshots - 1) && (standards[i%3] == SILABS_ISDB_T) ) {
+        for (l=0; l<extended.nb_layers; l++) { measured += (extended.layer[l].age >= 0); }
+      }
+      if (ok) { bench->result.success++; }
+    }
+  }
+  extended_commands = 0;
+  for (i=0; i<nb_front_ends; i++) { extended_commands += SiLabs_Benchmark_Chip_Find(bench, BENCHMARK_DEMOD_ADDRESS + 2*i)->commands; }
+  extended_commands = extended_commands - start_commands;
+  L0_SimulatorStats(&stats, 0);
+  extended_bytes    = stats.bytes_read + stats.bytes_written - start_bytes;
+  if (extended_commands >= legacy_commands) { bench->result.success = 0; }
+  for (i=0; i<nb_front_ends; i++) { SiLabs_API_TER_AutoDetect(&(FrontEnd_Table[i]), auto_detect[i]); }
+  bench->nb_plp  = nb_plp;
+  bench->layered = 0;
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"front_ends\":%d,\"snapshots\":%d,\"legacy_cmds\":%lu,\"cmds\":%lu,\"legacy_bytes\":%lu,\"bytes\":%lu,\"layers_measured\":%d"
+    , nb_front_ends, snapshots, legacy_commands, extended_commands, legacy_bytes, extended_bytes, measured);
+  return SiLabs_Benchmark_Stop(bench);
+}
+#endif /* EXTENDED_STATUS */
+#ifdef    BENCHMARK_ATV_TUNER
+/************************************************************************************************************************
+  SiLabs_Benchmark_ATV_Scan function
+  Use:      'atv_scan', 'atv_parallel' and 'atv_rescan' scenarios
+            ATV system M scan from 54 to 126 MHz, with emulated analog channels on 55.25, 61.25, 67.25, 77.25, 83.25
+             and 97.25 MHz. The TER tuners of the front-ends used are switched to the Si2157 during the scenario.
+             mode 0: scan with SiLabs_ATV_Channel_Scan_M on front-end 0
+             mode 1: scan with the ATV scan coordinator on nb_tuners front-ends, by 2 MHz segments (with ATV_PARALLEL_SCAN)
+             mode 2: same as mode 1, then the 83.25 MHz channel moves to 85.25 MHz and 80 to 90 MHz is re-scanned.
+                      Only the re-scan is measured.                                           (with ATV_PARALLEL_SCAN)
+  Returns:  the number of channels found at the expected frequencies
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_ATV_Scan               (SILABS_Benchmark *bench, signed   int nb_tuners, signed   int mode) {
+  SILABS_TER_TUNER_Context *tuner_ter;
+  signed   int              channels_khz[6] = {55250, 61250, 67250, 77250, 83250, 97250};
+  signed   int              found_hz[BENCHMARK_MAX_CARRIERS];
+  signed   int              nb_found;
+  signed   int              matched;
+  signed   int              tunes;
+  signed   int              i;
+  signed   int              j;
+#ifndef   ATV_PARALLEL_SCAN
+  mode = 0;
+#endif /* ATV_PARALLEL_SCAN */
+  if (mode == 0) { nb_tuners = 1; }
+  nb_tuners = SiLabs_Benchmark_Setup(bench, nb_tuners);
+  for (i=0; i<nb_tuners; i++) {
+    SiLabs_API_Select_TER_Tuner(&(FrontEnd_Table[i]), BENCHMARK_ATV_TUNER, 0);
+    SiLabs_TER_Tuner_HW_Connect(FrontEnd_Table[i].Si2183_FE->tuner_ter, SIMU);
+  }
+  for (i=0; i<6; i++) {
+    bench->atv_carrier_hz[i] = channels_khz[i]*1000;
+    bench->atv_video_sys [i] = SILABS_VIDEO_SYS_M;
+  }
+  bench->nb_atv_carriers = i;
+  nb_found = 0;
+  tunes    = 0;
+  if (mode == 0) {
+    tuner_ter = FrontEnd_Table[0].Si2183_FE->tuner_ter;
+    SiLabs_Benchmark_Start(bench, "atv_scan");
+    SiLabs_API_TER_Tuner_I2C_Enable (&(FrontEnd_Table[0]));
+    SiLabs_ATV_Channel_Scan_M(tuner_ter, 54000000, 126000000, -70, 0, 25, 45);
+    SiLabs_API_TER_Tuner_I2C_Disable(&(FrontEnd_Table[0]));
+    for (i=0; (i<tuner_ter->Si2157_Tuner[tuner_ter->tuner_index]->ChannelListSize) && (nb_found < BENCHMARK_MAX_CARRIERS); i++) {
+      found_hz[nb_found++] = (signed int)tuner_ter->Si2157_Tuner[tuner_ter->tuner_index]->ChannelList[i];
+    }
+  }
+#ifdef    ATV_PARALLEL_SCAN
+  else {
+    SiLabs_ATV_Scan_Init  (&ATV_Scan_Context);
+    for (i=0; i<nb_tuners; i++) { SiLabs_ATV_Scan_Add_Tuner(&ATV_Scan_Context, &(FrontEnd_Table[i])); }
+    SiLabs_ATV_Scan_Config(&ATV_Scan_Context, ATV_SCAN_FAMILY_M, 54000000, 126000000, 2000000);
+    if (mode == 2) {
+      SiLabs_ATV_Scan_Run (&ATV_Scan_Context);
+      bench->atv_carrier_hz[4] = 85250000;
+      SiLabs_Benchmark_Start(bench, "atv_rescan");
+      SiLabs_ATV_Scan_Rescan(&ATV_Scan_Context, 80000000, 90000000);
+    } else {
+      SiLabs_Benchmark_Start(bench, "atv_parallel");
+    }
+    SiLabs_ATV_Scan_Run   (&ATV_Scan_Context);
+    for (i=0; (i<ATV_Scan_Context.nb_channels) && (nb_found < BENCHMARK_MAX_CARRIERS); i++) {
+      found_hz[nb_found++] = (signed int)ATV_Scan_Context.channel[i].freq;
+    }
+    tunes = ATV_Scan_Context.tunes;
+  }
+#endif /* ATV_PARALLEL_SCAN */
+  /* Each emulated channel must be found once, at its picture carrier frequency */
+  matched = 0;
+  for (i=0; i<bench->nb_atv_carriers; i++) {
+    for (j=0; j<nb_found; j++) {
+      if ( (found_hz[j] > bench->atv_carrier_hz[i] - 100000) && (found_hz[j] < bench->atv_carrier_hz[i] + 100000) ) { matched++; break; }
+    }
+  }
+  bench->result.iterations = bench->nb_atv_carriers;
+  bench->result.success    = (nb_found == matched) ? matched : 0;
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"tuners\":%d,\"channels\":%d,\"found\":%d,\"tunes\":%d", nb_tuners, bench->nb_atv_carriers, nb_found, tunes);
+  SiLabs_Benchmark_Stop(bench);
+  for (i=0; i<nb_tuners; i++) {
+    SiLabs_API_Select_TER_Tuner(&(FrontEnd_Table[i]), BENCHMARK_TER_TUNER, 0);
+    SiLabs_TER_Tuner_HW_Connect(FrontEnd_Table[i].Si2183_FE->tuner_ter, SIMU);
+  }
+  bench->nb_atv_carriers = 0;
+  return bench->result.success;
+}
+#endif /* BENCHMARK_ATV_TUNER */
+#ifdef    PLP_DIRECTORY
+/************************************************************************************************************************
+  SiLabs_Benchmark_PLP_Hop function
+  Use:      'plp_hop' and 'plp_relock' scenarios
+            PLP changes on front-end 0, locked on a DVB-T2 multiplex with BENCHMARK_PLP_COUNT PLPs,
+             using SiLabs_PLP_Hop (relock = 0) or SiLabs_API_lock_to_carrier (relock = 1)
+  Returns:  the number of successful PLP changes
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_PLP_Hop                (SILABS_Benchmark *bench, signed   int hops, signed   int relock) {
+  SILABS_FE_Context    *front_end;
+  SILABS_PLP_Directory *directory;
+  signed   int          plp_id;
+  signed   int          success;
+  signed   int          i;
+  if (hops < 1) { hops = 1; }
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end     = &(FrontEnd_Table[0]);
+  directory     = SiLabs_PLP_Directory_Of(front_end);
+  bench->nb_plp = BENCHMARK_PLP_COUNT;
+  SiLabs_API_switch_to_standard(front_end, SILABS_DVB_T2, 0);
+  SiLabs_API_lock_to_carrier   (front_end, SILABS_DVB_T2, 474000000, 8000000, 0, 0, 0, 0, 0, 0, 0, 0);
+  SiLabs_PLP_Directory_Check   (directory, 0);
+  SiLabs_Benchmark_Start(bench, relock ? "plp_relock" : "plp_hop");
+  for (i=0; i<hops; i++) {
+    plp_id = (i + 1) % (bench->nb_plp - 1); /* data PLPs only */
+    bench->result.iterations++;
+    if (relock) {
+      if (SiLabs_API_lock_to_carrier(front_end, SILABS_DVB_T2, 474000000, 8000000, 0, 0, 0, 0, 0, 0, plp_id, 0) == 1) { bench->result.success++; }
+    } else {
+      if (SiLabs_PLP_Hop(directory, plp_id, PLP_HOP_TIMEOUT_MS) == 1) { bench->result.success++; }
+    }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"plps\":%d,\"plp_ms\":%d,\"lock_ms\":%d", bench->nb_plp, bench->plp_ms, bench->lock_ms);
+  success = SiLabs_Benchmark_Stop(bench);
+  bench->nb_plp = 0;
+  return success;
+}
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+ #ifdef    DEMOD_DVB_S_S2_DSS
+/************************************************************************************************************************
+  SiLabs_Benchmark_Stream_Switch function
+  Use:      'isi_switch' and 'isi_relock' scenarios
+            ISI changes on front-end 0, locked on a DVB-S2 transponder with BENCHMARK_ISI_COUNT ISIs,
+             using SiLabs_Stream_Switch (relock = 0) or SiLabs_API_lock_to_carrier (relock = 1)
+  Returns:  the number of successful ISI changes
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Stream_Switch          (SILABS_Benchmark *bench, signed   int switches, signed   int relock) {
+  SILABS_FE_Context       *front_end;
+  SILABS_Stream_Directory *directory;
+  signed   int             isi_id;
+  signed   int             success;
+  signed   int             i;
+  if (switches < 1) { switches = 1; }
+  if (bench->nb_front_ends < 1) { SiLabs_Benchmark_Setup(bench, 1); }
+  front_end     = &(FrontEnd_Table[0]);
+  directory     = SiLabs_Stream_Directory_Of(front_end);
+  bench->nb_isi = BENCHMARK_ISI_COUNT;
+  SiLabs_API_switch_to_standard(front_end, SILABS_DVB_S2, 0);
+#ifdef    Si2183_COMPATIBLE
+  if (front_end->chip ==   0x2183 ) { front_end->Si2183_FE->demod->MIS_capability = 1; } /* The emulated part info does not match a MIS-capable part */
+#endif /* Si2183_COMPATIBLE */
+  SiLabs_API_lock_to_carrier   (front_end, SILABS_DVB_S2, 1000000, 0, 0, 27500000, 0, 0, 0, 0, BENCHMARK_ISI_BASE, 0);
+  SiLabs_Stream_Directory_Check(directory, 0);
+  SiLabs_Benchmark_Start(bench, relock ? "isi_relock" : "isi_switch");
+  for (i=0; i<switches; i++) {
+    isi_id = BENCHMARK_ISI_BASE + (i + 1) % bench->nb_isi;
+    bench->result.iterations++;
+    if (relock) {
+      if (SiLabs_API_lock_to_carrier(front_end, SILABS_DVB_S2, 1000000, 0, 0, 27500000, 0, 0, 0, 0, isi_id, 0) == 1) { bench->result.success++; }
+    } else {
+      if (SiLabs_Stream_Switch(directory, isi_id, STREAM_SWITCH_TIMEOUT_MS) == 1) { bench->result.success++; }
+    }
+  }
+  snprintf(bench->result.params, sizeof(bench->result.params), "\"isis\":%d,\"isi_ms\":%d,\"lock_ms\":%d", bench->nb_isi, bench->isi_ms, bench->lock_ms);
+  success = SiLabs_Benchmark_Stop(bench);
+  bench->nb_isi = 0;
+  return success;
+}
+ #endif /* DEMOD_DVB_S_S2_DSS */
+#endif /* STREAM_DIRECTORY */
+/************************************************************************************************************************
+  SiLabs_Benchmark_All function
+  Use:      Runs all scenarios with default values, printing one JSON line per scenario
+  Returns:  the number of scenarios with all iterations successful
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_All                    (SILABS_Benchmark *bench) {
+  signed   int standards[10];
+  signed   int nb_standards;
+  signed   int passed;
+  signed   int i;
+  passed = 0;
+  nb_standards = SiLabs_Benchmark_Standards(standards);
+  bench->nb_scenarios = 0;
+  SiLabs_Benchmark_Cold_Boot (bench, 4);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Switch    (bench, 2);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Switch_Matrix(bench);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  for (i=0; i<nb_standards; i++) {
+    SiLabs_Benchmark_Zap     (bench, standards[i], 10);
+    printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  }
+#ifdef    DEMOD_DVB_S_S2_DSS
+  SiLabs_Benchmark_Blindscan (bench, 950000, 1950000);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* DEMOD_DVB_S_S2_DSS */
+#ifdef    DEMOD_DVB_T2
+  SiLabs_Benchmark_TER_Scan  (bench, 474000000, 666000000, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #ifdef    RSSI_PRESCREEN
+  SiLabs_Benchmark_TER_Scan  (bench, 474000000, 666000000, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #endif /* RSSI_PRESCREEN */
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_S_S2_DSS
+  SiLabs_Benchmark_Lock_Timeout(bench, 0, 30, 5);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #ifdef    ADAPTIVE_LOCK_TIMEOUT
+  SiLabs_Benchmark_Lock_Timeout(bench, 1, 30, 5);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #endif /* ADAPTIVE_LOCK_TIMEOUT */
+#endif /* DEMOD_DVB_S_S2_DSS */
+#ifdef    PLP_DIRECTORY
+ #ifdef    DEMOD_DVB_T2
+  SiLabs_Benchmark_PLP_Hop   (bench, 20, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_PLP_Hop   (bench, 20, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #endif /* DEMOD_DVB_T2 */
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+ #ifdef    DEMOD_DVB_S_S2_DSS
+  SiLabs_Benchmark_Stream_Switch(bench, 20, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Stream_Switch(bench, 20, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #endif /* DEMOD_DVB_S_S2_DSS */
+#endif /* STREAM_DIRECTORY */
+#ifdef    LINUX_SPIDEV_Capability
+  SiLabs_Benchmark_SPI_Boot  (bench, 4);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* LINUX_SPIDEV_Capability */
+#ifdef    WARM_ATTACH
+  SiLabs_Benchmark_Warm_Restart(bench, 4, Si2183_WARM_ATTACH_READ);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Warm_Restart(bench, 4, Si2183_WARM_ATTACH_SNAPSHOT);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* WARM_ATTACH */
+#ifdef    POWER_MANAGER
+  SiLabs_Benchmark_Power_Zap (bench, 12, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Power_Zap (bench, 12, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* POWER_MANAGER */
+#ifdef    TERRESTRIAL_FRONT_END
+  SiLabs_Benchmark_VCO_Zap   (bench, BENCHMARK_VCO_FRONT_ENDS, 24);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #ifdef    FRONTEND_REGISTRY
+  #ifdef    INDIRECT_I2C_CONNECTION
+  SiLabs_Benchmark_Registry  (bench, BENCHMARK_REGISTRY_FRONT_ENDS);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  #endif /* INDIRECT_I2C_CONNECTION */
+ #endif /* FRONTEND_REGISTRY */
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    HW_DISCOVERY
+  SiLabs_Benchmark_Discovery (bench, DISCOVERY_PROBE_MS);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+  SiLabs_Benchmark_TS_Route  (bench, BENCHMARK_TS_ROUTE_REROUTES);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+  SiLabs_Benchmark_Bonding_Failover(bench, BENCHMARK_BONDING_EVENTS);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+  SiLabs_Benchmark_TS_Clock  (bench, BENCHMARK_TS_CLOCK_FRONT_ENDS, BENCHMARK_TS_CLOCK_STEPS);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  SiLabs_Benchmark_Extended_Status(bench, BENCHMARK_EXTENDED_FRONT_ENDS, BENCHMARK_EXTENDED_SNAPSHOTS);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* EXTENDED_STATUS */
+  SiLabs_Benchmark_Status_Poll(bench, 16, 5);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Status_Export(bench, 16, 2000, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#ifdef    STATUS_EXPORT
+  SiLabs_Benchmark_Status_Export(bench, 16, 2000, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_Status_Export(bench, 16, 2000, 2);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+#endif /* STATUS_EXPORT */
+#ifdef    BENCHMARK_ATV_TUNER
+  SiLabs_Benchmark_ATV_Scan(bench, 1, 0);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #ifdef    ATV_PARALLEL_SCAN
+  SiLabs_Benchmark_ATV_Scan(bench, BENCHMARK_ATV_TUNERS, 1);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+  SiLabs_Benchmark_ATV_Scan(bench, BENCHMARK_ATV_TUNERS, 2);
+  printf("%s\n", bench->json); passed += (bench->result.success == bench->result.iterations); bench->nb_scenarios++;
+ #endif /* ATV_PARALLEL_SCAN */
+#endif /* BENCHMARK_ATV_TUNER */
+  return passed;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Benchmark_Test function
+  Use:      Benchmark test pipe function
+  Returns:  1 if the command is known, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Benchmark_Test                   (SILABS_Benchmark *bench, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int transaction_us;
+  signed   int byte_us;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+  if (bench->transaction_us + bench->byte_us == 0) { SiLabs_Benchmark_Init(bench, BENCHMARK_TRANSACTION_US, BENCHMARK_BYTE_US); }
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible benchmark test commands (each scenario returns a JSON line):\n\
+latency                           : set the emulated bus latency (sub_cmd '<transaction_us> <byte_us>')\n\
+lock_ms            <ms>           : set the emulated lock time\n\
+cold_boot          <nb_fe>\n\
+switch             <loops>\n\
+switch_matrix                     : switch_to_standard for each pair of standards (transitions traced)\n\
+zap                <standard>     : 10 lock_to_carrier in the given standard (SILABS_DVB_T = 0, ...)\n\
+blindscan                         : DVB-S2 blindscan from 950 to 1950 MHz\n\
+ter_scan                          : DVB-T2 channel scan from 474 to 858 MHz\n\
+ter_prescan                       : the same channel scan with the RSSI pre-screen     (with RSSI_PRESCREEN)\n\
+lock_fixed                        : DVB-S2 zaps without signal, default lock timeout\n\
+lock_adapt                        : the same zaps with the learned lock timeout        (with ADAPTIVE_LOCK_TIMEOUT)\n\
+status_poll        <seconds>      : 1 Hz status polling of 16 front-ends (limited to FRONT_END_COUNT)\n\
+status_text        <renders>      : text status of 16 front-ends, rendered <renders> times\n\
+status_export      <renders>      : binary status export of 16 front-ends             (with STATUS_EXPORT)\n\
+status_print       <renders>      : binary status export rendered as text             (with STATUS_EXPORT)\n\
+plp_hop            <hops>         : DVB-T2 PLP changes with SiLabs_PLP_Hop            (with PLP_DIRECTORY)\n\
+plp_relock         <hops>         : DVB-T2 PLP changes with SiLabs_API_lock_to_carrier (with PLP_DIRECTORY)\n\
+isi_switch         <switches>     : DVB-S2 ISI changes with SiLabs_Stream_Switch       (with STREAM_DIRECTORY and DEMOD_DVB_S_S2_DSS)\n\
+isi_relock         <switches>     : DVB-S2 ISI changes with SiLabs_API_lock_to_carrier (with STREAM_DIRECTORY and DEMOD_DVB_S_S2_DSS)\n\
+spi_boot           <nb_fe>        : cold_boot with SPI FW download on a spidev mock    (with LINUX_SPIDEV_Capability)\n\
+warm_restart       <nb_fe>        : restart on running parts, reading all properties   (with WARM_ATTACH)\n\
+warm_snapshot      <nb_fe>        : restart on running parts, using saved properties   (with WARM_ATTACH)\n\
+power_predict      <zaps>         : zaps over 4 front-ends with power manager pre-warm (with POWER_MANAGER)\n\
+power_demand       <zaps>         : the same zaps, with wake-up on demand only         (with POWER_MANAGER)\n\
+atv_scan                          : ATV M scan with SiLabs_ATV_Channel_Scan_M          (with TER_TUNER_Si2157)\n\
+atv_parallel       <nb_tuners>    : the same scan with the ATV scan coordinator        (with ATV_PARALLEL_SCAN)\n\
+atv_rescan         <nb_tuners>    : incremental re-scan after a channel change         (with ATV_PARALLEL_SCAN)\n\
+vco_zap            <nb_fe>        : 24 DVB-T zaps on front-ends in turn, with VCO blocking\n\
+registry           <nb_fe>        : nb_fe (128) front-ends in a front-end registry     (with FRONTEND_REGISTRY and INDIRECT_I2C_CONNECTION)\n\
+discovery          <probe_ms>     : discovery of an emulated 3 front-end board         (with HW_DISCOVERY)\n\
+ts_route           <reroutes>     : random reroutes of 8 front-ends over 6 TS ports    (with TS_CROSSBAR)\n\
+bonding_failover   <events>       : fades of the bonding legs in turn                  (with CHANNEL_BONDING)\n\
+ts_clock           <steps>        : adaptive TS clocks with varying TS bitrates        (with ADAPTIVE_TS_CLOCK)\n\
+extended_status    <snapshots>    : ISDB-T/DVB-T/T2 per-layer status vs. existing calls (with EXTENDED_STATUS)\n\
+all                               : all scenarios, printed to stdout\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "latency"            ) == 0) {
+    transaction_us = BENCHMARK_TRANSACTION_US;
+    byte_us        = BENCHMARK_BYTE_US;
+    sscanf(sub_cmd, "%d %d", &transaction_us, &byte_us);
+    SiLabs_Benchmark_Init(bench, transaction_us, byte_us);
+    snprintf(*rettxt, 1000, "emulated bus latency: %d us per transaction + %d us per byte\n", transaction_us, byte_us);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "lock_ms"            ) == 0) {
+    bench->lock_ms = (signed int)dval;
+    snprintf(*rettxt, 1000, "emulated lock time: %d ms\n", bench->lock_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "cold_boot"          ) == 0) { *retdval = SiLabs_Benchmark_Cold_Boot  (bench, (signed int)dval); }
+  else if (strcmp_nocase(cmd, "switch"             ) == 0) { *retdval = SiLabs_Benchmark_Switch     (bench, (signed int)dval); }
+  else if (strcmp_nocase(cmd, "switch_matrix"      ) == 0) { *retdval = SiLabs_Benchmark_Switch_Matrix(bench); }
+  else if (strcmp_nocase(cmd, "zap"                ) == 0) { *retdval = SiLabs_Benchmark_Zap        (bench, (signed int)dval, 10); }
+  else if (strcmp_nocase(cmd, "blindscan"          ) == 0) { *retdval = SiLabs_Benchmark_Blindscan  (bench, 950000, 1950000); }
+  else if (strcmp_nocase(cmd, "ter_scan"           ) == 0) { *retdval = SiLabs_Benchmark_TER_Scan   (bench, 474000000, 858000000, 0); }
+#ifdef    RSSI_PRESCREEN
+  else if (strcmp_nocase(cmd, "ter_prescan"        ) == 0) { *retdval = SiLabs_Benchmark_TER_Scan   (bench, 474000000, 858000000, 1); }
+#endif /* RSSI_PRESCREEN */
+  else if (strcmp_nocase(cmd, "lock_fixed"         ) == 0) { *retdval = SiLabs_Benchmark_Lock_Timeout(bench, 0, 30, 5); }
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  else if (strcmp_nocase(cmd, "lock_adapt"         ) == 0) { *retdval = SiLabs_Benchmark_Lock_Timeout(bench, 1, 30, 5); }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+  else if (strcmp_nocase(cmd, "status_poll"        ) == 0) { *retdval = SiLabs_Benchmark_Status_Poll(bench, 16, (signed int)dval); }
+  else if (strcmp_nocase(cmd, "status_text"        ) == 0) { *retdval = SiLabs_Benchmark_Status_Export(bench, 16, (signed int)dval, 0); }
+#ifdef    STATUS_EXPORT
+  else if (strcmp_nocase(cmd, "status_export"      ) == 0) { *retdval = SiLabs_Benchmark_Status_Export(bench, 16, (signed int)dval, 1); }
+  else if (strcmp_nocase(cmd, "status_print"       ) == 0) { *retdval = SiLabs_Benchmark_Status_Export(bench, 16, (signed int)dval, 2); }
+#endif /* STATUS_EXPORT */
+#ifdef    PLP_DIRECTORY
+  else if (strcmp_nocase(cmd, "plp_hop"            ) == 0) { *retdval = SiLabs_Benchmark_PLP_Hop    (bench, (signed int)dval, 0); }
+  else if (strcmp_nocase(cmd, "plp_relock"         ) == 0) { *retdval = SiLabs_Benchmark_PLP_Hop    (bench, (signed int)dval, 1); }
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+ #ifdef    DEMOD_DVB_S_S2_DSS
+  else if (strcmp_nocase(cmd, "isi_switch"         ) == 0) { *retdval = SiLabs_Benchmark_Stream_Switch(bench, (signed int)dval, 0); }
+  else if (strcmp_nocase(cmd, "isi_relock"         ) == 0) { *retdval = SiLabs_Benchmark_Stream_Switch(bench, (signed int)dval, 1); }
+ #endif /* DEMOD_DVB_S_S2_DSS */
+#endif /* STREAM_DIRECTORY */
+#ifdef    LINUX_SPIDEV_Capability
+  else if (strcmp_nocase(cmd, "spi_boot"           ) == 0) { *retdval = SiLabs_Benchmark_SPI_Boot   (bench, (signed int)dval); }
+#endif /* LINUX_SPIDEV_Capability */
+#ifdef    WARM_ATTACH
+  else if (strcmp_nocase(cmd, "warm_restart"       ) == 0) { *retdval = SiLabs_Benchmark_Warm_Restart(bench, (signed int)dval, Si2183_WARM_ATTACH_READ    ); }
+  else if (strcmp_nocase(cmd, "warm_snapshot"      ) == 0) { *retdval = SiLabs_Benchmark_Warm_Restart(bench, (signed int)dval, Si2183_WARM_ATTACH_SNAPSHOT); }
+#endif /* WARM_ATTACH */
+#ifdef    POWER_MANAGER
+  else if (strcmp_nocase(cmd, "power_predict"      ) == 0) { *retdval = SiLabs_Benchmark_Power_Zap  (bench, (signed int)dval, 1); }
+  else if (strcmp_nocase(cmd, "power_demand"       ) == 0) { *retdval = SiLabs_Benchmark_Power_Zap  (bench, (signed int)dval, 0); }
+#endif /* POWER_MANAGER */
+#ifdef    TERRESTRIAL_FRONT_END
+  else if (strcmp_nocase(cmd, "vco_zap"            ) == 0) { *retdval = SiLabs_Benchmark_VCO_Zap    (bench, (dval < 2) ? BENCHMARK_VCO_FRONT_ENDS : (signed int)dval, 24); }
+ #ifdef    FRONTEND_REGISTRY
+  #ifdef    INDIRECT_I2C_CONNECTION
+  else if (strcmp_nocase(cmd, "registry"           ) == 0) { *retdval = SiLabs_Benchmark_Registry   (bench, (signed int)dval); }
+  #endif /* INDIRECT_I2C_CONNECTION */
+ #endif /* FRONTEND_REGISTRY */
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    HW_DISCOVERY
+  else if (strcmp_nocase(cmd, "discovery"          ) == 0) { *retdval = SiLabs_Benchmark_Discovery  (bench, (signed int)dval); }
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+  else if (strcmp_nocase(cmd, "ts_route"           ) == 0) { *retdval = SiLabs_Benchmark_TS_Route   (bench, (dval < 1) ? BENCHMARK_TS_ROUTE_REROUTES : (signed int)dval); }
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+  else if (strcmp_nocase(cmd, "bonding_failover"   ) == 0) { *retdval = SiLabs_Benchmark_Bonding_Failover(bench, (dval < 1) ? BENCHMARK_BONDING_EVENTS : (signed int)dval); }
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+  else if (strcmp_nocase(cmd, "ts_clock"           ) == 0) { *retdval = SiLabs_Benchmark_TS_Clock   (bench, BENCHMARK_TS_CLOCK_FRONT_ENDS, (dval < 1) ? BENCHMARK_TS_CLOCK_STEPS : (signed int)dval); }
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  else if (strcmp_nocase(cmd, "extended_status"    ) == 0) { *retdval = SiLabs_Benchmark_Extended_Status(bench, BENCHMARK_EXTENDED_FRONT_ENDS, (dval < 1) ? BENCHMARK_EXTENDED_SNAPSHOTS : (signed int)dval); }
+#endif /* EXTENDED_STATUS */
+#ifdef    BENCHMARK_ATV_TUNER
+  else if (strcmp_nocase(cmd, "atv_scan"           ) == 0) { *retdval = SiLabs_Benchmark_ATV_Scan   (bench, 1, 0); }
+ #ifdef    ATV_PARALLEL_SCAN
+  else if (strcmp_nocase(cmd, "atv_parallel"       ) == 0) { *retdval = SiLabs_Benchmark_ATV_Scan   (bench, (dval < 1) ? BENCHMARK_ATV_TUNERS : (signed int)dval, 1); }
+  else if (strcmp_nocase(cmd, "atv_rescan"         ) == 0) { *retdval = SiLabs_Benchmark_ATV_Scan   (bench, (dval < 1) ? BENCHMARK_ATV_TUNERS : (signed int)dval, 2); }
+ #endif /* ATV_PARALLEL_SCAN */
+#endif /* BENCHMARK_ATV_TUNER */
+  else if (strcmp_nocase(cmd, "all"                ) == 0) {
+    *retdval = SiLabs_Benchmark_All(bench);
+    snprintf(*rettxt, 1000, "%d scenarios passed\n", (signed int)*retdval);
+    return 1;
+  }
+  else { return 0; }
+  snprintf(*rettxt, 1000, "%s\n", bench->json);
+  return 1;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    SILABS_BENCHMARK_MAIN
+/************************************************************************************************************************
+  main function (standalone benchmark)
+  Use:      benchmark [-latency <transaction_us> <byte_us>] [-fe <nb_front_ends>] [scenario ...]
+            scenarios: cold_boot, switch, switch_matrix, zap, blindscan, status_poll, plp_hop, plp_relock, isi_switch, isi_relock, spi_boot, warm_restart, warm_snapshot,
+             power_predict, power_demand, ter_scan, ter_prescan, lock_fixed, lock_adapt, status_text, status_export, status_print,
+             atv_scan, atv_parallel, atv_rescan, vco_zap, registry, discovery, ts_route, bonding_failover, ts_clock, extended_status, all (default)
+  Returns:  0 if all iterations of all scenarios are successful, 1 otherwise
+************************************************************************************************************************/
+int main (int argc, char *argv[]) {
+  SILABS_Benchmark *bench;
+  signed   int      standards[10];
+  signed   int      nb_standards;
+  signed   int      nb_front_ends;
+  signed   int      failed;
+  signed   int      scenarios;
+  signed   int      i;
+  signed   int      s;
+  bench         = &Benchmark_Context;
+  nb_front_ends = 4;
+  failed        = 0;
+  scenarios     = 0;
+  nb_standards  = SiLabs_Benchmark_Standards(standards);
+#ifdef    SiTRACES
+  SiTraceDefaultConfiguration();
+  SiTraceConfiguration("traces -output none"); /* Only the JSON lines on stdout */
+#endif /* SiTRACES */
+  SiLabs_Benchmark_Init(bench, BENCHMARK_TRANSACTION_US, BENCHMARK_BYTE_US);
+  for (i=1; i<argc; i++) {
+    if      ( (strcmp(argv[i], "-latency") == 0) && (i+2 < argc) ) { SiLabs_Benchmark_Init(bench, atoi(argv[i+1]), atoi(argv[i+2])); i = i + 2; continue; }
+    else if ( (strcmp(argv[i], "-fe"     ) == 0) && (i+1 < argc) ) { nb_front_ends = atoi(argv[i+1]); i++; continue; }
+    scenarios++;
+    if      (strcmp(argv[i], "cold_boot"  ) == 0) { SiLabs_Benchmark_Cold_Boot  (bench, nb_front_ends);   printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "switch"     ) == 0) { SiLabs_Benchmark_Switch     (bench, 2);               printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "switch_matrix") == 0) { SiLabs_Benchmark_Switch_Matrix(bench);              printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "blindscan"  ) == 0) { SiLabs_Benchmark_Blindscan  (bench, 950000, 1950000); printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "ter_scan"   ) == 0) { SiLabs_Benchmark_TER_Scan   (bench, 474000000, 858000000, 0); printf("%s\n", bench->json); }
+#ifdef    RSSI_PRESCREEN
+    else if (strcmp(argv[i], "ter_prescan") == 0) { SiLabs_Benchmark_TER_Scan   (bench, 474000000, 858000000, 1); printf("%s\n", bench->json); }
+#endif /* RSSI_PRESCREEN */
+    else if (strcmp(argv[i], "lock_fixed" ) == 0) { SiLabs_Benchmark_Lock_Timeout(bench, 0, 30, 5); printf("%s\n", bench->json); }
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+    else if (strcmp(argv[i], "lock_adapt" ) == 0) { SiLabs_Benchmark_Lock_Timeout(bench, 1, 30, 5); printf("%s\n", bench->json); }
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+    else if (strcmp(argv[i], "status_poll") == 0) { SiLabs_Benchmark_Status_Poll(bench, 16, 5);           printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "status_text") == 0) { SiLabs_Benchmark_Status_Export(bench, 16, 2000, 0);   printf("%s\n", bench->json); }
+#ifdef    STATUS_EXPORT
+    else if (strcmp(argv[i], "status_export") == 0) { SiLabs_Benchmark_Status_Export(bench, 16, 2000, 1); printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "status_print" ) == 0) { SiLabs_Benchmark_Status_Export(bench, 16, 2000, 2); printf("%s\n", bench->json); }
+#endif /* STATUS_EXPORT */
+#ifdef    PLP_DIRECTORY
+    else if (strcmp(argv[i], "plp_hop"    ) == 0) { SiLabs_Benchmark_PLP_Hop    (bench, 20, 0);           printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "plp_relock" ) == 0) { SiLabs_Benchmark_PLP_Hop    (bench, 20, 1);           printf("%s\n", bench->json); }
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+ #ifdef    DEMOD_DVB_S_S2_DSS
+    else if (strcmp(argv[i], "isi_switch" ) == 0) { SiLabs_Benchmark_Stream_Switch(bench, 20, 0);         printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "isi_relock" ) == 0) { SiLabs_Benchmark_Stream_Switch(bench, 20, 1);         printf("%s\n", bench->json); }
+ #endif /* DEMOD_DVB_S_S2_DSS */
+#endif /* STREAM_DIRECTORY */
+#ifdef    LINUX_SPIDEV_Capability
+    else if (strcmp(argv[i], "spi_boot"   ) == 0) { SiLabs_Benchmark_SPI_Boot   (bench, nb_front_ends);   printf("%s\n", bench->json); }
+#endif /* LINUX_SPIDEV_Capability */
+#ifdef    WARM_ATTACH
+    else if (strcmp(argv[i], "warm_restart" ) == 0) { SiLabs_Benchmark_Warm_Restart(bench, nb_front_ends, Si2183_WARM_ATTACH_READ    ); printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "warm_snapshot") == 0) { SiLabs_Benchmark_Warm_Restart(bench, nb_front_ends, Si2183_WARM_ATTACH_SNAPSHOT); printf("%s\n", bench->json); }
+#endif /* WARM_ATTACH */
+#ifdef    POWER_MANAGER
+    else if (strcmp(argv[i], "power_predict") == 0) { SiLabs_Benchmark_Power_Zap(bench, 12, 1); printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "power_demand" ) == 0) { SiLabs_Benchmark_Power_Zap(bench, 12, 0); printf("%s\n", bench->json); }
+#endif /* POWER_MANAGER */
+#ifdef    TERRESTRIAL_FRONT_END
+    else if (strcmp(argv[i], "vco_zap"      ) == 0) { SiLabs_Benchmark_VCO_Zap (bench, BENCHMARK_VCO_FRONT_ENDS, 24); printf("%s\n", bench->json); }
+ #ifdef    FRONTEND_REGISTRY
+  #ifdef    INDIRECT_I2C_CONNECTION
+    else if (strcmp(argv[i], "registry"     ) == 0) { SiLabs_Benchmark_Registry(bench, BENCHMARK_REGISTRY_FRONT_ENDS); printf("%s\n", bench->json); }
+  #endif /* INDIRECT_I2C_CONNECTION */
+ #endif /* FRONTEND_REGISTRY */
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    HW_DISCOVERY
+    else if (strcmp(argv[i], "discovery"    ) == 0) { SiLabs_Benchmark_Discovery(bench, DISCOVERY_PROBE_MS); printf("%s\n", bench->json); }
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+    else if (strcmp(argv[i], "ts_route"     ) == 0) { SiLabs_Benchmark_TS_Route(bench, BENCHMARK_TS_ROUTE_REROUTES); printf("%s\n", bench->json); }
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+    else if (strcmp(argv[i], "bonding_failover") == 0) { SiLabs_Benchmark_Bonding_Failover(bench, BENCHMARK_BONDING_EVENTS); printf("%s\n", bench->json); }
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+    else if (strcmp(argv[i], "ts_clock"     ) == 0) { SiLabs_Benchmark_TS_Clock(bench, BENCHMARK_TS_CLOCK_FRONT_ENDS, BENCHMARK_TS_CLOCK_STEPS); printf("%s\n", bench->json); }
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+    else if (strcmp(argv[i], "extended_status") == 0) { SiLabs_Benchmark_Extended_Status(bench, BENCHMARK_EXTENDED_FRONT_ENDS, BENCHMARK_EXTENDED_SNAPSHOTS); printf("%s\n", bench->json); }
+#endif /* EXTENDED_STATUS */
+#ifdef    BENCHMARK_ATV_TUNER
+    else if (strcmp(argv[i], "atv_scan"     ) == 0) { SiLabs_Benchmark_ATV_Scan(bench, 1, 0); printf("%s\n", bench->json); }
+ #ifdef    ATV_PARALLEL_SCAN
+    else if (strcmp(argv[i], "atv_parallel" ) == 0) { SiLabs_Benchmark_ATV_Scan(bench, nb_front_ends, 1); printf("%s\n", bench->json); }
+    else if (strcmp(argv[i], "atv_rescan"   ) == 0) { SiLabs_Benchmark_ATV_Scan(bench, nb_front_ends, 2); printf("%s\n", bench->json); }
+ #endif /* ATV_PARALLEL_SCAN */
+#endif /* BENCHMARK_ATV_TUNER */
+    else if (strcmp(argv[i], "zap"        ) == 0) {
+      for (s=0; s<nb_standards; s++) {
+        SiLabs_Benchmark_Zap(bench, standards[s], 10);
+        printf("%s\n", bench->json);
+        failed += (bench->result.success != bench->result.iterations);
+      }
+      continue;
+    }
+    else if (strcmp(argv[i], "all"        ) == 0) { failed += (SiLabs_Benchmark_All(bench) == 0); continue; }
+    else { printf("unknown scenario '%s'\n", argv[i]); return 1; }
+    failed += (bench->result.success != bench->result.iterations);
+  }
+  if (scenarios == 0) {
+    i = SiLabs_Benchmark_All(bench);
+    failed = (i != bench->nb_scenarios);
+  }
+  return (failed != 0);
+}
+#endif /* SILABS_BENCHMARK_MAIN */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SILABS_BENCHMARK */
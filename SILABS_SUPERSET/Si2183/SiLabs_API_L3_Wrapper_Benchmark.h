@@ -0,0 +1,274 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Benchmark_H_
+#define  _SiLabs_API_L3_Wrapper_Benchmark_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[SIMU/benchmark] Adding an emulator-backed benchmark via SiLabs_API_L3_Wrapper_Benchmark.c/.h
+        Typical scenarios are run on emulated demodulators and tuners, using the L0 SIMU connection.
+  <new_feature>[T2/MPLP] Adding the emulation of multiple PLP DVB-T2 multiplexes and the 'plp_hop' scenario (when PLP_DIRECTORY is defined).
+  <new_feature>[S2X/MULTISTREAM] Adding the emulation of multistream DVB-S2 transponders and the 'isi_switch' scenario (when STREAM_DIRECTORY is defined).
+  <new_feature>[SPI/spidev] Adding a spidev mock and the 'spi_boot' scenario (when LINUX_SPIDEV_Capability is defined).
+  <new_feature>[INIT/Warm_attach] Adding GET_PROPERTY emulation and the 'warm_restart' scenarios (when WARM_ATTACH is defined).
+  <new_feature>[power_consumption/Power_manager] Adding POWER_DOWN/resume emulation and the 'power_predict' scenario (when POWER_MANAGER is defined).
+  <new_feature>[Status/Export] Adding the 'status_text' and 'status_export' scenarios (status_export when STATUS_EXPORT is defined).
+  <new_feature>[ATV/scan] Adding the emulation of analog channels in the TER tuners and the 'atv_scan' scenarios (when TER_TUNER_Si2157 is defined).
+  <new_feature>[VCO_Blocking] Adding the emulation of the TER tuners VCO codes and blocked VCO properties, and the 'vco_zap' scenario.
+  <new_feature>[multi_front_end/registry] Adding SiLabs_Benchmark_FE_Attach and the 'registry' scenario (when FRONTEND_REGISTRY is defined).
+  <new_feature>[INIT/discovery] Adding the emulation of the i2c pass-through and of register-based or absent parts,
+        and the 'discovery' scenario (when HW_DISCOVERY is defined).
+  <new_feature>[switch/profiling] Adding the 'switch_matrix' scenario.
+  <new_feature>[TS_Crossbar/Router] Adding the 'ts_route' scenario (when TS_CROSSBAR is defined).
+  <new_feature>[Channel_Bonding/Supervisor] Adding the emulation of signal fades and the 'bonding_failover' scenario (when CHANNEL_BONDING is defined).
+  <new_feature>[TS/adaptive_clock] Adding the emulation of TS bitrates and TS clocks and the 'ts_clock' scenario (when ADAPTIVE_TS_CLOCK is defined).
+  <new_feature>[STATUS/extended] Adding the emulation of ISDB-T layers, DVB-T hierarchy, T2 PLP modulations and BER/PER/FER,
+        and the 'extended_status' scenario (when EXTENDED_STATUS is defined).
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCHMARK_MAX_CHIPS          (2*FRONT_END_COUNT)
+#define BENCHMARK_RESPONSE_SIZE       16
+#define BENCHMARK_MAX_CARRIERS        64
+#define BENCHMARK_PARAMS_SIZE        256  /* Scenario parameters, large enough for the longest scenario with any int values */
+#define BENCHMARK_RESULT_SIZE       1024  /* JSON line: BENCHMARK_PARAMS_SIZE plus the common fields with any values     */
+
+#define BENCHMARK_TRANSACTION_US     100  /* Default emulated duration of an i2c transaction (start, address, stop) */
+#define BENCHMARK_BYTE_US             23  /* Default emulated duration of a byte (9 bits at 400 kHz)              */
+#define BENCHMARK_BUSY_POLLS           1  /* Default number of 'not CTS' polls before each response               */
+#define BENCHMARK_LOCK_MS            100  /* Default emulated lock time after DD_RESTART                          */
+#define BENCHMARK_SCAN_MS             30  /* Default emulated blindscan analysis time per event                   */
+#define BENCHMARK_PLP_MS              50  /* Emulated time to deliver a new PLP after PLP_SELECT                   */
+#define BENCHMARK_PLP_COUNT            8  /* Number of PLPs in the emulated multiple PLP multiplex (plp_hop)       */
+#define BENCHMARK_ISI_MS              50  /* Emulated time to deliver a new ISI after STREAM_SELECT                */
+#define BENCHMARK_ISI_COUNT            6  /* Number of ISIs in the emulated multistream transponder (isi_switch)  */
+#define BENCHMARK_ISI_BASE            10  /* ISI id of the first emulated ISI (the ISI ids are not the ISI indexes) */
+#define BENCHMARK_SPI_HZ        10000000  /* Default emulated SPI clock (spi_boot)                                 */
+#define BENCHMARK_SPI_MESSAGE_US      50  /* Emulated overhead of each SPI_IOC_MESSAGE ioctl (spi_boot)           */
+#define BENCHMARK_POWER_FRONT_ENDS     4  /* Number of front-ends used in the power manager scenarios             */
+#define BENCHMARK_SCAN_WINDOW_KHZ  40000  /* Emulated blindscan tuner window                                      */
+#define BENCHMARK_NO_SIGNAL_MS       300  /* Emulated 'no signal' decision time after DD_RESTART (ter_scan)       */
+#define BENCHMARK_TER_RSSI_DBM       -45  /* Emulated TER tuner RSSI on a channel carrying a signal (ter_scan)    */
+#define BENCHMARK_TER_FLOOR_DBM      -95  /* Emulated TER tuner RSSI on an empty channel (ter_scan)              */
+#define BENCHMARK_LOCK_JITTER_MS      60  /* Emulated lock time spread in the lock timeout scenarios              */
+#define BENCHMARK_ATV_MS              20  /* Emulated ATVINT delay after an ATV TUNER_TUNE_FREQ on an analog channel */
+#define BENCHMARK_ATV_AFC_HZ     1500000  /* Emulated AFC range: analog channels are found up to 1.5 MHz away       */
+#define BENCHMARK_ATV_TUNERS           4  /* Number of tuners used in the 'atv_parallel' scenario                  */
+#define BENCHMARK_VCO_FRONT_ENDS       8  /* Number of front-ends used in the 'vco_zap' scenario                   */
+#define BENCHMARK_REGISTRY_FRONT_ENDS 128  /* Number of front-ends used in the 'registry' scenario                  */
+#define BENCHMARK_REGISTRY_PER_BOARD    8  /* Number of front-ends per board in the 'registry' scenario             */
+#define BENCHMARK_REGISTRY_LOOKUPS   1000  /* Number of lookups of all handles in the 'registry' scenario           */
+#define BENCHMARK_DISCOVERY_DEVICES    11  /* Number of parts to discover in the 'discovery' scenario              */
+#define BENCHMARK_TS_ROUTE_FRONT_ENDS   8  /* Number of front-ends (4 duals) used in the 'ts_route' scenario       */
+#define BENCHMARK_TS_ROUTE_REROUTES   200  /* Number of reroutes in the 'ts_route' scenario                        */
+#define BENCHMARK_BONDING_EVENTS       12  /* Number of leg fades in the 'bonding_failover' scenario               */
+#define BENCHMARK_BONDING_POLL_MS      10  /* Time between supervisor polls in the 'bonding_failover' scenario     */
+#define BENCHMARK_BONDING_MAX_POLLS    50  /* Maximum number of polls to degrade or recover a leg                  */
+#define BENCHMARK_TS_CLOCK_FRONT_ENDS   8  /* Number of front-ends used in the 'ts_clock' scenario                 */
+#define BENCHMARK_TS_CLOCK_STEPS      200  /* Number of TS bitrate steps in the 'ts_clock' scenario                */
+#define BENCHMARK_EXTENDED_FRONT_ENDS   6  /* Number of front-ends used in the 'extended_status' scenario          */
+#define BENCHMARK_EXTENDED_SNAPSHOTS   20  /* Number of status snapshots per method in the 'extended_status' scenario */
+
+#define BENCHMARK_DEMOD_ADDRESS     0x80  /* Emulated demodulators are at 0x80 + 2*fe_index                        */
+#define BENCHMARK_TER_ADDRESS       0xc0  /* Emulated TER tuners    are at 0xc0 + 2*fe_index                        */
+#define BENCHMARK_SAT_ADDRESS       0x40  /* SAT tuners (register-based) use the SIMU Byte[] memory                 */
+#define BENCHMARK_LNB_ADDRESS       0x10
+
+/* possible values for the emulated chip kinds */
+typedef enum  _SILABS_Benchmark_Chip_Kind         {
+  BENCHMARK_CHIP_DEMOD    = 1,
+  BENCHMARK_CHIP_TUNER    = 2,
+  BENCHMARK_CHIP_REGISTER = 3, /* register-based part: any transaction is acknowledged, reads return 0x00 */
+  BENCHMARK_CHIP_ABSENT   = 4  /* no part: any transaction fails (NACK)                                  */
+} SILABS_Benchmark_Chip_Kind;
+
+/* Structure used to store the state of one emulated command-mode chip */
+typedef struct _SILABS_Benchmark_Chip             {
+  struct _SILABS_Benchmark     *bench;           /* emulation parameters (busy_polls, lock_ms, scan_ms, carriers) */
+  unsigned char                 address;
+  SILABS_Benchmark_Chip_Kind    kind;
+  struct _SILABS_Benchmark_Chip *parent;         /* demodulator providing the i2c pass-through, NULL if on the bus  */
+  signed   int                  passthru;        /* demodulator i2c pass-through state (1 when closed)              */
+  unsigned char                 part_info[13];
+  unsigned char                 get_rev[10];
+  unsigned char                 response[BENCHMARK_RESPONSE_SIZE];
+  signed   int                  busy;            /* remaining 'not CTS' polls before the response is available */
+  signed   int                  booting;         /* 1 between POWER_UP and EXIT_BOOTLOADER                     */
+  signed   int                  reset;           /* 1 between RESET_HW and POWER_UP (status byte 0xFE)         */
+  signed   int                  standby;         /* 1 between POWER_DOWN and POWER_UP                          */
+  signed   int                  modulation;      /* last DD_MODE modulation                                    */
+  signed   int                  auto_detect;     /* last DD_MODE auto_detect                                   */
+  signed   int                  restart_ms;      /* time of the last DD_RESTART                                */
+  signed   int                  no_signal;       /* 1 if there was no signal at the last DD_RESTART            */
+  signed   int                  lock_after_ms;   /* lock time drawn at the last DD_RESTART                     */
+  signed   int                  fading;          /* 1 while the signal is lost (no lock, whatever DD_RESTART)  */
+  signed   int                  ts_kbps;         /* TS bitrate reported by DD_STATUS (0 for 38560 kbps)        */
+  signed   int                  tuned_hz;        /* TER tuner frequency (last TUNER_TUNE_FREQ)                 */
+  signed   int                  atv_tuned;       /* 1 after an ATV TUNER_TUNE_FREQ, until ATV_STATUS with INTACK */
+  signed   int                  atv_tune_ms;     /* time of the last ATV TUNER_TUNE_FREQ                       */
+  signed   int                  atv_video_sys;   /* last ATV_VIDEO_MODE video_sys                              */
+  signed   int                  atv_color;       /* last ATV_VIDEO_MODE color                                  */
+  signed   int                  blocked_vco[3];  /* last TUNER_BLOCKED_VCO, VCO2 and VCO3 values               */
+  signed   int                  scan_fmax_khz;
+  signed   int                  scan_tuned_khz;
+  signed   int                  scan_found_khz;  /* last reported carrier                                      */
+  signed   int                  scan_ready_ms;   /* time at which the next scan event is available            */
+  signed   int                  scan_event;      /* next scan_status value, 0 when idle                        */
+  signed   int                  scan_int;        /* scanint bit in the status byte                             */
+  signed   int                  scan_freq_khz;
+  signed   int                  scan_symb_rate;
+  signed   int                  plp_id;          /* PLP currently delivered                                    */
+  signed   int                  plp_target;      /* PLP selected by the last PLP_SELECT                        */
+  signed   int                  plp_ready_ms;    /* time at which plp_target is delivered, 0 when done         */
+  signed   int                  isi_id;          /* ISI currently delivered                                    */
+  signed   int                  isi_target;      /* ISI selected by the last STREAM_SELECT                     */
+  signed   int                  isi_ready_ms;    /* time at which isi_target is delivered, 0 when done         */
+  Si2183_PropObj                prop;            /* property values set by SET_PROPERTY, read by GET_PROPERTY  */
+  unsigned long                 commands;
+  unsigned long                 polls;
+  unsigned long                 busy_polls;
+  unsigned long                 fw_bytes;
+} SILABS_Benchmark_Chip;
+
+/* Structure used to store the results of one benchmark scenario */
+typedef struct _SILABS_Benchmark_Result           {
+  const char                   *scenario;
+  char                          params[BENCHMARK_PARAMS_SIZE];
+  signed   int                  iterations;
+  signed   int                  success;
+  signed   int                  wall_ms;
+  signed   int                  cpu_ms;
+  signed   int                  wait_ms;         /* part of cpu_ms spent busy-waiting in system_wait */
+  L0_Simu_Stats                 i2c;
+  unsigned long                 commands;
+  unsigned long                 cts_polls;
+  unsigned long                 busy_polls;
+  unsigned long                 fw_bytes;
+} SILABS_Benchmark_Result;
+
+/* Structure used to store all benchmark information */
+typedef struct _SILABS_Benchmark                  {
+  SILABS_Benchmark_Chip         chip[BENCHMARK_MAX_CHIPS];
+  signed   int                  nb_chips;
+  signed   int                  nb_front_ends;   /* number of configured front-ends */
+  signed   int                  transaction_us;
+  signed   int                  byte_us;
+  signed   int                  busy_polls;
+  signed   int                  lock_ms;
+  signed   int                  lock_jitter_ms;  /* lock times are drawn between lock_ms and lock_ms + lock_jitter_ms */
+  unsigned long                 seed;
+  signed   int                  no_signal;       /* 1 to emulate DD_RESTARTs without any signal                  */
+  signed   int                  scan_ms;
+  signed   int                  nb_plp;          /* number of PLPs in the emulated DVB-T2 multiplexes, 0 for single PLP */
+  signed   int                  plp_ms;
+  signed   int                  nb_isi;          /* number of ISIs in the emulated DVB-S2 transponders, 0 for single stream */
+  signed   int                  isi_ms;
+  signed   int                  layered;         /* 1 to emulate hierarchical DVB-T, 3 ISDB-T layers, T2 PLP modulations and BER/PER/FER */
+  signed   int                  spi_hz;          /* emulated SPI clock frequency                                 */
+  signed   int                  spi_debt_us;     /* emulated SPI bus time not yet applied using system_wait      */
+  signed   int                  carrier_khz[BENCHMARK_MAX_CARRIERS];
+  signed   int                  nb_carriers;
+  signed   int                  ter_carrier_hz[BENCHMARK_MAX_CARRIERS];
+  signed   int                  nb_ter_carriers; /* number of emulated TER channels, 0 when all frequencies carry a signal */
+  signed   int                  atv_carrier_hz[BENCHMARK_MAX_CARRIERS];  /* picture carrier frequencies               */
+  signed   int                  atv_video_sys[BENCHMARK_MAX_CARRIERS];   /* SILABS_VIDEO_SYS_xx                       */
+  signed   int                  nb_atv_carriers; /* number of emulated analog channels                           */
+  signed   int                  vco_others;      /* TER tunes x other tuned TER tuners (vco_zap)                 */
+  signed   int                  vco_blocked;     /* part of vco_others with the other tuner's VCO code blocked at tune time */
+  signed   int                  start_wall_ms;
+  clock_t                       start_cpu;
+  SILABS_Benchmark_Result       result;
+  signed   int                  nb_scenarios;    /* number of scenarios run by SiLabs_Benchmark_All */
+  char                          json[BENCHMARK_RESULT_SIZE];
+} SILABS_Benchmark;
+
+extern SILABS_Benchmark  Benchmark_Context;
+
+signed   int   SiLabs_Benchmark_Init                   (SILABS_Benchmark *bench, signed   int transaction_us, signed   int byte_us);
+signed   int   SiLabs_Benchmark_FE_Attach              (SILABS_Benchmark *bench, SILABS_FE_Context *front_end, signed   int chip_index, signed   int connection);
+signed   int   SiLabs_Benchmark_FE_Init                (SILABS_Benchmark *bench, signed   int fe_index);
+signed   int   SiLabs_Benchmark_Setup                  (SILABS_Benchmark *bench, signed   int nb_front_ends);
+signed   int   SiLabs_Benchmark_Cold_Boot              (SILABS_Benchmark *bench, signed   int nb_front_ends);
+signed   int   SiLabs_Benchmark_Switch                 (SILABS_Benchmark *bench, signed   int loops);
+signed   int   SiLabs_Benchmark_Switch_Matrix          (SILABS_Benchmark *bench);
+signed   int   SiLabs_Benchmark_Zap                    (SILABS_Benchmark *bench, signed   int standard, signed   int zaps);
+signed   int   SiLabs_Benchmark_Blindscan              (SILABS_Benchmark *bench, signed   int start_khz, signed   int stop_khz);
+signed   int   SiLabs_Benchmark_TER_Scan               (SILABS_Benchmark *bench, signed   int start_hz, signed   int stop_hz, signed   int prescreen);
+signed   int   SiLabs_Benchmark_Lock_Timeout           (SILABS_Benchmark *bench, signed   int adaptive, signed   int learn, signed   int fails);
+signed   int   SiLabs_Benchmark_Status_Poll            (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int seconds);
+signed   int   SiLabs_Benchmark_Status_Export          (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int renders, signed   int mode);
+#ifdef    TERRESTRIAL_FRONT_END
+signed   int   SiLabs_Benchmark_VCO_Zap                (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int zaps);
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    FRONTEND_REGISTRY
+ #ifdef    TERRESTRIAL_FRONT_END
+  #ifdef    INDIRECT_I2C_CONNECTION
+signed   int   SiLabs_Benchmark_Registry               (SILABS_Benchmark *bench, signed   int nb_front_ends);
+  #endif /* INDIRECT_I2C_CONNECTION */
+ #endif /* TERRESTRIAL_FRONT_END */
+#endif /* FRONTEND_REGISTRY */
+#ifdef    HW_DISCOVERY
+signed   int   SiLabs_Benchmark_Discovery              (SILABS_Benchmark *bench, signed   int probe_ms);
+#endif /* HW_DISCOVERY */
+#ifdef    TS_CROSSBAR
+signed   int   SiLabs_Benchmark_TS_Route               (SILABS_Benchmark *bench, signed   int reroutes);
+#endif /* TS_CROSSBAR */
+#ifdef    CHANNEL_BONDING
+signed   int   SiLabs_Benchmark_Bonding_Failover       (SILABS_Benchmark *bench, signed   int events);
+#endif /* CHANNEL_BONDING */
+#ifdef    ADAPTIVE_TS_CLOCK
+signed   int   SiLabs_Benchmark_TS_Clock               (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int steps);
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+signed   int   SiLabs_Benchmark_Extended_Status        (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int snapshots);
+#endif /* EXTENDED_STATUS */
+#ifdef    TER_TUNER_Si2157
+signed   int   SiLabs_Benchmark_ATV_Scan               (SILABS_Benchmark *bench, signed   int nb_tuners, signed   int mode);
+#endif /* TER_TUNER_Si2157 */
+#ifdef    PLP_DIRECTORY
+signed   int   SiLabs_Benchmark_PLP_Hop                (SILABS_Benchmark *bench, signed   int hops, signed   int relock);
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+ #ifdef    DEMOD_DVB_S_S2_DSS
+signed   int   SiLabs_Benchmark_Stream_Switch          (SILABS_Benchmark *bench, signed   int switches, signed   int relock);
+ #endif /* DEMOD_DVB_S_S2_DSS */
+#endif /* STREAM_DIRECTORY */
+#ifdef    LINUX_SPIDEV_Capability
+int            SiLabs_Benchmark_SPIDEV_ioctl           (int fd, unsigned long request, void *arg);
+signed   int   SiLabs_Benchmark_SPI_Boot               (SILABS_Benchmark *bench, signed   int nb_front_ends);
+#endif /* LINUX_SPIDEV_Capability */
+#ifdef    POWER_MANAGER
+signed   int   SiLabs_Benchmark_Power_Zap              (SILABS_Benchmark *bench, signed   int zaps, signed   int predict);
+#endif /* POWER_MANAGER */
+#ifdef    WARM_ATTACH
+signed   int   SiLabs_Benchmark_Warm_Restart           (SILABS_Benchmark *bench, signed   int nb_front_ends, signed   int mode);
+#endif /* WARM_ATTACH */
+signed   int   SiLabs_Benchmark_All                    (SILABS_Benchmark *bench);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Benchmark_Test                   (SILABS_Benchmark *bench, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Benchmark_H_ */
@@ -50,6 +50,14 @@ limitations under the License.
 /* Change log: */
 /* Last  changes:
 
+  As from V2.8.1:
+   <new_feature>[Channel_Bonding/Supervisor] Adding the bonding supervisor:
+    SiLabs_Bonding_Supervisor_Init to store the bonding chain once SiLabs_Channel_Bonding is done.
+    SiLabs_Bonding_Supervisor_Poll/Process to collect the lock/BER/TS bitrate of each leg, to detect degraded legs
+     (with hysteresis) and to remove them from the chain (or add them back), changing only the roles which need it.
+    SiLabs_Bonding_Supervisor_Text to list the legs with their contribution to the bonded bitrate.
+   <new_feature>[Channel_Bonding/Supervisor] Adding SiLabs_Channel_Bonding_Role_Text.
+
   As from V2.7.5:
    <correction>[QUAD/pointer] In SiLabs_Channel_Bonding: pointer correction for 'unused' part.
 
@@ -526,6 +534,362 @@ signed   int   SiLabs_Channel_Bonding            (SILABS_Channel_Bonding       *
   return i;
 }
 
+/************************************************************************************************************************
+  Bonding supervisor functions
+  The bonding chain is stored in TS flow order (slave, bridge if any, master). The master drives the TS output, so it
+   is always the last leg of the chain. When an upstream leg is degraded, this leg and all legs before it are removed
+   from the chain: the first remaining leg becomes the slave, and the master is used alone (without bonding) if it is
+   the only remaining leg. When the legs recover, they are added back in the chain.
+  Only the legs with a new role are reconfigured. Degraded legs are restarted when removed from the chain. Healthy legs
+   with a new role are only restarted if hot_roles is 0 (i.e. if the firmware doesn't allow role changes while locked).
+************************************************************************************************************************/
+SILABS_Bonding_Supervisor  Bonding_Supervisor_Context;
+
+const    char *SiLabs_Channel_Bonding_Role_Text  (SILABS_Channel_Bonding_Role    role) {
+  switch (role) {
+    case SILABS_TS_CHANNEL_BONDING_OFF : { return "OFF"   ; break;}
+    case SILABS_TS_MASTER              : { return "MASTER"; break;}
+    case SILABS_TS_SLAVE               : { return "SLAVE" ; break;}
+    case SILABS_TS_SLAVE_BRIDGE        : { return "BRIDGE"; break;}
+    default                            : { return "UNKNOWN"; break;}
+  }
+}
+/* Returns 1 if the BER (ber_mant * 10^-ber_exp) is higher than 10^-limit */
+static signed   int   SiLabs_Bonding_BER_Above     (signed   int ber_mant, signed   int ber_exp, signed   int limit) {
+  signed   int threshold;
+  if (ber_mant < 0) { return 0; }
+  threshold = 1;
+  while (ber_exp > limit) {
+    threshold = threshold*10;
+    ber_exp--;
+    if (threshold > ber_mant) { return 0; }
+  }
+  return (ber_mant >= threshold) && (ber_mant > 0);
+}
+/* Role of each leg, depending on the first leg in the chain (first_leg == nb_legs-1 means 'master alone') */
+static SILABS_Channel_Bonding_Role SiLabs_Bonding_Leg_Role (SILABS_Bonding_Supervisor *supervisor, signed   int first_leg, signed   int i) {
+  if (i <  first_leg                 ) { return SILABS_TS_CHANNEL_BONDING_OFF; }
+  if (first_leg == supervisor->nb_legs - 1) { return SILABS_TS_CHANNEL_BONDING_OFF; }
+  if (i == supervisor->nb_legs - 1   ) { return SILABS_TS_MASTER;               }
+  if (i == first_leg                 ) { return SILABS_TS_SLAVE;                }
+  return SILABS_TS_SLAVE_BRIDGE;
+}
+/* Applying the DD_TS_PINS settings of a role to a leg, as done in SiLabs_Channel_Bonding */
+static void           SiLabs_Bonding_Leg_Pins      (SILABS_Bonding_Supervisor *supervisor, SILABS_Bonding_Leg *leg, SILABS_Channel_Bonding_Role role) {
+  L1_Si2183_Context *demod;
+  L1_Si2183_Context *master;
+  signed   int       secondary_output;
+  demod  = leg->fe->Si2183_FE->demod;
+  master = supervisor->leg[supervisor->nb_legs - 1].fe->Si2183_FE->demod;
+  /* In DUAL_SINGLE with the bonded TS on TS_2, the master receives on its primary TS and drives its secondary TS */
+  secondary_output = (leg == &(supervisor->leg[supervisor->nb_legs - 1])) && (supervisor->parts == SILABS_DUAL_SINGLE) && (supervisor->bonding->second_dual_input == SILABS_TS_2);
+  demod->cmd->dd_ts_pins.master_freq = master->prop->dvbs2_symbol_rate.rate;
+  switch (role) {
+    case SILABS_TS_SLAVE       : {
+      demod->cmd->dd_ts_pins.demod_role        = Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_SLAVE;
+      demod->cmd->dd_ts_pins.primary_ts_dir    = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_DIR_OUTPUT;
+      demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS;
+      Si2183_L1_SendCommand2 (demod, Si2183_DD_TS_PINS_CMD_CODE);
+      break;
+    }
+    case SILABS_TS_SLAVE_BRIDGE: {
+      demod->cmd->dd_ts_pins.demod_role        = Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_SLAVE_BRIDGE;
+      demod->cmd->dd_ts_pins.primary_ts_dir    = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_DIR_OUTPUT;
+      demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS;
+      demod->cmd->dd_ts_pins.secondary_ts_dir  = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_DIR_INPUT;
+      demod->cmd->dd_ts_pins.secondary_ts_mode = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_DRIVE_TS;
+      Si2183_L1_SendCommand2 (demod, Si2183_DD_TS_PINS_CMD_CODE);
+      break;
+    }
+    case SILABS_TS_MASTER      : {
+      /* output first, then input, as in SiLabs_Channel_Bonding */
+      demod->cmd->dd_ts_pins.demod_role        = Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_MASTER;
+      if (secondary_output) {
+        demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_NO_CHANGE;
+        demod->cmd->dd_ts_pins.secondary_ts_dir  = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_DIR_OUTPUT;
+        demod->cmd->dd_ts_pins.secondary_ts_mode = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_DRIVE_TS;
+      } else {
+        demod->cmd->dd_ts_pins.secondary_ts_mode = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_NO_CHANGE;
+        demod->cmd->dd_ts_pins.primary_ts_dir    = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_DIR_OUTPUT;
+        demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS;
+      }
+      Si2183_L1_SendCommand2 (demod, Si2183_DD_TS_PINS_CMD_CODE);
+      if (secondary_output) {
+        demod->cmd->dd_ts_pins.primary_ts_dir    = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_DIR_INPUT;
+        demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS;
+      } else {
+        demod->cmd->dd_ts_pins.secondary_ts_dir  = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_DIR_INPUT;
+        demod->cmd->dd_ts_pins.secondary_ts_mode = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_DRIVE_TS;
+      }
+      Si2183_L1_SendCommand2 (demod, Si2183_DD_TS_PINS_CMD_CODE);
+      break;
+    }
+    default                    : {
+      demod->cmd->dd_ts_pins.demod_role        = Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_CHANNEL_BONDING_OFF;
+      if (leg == &(supervisor->leg[supervisor->nb_legs - 1])) {
+        /* master alone: driving its own TS on the output */
+        if (secondary_output) {
+          demod->cmd->dd_ts_pins.secondary_ts_dir  = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_DIR_OUTPUT;
+          demod->cmd->dd_ts_pins.secondary_ts_mode = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_DRIVE_TS;
+        } else {
+          demod->cmd->dd_ts_pins.primary_ts_dir    = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_DIR_OUTPUT;
+          demod->cmd->dd_ts_pins.primary_ts_mode   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS;
+        }
+        Si2183_L1_SendCommand2 (demod, Si2183_DD_TS_PINS_CMD_CODE);
+      }
+      break;
+    }
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Bonding_Supervisor_Init function
+  Use:      Bonding supervisor initialization function
+            Used to store the bonding chain, once SiLabs_Channel_Bonding has been called with the same parts and TS_output.
+            There is no i2c traffic.
+  Parameter: supervisor, the supervisor to init
+  Parameter: Channel_Bonding, the SILABS_Channel_Bonding structure (previously filled using SiLabs_Channel_Bonding_SW_Init)
+  Parameter: parts,     the HW configuration used for bonding
+  Parameter: TS_output, the TS output (as used in SiLabs_Channel_Bonding)
+  Returns:  the number of legs, 0 if error
+************************************************************************************************************************/
+signed   int   SiLabs_Bonding_Supervisor_Init    (SILABS_Bonding_Supervisor     *supervisor
+                                                , SILABS_Channel_Bonding        *Channel_Bonding
+                                                , SILABS_Channel_Bonding_Parts   parts
+                                                , SILABS_TS_BUS                  TS_output ) {
+  signed   int i;
+  if (supervisor      == NULL) { SiERROR ("no supervisor pointer!\n"     ); return 0; }
+  if (Channel_Bonding == NULL) { SiERROR ("no Channel_Bonding pointer!\n"); return 0; }
+  memset(supervisor, 0, sizeof(SILABS_Bonding_Supervisor));
+  supervisor->bonding       = Channel_Bonding;
+  supervisor->parts         = parts;
+  supervisor->hot_roles     = 0;
+  supervisor->poll_ms       = BONDING_POLL_MS;
+  supervisor->degrade_polls = BONDING_DEGRADE_POLLS;
+  supervisor->recover_polls = BONDING_RECOVER_POLLS;
+  supervisor->ber_exp_limit = BONDING_BER_EXP_LIMIT;
+  if (SiLabs_Channel_Bonding_Roles(Channel_Bonding, parts, TS_output) < 2) {
+    SiERROR ("SiLabs_Bonding_Supervisor_Init: incorrect bonding roles!\n");
+    return 0;
+  }
+  supervisor->leg[supervisor->nb_legs++].fe = Channel_Bonding->slave;
+  if (Channel_Bonding->bridge != NULL) { supervisor->leg[supervisor->nb_legs++].fe = Channel_Bonding->bridge; }
+  supervisor->leg[supervisor->nb_legs++].fe = Channel_Bonding->master;
+  for (i = 0; i < supervisor->nb_legs; i++) {
+    supervisor->leg[i].role     = SiLabs_Bonding_Leg_Role(supervisor, 0, i);
+    supervisor->leg[i].healthy  = 1;
+    supervisor->leg[i].good     = 1;
+    supervisor->leg[i].ber_mant = -1;
+    SiTRACE("SiLabs_Bonding_Supervisor_Init leg %d %-10s %s\n", i, supervisor->leg[i].fe->tag, SiLabs_Channel_Bonding_Role_Text(supervisor->leg[i].role));
+  }
+  supervisor->first_leg = 0;
+  supervisor->state     = SILABS_BONDING_BONDED;
+  return supervisor->nb_legs;
+}
+/************************************************************************************************************************
+  SiLabs_Bonding_Supervisor_Poll function
+  Use:      Bonding supervisor poll function
+            Used to collect the lock/BER/TS bitrate of all legs, to update their health and to change the roles if needed:
+              a leg is degraded after degrade_polls consecutive polls without FEC lock, without TS or with a BER above 10^-ber_exp_limit.
+              a degraded leg is recovered after recover_polls consecutive good polls.
+  Returns:  the supervisor state
+************************************************************************************************************************/
+signed   int   SiLabs_Bonding_Supervisor_Poll    (SILABS_Bonding_Supervisor     *supervisor) {
+  CUSTOM_Status_Struct  status;
+  SILABS_Bonding_Leg   *leg;
+  SILABS_Channel_Bonding_Role roles[BONDING_MAX_LEGS];
+  signed   int          now;
+  signed   int          first_leg;
+  signed   int          trigger_ms;
+  signed   int          changes;
+  signed   int          start_ms;
+  signed   int          good;
+  signed   int          i;
+  if (supervisor->state == SILABS_BONDING_IDLE) { return SILABS_BONDING_IDLE; }
+  now        = system_time();
+  trigger_ms = now;
+  supervisor->last_poll_ms = now;
+  supervisor->polls++;
+  /* Collecting the leg status and updating the leg health */
+  for (i = 0; i < supervisor->nb_legs; i++) {
+    leg = &(supervisor->leg[i]);
+    memset(&status, 0, sizeof(status));
+    SiLabs_API_Demod_status_selection(leg->fe, &status, FE_LOCK_STATE | FE_RATES);
+    leg->fec_lock = status.fec_lock;
+    leg->ber_mant = status.fec_lock ? status.ber_mant : -1;
+    leg->ber_exp  = status.ber_exp;
+    leg->ts_kbps  = status.fec_lock ? status.TS_bitrate_kHz : 0;
+    good = (leg->fec_lock) && (leg->ts_kbps > 0) && (SiLabs_Bonding_BER_Above(leg->ber_mant, leg->ber_exp, supervisor->ber_exp_limit) == 0);
+    if (good != leg->good) {
+      leg->good     = good;
+      leg->streak   = 0;
+      leg->since_ms = now;
+    }
+    leg->streak++;
+    if ( (leg->healthy) && (good == 0) && (leg->streak >= supervisor->degrade_polls) ) {
+      SiTRACE("SiLabs_Bonding_Supervisor_Poll leg %d %s degraded (fec_lock %d, BER %de-%d, %d kbps)\n", i, leg->fe->tag, leg->fec_lock, leg->ber_mant, leg->ber_exp, leg->ts_kbps);
+      leg->healthy = 0;
+      leg->degradations++;
+      if (leg->since_ms < trigger_ms) { trigger_ms = leg->since_ms; }
+    }
+    if ( (leg->healthy == 0) && (good) && (leg->streak >= supervisor->recover_polls) ) {
+      SiTRACE("SiLabs_Bonding_Supervisor_Poll leg %d %s recovered\n", i, leg->fe->tag);
+      leg->healthy = 1;
+      if (leg->since_ms < trigger_ms) { trigger_ms = leg->since_ms; }
+    }
+  }
+  /* Planning the chain: all legs after the last degraded leg */
+  if (supervisor->leg[supervisor->nb_legs - 1].healthy == 0) {
+    /* The master is degraded: there is no other path to the TS output, the roles are kept until it recovers */
+    supervisor->state = SILABS_BONDING_DOWN;
+  } else {
+    first_leg = 0;
+    for (i = 0; i < supervisor->nb_legs - 1; i++) { if (supervisor->leg[i].healthy == 0) { first_leg = i + 1; } }
+    changes = 0;
+    for (i = 0; i < supervisor->nb_legs; i++) {
+      roles[i] = SiLabs_Bonding_Leg_Role(supervisor, first_leg, i);
+      if (roles[i] != supervisor->leg[i].role) { changes++; }
+    }
+    if (changes) {
+      start_ms = system_time();
+      /* 1- disabling the TS pins of the legs changing role, restarting them if needed */
+      for (i = 0; i < supervisor->nb_legs; i++) {
+        leg = &(supervisor->leg[i]);
+        if (roles[i] == leg->role) { continue; }
+        SiTRACE("SiLabs_Bonding_Supervisor_Poll leg %d %s %s -> %s\n", i, leg->fe->tag, SiLabs_Channel_Bonding_Role_Text(leg->role), SiLabs_Channel_Bonding_Role_Text(roles[i]));
+        leg->fe->Si2183_FE->demod->cmd->dd_ts_pins.primary_ts_activity   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_ACTIVITY_CLEAR;
+        leg->fe->Si2183_FE->demod->cmd->dd_ts_pins.secondary_ts_activity = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_ACTIVITY_CLEAR;
+        leg->fe->Si2183_FE->demod->cmd->dd_ts_pins.primary_ts_mode       = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_NOT_USED;
+        leg->fe->Si2183_FE->demod->cmd->dd_ts_pins.secondary_ts_mode     = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_NOT_USED;
+        leg->fe->Si2183_FE->demod->cmd->dd_ts_pins.demod_role            = Si2183_DD_TS_PINS_CMD_DEMOD_ROLE_CHANNEL_BONDING_OFF;
+        Si2183_L1_SendCommand2 (leg->fe->Si2183_FE->demod, Si2183_DD_TS_PINS_CMD_CODE);
+        if ( (leg->healthy == 0) | (supervisor->hot_roles == 0) ) {
+          Si2183_L1_DD_RESTART (leg->fe->Si2183_FE->demod);
+          leg->restarts++;
+        }
+      }
+      /* 2- setting the new roles, in TS flow order */
+      for (i = 0; i < supervisor->nb_legs; i++) {
+        leg = &(supervisor->leg[i]);
+        if (roles[i] == leg->role) { continue; }
+        SiLabs_Bonding_Leg_Pins(supervisor, leg, roles[i]);
+        leg->role = roles[i];
+        leg->role_changes++;
+      }
+      supervisor->last_apply_ms    = system_time() - start_ms;
+      supervisor->last_reconfig_ms = system_time() - trigger_ms;
+      if (supervisor->last_reconfig_ms > supervisor->max_reconfig_ms) { supervisor->max_reconfig_ms = supervisor->last_reconfig_ms; }
+      supervisor->reconfigurations++;
+      SiTRACE("SiLabs_Bonding_Supervisor_Poll %d role changes applied in %d ms (%d ms after detection)\n", changes, supervisor->last_apply_ms, supervisor->last_reconfig_ms);
+    }
+    supervisor->first_leg = first_leg;
+    supervisor->state     = (first_leg == 0) ? SILABS_BONDING_BONDED : SILABS_BONDING_DEGRADED;
+  }
+  /* Aggregate bitrate of the legs in the chain */
+  supervisor->bonded_kbps = 0;
+  if (supervisor->state != SILABS_BONDING_DOWN) {
+    for (i = supervisor->first_leg; i < supervisor->nb_legs; i++) { supervisor->bonded_kbps += supervisor->leg[i].ts_kbps; }
+  }
+  return supervisor->state;
+}
+/************************************************************************************************************************
+  SiLabs_Bonding_Supervisor_Process function
+  Use:      Bonding supervisor periodic function
+            Used to call SiLabs_Bonding_Supervisor_Poll every poll_ms. To be called from the application loop.
+  Returns:  the supervisor state
+************************************************************************************************************************/
+signed   int   SiLabs_Bonding_Supervisor_Process (SILABS_Bonding_Supervisor     *supervisor) {
+  if ( (supervisor->polls) && (system_time() - supervisor->last_poll_ms < supervisor->poll_ms) ) { return supervisor->state; }
+  return SiLabs_Bonding_Supervisor_Poll(supervisor);
+}
+/************************************************************************************************************************
+  SiLabs_Bonding_Supervisor_Text function
+  Use:      Bonding supervisor status function
+            Used to list the legs, with their role, health and bitrate contribution
+  Returns:  the aggregate bonded bitrate in kbps
+************************************************************************************************************************/
+signed   int   SiLabs_Bonding_Supervisor_Text    (SILABS_Bonding_Supervisor     *supervisor, char *text, signed   int size) {
+  SILABS_Bonding_Leg *leg;
+  const char *state;
+  signed   int i;
+  signed   int n;
+  switch (supervisor->state) {
+    case SILABS_BONDING_BONDED  : { state = "BONDED"  ; break; }
+    case SILABS_BONDING_DEGRADED: { state = "DEGRADED"; break; }
+    case SILABS_BONDING_DOWN    : { state = "DOWN"    ; break; }
+    default                     : { state = "IDLE"    ; break; }
+  }
+  n = snprintf(text, size, "%s, %d kbps, %d reconfigurations (last %d ms, max %d ms, apply %d ms)\n", state, supervisor->bonded_kbps
+    , supervisor->reconfigurations, supervisor->last_reconfig_ms, supervisor->max_reconfig_ms, supervisor->last_apply_ms);
+  for (i = 0; i < supervisor->nb_legs; i++) {
+    if ( (n < 0) | (n >= size) ) { break; }
+    leg = &(supervisor->leg[i]);
+    n += snprintf(text + n, size - n, "leg %d %-10s %-6s %-8s fec_lock %d BER %2de-%d %6d kbps %3d%% (%d degradations, %d restarts)\n", i, leg->fe->tag
+      , SiLabs_Channel_Bonding_Role_Text(leg->role), leg->healthy ? "healthy" : "degraded", leg->fec_lock, leg->ber_mant, leg->ber_exp, leg->ts_kbps
+      , ( (supervisor->bonded_kbps > 0) && (i >= supervisor->first_leg) ) ? (leg->ts_kbps*100)/supervisor->bonded_kbps : 0, leg->degradations, leg->restarts);
+  }
+  return supervisor->bonded_kbps;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Bonding_Supervisor_Test function
+  Use:      Generic test pipe function
+            Used to send a generic command to the bonding supervisor.
+  Returns:  0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Bonding_Supervisor_Test    (SILABS_Bonding_Supervisor     *supervisor, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int parts;
+  signed   int TS_output;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible bonding supervisor test commands:\n\
+init               <parts>        : start supervising Channel_Bonding_Context (2 ONE_DUAL, 3 DUAL_SINGLE, 4 DUAL_DUAL, sub_cmd '<TS_output>')\n\
+poll                              : poll all legs now\n\
+status                            : list the legs, returns the bonded bitrate\n\
+hot_roles          <0/1>          : 1 if the firmware allows role changes without DD_RESTART\n\
+ber_limit          <exp>          : BER limit (10^-exp)\n\
+poll_ms            <ms>           : period used by SiLabs_Bonding_Supervisor_Process\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "init"               ) == 0) {
+    TS_output = SILABS_TS_1;
+    sscanf(sub_cmd, "%d", &TS_output);
+    parts = (signed int)dval;
+    *retdval = SiLabs_Bonding_Supervisor_Init(supervisor, &Channel_Bonding_Context, (SILABS_Channel_Bonding_Parts)parts, (SILABS_TS_BUS)TS_output);
+    SiLabs_Bonding_Supervisor_Text(supervisor, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "poll"               ) == 0) {
+    *retdval = SiLabs_Bonding_Supervisor_Poll(supervisor);
+    SiLabs_Bonding_Supervisor_Text(supervisor, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = SiLabs_Bonding_Supervisor_Text(supervisor, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "hot_roles"          ) == 0) {
+    supervisor->hot_roles = (signed int)dval;
+    *retdval = supervisor->hot_roles;
+    snprintf(*rettxt, 1000, "hot_roles %d\n", supervisor->hot_roles);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "ber_limit"          ) == 0) {
+    if (dval > 0) { supervisor->ber_exp_limit = (signed int)dval; }
+    *retdval = supervisor->ber_exp_limit;
+    snprintf(*rettxt, 1000, "ber_limit 1e-%d\n", supervisor->ber_exp_limit);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "poll_ms"            ) == 0) {
+    if (dval > 0) { supervisor->poll_ms = (signed int)dval; }
+    *retdval = supervisor->poll_ms;
+    snprintf(*rettxt, 1000, "poll_ms %d\n", supervisor->poll_ms);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
 #ifdef    __cplusplus
 }
 #endif /* __cplusplus */
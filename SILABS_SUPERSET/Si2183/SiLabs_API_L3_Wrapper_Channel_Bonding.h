@@ -17,6 +17,11 @@ limitations under the License.
 #define  _SiLabs_API_L3_Wrapper_Channel_Bonding_H_
 /* Change log:
 
+  As from V2.8.1:
+  <new_feature>[Channel_Bonding/Supervisor] Adding a bonding supervisor (SiLabs_Bonding_Supervisor_xxx functions).
+        The status of each leg is polled, degraded legs are removed from the bonding chain (and added back once recovered),
+         only changing the roles of the legs which need it. The bonded bitrate and the reconfiguration times are available.
+
   As from V2.9.0:
   <new_feature>[Channel_Bonding/Duals] Adding TS Bonding capability via SiLabs_API_L3_Channel_Bonding.c/.h
         This is only valid for dual demodulators with the TS bonding feature.
@@ -90,6 +95,73 @@ signed   int   SiLabs_Channel_Bonding            (SILABS_Channel_Bonding       *
                                                 , SILABS_Channel_Bonding_Parts  parts
                                                 , SILABS_TS_BUS                 TS_output );
 
+#define BONDING_MAX_LEGS               3  /* Maximum number of legs in a bonding chain (slave, bridge, master)               */
+#define BONDING_POLL_MS             1000  /* Default period of the leg status polls in SiLabs_Bonding_Supervisor_Process   */
+#define BONDING_DEGRADE_POLLS          2  /* Default number of consecutive bad  polls before a leg is removed from the chain */
+#define BONDING_RECOVER_POLLS          3  /* Default number of consecutive good polls before a leg is added back           */
+#define BONDING_BER_EXP_LIMIT          4  /* Default BER limit (1e-4): a leg with a higher BER is bad                       */
+
+/* possible values for the bonding supervisor state */
+typedef enum  _SILABS_Bonding_State               {
+  SILABS_BONDING_IDLE     = 0,                   /* supervisor not started                                       */
+  SILABS_BONDING_BONDED   = 1,                   /* all legs are in the bonding chain                            */
+  SILABS_BONDING_DEGRADED = 2,                   /* some upstream legs are removed from the bonding chain        */
+  SILABS_BONDING_DOWN     = 3                    /* the master leg (driving the TS output) is degraded           */
+} SILABS_Bonding_State;
+
+/* Structure used to store the status of one leg */
+typedef struct _SILABS_Bonding_Leg                {
+  SILABS_FE_Context            *fe;
+  SILABS_Channel_Bonding_Role   role;            /* role currently applied                                       */
+  signed   int                  fec_lock;
+  signed   int                  ber_mant;        /* BER = ber_mant * 10^-ber_exp (ber_mant -1 if not available)  */
+  signed   int                  ber_exp;
+  signed   int                  ts_kbps;         /* TS bitrate of this leg                                       */
+  signed   int                  healthy;         /* 1 while the leg can be used in the bonding chain             */
+  signed   int                  streak;          /* number of consecutive polls with the same health (good/bad)  */
+  signed   int                  good;            /* health at the last poll                                      */
+  signed   int                  since_ms;        /* time of the first poll of the current streak                 */
+  signed   int                  degradations;
+  signed   int                  role_changes;
+  signed   int                  restarts;
+} SILABS_Bonding_Leg;
+
+/* Structure used to store all bonding supervisor information */
+typedef struct _SILABS_Bonding_Supervisor         {
+  SILABS_Channel_Bonding       *bonding;
+  SILABS_Channel_Bonding_Parts  parts;
+  SILABS_Bonding_Leg            leg[BONDING_MAX_LEGS]; /* in TS flow order: slave, (bridge), master                  */
+  signed   int                  nb_legs;
+  signed   int                  first_leg;       /* first leg in the bonding chain                               */
+  SILABS_Bonding_State          state;
+  signed   int                  hot_roles;       /* 1 if the firmware allows role changes without DD_RESTART     */
+  signed   int                  poll_ms;
+  signed   int                  degrade_polls;
+  signed   int                  recover_polls;
+  signed   int                  ber_exp_limit;
+  signed   int                  last_poll_ms;
+  signed   int                  polls;
+  signed   int                  bonded_kbps;     /* aggregate TS bitrate of the legs in the bonding chain        */
+  signed   int                  reconfigurations;
+  signed   int                  last_apply_ms;   /* duration of the last role changes                            */
+  signed   int                  last_reconfig_ms;/* time from the first poll showing the change until applied    */
+  signed   int                  max_reconfig_ms;
+} SILABS_Bonding_Supervisor;
+
+extern SILABS_Bonding_Supervisor  Bonding_Supervisor_Context;
+
+const    char *SiLabs_Channel_Bonding_Role_Text  (SILABS_Channel_Bonding_Role    role);
+signed   int   SiLabs_Bonding_Supervisor_Init    (SILABS_Bonding_Supervisor     *supervisor
+                                                , SILABS_Channel_Bonding        *Channel_Bonding
+                                                , SILABS_Channel_Bonding_Parts   parts
+                                                , SILABS_TS_BUS                  TS_output );
+signed   int   SiLabs_Bonding_Supervisor_Poll    (SILABS_Bonding_Supervisor     *supervisor);
+signed   int   SiLabs_Bonding_Supervisor_Process (SILABS_Bonding_Supervisor     *supervisor);
+signed   int   SiLabs_Bonding_Supervisor_Text    (SILABS_Bonding_Supervisor     *supervisor, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Bonding_Supervisor_Test    (SILABS_Bonding_Supervisor     *supervisor, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,432 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API DiSEqC Queue Functions                                        */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a non-blocking DiSEqC queue, allowing tuner programming during DiSEqC activity */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_SAT_send_diseqc_sequence and SiLabs_API_SAT_voltage_and_tone return only once the demodulator
+  is ready for the next DiSEqC activity, and the application then waits for the protocol gaps
+  (15 ms after a voltage change, 15 ms between messages, 13.5 ms per byte) before programming the tuner.
+
+ The DiSEqC queue stores the voltage, tone, message and reply operations for one front-end and starts
+  them as soon as the protocol allows it, using SiLabs_API_SAT_prepare_diseqc_sequence and
+  SiLabs_API_SAT_trigger_diseqc_sequence. It never waits: SiLabs_DiSEqC_Queue_Process starts what is due
+  and returns, such that the SAT tuner and demodulator can be programmed while the DiSEqC bytes are on the wire.
+ Redundant voltage and tone changes are skipped.
+
+ Use case with a committed switch (port 2, vertical, high band):
+    SiLabs_DiSEqC_Queue_Init              ( queue, front_end);
+    SiLabs_DiSEqC_Queue_Voltage_And_Tone  ( queue, 13, 0);
+    SiLabs_DiSEqC_Queue_Message           ( queue, 4, committed_switch_bytes, 0, 0, 0, 1);
+    SiLabs_DiSEqC_Queue_Tone              ( queue, 1);
+    SiLabs_DiSEqC_Queue_Lock_To_Carrier   ( queue, SILABS_DVB_S2, 1178000, 27500000, 0);
+
+ SiLabs_DiSEqC_Queue_Lock_To_Carrier starts the DiSEqC activity, tunes the SAT tuner while the bytes are sent,
+  flushes the queue and then locks the demodulator without re-tuning.
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[SAT/DiSEqC] Initial version of the non-blocking DiSEqC queue
+   <new_feature>[SAT/DiSEqC] Adding SiLabs_DiSEqC_Queue_Of, returning the queue of a front-end (from its registry entry for registered front-ends)
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   DISEQC_QUEUE
+  "If you get a compilation error on this line, it means that you included the DiSEqC_Queue code in your project without defining DISEQC_QUEUE.";
+  "Please define DISEQC_QUEUE at project-level, or remove the DiSEqC_Queue code from your project";
+#endif /* DISEQC_QUEUE */
+
+#ifdef    DISEQC_QUEUE
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "DiSEqC_Q "
+#include "SiLabs_API_L3_Wrapper_DiSEqC_Queue.h"
+
+SILABS_DiSEqC_Queue  DiSEqC_Queue_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Of function
+  Use:      DiSEqC queue retrieval
+            Returns the DiSEqC queue of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the DiSEqC queue
+************************************************************************************************************************/
+SILABS_DiSEqC_Queue *SiLabs_DiSEqC_Queue_Of            (SILABS_FE_Context *front_end) {
+  SILABS_DiSEqC_Queue *queue;
+  queue = &(DiSEqC_Queue_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { queue = ((SILABS_FE_Registry_Entry *)front_end)->diseqc_queue; }
+#endif /* FRONTEND_REGISTRY */
+  if (queue->front_end != front_end) { SiLabs_DiSEqC_Queue_Init(queue, front_end); }
+  return queue;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Init function
+  Use:      DiSEqC queue initialization
+            Clears the queue and marks the voltage and tone as unknown, such that the first changes are always applied.
+  Parameter: queue, a pointer to the DiSEqC queue
+  Parameter: front_end, a pointer to the SILABS_FE_Context using the queue
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Init                (SILABS_DiSEqC_Queue *queue, SILABS_FE_Context *front_end) {
+  queue->front_end      = front_end;
+  queue->head           = 0;
+  queue->count          = 0;
+  queue->ready_ms       = system_time();
+  queue->reply_start_ms = 0;
+  queue->reply_length   = 0;
+  queue->voltage        = -1;
+  queue->tone           = -1;
+  queue->skipped        = 0;
+  queue->overlap_ms     = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Add function
+  Use:      Adds an item at the end of the queue
+  Returns:  a pointer to the new item, NULL if the queue is full
+************************************************************************************************************************/
+SILABS_DiSEqC_Item *SiLabs_DiSEqC_Queue_Add            (SILABS_DiSEqC_Queue *queue, SILABS_DiSEqC_Item_Type type, signed   int value) {
+  SILABS_DiSEqC_Item *item;
+  if (queue->count >= DISEQC_QUEUE_SIZE) {
+    SiERROR("DiSEqC queue full!\n");
+    return NULL;
+  }
+  item = &(queue->item[(queue->head + queue->count)%DISEQC_QUEUE_SIZE]);
+  item->type       = type;
+  item->value      = value;
+  item->length     = 0;
+  item->cont_tone  = 0;
+  item->tone_burst = 0;
+  item->burst_sel  = 0;
+  item->end_seq    = 1;
+  queue->count++;
+  return item;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Voltage function
+  Use:      Queues an LNB voltage change (skipped if the voltage is already queued or applied)
+  Parameter: voltage, the LNB voltage level (allows 0, 13 or 18)
+  Returns:  1 if queued or skipped, 0 if the queue is full
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Voltage             (SILABS_DiSEqC_Queue *queue, signed   int voltage) {
+  if (queue->voltage == voltage) { queue->skipped++; return 1; }
+  if (SiLabs_DiSEqC_Queue_Add(queue, DISEQC_ITEM_VOLTAGE, voltage) == NULL) { return 0; }
+  queue->voltage = voltage;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Tone function
+  Use:      Queues a 22 kHz continuous tone change (skipped if the tone is already queued or applied)
+  Parameter: tone, a flag to enable the 22khz tone (allows 0 or 1)
+  Returns:  1 if queued or skipped, 0 if the queue is full
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Tone                (SILABS_DiSEqC_Queue *queue, unsigned char tone) {
+  if (queue->tone == tone) { queue->skipped++; return 1; }
+  if (SiLabs_DiSEqC_Queue_Add(queue, DISEQC_ITEM_TONE, tone) == NULL) { return 0; }
+  queue->tone = tone;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Voltage_And_Tone function
+  Use:      Queued equivalent of SiLabs_API_SAT_voltage_and_tone
+  Returns:  1 if queued or skipped, 0 if the queue is full
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Voltage_And_Tone    (SILABS_DiSEqC_Queue *queue, signed   int voltage, unsigned char tone) {
+  if (SiLabs_DiSEqC_Queue_Voltage(queue, voltage) == 0) { return 0; }
+  return SiLabs_DiSEqC_Queue_Tone(queue, tone);
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Message function
+  Use:      Queued equivalent of SiLabs_API_SAT_send_diseqc_sequence
+            When the framing byte requests a reply (0xE2 or 0xE3), a reply item is automatically queued after the message.
+            The continuous tone state after the message is given by cont_tone.
+  Returns:  1 if queued, 0 if the queue is full or the message is too long
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Message             (SILABS_DiSEqC_Queue *queue, signed   int sequence_length, unsigned char *sequence_buffer, unsigned char cont_tone, unsigned char tone_burst, unsigned char burst_sel, unsigned char end_seq) {
+  SILABS_DiSEqC_Item *item;
+  signed   int i;
+  if (sequence_length < 0 || sequence_length > 6) {
+    SiERROR("DiSEqC queue: message length must be between 0 and 6\n");
+    return 0;
+  }
+  if ((item = SiLabs_DiSEqC_Queue_Add(queue, DISEQC_ITEM_MESSAGE, 0)) == NULL) { return 0; }
+  item->length     = sequence_length;
+  for (i=0; i<sequence_length; i++) { item->buffer[i] = sequence_buffer[i]; }
+  item->cont_tone  = cont_tone;
+  item->tone_burst = tone_burst;
+  item->burst_sel  = burst_sel;
+  item->end_seq    = end_seq;
+  queue->tone      = cont_tone;
+  if (sequence_length > 0) {
+    if ( (sequence_buffer[0] == 0xE2) | (sequence_buffer[0] == 0xE3) ) {
+      if (SiLabs_DiSEqC_Queue_Add(queue, DISEQC_ITEM_REPLY, DISEQC_QUEUE_REPLY_MS) == NULL) { return 0; }
+    }
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Wait function
+  Use:      Queues an additional delay (for instance for a motor or a slow switch)
+  Returns:  1 if queued, 0 if the queue is full
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Wait                (SILABS_DiSEqC_Queue *queue, signed   int wait_ms) {
+  if (SiLabs_DiSEqC_Queue_Add(queue, DISEQC_ITEM_WAIT, wait_ms) == NULL) { return 0; }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Process function
+  Use:      Starts all queued items which are due, without waiting
+            Each item sets the time at which the next item can be started, based on the DiSEqC timings.
+            A reply item is polled until the reply is received or DISEQC_QUEUE_REPLY_MS is elapsed.
+  Returns:  the number of items still in the queue (0 when done)
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Process             (SILABS_DiSEqC_Queue *queue) {
+  SILABS_DiSEqC_Item *item;
+  SILABS_FE_Context  *front_end;
+  signed   int now;
+  signed   int flags;
+  signed   int duration;
+  front_end = queue->front_end;
+  while (queue->count > 0) {
+    now  = system_time();
+    if (now < queue->ready_ms) { break; }
+    item = &(queue->item[queue->head]);
+    if (item->type == DISEQC_ITEM_REPLY) {
+      if (queue->reply_start_ms == 0) { queue->reply_start_ms = now; queue->reply_length = 0; }
+      SiLabs_API_SAT_read_diseqc_reply(front_end, &(queue->reply_length), queue->reply_buffer);
+      if ( (queue->reply_length == 0) & (now - queue->reply_start_ms < item->value) ) {
+        queue->ready_ms = now + DISEQC_QUEUE_POLL_MS;
+        break;
+      }
+      SiTRACE("DiSEqC reply: %d bytes after %d ms\n", queue->reply_length, now - queue->reply_start_ms);
+      queue->reply_start_ms = 0;
+      queue->ready_ms = now + DISEQC_QUEUE_GAP_MS;
+    } else {
+      switch (item->type) {
+        case DISEQC_ITEM_VOLTAGE: {
+          SiTRACE("DiSEqC queue: voltage %d\n", item->value);
+          SiLabs_API_SAT_Tuner_I2C_Enable  (front_end);
+          SiLabs_API_SAT_voltage           (front_end, item->value);
+          SiLabs_API_SAT_Tuner_I2C_Disable (front_end);
+          duration = DISEQC_QUEUE_VOLTAGE_MS;
+          break;
+        }
+        case DISEQC_ITEM_TONE   : {
+          SiTRACE("DiSEqC queue: tone %d\n", item->value);
+          SiLabs_API_SAT_tone              (front_end, (unsigned char)item->value);
+          duration = DISEQC_QUEUE_GAP_MS;
+          break;
+        }
+        case DISEQC_ITEM_MESSAGE: {
+          SiTRACE("DiSEqC queue: message of %d bytes\n", item->length);
+          SiLabs_API_SAT_prepare_diseqc_sequence(front_end, item->length, item->buffer, item->cont_tone, item->tone_burst, item->burst_sel, item->end_seq, &flags);
+          SiLabs_API_SAT_trigger_diseqc_sequence(front_end, flags);
+          duration = item->length*DISEQC_QUEUE_BYTE_MS + DISEQC_QUEUE_GAP_MS;
+          if (item->tone_burst) { duration = duration + DISEQC_QUEUE_BURST_MS + DISEQC_QUEUE_GAP_MS; }
+          break;
+        }
+        default                 : {
+          duration = item->value;
+          break;
+        }
+      }
+      queue->ready_ms = now + duration;
+    }
+    queue->head = (queue->head + 1)%DISEQC_QUEUE_SIZE;
+    queue->count--;
+  }
+  return queue->count;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Next_ms function
+  Use:      Returns the time (in ms) before SiLabs_DiSEqC_Queue_Process can do something useful
+            Also used to know how long the DiSEqC bus will remain busy after the last item.
+  Returns:  0 if an item is due now or if the bus is idle
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Next_ms             (SILABS_DiSEqC_Queue *queue) {
+  signed   int remaining;
+  remaining = queue->ready_ms - system_time();
+  if (remaining < 0) { return 0; }
+  return remaining;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Flush function
+  Use:      Processes the queue until all items are done and the bus is idle
+            Only waits for the time required by the protocol.
+  Parameter: timeout_ms, the maximum flush duration
+  Returns:  1 if the queue is empty, 0 in case of timeout
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Flush               (SILABS_DiSEqC_Queue *queue, signed   int timeout_ms) {
+  signed   int start_ms;
+  signed   int wait_ms;
+  start_ms = system_time();
+  while (SiLabs_DiSEqC_Queue_Process(queue) > 0) {
+    if (system_time() - start_ms > timeout_ms) {
+      SiTRACE("DiSEqC queue flush timeout with %d items left\n", queue->count);
+      return 0;
+    }
+    wait_ms = SiLabs_DiSEqC_Queue_Next_ms(queue);
+    if (wait_ms > 0) { system_wait(wait_ms); }
+  }
+  wait_ms = SiLabs_DiSEqC_Queue_Next_ms(queue);
+  if (wait_ms > 0) { system_wait(wait_ms); }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Reply function
+  Use:      Retrieves the last DiSEqC reply received by the queue
+  Parameter: reply_length, a pointer to the number of DiSEqC bytes read
+  Parameter: reply_buffer, a pointer to store the DiSEqC bytes read (3 bytes max)
+  Returns:  the reply length
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Reply               (SILABS_DiSEqC_Queue *queue, signed   int *reply_length, unsigned char *reply_buffer) {
+  signed   int i;
+  *reply_length = queue->reply_length;
+  for (i=0; (i<queue->reply_length) & (i<3); i++) { reply_buffer[i] = queue->reply_buffer[i]; }
+  return queue->reply_length;
+}
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Lock_To_Carrier function
+  Use:      SAT lock_to_carrier using the DiSEqC queue
+            1- starts the queued DiSEqC activity
+            2- tunes the SAT tuner while the DiSEqC bus is busy
+            3- flushes the queue
+            4- calls SiLabs_API_lock_to_carrier without re-tuning and without voltage/tone changes
+            With Unicable, the ODU message needs the voltage and tone set by the queue first, so the queue is
+             flushed and the regular lock_to_carrier is used.
+  Parameter: standard, SILABS_DVB_S, SILABS_DVB_S2, SILABS_DSS or SILABS_SLSI
+  Parameter: freq, the SAT frequency in kHz (IF frequency for normal LNBs, RF frequency for Unicable)
+  Parameter: symbol_rate_bps, the symbol rate in baud
+  Parameter: plp_id, used for DVB-S2 ISI selection
+  Returns:  the value returned by SiLabs_API_lock_to_carrier
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Lock_To_Carrier     (SILABS_DiSEqC_Queue *queue, signed   int standard, signed   int freq, unsigned int symbol_rate_bps, signed   int plp_id) {
+  SILABS_FE_Context  *front_end;
+  signed   int start_ms;
+  front_end = queue->front_end;
+  if (front_end->standard != standard) {
+    SiLabs_DiSEqC_Queue_Flush(queue, 1000);
+    SiLabs_API_switch_to_standard(front_end, standard, 0);
+  }
+#ifdef    UNICABLE_COMPATIBLE
+  if (front_end->lnb_type == UNICABLE_LNB_TYPE_UNICABLE) {
+    SiLabs_DiSEqC_Queue_Flush(queue, 1000);
+    return SiLabs_API_lock_to_carrier(front_end, standard, freq, 0, 0, symbol_rate_bps, 0, SILABS_POLARIZATION_DO_NOT_CHANGE, SILABS_BAND_DO_NOT_CHANGE, 0, plp_id, 0);
+  }
+#endif /* UNICABLE_COMPATIBLE */
+  SiLabs_DiSEqC_Queue_Process(queue);
+  start_ms = system_time();
+  SiLabs_API_Tune(front_end, freq);
+  if (SiLabs_DiSEqC_Queue_Next_ms(queue) > 0 || queue->count > 0) {
+    queue->overlap_ms = queue->overlap_ms + system_time() - start_ms;
+  }
+  SiLabs_DiSEqC_Queue_Flush(queue, 1000);
+  return SiLabs_API_lock_to_carrier(front_end, standard, 0, 0, 0, symbol_rate_bps, 0, SILABS_POLARIZATION_DO_NOT_CHANGE, SILABS_BAND_DO_NOT_CHANGE, 0, plp_id, 0);
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_DiSEqC_Queue_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the DiSEqC queue.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_DiSEqC_Queue_Test                (SILABS_DiSEqC_Queue *queue, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  unsigned char buffer[6];
+  unsigned int  byte;
+  signed   int  n;
+  signed   int  pos;
+  signed   int  start_ms;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible DiSEqC queue test commands:\n\
+voltage            <0,13,18>\n\
+tone               <0,1>\n\
+message            <hex bytes in sub_cmd, i.e. 'E0 10 38 F0'>\n\
+committed          <port 0-3>     : committed switch with the queued voltage and tone\n\
+wait               <ms>\n\
+flush\n\
+stats\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "voltage"            ) == 0) {
+    *retdval = SiLabs_DiSEqC_Queue_Voltage(queue, (signed int)dval);
+    snprintf(*rettxt, 1000, "voltage %d queued (%d items)\n", (signed int)dval, queue->count);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "tone"               ) == 0) {
+    *retdval = SiLabs_DiSEqC_Queue_Tone(queue, (unsigned char)dval);
+    snprintf(*rettxt, 1000, "tone %d queued (%d items)\n", (signed int)dval, queue->count);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "message"            ) == 0) {
+    n = 0;
+    while ( (n < 6) && (sscanf(sub_cmd, "%x%n", &byte, &pos) == 1) ) { buffer[n++] = (unsigned char)byte; sub_cmd = sub_cmd + pos; }
+    *retdval = SiLabs_DiSEqC_Queue_Message(queue, n, buffer, (unsigned char)(queue->tone == 1), 0, 0, 1);
+    snprintf(*rettxt, 1000, "%d bytes message queued (%d items)\n", n, queue->count);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "committed"          ) == 0) {
+    buffer[0] = 0xE0;
+    buffer[1] = 0x10;
+    buffer[2] = 0x38;
+    buffer[3] = (unsigned char)(0xF0 + (((signed int)dval & 0x03) << 2) + ((queue->voltage == 18) << 1) + (queue->tone == 1));
+    *retdval = SiLabs_DiSEqC_Queue_Message(queue, 4, buffer, (unsigned char)(queue->tone == 1), 0, 0, 1);
+    snprintf(*rettxt, 1000, "committed switch 0x%02X queued (%d items)\n", buffer[3], queue->count);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "wait"               ) == 0) {
+    *retdval = SiLabs_DiSEqC_Queue_Wait(queue, (signed int)dval);
+    snprintf(*rettxt, 1000, "wait %d ms queued (%d items)\n", (signed int)dval, queue->count);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "flush"              ) == 0) {
+    start_ms = system_time();
+    *retdval = SiLabs_DiSEqC_Queue_Flush(queue, 2000);
+    snprintf(*rettxt, 1000, "queue flushed in %d ms (%d items left, reply %d bytes)\n", system_time() - start_ms, queue->count, queue->reply_length);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "stats"              ) == 0) {
+    *retdval = queue->overlap_ms;
+    snprintf(*rettxt, 1000, "%d items queued, %d redundant changes skipped, %d ms of tuning done during DiSEqC activity\n", queue->count, queue->skipped, queue->overlap_ms);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DISEQC_QUEUE */
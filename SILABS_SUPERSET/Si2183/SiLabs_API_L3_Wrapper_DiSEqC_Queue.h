@@ -0,0 +1,100 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_DiSEqC_Queue_H_
+#define  _SiLabs_API_L3_Wrapper_DiSEqC_Queue_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[SAT/DiSEqC] Adding a non-blocking DiSEqC queue via SiLabs_API_L3_Wrapper_DiSEqC_Queue.c/.h
+        LNB voltage, tone, DiSEqC messages and replies are sequenced without blocking the caller.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISEQC_QUEUE_SIZE          16
+
+#define DISEQC_QUEUE_BYTE_MS       14  /* Each DiSEqC byte lasts 13.5 ms (9 bits at 1.5 ms)                      */
+#define DISEQC_QUEUE_BURST_MS      13  /* Tone burst duration is 12.5 ms                                         */
+#define DISEQC_QUEUE_VOLTAGE_MS    15  /* Minimum delay between a voltage change and the next DiSEqC activity    */
+#define DISEQC_QUEUE_GAP_MS        15  /* Minimum quiet time after a message, a tone burst or a tone change      */
+#define DISEQC_QUEUE_REPLY_MS     150  /* Maximum time for a slave to reply to a message                         */
+#define DISEQC_QUEUE_POLL_MS        5  /* Reply polling period                                                   */
+
+/* possible values for the DiSEqC queue items */
+typedef enum  _SILABS_DiSEqC_Item_Type            {
+  DISEQC_ITEM_VOLTAGE = 1,
+  DISEQC_ITEM_TONE    = 2,
+  DISEQC_ITEM_MESSAGE = 3,
+  DISEQC_ITEM_REPLY   = 4,
+  DISEQC_ITEM_WAIT    = 5
+} SILABS_DiSEqC_Item_Type;
+
+/* Structure used to store one DiSEqC queue item */
+typedef struct _SILABS_DiSEqC_Item                {
+  SILABS_DiSEqC_Item_Type       type;
+  signed   int                  value;           /* voltage, tone or wait duration */
+  signed   int                  length;
+  unsigned char                 buffer[6];
+  unsigned char                 cont_tone;
+  unsigned char                 tone_burst;
+  unsigned char                 burst_sel;
+  unsigned char                 end_seq;
+} SILABS_DiSEqC_Item;
+
+/* Structure used to store all DiSEqC queue information for one front-end */
+typedef struct _SILABS_DiSEqC_Queue               {
+  SILABS_FE_Context            *front_end;
+  SILABS_DiSEqC_Item            item[DISEQC_QUEUE_SIZE];
+  signed   int                  head;
+  signed   int                  count;
+  signed   int                  ready_ms;        /* time at which the next item can start                 */
+  signed   int                  reply_start_ms;  /* 0 when no reply is being waited for                   */
+  signed   int                  reply_length;
+  unsigned char                 reply_buffer[3];
+  signed   int                  voltage;         /* last queued LNB voltage, -1 if unknown                */
+  signed   int                  tone;            /* last queued continuous tone state, -1 if unknown      */
+  signed   int                  skipped;         /* number of voltage/tone changes skipped as redundant   */
+  signed   int                  overlap_ms;      /* time spent tuning while the DiSEqC bus was busy       */
+} SILABS_DiSEqC_Queue;
+
+extern SILABS_DiSEqC_Queue  DiSEqC_Queue_Table[FRONT_END_COUNT];
+
+SILABS_DiSEqC_Queue *SiLabs_DiSEqC_Queue_Of            (SILABS_FE_Context *front_end);
+signed   int   SiLabs_DiSEqC_Queue_Init                (SILABS_DiSEqC_Queue *queue, SILABS_FE_Context *front_end);
+signed   int   SiLabs_DiSEqC_Queue_Voltage             (SILABS_DiSEqC_Queue *queue, signed   int voltage);
+signed   int   SiLabs_DiSEqC_Queue_Tone                (SILABS_DiSEqC_Queue *queue, unsigned char tone);
+signed   int   SiLabs_DiSEqC_Queue_Voltage_And_Tone    (SILABS_DiSEqC_Queue *queue, signed   int voltage, unsigned char tone);
+signed   int   SiLabs_DiSEqC_Queue_Message             (SILABS_DiSEqC_Queue *queue, signed   int sequence_length, unsigned char *sequence_buffer, unsigned char cont_tone, unsigned char tone_burst, unsigned char burst_sel, unsigned char end_seq);
+signed   int   SiLabs_DiSEqC_Queue_Wait                (SILABS_DiSEqC_Queue *queue, signed   int wait_ms);
+signed   int   SiLabs_DiSEqC_Queue_Process             (SILABS_DiSEqC_Queue *queue);
+signed   int   SiLabs_DiSEqC_Queue_Next_ms             (SILABS_DiSEqC_Queue *queue);
+signed   int   SiLabs_DiSEqC_Queue_Flush               (SILABS_DiSEqC_Queue *queue, signed   int timeout_ms);
+signed   int   SiLabs_DiSEqC_Queue_Reply               (SILABS_DiSEqC_Queue *queue, signed   int *reply_length, unsigned char *reply_buffer);
+signed   int   SiLabs_DiSEqC_Queue_Lock_To_Carrier     (SILABS_DiSEqC_Queue *queue, signed   int standard, signed   int freq, unsigned int symbol_rate_bps, signed   int plp_id);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_DiSEqC_Queue_Test                (SILABS_DiSEqC_Queue *queue, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_DiSEqC_Queue_H_ */
@@ -0,0 +1,804 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Hardware Discovery Functions                                  */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a hardware discovery service, probing several i2c buses                       */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_Auto_Detect_Demods probes the demodulator addresses one after the other on a single bus, and each
+  probe waits for CTS after POWER_UP, then after PART_INFO. The complete board bring-up time is therefore the sum
+  of all probes, and the TER/SAT tuners and LNB controllers still need to be described by the application.
+
+ The discovery service:
+  - probes all configured buses together. Each probe is a small state machine (one i2c transaction per step),
+     and SiLabs_Discovery_Process does one step of all probes in progress on all buses. The waits for CTS
+     of all probes are therefore interleaved, on a single thread.
+  - bounds each wait for CTS to probe_ms, and the complete discovery to timeout_ms. A NACK ends a probe at once.
+     Each probe reads its CTS at most every DISCOVERY_POLL_MS.
+  - on each bus:
+     1- probes the demodulator addresses (START_CLK + POWER_UP, then PART_INFO) and the LNB controller addresses
+         (i2c ack), while all pass-throughs are open.
+     2- for each demodulator found, closes its i2c pass-through, probes the TER tuner addresses (PART_INFO)
+         and the SAT tuner addresses (i2c ack), then opens the pass-through again.
+         Only one pass-through is closed at a time on a bus, as tuners behind different demodulators may use
+         the same address.
+  - builds a front-end description for each demodulator (demodulator, TER tuner, SAT tuner, LNB controller),
+     which SiLabs_Discovery_FE_Init uses to init a front-end.
+
+ Silabs parts (demodulators and TER tuners) are identified by their PART_INFO reply.
+ Register-based parts (SAT tuners, LNB controllers) can not identify themselves: they are only detected
+  by their i2c ack, and their code is the sat_hint/lnb_hint value.
+  A device at a TER tuner address not replying to PART_INFO is reported as a SAT tuner if this address is
+  also a SAT tuner candidate (i.e. AV2018 at 0xc6), and ignored otherwise.
+ LNB controllers are assigned to the demodulators of the same bus in address order.
+ As parts on the bus still answer when a pass-through is closed, the addresses of the parts found on the bus are
+  not probed behind the demodulators.
+
+ The demodulators are powered up during the discovery: it is meant to be used at board bring-up, before any
+  front-end is initialized.
+
+ Use case:
+    SiLabs_Discovery_Init      (&Discovery_Context);
+    SiLabs_Discovery_Bus       (&Discovery_Context, i2c_bus_0);
+    SiLabs_Discovery_Bus       (&Discovery_Context, i2c_bus_1);
+    Discovery_Context.lnb_hint = 25;
+    nb_front_ends = SiLabs_Discovery_Run (&Discovery_Context);
+    for (i=0; i<nb_front_ends; i++) {
+      SiLabs_Discovery_FE_Init (&Discovery_Context, i, &(FrontEnd_Table[i]));
+    }
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[INIT/discovery] Initial version of the hardware discovery
+   <improvement>[INIT/discovery] Pacing the waits for CTS: each probe reads its CTS at most every DISCOVERY_POLL_MS,
+     and SiLabs_Discovery_Run waits until the next probe is due instead of polling the buses.
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   HW_DISCOVERY
+  "If you get a compilation error on this line, it means that you included the Discovery code in your project without defining HW_DISCOVERY.";
+  "Please define HW_DISCOVERY at project-level, or remove the Discovery code from your project";
+#endif /* HW_DISCOVERY */
+
+#ifdef    HW_DISCOVERY
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Discovery "
+#include "SiLabs_API_L3_Wrapper_Discovery.h"
+
+#define DISCOVERY_PHASE_PROBE    0  /* probing the demodulators and LNB controllers                */
+#define DISCOVERY_PHASE_CLOSE    1  /* closing the pass-through of the current demodulator         */
+#define DISCOVERY_PHASE_BEHIND   2  /* probing the tuners behind the current demodulator           */
+#define DISCOVERY_PHASE_OPEN     3  /* opening the pass-through of the current demodulator         */
+#define DISCOVERY_PHASE_DONE     4
+
+#define DISCOVERY_JOB_START      0
+#define DISCOVERY_JOB_POWER      1  /* waiting for CTS after POWER_UP                              */
+#define DISCOVERY_JOB_INFO       2  /* waiting for CTS after PART_INFO                             */
+#define DISCOVERY_JOB_DONE       3
+
+SILABS_Discovery  Discovery_Context;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Discovery_Default_LNB function
+  Use:      Default LNB controller code
+            Used to select the first LNB controller compiled in the wrapper as the default lnb_hint
+  Returns:  the LNB controller code, 0 if none
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Default_LNB       (void) {
+#ifdef    SATELLITE_FRONT_END
+#ifdef    LNBH21_COMPATIBLE
+  return 21;
+#endif /* LNBH21_COMPATIBLE */
+#ifdef    LNBH25_COMPATIBLE
+  return 25;
+#endif /* LNBH25_COMPATIBLE */
+#ifdef    LNBH26_COMPATIBLE
+  return 26;
+#endif /* LNBH26_COMPATIBLE */
+#ifdef    LNBH29_COMPATIBLE
+  return 29;
+#endif /* LNBH29_COMPATIBLE */
+#ifdef    A8293_COMPATIBLE
+  return 0xA8293;
+#endif /* A8293_COMPATIBLE */
+#ifdef    A8297_COMPATIBLE
+  return 0xA8297;
+#endif /* A8297_COMPATIBLE */
+#ifdef    A8302_COMPATIBLE
+  return 0xA8302;
+#endif /* A8302_COMPATIBLE */
+#ifdef    A8304_COMPATIBLE
+  return 0xA8304;
+#endif /* A8304_COMPATIBLE */
+#ifdef    TPS65233_COMPATIBLE
+  return 0x65233;
+#endif /* TPS65233_COMPATIBLE */
+#endif /* SATELLITE_FRONT_END */
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_TER_Code function
+  Use:      TER tuner code
+            Used to convert a TER tuner PART_INFO part and chiprev to the code used by SiLabs_API_Select_TER_Tuner
+             (i.e. part 57 -> 0x2157, part 78 rev 'B' -> 0x2178B)
+  Returns:  the TER tuner code
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_TER_Code          (signed   int part, signed   int chiprev) {
+  signed   int code;
+  code = 0x2100 + ((part/10)<<4) + (part%10);
+  if ( (chiprev == 2) && ( (part == 48) || (part == 58) || (part == 78) || (part == 90) || (part == 91) ) ) {
+    code = (code<<4) + 0xB;
+  }
+  return code;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Valid function
+  Use:      PART_INFO reply check
+            Used to check that a reply with CTS is a PART_INFO reply from a Silabs part, and not the content of
+             the registers of a register-based part
+  Returns:  1 if this is a PART_INFO reply, 0 otherwise
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Valid             (unsigned char *reply) {
+  if ( (reply[0] & 0xc0) != 0x80          ) { return 0; } /* CTS without ERR        */
+  if ( (reply[2] < 10) || (reply[2] > 99) ) { return 0; } /* Si21xx part            */
+  if ( (reply[3] < '0') || (reply[3] > '9') ) { return 0; } /* ASCII pmajor         */
+  if ( (reply[4] < '0') || (reply[4] > '9') ) { return 0; } /* ASCII pminor         */
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Candidate function
+  Use:      Candidate address check
+            Used to check if an address is in a candidate address list
+  Returns:  1 if the address is in the list, 0 otherwise
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Candidate         (unsigned char *list, signed   int nb, unsigned char address) {
+  signed   int i;
+  for (i=0; i<nb; i++) { if (list[i] == address) { return 1; } }
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_On_Bus function
+  Use:      Bus device check
+            Used to skip the addresses of the parts found on bus b when probing behind a demodulator, as parts on the bus
+             still answer when a pass-through is closed.
+  Returns:  1 if a part was found at this address on bus b, 0 otherwise
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_On_Bus            (SILABS_Discovery *discovery, signed   int b, unsigned char address) {
+  signed   int i;
+  for (i=0; i<discovery->nb_devices; i++) {
+    if ( (discovery->device[i].bus == b) && (discovery->device[i].parent < 0) && (discovery->device[i].address == address) ) { return 1; }
+  }
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Device_Add function
+  Use:      Discovered device storage
+            Used to store a device found by a probe. reply is the PART_INFO reply of Silabs parts, NULL otherwise.
+  Returns:  the device index, -1 if the device table is full
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Device_Add        (SILABS_Discovery *discovery, signed   int b, SILABS_Discovery_Kind kind, SILABS_Discovery_Job *job, unsigned char *reply) {
+  SILABS_Discovery_Device *device;
+  if (discovery->nb_devices >= DISCOVERY_MAX_DEVICES) { return -1; }
+  device = &(discovery->device[discovery->nb_devices]);
+  memset(device, 0, sizeof(SILABS_Discovery_Device));
+  device->bus      = b;
+  device->kind     = kind;
+  device->address  = job->i2c.address;
+  device->parent   = job->parent;
+  device->probe_ms = system_time() - discovery->start_ms;
+  if (reply != NULL) {
+    device->chiprev = reply[1] & 0x0f;
+    device->part    = reply[2];
+    device->pmajor  = reply[3];
+    device->pminor  = reply[4];
+    device->pbuild  = reply[5];
+    device->romid   = reply[12];
+  }
+  switch (kind) {
+    case SILABS_DISCOVERY_DEMOD    : { device->code = 0x2183; break; } /* all Si21xx demodulators are controlled by the Si2183 code */
+    case SILABS_DISCOVERY_TER_TUNER: { device->code = SiLabs_Discovery_TER_Code(device->part, device->chiprev); break; }
+    case SILABS_DISCOVERY_SAT_TUNER: { device->code = discovery->sat_hint; break; }
+    case SILABS_DISCOVERY_LNB      : { device->code = discovery->lnb_hint; break; }
+    default                        : { break; }
+  }
+  SiTRACE("bus %d: %s at 0x%02x (part %d, code 0x%x) after %d ms\n", b, SiLabs_Discovery_Kind_Text(kind), device->address, device->part, device->code, device->probe_ms);
+  return discovery->nb_devices++;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Job_Add function
+  Use:      Probe creation
+            Used to start a probe of the given kind at the given address on bus b
+  Returns:  1 if ok, 0 if the job table is full
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Job_Add           (SILABS_Discovery *discovery, signed   int b, SILABS_Discovery_Kind kind, unsigned char address, signed   int parent) {
+  SILABS_Discovery_Bus *bus;
+  SILABS_Discovery_Job *job;
+  bus = &(discovery->bus[b]);
+  if (bus->nb_jobs >= DISCOVERY_MAX_JOBS) { return 0; }
+  job = &(bus->job[bus->nb_jobs]);
+  memset(job, 0, sizeof(SILABS_Discovery_Job));
+  job->kind          = kind;
+  job->state         = DISCOVERY_JOB_START;
+  job->parent        = parent;
+  job->i2c           = *(bus->i2c);
+  job->i2c.address   = address;
+  job->i2c.indexSize = 0;
+  job->i2c.stats_index = -1;
+  snprintf(job->i2c.tag, SILABS_TAG_SIZE, "discovery");
+  bus->nb_jobs++;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Step function
+  Use:      Probe step
+            Used to do one i2c transaction of a probe.
+            Demodulators:                         START_CLK + POWER_UP, CTS, PART_INFO, CTS + PART_INFO reply
+            TER tuners:                           status, PART_INFO, CTS + PART_INFO reply
+            SAT tuners and LNB controllers:       1 byte read (ack)
+            Pass-through:                         I2C_PASSTHROUGH (close or open, depending on the bus phase)
+************************************************************************************************************************/
+static void         SiLabs_Discovery_Step              (SILABS_Discovery *discovery, signed   int b, SILABS_Discovery_Job *job) {
+  unsigned char START_CLK_Bytes[13] = { 0xc0, 0x12, 0x00, 0x0c, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  unsigned char POWER_UP_Bytes[8]   = { 0xc0, 0x06, 0x01, 0x0f, 0x00, 0x20, 0x20, 0x01 };
+  unsigned char PART_INFO_Bytes[1]  = { 0x02 };
+  unsigned char PASSTHRU_Bytes[3]   = { 0xc0, 0x0d, 0x00 };
+  unsigned char reply[13];
+  signed   int  now;
+  now = system_time();
+  discovery->transactions++;
+  switch (job->state) {
+    case DISCOVERY_JOB_START: {
+      job->deadline_ms = now + discovery->probe_ms;
+      job->state       = DISCOVERY_JOB_DONE;
+      if ( (job->kind == SILABS_DISCOVERY_SAT_TUNER) || (job->kind == SILABS_DISCOVERY_LNB) ) {
+        if (L0_ReadCommandBytes(&(job->i2c), 1, reply) != 1) { discovery->nacks++; break; }
+        job->result = 1;
+        SiLabs_Discovery_Device_Add(discovery, b, job->kind, job, NULL);
+        break;
+      }
+      if (job->kind == SILABS_DISCOVERY_PASSTHRU) {
+        /* I2C_PASSTHROUGH has no response */
+        PASSTHRU_Bytes[2] = (discovery->bus[b].phase == DISCOVERY_PHASE_CLOSE) ? 0x01 : 0x00;
+        if (L0_WriteCommandBytes(&(job->i2c), 3, PASSTHRU_Bytes) != 3) { discovery->nacks++; break; }
+        job->result = 1;
+        break;
+      }
+      if (job->kind == SILABS_DISCOVERY_DEMOD) {
+        if (L0_WriteCommandBytes(&(job->i2c), sizeof(START_CLK_Bytes), START_CLK_Bytes) != sizeof(START_CLK_Bytes)) { discovery->nacks++; break; }
+        L0_WriteCommandBytes(&(job->i2c), sizeof(POWER_UP_Bytes), POWER_UP_Bytes);
+        discovery->transactions++;
+        job->next_ms = now + DISCOVERY_POLL_MS;
+        job->state   = DISCOVERY_JOB_POWER;
+        break;
+      }
+      /* TER tuner */
+      if (L0_ReadCommandBytes(&(job->i2c), 1, reply) != 1) { discovery->nacks++; break; }
+      if (reply[0] == 0xfe) {
+        /* Silabs tuner between RESET_HW and POWER_UP: PART_INFO is not available */
+        job->result = 1;
+        SiLabs_Discovery_Device_Add(discovery, b, SILABS_DISCOVERY_TER_TUNER, job, NULL);
+        break;
+      }
+      L0_WriteCommandBytes(&(job->i2c), sizeof(PART_INFO_Bytes), PART_INFO_Bytes);
+      discovery->transactions++;
+      job->next_ms = now + DISCOVERY_POLL_MS;
+      job->state   = DISCOVERY_JOB_INFO;
+      break;
+    }
+    case DISCOVERY_JOB_POWER: {
+      if (L0_ReadCommandBytes(&(job->i2c), 1, reply) != 1) { discovery->nacks++; job->state = DISCOVERY_JOB_DONE; break; }
+      if (reply[0] & 0x80) {
+        L0_WriteCommandBytes(&(job->i2c), sizeof(PART_INFO_Bytes), PART_INFO_Bytes);
+        discovery->transactions++;
+        job->deadline_ms = now + discovery->probe_ms;
+        job->next_ms     = now + DISCOVERY_POLL_MS;
+        job->state       = DISCOVERY_JOB_INFO;
+        break;
+      }
+      if (now > job->deadline_ms) {
+        SiTRACE("bus %d: no CTS after POWER_UP at 0x%02x\n", b, job->i2c.address);
+        discovery->timeouts++;
+        job->state = DISCOVERY_JOB_DONE;
+      }
+      job->next_ms = now + DISCOVERY_POLL_MS;
+      break;
+    }
+    case DISCOVERY_JOB_INFO: {
+      if (L0_ReadCommandBytes(&(job->i2c), 13, reply) != 13) { discovery->nacks++; job->state = DISCOVERY_JOB_DONE; break; }
+      if (reply[0] & 0x80) {
+        job->state = DISCOVERY_JOB_DONE;
+        if (SiLabs_Discovery_Valid(reply)) {
+          job->result = 1;
+          SiLabs_Discovery_Device_Add(discovery, b, job->kind, job, reply);
+          break;
+        }
+      } else if (now > job->deadline_ms) {
+        discovery->timeouts++;
+        job->state = DISCOVERY_JOB_DONE;
+      } else {
+        job->next_ms = now + DISCOVERY_POLL_MS;
+        break;
+      }
+      /* register-based part at a TER tuner address */
+      if ( (job->kind == SILABS_DISCOVERY_TER_TUNER) && (SiLabs_Discovery_Candidate(discovery->sat_add, discovery->nb_sat_add, job->i2c.address)) ) {
+        job->result = 1;
+        SiLabs_Discovery_Device_Add(discovery, b, SILABS_DISCOVERY_SAT_TUNER, job, NULL);
+      } else {
+        SiTRACE("bus %d: unidentified device at 0x%02x\n", b, job->i2c.address);
+      }
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Phase function
+  Use:      Bus phase sequencing
+            Used once all probes of the current phase are done on bus b, to start the probes of the next phase
+************************************************************************************************************************/
+static void         SiLabs_Discovery_Phase             (SILABS_Discovery *discovery, signed   int b) {
+  SILABS_Discovery_Bus *bus;
+  unsigned char         demod_add;
+  signed   int          i;
+  bus = &(discovery->bus[b]);
+  switch (bus->phase) {
+    case DISCOVERY_PHASE_PROBE:
+    case DISCOVERY_PHASE_OPEN: {
+      bus->nb_jobs = 0;
+      for (i = bus->demod + 1; i < discovery->nb_devices; i++) {
+        if ( (discovery->device[i].bus == b) && (discovery->device[i].kind == SILABS_DISCOVERY_DEMOD) ) { break; }
+      }
+      if (i >= discovery->nb_devices) {
+        bus->demod   = -1;
+        bus->phase   = DISCOVERY_PHASE_DONE;
+        bus->done_ms = system_time() - discovery->start_ms;
+        SiTRACE("bus %d done after %d ms\n", b, bus->done_ms);
+        break;
+      }
+      bus->demod = i;
+      bus->phase = DISCOVERY_PHASE_CLOSE;
+      SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_PASSTHRU, discovery->device[i].address, i);
+      break;
+    }
+    case DISCOVERY_PHASE_CLOSE: {
+      if (bus->job[0].result) {
+        bus->nb_jobs = 0;
+        bus->phase   = DISCOVERY_PHASE_BEHIND;
+        for (i=0; i<discovery->nb_ter_add; i++) {
+          if (SiLabs_Discovery_On_Bus(discovery, b, discovery->ter_add[i])) { continue; }
+          SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_TER_TUNER, discovery->ter_add[i], bus->demod);
+        }
+        for (i=0; i<discovery->nb_sat_add; i++) {
+          if (SiLabs_Discovery_On_Bus(discovery, b, discovery->sat_add[i])) { continue; }
+          if (SiLabs_Discovery_Candidate(discovery->ter_add, discovery->nb_ter_add, discovery->sat_add[i])) { continue; }
+          SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_SAT_TUNER, discovery->sat_add[i], bus->demod);
+        }
+        break;
+      }
+      /* the pass-through could not be closed: opening it anyway */
+    }
+    /* fall through */
+    case DISCOVERY_PHASE_BEHIND: {
+      demod_add    = discovery->device[bus->demod].address;
+      bus->nb_jobs = 0;
+      bus->phase   = DISCOVERY_PHASE_OPEN;
+      SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_PASSTHRU, demod_add, bus->demod);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Topology function
+  Use:      Front-ends description
+            Used at the end of the discovery to build one front-end description per demodulator.
+            TER and SAT tuners are those found behind the demodulator, LNB controllers are assigned in address order.
+  Returns:  the number of front-ends
+************************************************************************************************************************/
+static signed   int SiLabs_Discovery_Topology          (SILABS_Discovery *discovery) {
+  SILABS_Discovery_Front_End *fe;
+  SILABS_Discovery_Device    *device;
+  signed   int                demods;
+  signed   int                lnbs;
+  signed   int                i;
+  signed   int                j;
+  discovery->nb_front_ends = 0;
+  for (i=0; i<discovery->nb_devices; i++) {
+    if (discovery->device[i].kind != SILABS_DISCOVERY_DEMOD) { continue; }
+    if (discovery->nb_front_ends >= DISCOVERY_MAX_FRONT_ENDS) { break; }
+    fe = &(discovery->front_end[discovery->nb_front_ends]);
+    memset(fe, 0, sizeof(SILABS_Discovery_Front_End));
+    fe->bus        = discovery->device[i].bus;
+    fe->demod      = i;
+    fe->demod_add  = discovery->device[i].address;
+    fe->demod_code = discovery->device[i].code;
+    demods = 0;
+    for (j=0; j<i; j++) {
+      if ( (discovery->device[j].kind == SILABS_DISCOVERY_DEMOD) && (discovery->device[j].bus == fe->bus) ) { demods++; }
+    }
+    lnbs = 0;
+    for (j=0; j<discovery->nb_devices; j++) {
+      device = &(discovery->device[j]);
+      if ( (device->kind == SILABS_DISCOVERY_TER_TUNER) && (device->parent == i) && (fe->ter_add == 0) ) {
+        fe->ter_add  = device->address;
+        fe->ter_code = device->code;
+      }
+      if ( (device->kind == SILABS_DISCOVERY_SAT_TUNER) && (device->parent == i) && (fe->sat_add == 0) ) {
+        fe->sat_add  = device->address;
+        fe->sat_code = device->code;
+      }
+      if ( (device->kind == SILABS_DISCOVERY_LNB) && (device->bus == fe->bus) ) {
+        if (lnbs == demods) {
+          fe->lnb_add  = device->address;
+          fe->lnb_code = device->code;
+        }
+        lnbs++;
+      }
+    }
+    discovery->nb_front_ends++;
+  }
+  return discovery->nb_front_ends;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Init function
+  Use:      Discovery initialization
+            Used to clear the buses and results, and to set the default candidate addresses, hints and timeouts
+  Returns:  1
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Init              (SILABS_Discovery *discovery) {
+  memset(discovery, 0, sizeof(SILABS_Discovery));
+  SiLabs_Discovery_Addresses(discovery, SILABS_DISCOVERY_DEMOD    , 0xc8, 0xce);
+  SiLabs_Discovery_Addresses(discovery, SILABS_DISCOVERY_TER_TUNER, 0xc0, 0xc6);
+  SiLabs_Discovery_Addresses(discovery, SILABS_DISCOVERY_SAT_TUNER, 0x14, 0x18);
+  SiLabs_Discovery_Addresses(discovery, SILABS_DISCOVERY_LNB      , 0x10, 0x16);
+  discovery->sat_add[discovery->nb_sat_add++] = 0xc6; /* AV2018 */
+  discovery->sat_hint   = 0;
+  discovery->lnb_hint   = SiLabs_Discovery_Default_LNB();
+  discovery->probe_ms   = DISCOVERY_PROBE_MS;
+  discovery->timeout_ms = DISCOVERY_TIMEOUT_MS;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Bus function
+  Use:      Bus declaration
+            Used to add an i2c bus to probe. The bus context is used as a template for all probes on this bus
+             (connection type, adapter), and is not modified.
+  Returns:  the bus index, -1 if DISCOVERY_MAX_BUSES buses are already declared
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Bus               (SILABS_Discovery *discovery, L0_Context *i2c) {
+  if (discovery->nb_buses >= DISCOVERY_MAX_BUSES) { return -1; }
+  discovery->bus[discovery->nb_buses].i2c = i2c;
+  return discovery->nb_buses++;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Addresses function
+  Use:      Candidate addresses selection
+            Used to set the candidate addresses for a kind of device, from first to last (by steps of 2).
+            Use first = 0 to probe no address for this kind of device.
+  Returns:  the number of candidate addresses
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Addresses         (SILABS_Discovery *discovery, SILABS_Discovery_Kind kind, signed   int first, signed   int last) {
+  unsigned char *list;
+  signed   int  *nb;
+  signed   int   add;
+  switch (kind) {
+    case SILABS_DISCOVERY_DEMOD    : { list = discovery->demod_add; nb = &(discovery->nb_demod_add); break; }
+    case SILABS_DISCOVERY_TER_TUNER: { list = discovery->ter_add  ; nb = &(discovery->nb_ter_add  ); break; }
+    case SILABS_DISCOVERY_SAT_TUNER: { list = discovery->sat_add  ; nb = &(discovery->nb_sat_add  ); break; }
+    case SILABS_DISCOVERY_LNB      : { list = discovery->lnb_add  ; nb = &(discovery->nb_lnb_add  ); break; }
+    default                        : { return 0; }
+  }
+  *nb = 0;
+  if (first == 0) { return 0; }
+  for (add = first; (add <= last) && (*nb < DISCOVERY_MAX_ADDRESSES); add = add + 2) {
+    list[(*nb)++] = (unsigned char)add;
+  }
+  return *nb;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Start function
+  Use:      Discovery start
+            Used to clear the previous results and to start the demodulator and LNB controller probes on all buses
+  Returns:  the number of probes started
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Start             (SILABS_Discovery *discovery) {
+  signed   int jobs;
+  signed   int b;
+  signed   int i;
+  discovery->start_ms      = system_time();
+  discovery->elapsed_ms    = 0;
+  discovery->done          = 0;
+  discovery->rounds        = 0;
+  discovery->transactions  = 0;
+  discovery->nacks         = 0;
+  discovery->timeouts      = 0;
+  discovery->nb_devices    = 0;
+  discovery->nb_front_ends = 0;
+  jobs = 0;
+  for (b=0; b<discovery->nb_buses; b++) {
+    discovery->bus[b].phase   = DISCOVERY_PHASE_PROBE;
+    discovery->bus[b].demod   = -1;
+    discovery->bus[b].nb_jobs = 0;
+    discovery->bus[b].done_ms = -1;
+    for (i=0; i<discovery->nb_demod_add; i++) { jobs += SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_DEMOD, discovery->demod_add[i], -1); }
+    for (i=0; i<discovery->nb_lnb_add  ; i++) { jobs += SiLabs_Discovery_Job_Add(discovery, b, SILABS_DISCOVERY_LNB  , discovery->lnb_add[i]  , -1); }
+  }
+  SiTRACE("discovery started on %d buses (%d probes)\n", discovery->nb_buses, jobs);
+  return jobs;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Process function
+  Use:      Discovery progress
+            Used to do one step of all probes in progress on all buses, and to move each bus to its next phase
+             once its current probes are done.
+            Probes waiting for CTS are only stepped once their next_ms is reached. discovery->next_ms is the time at
+             which the next probe is due.
+            After timeout_ms, the discovery ends with the devices found so far.
+  Returns:  1 when the discovery is done, 0 otherwise
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Process           (SILABS_Discovery *discovery) {
+  SILABS_Discovery_Bus *bus;
+  signed   int          pending;
+  signed   int          busy;
+  signed   int          now;
+  signed   int          b;
+  signed   int          i;
+  if (discovery->done) { return 1; }
+  discovery->rounds++;
+  busy = 0;
+  now  = system_time();
+  discovery->next_ms = now + DISCOVERY_POLL_MS;
+  for (b=0; b<discovery->nb_buses; b++) {
+    bus = &(discovery->bus[b]);
+    if (bus->phase == DISCOVERY_PHASE_DONE) { continue; }
+    pending = 0;
+    for (i=0; i<bus->nb_jobs; i++) {
+      if (bus->job[i].state == DISCOVERY_JOB_DONE) { continue; }
+      if (now >= bus->job[i].next_ms) { SiLabs_Discovery_Step(discovery, b, &(bus->job[i])); }
+      if (bus->job[i].state != DISCOVERY_JOB_DONE) {
+        pending++;
+        if (bus->job[i].next_ms < discovery->next_ms) { discovery->next_ms = bus->job[i].next_ms; }
+      }
+    }
+    if (pending == 0) { SiLabs_Discovery_Phase(discovery, b); discovery->next_ms = now; }
+    if (bus->phase != DISCOVERY_PHASE_DONE) { busy++; }
+  }
+  discovery->elapsed_ms = system_time() - discovery->start_ms;
+  if ( (busy) && (discovery->elapsed_ms <= discovery->timeout_ms) ) { return 0; }
+  if (busy) {
+    SiERROR("hardware discovery timeout\n");
+    discovery->timeouts += busy;
+  }
+  SiLabs_Discovery_Topology(discovery);
+  discovery->done = 1;
+  SiTRACE("discovery done after %d ms: %d devices, %d front-ends\n", discovery->elapsed_ms, discovery->nb_devices, discovery->nb_front_ends);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Run function
+  Use:      Complete discovery
+            Used to run the discovery until it is done (at most timeout_ms plus the duration of one step)
+            Between 2 calls to SiLabs_Discovery_Process, waits until the next probe is due
+  Returns:  the number of front-ends found
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Run               (SILABS_Discovery *discovery) {
+  signed   int wait_ms;
+  SiLabs_Discovery_Start(discovery);
+  while (SiLabs_Discovery_Process(discovery) == 0) {
+    wait_ms = discovery->next_ms - system_time();
+    if (wait_ms > 0) { system_wait(wait_ms); }
+  }
+  return discovery->nb_front_ends;
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_FE_Init function
+  Use:      Front-end SW configuration from the topology
+            Used to SW init a front-end with the parts found for the discovered front-end of the given index,
+             and to connect it with the connection type of its bus.
+            The remaining configuration (clocks, AGCs, ...) depends on the board and is still needed.
+  Returns:  1 if ok, 0 if index is not a discovered front-end
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_FE_Init           (SILABS_Discovery *discovery, signed   int index, SILABS_FE_Context *front_end) {
+  SILABS_Discovery_Front_End *fe;
+  signed   int                ter_add;
+  signed   int                sat_add;
+  if ( (index < 0) || (index >= discovery->nb_front_ends) ) { return 0; }
+  fe = &(discovery->front_end[index]);
+  ter_add = fe->ter_add ? fe->ter_add : discovery->ter_add[0];
+  sat_add = fe->sat_add ? fe->sat_add : discovery->sat_add[0];
+  SiLabs_API_Frontend_Chip           (front_end, fe->demod_code);
+  SiLabs_API_SW_Init                 (front_end, fe->demod_add, ter_add, sat_add);
+#ifdef    TERRESTRIAL_FRONT_END
+  if (fe->ter_code) { SiLabs_API_Select_TER_Tuner (front_end, fe->ter_code, 0); }
+#endif /* TERRESTRIAL_FRONT_END */
+#ifdef    SATELLITE_FRONT_END
+  if (fe->sat_code) { SiLabs_API_Select_SAT_Tuner (front_end, fe->sat_code, 0); }
+  if (fe->lnb_add ) { SiLabs_API_SAT_Select_LNB_Chip (front_end, fe->lnb_code, fe->lnb_add); }
+#endif /* SATELLITE_FRONT_END */
+  SiLabs_API_HW_Connect              (front_end, discovery->bus[fe->bus].i2c->connectionType);
+  return 1;
+}
+#ifdef    FRONTEND_REGISTRY
+/************************************************************************************************************************
+  SiLabs_Discovery_Register function
+  Use:      Front-ends registration from the topology
+            Used to add all discovered front-ends to a front-end registry (on their bus, and on the given board),
+             and to SW init them with SiLabs_Discovery_FE_Init.
+  Returns:  the number of registered front-ends
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Register          (SILABS_Discovery *discovery, struct _SILABS_FE_Registry *registry, signed   int board) {
+  signed   int handle;
+  signed   int i;
+  for (i=0; i<discovery->nb_front_ends; i++) {
+    handle = SiLabs_FE_Registry_Add(registry, discovery->front_end[i].bus, board);
+    if (handle < 0) { break; }
+    SiLabs_Discovery_FE_Init(discovery, i, SiLabs_FE_Registry_Get(registry, handle));
+  }
+  return i;
+}
+#endif /* FRONTEND_REGISTRY */
+/************************************************************************************************************************
+  SiLabs_Discovery_Kind_Text function
+  Use:      Device kind text
+  Returns:  the text corresponding to a device kind
+************************************************************************************************************************/
+const    char      *SiLabs_Discovery_Kind_Text         (SILABS_Discovery_Kind kind) {
+  switch (kind) {
+    case SILABS_DISCOVERY_DEMOD    : return "demod";
+    case SILABS_DISCOVERY_TER_TUNER: return "TER tuner";
+    case SILABS_DISCOVERY_SAT_TUNER: return "SAT tuner";
+    case SILABS_DISCOVERY_LNB      : return "LNB";
+    case SILABS_DISCOVERY_PASSTHRU : return "pass-through";
+    default                        : break;
+  }
+  return "none";
+}
+/************************************************************************************************************************
+  SiLabs_Discovery_Text function
+  Use:      Topology text
+            Used to list the discovered front-ends and devices in a text buffer of the given size
+  Returns:  the number of front-ends
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Text              (SILABS_Discovery *discovery, char *text, signed   int size) {
+  SILABS_Discovery_Front_End *fe;
+  SILABS_Discovery_Device    *device;
+  signed   int                i;
+  snprintf(text, size, "%d bus(es), %d front-end(s), %d device(s) in %d ms (%d rounds, %d transactions, %d nacks, %d timeouts)\n"
+    , discovery->nb_buses, discovery->nb_front_ends, discovery->nb_devices, discovery->elapsed_ms, discovery->rounds, discovery->transactions, discovery->nacks, discovery->timeouts);
+  for (i=0; i<discovery->nb_front_ends; i++) {
+    fe = &(discovery->front_end[i]);
+    snprintf(text + strlen(text), size - strlen(text), " fe %2d bus %d: demod 0x%02x 0x%x ter 0x%02x 0x%x sat 0x%02x 0x%x lnb 0x%02x 0x%x\n"
+      , i, fe->bus, fe->demod_add, fe->demod_code, fe->ter_add, fe->ter_code, fe->sat_add, fe->sat_code, fe->lnb_add, fe->lnb_code);
+  }
+  for (i=0; i<discovery->nb_devices; i++) {
+    device = &(discovery->device[i]);
+    if (device->part) {
+      snprintf(text + strlen(text), size - strlen(text), " bus %d 0x%02x %-9s Si21%02d-%c%c%c ROM%x NVM%c_%cb%d", device->bus, device->address, SiLabs_Discovery_Kind_Text(device->kind)
+        , device->part, device->chiprev + 0x40, device->pmajor, device->pminor, device->romid, device->pmajor, device->pminor, device->pbuild);
+    } else {
+      snprintf(text + strlen(text), size - strlen(text), " bus %d 0x%02x %-9s code 0x%x", device->bus, device->address, SiLabs_Discovery_Kind_Text(device->kind), device->code);
+    }
+    if (device->parent >= 0) {
+      snprintf(text + strlen(text), size - strlen(text), " behind 0x%02x", discovery->device[device->parent].address);
+    }
+    snprintf(text + strlen(text), size - strlen(text), " (%d ms)\n", device->probe_ms);
+  }
+  return discovery->nb_front_ends;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Discovery_Test function
+  Use:      Generic test pipe function
+            Used to send a generic command to the hardware discovery.
+            When no bus is declared, the bus of the current front-end's demodulator is used.
+  Returns:  0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int        SiLabs_Discovery_Test              (SILABS_Discovery *discovery, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int first;
+  signed   int last;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible hardware discovery test commands:\n\
+run                               : discover the parts on all buses, returns the number of front-ends\n\
+status                            : list the discovered front-ends and devices\n\
+probe_ms           <ms>           : set the timeout of each probe\n\
+timeout_ms         <ms>           : set the timeout of the complete discovery\n\
+addresses          <kind>         : set the candidate addresses (1 demod, 2 TER, 3 SAT, 4 LNB, sub_cmd '<first> <last>')\n\
+lnb_hint           <code>         : set the LNB controller code\n\
+sat_hint           <code>         : set the SAT tuner code\n\
+fe_init            <index>        : SW init the current front-end as the discovered front-end of this index\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "run"                ) == 0) {
+    if (discovery->nb_buses == 0) {
+#ifdef    Si2183_COMPATIBLE
+      if (SILABS_DEMOD_CHIP(front_end) == 0x2183) { SiLabs_Discovery_Bus(discovery, front_end->Si2183_FE->demod->i2c); }
+#endif /* Si2183_COMPATIBLE */
+    }
+    *retdval = SiLabs_Discovery_Run(discovery);
+    SiLabs_Discovery_Text(discovery, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = SiLabs_Discovery_Text(discovery, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "probe_ms"           ) == 0) {
+    if (dval > 0) { discovery->probe_ms = (signed int)dval; }
+    *retdval = discovery->probe_ms;
+    snprintf(*rettxt, 1000, "probe_ms %d\n", discovery->probe_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "timeout_ms"         ) == 0) {
+    if (dval > 0) { discovery->timeout_ms = (signed int)dval; }
+    *retdval = discovery->timeout_ms;
+    snprintf(*rettxt, 1000, "timeout_ms %d\n", discovery->timeout_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "addresses"          ) == 0) {
+    first = 0;
+    last  = 0;
+    sscanf(sub_cmd, "%i %i", &first, &last);
+    *retdval = SiLabs_Discovery_Addresses(discovery, (SILABS_Discovery_Kind)(signed int)dval, first, last);
+    snprintf(*rettxt, 1000, "%s: %d candidate addresses\n", SiLabs_Discovery_Kind_Text((SILABS_Discovery_Kind)(signed int)dval), (signed int)*retdval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "lnb_hint"           ) == 0) {
+    discovery->lnb_hint = (signed int)dval;
+    *retdval = discovery->lnb_hint;
+    snprintf(*rettxt, 1000, "lnb_hint 0x%x\n", discovery->lnb_hint);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "sat_hint"           ) == 0) {
+    discovery->sat_hint = (signed int)dval;
+    *retdval = discovery->sat_hint;
+    snprintf(*rettxt, 1000, "sat_hint 0x%x\n", discovery->sat_hint);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "fe_init"            ) == 0) {
+    *retdval = SiLabs_Discovery_FE_Init(discovery, (signed int)dval, front_end);
+    snprintf(*rettxt, 1000, "fe_init %d: %s\n", (signed int)dval, (*retdval) ? "done" : "no such discovered front-end");
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* HW_DISCOVERY */
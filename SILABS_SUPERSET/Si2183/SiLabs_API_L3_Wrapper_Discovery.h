@@ -0,0 +1,153 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Discovery_H_
+#define  _SiLabs_API_L3_Wrapper_Discovery_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[INIT/discovery] Adding a hardware discovery service via SiLabs_API_L3_Wrapper_Discovery.c/.h
+        All i2c buses are probed together, with a timeout on each probe, and the resulting topology is used to init the front-ends.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISCOVERY_MAX_BUSES            8  /* Maximum number of i2c buses                                                     */
+#define DISCOVERY_MAX_ADDRESSES        8  /* Maximum number of candidate addresses for each kind of device                   */
+#define DISCOVERY_MAX_JOBS            16  /* Maximum number of probes in progress on a bus                                    */
+#define DISCOVERY_MAX_DEVICES         64  /* Maximum number of discovered devices (all buses)                                 */
+#define DISCOVERY_MAX_FRONT_ENDS      32  /* Maximum number of discovered front-ends (all buses)                              */
+#define DISCOVERY_PROBE_MS            50  /* Default timeout of each wait for CTS (after POWER_UP or PART_INFO)               */
+#define DISCOVERY_TIMEOUT_MS        1000  /* Default timeout of the complete discovery                                        */
+#define DISCOVERY_POLL_MS              1  /* Minimum interval between 2 CTS reads of the same probe                           */
+
+typedef enum _SILABS_Discovery_Kind               {
+  SILABS_DISCOVERY_NONE = 0,
+  SILABS_DISCOVERY_DEMOD,                        /* Silabs demodulator, identified by PART_INFO                        */
+  SILABS_DISCOVERY_TER_TUNER,                    /* Silabs TER tuner behind a demodulator, identified by PART_INFO     */
+  SILABS_DISCOVERY_SAT_TUNER,                    /* register-based SAT tuner behind a demodulator (i2c ack)            */
+  SILABS_DISCOVERY_LNB,                          /* register-based LNB controller on the bus (i2c ack)                 */
+  SILABS_DISCOVERY_PASSTHRU                      /* demodulator i2c pass-through (probe only)                          */
+} SILABS_Discovery_Kind;
+
+/* Structure used to store one discovered device */
+typedef struct _SILABS_Discovery_Device           {
+  signed   int                  bus;
+  SILABS_Discovery_Kind         kind;
+  unsigned char                 address;
+  signed   int                  parent;          /* device index of the demodulator providing the i2c pass-through, -1 on the bus */
+  signed   int                  part;            /* PART_INFO part (i.e. 83 for a Si2183), 0 for register-based parts             */
+  signed   int                  chiprev;         /* PART_INFO chiprev (1 for 'A', 2 for 'B', ...)                                 */
+  signed   int                  pmajor;
+  signed   int                  pminor;
+  signed   int                  pbuild;
+  signed   int                  romid;
+  signed   int                  code;            /* code to use in the wrapper (0x2183, 0x2157, 0x2178B, SAT/LNB hint, ...)       */
+  signed   int                  probe_ms;        /* time from the discovery start until the device is identified                  */
+} SILABS_Discovery_Device;
+
+/* Structure used to store one discovered front-end, as used by SiLabs_Discovery_FE_Init */
+typedef struct _SILABS_Discovery_Front_End        {
+  signed   int                  bus;
+  signed   int                  demod;           /* device index of the demodulator                                               */
+  signed   int                  demod_add;
+  signed   int                  demod_code;
+  signed   int                  ter_add;         /* 0 if no TER tuner was found                                                   */
+  signed   int                  ter_code;
+  signed   int                  sat_add;         /* 0 if no SAT tuner was found                                                   */
+  signed   int                  sat_code;
+  signed   int                  lnb_add;         /* 0 if no LNB controller was found                                              */
+  signed   int                  lnb_code;
+} SILABS_Discovery_Front_End;
+
+/* Structure used to store one probe in progress */
+typedef struct _SILABS_Discovery_Job              {
+  SILABS_Discovery_Kind         kind;
+  signed   int                  state;
+  signed   int                  parent;          /* device index of the demodulator with its pass-through closed, -1 if none      */
+  signed   int                  deadline_ms;     /* time at which the current wait is abandoned                                   */
+  signed   int                  next_ms;         /* the next CTS read of this probe is not done before this time                  */
+  signed   int                  result;          /* 1 if the device is present (or the pass-through command is done)              */
+  L0_Context                    i2c;
+} SILABS_Discovery_Job;
+
+/* Structure used to store the discovery progress on one bus */
+typedef struct _SILABS_Discovery_Bus              {
+  L0_Context                   *i2c;             /* application bus context (connection type, adapter)                            */
+  signed   int                  phase;           /* DISCOVERY_PHASE_xxx (in the .c file)                                          */
+  signed   int                  demod;           /* device index of the demodulator with its pass-through closed, -1 if none      */
+  SILABS_Discovery_Job          job[DISCOVERY_MAX_JOBS];
+  signed   int                  nb_jobs;
+  signed   int                  done_ms;         /* time needed to complete this bus, -1 until done                               */
+} SILABS_Discovery_Bus;
+
+/* Structure used to store the discovery configuration and results */
+typedef struct _SILABS_Discovery                  {
+  SILABS_Discovery_Bus          bus[DISCOVERY_MAX_BUSES];
+  signed   int                  nb_buses;
+  unsigned char                 demod_add[DISCOVERY_MAX_ADDRESSES]; /* candidate demodulator addresses, on the buses          */
+  signed   int                  nb_demod_add;
+  unsigned char                 ter_add  [DISCOVERY_MAX_ADDRESSES]; /* candidate TER tuner addresses, behind the demodulators */
+  signed   int                  nb_ter_add;
+  unsigned char                 sat_add  [DISCOVERY_MAX_ADDRESSES]; /* candidate SAT tuner addresses, behind the demodulators */
+  signed   int                  nb_sat_add;
+  unsigned char                 lnb_add  [DISCOVERY_MAX_ADDRESSES]; /* candidate LNB controller addresses, on the buses       */
+  signed   int                  nb_lnb_add;
+  signed   int                  sat_hint;        /* SAT tuner code of register-based SAT tuners, 0 to keep the default SAT tuner  */
+  signed   int                  lnb_hint;        /* LNB controller code of register-based LNB controllers                         */
+  signed   int                  probe_ms;
+  signed   int                  timeout_ms;
+  signed   int                  start_ms;
+  signed   int                  elapsed_ms;      /* duration of the last discovery                                                */
+  signed   int                  next_ms;         /* earliest next_ms of the probes in progress                                    */
+  signed   int                  done;            /* 1 when all buses are done (or after the discovery timeout)                    */
+  signed   int                  rounds;          /* number of calls to SiLabs_Discovery_Process                                   */
+  signed   int                  transactions;
+  signed   int                  nacks;
+  signed   int                  timeouts;
+  SILABS_Discovery_Device       device[DISCOVERY_MAX_DEVICES];
+  signed   int                  nb_devices;
+  SILABS_Discovery_Front_End    front_end[DISCOVERY_MAX_FRONT_ENDS];
+  signed   int                  nb_front_ends;
+} SILABS_Discovery;
+
+extern SILABS_Discovery  Discovery_Context;
+
+signed   int        SiLabs_Discovery_Init              (SILABS_Discovery *discovery);
+signed   int        SiLabs_Discovery_Bus               (SILABS_Discovery *discovery, L0_Context *i2c);
+signed   int        SiLabs_Discovery_Addresses         (SILABS_Discovery *discovery, SILABS_Discovery_Kind kind, signed   int first, signed   int last);
+signed   int        SiLabs_Discovery_Start             (SILABS_Discovery *discovery);
+signed   int        SiLabs_Discovery_Process           (SILABS_Discovery *discovery);
+signed   int        SiLabs_Discovery_Run               (SILABS_Discovery *discovery);
+signed   int        SiLabs_Discovery_FE_Init           (SILABS_Discovery *discovery, signed   int index, SILABS_FE_Context *front_end);
+#ifdef    FRONTEND_REGISTRY
+signed   int        SiLabs_Discovery_Register          (SILABS_Discovery *discovery, struct _SILABS_FE_Registry *registry, signed   int board);
+#endif /* FRONTEND_REGISTRY */
+const    char      *SiLabs_Discovery_Kind_Text         (SILABS_Discovery_Kind kind);
+signed   int        SiLabs_Discovery_Text              (SILABS_Discovery *discovery, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int        SiLabs_Discovery_Test              (SILABS_Discovery *discovery, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Discovery_H_ */
@@ -0,0 +1,706 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Extended Status Functions                                     */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains layer-aware extended status snapshots for DVB-T, ISDB-T and DVB-T2           */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ Getting the full status of a hierarchical signal with the existing functions requires several calls:
+  - DVB-T:  SiLabs_API_Demod_status plus SiLabs_API_Get_DVBT_Hierarchy,
+  - ISDB-T: SiLabs_API_Demod_status plus SiLabs_API_TER_ISDBT_Layer_Info for each layer,
+  - DVB-T2: SiLabs_API_Demod_status plus one DVBT2_PLP_INFO per PLP to know the modulation of each PLP.
+ Each call re-sends commands returning information which only changes when the signalling changes.
+
+ The extended status returns all streams/layers/PLPs of the current signal in a SILABS_Extended_Status structure
+  with a fixed layout (one SILABS_Extended_Layer per DVB-T stream, ISDB-T layer or DVB-T2 PLP).
+
+ For each front-end, a plan is built once per lock configuration:
+  - the static L1/TMCC information is read once and kept in the plan:
+     DVB-T:  DVBT_STATUS + DVBT_TPS_EXTRA (cell id),
+     ISDB-T: ISDBT_STATUS + 1 ISDBT_LAYER_INFO per layer carrying segments,
+     DVB-T2: DVBT2_STATUS + DVBT2_TX_ID (cell id) + 1 DVBT2_PLP_INFO per PLP,
+  - the commands to send at each snapshot are selected (EXTENDED_STEP_xx):
+     DD_STATUS + standard status + DD_BER + DD_PER (+ DD_FER in DVB-T2) + DD_UNCOR.
+ The plan is invalidated by SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next, and built
+  again when the signalling fields returned by the standard status (hierarchy, ISDB-T segments, T2 L1 summary) change.
+  As the standard status is part of each snapshot, this check does not require additional i2c traffic.
+
+ The demodulator only measures BER/PER on one stream at a time (the selected DVB-T stream or DVB-T2 PLP, or the
+  ISDB-T layer selected by ISDBT_MODE layer_mon). The rates are stored in the corresponding layer, and 'age' tells
+  how many snapshots ago the rates of each layer were measured.
+ In ISDB-T, when layer_loop is set (default), the monitoring moves to the next layer each time a BER measurement is
+  complete (as in the 0xABC 'loop mode' of SiLabs_API_TER_ISDBT_Monitoring_mode), so that all layers are measured in turn.
+
+ Use case:
+    SiLabs_API_lock_to_carrier (front_end, SILABS_ISDB_T, 473143000, 6000000, 0, 0, 0, 0, 0, 0, 0, 0);
+    plan = SiLabs_Extended_Status_Of(front_end);
+    SiLabs_Extended_Status_Get (plan, &extended);
+    for (i=0; i<extended.nb_layers; i++) { ... extended.layer[i].nb_seg, extended.layer[i].ber_mant ... }
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[STATUS/extended] Initial version of the extended status snapshots
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   EXTENDED_STATUS
+  "If you get a compilation error on this line, it means that you included the Extended_Status code in your project without defining EXTENDED_STATUS.";
+  "Please define EXTENDED_STATUS at project-level, or remove the Extended_Status code from your project";
+#endif /* EXTENDED_STATUS */
+
+#ifdef    EXTENDED_STATUS
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Ext_Stat"
+#include "SiLabs_API_L3_Wrapper_Extended_Status.h"
+
+SILABS_Extended_Plan  Extended_Plan_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Of function
+  Use:      Extended status plan retrieval
+            Returns the extended status plan of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the extended status plan
+************************************************************************************************************************/
+SILABS_Extended_Plan *SiLabs_Extended_Status_Of        (SILABS_FE_Context *front_end) {
+  SILABS_Extended_Plan *plan;
+  plan = &(Extended_Plan_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { plan = ((SILABS_FE_Registry_Entry *)front_end)->extended_plan; }
+#endif /* FRONTEND_REGISTRY */
+  if (plan->front_end != front_end) { SiLabs_Extended_Status_Init(plan, front_end); }
+  return plan;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Init function
+  Use:      Extended status plan initialization
+  Parameter: plan, a pointer to the extended status plan
+  Parameter: front_end, a pointer to the SILABS_FE_Context using the plan
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Init             (SILABS_Extended_Plan *plan, SILABS_FE_Context *front_end) {
+  memset(plan, 0, sizeof(SILABS_Extended_Plan));
+  plan->front_end  = front_end;
+  plan->layer_loop = 1;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Config function
+  Use:      Extended status configuration
+  Parameter: plan, a pointer to the extended status plan
+  Parameter: layer_loop, 1 to monitor all ISDB-T layers in turn, 0 to keep the layer selected by the application
+  Returns:  layer_loop
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Config           (SILABS_Extended_Plan *plan, signed   int layer_loop) {
+  plan->layer_loop = layer_loop;
+  plan->valid      = 0; /* the plan steps depend on layer_loop */
+  return plan->layer_loop;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Invalidate function
+  Use:      Extended status plan invalidation
+            Called when the front-end moves to another signal. The plan will be built again at the next snapshot.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Invalidate       (SILABS_Extended_Plan *plan) {
+  plan->valid          = 0;
+  plan->last.nb_layers = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Signature function
+  Use:      Signalling summary
+            Computed from the last standard status response, without sending any command.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  the signalling summary
+************************************************************************************************************************/
+static unsigned long SiLabs_Extended_Status_Signature     (SILABS_Extended_Plan *plan) {
+  unsigned long signature;
+  signature = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(plan->front_end) ==   0x2183 ) {
+    switch (plan->modulation) {
+ #ifdef    DEMOD_DVB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT : {
+        signature = (unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.hierarchy
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.constellation << 4)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.rate_hp       << 10)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.rate_lp       << 14)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.fft_mode      << 18)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt_status.guard_int     << 22);
+        break;
+      }
+ #endif /* DEMOD_DVB_T */
+ #ifdef    DEMOD_ISDB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_ISDBT: {
+        signature = (unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_a
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_b      <<  4)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_c      <<  8)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.partial_flag  << 12)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.syst_id       << 13)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.fft_mode      << 16)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->isdbt_status.guard_int     << 20);
+        break;
+      }
+ #endif /* DEMOD_ISDB_T */
+ #ifdef    DEMOD_DVB_T2
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2: {
+        signature = (unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.num_plp
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.t2_version    <<  8)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.fft_mode      << 12)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.guard_int     << 16)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.pilot_pattern << 20)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.tx_mode       << 24)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.bw_ext        << 26)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.fef           << 27)
+                  + ((unsigned long)plan->front_end->Si2183_FE->demod->rsp->dvbt2_status.short_frame   << 28);
+        break;
+      }
+ #endif /* DEMOD_DVB_T2 */
+      default: { break; }
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  return signature;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Standard function
+  Use:      Standard status decoding
+            Copies the last standard status response in the snapshot, without sending any command.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  1
+************************************************************************************************************************/
+static signed   int SiLabs_Extended_Status_Standard       (SILABS_Extended_Plan *plan) {
+  SILABS_FE_Context      *front_end;
+  SILABS_Extended_Status *last;
+  signed   int            i;
+  front_end = plan->front_end;
+  last      = &(plan->last);
+  i         = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    switch (plan->modulation) {
+ #ifdef    DEMOD_DVB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT : {
+        last->c_n_100            = front_end->Si2183_FE->demod->rsp->dvbt_status.cnr*25;
+        last->freq_offset        = front_end->Si2183_FE->demod->rsp->dvbt_status.afc_freq;
+        last->timing_offset      = front_end->Si2183_FE->demod->rsp->dvbt_status.timing_offset;
+        last->spectral_inversion = front_end->Si2183_FE->demod->rsp->dvbt_status.sp_inv;
+        last->fft_mode           = Custom_fftCode      (front_end, front_end->Si2183_FE->demod->rsp->dvbt_status.fft_mode);
+        last->guard_interval     = Custom_giCode       (front_end, front_end->Si2183_FE->demod->rsp->dvbt_status.guard_int);
+        last->hierarchy          = Custom_hierarchyCode(front_end, front_end->Si2183_FE->demod->rsp->dvbt_status.hierarchy);
+        last->nb_layers          = (front_end->Si2183_FE->demod->rsp->dvbt_status.hierarchy == Si2183_DVBT_STATUS_RESPONSE_HIERARCHY_NONE) ? 1 : 2;
+        for (i=0; i<last->nb_layers; i++) {
+          last->layer[i].id            = (i == 0) ? SILABS_HP : SILABS_LP;
+          last->layer[i].fec_lock      = front_end->Si2183_FE->demod->rsp->dvbt_status.dl;
+          last->layer[i].constellation = Custom_constelCode (front_end, front_end->Si2183_FE->demod->rsp->dvbt_status.constellation);
+          last->layer[i].code_rate     = Custom_coderateCode(front_end, (i == 0) ? front_end->Si2183_FE->demod->rsp->dvbt_status.rate_hp : front_end->Si2183_FE->demod->rsp->dvbt_status.rate_lp);
+        }
+        break;
+      }
+ #endif /* DEMOD_DVB_T */
+ #ifdef    DEMOD_ISDB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_ISDBT: {
+        last->c_n_100            = front_end->Si2183_FE->demod->rsp->isdbt_status.cnr*25;
+        last->freq_offset        = front_end->Si2183_FE->demod->rsp->isdbt_status.afc_freq;
+        last->timing_offset      = front_end->Si2183_FE->demod->rsp->isdbt_status.timing_offset;
+        last->spectral_inversion = front_end->Si2183_FE->demod->rsp->isdbt_status.sp_inv;
+        last->fft_mode           = Custom_fftCode      (front_end, front_end->Si2183_FE->demod->rsp->isdbt_status.fft_mode);
+        last->guard_interval     = Custom_giCode       (front_end, front_end->Si2183_FE->demod->rsp->isdbt_status.guard_int);
+        last->system_id          = front_end->Si2183_FE->demod->rsp->isdbt_status.syst_id;
+        last->partial_flag       = front_end->Si2183_FE->demod->rsp->isdbt_status.partial_flag;
+        last->emergency_flag     = front_end->Si2183_FE->demod->rsp->isdbt_status.emergency_flag;
+        last->monitored_layer    = front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon ? 0x9 + front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon : 0;
+        for (i=0; i<last->nb_layers; i++) {
+          switch (last->layer[i].id) {
+            case 0xA: { last->layer[i].fec_lock = front_end->Si2183_FE->demod->rsp->isdbt_status.dl_a; break; }
+            case 0xB: { last->layer[i].fec_lock = front_end->Si2183_FE->demod->rsp->isdbt_status.dl_b; break; }
+            default : { last->layer[i].fec_lock = front_end->Si2183_FE->demod->rsp->isdbt_status.dl_c; break; }
+          }
+        }
+        break;
+      }
+ #endif /* DEMOD_ISDB_T */
+ #ifdef    DEMOD_DVB_T2
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2: {
+        last->c_n_100            = front_end->Si2183_FE->demod->rsp->dvbt2_status.cnr*25;
+        last->freq_offset        = front_end->Si2183_FE->demod->rsp->dvbt2_status.afc_freq;
+        last->timing_offset      = front_end->Si2183_FE->demod->rsp->dvbt2_status.timing_offset;
+        last->spectral_inversion = front_end->Si2183_FE->demod->rsp->dvbt2_status.sp_inv;
+        last->fft_mode           = Custom_fftCode         (front_end, front_end->Si2183_FE->demod->rsp->dvbt2_status.fft_mode);
+        last->guard_interval     = Custom_giCode          (front_end, front_end->Si2183_FE->demod->rsp->dvbt2_status.guard_int);
+        last->num_plp            = front_end->Si2183_FE->demod->rsp->dvbt2_status.num_plp;
+        last->plp_id             = front_end->Si2183_FE->demod->rsp->dvbt2_status.plp_id;
+        last->t2_version         = Custom_T2VersionCode   (front_end, front_end->Si2183_FE->demod->rsp->dvbt2_status.t2_version);
+        last->t2_base_lite       = front_end->Si2183_FE->demod->rsp->dvbt2_status.t2_mode;
+        last->pilot_pattern      = Custom_pilotPatternCode(front_end, front_end->Si2183_FE->demod->rsp->dvbt2_status.pilot_pattern);
+        last->fef                = front_end->Si2183_FE->demod->rsp->dvbt2_status.fef;
+        for (i=0; i<last->nb_layers; i++) {
+          last->layer[i].fec_lock = (last->layer[i].id == last->plp_id) ? front_end->Si2183_FE->demod->rsp->dvbt2_status.dl : 0;
+        }
+        break;
+      }
+ #endif /* DEMOD_DVB_T2 */
+      default: { break; }
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  front_end = front_end; /* To avoid compiler warning if not used */
+  i         = i;         /* To avoid compiler warning if not used */
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Decoded function
+  Use:      Measured layer retrieval
+            Returns the index of the layer on which the demodulator measures BER/PER:
+             the selected DVB-T stream, the ISDB-T layer selected by layer_mon, the DVB-T2 PLP currently decoded.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  the layer index, -1 if the rates do not apply to a single layer
+************************************************************************************************************************/
+static signed   int SiLabs_Extended_Status_Decoded        (SILABS_Extended_Plan *plan) {
+  SILABS_Extended_Status *last;
+  signed   int            id;
+  signed   int            i;
+  last = &(plan->last);
+  id   = -1;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(plan->front_end) ==   0x2183 ) {
+    switch (plan->modulation) {
+ #ifdef    DEMOD_DVB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT : {
+        id = SILABS_HP;
+        if (last->nb_layers > 1) { id = Custom_streamCode(plan->front_end, plan->front_end->Si2183_FE->demod->prop->dvbt_hierarchy.stream); }
+        break;
+      }
+ #endif /* DEMOD_DVB_T */
+ #ifdef    DEMOD_ISDB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_ISDBT: { id = last->monitored_layer; break; }
+ #endif /* DEMOD_ISDB_T */
+ #ifdef    DEMOD_DVB_T2
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2: { id = last->plp_id;          break; }
+ #endif /* DEMOD_DVB_T2 */
+      default: { return (last->nb_layers == 1) ? 0 : -1; }
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  for (i=0; i<last->nb_layers; i++) {
+    if (last->layer[i].id == id) { return i; }
+  }
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Build function
+  Use:      Extended status plan building
+            Reads the static L1/TMCC information of the current signal and selects the commands of each snapshot.
+            DVB-T : 1 DVBT_STATUS  + 1 DVBT_TPS_EXTRA
+            ISDB-T: 1 ISDBT_STATUS + 1 ISDBT_LAYER_INFO per layer carrying segments
+            DVB-T2: 1 DVBT2_STATUS + 1 DVBT2_TX_ID + 1 DVBT2_PLP_INFO per PLP (up to EXTENDED_STATUS_MAX_LAYERS)
+            The DD_STATUS response must be up to date.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  the number of layers, -1 in case of an error
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Build            (SILABS_Extended_Plan *plan) {
+  SILABS_FE_Context      *front_end;
+  SILABS_Extended_Status *last;
+  SILABS_Extended_Layer  *layer;
+  signed   int            start_ms;
+  signed   int            commands;
+  signed   int            i;
+#ifdef    DEMOD_ISDB_T
+  signed   int            nb_seg[3];
+#endif /* DEMOD_ISDB_T */
+#ifdef    DEMOD_DVB_T2
+  signed   int            cod_code[8] = {1, 13, 2, 3, 4, 5, 10, 12}; /* PLP_COD to DVBT2_STATUS code_rate */
+  signed   int            mod_code[4] = {3,  7, 9, 11};              /* PLP_MOD to DVBT2_STATUS constellation */
+#endif /* DEMOD_DVB_T2 */
+  front_end = plan->front_end;
+  last      = &(plan->last);
+  SiLabs_Extended_Status_Invalidate(plan);
+  memset(last->layer, 0, sizeof(last->layer));
+  start_ms  = system_time();
+  commands  = 0;
+  layer     = NULL;
+  i         = 0;
+  last->cell_id   = 0;
+  last->hierarchy = 0;
+  last->num_plp   = 0;
+  plan->steps     = EXTENDED_STEP_DD_STATUS + EXTENDED_STEP_BER + EXTENDED_STEP_PER + EXTENDED_STEP_UNCOR;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    plan->modulation = front_end->Si2183_FE->demod->rsp->dd_status.modulation;
+    switch (plan->modulation) {
+ #ifdef    DEMOD_DVB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT : {
+        if (Si2183_L1_DVBT_STATUS   (front_end->Si2183_FE->demod, Si2183_DVBT_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DVBT_STATUS error when building the extended status plan!\n"); return -1; }
+        commands++;
+        if (Si2183_L1_DVBT_TPS_EXTRA(front_end->Si2183_FE->demod)                                   != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DVBT_TPS_EXTRA error when building the extended status plan!\n"); return -1; }
+        commands++;
+        last->cell_id = front_end->Si2183_FE->demod->rsp->dvbt_tps_extra.cell_id;
+        plan->steps   = plan->steps + EXTENDED_STEP_STANDARD;
+        break;
+      }
+ #endif /* DEMOD_DVB_T */
+ #ifdef    DEMOD_ISDB_T
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_ISDBT: {
+        if (Si2183_L1_ISDBT_STATUS  (front_end->Si2183_FE->demod, Si2183_ISDBT_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_ISDBT_STATUS error when building the extended status plan!\n"); return -1; }
+        commands++;
+        nb_seg[0] = front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_a;
+        nb_seg[1] = front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_b;
+        nb_seg[2] = front_end->Si2183_FE->demod->rsp->isdbt_status.nb_seg_c;
+        for (i=0; i<3; i++) {
+          if (nb_seg[i] == 0) { continue; }
+          if (Si2183_L1_ISDBT_LAYER_INFO(front_end->Si2183_FE->demod, (unsigned char)i) != NO_Si2183_ERROR) {
+            SiTRACE("Si2183_L1_ISDBT_LAYER_INFO error when checking layer %c!\n", 'A' + i);
+            SiERROR("Si2183_L1_ISDBT_LAYER_INFO error when building the extended status plan!\n");
+            return -1;
+          }
+          commands++;
+          layer = &(last->layer[last->nb_layers]);
+          layer->id            = 0xA + i;
+          layer->constellation = Custom_constelCode (front_end, front_end->Si2183_FE->demod->rsp->isdbt_layer_info.constellation);
+          layer->code_rate     = Custom_coderateCode(front_end, front_end->Si2183_FE->demod->rsp->isdbt_layer_info.code_rate);
+          layer->il            = front_end->Si2183_FE->demod->rsp->isdbt_layer_info.il;
+          layer->nb_seg        = nb_seg[i];
+          last->nb_layers++;
+        }
+        plan->steps = plan->steps + EXTENDED_STEP_STANDARD;
+        if ( (plan->layer_loop) && (last->nb_layers > 1) ) { plan->steps = plan->steps + EXTENDED_STEP_LAYER_LOOP; }
+        break;
+      }
+ #endif /* DEMOD_ISDB_T */
+ #ifdef    DEMOD_DVB_T2
+      case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2: {
+        if (Si2183_L1_DVBT2_STATUS  (front_end->Si2183_FE->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DVBT2_STATUS error when building the extended status plan!\n"); return -1; }
+        commands++;
+        if (Si2183_L1_DVBT2_TX_ID   (front_end->Si2183_FE->demod)                                    != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DVBT2_TX_ID error when building the extended status plan!\n"); return -1; }
+        commands++;
+        last->cell_id = front_end->Si2183_FE->demod->rsp->dvbt2_tx_id.cell_id;
+        for (i=0; (i<front_end->Si2183_FE->demod->rsp->dvbt2_status.num_plp) && (i<EXTENDED_STATUS_MAX_LAYERS); i++) {
+          if (Si2183_L1_DVBT2_PLP_INFO(front_end->Si2183_FE->demod, (unsigned char)i) != NO_Si2183_ERROR) {
+            SiTRACE("Si2183_L1_DVBT2_PLP_INFO error when checking PLP index %d!\n", i);
+            SiERROR("Si2183_L1_DVBT2_PLP_INFO error when building the extended status plan!\n");
+            return -1;
+          }
+          commands++;
+          layer = &(last->layer[i]);
+          layer->id            = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_id;
+          layer->constellation = Custom_constelCode (front_end, mod_code[((front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_mod_msb << 2) + front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_mod_lsb) & 0x03]);
+          layer->code_rate     = Custom_coderateCode(front_end, cod_code[front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_cod & 0x07]);
+          layer->il            =(front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.time_il_length_msb << 7) + front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.time_il_length_lsb;
+          layer->plp_type      = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_type;
+          layer->fec_type      = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_fec_type;
+          layer->rotated       = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_rot;
+          layer->group_id      =(front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_group_id_msb << 4) + front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_group_id_lsb;
+        }
+        last->nb_layers = i;
+        plan->steps = plan->steps + EXTENDED_STEP_STANDARD + EXTENDED_STEP_FER;
+        break;
+      }
+ #endif /* DEMOD_DVB_T2 */
+      default: { /* single stream standards: only the rates are measured */
+        last->nb_layers = 1;
+        break;
+      }
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  for (i=0; i<last->nb_layers; i++) {
+    last->layer[i].ber_mant = -1;
+    last->layer[i].per_mant = -1;
+    last->layer[i].fer_mant = -1;
+    last->layer[i].age      = -1;
+  }
+  SiLabs_Extended_Status_Standard(plan);
+  layer = layer; /* To avoid compiler warning if not used */
+  plan->signature      = SiLabs_Extended_Status_Signature(plan);
+  plan->build_commands = commands;
+  plan->build_ms       = system_time() - start_ms;
+  plan->valid          = 1;
+  plan->builds++;
+  SiTRACE("Extended status plan built in %d ms with %d commands: %d layers, steps 0x%02x\n", plan->build_ms, commands, last->nb_layers, plan->steps);
+  return last->nb_layers;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Loop function
+  Use:      ISDB-T layer loop
+            Moves the BER/PER monitoring to the next layer carrying segments, and adapts the BER depth to its constellation.
+            The BER depth is only set if it changes.
+  Parameter: plan, a pointer to the extended status plan
+  Returns:  the number of commands sent
+************************************************************************************************************************/
+static signed   int SiLabs_Extended_Status_Loop           (SILABS_Extended_Plan *plan) {
+  signed   int commands;
+  commands = 0;
+  plan     = plan; /* To avoid compiler warning if not used */
+#ifdef    DEMOD_ISDB_T
+ #ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(plan->front_end) ==   0x2183 ) {
+    SILABS_Extended_Status *last;
+    signed   int            current;
+    signed   int            next;
+    signed   int            exp;
+    last    = &(plan->last);
+    current = SiLabs_Extended_Status_Decoded(plan);
+    next    = (current + 1) % last->nb_layers;
+    plan->front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon = (unsigned char)(last->layer[next].id - 0x9);
+    if (Si2183_L1_SetProperty2(plan->front_end->Si2183_FE->demod, Si2183_ISDBT_MODE_PROP_CODE) == NO_Si2183_ERROR) { commands++; }
+    plan->front_end->TER_ISDBT_Monitoring_layer = plan->front_end->Si2183_FE->demod->prop->isdbt_mode.layer_mon;
+    exp = ( (last->layer[next].constellation == SILABS_QPSK) || (last->layer[next].constellation == SILABS_DQPSK) ) ? 5 : 6;
+    if ( (plan->front_end->Si2183_FE->demod->prop->dd_ber_resol.exp != exp) || (plan->front_end->Si2183_FE->demod->prop->dd_ber_resol.mant != 1) ) {
+      plan->front_end->Si2183_FE->demod->prop->dd_ber_resol.exp  = (unsigned char)exp;
+      plan->front_end->Si2183_FE->demod->prop->dd_ber_resol.mant = 1;
+      if (Si2183_L1_SetProperty2(plan->front_end->Si2183_FE->demod, Si2183_DD_BER_RESOL_PROP_CODE) == NO_Si2183_ERROR) { commands++; }
+    }
+    last->monitored_layer = last->layer[next].id;
+    SiTRACE("Extended status: monitoring layer '%c', BER depth 10e-%d\n", 'A' + last->layer[next].id - 0xA, exp);
+  }
+ #endif /* Si2183_COMPATIBLE */
+#endif /* DEMOD_ISDB_T */
+  return commands;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Get function
+  Use:      Extended status snapshot
+            Sends the commands selected by the plan, building the plan first if required (new lock, signalling change).
+            When not locked, only DD_STATUS is sent.
+  Parameter: plan, a pointer to the extended status plan
+  Parameter: status, a pointer to the SILABS_Extended_Status to fill (can be NULL to only update plan->last)
+  Returns:  the number of layers, -1 in case of an error
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Get              (SILABS_Extended_Plan *plan, SILABS_Extended_Status *status) {
+  SILABS_FE_Context      *front_end;
+  SILABS_Extended_Status *last;
+  SILABS_Extended_Layer  *layer;
+  signed   int            commands;
+  signed   int            standard_read;
+  signed   int            decoded;
+  signed   int            measured;
+  signed   int            i;
+  front_end     = plan->front_end;
+  last          = &(plan->last);
+  commands      = 0;
+  standard_read = 0;
+  decoded       = -1;
+  measured      = 0;
+  layer         = NULL;
+  i             = 0;
+  if (front_end->standard == SILABS_SLEEP) { last->standard = SILABS_SLEEP; last->demod_lock = last->fec_lock = 0; }
+#ifdef    Si2183_COMPATIBLE
+  if ( (front_end->standard != SILABS_SLEEP) && (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) ) {
+    if (Si2183_L1_DD_STATUS(front_end->Si2183_FE->demod, Si2183_DD_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) {
+      SiERROR("Si2183_L1_DD_STATUS error during extended status snapshot!\n");
+      return -1;
+    }
+    commands++;
+    last->standard       = Custom_standardCode(front_end, front_end->Si2183_FE->demod->rsp->dd_status.modulation);
+    last->demod_lock     = front_end->Si2183_FE->demod->rsp->dd_status.pcl;
+    last->fec_lock       = front_end->Si2183_FE->demod->rsp->dd_status.dl;
+    last->TS_bitrate_kHz = front_end->Si2183_FE->demod->rsp->dd_status.ts_bit_rate*10;
+    if (last->fec_lock) {
+      /* Check the plan, reading the standard status */
+      if ( (plan->valid) && (plan->modulation == front_end->Si2183_FE->demod->rsp->dd_status.modulation) && (plan->steps & EXTENDED_STEP_STANDARD) ) {
+        switch (plan->modulation) {
+ #ifdef    DEMOD_DVB_T
+          case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT : { standard_read = (Si2183_L1_DVBT_STATUS (front_end->Si2183_FE->demod, Si2183_DVBT_STATUS_CMD_INTACK_OK ) == NO_Si2183_ERROR); break; }
+ #endif /* DEMOD_DVB_T */
+ #ifdef    DEMOD_ISDB_T
+          case Si2183_DD_STATUS_RESPONSE_MODULATION_ISDBT: { standard_read = (Si2183_L1_ISDBT_STATUS(front_end->Si2183_FE->demod, Si2183_ISDBT_STATUS_CMD_INTACK_OK) == NO_Si2183_ERROR); break; }
+ #endif /* DEMOD_ISDB_T */
+ #ifdef    DEMOD_DVB_T2
+          case Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2: { standard_read = (Si2183_L1_DVBT2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK) == NO_Si2183_ERROR); break; }
+ #endif /* DEMOD_DVB_T2 */
+          default: { break; }
+        }
+        if (!standard_read) { SiERROR("standard status error during extended status snapshot!\n"); return -1; }
+        commands++;
+        if (SiLabs_Extended_Status_Signature(plan) != plan->signature) {
+          SiTRACE("Extended status: signalling change detected\n");
+          plan->valid = 0;
+        }
+      }
+      if ( (!plan->valid) || (plan->modulation != front_end->Si2183_FE->demod->rsp->dd_status.modulation) ) {
+        if (SiLabs_Extended_Status_Build(plan) < 0) { return -1; }
+        commands = commands + plan->build_commands;
+      } else {
+        SiLabs_Extended_Status_Standard(plan);
+      }
+      /* Measure the rates on the decoded layer */
+      for (i=0; i<last->nb_layers; i++) {
+        last->layer[i].decoded = 0;
+        if (last->layer[i].age >= 0) { last->layer[i].age++; }
+      }
+      decoded = SiLabs_Extended_Status_Decoded(plan);
+      layer   = (decoded >= 0) ? &(last->layer[decoded]) : NULL;
+      if (layer != NULL) { layer->decoded = 1; }
+      if (plan->steps & EXTENDED_STEP_BER  ) {
+        if (Si2183_L1_DD_BER  (front_end->Si2183_FE->demod, Si2183_DD_BER_CMD_RST_RUN  ) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DD_BER error during extended status snapshot!\n"); return -1; }
+        commands++;
+        if ( (layer != NULL) && (front_end->Si2183_FE->demod->rsp->dd_ber.exp != 0) ) {
+          layer->ber_mant = front_end->Si2183_FE->demod->rsp->dd_ber.mant;
+          layer->ber_exp  = front_end->Si2183_FE->demod->rsp->dd_ber.exp + 1;
+          layer->age      = 0;
+          measured        = 1;
+        }
+      }
+      if (plan->steps & EXTENDED_STEP_PER  ) {
+        if (Si2183_L1_DD_PER  (front_end->Si2183_FE->demod, Si2183_DD_PER_CMD_RST_RUN  ) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DD_PER error during extended status snapshot!\n"); return -1; }
+        commands++;
+        if ( (layer != NULL) && (front_end->Si2183_FE->demod->rsp->dd_per.exp != 0) ) {
+          layer->per_mant = front_end->Si2183_FE->demod->rsp->dd_per.mant;
+          layer->per_exp  = front_end->Si2183_FE->demod->rsp->dd_per.exp + 1;
+        }
+      }
+      if (plan->steps & EXTENDED_STEP_FER  ) {
+        if (Si2183_L1_DD_FER  (front_end->Si2183_FE->demod, Si2183_DD_FER_CMD_RST_RUN  ) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DD_FER error during extended status snapshot!\n"); return -1; }
+        commands++;
+        if ( (layer != NULL) && (front_end->Si2183_FE->demod->rsp->dd_fer.exp != 0) ) {
+          layer->fer_mant = front_end->Si2183_FE->demod->rsp->dd_fer.mant;
+          layer->fer_exp  = front_end->Si2183_FE->demod->rsp->dd_fer.exp + 1;
+        }
+      }
+      if (plan->steps & EXTENDED_STEP_UNCOR) {
+        if (Si2183_L1_DD_UNCOR(front_end->Si2183_FE->demod, Si2183_DD_UNCOR_CMD_RST_RUN) != NO_Si2183_ERROR) { SiERROR("Si2183_L1_DD_UNCOR error during extended status snapshot!\n"); return -1; }
+        commands++;
+        if (layer != NULL) {
+          layer->uncorrs = (front_end->Si2183_FE->demod->rsp->dd_uncor.uncor_msb<<8) + front_end->Si2183_FE->demod->rsp->dd_uncor.uncor_lsb;
+        }
+      }
+      /* ISDB-T: once the BER of the current layer is available, move to the next layer */
+      if ( (plan->steps & EXTENDED_STEP_LAYER_LOOP) && (measured || (layer == NULL)) ) {
+        commands = commands + SiLabs_Extended_Status_Loop(plan);
+      }
+    } else {
+      for (i=0; i<last->nb_layers; i++) {
+        last->layer[i].fec_lock = 0;
+        last->layer[i].decoded  = 0;
+      }
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  layer    = layer;    /* To avoid compiler warning if not used */
+  decoded  = decoded;  /* To avoid compiler warning if not used */
+  measured = measured; /* To avoid compiler warning if not used */
+  last->commands = commands;
+  last->snapshot = ++plan->snapshots;
+  plan->commands = plan->commands + commands;
+  if ( (status != NULL) && (status != last) ) { memcpy(status, last, sizeof(SILABS_Extended_Status)); }
+  return last->nb_layers;
+}
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Text function
+  Use:      Extended status display
+  Parameter: status, a pointer to the extended status snapshot
+  Parameter: text, the text buffer
+  Parameter: size, the text buffer size
+  Returns:  the number of layers
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Text             (SILABS_Extended_Status *status, char *text, signed   int size) {
+  SILABS_Extended_Layer *layer;
+  signed   int           len;
+  signed   int           i;
+  len = snprintf(text, size, "%s %s%s, C/N %d.%02d dB, TS %d kbps, cell_id %d, %d layers (snapshot %lu, %d commands)\n"
+    , Silabs_Standard_Text(status->standard), status->demod_lock ? "demod_lock " : "", status->fec_lock ? "fec_lock" : "unlocked"
+    , status->c_n_100/100, status->c_n_100%100, status->TS_bitrate_kHz, status->cell_id, status->nb_layers, status->snapshot, status->commands);
+  if (status->standard == SILABS_ISDB_T) {
+    len += snprintf(text + len, size - len, " system_id %d, partial %d, emergency %d, monitoring '%c'\n"
+      , status->system_id, status->partial_flag, status->emergency_flag, status->monitored_layer ? 'A' + status->monitored_layer - 0xA : '*');
+  }
+  if (status->standard == SILABS_DVB_T2) {
+    len += snprintf(text + len, size - len, " num_plp %d, plp_id %d, t2_version %d, base_lite %d, pilot_pattern %d, fef %d\n"
+      , status->num_plp, status->plp_id, status->t2_version, status->t2_base_lite, status->pilot_pattern, status->fef);
+  }
+  for (i=0; (i<status->nb_layers) && (len < size); i++) {
+    layer = &(status->layer[i]);
+    len += snprintf(text + len, size - len, " %c %3d: lock %d %-8s %-5s seg %2d il %3d type %d BER %dE-%d PER %dE-%d uncor %d age %d\n"
+      , layer->decoded ? '>' : ' ', layer->id, layer->fec_lock
+      , Silabs_Constel_Text((CUSTOM_Constel_Enum)layer->constellation), Silabs_Coderate_Text((CUSTOM_Coderate_Enum)layer->code_rate)
+      , layer->nb_seg, layer->il, layer->plp_type
+      , layer->ber_mant, layer->ber_exp, layer->per_mant, layer->per_exp, layer->uncorrs, layer->age);
+  }
+  return status->nb_layers;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Extended_Status_Test function
+  Use:      Generic test pipe function
+            Used to send a generic command to the extended status.
+  Returns:  0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Extended_Status_Test             (SILABS_Extended_Plan *plan, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible extended status test commands:\n\
+get                               : take a snapshot and display all layers/PLPs\n\
+last                              : display the last snapshot\n\
+plan                              : display the current plan\n\
+layer_loop         <0/1>          : monitor all ISDB-T layers in turn\n\
+invalidate                        : build the plan again at the next snapshot\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "get"                ) == 0) {
+    *retdval = SiLabs_Extended_Status_Get(plan, NULL);
+    SiLabs_Extended_Status_Text(&(plan->last), *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "last"               ) == 0) {
+    *retdval = SiLabs_Extended_Status_Text(&(plan->last), *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "plan"               ) == 0) {
+    *retdval = plan->valid;
+    snprintf(*rettxt, 1000, "%s plan %s: steps 0x%02x, %d layers, built in %d ms with %d commands, layer_loop %d\n %lu builds, %lu snapshots, %lu commands\n"
+      , plan->front_end->tag, plan->valid ? "valid" : "invalid", plan->steps, plan->last.nb_layers, plan->build_ms, plan->build_commands, plan->layer_loop
+      , plan->builds, plan->snapshots, plan->commands);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "layer_loop"         ) == 0) {
+    *retdval = SiLabs_Extended_Status_Config(plan, (signed int)dval);
+    snprintf(*rettxt, 1000, "ISDB-T layer loop %s\n", plan->layer_loop ? "enabled" : "disabled");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "invalidate"         ) == 0) {
+    *retdval = SiLabs_Extended_Status_Invalidate(plan);
+    snprintf(*rettxt, 1000, "extended status plan invalidated\n");
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* EXTENDED_STATUS */
@@ -0,0 +1,129 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Extended_Status_H_
+#define  _SiLabs_API_L3_Wrapper_Extended_Status_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[STATUS/extended] Adding layer-aware extended status snapshots via SiLabs_API_L3_Wrapper_Extended_Status.c/.h
+        The DVB-T streams, ISDB-T layers or DVB-T2 PLPs are returned in a fixed-layout structure, using a command plan built once per lock.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EXTENDED_STATUS_MAX_LAYERS     16  /* Layers stored per snapshot: 2 DVB-T streams, 3 ISDB-T layers, up to 16 DVB-T2 PLPs */
+
+/* possible values for the extended status plan steps (commands sent at each snapshot) */
+#define EXTENDED_STEP_DD_STATUS    0x0001  /* DD_STATUS (lock, standard, TS bitrate)                                          */
+#define EXTENDED_STEP_STANDARD     0x0002  /* DVBT_STATUS, ISDBT_STATUS or DVBT2_STATUS                                       */
+#define EXTENDED_STEP_BER          0x0004  /* DD_BER                                                                          */
+#define EXTENDED_STEP_PER          0x0008  /* DD_PER                                                                          */
+#define EXTENDED_STEP_FER          0x0010  /* DD_FER (DVB-T2 only)                                                            */
+#define EXTENDED_STEP_UNCOR        0x0020  /* DD_UNCOR                                                                        */
+#define EXTENDED_STEP_LAYER_LOOP   0x0040  /* ISDB-T: BER/PER monitoring moved to the next layer once its BER is available    */
+
+/* Structure used to store one DVB-T stream, ISDB-T layer or DVB-T2 PLP */
+typedef struct _SILABS_Extended_Layer             {
+  signed   int                  id;              /* DVB-T: SILABS_HP/SILABS_LP, ISDB-T: 0xA/0xB/0xC, DVB-T2: plp_id       */
+  signed   int                  decoded;         /* 1 for the layer measured by the demodulator during this snapshot      */
+  signed   int                  fec_lock;
+  signed   int                  constellation;   /* SILABS_xx constellation code                                          */
+  signed   int                  code_rate;       /* SILABS_CODERATE_xx code                                               */
+  signed   int                  nb_seg;          /* ISDB-T only                                                           */
+  signed   int                  il;              /* ISDB-T: time interleaving code, DVB-T2: time interleaving length      */
+  signed   int                  plp_type;        /* DVB-T2 only, Si2183 plp_type code                                     */
+  signed   int                  fec_type;        /* DVB-T2 only, 0 for 16K LDPC, 1 for 64K LDPC                           */
+  signed   int                  rotated;         /* DVB-T2 only                                                           */
+  signed   int                  group_id;        /* DVB-T2 only                                                           */
+  signed   int                  ber_mant;        /* '-1' when not measured yet                                            */
+  signed   int                  ber_exp;
+  signed   int                  per_mant;        /* '-1' when not measured yet                                            */
+  signed   int                  per_exp;
+  signed   int                  fer_mant;        /* DVB-T2 only, '-1' when not measured yet                               */
+  signed   int                  fer_exp;
+  signed   int                  uncorrs;
+  signed   int                  age;             /* snapshots since the rates were measured on this layer, -1 if never    */
+} SILABS_Extended_Layer;
+
+/* Structure used to store one extended status snapshot */
+typedef struct _SILABS_Extended_Status            {
+  signed   int                  standard;
+  signed   int                  demod_lock;
+  signed   int                  fec_lock;
+  signed   int                  c_n_100;
+  signed   int                  freq_offset;
+  signed   int                  timing_offset;
+  signed   int                  spectral_inversion;
+  signed   int                  fft_mode;
+  signed   int                  guard_interval;
+  signed   int                  TS_bitrate_kHz;
+  signed   int                  cell_id;         /* DVB-T (TPS) and DVB-T2 (TX_ID), read when the plan is built           */
+  signed   int                  hierarchy;       /* DVB-T only                                                            */
+  signed   int                  system_id;       /* ISDB-T TMCC                                                           */
+  signed   int                  partial_flag;    /* ISDB-T TMCC                                                           */
+  signed   int                  emergency_flag;  /* ISDB-T TMCC                                                           */
+  signed   int                  monitored_layer; /* ISDB-T: 0xA/0xB/0xC, 0 when all layers are monitored together         */
+  signed   int                  num_plp;         /* DVB-T2 L1                                                             */
+  signed   int                  plp_id;          /* DVB-T2: PLP currently decoded                                         */
+  signed   int                  t2_version;      /* DVB-T2 L1                                                             */
+  signed   int                  t2_base_lite;    /* DVB-T2 L1                                                             */
+  signed   int                  pilot_pattern;   /* DVB-T2 L1                                                             */
+  signed   int                  fef;             /* DVB-T2 L1                                                             */
+  signed   int                  nb_layers;
+  SILABS_Extended_Layer         layer[EXTENDED_STATUS_MAX_LAYERS];
+  signed   int                  commands;        /* demodulator commands sent for this snapshot                           */
+  unsigned long                 snapshot;
+} SILABS_Extended_Status;
+
+/* Structure used to store the extended status plan of one front-end */
+typedef struct _SILABS_Extended_Plan              {
+  SILABS_FE_Context            *front_end;
+  signed   int                  valid;
+  signed   int                  modulation;      /* dd_status.modulation when the plan was built                        */
+  unsigned long                 signature;       /* signalling fields summary, used to detect lock configuration changes */
+  signed   int                  steps;           /* EXTENDED_STEP_xx commands sent at each snapshot                     */
+  signed   int                  layer_loop;      /* ISDB-T: 1 to monitor all layers in turn (default)                   */
+  signed   int                  build_commands;  /* commands used to build the plan                                     */
+  signed   int                  build_ms;        /* duration of the last plan build                                     */
+  SILABS_Extended_Status        last;            /* last snapshot, also storing the L1/TMCC information of the plan     */
+  unsigned long                 builds;
+  unsigned long                 snapshots;
+  unsigned long                 commands;
+} SILABS_Extended_Plan;
+
+extern SILABS_Extended_Plan  Extended_Plan_Table[FRONT_END_COUNT];
+
+SILABS_Extended_Plan *SiLabs_Extended_Status_Of        (SILABS_FE_Context *front_end);
+signed   int   SiLabs_Extended_Status_Init             (SILABS_Extended_Plan *plan, SILABS_FE_Context *front_end);
+signed   int   SiLabs_Extended_Status_Config           (SILABS_Extended_Plan *plan, signed   int layer_loop);
+signed   int   SiLabs_Extended_Status_Invalidate       (SILABS_Extended_Plan *plan);
+signed   int   SiLabs_Extended_Status_Build            (SILABS_Extended_Plan *plan);
+signed   int   SiLabs_Extended_Status_Get              (SILABS_Extended_Plan *plan, SILABS_Extended_Status *status);
+signed   int   SiLabs_Extended_Status_Text             (SILABS_Extended_Status *status, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Extended_Status_Test             (SILABS_Extended_Plan *plan, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Extended_Status_H_ */
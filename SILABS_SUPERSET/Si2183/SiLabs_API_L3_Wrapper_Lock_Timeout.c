@@ -0,0 +1,498 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Adaptive Lock Timeout Functions                               */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code learns the lock times of the demodulators to shorten the lock timeouts                 */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ The Si2183 L2 lock timeouts (Si2183_DVBT2_MAX_LOCK_TIME, Si2183_DVBS2_MAX_LOCK_TIME*2, Si2183_DVB_C_max_lock_ms, ...)
+  are sized for the worst case. Lock attempts on frequencies without any signal (or without a signal the
+  demodulator can decide on) therefore always last the full worst case duration.
+
+ With ADAPTIVE_LOCK_TIMEOUT, the duration of each successful lock (SiLabs_API_lock_to_carrier, and
+  SiLabs_API_Channel_Seek_Next in 'not blind' mode) is stored in a histogram per standard, symbol rate class
+  and constellation. Once 'min_samples' locks are known for a combination, the lock timeout becomes:
+    lock time percentile ('permille', 999 = p99.9) + 'margin_pct' % + 'margin_ms'
+  if this is lower than the default timeout. The lowest observed lock time is also used as min_lock_time_ms
+  when lower than the default value.
+
+ Every 'verify' learned timeouts, the L2 goes on waiting up to the default timeout. A lock obtained after the
+  learned timeout is counted as a 'miss'. misses/verified is an estimate of the proportion of learned timeouts
+  which lost a channel, displayed by SiLabs_Lock_Timeout_Text ('verify' = 1 to always fall back to the
+  default timeout, 0 to never fall back).
+
+ The statistics are shared by all front-ends, and can be saved to/loaded from a file to be kept across runs.
+
+ Use case:
+    SiLabs_Lock_Timeout_Load   ("lock_times.bin");                           (statistics from the previous runs)
+    SiLabs_Lock_Timeout_Config (1, 999, 25, 50, 20, 10);
+    SiLabs_API_lock_to_carrier (front_end, SILABS_DVB_S2, ...);              (learned timeout if known)
+    ...
+    SiLabs_Lock_Timeout_Save   ("lock_times.bin");
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[lock/adaptive_timeout] Initial version of the adaptive lock timeouts
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   ADAPTIVE_LOCK_TIMEOUT
+  "If you get a compilation error on this line, it means that you included the Lock_Timeout code in your project without defining ADAPTIVE_LOCK_TIMEOUT.";
+  "Please define ADAPTIVE_LOCK_TIMEOUT at project-level, or remove the Lock_Timeout code from your project";
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "LockTime  "
+#include "SiLabs_API_L3_Wrapper_Lock_Timeout.h"
+
+SILABS_Lock_Time_Learning  Lock_Time_Learning;
+SILABS_Lock_Timeout        Lock_Timeout_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Learning function
+  Use:      Lock time learning retrieval
+            Returns the lock time learning structure, setting the default configuration on first use.
+  Returns:  a pointer to Lock_Time_Learning
+************************************************************************************************************************/
+SILABS_Lock_Time_Learning *SiLabs_Lock_Timeout_Learning (void) {
+  if (Lock_Time_Learning.magic != LOCK_TIMEOUT_FILE_MAGIC) {
+    memset(&Lock_Time_Learning, 0, sizeof(SILABS_Lock_Time_Learning));
+    Lock_Time_Learning.magic       = LOCK_TIMEOUT_FILE_MAGIC;
+    Lock_Time_Learning.size        = sizeof(SILABS_Lock_Time_Learning);
+    Lock_Time_Learning.enabled     = 1;
+    Lock_Time_Learning.permille    = LOCK_TIMEOUT_PERMILLE;
+    Lock_Time_Learning.margin_pct  = LOCK_TIMEOUT_MARGIN_PCT;
+    Lock_Time_Learning.margin_ms   = LOCK_TIMEOUT_MARGIN_MS;
+    Lock_Time_Learning.min_samples = LOCK_TIMEOUT_MIN_SAMPLES;
+    Lock_Time_Learning.verify      = LOCK_TIMEOUT_VERIFY;
+  }
+  return &Lock_Time_Learning;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Of function
+  Use:      Adaptive lock timeout retrieval
+            Returns the adaptive lock timeout of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the adaptive lock timeout
+************************************************************************************************************************/
+SILABS_Lock_Timeout *SiLabs_Lock_Timeout_Of            (SILABS_FE_Context *front_end) {
+  SILABS_Lock_Timeout *lt;
+  lt = &(Lock_Timeout_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { lt = ((SILABS_FE_Registry_Entry *)front_end)->lock_timeout; }
+#endif /* FRONTEND_REGISTRY */
+  if (lt->front_end != front_end) { SiLabs_Lock_Timeout_Init(lt, front_end); }
+  return lt;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Init function
+  Use:      Adaptive lock timeout initialization
+  Parameter: lt, a pointer to the adaptive lock timeout
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Init                (SILABS_Lock_Timeout *lt, SILABS_FE_Context *front_end) {
+  memset(lt, 0, sizeof(SILABS_Lock_Timeout));
+  lt->front_end = front_end;
+  lt->key       = -1;
+  SiLabs_Lock_Timeout_Learning();
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Config function
+  Use:      Adaptive lock timeout configuration (all front-ends)
+  Parameter: enabled, 1 to use the learned timeouts, 0 to use the default timeouts (lock times are still learned)
+  Parameter: permille, the lock time percentile used as learned timeout (999 = p99.9)
+  Parameter: margin_pct, the safety margin added to the percentile, in percent
+  Parameter: margin_ms, the safety margin added to the percentile, in ms
+  Parameter: min_samples, the number of locks required before using the learned timeout
+  Parameter: verify, every 'verify' learned timeouts, the wait goes on up to the default timeout (0: never)
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Config              (signed   int enabled, signed   int permille, signed   int margin_pct, signed   int margin_ms, signed   int min_samples, signed   int verify) {
+  SILABS_Lock_Time_Learning *learning;
+  learning = SiLabs_Lock_Timeout_Learning();
+  learning->enabled     = enabled;
+  learning->permille    = (permille    > 0) ? ( (permille < 1000) ? permille : 1000 ) : 1;
+  learning->margin_pct  = (margin_pct  > 0) ? margin_pct  : 0;
+  learning->margin_ms   = (margin_ms   > 0) ? margin_ms   : 0;
+  learning->min_samples = (min_samples > 1) ? min_samples : 1;
+  learning->verify      = (verify      > 0) ? verify      : 0;
+  SiTRACE("adaptive lock timeouts %s: p%d.%d + %d%% + %d ms after %d locks, verify 1/%d\n", enabled ? "enabled" : "disabled", learning->permille/10, learning->permille%10, learning->margin_pct, learning->margin_ms, learning->min_samples, learning->verify);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Reset function
+  Use:      Lock time statistics reset (all front-ends)
+  Returns:  the number of statistics entries cleared
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Reset               (void) {
+  SILABS_Lock_Time_Learning *learning;
+  signed   int nb_keys;
+  learning = SiLabs_Lock_Timeout_Learning();
+  nb_keys  = learning->nb_keys;
+  memset(learning->stats, 0, sizeof(learning->stats));
+  learning->nb_keys = 0;
+  return nb_keys;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Key function
+  Use:      Statistics entry selection
+            The symbol rate and constellation are only used for single carrier standards.
+  Parameter: standard, the CUSTOM standard
+  Parameter: constellation, the CUSTOM constellation
+  Parameter: symbol_rate_bps, the symbol rate
+  Returns:  the statistics index (created if new), -1 if the table is full
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Key                 (signed   int standard, signed   int constellation, unsigned int symbol_rate_bps) {
+  SILABS_Lock_Time_Learning *learning;
+  signed   int sr_class;
+  signed   int i;
+  learning = SiLabs_Lock_Timeout_Learning();
+  switch (standard) {
+    case SILABS_DVB_C :
+    case SILABS_MCNS  : { break; }
+    case SILABS_DVB_S :
+    case SILABS_DVB_S2:
+    case SILABS_DSS   : { break; }
+    default           : { constellation = 0; symbol_rate_bps = 0; break; }
+  }
+       if (symbol_rate_bps ==        0) { sr_class = 0; }
+  else if (symbol_rate_bps <=  2000000) { sr_class = 1; }
+  else if (symbol_rate_bps <=  5000000) { sr_class = 2; }
+  else if (symbol_rate_bps <= 10000000) { sr_class = 3; }
+  else if (symbol_rate_bps <= 20000000) { sr_class = 4; }
+  else if (symbol_rate_bps <= 30000000) { sr_class = 5; }
+  else                                  { sr_class = 6; }
+  for (i=0; i<learning->nb_keys; i++) {
+    if ( (learning->stats[i].standard == standard) && (learning->stats[i].constellation == constellation) && (learning->stats[i].sr_class == sr_class) ) { return i; }
+  }
+  if (learning->nb_keys >= LOCK_TIMEOUT_KEYS) { return -1; }
+  i = learning->nb_keys;
+  memset(&(learning->stats[i]), 0, sizeof(SILABS_Lock_Time_Stats));
+  learning->stats[i].standard      = standard;
+  learning->stats[i].constellation = constellation;
+  learning->stats[i].sr_class      = sr_class;
+  learning->nb_keys++;
+  return i;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Learned function
+  Use:      Learned timeouts computation
+  Parameter: stats, a pointer to the statistics entry
+  Parameter: max_ms, a pointer to store the learned max lock time (0 if not known)
+  Parameter: min_ms, a pointer to store the learned min lock time (0 if not known)
+  Returns:  1 if the learned values are known, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Learned             (SILABS_Lock_Time_Stats *stats, signed   int *max_ms, signed   int *min_ms) {
+  SILABS_Lock_Time_Learning *learning;
+  unsigned long total;
+  unsigned long target;
+  unsigned long count;
+  signed   int  b;
+  learning = SiLabs_Lock_Timeout_Learning();
+  *max_ms  = 0;
+  *min_ms  = 0;
+  if (stats->locks < (unsigned long)learning->min_samples) { return 0; }
+  total = 0;
+  for (b=0; b<LOCK_TIMEOUT_BINS; b++) { total = total + stats->histogram[b]; }
+  if (total == 0) { return 0; }
+  target = (total*learning->permille + 999)/1000;
+  count  = 0;
+  for (b=0; b<LOCK_TIMEOUT_BINS; b++) {
+    count = count + stats->histogram[b];
+    if (count >= target) { break; }
+  }
+  /* Lock times above the histogram range: the default timeout is kept */
+  if (b >= LOCK_TIMEOUT_BINS - 1) { return 0; }
+  *max_ms = (b+1)*LOCK_TIMEOUT_BIN_MS;
+  *max_ms = *max_ms + (*max_ms*learning->margin_pct)/100 + learning->margin_ms;
+  *min_ms = (stats->min_ms/LOCK_TIMEOUT_BIN_MS)*LOCK_TIMEOUT_BIN_MS;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Apply function
+  Use:      Learned timeouts selection before a lock attempt
+            Used by SiLabs_API_lock_to_carrier before the L2 lock, to pass the learned timeouts to the L2.
+  Parameter: lt, a pointer to the adaptive lock timeout
+  Parameter: standard, the CUSTOM standard
+  Parameter: constellation, the CUSTOM constellation
+  Parameter: symbol_rate_bps, the symbol rate
+  Returns:  the learned max lock time, 0 if the default timeout is used
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Apply               (SILABS_Lock_Timeout *lt, signed   int standard, signed   int constellation, unsigned int symbol_rate_bps) {
+  SILABS_Lock_Time_Learning *learning;
+  learning    = SiLabs_Lock_Timeout_Learning();
+  lt->key     = SiLabs_Lock_Timeout_Key(standard, constellation, symbol_rate_bps);
+  lt->max_ms  = 0;
+  lt->min_ms  = 0;
+  if ( (lt->key >= 0) && (learning->enabled) ) {
+    SiLabs_Lock_Timeout_Learned(&(learning->stats[lt->key]), &(lt->max_ms), &(lt->min_ms));
+  }
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(lt->front_end) ==   0x2183 ) {
+    lt->front_end->Si2183_FE->lockTimeoutMax_ms = lt->max_ms;
+    lt->front_end->Si2183_FE->lockTimeoutMin_ms = lt->min_ms;
+    lt->front_end->Si2183_FE->lockTimeoutVerify = learning->verify;
+    lt->timeouts = lt->front_end->Si2183_FE->nbLearnedTimeouts;
+    lt->verified = lt->front_end->Si2183_FE->nbLearnedVerified;
+    lt->misses   = lt->front_end->Si2183_FE->nbLearnedMisses;
+  }
+#endif /* Si2183_COMPATIBLE */
+  if (lt->max_ms) { SiTRACE("fe[%d] %s: learned lock timeout %d ms (min %d ms)\n", lt->front_end->fe_index, Silabs_Standard_Text(standard), lt->max_ms, lt->min_ms); }
+  return lt->max_ms;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Apply_Seek function
+  Use:      Learned timeouts selection before a seek
+            Used by SiLabs_API_Channel_Seek_Next before the L2 seek. Only 'not blind' seeks use the learned timeouts.
+  Parameter: lt, a pointer to the adaptive lock timeout
+  Returns:  the learned max lock time, 0 if the default timeout is used
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Apply_Seek          (SILABS_Lock_Timeout *lt) {
+  switch (lt->front_end->standard) {
+    case SILABS_DVB_T :
+    case SILABS_DVB_T2:
+    case SILABS_ISDB_T:
+    case SILABS_DVB_C2: { return SiLabs_Lock_Timeout_Apply(lt, lt->front_end->standard, 0, 0); }
+    default           : { break; }
+  }
+  lt->key    = -1;
+  lt->max_ms = 0;
+  lt->min_ms = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(lt->front_end) ==   0x2183 ) {
+    lt->front_end->Si2183_FE->lockTimeoutMax_ms = 0;
+    lt->front_end->Si2183_FE->lockTimeoutMin_ms = 0;
+  }
+#endif /* Si2183_COMPATIBLE */
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Record function
+  Use:      Lock attempt result recording
+            Used after the L2 lock or seek, to store the lock time and the learned timeouts results.
+            The L2 is then set back to the default timeouts.
+  Parameter: lt, a pointer to the adaptive lock timeout
+  Parameter: lock, the value returned by the L2 (values above 1 are handshakes, the lock attempt is not finished)
+  Returns:  the lock time, -1 if not recorded
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Record              (SILABS_Lock_Timeout *lt, signed   int lock) {
+  SILABS_Lock_Time_Learning *learning;
+  SILABS_Lock_Time_Stats    *stats;
+  signed   int lock_ms;
+  signed   int b;
+  if (lock > 1) { return -1; }
+  if (lt->key < 0) { return -1; }
+  learning = SiLabs_Lock_Timeout_Learning();
+  stats    = &(learning->stats[lt->key]);
+  lock_ms  = -1;
+  stats->attempts++;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(lt->front_end) ==   0x2183 ) {
+    stats->timeouts = stats->timeouts + (lt->front_end->Si2183_FE->nbLearnedTimeouts - lt->timeouts);
+    stats->verified = stats->verified + (lt->front_end->Si2183_FE->nbLearnedVerified - lt->verified);
+    stats->misses   = stats->misses   + (lt->front_end->Si2183_FE->nbLearnedMisses   - lt->misses  );
+    if (lock == 1) { lock_ms = lt->front_end->Si2183_FE->lockTime_ms; }
+    lt->front_end->Si2183_FE->lockTimeoutMax_ms = 0;
+    lt->front_end->Si2183_FE->lockTimeoutMin_ms = 0;
+  }
+#endif /* Si2183_COMPATIBLE */
+  lt->key = -1;
+  if (lock_ms < 0) { return -1; }
+  b = lock_ms/LOCK_TIMEOUT_BIN_MS;
+  if (b >= LOCK_TIMEOUT_BINS) { b = LOCK_TIMEOUT_BINS - 1; }
+  /* When a bin is full, all bins are halved. This also gives more weight to the recent lock times */
+  if (stats->histogram[b] == 0xffff) {
+    for (b=0; b<LOCK_TIMEOUT_BINS; b++) { stats->histogram[b] = stats->histogram[b]/2; }
+    b = lock_ms/LOCK_TIMEOUT_BIN_MS;
+    if (b >= LOCK_TIMEOUT_BINS) { b = LOCK_TIMEOUT_BINS - 1; }
+  }
+  stats->histogram[b]++;
+  if ( (stats->locks == 0) || (lock_ms < stats->min_ms) ) { stats->min_ms = lock_ms; }
+  if ( (stats->locks == 0) || (lock_ms > stats->max_ms) ) { stats->max_ms = lock_ms; }
+  stats->locks++;
+  return lock_ms;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Save function
+  Use:      Lock time statistics saving
+            Used to keep the lock time statistics across runs (see SiLabs_Lock_Timeout_Load).
+  Parameter: path, the file name
+  Returns:  1 if saved, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Save                (const char *path) {
+  SILABS_Lock_Time_Learning *learning;
+  FILE                      *file;
+  signed   int               saved;
+  learning = SiLabs_Lock_Timeout_Learning();
+  file = fopen(path, "wb");
+  if (file == NULL) { SiTRACE("SiLabs_Lock_Timeout_Save: can not open '%s'\n", path); return 0; }
+  saved = (fwrite(learning, sizeof(SILABS_Lock_Time_Learning), 1, file) == 1);
+  fclose(file);
+  SiTRACE("SiLabs_Lock_Timeout_Save: '%s' %s (%d entries)\n", path, saved?"saved":"write error", learning->nb_keys);
+  return saved;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Load function
+  Use:      Lock time statistics loading
+            Only the statistics are restored, the current configuration is kept.
+  Parameter: path, the file name
+  Returns:  the number of statistics entries loaded, 0 if the file is missing or invalid
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Load                (const char *path) {
+  static SILABS_Lock_Time_Learning  file_content;
+  SILABS_Lock_Time_Learning *learning;
+  SILABS_Lock_Time_Learning *loaded;
+  FILE                      *file;
+  signed   int               ok;
+  learning = SiLabs_Lock_Timeout_Learning();
+  loaded   = &file_content;
+  ok   = 0;
+  file = fopen(path, "rb");
+  if (file != NULL) {
+    ok = (fread(loaded, sizeof(SILABS_Lock_Time_Learning), 1, file) == 1);
+    fclose(file);
+  }
+  if ( (ok) && ( (loaded->magic != LOCK_TIMEOUT_FILE_MAGIC) || (loaded->size != sizeof(SILABS_Lock_Time_Learning)) || (loaded->nb_keys < 0) || (loaded->nb_keys > LOCK_TIMEOUT_KEYS) ) ) {
+    SiTRACE("SiLabs_Lock_Timeout_Load: '%s' is not a valid lock time file\n", path);
+    ok = 0;
+  }
+  if (ok) {
+    memcpy(learning->stats, loaded->stats, sizeof(learning->stats));
+    learning->nb_keys = loaded->nb_keys;
+    ok = learning->nb_keys;
+  }
+  SiTRACE("SiLabs_Lock_Timeout_Load: '%s' %d entries\n", path, ok);
+  return ok;
+}
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Text function
+  Use:      Adaptive lock timeout text
+            Used to list the configuration and the lock time statistics
+  Parameter: text, a buffer to store the text
+  Parameter: size, the buffer size
+  Returns:  the text length
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Text                (char *text, signed   int size) {
+  SILABS_Lock_Time_Learning *learning;
+  SILABS_Lock_Time_Stats    *stats;
+  signed   int max_ms;
+  signed   int min_ms;
+  signed   int i;
+  signed   int pos;
+  learning = SiLabs_Lock_Timeout_Learning();
+  pos = snprintf(text, size, "adaptive lock timeouts %s: p%d.%d + %d%% + %d ms after %d locks, verify 1/%d\n"
+    , learning->enabled ? "enabled" : "disabled", learning->permille/10, learning->permille%10, learning->margin_pct, learning->margin_ms, learning->min_samples, learning->verify);
+  for (i=0; (i<learning->nb_keys) && (pos < size); i++) {
+    stats = &(learning->stats[i]);
+    SiLabs_Lock_Timeout_Learned(stats, &max_ms, &min_ms);
+    pos += snprintf(text + pos, size - pos, "%-7s %-8s sr%d: %5ld locks/%5ld, %4d..%4d ms, timeout %4d ms, %ld timeouts, %ld misses/%ld verified\n"
+      , Silabs_Standard_Text(stats->standard), Silabs_Constel_Text(stats->constellation), stats->sr_class
+      , stats->locks, stats->attempts, stats->min_ms, stats->max_ms, max_ms, stats->timeouts, stats->misses, stats->verified);
+  }
+  return pos;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Lock_Timeout_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the adaptive lock timeouts.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Lock_Timeout_Test                (SILABS_Lock_Timeout *lt, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  SILABS_Lock_Time_Learning *learning;
+  signed   int permille;
+  signed   int margin_pct;
+  signed   int margin_ms;
+  signed   int min_samples;
+  signed   int verify;
+  target   = target;   /* To avoid compiler warning if not used */
+  lt       = lt;       /* To avoid compiler warning if not used */
+  learning = SiLabs_Lock_Timeout_Learning();
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible adaptive lock timeout test commands:\n\
+status                            : configuration and lock time statistics\n\
+enable             <0/1>          : use the learned timeouts or the default timeouts\n\
+config                            : set the learning (sub_cmd '<permille> <margin_pct> <margin_ms> <min_samples> <verify>')\n\
+reset                             : clear the lock time statistics\n\
+save                              : save the lock time statistics (sub_cmd '<file>')\n\
+load                              : load the lock time statistics (sub_cmd '<file>')\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = learning->nb_keys;
+    SiLabs_Lock_Timeout_Text(*rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "enable"             ) == 0) {
+    *retdval = SiLabs_Lock_Timeout_Config((signed int)dval, learning->permille, learning->margin_pct, learning->margin_ms, learning->min_samples, learning->verify);
+    snprintf(*rettxt, 1000, "adaptive lock timeouts %s\n", learning->enabled ? "enabled" : "disabled");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "config"             ) == 0) {
+    permille    = LOCK_TIMEOUT_PERMILLE;
+    margin_pct  = LOCK_TIMEOUT_MARGIN_PCT;
+    margin_ms   = LOCK_TIMEOUT_MARGIN_MS;
+    min_samples = LOCK_TIMEOUT_MIN_SAMPLES;
+    verify      = LOCK_TIMEOUT_VERIFY;
+    sscanf(sub_cmd, "%d %d %d %d %d", &permille, &margin_pct, &margin_ms, &min_samples, &verify);
+    *retdval = SiLabs_Lock_Timeout_Config(learning->enabled, permille, margin_pct, margin_ms, min_samples, verify);
+    SiLabs_Lock_Timeout_Text(*rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "reset"              ) == 0) {
+    *retdval = SiLabs_Lock_Timeout_Reset();
+    snprintf(*rettxt, 1000, "%d lock time statistics entries cleared\n", (signed int)*retdval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "save"               ) == 0) {
+    *retdval = SiLabs_Lock_Timeout_Save(sub_cmd);
+    snprintf(*rettxt, 1000, "lock time statistics %s '%s'\n", *retdval ? "saved in" : "NOT saved in", sub_cmd);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "load"               ) == 0) {
+    *retdval = SiLabs_Lock_Timeout_Load(sub_cmd);
+    snprintf(*rettxt, 1000, "%d lock time statistics entries loaded from '%s'\n", (signed int)*retdval, sub_cmd);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
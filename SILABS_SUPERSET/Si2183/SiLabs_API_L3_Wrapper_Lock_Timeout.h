@@ -0,0 +1,106 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Lock_Timeout_H_
+#define  _SiLabs_API_L3_Wrapper_Lock_Timeout_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[lock/adaptive_timeout] Adding adaptive lock timeouts via SiLabs_API_L3_Wrapper_Lock_Timeout.c/.h
+        Lock time statistics are kept per standard/symbol rate/constellation and used to shorten the lock timeouts.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOCK_TIMEOUT_KEYS               32  /* maximum number of standard/symbol rate/constellation combinations  */
+#define LOCK_TIMEOUT_BIN_MS             10  /* lock time histogram resolution                                     */
+#define LOCK_TIMEOUT_BINS              256  /* histogram size (the last bin holds all longer lock times)          */
+#define LOCK_TIMEOUT_PERMILLE          999  /* Default lock time percentile used as the learned timeout (p99.9)   */
+#define LOCK_TIMEOUT_MARGIN_PCT         25  /* Default safety margin added to the percentile, in percent          */
+#define LOCK_TIMEOUT_MARGIN_MS          50  /* Default safety margin added to the percentile, in ms               */
+#define LOCK_TIMEOUT_MIN_SAMPLES        20  /* Default number of locks required before using learned timeouts     */
+#define LOCK_TIMEOUT_VERIFY             10  /* Default: every 10th learned timeout, wait up to the default timeout */
+#define LOCK_TIMEOUT_FILE_MAGIC 0x4c4b5431  /* 'LKT1'                                                             */
+
+/* Structure used to store the lock time statistics of one standard/symbol rate/constellation combination */
+typedef struct _SILABS_Lock_Time_Stats            {
+  signed   int                  standard;
+  signed   int                  constellation;
+  signed   int                  sr_class;        /* symbol rate class (0 for OFDM standards)                      */
+  unsigned long                 attempts;
+  unsigned long                 locks;
+  unsigned long                 timeouts;        /* learned timeouts                                              */
+  unsigned long                 verified;        /* learned timeouts followed by a wait up to the default timeout */
+  unsigned long                 misses;          /* locks obtained after the learned timeout, while verifying     */
+  signed   int                  min_ms;
+  signed   int                  max_ms;
+  unsigned short                histogram[LOCK_TIMEOUT_BINS];
+} SILABS_Lock_Time_Stats;
+
+/* Structure used to store the lock time learning configuration and statistics (shared by all front-ends, saved in a file) */
+typedef struct _SILABS_Lock_Time_Learning         {
+  unsigned long                 magic;
+  unsigned long                 size;
+  signed   int                  enabled;
+  signed   int                  permille;
+  signed   int                  margin_pct;
+  signed   int                  margin_ms;
+  signed   int                  min_samples;
+  signed   int                  verify;          /* every 'verify' learned timeouts, wait up to the default timeout (0: never) */
+  signed   int                  nb_keys;
+  SILABS_Lock_Time_Stats        stats[LOCK_TIMEOUT_KEYS];
+} SILABS_Lock_Time_Learning;
+
+/* Structure used to store the adaptive lock timeout information of one front-end */
+typedef struct _SILABS_Lock_Timeout               {
+  SILABS_FE_Context            *front_end;
+  signed   int                  key;             /* stats index for the current lock attempt, -1 if none          */
+  signed   int                  max_ms;          /* learned timeout applied to the current lock attempt, 0 if none */
+  signed   int                  min_ms;
+  unsigned long                 timeouts;        /* L2 counters when the current lock attempt started             */
+  unsigned long                 verified;
+  unsigned long                 misses;
+} SILABS_Lock_Timeout;
+
+extern SILABS_Lock_Time_Learning  Lock_Time_Learning;
+extern SILABS_Lock_Timeout        Lock_Timeout_Table[FRONT_END_COUNT];
+
+SILABS_Lock_Time_Learning *SiLabs_Lock_Timeout_Learning (void);
+SILABS_Lock_Timeout *SiLabs_Lock_Timeout_Of            (SILABS_FE_Context *front_end);
+signed   int   SiLabs_Lock_Timeout_Init                (SILABS_Lock_Timeout *lt, SILABS_FE_Context *front_end);
+signed   int   SiLabs_Lock_Timeout_Config              (signed   int enabled, signed   int permille, signed   int margin_pct, signed   int margin_ms, signed   int min_samples, signed   int verify);
+signed   int   SiLabs_Lock_Timeout_Reset               (void);
+signed   int   SiLabs_Lock_Timeout_Key                 (signed   int standard, signed   int constellation, unsigned int symbol_rate_bps);
+signed   int   SiLabs_Lock_Timeout_Learned             (SILABS_Lock_Time_Stats *stats, signed   int *max_ms, signed   int *min_ms);
+signed   int   SiLabs_Lock_Timeout_Apply               (SILABS_Lock_Timeout *lt, signed   int standard, signed   int constellation, unsigned int symbol_rate_bps);
+signed   int   SiLabs_Lock_Timeout_Apply_Seek          (SILABS_Lock_Timeout *lt);
+signed   int   SiLabs_Lock_Timeout_Record              (SILABS_Lock_Timeout *lt, signed   int lock);
+signed   int   SiLabs_Lock_Timeout_Save                (const char *path);
+signed   int   SiLabs_Lock_Timeout_Load                (const char *path);
+signed   int   SiLabs_Lock_Timeout_Text                (char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Lock_Timeout_Test                (SILABS_Lock_Timeout *lt, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Lock_Timeout_H_ */
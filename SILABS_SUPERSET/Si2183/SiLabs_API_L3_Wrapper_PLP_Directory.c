@@ -0,0 +1,540 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API PLP Directory Functions                                       */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a PLP directory cache and a PLP hop function for DVB-T2 and DVB-C2           */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_Get_PLP_ID_and_TYPE and SiLabs_API_Get_PLP_Group_Id send one PLP_INFO command per PLP index
+  each time the application needs the PLP list, and changing service on a multiple PLP multiplex is
+  generally done using SiLabs_API_lock_to_carrier, which re-tunes and restarts the demodulator.
+
+ The PLP directory stores, for the multiplex currently received by each front-end:
+  - DVB-T2: the PLP ids, types and group ids, and the common PLP associated to each data PLP (same group id),
+  - DVB-C2: the data slices (id, number of PLPs, tuning position) and the PLP ids and types in each data slice,
+             and the common PLP associated to each grouped data PLP (same data slice).
+
+ The directory is filled on first use after lock, and invalidated:
+  - by SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next (new multiplex),
+  - when the signalling fields last read from the demodulator (DVBT2_STATUS or DVBC2_SYS_INFO) differ from those
+     read when the directory was filled (number of PLPs, FFT mode, guard interval, pilot pattern, T2 version, ...).
+    As the application generally reads the T2 status periodically, this check does not require additional i2c traffic.
+
+ When PLP_DIRECTORY is defined, SiLabs_API_Get_PLP_ID_and_TYPE and SiLabs_API_Get_PLP_Group_Id are served
+  from the directory, without any i2c traffic.
+
+ SiLabs_PLP_Hop changes the PLP on the current multiplex with one PLP_SELECT (DVB-T2) or DS_PLP_SELECT (DVB-C2)
+  command, without re-tuning and without DD_RESTART, then polls the standard status until the demodulator delivers
+  the new PLP. It returns -1 if the PLP is not in the current multiplex (or in a DVB-C2 data slice with a different
+  tuning position), in which case SiLabs_API_lock_to_carrier is required.
+
+ Use case:
+    SiLabs_API_lock_to_carrier (front_end, SILABS_DVB_T2, 474000000, 8000000, 0, 0, 0, 0, 0, 0, 1, 0);
+    directory = SiLabs_PLP_Directory_Of(front_end);
+    for (i=0; i<directory->nb_plp; i++) { ... directory->plp[i].plp_id ... }
+    SiLabs_PLP_Hop             (directory, 3, PLP_HOP_TIMEOUT_MS);
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[T2/C2/MPLP] Initial version of the PLP directory and PLP hop
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   PLP_DIRECTORY
+  "If you get a compilation error on this line, it means that you included the PLP_Directory code in your project without defining PLP_DIRECTORY.";
+  "Please define PLP_DIRECTORY at project-level, or remove the PLP_Directory code from your project";
+#endif /* PLP_DIRECTORY */
+
+#ifdef    PLP_DIRECTORY
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "PLP_Dir "
+#include "SiLabs_API_L3_Wrapper_PLP_Directory.h"
+
+SILABS_PLP_Directory  PLP_Directory_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Of function
+  Use:      PLP directory retrieval
+            Returns the PLP directory of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the PLP directory
+************************************************************************************************************************/
+SILABS_PLP_Directory *SiLabs_PLP_Directory_Of          (SILABS_FE_Context *front_end) {
+  SILABS_PLP_Directory *directory;
+  directory = &(PLP_Directory_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { directory = ((SILABS_FE_Registry_Entry *)front_end)->plp_directory; }
+#endif /* FRONTEND_REGISTRY */
+  if (directory->front_end != front_end) { SiLabs_PLP_Directory_Init(directory, front_end); }
+  return directory;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Init function
+  Use:      PLP directory initialization
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: front_end, a pointer to the SILABS_FE_Context using the directory
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Init               (SILABS_PLP_Directory *directory, SILABS_FE_Context *front_end) {
+  memset(directory, 0, sizeof(SILABS_PLP_Directory));
+  directory->front_end = front_end;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Invalidate function
+  Use:      PLP directory invalidation
+            Called when the front-end moves to another multiplex. The directory will be filled again on next use.
+  Parameter: directory, a pointer to the PLP directory
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Invalidate         (SILABS_PLP_Directory *directory) {
+  directory->valid  = 0;
+  directory->nb_plp = 0;
+  directory->nb_ds  = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Signature function
+  Use:      Signalling summary
+            Computed from the last DVBT2_STATUS or DVBC2_SYS_INFO response, without sending any command.
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: modulation, the dd_status modulation
+  Returns:  the signalling summary
+************************************************************************************************************************/
+unsigned long  SiLabs_PLP_Directory_Signature          (SILABS_PLP_Directory *directory, signed   int modulation) {
+  unsigned long signature;
+  signature = 0;
+  directory  = directory;  /* To avoid compiler warning if not used */
+  modulation = modulation; /* To avoid compiler warning if not used */
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(directory->front_end) ==   0x2183 ) {
+#ifdef    DEMOD_DVB_T2
+    if (modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) {
+      signature = (unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.num_plp
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.t2_version    <<  8)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.fft_mode      << 12)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.guard_int     << 16)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.pilot_pattern << 20)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.tx_mode       << 24)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.bw_ext        << 26)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.fef           << 27)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbt2_status.short_frame   << 28);
+    }
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_C2
+    if (modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBC2) {
+      signature = (unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbc2_sys_info.num_dslice
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbc2_sys_info.c2_version   <<  8)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbc2_sys_info.c2_system_id << 12)
+                + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbc2_sys_info.network_id   << 20);
+    }
+#endif /* DEMOD_DVB_C2 */
+  }
+#endif /* Si2183_COMPATIBLE */
+  return signature;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Associate function
+  Use:      Common PLP association
+            DVB-T2: a data PLP is associated to the common PLP with the same group id.
+            DVB-C2: a grouped data PLP is associated to the common PLP of the same data slice.
+  Parameter: directory, a pointer to the PLP directory
+  Returns:  the number of data PLPs with an associated common PLP
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Associate          (SILABS_PLP_Directory *directory) {
+  SILABS_PLP_Entry *entry;
+  SILABS_PLP_Entry *common;
+  signed   int      associated;
+  signed   int      i;
+  signed   int      j;
+  associated = 0;
+  for (i=0; i<directory->nb_plp; i++) {
+    entry = &(directory->plp[i]);
+    entry->common_plp_id = -1;
+#ifdef    DEMOD_DVB_T2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) {
+      if (entry->plp_type == Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON) { continue; }
+      for (j=0; j<directory->nb_plp; j++) {
+        common = &(directory->plp[j]);
+        if ( (common->plp_type == Si2183_DVBT2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON) && (common->group_id == entry->group_id) ) {
+          entry->common_plp_id = common->plp_id;
+          associated++;
+          break;
+        }
+      }
+    }
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_C2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBC2) {
+      if (entry->plp_type != Si2183_DVBC2_PLP_INFO_RESPONSE_PLP_TYPE_GROUPED) { continue; }
+      for (j=0; j<directory->nb_plp; j++) {
+        common = &(directory->plp[j]);
+        if ( (common->plp_type == Si2183_DVBC2_PLP_INFO_RESPONSE_PLP_TYPE_COMMON) && (common->ds_id == entry->ds_id) ) {
+          entry->common_plp_id = common->plp_id;
+          associated++;
+          break;
+        }
+      }
+    }
+#endif /* DEMOD_DVB_C2 */
+  }
+  j      = 0;      /* To avoid compiler warning if not used */
+  common = NULL;   /* To avoid compiler warning if not used */
+  return associated;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Fill function
+  Use:      PLP directory reading
+            Reads the signalling status and all PLP information of the current multiplex from the demodulator.
+            DVB-T2: 1 DVBT2_STATUS + 1 DVBT2_PLP_INFO per PLP
+            DVB-C2: 1 DVBC2_SYS_INFO + 1 DVBC2_DS_INFO per data slice + 1 DVBC2_PLP_INFO per PLP
+  Parameter: directory, a pointer to the PLP directory
+  Returns:  the number of stored PLPs, -1 if not locked in DVB-T2 or DVB-C2 or in case of an error
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Fill               (SILABS_PLP_Directory *directory) {
+  SILABS_FE_Context *front_end;
+  SILABS_PLP_Entry  *entry;
+  signed   int       start_ms;
+  signed   int       supported;
+  signed   int       i;
+#ifdef    DEMOD_DVB_C2
+  signed   int       ds;
+#endif /* DEMOD_DVB_C2 */
+  front_end = directory->front_end;
+  SiLabs_PLP_Directory_Invalidate(directory);
+  directory->num_plp    = 0;
+  directory->num_dslice = 0;
+  start_ms  = system_time();
+  supported = 0;
+  entry     = NULL;
+  i         = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+    directory->modulation = front_end->Si2183_FE->demod->rsp->dd_status.modulation;
+#ifdef    DEMOD_DVB_T2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) {
+      supported = 1;
+      if (Si2183_L1_DVBT2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) {
+        SiERROR("Si2183_L1_DVBT2_STATUS error when filling the PLP directory!\n");
+        return -1;
+      }
+      directory->num_plp = front_end->Si2183_FE->demod->rsp->dvbt2_status.num_plp;
+      for (i=0; (i<directory->num_plp) && (i<PLP_DIRECTORY_MAX_PLP); i++) {
+        if (Si2183_L1_DVBT2_PLP_INFO(front_end->Si2183_FE->demod, i) != NO_Si2183_ERROR) {
+          SiTRACE("Si2183_L1_DVBT2_PLP_INFO error when checking PLP index %d!\n", i);
+          SiERROR("Si2183_L1_DVBT2_PLP_INFO error when filling the PLP directory!\n");
+          return -1;
+        }
+        entry = &(directory->plp[i]);
+        entry->plp_id       = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_id;
+        entry->plp_type     = front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_type;
+        entry->group_id     =(front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_group_id_msb << 4) + front_end->Si2183_FE->demod->rsp->dvbt2_plp_info.plp_group_id_lsb;
+        entry->ds_id        = -1;
+        entry->ds_plp_index = i;
+      }
+      directory->nb_plp = i;
+    }
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_C2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBC2) {
+      supported = 1;
+      if (Si2183_L1_DVBC2_SYS_INFO(front_end->Si2183_FE->demod) != NO_Si2183_ERROR) {
+        SiERROR("Si2183_L1_DVBC2_SYS_INFO error when filling the PLP directory!\n");
+        return -1;
+      }
+      directory->num_dslice = front_end->Si2183_FE->demod->rsp->dvbc2_sys_info.num_dslice;
+      for (ds=0; (ds<directory->num_dslice) && (ds<PLP_DIRECTORY_MAX_DS); ds++) {
+        if (Si2183_L1_DVBC2_DS_INFO(front_end->Si2183_FE->demod, ds, Si2183_DVBC2_DS_INFO_CMD_DS_SELECT_INDEX_OR_ID_INDEX) != NO_Si2183_ERROR) {
+          SiTRACE("Si2183_L1_DVBC2_DS_INFO error when checking DS index %d!\n", ds);
+          SiERROR("Si2183_L1_DVBC2_DS_INFO error when filling the PLP directory!\n");
+          return -1;
+        }
+        directory->ds[ds].ds_id       = front_end->Si2183_FE->demod->rsp->dvbc2_ds_info.ds_id;
+        directory->ds[ds].num_plp     = front_end->Si2183_FE->demod->rsp->dvbc2_ds_info.dslice_num_plp;
+        directory->ds[ds].tune_pos_hz = front_end->Si2183_FE->demod->rsp->dvbc2_ds_info.dslice_tune_pos_hz;
+        directory->num_plp = directory->num_plp + directory->ds[ds].num_plp;
+        for (i=0; (i<directory->ds[ds].num_plp) && (directory->nb_plp<PLP_DIRECTORY_MAX_PLP); i++) {
+          if (Si2183_L1_DVBC2_PLP_INFO(front_end->Si2183_FE->demod, i, Si2183_DVBC2_PLP_INFO_CMD_PLP_INFO_DS_MODE_ANY, ds) != NO_Si2183_ERROR) {
+            SiTRACE("Si2183_L1_DVBC2_PLP_INFO error when checking DS index %d PLP index %d!\n", ds, i);
+            SiERROR("Si2183_L1_DVBC2_PLP_INFO error when filling the PLP directory!\n");
+            return -1;
+          }
+          entry = &(directory->plp[directory->nb_plp]);
+          entry->plp_id       = front_end->Si2183_FE->demod->rsp->dvbc2_plp_info.plp_id;
+          entry->plp_type     = front_end->Si2183_FE->demod->rsp->dvbc2_plp_info.plp_type;
+          entry->group_id     = 0;
+          entry->ds_id        = directory->ds[ds].ds_id;
+          entry->ds_plp_index = i;
+          directory->nb_plp++;
+        }
+      }
+      directory->nb_ds = ds;
+    }
+#endif /* DEMOD_DVB_C2 */
+  }
+#endif /* Si2183_COMPATIBLE */
+  entry = entry; /* To avoid compiler warning if not used */
+  i     = i;     /* To avoid compiler warning if not used */
+  if (!supported) {
+    SiTRACE("PLP directory: not locked in DVB-T2 or DVB-C2 (modulation %d)\n", directory->modulation);
+    return -1;
+  }
+  if (directory->num_plp > directory->nb_plp) {
+    SiTRACE("PLP directory: only %d PLPs stored out of %d\n", directory->nb_plp, directory->num_plp);
+  }
+  SiLabs_PLP_Directory_Associate(directory);
+  directory->signature = SiLabs_PLP_Directory_Signature(directory, directory->modulation);
+  directory->fill_ms   = system_time() - start_ms;
+  directory->valid     = 1;
+  directory->fills++;
+  SiTRACE("PLP directory filled in %d ms: %d PLPs, %d data slices\n", directory->fill_ms, directory->nb_plp, directory->nb_ds);
+  return directory->nb_plp;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Check function
+  Use:      PLP directory validation
+            Compares the signalling fields with those read when the directory was filled, and fills it again if required.
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: refresh, 1 to read the signalling fields from the demodulator first (1 command),
+                      0 to use the last values read by the application (no i2c traffic)
+  Returns:  1 if the directory is valid, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Check              (SILABS_PLP_Directory *directory, signed   int refresh) {
+  SILABS_FE_Context *front_end;
+  front_end = directory->front_end;
+  if (directory->valid) {
+#ifdef    Si2183_COMPATIBLE
+    if ( (refresh) && (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) ) {
+#ifdef    DEMOD_DVB_T2
+      if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) { Si2183_L1_DVBT2_STATUS  (front_end->Si2183_FE->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK); }
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_C2
+      if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBC2) { Si2183_L1_DVBC2_SYS_INFO(front_end->Si2183_FE->demod); }
+#endif /* DEMOD_DVB_C2 */
+    }
+#endif /* Si2183_COMPATIBLE */
+    if (SiLabs_PLP_Directory_Signature(directory, directory->modulation) == directory->signature) {
+      directory->hits++;
+      return 1;
+    }
+    SiTRACE("PLP directory: signalling change detected\n");
+  }
+  front_end = front_end; /* To avoid compiler warning if not used */
+  return (SiLabs_PLP_Directory_Fill(directory) >= 0);
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Find function
+  Use:      PLP search by id
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: plp_id, the PLP id
+  Returns:  a pointer to the PLP entry, NULL if the PLP is not in the current multiplex
+************************************************************************************************************************/
+SILABS_PLP_Entry *SiLabs_PLP_Directory_Find            (SILABS_PLP_Directory *directory, signed   int plp_id) {
+  signed   int i;
+  if (!SiLabs_PLP_Directory_Check(directory, 0)) { return NULL; }
+  for (i=0; i<directory->nb_plp; i++) {
+    if (directory->plp[i].plp_id == plp_id) { return &(directory->plp[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Lookup function
+  Use:      PLP search by index
+            Used by SiLabs_API_Get_PLP_ID_and_TYPE and SiLabs_API_Get_PLP_Group_Id.
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: ds_id, the data slice id (only for DVB-C2)
+  Parameter: plp_index, the PLP index (in the multiplex for DVB-T2, in the data slice for DVB-C2)
+  Returns:  a pointer to the PLP entry, NULL if not stored in the directory
+************************************************************************************************************************/
+SILABS_PLP_Entry *SiLabs_PLP_Directory_Lookup          (SILABS_PLP_Directory *directory, signed   int ds_id, signed   int plp_index) {
+  signed   int i;
+  if (!SiLabs_PLP_Directory_Check(directory, 0)) { return NULL; }
+  for (i=0; i<directory->nb_plp; i++) {
+    if ( (directory->plp[i].ds_plp_index == plp_index) && ( (directory->plp[i].ds_id == -1) || (directory->plp[i].ds_id == ds_id) ) ) { return &(directory->plp[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Hop function
+  Use:      PLP change on the current multiplex
+            Selects the PLP with a single PLP_SELECT (DVB-T2) or DS_PLP_SELECT (DVB-C2) command, without re-tuning
+             and without DD_RESTART, then polls the standard status until the new PLP is delivered.
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: plp_id, the PLP id
+  Parameter: timeout_ms, the maximum time to wait for the new PLP
+  Returns:  1 if locked on the new PLP, 0 in case of timeout,
+            -1 if the PLP can not be reached without lock_to_carrier (not in the multiplex, other C2 tuning position)
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Hop                          (SILABS_PLP_Directory *directory, signed   int plp_id, signed   int timeout_ms) {
+  SILABS_FE_Context *front_end;
+  SILABS_PLP_Entry  *entry;
+  signed   int       start_ms;
+  signed   int       locked;
+#ifdef    DEMOD_DVB_C2
+  signed   int       ds;
+  signed   int       current_pos_hz;
+  signed   int       target_pos_hz;
+#endif /* DEMOD_DVB_C2 */
+  front_end = directory->front_end;
+  SiTRACE("API CALL LOCK  : SiLabs_PLP_Hop (directory, %d, %d);\n", plp_id, timeout_ms);
+  entry = SiLabs_PLP_Directory_Find(directory, plp_id);
+  if (entry == NULL) {
+    SiTRACE("PLP %d is not in the current multiplex, lock_to_carrier is required\n", plp_id);
+    return -1;
+  }
+  start_ms = system_time();
+  locked   = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+#ifdef    DEMOD_DVB_T2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBT2) {
+      front_end->Si2183_FE->demod->cmd->dvbt2_plp_select.plp_id_sel_mode = Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_SEL_MODE_MANUAL;
+      front_end->Si2183_FE->demod->cmd->dvbt2_plp_select.plp_id          = (unsigned char)plp_id;
+      if (Si2183_L1_DVBT2_PLP_SELECT(front_end->Si2183_FE->demod, (unsigned char)plp_id, Si2183_DVBT2_PLP_SELECT_CMD_PLP_ID_SEL_MODE_MANUAL) != NO_Si2183_ERROR) {
+        SiERROR("Si2183_L1_DVBT2_PLP_SELECT error during PLP hop!\n");
+        return 0;
+      }
+      while (system_time() - start_ms < timeout_ms) {
+        if (Si2183_L1_DVBT2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBT2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { break; }
+        if ( (front_end->Si2183_FE->demod->rsp->dvbt2_status.plp_id == plp_id)
+          && (front_end->Si2183_FE->demod->rsp->dvbt2_status.dl     == Si2183_DVBT2_STATUS_RESPONSE_DL_LOCKED) ) { locked = 1; break; }
+        system_wait(PLP_HOP_POLL_MS);
+      }
+    }
+#endif /* DEMOD_DVB_T2 */
+#ifdef    DEMOD_DVB_C2
+    if (directory->modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBC2) {
+      current_pos_hz = target_pos_hz = 0;
+      if (Si2183_L1_DVBC2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBC2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { return 0; }
+      for (ds=0; ds<directory->nb_ds; ds++) {
+        if (directory->ds[ds].ds_id == front_end->Si2183_FE->demod->rsp->dvbc2_status.ds_id) { current_pos_hz = directory->ds[ds].tune_pos_hz; }
+        if (directory->ds[ds].ds_id == entry->ds_id                                        ) { target_pos_hz  = directory->ds[ds].tune_pos_hz; }
+      }
+      if (current_pos_hz != target_pos_hz) {
+        SiTRACE("PLP %d is in data slice %d, at another tuning position (%d Hz instead of %d Hz), lock_to_carrier is required\n", plp_id, entry->ds_id, target_pos_hz, current_pos_hz);
+        return -1;
+      }
+      front_end->Si2183_FE->demod->cmd->dvbc2_ds_plp_select.id_sel_mode = Si2183_DVBC2_DS_PLP_SELECT_CMD_ID_SEL_MODE_MANUAL;
+      front_end->Si2183_FE->demod->cmd->dvbc2_ds_plp_select.plp_id      = (unsigned char)plp_id;
+      front_end->Si2183_FE->demod->cmd->dvbc2_ds_plp_select.ds_id       = (unsigned char)entry->ds_id;
+      if (Si2183_L1_DVBC2_DS_PLP_SELECT(front_end->Si2183_FE->demod, (unsigned char)plp_id, Si2183_DVBC2_DS_PLP_SELECT_CMD_ID_SEL_MODE_MANUAL, (unsigned char)entry->ds_id) != NO_Si2183_ERROR) {
+        SiERROR("Si2183_L1_DVBC2_DS_PLP_SELECT error during PLP hop!\n");
+        return 0;
+      }
+      while (system_time() - start_ms < timeout_ms) {
+        if (Si2183_L1_DVBC2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBC2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { break; }
+        if ( (front_end->Si2183_FE->demod->rsp->dvbc2_status.plp_id == plp_id)
+          && (front_end->Si2183_FE->demod->rsp->dvbc2_status.ds_id  == entry->ds_id)
+          && (front_end->Si2183_FE->demod->rsp->dvbc2_status.dl     == Si2183_DVBC2_STATUS_RESPONSE_DL_LOCKED) ) { locked = 1; break; }
+        system_wait(PLP_HOP_POLL_MS);
+      }
+    }
+#endif /* DEMOD_DVB_C2 */
+  }
+#endif /* Si2183_COMPATIBLE */
+  directory->hop_ms = system_time() - start_ms;
+  directory->hops++;
+  if (locked) {
+    SiLabs_API_Reset_Uncorrs(front_end);
+    SiTRACE("PLP hop to PLP %d done in %d ms\n", plp_id, directory->hop_ms);
+  } else {
+    SiTRACE("PLP hop to PLP %d: no lock after %d ms\n", plp_id, directory->hop_ms);
+  }
+  return locked;
+}
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Text function
+  Use:      PLP directory display
+  Parameter: directory, a pointer to the PLP directory
+  Parameter: text, the output buffer
+  Parameter: size, the output buffer size
+  Returns:  the number of PLPs listed
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Text               (SILABS_PLP_Directory *directory, char *text, signed   int size) {
+  signed   int i;
+  signed   int pos;
+  pos = snprintf(text, size, "%d PLPs (%d stored), %d data slices, filled in %d ms (%lu fills, %lu hits, %lu hops)\n"
+    , directory->num_plp, directory->nb_plp, directory->num_dslice, directory->fill_ms, directory->fills, directory->hits, directory->hops);
+  for (i=0; (i<directory->nb_plp) && (pos < size); i++) {
+    pos += snprintf(text + pos, size - pos, " PLP %3d: type %d group %3d common %4d ds %4d index %3d\n"
+      , directory->plp[i].plp_id, directory->plp[i].plp_type, directory->plp[i].group_id, directory->plp[i].common_plp_id, directory->plp[i].ds_id, directory->plp[i].ds_plp_index);
+  }
+  return i;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_PLP_Directory_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the PLP directory.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_PLP_Directory_Test               (SILABS_PLP_Directory *directory, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible PLP directory test commands:\n\
+list                              : PLP directory of the current multiplex\n\
+fill                              : read the PLP directory again\n\
+check                             : check the signalling and fill the directory if required\n\
+hop                <plp_id>       : change PLP without re-tuning\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "list"               ) == 0) {
+    SiLabs_PLP_Directory_Check(directory, 0);
+    *retdval = SiLabs_PLP_Directory_Text(directory, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "fill"               ) == 0) {
+    *retdval = SiLabs_PLP_Directory_Fill(directory);
+    snprintf(*rettxt, 1000, "%d PLPs read in %d ms\n", (signed int)*retdval, directory->fill_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "check"              ) == 0) {
+    *retdval = SiLabs_PLP_Directory_Check(directory, 1);
+    snprintf(*rettxt, 1000, "PLP directory %s (%lu fills)\n", *retdval ? "valid" : "invalid", directory->fills);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "hop"                ) == 0) {
+    *retdval = SiLabs_PLP_Hop(directory, (signed int)dval, PLP_HOP_TIMEOUT_MS);
+    snprintf(*rettxt, 1000, "PLP hop to %d: %s in %d ms\n", (signed int)dval, (*retdval == 1) ? "locked" : ((*retdval == 0) ? "not locked" : "lock_to_carrier required"), directory->hop_ms);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PLP_DIRECTORY */
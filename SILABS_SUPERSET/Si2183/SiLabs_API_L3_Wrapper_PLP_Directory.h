@@ -0,0 +1,92 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_PLP_Directory_H_
+#define  _SiLabs_API_L3_Wrapper_PLP_Directory_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[T2/C2/MPLP] Adding a PLP directory cache via SiLabs_API_L3_Wrapper_PLP_Directory.c/.h
+        The PLP list of the current multiplex is read once after lock, and PLPs can be changed without re-tuning.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PLP_DIRECTORY_MAX_PLP         64  /* Maximum number of PLPs stored per multiplex (T2 allows 255)       */
+#define PLP_DIRECTORY_MAX_DS          16  /* Maximum number of C2 data slices stored per multiplex             */
+#define PLP_HOP_TIMEOUT_MS          1000  /* Default maximum time to get the demodulator locked on the new PLP */
+#define PLP_HOP_POLL_MS               10  /* Status polling period during a PLP hop                            */
+
+/* Structure used to store one PLP of the current multiplex */
+typedef struct _SILABS_PLP_Entry                  {
+  unsigned char                 plp_id;
+  unsigned char                 plp_type;        /* Si2183 plp_type code, as returned by SiLabs_API_Get_PLP_ID_and_TYPE   */
+  signed   int                  group_id;        /* DVB-T2 only, 0 in DVB-C2                                            */
+  signed   int                  common_plp_id;   /* id of the common PLP associated to this data PLP, -1 if none        */
+  signed   int                  ds_id;           /* DVB-C2 only, data slice containing the PLP, -1 in DVB-T2            */
+  signed   int                  ds_plp_index;    /* index of the PLP in its data slice (DVB-C2) or in the multiplex     */
+} SILABS_PLP_Entry;
+
+/* Structure used to store one DVB-C2 data slice of the current multiplex */
+typedef struct _SILABS_PLP_Data_Slice             {
+  signed   int                  ds_id;
+  signed   int                  num_plp;
+  signed   int                  tune_pos_hz;
+} SILABS_PLP_Data_Slice;
+
+/* Structure used to store the PLP directory of the multiplex currently received by one front-end */
+typedef struct _SILABS_PLP_Directory              {
+  SILABS_FE_Context            *front_end;
+  signed   int                  valid;
+  signed   int                  modulation;      /* dd_status.modulation when the directory was filled            */
+  unsigned long                 signature;       /* signalling fields summary, used to detect signalling changes  */
+  signed   int                  num_plp;         /* number of PLPs signalled in the multiplex                     */
+  signed   int                  nb_plp;          /* number of PLPs stored (limited to PLP_DIRECTORY_MAX_PLP)      */
+  SILABS_PLP_Entry              plp[PLP_DIRECTORY_MAX_PLP];
+  signed   int                  num_dslice;      /* DVB-C2 only                                                   */
+  signed   int                  nb_ds;
+  SILABS_PLP_Data_Slice         ds[PLP_DIRECTORY_MAX_DS];
+  signed   int                  fill_ms;         /* duration of the last directory read                           */
+  signed   int                  hop_ms;          /* duration of the last PLP hop                                  */
+  unsigned long                 fills;
+  unsigned long                 hits;
+  unsigned long                 hops;
+} SILABS_PLP_Directory;
+
+extern SILABS_PLP_Directory  PLP_Directory_Table[FRONT_END_COUNT];
+
+SILABS_PLP_Directory *SiLabs_PLP_Directory_Of          (SILABS_FE_Context *front_end);
+signed   int   SiLabs_PLP_Directory_Init               (SILABS_PLP_Directory *directory, SILABS_FE_Context *front_end);
+signed   int   SiLabs_PLP_Directory_Invalidate         (SILABS_PLP_Directory *directory);
+signed   int   SiLabs_PLP_Directory_Fill               (SILABS_PLP_Directory *directory);
+signed   int   SiLabs_PLP_Directory_Check              (SILABS_PLP_Directory *directory, signed   int refresh);
+SILABS_PLP_Entry *SiLabs_PLP_Directory_Find            (SILABS_PLP_Directory *directory, signed   int plp_id);
+SILABS_PLP_Entry *SiLabs_PLP_Directory_Lookup          (SILABS_PLP_Directory *directory, signed   int ds_id, signed   int plp_index);
+signed   int   SiLabs_PLP_Hop                          (SILABS_PLP_Directory *directory, signed   int plp_id, signed   int timeout_ms);
+signed   int   SiLabs_PLP_Directory_Text               (SILABS_PLP_Directory *directory, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_PLP_Directory_Test               (SILABS_PLP_Directory *directory, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_PLP_Directory_H_ */
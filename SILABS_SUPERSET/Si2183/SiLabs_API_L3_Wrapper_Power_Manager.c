@@ -0,0 +1,606 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Power Manager Functions                                       */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a usage-based power manager for the front-ends                              */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_Demod_Standby, SiLabs_API_TER_Tuner_Standby, SiLabs_API_SAT_Tuner_Standby and the SILABS_SLEEP
+  standard are only applied on application request. Idle front-ends therefore either stay fully powered or
+  pay the full wake-up latency on their next use.
+
+ The power manager tracks the use of each managed front-end and selects its power state:
+  POWER_STATE_ACTIVE        : demodulator and tuners running in the last used standard
+  POWER_STATE_STANDBY_CLOCK : switch_to_standard(SILABS_SLEEP) with the tuner clocks kept on
+                               (wake-up without clock restart)
+  POWER_STATE_STANDBY       : switch_to_standard(SILABS_SLEEP) with the configured clock control
+                               (tuner clocks off if Si2183_CLOCK_MANAGED)
+  POWER_STATE_OFF           : switch_to_standard(SILABS_OFF). The next use does a full init, so the platform may
+                               remove the front-end supply in this state.
+
+ After 'idle_ms' without use, a front-end is put in the lowest power state whose wake-up latency fits its
+  'wake_budget_ms'. The wake-up latency of each state is measured on each wake-up (last, min, max, average).
+  The average is used as the estimate for the next decisions, with default values as long as no wake-up has been
+  measured from a state (POWER_MANAGER_WAKE_xxx_MS).
+
+ Front-ends are woken up in advance ('pre-warmed'):
+  - for scheduled uses (SiLabs_Power_Manager_Schedule, i.e. recordings), the wake-up latency estimate before the
+     scheduled time,
+  - when they are predicted to be used next: each front-end records the front-end used after it (its successor).
+     When the same succession has been seen 'predict_hits' times in a row, using a front-end pre-warms its
+     successor (i.e. the next channel in a zap sequence over a pool of front-ends),
+  - a front-end is kept active when its average idle time shows that it will be used again before 'idle_ms'.
+
+ SiLabs_Power_Manager_Process applies the decisions. It needs to be called periodically by the application.
+ The power manager follows the standard changes done directly using SiLabs_API_switch_to_standard.
+
+ Use case:
+    pm = SiLabs_Power_Manager_Of(front_end);
+    SiLabs_Power_Manager_Config (pm, 2000, 100);
+    ...
+    SiLabs_Power_Manager_Use    (pm, SILABS_DVB_T2);  (wakes up the front-end if required)
+    SiLabs_API_lock_to_carrier  (front_end, ...);
+    ...
+    SiLabs_Power_Manager_Release(pm);
+    ...
+    SiLabs_Power_Manager_Process();                   (periodically, for all front-ends)
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[power_consumption/Power_manager] Initial version of the power manager
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   POWER_MANAGER
+  "If you get a compilation error on this line, it means that you included the Power_Manager code in your project without defining POWER_MANAGER.";
+  "Please define POWER_MANAGER at project-level, or remove the Power_Manager code from your project";
+#endif /* POWER_MANAGER */
+
+#ifdef    POWER_MANAGER
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Power   "
+#include "SiLabs_API_L3_Wrapper_Power_Manager.h"
+
+SILABS_Power_Manager  Power_Manager_Table[FRONT_END_COUNT];
+SILABS_Power_Manager *Power_Manager_Last_Used = NULL; /* power manager of the last used front-end, to learn the successions */
+SILABS_Power_Manager *Power_Manager_List      = NULL; /* all initialized power managers, for SiLabs_Power_Manager_Process */
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Set_State function
+  Use:      Power state change recording
+            Used to update the residency time of the previous state
+  Parameter: pm, a pointer to the power manager of the front-end
+  Parameter: state, the new state
+************************************************************************************************************************/
+void           SiLabs_Power_Manager_Set_State          (SILABS_Power_Manager *pm, signed   int state) {
+  signed   int now;
+  now = system_time();
+  if (pm->state_ms != 0) { pm->residency_ms[pm->state] = pm->residency_ms[pm->state] + (now - pm->state_ms); }
+  if (state != pm->state) { pm->entries[state]++; }
+  if (state != POWER_STATE_ACTIVE) { pm->prewarmed = 0; }
+  pm->state    = state;
+  pm->state_ms = now;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Of function
+  Use:      Power manager retrieval
+            Returns the power manager of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the power manager
+************************************************************************************************************************/
+SILABS_Power_Manager *SiLabs_Power_Manager_Of          (SILABS_FE_Context *front_end) {
+  SILABS_Power_Manager *pm;
+  pm = &(Power_Manager_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { pm = ((SILABS_FE_Registry_Entry *)front_end)->power_manager; }
+#endif /* FRONTEND_REGISTRY */
+  if (pm->front_end != front_end) { SiLabs_Power_Manager_Init(pm, front_end); }
+  return pm;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Init function
+  Use:      Power manager initialization
+            The initial state is ACTIVE if the front-end is already running, OFF otherwise.
+            The front-end is not managed until SiLabs_Power_Manager_Config is called.
+  Parameter: pm, a pointer to the power manager
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Init               (SILABS_Power_Manager *pm, SILABS_FE_Context *front_end) {
+  signed   int i;
+  SiLabs_Power_Manager_Remove(pm);
+  memset(pm, 0, sizeof(SILABS_Power_Manager));
+  pm->front_end      = front_end;
+  pm->idle_ms        = POWER_MANAGER_IDLE_MS;
+  pm->wake_budget_ms = POWER_MANAGER_WAKE_BUDGET_MS;
+  pm->predict_hits   = POWER_MANAGER_PREDICT_HITS;
+  pm->mean_idle_ms   = -1;
+  pm->standard       = front_end->standard;
+  for (i=0; i<POWER_STATES; i++) { pm->wake[i].min_ms = -1; }
+  if ( (front_end->init_ok) && (front_end->standard != SILABS_SLEEP) && (front_end->standard != SILABS_OFF) ) {
+    pm->state = POWER_STATE_ACTIVE;
+  } else {
+    pm->state = POWER_STATE_OFF;
+  }
+  pm->state_ms = system_time();
+  pm->next     = Power_Manager_List;
+  Power_Manager_List = pm;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Remove function
+  Use:      Power manager removal
+            Used before re-initializing or freeing a power manager, to remove it from Power_Manager_List and from
+             the successions learned by the other power managers.
+  Parameter: pm, a pointer to the power manager
+************************************************************************************************************************/
+void           SiLabs_Power_Manager_Remove             (SILABS_Power_Manager *pm) {
+  SILABS_Power_Manager **link;
+  SILABS_Power_Manager  *other;
+  for (link = &Power_Manager_List; *link != NULL; link = &((*link)->next)) {
+    if (*link == pm) { *link = pm->next; break; }
+  }
+  for (other = Power_Manager_List; other != NULL; other = other->next) {
+    if (other->successor == pm) { other->successor = NULL; other->successor_hits = 0; }
+  }
+  if (Power_Manager_Last_Used == pm) { Power_Manager_Last_Used = NULL; }
+  pm->next = NULL;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Config function
+  Use:      Power manager configuration
+            Used to start managing a front-end, with its idle time and wake-up latency budget
+  Parameter: pm, a pointer to the power manager
+  Parameter: idle_ms, the idle time before entering a low power state (-1 to stop managing the front-end)
+  Parameter: wake_budget_ms, the maximum wake-up latency accepted after idle_ms
+  Returns:  1 if the front-end is managed, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Config             (SILABS_Power_Manager *pm, signed   int idle_ms, signed   int wake_budget_ms) {
+  SiTRACE("API CALL CONFIG: SiLabs_Power_Manager_Config (pm, %d, %d);\n", idle_ms, wake_budget_ms);
+  if (idle_ms < 0) { pm->managed = 0; return 0; }
+  pm->idle_ms        = idle_ms;
+  pm->wake_budget_ms = wake_budget_ms;
+  pm->managed        = 1;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Estimate function
+  Use:      Wake-up latency estimate
+  Parameter: pm, a pointer to the power manager
+  Parameter: state, the power state
+  Returns:  the average measured wake-up latency from 'state', or its default value if not measured yet
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Estimate           (SILABS_Power_Manager *pm, signed   int state) {
+  if ( (state <= POWER_STATE_ACTIVE) || (state >= POWER_STATES) ) { return 0; }
+  if (pm->wake[state].count) { return (signed int)(pm->wake[state].total_ms/pm->wake[state].count); }
+  switch (state) {
+    case POWER_STATE_STANDBY_CLOCK: return POWER_MANAGER_WAKE_CLOCK_MS;
+    case POWER_STATE_STANDBY      : return POWER_MANAGER_WAKE_STANDBY_MS;
+    default                       : return POWER_MANAGER_WAKE_OFF_MS;
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Choose function
+  Use:      Idle state selection
+  Parameter: pm, a pointer to the power manager
+  Returns:  the lowest power state with a wake-up latency estimate within wake_budget_ms, POWER_STATE_ACTIVE if none
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Choose             (SILABS_Power_Manager *pm) {
+  signed   int state;
+  for (state = POWER_STATES - 1; state > POWER_STATE_ACTIVE; state--) {
+    if (SiLabs_Power_Manager_Estimate(pm, state) <= pm->wake_budget_ms) { return state; }
+  }
+  return POWER_STATE_ACTIVE;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Enter function
+  Use:      Power state change
+            Used to put the front-end in a low power state (or to wake it up if state is POWER_STATE_ACTIVE)
+  Parameter: pm, a pointer to the power manager
+  Parameter: state, the new state
+  Returns:  1 if successful, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Enter              (SILABS_Power_Manager *pm, signed   int state) {
+  SILABS_FE_Context *front_end;
+  signed   int       ok;
+#ifdef    Si2183_COMPATIBLE
+  unsigned int       ter_clock_control;
+  unsigned int       sat_clock_control;
+#endif /* Si2183_COMPATIBLE */
+  front_end = pm->front_end;
+  if (state == pm->state        ) { return 1; }
+  if (state == POWER_STATE_ACTIVE) { return (SiLabs_Power_Manager_Wake(pm, pm->standard) >= 0); }
+  /* Moving to a state with a higher power consumption requires a wake-up first (the clocks are off) */
+  if ( (pm->state != POWER_STATE_ACTIVE) && (state < pm->state) ) {
+    if (SiLabs_Power_Manager_Wake(pm, pm->standard) < 0) { return 0; }
+  }
+  SiTRACE("SiLabs_Power_Manager_Enter: fe[%d] %s -> %s\n", front_end->fe_index, SiLabs_Power_Manager_State_Text(pm->state), SiLabs_Power_Manager_State_Text(state));
+  pm->transition = 1;
+  ok = 0;
+  if (state == POWER_STATE_OFF) {
+    ok = SiLabs_API_switch_to_standard(front_end, SILABS_OFF  , 0);
+  } else {
+#ifdef    Si2183_COMPATIBLE
+    ter_clock_control = sat_clock_control = 0;
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+      ter_clock_control = front_end->Si2183_FE->demod->tuner_ter_clock_control;
+      sat_clock_control = front_end->Si2183_FE->demod->tuner_sat_clock_control;
+      if (state == POWER_STATE_STANDBY_CLOCK) {
+        if (ter_clock_control != Si2183_CLOCK_ALWAYS_OFF) { front_end->Si2183_FE->demod->tuner_ter_clock_control = Si2183_CLOCK_ALWAYS_ON; }
+        if (sat_clock_control != Si2183_CLOCK_ALWAYS_OFF) { front_end->Si2183_FE->demod->tuner_sat_clock_control = Si2183_CLOCK_ALWAYS_ON; }
+      }
+    }
+#endif /* Si2183_COMPATIBLE */
+    ok = SiLabs_API_switch_to_standard(front_end, SILABS_SLEEP, 0);
+#ifdef    Si2183_COMPATIBLE
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+      front_end->Si2183_FE->demod->tuner_ter_clock_control = ter_clock_control;
+      front_end->Si2183_FE->demod->tuner_sat_clock_control = sat_clock_control;
+    }
+#endif /* Si2183_COMPATIBLE */
+  }
+  pm->transition = 0;
+  if (ok) { SiLabs_Power_Manager_Set_State(pm, state); }
+  return ok;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Wake function
+  Use:      Front-end wake-up
+            Used to switch the front-end to 'standard', measuring the wake-up latency if it was in a low power state
+  Parameter: pm, a pointer to the power manager
+  Parameter: standard, the standard to use
+  Returns:  the wake-up latency in ms (0 if the front-end was already active), -1 in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Wake               (SILABS_Power_Manager *pm, signed   int standard) {
+  SILABS_Power_Wake_Stats *wake;
+  signed   int              from;
+  signed   int              start_ms;
+  signed   int              latency;
+  from = pm->state;
+  if ( (from == POWER_STATE_ACTIVE) && (standard == pm->standard) ) { return 0; }
+  start_ms       = system_time();
+  pm->transition = 1;
+  latency        = SiLabs_API_switch_to_standard(pm->front_end, standard, 0);
+  pm->transition = 0;
+  if (latency == 0) {
+    SiTRACE("SiLabs_Power_Manager_Wake: fe[%d] switch to %s failed\n", pm->front_end->fe_index, Silabs_Standard_Text(standard));
+    return -1;
+  }
+  latency      = system_time() - start_ms;
+  pm->standard = standard;
+  if (from != POWER_STATE_ACTIVE) {
+    wake = &(pm->wake[from]);
+    wake->count++;
+    wake->last_ms  = latency;
+    wake->total_ms = wake->total_ms + latency;
+    if ( (wake->min_ms < 0) || (latency < wake->min_ms) ) { wake->min_ms = latency; }
+    if (                        latency > wake->max_ms  ) { wake->max_ms = latency; }
+    SiTRACE("SiLabs_Power_Manager_Wake: fe[%d] woken up from %s in %d ms\n", pm->front_end->fe_index, SiLabs_Power_Manager_State_Text(from), latency);
+    SiLabs_Power_Manager_Set_State(pm, POWER_STATE_ACTIVE);
+  } else {
+    latency = 0;
+  }
+  return latency;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Use function
+  Use:      Front-end use start
+            Used before using a front-end in 'standard'. The front-end is woken up if required.
+            The idle time and the succession of front-ends are recorded, and the successor of the front-end is
+             marked for pre-warming if the same succession has been seen predict_hits times in a row.
+  Parameter: pm, a pointer to the power manager
+  Parameter: standard, the standard to use
+  Returns:  the wake-up latency in ms (0 if the front-end was active), -1 in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Use                (SILABS_Power_Manager *pm, signed   int standard) {
+  SILABS_Power_Manager *previous;
+  signed   int          latency;
+  signed   int          idle;
+  if ( (pm->state == POWER_STATE_ACTIVE) && (pm->prewarmed) && (standard == pm->standard) ) { pm->prewarm_hits++; }
+  if (pm->state != POWER_STATE_ACTIVE) { pm->demand_wakes++; }
+  latency = SiLabs_Power_Manager_Wake(pm, standard);
+  if (latency < 0) { return -1; }
+  if ( (pm->release_ms != 0) && (pm->in_use == 0) ) {
+    idle = system_time() - pm->release_ms;
+    if (pm->mean_idle_ms < 0) { pm->mean_idle_ms = idle; } else { pm->mean_idle_ms = (7*pm->mean_idle_ms + idle)/8; }
+  }
+  pm->in_use    = 1;
+  pm->prewarmed = 0;
+  pm->predicted = 0;
+  pm->uses++;
+  if ( (Power_Manager_Last_Used != NULL) && (Power_Manager_Last_Used != pm) ) {
+    previous = Power_Manager_Last_Used;
+    if (previous->successor == pm) {
+      previous->successor_hits++;
+    } else {
+      previous->successor      = pm;
+      previous->successor_hits = 1;
+    }
+  }
+  Power_Manager_Last_Used = pm;
+  if ( (pm->predict_hits > 0) && (pm->successor != NULL) && (pm->successor_hits >= pm->predict_hits) ) {
+    if (pm->successor->managed) { pm->successor->predicted = 1; }
+  }
+  return latency;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Release function
+  Use:      Front-end use end
+            Used when the application stops using a front-end. The idle time starts.
+  Parameter: pm, a pointer to the power manager
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Release            (SILABS_Power_Manager *pm) {
+  pm->in_use     = 0;
+  pm->release_ms = system_time();
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Prewarm function
+  Use:      Front-end wake-up in advance
+            Used to wake up a front-end expected to be used soon. It stays active for at least idle_ms.
+  Parameter: pm, a pointer to the power manager
+  Parameter: standard, the expected standard
+  Returns:  the wake-up latency in ms (0 if the front-end was active), -1 in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Prewarm            (SILABS_Power_Manager *pm, signed   int standard) {
+  signed   int latency;
+  if (pm->in_use) { return 0; }
+  latency = SiLabs_Power_Manager_Wake(pm, standard);
+  if (latency < 0) { return -1; }
+  pm->prewarms++;
+  pm->prewarmed = 1;
+  pm->state_ms  = system_time();
+  return latency;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Schedule function
+  Use:      Scheduled use declaration
+            Used to declare a future use (i.e. a recording). The front-end will be woken up before 'at_ms',
+             taking into account the wake-up latency estimate of its state at that time.
+  Parameter: pm, a pointer to the power manager
+  Parameter: at_ms, the time of the scheduled use (system_time() value), 0 to cancel
+  Parameter: standard, the expected standard
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Schedule           (SILABS_Power_Manager *pm, signed   int at_ms, signed   int standard) {
+  pm->schedule_ms       = at_ms;
+  pm->schedule_standard = standard;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Process function
+  Use:      Power manager decisions
+            Needs to be called periodically. For each managed front-end:
+             - pre-warms it before its scheduled use or when it is predicted to be used next,
+             - puts it in the lowest power state compatible with its wake-up budget after idle_ms without use,
+                unless its average idle time shows that it will be used again before idle_ms.
+  Returns:  the number of power state changes
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Process            (void) {
+  SILABS_Power_Manager *pm;
+  signed   int          transitions;
+  signed   int          now;
+  signed   int          idle_start;
+  signed   int          expected;
+  signed   int          state;
+  transitions = 0;
+  for (pm = Power_Manager_List; pm != NULL; pm = pm->next) {
+    if ( (pm->managed == 0) || (pm->front_end == NULL) ) { continue; }
+    now = system_time();
+    if (pm->schedule_ms != 0) {
+      if (pm->state != POWER_STATE_ACTIVE) {
+        if (now >= pm->schedule_ms - SiLabs_Power_Manager_Estimate(pm, pm->state) - POWER_MANAGER_PREWARM_MS) {
+          if (SiLabs_Power_Manager_Prewarm(pm, pm->schedule_standard) >= 0) { transitions++; }
+          continue;
+        }
+      } else if (now >= pm->schedule_ms) {
+        pm->schedule_ms = 0;
+      }
+    }
+    if (pm->predicted) {
+      pm->predicted = 0;
+      if (pm->state != POWER_STATE_ACTIVE) {
+        if (SiLabs_Power_Manager_Prewarm(pm, pm->standard) >= 0) { transitions++; }
+        continue;
+      }
+    }
+    if ( (pm->state != POWER_STATE_ACTIVE) || (pm->in_use) ) { continue; }
+    idle_start = (pm->release_ms > pm->state_ms) ? pm->release_ms : pm->state_ms;
+    if (now - idle_start < pm->idle_ms) { continue; }
+    /* Keeping the front-end active for a scheduled use within idle_ms */
+    if ( (pm->schedule_ms != 0) && (pm->schedule_ms - now < pm->idle_ms) ) { continue; }
+    /* Keeping the front-end active if its average idle time shows that it will be used again within idle_ms */
+    if ( (pm->mean_idle_ms >= 0) && (pm->release_ms != 0) ) {
+      expected = pm->release_ms + pm->mean_idle_ms;
+      if ( (expected > now) && (expected - now < pm->idle_ms) ) { continue; }
+    }
+    state = SiLabs_Power_Manager_Choose(pm);
+    if (state == POWER_STATE_ACTIVE) { continue; }
+    if (SiLabs_Power_Manager_Enter(pm, state)) { transitions++; }
+  }
+  return transitions;
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Notify function
+  Use:      Standard change notification
+            Called by SiLabs_API_switch_to_standard, to follow the standard changes done by the application
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Parameter: standard, the new standard
+  Parameter: init_ok, the switch_to_standard result
+************************************************************************************************************************/
+void           SiLabs_Power_Manager_Notify             (SILABS_FE_Context *front_end, signed   int standard, signed   int init_ok) {
+  SILABS_Power_Manager *pm;
+  pm = &(Power_Manager_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { pm = ((SILABS_FE_Registry_Entry *)front_end)->power_manager; }
+#endif /* FRONTEND_REGISTRY */
+  if ( (pm->front_end != front_end) || (pm->transition) || (init_ok == 0) ) { return; }
+  if        (standard == SILABS_SLEEP) {
+    SiLabs_Power_Manager_Set_State(pm, POWER_STATE_STANDBY);
+  } else if (standard == SILABS_OFF  ) {
+    SiLabs_Power_Manager_Set_State(pm, POWER_STATE_OFF);
+  } else {
+    pm->standard = standard;
+    if (pm->state != POWER_STATE_ACTIVE) { SiLabs_Power_Manager_Set_State(pm, POWER_STATE_ACTIVE); }
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_State_Text function
+  Use:      Power state name
+  Parameter: state, the power state
+  Returns:  the state name
+************************************************************************************************************************/
+char          *SiLabs_Power_Manager_State_Text         (signed   int state) {
+  switch (state) {
+    case POWER_STATE_ACTIVE       : return (char *)"ACTIVE";
+    case POWER_STATE_STANDBY_CLOCK: return (char *)"STANDBY_CLOCK";
+    case POWER_STATE_STANDBY      : return (char *)"STANDBY";
+    case POWER_STATE_OFF          : return (char *)"OFF";
+    default                       : return (char *)"UNKNOWN";
+  }
+}
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Text function
+  Use:      Power manager display
+            Lists the state, the usage counters, the residency in each state and the measured wake-up latencies
+  Parameter: pm, a pointer to the power manager
+  Parameter: text, the output buffer
+  Parameter: size, the output buffer size
+  Returns:  the number of characters written
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Text               (SILABS_Power_Manager *pm, char *text, signed   int size) {
+  SILABS_Power_Wake_Stats *wake;
+  unsigned long            residency;
+  signed   int             state;
+  signed   int             pos;
+  pos  = snprintf(text, size, "fe[%d] %s%s in %s, %s, idle %d ms, budget %d ms (idle state %s)\n"
+    , pm->front_end->fe_index, SiLabs_Power_Manager_State_Text(pm->state), pm->prewarmed ? " (pre-warmed)" : ""
+    , Silabs_Standard_Text(pm->standard), pm->in_use ? "in use" : "not used", pm->idle_ms, pm->wake_budget_ms
+    , SiLabs_Power_Manager_State_Text(SiLabs_Power_Manager_Choose(pm)));
+  pos += snprintf(text + pos, size - pos, "%lu uses, %lu demand wake-ups, %lu pre-warms (%lu hits), successor %d (%d hits), mean idle %d ms\n"
+    , pm->uses, pm->demand_wakes, pm->prewarms, pm->prewarm_hits, pm->successor ? pm->successor->front_end->fe_index : -1, pm->successor_hits, pm->mean_idle_ms);
+  for (state = 0; (state < POWER_STATES) && (pos < size); state++) {
+    wake      = &(pm->wake[state]);
+    residency = pm->residency_ms[state];
+    if (state == pm->state) { residency = residency + (system_time() - pm->state_ms); }
+    pos += snprintf(text + pos, size - pos, " %-13s: %5lu entries, %9lu ms", SiLabs_Power_Manager_State_Text(state), pm->entries[state], residency);
+    if ( (state != POWER_STATE_ACTIVE) && (pos < size) ) {
+      pos += snprintf(text + pos, size - pos, ", %lu wake-ups: last %d min %d max %d avg %d ms (estimate %d ms)"
+        , wake->count, wake->last_ms, wake->min_ms, wake->max_ms, wake->count ? (signed int)(wake->total_ms/wake->count) : 0, SiLabs_Power_Manager_Estimate(pm, state));
+    }
+    if (pos < size) { pos += snprintf(text + pos, size - pos, "\n"); }
+  }
+  return pos;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Power_Manager_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the power manager.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Power_Manager_Test               (SILABS_Power_Manager *pm, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int idle_ms;
+  signed   int wake_budget_ms;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible power manager test commands:\n\
+status                            : power state, counters, residency and wake-up latencies\n\
+config                            : start managing the front-end (sub_cmd '<idle_ms> <wake_budget_ms>')\n\
+unmanage                          : stop managing the front-end\n\
+use                <standard>     : use the front-end (SILABS_DVB_T = 0, ...), returns the wake-up latency\n\
+release                           : stop using the front-end\n\
+prewarm                           : wake up the front-end in advance, in its last standard\n\
+schedule           <delay_ms>     : declare a use in delay_ms, in the last standard\n\
+enter              <state>        : force a power state (0: ACTIVE, 1: STANDBY_CLOCK, 2: STANDBY, 3: OFF)\n\
+process                           : apply the power manager decisions for all front-ends\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = pm->state;
+    SiLabs_Power_Manager_Text(pm, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "config"             ) == 0) {
+    idle_ms        = POWER_MANAGER_IDLE_MS;
+    wake_budget_ms = POWER_MANAGER_WAKE_BUDGET_MS;
+    sscanf(sub_cmd, "%d %d", &idle_ms, &wake_budget_ms);
+    *retdval = SiLabs_Power_Manager_Config(pm, idle_ms, wake_budget_ms);
+    snprintf(*rettxt, 1000, "fe[%d] managed: idle %d ms, wake-up budget %d ms\n", pm->front_end->fe_index, pm->idle_ms, pm->wake_budget_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "unmanage"           ) == 0) {
+    *retdval = SiLabs_Power_Manager_Config(pm, -1, 0);
+    snprintf(*rettxt, 1000, "fe[%d] not managed\n", pm->front_end->fe_index);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "use"                ) == 0) {
+    *retdval = SiLabs_Power_Manager_Use(pm, (signed int)dval);
+    snprintf(*rettxt, 1000, "fe[%d] used in %s, wake-up latency %d ms\n", pm->front_end->fe_index, Silabs_Standard_Text((signed int)dval), (signed int)*retdval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "release"            ) == 0) {
+    *retdval = SiLabs_Power_Manager_Release(pm);
+    snprintf(*rettxt, 1000, "fe[%d] released\n", pm->front_end->fe_index);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "prewarm"            ) == 0) {
+    *retdval = SiLabs_Power_Manager_Prewarm(pm, pm->standard);
+    snprintf(*rettxt, 1000, "fe[%d] pre-warmed in %d ms\n", pm->front_end->fe_index, (signed int)*retdval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "schedule"           ) == 0) {
+    *retdval = SiLabs_Power_Manager_Schedule(pm, system_time() + (signed int)dval, pm->standard);
+    snprintf(*rettxt, 1000, "fe[%d] use scheduled in %d ms\n", pm->front_end->fe_index, (signed int)dval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "enter"              ) == 0) {
+    *retdval = SiLabs_Power_Manager_Enter(pm, (signed int)dval);
+    snprintf(*rettxt, 1000, "fe[%d] %s %s\n", pm->front_end->fe_index, SiLabs_Power_Manager_State_Text((signed int)dval), *retdval ? "entered" : "error");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "process"            ) == 0) {
+    *retdval = SiLabs_Power_Manager_Process();
+    snprintf(*rettxt, 1000, "%d power state changes\n", (signed int)*retdval);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* POWER_MANAGER */
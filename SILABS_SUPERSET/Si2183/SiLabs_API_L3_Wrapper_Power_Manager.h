@@ -0,0 +1,119 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Power_Manager_H_
+#define  _SiLabs_API_L3_Wrapper_Power_Manager_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[power_consumption/Power_manager] Adding a power manager via SiLabs_API_L3_Wrapper_Power_Manager.c/.h
+        Idle front-ends are put in the lowest power state compatible with a wake-up latency budget,
+         and front-ends expected to be used soon are woken up in advance.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Power states, from the highest to the lowest power consumption */
+#define POWER_STATE_ACTIVE               0  /* demodulator and tuners running in 'standard'                       */
+#define POWER_STATE_STANDBY_CLOCK        1  /* demodulator and tuners in standby, tuner clocks kept on            */
+#define POWER_STATE_STANDBY              2  /* demodulator and tuners in standby, tuner clocks off (if managed)    */
+#define POWER_STATE_OFF                  3  /* full init required on next use, the supply may be removed          */
+#define POWER_STATES                     4
+
+#define POWER_MANAGER_IDLE_MS         2000  /* Default idle time before a front-end is put in a low power state  */
+#define POWER_MANAGER_WAKE_BUDGET_MS   100  /* Default maximum wake-up latency accepted for an idle front-end    */
+#define POWER_MANAGER_PREWARM_MS        50  /* Margin added to the wake-up latency estimate for scheduled uses   */
+#define POWER_MANAGER_PREDICT_HITS       2  /* Identical successions required to pre-warm a successor (0: off)  */
+
+/* Wake-up latency estimates used as long as no wake-up has been measured from a given state */
+#define POWER_MANAGER_WAKE_CLOCK_MS     10
+#define POWER_MANAGER_WAKE_STANDBY_MS   30
+#define POWER_MANAGER_WAKE_OFF_MS     1500
+
+/* Structure used to store the wake-up latencies measured from one power state */
+typedef struct _SILABS_Power_Wake_Stats           {
+  unsigned long                 count;
+  signed   int                  last_ms;
+  signed   int                  min_ms;
+  signed   int                  max_ms;
+  unsigned long                 total_ms;
+} SILABS_Power_Wake_Stats;
+
+/* Structure used to store the power management information of one front-end */
+typedef struct _SILABS_Power_Manager              {
+  SILABS_FE_Context            *front_end;
+  signed   int                  managed;         /* 1 when the front-end is handled by SiLabs_Power_Manager_Process */
+  signed   int                  state;           /* POWER_STATE_xxx                                               */
+  signed   int                  standard;        /* standard restored on wake-up (last used standard)             */
+  signed   int                  in_use;
+  signed   int                  idle_ms;         /* idle time before entering a low power state                   */
+  signed   int                  wake_budget_ms;  /* maximum wake-up latency accepted when idle                    */
+  signed   int                  predict_hits;    /* identical successions required to pre-warm the successor      */
+  signed   int                  release_ms;      /* time of the last release (or pre-warm)                        */
+  signed   int                  state_ms;        /* time of the last state change                                 */
+  signed   int                  mean_idle_ms;    /* average time between a release and the next use, -1: unknown  */
+  struct _SILABS_Power_Manager *successor;       /* power manager of the front-end used after this one, NULL: unknown */
+  signed   int                  successor_hits;  /* number of consecutive identical successions                   */
+  signed   int                  predicted;       /* set when this front-end is expected to be used next           */
+  signed   int                  schedule_ms;     /* time of the next scheduled use, 0 if none                     */
+  signed   int                  schedule_standard;
+  signed   int                  prewarmed;       /* 1 when woken up in advance and not used yet                   */
+  signed   int                  transition;      /* set during the power manager's own transitions                */
+  unsigned long                 uses;
+  unsigned long                 prewarms;
+  unsigned long                 prewarm_hits;    /* uses served by a pre-warmed front-end                         */
+  unsigned long                 demand_wakes;    /* uses requiring a wake-up                                      */
+  unsigned long                 entries[POWER_STATES];
+  unsigned long                 residency_ms[POWER_STATES];
+  SILABS_Power_Wake_Stats       wake[POWER_STATES];
+  struct _SILABS_Power_Manager *next;            /* next initialized power manager, in Power_Manager_List         */
+} SILABS_Power_Manager;
+
+extern SILABS_Power_Manager  Power_Manager_Table[FRONT_END_COUNT];
+
+extern SILABS_Power_Manager *Power_Manager_Last_Used;
+extern SILABS_Power_Manager *Power_Manager_List;
+
+SILABS_Power_Manager *SiLabs_Power_Manager_Of          (SILABS_FE_Context *front_end);
+void           SiLabs_Power_Manager_Set_State          (SILABS_Power_Manager *pm, signed   int state);
+signed   int   SiLabs_Power_Manager_Init               (SILABS_Power_Manager *pm, SILABS_FE_Context *front_end);
+void           SiLabs_Power_Manager_Remove             (SILABS_Power_Manager *pm);
+signed   int   SiLabs_Power_Manager_Config             (SILABS_Power_Manager *pm, signed   int idle_ms, signed   int wake_budget_ms);
+signed   int   SiLabs_Power_Manager_Estimate           (SILABS_Power_Manager *pm, signed   int state);
+signed   int   SiLabs_Power_Manager_Choose             (SILABS_Power_Manager *pm);
+signed   int   SiLabs_Power_Manager_Enter              (SILABS_Power_Manager *pm, signed   int state);
+signed   int   SiLabs_Power_Manager_Wake               (SILABS_Power_Manager *pm, signed   int standard);
+signed   int   SiLabs_Power_Manager_Use                (SILABS_Power_Manager *pm, signed   int standard);
+signed   int   SiLabs_Power_Manager_Release            (SILABS_Power_Manager *pm);
+signed   int   SiLabs_Power_Manager_Prewarm            (SILABS_Power_Manager *pm, signed   int standard);
+signed   int   SiLabs_Power_Manager_Schedule           (SILABS_Power_Manager *pm, signed   int at_ms, signed   int standard);
+signed   int   SiLabs_Power_Manager_Process            (void);
+void           SiLabs_Power_Manager_Notify             (SILABS_FE_Context *front_end, signed   int standard, signed   int init_ok);
+char          *SiLabs_Power_Manager_State_Text         (signed   int state);
+signed   int   SiLabs_Power_Manager_Text               (SILABS_Power_Manager *pm, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Power_Manager_Test               (SILABS_Power_Manager *pm, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Power_Manager_H_ */
@@ -0,0 +1,386 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API RSSI Pre-screen Functions                                     */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a tuner-only RSSI sweep used to accelerate 'not blind' channel scans          */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ In 'not blind' mode (DVB-T, DVB-T2, ISDB-T, DVB-C2), Si2183_L2_Channel_Seek_Next tunes each raster step,
+  issues a DD_RESTART and waits at least min_lock_time_ms, then until the demodulator decides that there is
+  no signal. Most of the scan time is therefore spent on empty channels.
+
+ The RSSI pre-screen adds a first pass, done in SiLabs_API_Channel_Seek_Init:
+  - each raster step of the scan range is tuned (tuner only) and the TER tuner RSSI is read after 'settle_ms'.
+  - the median RSSI of the sweep is used as the noise floor.
+  - the steps with an RSSI at or above the applied threshold are the candidates, where the applied threshold is
+     the lowest of 'threshold_dBm' and 'noise floor + above_floor_dB' ('above_floor_dB' = 0 to only use the
+     absolute threshold). 'neighbors' steps on each side of a candidate can also be probed, for rasters finer
+     than the channel bandwidth.
+
+ In the second pass, SiLabs_API_Channel_Seek_Next only runs the demodulator seek on the candidates, by setting
+  the L2 seek range to each candidate in turn. Locks, handshakes and aborts are returned to the application
+  as without pre-screen. The number of probed and skipped steps is available for the last scan.
+
+ The pre-screen is only applied with TER tuners using the SiLabs TER tuner wrapper (TER_TUNER_SILABS),
+  since these provide the tuner RSSI. In all other cases the scan is done on all steps.
+
+ Use case:
+    SiLabs_RSSI_Prescreen_Config (SiLabs_RSSI_Prescreen_Of(front_end), 1, -80, 8, 5, 0);
+    SiLabs_API_switch_to_standard(front_end, SILABS_DVB_T2, 0);
+    SiLabs_API_Channel_Seek_Init (front_end, 474000000, 858000000, 8000000, 8000000, 0, 0, 0, 0, 0, 0);  (RSSI sweep)
+    while (SiLabs_API_Channel_Seek_Next(front_end, ...) == 1) { ... }                                    (candidates only)
+    SiLabs_API_Channel_Seek_End  (front_end);
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[scan/not_blind] Initial version of the RSSI pre-screen
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   RSSI_PRESCREEN
+  "If you get a compilation error on this line, it means that you included the RSSI_Prescreen code in your project without defining RSSI_PRESCREEN.";
+  "Please define RSSI_PRESCREEN at project-level, or remove the RSSI_Prescreen code from your project";
+#endif /* RSSI_PRESCREEN */
+
+#ifdef    RSSI_PRESCREEN
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Prescreen "
+#include "SiLabs_API_L3_Wrapper_RSSI_Prescreen.h"
+
+SILABS_RSSI_Prescreen  RSSI_Prescreen_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Of function
+  Use:      RSSI pre-screen retrieval
+            Returns the RSSI pre-screen of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the RSSI pre-screen
+************************************************************************************************************************/
+SILABS_RSSI_Prescreen *SiLabs_RSSI_Prescreen_Of        (SILABS_FE_Context *front_end) {
+  SILABS_RSSI_Prescreen *pre;
+  pre = &(RSSI_Prescreen_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { pre = ((SILABS_FE_Registry_Entry *)front_end)->rssi_prescreen; }
+#endif /* FRONTEND_REGISTRY */
+  if (pre->front_end != front_end) { SiLabs_RSSI_Prescreen_Init(pre, front_end); }
+  return pre;
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Init function
+  Use:      RSSI pre-screen initialization
+            The pre-screen is enabled with the default thresholds.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Init              (SILABS_RSSI_Prescreen *pre, SILABS_FE_Context *front_end) {
+  memset(pre, 0, sizeof(SILABS_RSSI_Prescreen));
+  pre->front_end      = front_end;
+  pre->enabled        = 1;
+  pre->threshold_dBm  = RSSI_PRESCREEN_THRESHOLD_DBM;
+  pre->above_floor_dB = RSSI_PRESCREEN_ABOVE_FLOOR_DB;
+  pre->settle_ms      = RSSI_PRESCREEN_SETTLE_MS;
+  pre->neighbors      = RSSI_PRESCREEN_NEIGHBORS;
+  pre->probing        = -1;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Config function
+  Use:      RSSI pre-screen configuration
+            Used to enable/disable the pre-screen and to set its thresholds. Applied from the next SiLabs_API_Channel_Seek_Init.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Parameter: enabled, 1 to use the pre-screen, 0 to scan all steps
+  Parameter: threshold_dBm, the RSSI at or above which a step is always probed
+  Parameter: above_floor_dB, the margin above the noise floor at or above which a step is probed (0: not used)
+  Parameter: settle_ms, the delay between the tune and the RSSI reading
+  Parameter: neighbors, the number of steps also probed on each side of a candidate
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Config            (SILABS_RSSI_Prescreen *pre, signed   int enabled, signed   int threshold_dBm, signed   int above_floor_dB, signed   int settle_ms, signed   int neighbors) {
+  pre->enabled        = enabled;
+  pre->threshold_dBm  = threshold_dBm;
+  pre->above_floor_dB = (above_floor_dB > 0) ? above_floor_dB : 0;
+  pre->settle_ms      = (settle_ms      > 0) ? settle_ms      : 0;
+  pre->neighbors      = (neighbors      > 0) ? neighbors      : 0;
+  SiTRACE("fe[%d] RSSI pre-screen %s, threshold %d dBm, %d dB above floor, settle %d ms, %d neighbors\n", pre->front_end->fe_index, pre->enabled ? "enabled" : "disabled", pre->threshold_dBm, pre->above_floor_dB, pre->settle_ms, pre->neighbors);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Sweep function
+  Use:      RSSI sweep
+            Used by SiLabs_API_Channel_Seek_Init to measure the RSSI on all raster steps and to select the candidates.
+            The pre-screen is only activated in 'not blind' TER standards, with a SiLabs TER tuner.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Parameter: range_min, the first raster step (Hz)
+  Parameter: range_max, the last  raster step (Hz)
+  Parameter: step_hz, the raster step (Hz)
+  Returns:  the number of candidates, -1 if the pre-screen is not used for this scan
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Sweep             (SILABS_RSSI_Prescreen *pre, signed   int range_min, signed   int range_max, signed   int step_hz) {
+  SILABS_FE_Context   *front_end;
+#ifdef    TER_TUNER_SILABS
+  CUSTOM_Status_Struct status;
+  signed   char        sorted[RSSI_PRESCREEN_MAX_STEPS];
+  signed   char        rssi;
+  signed   int         start_ms;
+  signed   int         i;
+  signed   int         j;
+#endif /* TER_TUNER_SILABS */
+  front_end        = pre->front_end;
+  pre->active      = 0;
+  pre->probing     = -1;
+  pre->nb_steps    = 0;
+  pre->candidates  = pre->probed = pre->skipped = pre->locked = 0;
+  pre->sweep_ms    = pre->seek_ms = 0;
+  if (!pre->enabled) { return -1; }
+  switch (front_end->standard) {
+    case SILABS_DVB_T :
+    case SILABS_DVB_T2:
+    case SILABS_ISDB_T:
+    case SILABS_DVB_C2: { break; }
+    default           : {
+      SiTRACE("fe[%d] RSSI pre-screen not used in %s (blind scan)\n", front_end->fe_index, Silabs_Standard_Text(front_end->standard));
+      return -1;
+    }
+  }
+  if ( (step_hz <= 0) || (range_max < range_min) ) { return -1; }
+  if ( (range_max - range_min)/step_hz + 1 > RSSI_PRESCREEN_MAX_STEPS ) {
+    SiTRACE("fe[%d] RSSI pre-screen not used: more than %d steps from %d to %d by %d Hz\n", front_end->fe_index, RSSI_PRESCREEN_MAX_STEPS, range_min, range_max, step_hz);
+    return -1;
+  }
+  pre->range_min = range_min;
+  pre->range_max = range_max;
+  pre->step_hz   = step_hz;
+#ifdef    TER_TUNER_SILABS
+  start_ms       = system_time();
+  pre->nb_steps  = (range_max - range_min)/step_hz + 1;
+  for (i=0; i<pre->nb_steps; i++) {
+#ifdef    Si2183_COMPATIBLE
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { Si2183_L2_Tune(front_end->Si2183_FE, range_min + i*step_hz); }
+#endif /* Si2183_COMPATIBLE */
+    if (pre->settle_ms) { system_wait(pre->settle_ms); }
+    status.rssi = -128;
+    SiLabs_API_TER_Tuner_status(front_end, &status);
+    pre->rssi[i]     = status.rssi;
+    pre->candidate[i] = 0;
+    /* insertion in the sorted copy, to retrieve the median */
+    rssi = status.rssi;
+    for (j=i; (j>0) && (sorted[j-1] > rssi); j--) { sorted[j] = sorted[j-1]; }
+    sorted[j] = rssi;
+  }
+  pre->floor_dBm   = sorted[pre->nb_steps/2];
+  pre->applied_dBm = pre->threshold_dBm;
+  if ( (pre->above_floor_dB) && (pre->floor_dBm + pre->above_floor_dB < pre->applied_dBm) ) { pre->applied_dBm = pre->floor_dBm + pre->above_floor_dB; }
+  for (i=0; i<pre->nb_steps; i++) {
+    if (pre->rssi[i] < pre->applied_dBm) { continue; }
+    for (j=i-pre->neighbors; j<=i+pre->neighbors; j++) {
+      if ( (j >= 0) && (j < pre->nb_steps) ) { pre->candidate[j] = 1; }
+    }
+  }
+  for (i=0; i<pre->nb_steps; i++) { pre->candidates = pre->candidates + pre->candidate[i]; }
+  pre->skipped  = pre->nb_steps - pre->candidates;
+  pre->sweep_ms = system_time() - start_ms;
+  pre->active   = 1;
+  SiTRACE("fe[%d] RSSI pre-screen: %d candidates out of %d steps (floor %d dBm, threshold %d dBm) in %d ms\n", front_end->fe_index, pre->candidates, pre->nb_steps, pre->floor_dBm, pre->applied_dBm, pre->sweep_ms);
+  return pre->candidates;
+#else  /* TER_TUNER_SILABS */
+  SiTRACE("fe[%d] RSSI pre-screen not used: the TER tuner RSSI is only available with TER_TUNER_SILABS\n", front_end->fe_index);
+  return -1;
+#endif /* TER_TUNER_SILABS */
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Range function
+  Use:      Candidate selection
+            Used by SiLabs_API_Channel_Seek_Next before each L2 seek, to restrict the L2 seek range to the next candidate
+             at or above the current L2 rangeMin.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Returns:  1 if the L2 seek needs to be done, 0 if there is no candidate left (end of range)
+            When the pre-screen is not active, the L2 seek is done once on the full range.
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Range             (SILABS_RSSI_Prescreen *pre) {
+#ifdef    Si2183_COMPATIBLE
+  Si2183_L2_Context *L2;
+  signed   int       i;
+  if (!pre->active) { return 1; }
+  if (SILABS_DEMOD_CHIP(pre->front_end) != 0x2183) { return 1; }
+  L2 = pre->front_end->Si2183_FE;
+  i  = 0;
+  if ((signed int)L2->rangeMin > pre->range_min) { i = ((signed int)L2->rangeMin - pre->range_min + pre->step_hz - 1)/pre->step_hz; }
+  while ( (i < pre->nb_steps) && (pre->candidate[i] == 0) ) { i++; }
+  if (i >= pre->nb_steps) {
+    L2->rangeMin = pre->range_max + pre->step_hz;
+    pre->probing = -1;
+    return 0;
+  }
+  if (i != pre->probing) { pre->probed++; }
+  pre->probing  = i;
+  L2->rangeMin  = L2->rangeMax = pre->range_min + i*pre->step_hz;
+  pre->probe_ms = system_time();
+  SiTRACE("fe[%d] RSSI pre-screen: probing %d (rssi %d dBm)\n", pre->front_end->fe_index, L2->rangeMin, pre->rssi[i]);
+#endif /* Si2183_COMPATIBLE */
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Result function
+  Use:      Candidate seek result
+            Used by SiLabs_API_Channel_Seek_Next after each L2 seek, to restore the L2 seek range and to decide whether
+             the next candidate needs to be probed.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Parameter: seek_result, the value returned by the L2 seek
+  Returns:  1 to probe the next candidate, 0 to return seek_result to the application
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Result            (SILABS_RSSI_Prescreen *pre, signed   int seek_result) {
+#ifdef    Si2183_COMPATIBLE
+  Si2183_L2_Context *L2;
+  if (!pre->active) { return 0; }
+  if (SILABS_DEMOD_CHIP(pre->front_end) != 0x2183) { return 0; }
+  L2 = pre->front_end->Si2183_FE;
+  L2->rangeMax = pre->range_max;
+  pre->seek_ms = pre->seek_ms + (system_time() - pre->probe_ms);
+  if (seek_result == 1) { pre->locked++; return 0; }
+  /* Handshake: the L2 rangeMin is still on the probed step, the seek will be resumed on this step */
+  if (seek_result >  1) { return 0; }
+  if (L2->seekAbort    ) { return 0; }
+  /* No channel on this candidate: next candidate */
+  L2->rangeMin = pre->range_min + (pre->probing + 1)*pre->step_hz;
+  return 1;
+#else  /* Si2183_COMPATIBLE */
+  pre         = pre;         /* To avoid compiler warning */
+  seek_result = seek_result; /* To avoid compiler warning */
+  return 0;
+#endif /* Si2183_COMPATIBLE */
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_End function
+  Use:      RSSI pre-screen end
+            Used by SiLabs_API_Channel_Seek_End to deactivate the pre-screen. The statistics are kept until the next sweep.
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Returns:  the number of probed steps
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_End               (SILABS_RSSI_Prescreen *pre) {
+  if (pre->active) {
+    SiTRACE("fe[%d] RSSI pre-screen: %d steps, %d probed, %d skipped, %d locked. sweep %d ms, seek %d ms\n", pre->front_end->fe_index, pre->nb_steps, pre->probed, pre->skipped, pre->locked, pre->sweep_ms, pre->seek_ms);
+  }
+  pre->active  = 0;
+  pre->probing = -1;
+  return pre->probed;
+}
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Text function
+  Use:      RSSI pre-screen text
+            Used to list the configuration, the statistics and the candidates of the last sweep
+  Parameter: pre, a pointer to the RSSI pre-screen
+  Parameter: text, a buffer to store the text
+  Parameter: size, the buffer size
+  Returns:  the text length
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Text              (SILABS_RSSI_Prescreen *pre, char *text, signed   int size) {
+  signed   int i;
+  signed   int pos;
+  pos  = snprintf(text, size, "fe[%d] RSSI pre-screen %s%s: threshold %d dBm, %d dB above floor, settle %d ms, %d neighbors\n"
+    , pre->front_end->fe_index, pre->enabled ? "enabled" : "disabled", pre->active ? " (active)" : "", pre->threshold_dBm, pre->above_floor_dB, pre->settle_ms, pre->neighbors);
+  if (pre->nb_steps == 0) { return pos; }
+  pos += snprintf(text + pos, size - pos, "last sweep: %d steps from %d to %d by %d Hz in %d ms, floor %d dBm, applied threshold %d dBm\n"
+    , pre->nb_steps, pre->range_min, pre->range_max, pre->step_hz, pre->sweep_ms, pre->floor_dBm, pre->applied_dBm);
+  if (pos < size) {
+    pos += snprintf(text + pos, size - pos, "%d candidates, %d probed, %d skipped, %d locked, seek %d ms\n"
+      , pre->candidates, pre->probed, pre->skipped, pre->locked, pre->seek_ms);
+  }
+  for (i=0; (i<pre->nb_steps) && (pos < size); i++) {
+    if (pre->candidate[i]) { pos += snprintf(text + pos, size - pos, " %d (%d dBm)\n", pre->range_min + i*pre->step_hz, pre->rssi[i]); }
+  }
+  return pos;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_RSSI_Prescreen_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the RSSI pre-screen.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_RSSI_Prescreen_Test              (SILABS_RSSI_Prescreen *pre, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int threshold_dBm;
+  signed   int above_floor_dB;
+  signed   int settle_ms;
+  signed   int neighbors;
+  signed   int range_min;
+  signed   int range_max;
+  signed   int step_hz;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible RSSI pre-screen test commands:\n\
+status                            : configuration, statistics and candidates of the last sweep\n\
+enable             <0/1>          : enable/disable the pre-screen for the next scans\n\
+config                            : set the thresholds (sub_cmd '<threshold_dBm> <above_floor_dB> <settle_ms> <neighbors>')\n\
+sweep                             : RSSI sweep only (sub_cmd '<min_hz> <max_hz> <step_hz>'), returns the number of candidates\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = pre->candidates;
+    SiLabs_RSSI_Prescreen_Text(pre, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "enable"             ) == 0) {
+    *retdval = SiLabs_RSSI_Prescreen_Config(pre, (signed int)dval, pre->threshold_dBm, pre->above_floor_dB, pre->settle_ms, pre->neighbors);
+    snprintf(*rettxt, 1000, "fe[%d] RSSI pre-screen %s\n", pre->front_end->fe_index, pre->enabled ? "enabled" : "disabled");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "config"             ) == 0) {
+    threshold_dBm  = RSSI_PRESCREEN_THRESHOLD_DBM;
+    above_floor_dB = RSSI_PRESCREEN_ABOVE_FLOOR_DB;
+    settle_ms      = RSSI_PRESCREEN_SETTLE_MS;
+    neighbors      = RSSI_PRESCREEN_NEIGHBORS;
+    sscanf(sub_cmd, "%d %d %d %d", &threshold_dBm, &above_floor_dB, &settle_ms, &neighbors);
+    *retdval = SiLabs_RSSI_Prescreen_Config(pre, pre->enabled, threshold_dBm, above_floor_dB, settle_ms, neighbors);
+    SiLabs_RSSI_Prescreen_Text(pre, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "sweep"              ) == 0) {
+    range_min = 474000000;
+    range_max = 858000000;
+    step_hz   =   8000000;
+    sscanf(sub_cmd, "%d %d %d", &range_min, &range_max, &step_hz);
+    *retdval = SiLabs_RSSI_Prescreen_Sweep(pre, range_min, range_max, step_hz);
+    SiLabs_RSSI_Prescreen_End(pre);
+    SiLabs_RSSI_Prescreen_Text(pre, *rettxt, 1000);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RSSI_PRESCREEN */
@@ -0,0 +1,83 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_RSSI_Prescreen_H_
+#define  _SiLabs_API_L3_Wrapper_RSSI_Prescreen_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[scan/not_blind] Adding an RSSI pre-screen pass via SiLabs_API_L3_Wrapper_RSSI_Prescreen.c/.h
+        A tuner-only RSSI sweep selects the raster steps where the demodulator seek is done.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RSSI_PRESCREEN_MAX_STEPS       512  /* maximum number of raster steps in a pre-screened range            */
+#define RSSI_PRESCREEN_THRESHOLD_DBM   -80  /* Default absolute threshold: steps at or above are always probed    */
+#define RSSI_PRESCREEN_ABOVE_FLOOR_DB    8  /* Default relative threshold above the noise floor (0: not used)     */
+#define RSSI_PRESCREEN_SETTLE_MS         5  /* Default tuner AGC settling time before reading the RSSI            */
+#define RSSI_PRESCREEN_NEIGHBORS         0  /* Default number of steps also probed on each side of a candidate    */
+
+/* Structure used to store the RSSI pre-screen information of one front-end */
+typedef struct _SILABS_RSSI_Prescreen             {
+  SILABS_FE_Context            *front_end;
+  signed   int                  enabled;
+  signed   int                  active;          /* 1 from a successful sweep until the end of the scan           */
+  signed   int                  threshold_dBm;
+  signed   int                  above_floor_dB;
+  signed   int                  settle_ms;
+  signed   int                  neighbors;
+  signed   int                  range_min;       /* first raster step, in Hz                                      */
+  signed   int                  range_max;
+  signed   int                  step_hz;
+  signed   int                  nb_steps;
+  signed   int                  floor_dBm;       /* median RSSI of the sweep                                      */
+  signed   int                  applied_dBm;     /* threshold applied during the last sweep                       */
+  signed   int                  probing;         /* raster step currently probed by the demodulator, -1 if none   */
+  signed   int                  probe_ms;        /* start time of the current L2 seek                             */
+  signed   int                  sweep_ms;
+  signed   int                  seek_ms;         /* time spent in the demodulator seek on the candidates          */
+  signed   int                  candidates;
+  signed   int                  probed;
+  signed   int                  skipped;         /* steps not probed by the demodulator                           */
+  signed   int                  locked;
+  signed   char                 rssi[RSSI_PRESCREEN_MAX_STEPS];
+  unsigned char                 candidate[RSSI_PRESCREEN_MAX_STEPS];
+} SILABS_RSSI_Prescreen;
+
+extern SILABS_RSSI_Prescreen  RSSI_Prescreen_Table[FRONT_END_COUNT];
+
+SILABS_RSSI_Prescreen *SiLabs_RSSI_Prescreen_Of        (SILABS_FE_Context *front_end);
+signed   int   SiLabs_RSSI_Prescreen_Init              (SILABS_RSSI_Prescreen *pre, SILABS_FE_Context *front_end);
+signed   int   SiLabs_RSSI_Prescreen_Config            (SILABS_RSSI_Prescreen *pre, signed   int enabled, signed   int threshold_dBm, signed   int above_floor_dB, signed   int settle_ms, signed   int neighbors);
+signed   int   SiLabs_RSSI_Prescreen_Sweep             (SILABS_RSSI_Prescreen *pre, signed   int range_min, signed   int range_max, signed   int step_hz);
+signed   int   SiLabs_RSSI_Prescreen_Range             (SILABS_RSSI_Prescreen *pre);
+signed   int   SiLabs_RSSI_Prescreen_Result            (SILABS_RSSI_Prescreen *pre, signed   int seek_result);
+signed   int   SiLabs_RSSI_Prescreen_End               (SILABS_RSSI_Prescreen *pre);
+signed   int   SiLabs_RSSI_Prescreen_Text              (SILABS_RSSI_Prescreen *pre, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_RSSI_Prescreen_Test              (SILABS_RSSI_Prescreen *pre, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_RSSI_Prescreen_H_ */
@@ -0,0 +1,437 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Front-End Registry Functions                                  */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains a dynamically sized front-end registry                                        */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ FrontEnd_Table is an application array of FRONT_END_COUNT front-ends (4 by default), and the wrapper finds
+  the index of a front-end by searching this table (i.e. for the indirect tuner i2c connections).
+ Applications controlling many boards in a single process (i.e. 8 boards with 4 to 8 front-ends each) need
+  a number of front-ends only known at run time.
+
+ The front-end registry:
+  - allocates each front-end at run time, in a separate entry containing the front-end context and therefore
+     all its L1/L2 contexts (demodulator, tuners, LNB controller). Front-end pointers remain valid when the
+     registry grows, and there is no compile-time limit to the number of front-ends.
+  - identifies each front-end by a handle. Handles are FE_REGISTRY_HANDLE_BASE + slot, the slot being the index
+     in a table of entry pointers (doubled when full). Retrieving a front-end from its handle is direct.
+  - stores the i2c bus and board of each front-end, to list the front-ends of a bus and/or board.
+
+ Registered front-ends use their registry handle as their default TER/SAT tuner I2C connection (set in SiLabs_API_SW_Init).
+  SiLabs_API_TER_tuner_I2C_connection and SiLabs_API_SAT_tuner_I2C_connection accept the handle of any front-end of the
+  same registry, and the pass-through of this front-end is then found directly, without searching FrontEnd_Table.
+  FrontEnd_Table front-ends are not affected: their I2C connection values are still FrontEnd_Table indexes.
+
+ Registered front-ends are also added to the TER tuners used for VCO blocking (TER_tuners grows with the registry), and
+  removed from these when they are removed from the registry.
+
+ The add-on contexts of a registered front-end (PLP/stream directories, power manager, adaptive lock timeout, ...)
+  are stored in its registry entry. The add-on tables, sized for FrontEnd_Table, are not used for registered front-ends.
+
+ The fe_index of a registered front-end is its slot. It is only used in traces and status exports.
+
+ Use case:
+    SiLabs_FE_Registry_Init (&FE_Registry);
+    for (board=0; board<8; board++) {
+      for (i=0; i<8; i++) {
+        handle    = SiLabs_FE_Registry_Add (&FE_Registry, board/2, board);
+        front_end = SiLabs_FE_Registry_Get (&FE_Registry, handle);
+        SiLabs_API_Frontend_Chip (front_end, 0x2183);
+        SiLabs_API_SW_Init       (front_end, 0xc8 + 2*(i%4), 0xc0 + 2*(i%4), 0x14);
+        ...
+      }
+    }
+    nb = SiLabs_FE_Registry_Group (&FE_Registry, FE_REGISTRY_ANY, 3, handles, 64);   (all front-ends of board 3)
+    ...
+    SiLabs_FE_Registry_Free (&FE_Registry);
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[multi_front_end/registry] Initial version of the front-end registry
+   <improvement>[multi_front_end/registry] Storing the add-on contexts of each registered front-end in its registry entry.
+     With a FrontEnd_Table sized add-on table, registered front-ends FRONT_END_COUNT slots apart were sharing (and re-initializing) the same context.
+   <improvement>[multi_front_end/registry] fe_index is now a signed int, to keep the slot of registered front-ends beyond 255 (it was wrapping at 256).
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   FRONTEND_REGISTRY
+  "If you get a compilation error on this line, it means that you included the Registry code in your project without defining FRONTEND_REGISTRY.";
+  "Please define FRONTEND_REGISTRY at project-level, or remove the Registry code from your project";
+#endif /* FRONTEND_REGISTRY */
+
+#ifdef    FRONTEND_REGISTRY
+
+#include <stdlib.h>
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "Registry  "
+#include "SiLabs_API_L3_Wrapper_Registry.h"
+
+SILABS_FE_Registry  FE_Registry;
+
+/* A front-end is allocated in one block with its add-on contexts (the entry comes first, to be freed as the block) */
+typedef struct _SILABS_FE_Registry_Block          {
+  SILABS_FE_Registry_Entry      entry;
+#ifdef    DISEQC_QUEUE
+  SILABS_DiSEqC_Queue           diseqc_queue;
+#endif /* DISEQC_QUEUE */
+#ifdef    PLP_DIRECTORY
+  SILABS_PLP_Directory          plp_directory;
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  SILABS_Stream_Directory       stream_directory;
+#endif /* STREAM_DIRECTORY */
+#ifdef    POWER_MANAGER
+  SILABS_Power_Manager          power_manager;
+#endif /* POWER_MANAGER */
+#ifdef    RSSI_PRESCREEN
+  SILABS_RSSI_Prescreen         rssi_prescreen;
+#endif /* RSSI_PRESCREEN */
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  SILABS_Lock_Timeout           lock_timeout;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    STATUS_EXPORT
+  SILABS_Status_Export          status_export;
+#endif /* STATUS_EXPORT */
+#ifdef    ADAPTIVE_TS_CLOCK
+  SILABS_TS_Clock               ts_clock;
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  SILABS_Extended_Plan          extended_plan;
+#endif /* EXTENDED_STATUS */
+} SILABS_FE_Registry_Block;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Release function
+  Use:      Front-end release
+            Used before freeing a front-end, to remove its TER tuner from the TER tuners used for VCO blocking
+             and its power manager from the power managers handled by SiLabs_Power_Manager_Process
+************************************************************************************************************************/
+static void         SiLabs_FE_Registry_Release         (SILABS_FE_Registry_Entry *entry) {
+#ifdef    TER_TUNER_SILABS
+  signed   int i;
+  signed   int j;
+  for (i=0; i<TER_Tuner_count; i++) {
+    if ( ((char *)TER_tuners[i] >= (char *)entry) && ((char *)TER_tuners[i] < (char *)(entry + 1)) ) {
+      for (j=i; j<TER_Tuner_count - 1; j++) { TER_tuners[j] = TER_tuners[j+1]; }
+      TER_Tuner_count--;
+      break;
+    }
+  }
+#endif /* TER_TUNER_SILABS */
+#ifdef    POWER_MANAGER
+  SiLabs_Power_Manager_Remove(entry->power_manager);
+#endif /* POWER_MANAGER */
+  entry = entry; /* To avoid compiler warning if not used */
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Init function
+  Use:      Registry initialization
+            Used to start with an empty registry. Any previous content must have been freed with SiLabs_FE_Registry_Free.
+  Returns:  1
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Init            (SILABS_FE_Registry *registry) {
+  memset(registry, 0, sizeof(SILABS_FE_Registry));
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Add function
+  Use:      Front-end registration
+            Used to allocate a new front-end, on the given i2c bus and board.
+            The front-end context is cleared, and must then be configured as any front-end (SiLabs_API_Frontend_Chip,
+             SiLabs_API_SW_Init, ...). The slot of a removed front-end is re-used, otherwise the registry grows if needed.
+  Returns:  the handle of the new front-end, -1 if the allocation failed
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Add             (SILABS_FE_Registry *registry, signed   int bus, signed   int board) {
+  SILABS_FE_Registry_Entry **table;
+  SILABS_FE_Registry_Block  *block;
+  SILABS_FE_Registry_Entry  *entry;
+  signed   int               capacity;
+  signed   int               slot;
+  slot = registry->slots;
+  if (registry->count < registry->slots) {
+    for (slot = 0; slot < registry->slots; slot++) { if (registry->entry[slot] == NULL) { break; } }
+  }
+  if (slot >= registry->capacity) {
+    capacity = registry->capacity * 2;
+    if (capacity < FE_REGISTRY_MIN_CAPACITY) { capacity = FE_REGISTRY_MIN_CAPACITY; }
+    table = (SILABS_FE_Registry_Entry **)realloc(registry->entry, sizeof(SILABS_FE_Registry_Entry *)*capacity);
+    if (table == NULL) {
+      SiERROR("SiLabs_FE_Registry_Add: unable to grow the registry!\n");
+      return -1;
+    }
+    memset(&(table[registry->capacity]), 0, sizeof(SILABS_FE_Registry_Entry *)*(capacity - registry->capacity));
+    registry->entry    = table;
+    registry->capacity = capacity;
+  }
+  block = (SILABS_FE_Registry_Block *)calloc(1, sizeof(SILABS_FE_Registry_Block));
+  if (block == NULL) {
+    SiERROR("SiLabs_FE_Registry_Add: unable to allocate the front-end!\n");
+    return -1;
+  }
+  entry = &(block->entry);
+#ifdef    DISEQC_QUEUE
+  entry->diseqc_queue              = &(block->diseqc_queue);
+#endif /* DISEQC_QUEUE */
+#ifdef    PLP_DIRECTORY
+  entry->plp_directory             = &(block->plp_directory);
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  entry->stream_directory          = &(block->stream_directory);
+#endif /* STREAM_DIRECTORY */
+#ifdef    POWER_MANAGER
+  entry->power_manager             = &(block->power_manager);
+#endif /* POWER_MANAGER */
+#ifdef    RSSI_PRESCREEN
+  entry->rssi_prescreen            = &(block->rssi_prescreen);
+#endif /* RSSI_PRESCREEN */
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  entry->lock_timeout              = &(block->lock_timeout);
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    STATUS_EXPORT
+  entry->status_export             = &(block->status_export);
+#endif /* STATUS_EXPORT */
+#ifdef    ADAPTIVE_TS_CLOCK
+  entry->ts_clock                  = &(block->ts_clock);
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  entry->extended_plan             = &(block->extended_plan);
+#endif /* EXTENDED_STATUS */
+  entry->handle                    = FE_REGISTRY_HANDLE_BASE + slot;
+  entry->bus                       = bus;
+  entry->board                     = board;
+  entry->front_end.registry        = registry;
+  entry->front_end.registry_handle = entry->handle;
+  entry->front_end.fe_index        = slot;
+  registry->entry[slot]            = entry;
+  if (slot == registry->slots) { registry->slots++; }
+  registry->count++;
+  SiTRACE("SiLabs_FE_Registry_Add: front-end 0x%04x on bus %d board %d (%d front-ends)\n", entry->handle, bus, board, registry->count);
+  return entry->handle;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Get function
+  Use:      Front-end retrieval
+            Used to retrieve a front-end from its handle, without any search
+  Returns:  a pointer to the front-end context, NULL if the handle is not valid
+************************************************************************************************************************/
+SILABS_FE_Context  *SiLabs_FE_Registry_Get             (SILABS_FE_Registry *registry, signed   int handle) {
+  signed   int slot;
+  slot = handle - FE_REGISTRY_HANDLE_BASE;
+  if ( (slot < 0) || (slot >= registry->slots) ) { return NULL; }
+  if (registry->entry[slot] == NULL)             { return NULL; }
+  return &(registry->entry[slot]->front_end);
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Handle function
+  Use:      Front-end handle retrieval
+  Returns:  the handle of the front-end, -1 if the front-end is not registered
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Handle          (SILABS_FE_Context  *front_end) {
+  if (front_end->registry == NULL) { return -1; }
+  return front_end->registry_handle;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Bus function
+  Use:      Front-end i2c bus retrieval
+  Returns:  the i2c bus of the front-end, -1 if the front-end is not registered
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Bus             (SILABS_FE_Context  *front_end) {
+  if (front_end->registry == NULL) { return -1; }
+  return ((SILABS_FE_Registry_Entry *)front_end)->bus;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Board function
+  Use:      Front-end board retrieval
+  Returns:  the board of the front-end, -1 if the front-end is not registered
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Board           (SILABS_FE_Context  *front_end) {
+  if (front_end->registry == NULL) { return -1; }
+  return ((SILABS_FE_Registry_Entry *)front_end)->board;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Group function
+  Use:      Front-ends grouping
+            Used to list the handles of all front-ends on a given i2c bus and/or board, in registration order
+  Parameter: bus,   the i2c bus, FE_REGISTRY_ANY for all buses
+  Parameter: board, the board,   FE_REGISTRY_ANY for all boards
+  Parameter: handles, a table to store up to max_handles handles (can be NULL to only count the front-ends)
+  Returns:  the number of matching front-ends (which can be more than max_handles)
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Group           (SILABS_FE_Registry *registry, signed   int bus, signed   int board, signed   int *handles, signed   int max_handles) {
+  SILABS_FE_Registry_Entry *entry;
+  signed   int              slot;
+  signed   int              nb;
+  nb = 0;
+  for (slot = 0; slot < registry->slots; slot++) {
+    entry = registry->entry[slot];
+    if (entry == NULL)                                     { continue; }
+    if ( (bus   != FE_REGISTRY_ANY) && (entry->bus   != bus  ) ) { continue; }
+    if ( (board != FE_REGISTRY_ANY) && (entry->board != board) ) { continue; }
+    if ( (handles != NULL) && (nb < max_handles) ) { handles[nb] = entry->handle; }
+    nb++;
+  }
+  return nb;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Remove function
+  Use:      Front-end removal
+            Used to free a front-end. Its handle becomes invalid, and its slot will be re-used by the next registration.
+            The front-end must not be used anymore, including as the I2C connection of another front-end.
+  Returns:  1 if ok, 0 if the handle is not valid
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Remove          (SILABS_FE_Registry *registry, signed   int handle) {
+  signed   int slot;
+  if (SiLabs_FE_Registry_Get(registry, handle) == NULL) { return 0; }
+  slot = handle - FE_REGISTRY_HANDLE_BASE;
+  SiLabs_FE_Registry_Release(registry->entry[slot]);
+  free(registry->entry[slot]);
+  registry->entry[slot] = NULL;
+  registry->count--;
+  while ( (registry->slots > 0) && (registry->entry[registry->slots - 1] == NULL) ) { registry->slots--; }
+  SiTRACE("SiLabs_FE_Registry_Remove: front-end 0x%04x removed (%d front-ends)\n", handle, registry->count);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Free function
+  Use:      Registry release
+            Used to free all front-ends and the slot table. The registry is then empty, ready for new registrations.
+************************************************************************************************************************/
+void                SiLabs_FE_Registry_Free            (SILABS_FE_Registry *registry) {
+  signed   int slot;
+  for (slot = 0; slot < registry->slots; slot++) {
+    if (registry->entry[slot] == NULL) { continue; }
+    SiLabs_FE_Registry_Release(registry->entry[slot]);
+    free(registry->entry[slot]);
+  }
+  free(registry->entry);
+  SiLabs_FE_Registry_Init(registry);
+}
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Text function
+  Use:      Registry display
+            Used to list the registered front-ends, one line per board
+  Returns:  the number of registered front-ends
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Text            (SILABS_FE_Registry *registry, char *text, signed   int size) {
+  SILABS_FE_Registry_Entry *entry;
+  signed   int              slot;
+  signed   int              first;
+  signed   int              len;
+  snprintf(text, size, "%d front-ends in %d slots (capacity %d)\n", registry->count, registry->slots, registry->capacity);
+  for (first = 0; first < registry->slots; first++) {
+    entry = registry->entry[first];
+    if (entry == NULL) { continue; }
+    /* Each board is listed once, from its first front-end */
+    for (slot = 0; slot < first; slot++) {
+      if ( (registry->entry[slot] != NULL) && (registry->entry[slot]->board == entry->board) ) { break; }
+    }
+    if (slot < first) { continue; }
+    len = (signed int)strlen(text);
+    snprintf(text + len, size - len, " bus %2d board %2d:", entry->bus, entry->board);
+    for (slot = first; slot < registry->slots; slot++) {
+      if ( (registry->entry[slot] == NULL) || (registry->entry[slot]->board != entry->board) ) { continue; }
+      len = (signed int)strlen(text);
+      snprintf(text + len, size - len, " 0x%04x", registry->entry[slot]->handle);
+    }
+    len = (signed int)strlen(text);
+    snprintf(text + len, size - len, "\n");
+  }
+  return registry->count;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_FE_Registry_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the front-end registry.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int        SiLabs_FE_Registry_Test            (SILABS_FE_Registry *registry, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int handles[8];
+  signed   int bus;
+  signed   int board;
+  signed   int nb;
+  signed   int i;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible front-end registry test commands:\n\
+status                            : list the registered front-ends by board\n\
+add                <nb>           : register nb front-ends (sub_cmd '<bus> <board>'), returns the last handle\n\
+remove             <handle>       : remove a front-end\n\
+group                             : list the front-ends of a bus and board (sub_cmd '<bus> <board>', -1 for any)\n\
+free                              : remove all front-ends\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = SiLabs_FE_Registry_Text(registry, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "add"                ) == 0) {
+    bus   = 0;
+    board = 0;
+    sscanf(sub_cmd, "%d %d", &bus, &board);
+    nb    = (signed int)dval;
+    if (nb < 1) { nb = 1; }
+    for (i=0; i<nb; i++) { *retdval = SiLabs_FE_Registry_Add(registry, bus, board); }
+    SiLabs_FE_Registry_Text(registry, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "remove"             ) == 0) {
+    *retdval = SiLabs_FE_Registry_Remove(registry, (signed int)dval);
+    SiLabs_FE_Registry_Text(registry, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "group"              ) == 0) {
+    bus   = FE_REGISTRY_ANY;
+    board = FE_REGISTRY_ANY;
+    sscanf(sub_cmd, "%d %d", &bus, &board);
+    nb = SiLabs_FE_Registry_Group(registry, bus, board, handles, 8);
+    *retdval = nb;
+    snprintf(*rettxt, 1000, "bus %d board %d: %d front-ends", bus, board, nb);
+    for (i=0; (i<nb) && (i<8); i++) { snprintf(*rettxt + strlen(*rettxt), 1000 - strlen(*rettxt), " 0x%04x", handles[i]); }
+    snprintf(*rettxt + strlen(*rettxt), 1000 - strlen(*rettxt), "%s\n", (nb > 8) ? " ..." : "");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "free"               ) == 0) {
+    SiLabs_FE_Registry_Free(registry);
+    SiLabs_FE_Registry_Text(registry, *rettxt, 1000);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* FRONTEND_REGISTRY */
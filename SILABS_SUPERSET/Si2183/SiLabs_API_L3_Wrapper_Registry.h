@@ -0,0 +1,107 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Registry_H_
+#define  _SiLabs_API_L3_Wrapper_Registry_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[multi_front_end/registry] Adding a dynamically sized front-end registry via SiLabs_API_L3_Wrapper_Registry.c/.h
+        Front-ends are allocated at run time, grouped by i2c bus and board, and retrieved from their handle in constant time.
+  <improvement>[multi_front_end/registry] Storing the add-on contexts of each registered front-end in its registry entry,
+        instead of sharing the add-on tables (sized for FrontEnd_Table) between front-ends.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FE_REGISTRY_HANDLE_BASE   0x1000  /* Handles are FE_REGISTRY_HANDLE_BASE + slot. As this is above 100 and above       */
+                                          /*  FRONT_END_COUNT, handles can be used as TER/SAT tuner I2C connection values.    */
+#define FE_REGISTRY_MIN_CAPACITY      16  /* Initial number of slots, doubled each time the registry is full                 */
+#define FE_REGISTRY_ANY               -1  /* Wildcard bus or board value for SiLabs_FE_Registry_Group                        */
+
+/* Structure used to store one registered front-end.                                                   */
+/* Each entry is allocated separately, and holds the front-end context with its own L1/L2 contexts,    */
+/*  such that front-end pointers remain valid when the registry grows.                                 */
+/* It also points to the add-on contexts of the front-end, returned by the SiLabs_xxx_Of functions.   */
+/* (pointers, as the add-on types are not always defined when this file is included)                   */
+typedef struct _SILABS_FE_Registry_Entry          {
+  SILABS_FE_Context             front_end;       /* first member: an entry pointer is also a front-end pointer     */
+  signed   int                  handle;
+  signed   int                  bus;             /* application i2c bus index                                      */
+  signed   int                  board;           /* application board index                                        */
+  /* add-on contexts, allocated with the entry (the add-on tables are only used for FrontEnd_Table) */
+#ifdef    DISEQC_QUEUE
+  struct _SILABS_DiSEqC_Queue      *diseqc_queue;
+#endif /* DISEQC_QUEUE */
+#ifdef    PLP_DIRECTORY
+  struct _SILABS_PLP_Directory     *plp_directory;
+#endif /* PLP_DIRECTORY */
+#ifdef    STREAM_DIRECTORY
+  struct _SILABS_Stream_Directory  *stream_directory;
+#endif /* STREAM_DIRECTORY */
+#ifdef    POWER_MANAGER
+  struct _SILABS_Power_Manager     *power_manager;
+#endif /* POWER_MANAGER */
+#ifdef    RSSI_PRESCREEN
+  struct _SILABS_RSSI_Prescreen    *rssi_prescreen;
+#endif /* RSSI_PRESCREEN */
+#ifdef    ADAPTIVE_LOCK_TIMEOUT
+  struct _SILABS_Lock_Timeout      *lock_timeout;
+#endif /* ADAPTIVE_LOCK_TIMEOUT */
+#ifdef    STATUS_EXPORT
+  struct _SILABS_Status_Export     *status_export;
+#endif /* STATUS_EXPORT */
+#ifdef    ADAPTIVE_TS_CLOCK
+  struct _SILABS_TS_Clock          *ts_clock;
+#endif /* ADAPTIVE_TS_CLOCK */
+#ifdef    EXTENDED_STATUS
+  struct _SILABS_Extended_Plan     *extended_plan;
+#endif /* EXTENDED_STATUS */
+} SILABS_FE_Registry_Entry;
+
+/* Structure used to store the front-end registry */
+typedef struct _SILABS_FE_Registry                {
+  SILABS_FE_Registry_Entry    **entry;           /* one pointer per slot, NULL for unused slots                     */
+  signed   int                  capacity;        /* number of allocated slots                                       */
+  signed   int                  slots;           /* number of slots used so far (including removed front-ends)      */
+  signed   int                  count;           /* number of registered front-ends                                 */
+} SILABS_FE_Registry;
+
+extern SILABS_FE_Registry  FE_Registry;
+
+signed   int        SiLabs_FE_Registry_Init            (SILABS_FE_Registry *registry);
+signed   int        SiLabs_FE_Registry_Add             (SILABS_FE_Registry *registry, signed   int bus, signed   int board);
+SILABS_FE_Context  *SiLabs_FE_Registry_Get             (SILABS_FE_Registry *registry, signed   int handle);
+signed   int        SiLabs_FE_Registry_Handle          (SILABS_FE_Context  *front_end);
+signed   int        SiLabs_FE_Registry_Bus             (SILABS_FE_Context  *front_end);
+signed   int        SiLabs_FE_Registry_Board           (SILABS_FE_Context  *front_end);
+signed   int        SiLabs_FE_Registry_Group           (SILABS_FE_Registry *registry, signed   int bus, signed   int board, signed   int *handles, signed   int max_handles);
+signed   int        SiLabs_FE_Registry_Remove          (SILABS_FE_Registry *registry, signed   int handle);
+void                SiLabs_FE_Registry_Free            (SILABS_FE_Registry *registry);
+signed   int        SiLabs_FE_Registry_Text            (SILABS_FE_Registry *registry, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int        SiLabs_FE_Registry_Test            (SILABS_FE_Registry *registry, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Registry_H_ */
@@ -0,0 +1,378 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Status Board Functions                                        */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains the shared-memory status board, used to share front-end status between processes */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ When several processes (streamer, EPG, SNMP agent, web UI) monitor the same front-ends, each call to
+  SiLabs_API_FE_status generates its own I2C traffic.
+ With the status board:
+  - a single publisher process owns the I2C access. It periodically calls SiLabs_API_FE_status_selection
+     for each front-end and stores the resulting CUSTOM_Status_Struct in a shared memory segment,
+  - any number of client processes map the segment read-only and copy the status from it.
+     Reading is done without any system call and without any I2C access.
+
+ Each front-end entry is protected by a sequence lock: the publisher makes the sequence odd while writing,
+  and clients retry if the sequence is odd or has changed during their copy. Only the memory copy is done
+  with an odd sequence, the I2C status reads are done before.
+
+ The segment is a POSIX shared memory object (shm_open/mmap, link with -lrt on older glibc) when NO_WIN32 is defined,
+  and a named file mapping on Windows.
+ The segment header contains sizeof(CUSTOM_Status_Struct), such that clients built with different
+  flags (i.e. NO_FLOATS_ALLOWED) refuse to open it.
+
+ Clients only need this file, compiled with STATUS_BOARD_CLIENT_ONLY defined.
+
+ Publisher:
+    SiLabs_Status_Board_Create  ( board, STATUS_BOARD_DEFAULT_NAME, 4, 500);
+    while (running) { SiLabs_Status_Board_Process ( board); (other application tasks) }
+   (SiLabs_Status_Board_Publish can also be called from the application's interrupt handling)
+ Client:
+    SiLabs_Status_Board_Open    ( board, STATUS_BOARD_DEFAULT_NAME);
+    SiLabs_Status_Board_Read    ( board, fe_index, &status, &timestamp_ms);
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[Status/Multi_process] Initial version of the shared-memory status board
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   STATUS_BOARD
+  "If you get a compilation error on this line, it means that you included the Status_Board code in your project without defining STATUS_BOARD.";
+  "Please define STATUS_BOARD at project-level, or remove the Status_Board code from your project";
+#endif /* STATUS_BOARD */
+
+#ifdef    STATUS_BOARD
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "St_Board "
+#include "SiLabs_API_L3_Wrapper_Status_Board.h"
+
+#ifdef    NO_WIN32
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif /* NO_WIN32 */
+
+SILABS_Status_Board  Status_Board_Context;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Status_Board_Map function
+  Use:      Shared memory segment creation (owner = 1) or opening (owner = 0) and mapping
+  Returns:  1 if mapped, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Map                 (SILABS_Status_Board *board, const char *name, signed   int owner) {
+  snprintf(board->name, STATUS_BOARD_NAME_SIZE, "%s", name);
+  board->owner      = owner;
+  board->segment    = NULL;
+  board->contention = 0;
+#ifdef    NO_WIN32
+  if (owner) {
+    board->fd = shm_open(board->name, O_CREAT | O_RDWR, 0644);
+  } else {
+    board->fd = shm_open(board->name, O_RDONLY, 0);
+  }
+  if (board->fd < 0) {
+    SiTRACE("Status board: shm_open('%s') failed\n", board->name);
+    return 0;
+  }
+  if (owner) {
+    if (ftruncate(board->fd, sizeof(SILABS_Status_Board_Segment)) != 0) {
+      SiERROR("Status board: ftruncate failed\n");
+      close(board->fd); board->fd = -1;
+      return 0;
+    }
+    board->segment = (SILABS_Status_Board_Segment*)mmap(NULL, sizeof(SILABS_Status_Board_Segment), PROT_READ | PROT_WRITE, MAP_SHARED, board->fd, 0);
+  } else {
+    board->segment = (SILABS_Status_Board_Segment*)mmap(NULL, sizeof(SILABS_Status_Board_Segment), PROT_READ             , MAP_SHARED, board->fd, 0);
+  }
+  if (board->segment == (SILABS_Status_Board_Segment*)MAP_FAILED) {
+    SiERROR("Status board: mmap failed\n");
+    board->segment = NULL;
+    close(board->fd); board->fd = -1;
+    return 0;
+  }
+#else  /* NO_WIN32 */
+  if (owner) {
+    board->handle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(SILABS_Status_Board_Segment), board->name);
+  } else {
+    board->handle = OpenFileMappingA  (FILE_MAP_READ, FALSE, board->name);
+  }
+  if (board->handle == NULL) {
+    SiTRACE("Status board: file mapping '%s' failed\n", board->name);
+    return 0;
+  }
+  board->segment = (SILABS_Status_Board_Segment*)MapViewOfFile(board->handle, owner ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, sizeof(SILABS_Status_Board_Segment));
+  if (board->segment == NULL) {
+    SiERROR("Status board: MapViewOfFile failed\n");
+    CloseHandle(board->handle); board->handle = NULL;
+    return 0;
+  }
+#endif /* NO_WIN32 */
+  return 1;
+}
+#ifndef   STATUS_BOARD_CLIENT_ONLY
+/************************************************************************************************************************
+  SiLabs_Status_Board_Create function
+  Use:      Status board creation, in the publisher process
+  Parameter: name, the shared memory object name (i.e. STATUS_BOARD_DEFAULT_NAME)
+  Parameter: entry_count, the number of front-ends to publish (FrontEnd_Table[0] to FrontEnd_Table[entry_count-1])
+  Parameter: period_ms, the publication period used by SiLabs_Status_Board_Process
+  Returns:  1 if created, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Create              (SILABS_Status_Board *board, const char *name, signed   int entry_count, signed   int period_ms) {
+  signed   int i;
+  if (entry_count > FRONT_END_COUNT) { entry_count = FRONT_END_COUNT; }
+  if (SiLabs_Status_Board_Map(board, name, 1) == 0) { return 0; }
+  memset(board->segment, 0, sizeof(SILABS_Status_Board_Segment));
+  board->segment->version     = STATUS_BOARD_VERSION;
+  board->segment->status_size = sizeof(CUSTOM_Status_Struct);
+  board->segment->entry_count = entry_count;
+  board->segment->period_ms   = period_ms;
+  for (i=0; i<entry_count; i++) { board->segment->entry[i].sequence = 0; }
+  STATUS_BOARD_BARRIER();
+  /* The magic value is written last, such that clients can't use a partially initialized segment */
+  board->segment->magic       = STATUS_BOARD_MAGIC;
+  board->status_selection     = 0x00;
+  board->last_publish_ms      = system_time() - period_ms;
+  SiTRACE("Status board '%s' created for %d front-ends, period %d ms\n", board->name, entry_count, period_ms);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Board_Publish function
+  Use:      Reads the status of a front-end and publishes it in its status board entry
+            The I2C status reads are done first, then the status is copied while the sequence is odd.
+  Returns:  1 if published, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Publish             (SILABS_Status_Board *board, SILABS_FE_Context *front_end) {
+  SILABS_Status_Board_Entry *entry;
+  CUSTOM_Status_Struct       status;
+  signed   int               timestamp_ms;
+  if (board->segment == NULL || board->owner == 0) { return 0; }
+  if ( (front_end->fe_index < 0) | (front_end->fe_index >= (signed int)board->segment->entry_count) ) { return 0; }
+  entry = &(board->segment->entry[front_end->fe_index]);
+  memset(&status, 0, sizeof(CUSTOM_Status_Struct));
+  SiLabs_API_FE_status_selection(front_end, &status, board->status_selection);
+  timestamp_ms = system_time();
+
+  entry->sequence++;
+  STATUS_BOARD_BARRIER();
+  memcpy(&(entry->status), &status, sizeof(CUSTOM_Status_Struct));
+  entry->timestamp_ms     = timestamp_ms;
+  entry->status_selection = board->status_selection;
+  entry->valid            = 1;
+  entry->publish_count++;
+  STATUS_BOARD_BARRIER();
+  entry->sequence++;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Board_Process function
+  Use:      Publisher periodic function
+            Publishes the status of all initialized front-ends once per period.
+  Returns:  the number of front-ends published during this call
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Process             (SILABS_Status_Board *board) {
+  signed   int i;
+  signed   int published;
+  if (board->segment == NULL || board->owner == 0) { return 0; }
+  if (system_time() - board->last_publish_ms < board->segment->period_ms) { return 0; }
+  board->last_publish_ms = system_time();
+  published = 0;
+  for (i=0; i<(signed int)board->segment->entry_count; i++) {
+    if (FrontEnd_Table[i].init_ok) { published = published + SiLabs_Status_Board_Publish(board, &(FrontEnd_Table[i])); }
+  }
+  board->segment->heartbeat++;
+  return published;
+}
+#endif /* STATUS_BOARD_CLIENT_ONLY */
+/************************************************************************************************************************
+  SiLabs_Status_Board_Open function
+  Use:      Status board opening, in a client process
+            The segment is mapped read-only. Its layout is checked against the client's build.
+  Returns:  1 if opened, 0 otherwise (publisher not started or incompatible segment)
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Open                (SILABS_Status_Board *board, const char *name) {
+  if (SiLabs_Status_Board_Map(board, name, 0) == 0) { return 0; }
+  if ( (board->segment->magic       != STATUS_BOARD_MAGIC          )
+     | (board->segment->version     != STATUS_BOARD_VERSION        )
+     | (board->segment->status_size != sizeof(CUSTOM_Status_Struct)) ) {
+    SiTRACE("Status board '%s' is not compatible (magic 0x%08x, version %d, status_size %d/%d)\n", board->name
+           , board->segment->magic, board->segment->version, board->segment->status_size, (signed int)sizeof(CUSTOM_Status_Struct));
+    SiERROR("Status board not compatible\n");
+    SiLabs_Status_Board_Close(board);
+    return 0;
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Board_Read function
+  Use:      Copies the last published status of a front-end
+            No system call and no I2C access. Retries while the publisher is writing the same entry.
+  Parameter: fe_index, the front-end index
+  Parameter: status, a pointer to the CUSTOM_Status_Struct to fill
+  Parameter: timestamp_ms, a pointer to store the publisher time of the status (can be NULL)
+  Returns:  1 if a status is available, 0 if not published yet, -1 if not available (contention or wrong index)
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Read                (SILABS_Status_Board *board, signed   int fe_index, CUSTOM_Status_Struct *status, signed   int *timestamp_ms) {
+  SILABS_Status_Board_Entry *entry;
+  unsigned int               sequence;
+  signed   int               valid;
+  signed   int               timestamp;
+  signed   int               retry;
+  if (board->segment == NULL) { return -1; }
+  if ( (fe_index < 0) | (fe_index >= (signed int)board->segment->entry_count) ) { return -1; }
+  entry = &(board->segment->entry[fe_index]);
+  for (retry=0; retry<STATUS_BOARD_READ_RETRIES; retry++) {
+    sequence = entry->sequence;
+    STATUS_BOARD_BARRIER();
+    if (sequence & 0x01) { board->contention++; continue; }
+    memcpy(status, (const void*)&(entry->status), sizeof(CUSTOM_Status_Struct));
+    timestamp = entry->timestamp_ms;
+    valid     = entry->valid;
+    STATUS_BOARD_BARRIER();
+    if (entry->sequence == sequence) {
+      if (timestamp_ms != NULL) { *timestamp_ms = timestamp; }
+      return valid;
+    }
+    board->contention++;
+  }
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Board_Close function
+  Use:      Unmaps the segment. The publisher also removes the shared memory object.
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Close               (SILABS_Status_Board *board) {
+  if (board->segment == NULL) { return 1; }
+#ifdef    NO_WIN32
+  munmap((void*)board->segment, sizeof(SILABS_Status_Board_Segment));
+  close(board->fd);
+  if (board->owner) { shm_unlink(board->name); }
+  board->fd = -1;
+#else  /* NO_WIN32 */
+  UnmapViewOfFile((void*)board->segment);
+  CloseHandle(board->handle);
+  board->handle = NULL;
+#endif /* NO_WIN32 */
+  board->segment = NULL;
+  board->owner   = 0;
+  return 1;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Status_Board_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the status board.
+              'bench <n>' measures the time of n client reads.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Board_Test                (SILABS_Status_Board *board, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  CUSTOM_Status_Struct status;
+  signed   int         timestamp_ms;
+  signed   int         start_ms;
+  signed   int         i;
+  signed   int         n;
+  const char          *name;
+  target   = target;   /* To avoid compiler warning if not used */
+  front_end= front_end;/* To avoid compiler warning if not used */
+  name     = (strlen(sub_cmd) > 0) ? sub_cmd : STATUS_BOARD_DEFAULT_NAME;
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible status board test commands:\n\
+create             <period_ms>    : create the board (name in sub_cmd, default %s)\n\
+open                              : open the board as a client (name in sub_cmd)\n\
+close\n\
+publish                           : publish the current front-end status\n\
+process                           : publish all front-ends if the period is elapsed\n\
+read               <fe_index>\n\
+bench              <nb_reads>     : measure the client read time\n\
+", STATUS_BOARD_DEFAULT_NAME); return 1;
+  }
+#ifndef   STATUS_BOARD_CLIENT_ONLY
+  else if (strcmp_nocase(cmd, "create"             ) == 0) {
+    n = (signed int)dval;
+    if (n <= 0) { n = STATUS_BOARD_PERIOD_MS; }
+    *retdval = SiLabs_Status_Board_Create(board, name, FRONT_END_COUNT, n);
+    snprintf(*rettxt, 1000, "status board '%s' %s\n", name, *retdval ? "created" : "creation failed");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "publish"            ) == 0) {
+    *retdval = SiLabs_Status_Board_Publish(board, front_end);
+    snprintf(*rettxt, 1000, "front-end %d status %s\n", front_end->fe_index, *retdval ? "published" : "not published");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "process"            ) == 0) {
+    *retdval = SiLabs_Status_Board_Process(board);
+    snprintf(*rettxt, 1000, "%d front-ends published\n", (signed int)*retdval);
+    return 1;
+  }
+#endif /* STATUS_BOARD_CLIENT_ONLY */
+  else if (strcmp_nocase(cmd, "open"               ) == 0) {
+    *retdval = SiLabs_Status_Board_Open(board, name);
+    snprintf(*rettxt, 1000, "status board '%s' %s\n", name, *retdval ? "opened" : "not available");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "close"              ) == 0) {
+    *retdval = SiLabs_Status_Board_Close(board);
+    snprintf(*rettxt, 1000, "status board closed\n");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "read"               ) == 0) {
+    *retdval = SiLabs_Status_Board_Read(board, (signed int)dval, &status, &timestamp_ms);
+    if (*retdval == 1) {
+      snprintf(*rettxt, 1000, "fe %d (%d ms old): %s demod_lock %d fec_lock %d c_n_100 %d RSSI %ld uncorrs %d\n", (signed int)dval, system_time() - timestamp_ms
+             , Silabs_Standard_Text(status.standard), status.demod_lock, status.fec_lock, status.c_n_100, status.RSSI, status.uncorrs);
+    } else {
+      snprintf(*rettxt, 1000, "fe %d status not available (%d)\n", (signed int)dval, (signed int)*retdval);
+    }
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "bench"              ) == 0) {
+    n = (signed int)dval;
+    if (n <= 0) { n = 1000000; }
+    start_ms = system_time();
+    for (i=0; i<n; i++) { SiLabs_Status_Board_Read(board, i%FRONT_END_COUNT, &status, &timestamp_ms); }
+    *retdval = system_time() - start_ms;
+    snprintf(*rettxt, 1000, "%d reads in %d ms (%d seqlock retries)\n", n, (signed int)*retdval, board->contention);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* STATUS_BOARD */
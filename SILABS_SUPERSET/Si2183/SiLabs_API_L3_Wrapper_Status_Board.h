@@ -0,0 +1,99 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Status_Board_H_
+#define  _SiLabs_API_L3_Wrapper_Status_Board_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[Status/Multi_process] Adding a shared-memory status board via SiLabs_API_L3_Wrapper_Status_Board.c/.h
+        One publisher process reads the front-end status over I2C, any number of client processes read it from shared memory.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_BOARD_MAGIC          0x53694C42  /* 'SiLB' */
+#define STATUS_BOARD_VERSION                 1
+#define STATUS_BOARD_NAME_SIZE              64
+#define STATUS_BOARD_DEFAULT_NAME  "/silabs_fe_status"
+#define STATUS_BOARD_PERIOD_MS             500  /* Default publication period                             */
+#define STATUS_BOARD_READ_RETRIES          100  /* Maximum seqlock read attempts before reporting contention */
+
+#ifdef    NO_WIN32
+  #define STATUS_BOARD_BARRIER()  __sync_synchronize()
+#else  /* NO_WIN32 */
+  #define STATUS_BOARD_BARRIER()  MemoryBarrier()
+#endif /* NO_WIN32 */
+
+/* Structure used to store the status of one front-end in shared memory */
+typedef struct _SILABS_Status_Board_Entry         {
+  volatile unsigned int         sequence;        /* seqlock: odd while the publisher is writing             */
+  unsigned int                  publish_count;
+  signed   int                  timestamp_ms;    /* publisher system_time() when the status was read         */
+  signed   int                  valid;           /* 0 until the first publication                            */
+  signed   int                  status_selection;
+  CUSTOM_Status_Struct          status;
+} SILABS_Status_Board_Entry;
+
+/* Structure used to store the shared memory segment layout */
+typedef struct _SILABS_Status_Board_Segment       {
+  unsigned int                  magic;
+  unsigned int                  version;
+  unsigned int                  status_size;     /* sizeof(CUSTOM_Status_Struct), to detect incompatible builds */
+  unsigned int                  entry_count;
+  volatile unsigned int         heartbeat;       /* incremented at each publisher cycle                       */
+  signed   int                  period_ms;
+  SILABS_Status_Board_Entry     entry[FRONT_END_COUNT];
+} SILABS_Status_Board_Segment;
+
+/* Structure used to store the status board handle, in the publisher or in a client */
+typedef struct _SILABS_Status_Board               {
+  SILABS_Status_Board_Segment  *segment;
+  char                          name[STATUS_BOARD_NAME_SIZE];
+  signed   int                  owner;           /* 1 in the publisher, 0 in clients */
+#ifdef    NO_WIN32
+  signed   int                  fd;
+#else  /* NO_WIN32 */
+  void                         *handle;
+#endif /* NO_WIN32 */
+  signed   int                  last_publish_ms;
+  unsigned char                 status_selection;
+  unsigned int                  contention;      /* number of seqlock read retries */
+} SILABS_Status_Board;
+
+extern SILABS_Status_Board  Status_Board_Context;
+
+#ifndef   STATUS_BOARD_CLIENT_ONLY
+signed   int   SiLabs_Status_Board_Create              (SILABS_Status_Board *board, const char *name, signed   int entry_count, signed   int period_ms);
+signed   int   SiLabs_Status_Board_Publish             (SILABS_Status_Board *board, SILABS_FE_Context *front_end);
+signed   int   SiLabs_Status_Board_Process             (SILABS_Status_Board *board);
+#endif /* STATUS_BOARD_CLIENT_ONLY */
+signed   int   SiLabs_Status_Board_Open                (SILABS_Status_Board *board, const char *name);
+signed   int   SiLabs_Status_Board_Read                (SILABS_Status_Board *board, signed   int fe_index, CUSTOM_Status_Struct *status, signed   int *timestamp_ms);
+signed   int   SiLabs_Status_Board_Close               (SILABS_Status_Board *board);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Status_Board_Test                (SILABS_Status_Board *board, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Status_Board_H_ */
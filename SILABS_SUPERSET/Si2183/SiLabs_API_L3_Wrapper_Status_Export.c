@@ -0,0 +1,540 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Binary Status Export Functions                                */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code serializes the front-end status in a compact binary format                             */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_Text_status_selection, SiLabs_API_TER_Tuner_Text_status and the Infos functions build their text
+  using STRING_APPEND_SAFE, which calls strlen on the complete text for each item. The cost of building the
+  text therefore grows with the square of its length, and applications polling many front-ends then need
+  to parse the text back to get the values.
+
+ With STATUS_EXPORT, SiLabs_Status_Export writes the CUSTOM_Status_Struct fields (including the tuner status
+  fields) in a caller buffer, as TLV records, without any text formatting:
+    header : 'S' 'X' version status_selection fe_index standard payload_length (2 bytes, little endian)
+             (fe_index is limited to its 8 LSBs)
+    records: tag (1 byte) length (1, 2 or 4) value (signed, little endian)
+
+ Only the fields refreshed by the status_selection flags and used in the current standard are written.
+ The tag of a field is its index in Status_Export_Fields + 1. New fields are only added at the end of
+  the table, such that a tag never changes meaning. Readers skip the tags they don't know, using the length.
+
+ SiLabs_Status_Export_Parse fills a CUSTOM_Status_Struct from an export, and SiLabs_Status_Export_Print
+  renders an export as 'name value' lines, in a single pass over the records.
+
+ Use case:
+    unsigned char buffer[STATUS_EXPORT_MAX_SIZE];
+    SiLabs_API_FE_status_selection (front_end, &status, FE_LOCK_STATE | FE_LEVELS);
+    length = SiLabs_Status_Export  (front_end, &status, FE_LOCK_STATE | FE_LEVELS, buffer, sizeof(buffer));
+    ...                                                  (buffer sent to the monitoring application)
+    SiLabs_Status_Export_Parse     (buffer, length, &status);                   (on the monitoring side)
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[Status/Export] Initial version of the binary status export
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   STATUS_EXPORT
+  "If you get a compilation error on this line, it means that you included the Status_Export code in your project without defining STATUS_EXPORT.";
+  "Please define STATUS_EXPORT at project-level, or remove the Status_Export code from your project";
+#endif /* STATUS_EXPORT */
+
+#ifdef    STATUS_EXPORT
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "StatusExp "
+#include "SiLabs_API_L3_Wrapper_Status_Export.h"
+#include <stddef.h>
+
+#define STATUS_STD(standard)  (1<<(standard))
+#define STATUS_T              STATUS_STD(SILABS_DVB_T )
+#define STATUS_T2             STATUS_STD(SILABS_DVB_T2)
+#define STATUS_ISDBT          STATUS_STD(SILABS_ISDB_T)
+#define STATUS_C              STATUS_STD(SILABS_DVB_C )
+#define STATUS_C2             STATUS_STD(SILABS_DVB_C2)
+#define STATUS_MCNS           STATUS_STD(SILABS_MCNS  )
+#define STATUS_S              STATUS_STD(SILABS_DVB_S )
+#define STATUS_S2             STATUS_STD(SILABS_DVB_S2)
+#define STATUS_DSS            STATUS_STD(SILABS_DSS   )
+#define STATUS_ATV            STATUS_STD(SILABS_ANALOG)
+#define STATUS_SAT            (STATUS_S | STATUS_S2 | STATUS_DSS)
+#define STATUS_DTV            (STATUS_T | STATUS_T2 | STATUS_ISDBT | STATUS_C | STATUS_C2 | STATUS_MCNS | STATUS_SAT)
+#define STATUS_TER            (STATUS_T | STATUS_T2 | STATUS_ISDBT | STATUS_C | STATUS_C2 | STATUS_MCNS | STATUS_ATV)
+#define STATUS_FIELD(field, type, selection, standards, text)  { #field, (unsigned short)offsetof(CUSTOM_Status_Struct, field), type, selection, standards, text }
+
+/* Exported fields. The tag of a field is its index + 1: only add new fields at the end of the table! */
+static const SILABS_Status_Export_Field Status_Export_Fields[] = {
+  STATUS_FIELD(demod_lock        , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fec_lock          , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(uncorrs           , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(TS_bitrate_kHz    , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(TS_clock_kHz      , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(demod_die         , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(clock_mode        , STATUS_EXPORT_INT  , FE_LOCK_STATE, STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(RSSI              , STATUS_EXPORT_LONG , FE_LEVELS    , 0           , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(RFagc             , STATUS_EXPORT_INT  , FE_LEVELS    , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(IFagc             , STATUS_EXPORT_INT  , FE_LEVELS    , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(rssi              , STATUS_EXPORT_CHAR , FE_LEVELS    , 0           , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(tc                , STATUS_EXPORT_UCHAR, FE_LEVELS    , STATUS_TER  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(mode              , STATUS_EXPORT_UCHAR, FE_LEVELS    , STATUS_TER  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(freq              , STATUS_EXPORT_ULONG, FE_FREQ      , 0           , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(vco_code          , STATUS_EXPORT_INT  , FE_FREQ      , STATUS_TER  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_mant          , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_exp           , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(per_mant          , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(per_exp           , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fer_mant          , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fer_exp           , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_window        , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_count         , STATUS_EXPORT_INT  , FE_RATES     , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(SSI               , STATUS_EXPORT_INT  , FE_QUALITY   , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(SQI               , STATUS_EXPORT_INT  , FE_QUALITY   , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(bandwidth_Hz      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(symbol_rate       , STATUS_EXPORT_UINT , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(stream            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(constellation     , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_CONSTEL ),
+  STATUS_FIELD(c_n_100           , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(freq_offset       , STATUS_EXPORT_LONG , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(timing_offset     , STATUS_EXPORT_LONG , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(code_rate         , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(spectral_inversion, STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_DTV  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fft_mode          , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T | STATUS_T2 | STATUS_ISDBT            , STATUS_EXPORT_TEXT_FFT     ),
+  STATUS_FIELD(guard_interval    , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T | STATUS_T2 | STATUS_ISDBT | STATUS_C2, STATUS_EXPORT_TEXT_GI      ),
+  STATUS_FIELD(cell_id           , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T | STATUS_T2 | STATUS_C2               , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(code_rate_hp      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T    , STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(code_rate_lp      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T    , STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(hierarchy         , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T    , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(rotated           , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(pilot_pattern     , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(bw_ext            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(t2_version        , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(t2_base_lite      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(t2_system_id      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fef               , STATUS_EXPORT_UCHAR, FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(tx_mode           , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(short_frame       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(num_plp           , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2 | STATUS_C2, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(plp_id            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_T2 | STATUS_C2, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(c2_system_id      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_C2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(c2_start_freq_hz  , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_C2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(c2_system_bw_hz   , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_C2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(num_data_slice    , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_C2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ds_id             , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_C2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(roll_off          , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_SAT  , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(pilots            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(s2x               , STATUS_EXPORT_UINT , FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(num_is            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(isi_id            , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ccm_vcm           , STATUS_EXPORT_UCHAR, FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(sis_mis           , STATUS_EXPORT_UCHAR, FE_SPECIFIC  , STATUS_S2   , STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(isdbt_system_id   , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(partial_flag      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(emergency_flag    , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(nb_seg_a          , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fec_lock_a        , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(constellation_a   , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CONSTEL ),
+  STATUS_FIELD(code_rate_a       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(il_a              , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(uncorrs_a         , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_window_a      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_count_a       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(nb_seg_b          , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fec_lock_b        , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(constellation_b   , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CONSTEL ),
+  STATUS_FIELD(code_rate_b       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(il_b              , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(uncorrs_b         , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_window_b      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_count_b       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(nb_seg_c          , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(fec_lock_c        , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(constellation_c   , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CONSTEL ),
+  STATUS_FIELD(code_rate_c       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_CODERATE),
+  STATUS_FIELD(il_c              , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(uncorrs_c         , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_window_c      , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    ),
+  STATUS_FIELD(ber_count_c       , STATUS_EXPORT_INT  , FE_SPECIFIC  , STATUS_ISDBT, STATUS_EXPORT_TEXT_NONE    )
+};
+#define STATUS_EXPORT_FIELDS  ((signed int)(sizeof(Status_Export_Fields)/sizeof(SILABS_Status_Export_Field)))
+
+SILABS_Status_Export  Status_Export_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Status_Export_Of function
+  Use:      Status export retrieval
+            Returns the status export of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the status export
+************************************************************************************************************************/
+SILABS_Status_Export *SiLabs_Status_Export_Of          (SILABS_FE_Context *front_end) {
+  SILABS_Status_Export *exp;
+  exp = &(Status_Export_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { exp = ((SILABS_FE_Registry_Entry *)front_end)->status_export; }
+#endif /* FRONTEND_REGISTRY */
+  if (exp->front_end != front_end) { SiLabs_Status_Export_Init(exp, front_end); }
+  return exp;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Init function
+  Use:      Status export initialization
+  Parameter: exp, a pointer to the status export
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Init               (SILABS_Status_Export *exp, SILABS_FE_Context *front_end) {
+  memset(exp, 0, sizeof(SILABS_Status_Export));
+  exp->front_end = front_end;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Field function
+  Use:      Exported field description retrieval
+  Parameter: tag, the record tag
+  Returns:  a pointer to the field description, NULL for tags unknown in this version
+************************************************************************************************************************/
+const SILABS_Status_Export_Field *SiLabs_Status_Export_Field (signed   int tag) {
+  if ( (tag < 1) || (tag > STATUS_EXPORT_FIELDS) ) { return NULL; }
+  return &(Status_Export_Fields[tag - 1]);
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export function
+  Use:      Binary status export
+            Writes the fields refreshed by status_selection in the current standard as TLV records.
+            Each value is written on the smallest length (1, 2 or 4 bytes) able to hold it.
+  Parameter: front_end, a pointer to the SILABS_FE_Context (for the fe_index)
+  Parameter: status, a pointer to the status structure, as filled by SiLabs_API_FE_status_selection
+  Parameter: status_selection, the flags used to refresh the status. Use 0x00 for 'all'.
+  Parameter: buffer, the buffer to store the export
+  Parameter: size, the buffer size (STATUS_EXPORT_MAX_SIZE is enough for all standards)
+  Returns:  the export length, -1 if the buffer is too small
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export                    (SILABS_FE_Context *front_end, CUSTOM_Status_Struct *status, unsigned char status_selection, unsigned char *buffer, signed   int size) {
+  const SILABS_Status_Export_Field *field;
+  const unsigned char *p;
+  unsigned long value;
+  signed   long svalue;
+  signed   int  standards;
+  signed   int  length;
+  signed   int  pos;
+  signed   int  i;
+  if (size < STATUS_EXPORT_HEADER_SIZE) { return -1; }
+  if (status_selection == 0x00) { status_selection = FE_LOCK_STATE + FE_LEVELS + FE_RATES + FE_SPECIFIC + FE_QUALITY + FE_FREQ; }
+  standards = 0;
+  if ( (status->standard >= 0) && (status->standard < 16) ) { standards = STATUS_STD(status->standard); }
+  buffer[0] = STATUS_EXPORT_MAGIC_0;
+  buffer[1] = STATUS_EXPORT_MAGIC_1;
+  buffer[2] = STATUS_EXPORT_VERSION;
+  buffer[3] = status_selection;
+  buffer[4] = (unsigned char)(front_end->fe_index & 0xff);
+  buffer[5] = (unsigned char)status->standard;
+  pos = STATUS_EXPORT_HEADER_SIZE;
+  /* In SLEEP mode (or with an unknown standard), only the header is written */
+  for (i=0; (i<STATUS_EXPORT_FIELDS) && (standards); i++) {
+    field = &(Status_Export_Fields[i]);
+    if ( (field->selection & status_selection) == 0          ) { continue; }
+    if ( (field->standards) && ((field->standards & standards) == 0) ) { continue; }
+    p = (const unsigned char*)status + field->offset;
+    switch (field->type) {
+      case STATUS_EXPORT_UINT : { svalue = (signed long)*((const unsigned int  *)p); break; }
+      case STATUS_EXPORT_LONG : { svalue =              *((const signed   long *)p); break; }
+      case STATUS_EXPORT_ULONG: { svalue = (signed long)*((const unsigned long *)p); break; }
+      case STATUS_EXPORT_CHAR : { svalue =              *((const signed   char *)p); break; }
+      case STATUS_EXPORT_UCHAR: { svalue =              *((const unsigned char *)p); break; }
+      default                 : { svalue =              *((const signed   int  *)p); break; }
+    }
+         if ( (svalue >=   -128) && (svalue <=   127) ) { length = 1; }
+    else if ( (svalue >= -32768) && (svalue <= 32767) ) { length = 2; }
+    else                                                { length = 4; }
+    if (pos + 2 + length > size) { SiERROR("SiLabs_Status_Export: buffer too small\n"); return -1; }
+    buffer[pos++] = (unsigned char)(i + 1);
+    buffer[pos++] = (unsigned char)length;
+    value = (unsigned long)svalue;
+    buffer[pos++] = (unsigned char)(value      );
+    if (length > 1) {
+      buffer[pos++] = (unsigned char)(value >>  8);
+    }
+    if (length > 2) {
+      buffer[pos++] = (unsigned char)(value >> 16);
+      buffer[pos++] = (unsigned char)(value >> 24);
+    }
+  }
+  buffer[6] = (unsigned char)((pos - STATUS_EXPORT_HEADER_SIZE)     );
+  buffer[7] = (unsigned char)((pos - STATUS_EXPORT_HEADER_SIZE) >> 8);
+  return pos;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Read function
+  Use:      Front-end status read and export
+            Reads the front-end status with SiLabs_API_FE_status_selection and stores its export in exp->buffer.
+  Parameter: exp, a pointer to the status export
+  Parameter: status_selection, the flags used to refresh the status. Use 0x00 for 'all'.
+  Returns:  the export length, -1 in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Read               (SILABS_Status_Export *exp, unsigned char status_selection) {
+  CUSTOM_Status_Struct status;
+  memset(&status, 0, sizeof(CUSTOM_Status_Struct));
+  status.standard = exp->front_end->standard;
+  SiLabs_API_FE_status_selection(exp->front_end, &status, status_selection);
+  exp->length = SiLabs_Status_Export(exp->front_end, &status, status_selection, exp->buffer, STATUS_EXPORT_MAX_SIZE);
+  if (exp->length > 0) {
+    exp->exports++;
+    exp->bytes = exp->bytes + exp->length;
+  }
+  return exp->length;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Check function
+  Use:      Status export header check
+  Parameter: buffer, the export
+  Parameter: length, the export length
+  Returns:  the payload length, -1 if the header is invalid or if the export is truncated
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Check              (const unsigned char *buffer, signed   int length) {
+  signed   int payload;
+  if (length < STATUS_EXPORT_HEADER_SIZE                                                 ) { return -1; }
+  if ( (buffer[0] != STATUS_EXPORT_MAGIC_0) || (buffer[1] != STATUS_EXPORT_MAGIC_1)       ) { return -1; }
+  if (buffer[2] != STATUS_EXPORT_VERSION                                                  ) { return -1; }
+  payload = buffer[6] + (buffer[7]<<8);
+  if (STATUS_EXPORT_HEADER_SIZE + payload > length                                        ) { return -1; }
+  return payload;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Parse function
+  Use:      Status export parsing
+            Fills the status fields present in the export. The other fields are not changed.
+            Records with tags unknown in this version are skipped.
+  Parameter: buffer, the export
+  Parameter: length, the export length
+  Parameter: status, a pointer to the status structure to fill
+  Returns:  the number of fields filled, -1 if the export is invalid
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Parse              (const unsigned char *buffer, signed   int length, CUSTOM_Status_Struct *status) {
+  const SILABS_Status_Export_Field *field;
+  unsigned char *p;
+  signed   long value;
+  signed   int  end;
+  signed   int  pos;
+  signed   int  size;
+  signed   int  nb;
+  end = SiLabs_Status_Export_Check(buffer, length);
+  if (end < 0) { return -1; }
+  end = end + STATUS_EXPORT_HEADER_SIZE;
+  status->standard = (CUSTOM_Standard_Enum)buffer[5];
+  nb  = 0;
+  pos = STATUS_EXPORT_HEADER_SIZE;
+  while (pos + 2 <= end) {
+    field = SiLabs_Status_Export_Field(buffer[pos]);
+    size  = buffer[pos + 1];
+    pos   = pos + 2;
+    if (pos + size > end) { return -1; }
+    switch (size) {
+      case 1 : { value = (signed char )  buffer[pos];                                                             break; }
+      case 2 : { value = (signed short)( buffer[pos] + (buffer[pos+1]<<8));                                      break; }
+      case 4 : { value = (signed long )(signed int)((unsigned long)buffer[pos] + ((unsigned long)buffer[pos+1]<<8) + ((unsigned long)buffer[pos+2]<<16) + ((unsigned long)buffer[pos+3]<<24)); break; }
+      default: { field = NULL; value = 0;                                                                         break; }
+    }
+    pos = pos + size;
+    if (field == NULL) { continue; }
+    p = (unsigned char*)status + field->offset;
+    switch (field->type) {
+      case STATUS_EXPORT_UINT : { *((unsigned int  *)p) = (unsigned int )value; break; }
+      case STATUS_EXPORT_LONG : { *((signed   long *)p) =                value; break; }
+      case STATUS_EXPORT_ULONG: { *((unsigned long *)p) = (unsigned long)value; break; }
+      case STATUS_EXPORT_CHAR : { *((signed   char *)p) = (signed   char)value; break; }
+      case STATUS_EXPORT_UCHAR: { *((unsigned char *)p) = (unsigned char)value; break; }
+      default                 : { *((signed   int  *)p) = (signed   int )value; break; }
+    }
+    nb++;
+  }
+  return nb;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Append function
+  Use:      Text append at a known position (without snprintf, and without strlen on the text)
+  Parameter: text, the text buffer
+  Parameter: pos, the current text length
+  Parameter: size, the text buffer size
+  Parameter: string, the string to append
+  Returns:  the new text length (limited to size - 1)
+************************************************************************************************************************/
+static signed   int   SiLabs_Status_Export_Append      (char *text, signed   int pos, signed   int size, const char *string) {
+  while ( (*string != 0) && (pos < size - 1) ) { text[pos++] = *string++; }
+  text[pos] = 0;
+  return pos;
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Append_Value function
+  Use:      Decimal value append at a known position (without snprintf)
+  Parameter: text, the text buffer
+  Parameter: pos, the current text length
+  Parameter: size, the text buffer size
+  Parameter: value, the value to append
+  Returns:  the new text length (limited to size - 1)
+************************************************************************************************************************/
+static signed   int   SiLabs_Status_Export_Append_Value(char *text, signed   int pos, signed   int size, signed   long value) {
+  char          digits[12];
+  unsigned long magnitude;
+  signed   int  n;
+  n         = sizeof(digits) - 1;
+  digits[n] = 0;
+  magnitude = (value < 0) ? 0 - (unsigned long)value : (unsigned long)value;
+  do {
+    digits[--n] = (char)('0' + magnitude%10);
+    magnitude   = magnitude/10;
+  } while ( (magnitude) && (n > 1) );
+  if (value < 0) { digits[--n] = '-'; }
+  return SiLabs_Status_Export_Append(text, pos, size, digits + n);
+}
+/************************************************************************************************************************
+  SiLabs_Status_Export_Print function
+  Use:      Status export text rendering
+            Renders the export as 'name value' lines (with the constellation/code rate/GI/FFT texts),
+             appending each item at the current position, without snprintf (the text is never scanned again).
+  Parameter: buffer, the export
+  Parameter: length, the export length
+  Parameter: text, a buffer to store the text
+  Parameter: size, the text buffer size
+  Returns:  the text length, -1 if the export is invalid
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Print              (const unsigned char *buffer, signed   int length, char *text, signed   int size) {
+  const SILABS_Status_Export_Field *field;
+  const char   *value_text;
+  signed   long value;
+  signed   int  end;
+  signed   int  pos;
+  signed   int  len;
+  signed   int  txt;
+  end = SiLabs_Status_Export_Check(buffer, length);
+  if ( (end < 0) || (size < 1) ) { return -1; }
+  end = end + STATUS_EXPORT_HEADER_SIZE;
+  txt = SiLabs_Status_Export_Append      (text, 0  , size, "fe[");
+  txt = SiLabs_Status_Export_Append_Value(text, txt, size, buffer[4]);
+  txt = SiLabs_Status_Export_Append      (text, txt, size, "] ");
+  txt = SiLabs_Status_Export_Append      (text, txt, size, Silabs_Standard_Text(buffer[5]));
+  txt = SiLabs_Status_Export_Append      (text, txt, size, "\n");
+  pos = STATUS_EXPORT_HEADER_SIZE;
+  while ( (pos + 2 <= end) && (txt < size - 1) ) {
+    field = SiLabs_Status_Export_Field(buffer[pos]);
+    len   = buffer[pos + 1];
+    if (pos + 2 + len > end) { break; }
+    switch (len) {
+      case 1 : { value = (signed char )  buffer[pos+2];                                     break; }
+      case 2 : { value = (signed short)( buffer[pos+2] + (buffer[pos+3]<<8));               break; }
+      case 4 : { value = (signed long )(signed int)((unsigned long)buffer[pos+2] + ((unsigned long)buffer[pos+3]<<8) + ((unsigned long)buffer[pos+4]<<16) + ((unsigned long)buffer[pos+5]<<24)); break; }
+      default: { value = 0;                                                                 break; }
+    }
+    value_text = NULL;
+    if (field == NULL) {
+      txt = SiLabs_Status_Export_Append      (text, txt, size, "tag_");
+      txt = SiLabs_Status_Export_Append_Value(text, txt, size, buffer[pos]);
+    } else {
+      txt = SiLabs_Status_Export_Append      (text, txt, size, field->name);
+      switch (field->text) {
+        case STATUS_EXPORT_TEXT_CONSTEL : { value_text = Silabs_Constel_Text ((CUSTOM_Constel_Enum )value); break; }
+        case STATUS_EXPORT_TEXT_CODERATE: { value_text = Silabs_Coderate_Text((CUSTOM_Coderate_Enum)value); break; }
+        case STATUS_EXPORT_TEXT_GI      : { value_text = Silabs_GI_Text      ((CUSTOM_GI_Enum      )value); break; }
+        case STATUS_EXPORT_TEXT_FFT     : { value_text = Silabs_FFT_Text     ((CUSTOM_FFT_Mode_Enum)value); break; }
+        default                         : {                                                                 break; }
+      }
+    }
+    txt = SiLabs_Status_Export_Append      (text, txt, size, " ");
+    txt = SiLabs_Status_Export_Append_Value(text, txt, size, value);
+    if (value_text != NULL) {
+      txt = SiLabs_Status_Export_Append    (text, txt, size, " ");
+      txt = SiLabs_Status_Export_Append    (text, txt, size, value_text);
+    }
+    txt = SiLabs_Status_Export_Append      (text, txt, size, "\n");
+    pos = pos + 2 + len;
+  }
+  return txt;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Status_Export_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the status export.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Status_Export_Test               (SILABS_Status_Export *exp, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  const SILABS_Status_Export_Field *field;
+  signed   int pos;
+  signed   int i;
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible status export test commands:\n\
+read               <selection>    : read the status and export it (hexadecimal dump)\n\
+print              <selection>    : read the status and render the export as text\n\
+fields             <first_tag>    : list the exported fields and their tags from first_tag (0: number of fields)\n\
+stats                             : number of exports and average export length\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "read"               ) == 0) {
+    *retdval = SiLabs_Status_Export_Read(exp, (unsigned char)dval);
+    pos = 0;
+    for (i=0; (i<exp->length) && (pos < 1000 - 4); i++) {
+      pos += snprintf(*rettxt + pos, 1000 - pos, "%02x", exp->buffer[i]);
+    }
+    snprintf(*rettxt + pos, 1000 - pos, "\n");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "print"              ) == 0) {
+    *retdval = SiLabs_Status_Export_Read(exp, (unsigned char)dval);
+    SiLabs_Status_Export_Print(exp->buffer, exp->length, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "fields"             ) == 0) {
+    *retdval = STATUS_EXPORT_FIELDS;
+    pos = 0;
+    for (i=(signed int)dval; (pos < 1000 - 32) && ((field = SiLabs_Status_Export_Field(i)) != NULL); i++) {
+      pos += snprintf(*rettxt + pos, 1000 - pos, "%3d %-18s 0x%02x\n", i, field->name, field->selection);
+    }
+    if (pos == 0) { snprintf(*rettxt, 1000, "%d exported fields (tags 1 to %d)\n", STATUS_EXPORT_FIELDS, STATUS_EXPORT_FIELDS); }
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "stats"              ) == 0) {
+    *retdval = exp->exports;
+    snprintf(*rettxt, 1000, "%ld exports, %ld bytes on average\n", exp->exports, exp->exports ? exp->bytes/exp->exports : 0);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* STATUS_EXPORT */
@@ -0,0 +1,94 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Status_Export_H_
+#define  _SiLabs_API_L3_Wrapper_Status_Export_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[Status/Export] Adding a binary (TLV) status export via SiLabs_API_L3_Wrapper_Status_Export.c/.h
+        The front-end and tuner statuses are serialized without any text formatting, with an optional text rendering.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_EXPORT_MAGIC_0         0x53  /* 'S'                                                             */
+#define STATUS_EXPORT_MAGIC_1         0x58  /* 'X'                                                             */
+#define STATUS_EXPORT_VERSION            1  /* incremented only if the header changes. New fields get new tags */
+#define STATUS_EXPORT_HEADER_SIZE        8  /* magic (2), version, status_selection, fe_index, standard, payload length (2) */
+#define STATUS_EXPORT_MAX_SIZE         768  /* buffer size large enough for all records of any standard        */
+
+/* possible values for the field types */
+typedef enum  _SILABS_Status_Export_Type          {
+  STATUS_EXPORT_INT   = 0,
+  STATUS_EXPORT_UINT  = 1,
+  STATUS_EXPORT_LONG  = 2,
+  STATUS_EXPORT_ULONG = 3,
+  STATUS_EXPORT_CHAR  = 4,
+  STATUS_EXPORT_UCHAR = 5
+} SILABS_Status_Export_Type;
+
+/* possible values for the field text renderings */
+typedef enum  _SILABS_Status_Export_Text          {
+  STATUS_EXPORT_TEXT_NONE     = 0,
+  STATUS_EXPORT_TEXT_CONSTEL  = 1,
+  STATUS_EXPORT_TEXT_CODERATE = 2,
+  STATUS_EXPORT_TEXT_GI       = 3,
+  STATUS_EXPORT_TEXT_FFT      = 4
+} SILABS_Status_Export_Text;
+
+/* Structure used to describe one exported CUSTOM_Status_Struct field. The tag of a field is its index in the field table + 1 */
+typedef struct _SILABS_Status_Export_Field        {
+  const char                   *name;
+  unsigned short                offset;          /* offset in CUSTOM_Status_Struct                                */
+  unsigned char                 type;            /* SILABS_Status_Export_Type                                     */
+  unsigned char                 selection;       /* STATUS_SELECTION flags refreshing this field                  */
+  unsigned short                standards;       /* mask of the standards using this field, 0 for all standards   */
+  unsigned char                 text;            /* SILABS_Status_Export_Text                                     */
+} SILABS_Status_Export_Field;
+
+/* Structure used to store the last status export of one front-end */
+typedef struct _SILABS_Status_Export              {
+  SILABS_FE_Context            *front_end;
+  unsigned char                 buffer[STATUS_EXPORT_MAX_SIZE];
+  signed   int                  length;          /* length of the last export, 0 if none                          */
+  unsigned long                 exports;
+  unsigned long                 bytes;
+} SILABS_Status_Export;
+
+extern SILABS_Status_Export  Status_Export_Table[FRONT_END_COUNT];
+
+SILABS_Status_Export *SiLabs_Status_Export_Of          (SILABS_FE_Context *front_end);
+signed   int   SiLabs_Status_Export_Init               (SILABS_Status_Export *exp, SILABS_FE_Context *front_end);
+const SILABS_Status_Export_Field *SiLabs_Status_Export_Field (signed   int tag);
+signed   int   SiLabs_Status_Export                    (SILABS_FE_Context *front_end, CUSTOM_Status_Struct *status, unsigned char status_selection, unsigned char *buffer, signed   int size);
+signed   int   SiLabs_Status_Export_Read               (SILABS_Status_Export *exp, unsigned char status_selection);
+signed   int   SiLabs_Status_Export_Check              (const unsigned char *buffer, signed   int length);
+signed   int   SiLabs_Status_Export_Parse              (const unsigned char *buffer, signed   int length, CUSTOM_Status_Struct *status);
+signed   int   SiLabs_Status_Export_Print              (const unsigned char *buffer, signed   int length, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Status_Export_Test               (SILABS_Status_Export *exp, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Status_Export_H_ */
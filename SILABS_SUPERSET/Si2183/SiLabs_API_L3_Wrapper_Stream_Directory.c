@@ -0,0 +1,440 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Stream Directory Functions                                    */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains an ISI directory cache and a stream switch function for DVB-S2/S2X multistream */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ SiLabs_API_Get_Stream_Info sends one STREAM_INFO command per ISI index each time the application needs the
+  stream list, and the PLS scrambling code is applied separately using SiLabs_API_SAT_Gold_Sequence_Init and
+  SiLabs_API_SAT_PLS_Init, without any record of the value used to receive the transponder.
+
+ The stream directory stores, for the transponder currently received by each front-end:
+  - the ISI ids, in the order of the ISI indexes,
+  - the constellation and code rate of each ISI (as L3 codes, identical to those of SiLabs_API_Get_Stream_Info),
+  - the Gold sequence index and PLS initialization value applied when the ISIs were read.
+ The PLS scrambling is common to all ISIs of a transponder, it is therefore recorded in the directory and copied
+  to each entry when the directory is filled.
+
+ The directory is filled on first use after lock, and invalidated:
+  - by SiLabs_API_lock_to_carrier, SiLabs_API_Tune and SiLabs_API_Channel_Seek_Next (new transponder),
+  - by SiLabs_Stream_Directory_PLS (new scrambling code),
+  - when the signalling fields last read from the demodulator (DVBS2_STATUS) differ from those read when the
+     directory was filled (number of ISIs, CCM/VCM, SIS/MIS, stream type).
+    As the application generally reads the S2 status periodically, this check does not require additional i2c traffic.
+
+ When STREAM_DIRECTORY is defined, SiLabs_API_Get_Stream_Info is served from the directory, without any i2c traffic.
+
+ SiLabs_Stream_Switch changes the ISI on the current transponder with one STREAM_SELECT command, without re-tuning
+  and without DD_RESTART, then polls the DVBS2_STATUS until the demodulator delivers the new ISI.
+  It returns -1 if the ISI is not in the current transponder, in which case SiLabs_API_lock_to_carrier is required.
+  The duration of each switch is kept (last, min, max and total), to monitor the stream switching performance.
+
+ Use case:
+    SiLabs_API_lock_to_carrier (front_end, SILABS_DVB_S2, 1550000000, 0, 27500000, 0, 0, 0, 0, 0, 0, 0);
+    directory = SiLabs_Stream_Directory_Of(front_end);
+    for (i=0; i<directory->nb_isi; i++) { ... directory->isi[i].isi_id ... }
+    SiLabs_Stream_Switch      (directory, 3, STREAM_SWITCH_TIMEOUT_MS);
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[S2X/MULTISTREAM] Initial version of the stream directory and stream switch
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   STREAM_DIRECTORY
+  "If you get a compilation error on this line, it means that you included the Stream_Directory code in your project without defining STREAM_DIRECTORY.";
+  "Please define STREAM_DIRECTORY at project-level, or remove the Stream_Directory code from your project";
+#endif /* STREAM_DIRECTORY */
+
+#ifdef    STREAM_DIRECTORY
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "ISI_Dir "
+#include "SiLabs_API_L3_Wrapper_Stream_Directory.h"
+
+SILABS_Stream_Directory  Stream_Directory_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Of function
+  Use:      Stream directory retrieval
+            Returns the stream directory of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the stream directory
+************************************************************************************************************************/
+SILABS_Stream_Directory *SiLabs_Stream_Directory_Of    (SILABS_FE_Context *front_end) {
+  SILABS_Stream_Directory *directory;
+  directory = &(Stream_Directory_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { directory = ((SILABS_FE_Registry_Entry *)front_end)->stream_directory; }
+#endif /* FRONTEND_REGISTRY */
+  if (directory->front_end != front_end) { SiLabs_Stream_Directory_Init(directory, front_end); }
+  return directory;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Init function
+  Use:      Stream directory initialization
+  Parameter: directory, a pointer to the stream directory
+  Parameter: front_end, a pointer to the SILABS_FE_Context using the directory
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Init            (SILABS_Stream_Directory *directory, SILABS_FE_Context *front_end) {
+  memset(directory, 0, sizeof(SILABS_Stream_Directory));
+  directory->front_end     = front_end;
+  directory->gold_index    = -1;
+  directory->pls_init      = -1;
+  directory->switch_min_ms = -1;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Invalidate function
+  Use:      Stream directory invalidation
+            Called when the front-end moves to another transponder. The directory will be filled again on next use.
+  Parameter: directory, a pointer to the stream directory
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Invalidate      (SILABS_Stream_Directory *directory) {
+  directory->valid  = 0;
+  directory->nb_isi = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Signature function
+  Use:      Signalling summary
+            Computed from the last DVBS2_STATUS response, without sending any command.
+  Parameter: directory, a pointer to the stream directory
+  Returns:  the signalling summary
+************************************************************************************************************************/
+unsigned long  SiLabs_Stream_Directory_Signature       (SILABS_Stream_Directory *directory) {
+  unsigned long signature;
+  signature = 0;
+  directory = directory; /* To avoid compiler warning if not used */
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(directory->front_end) ==   0x2183 ) {
+#ifdef    DEMOD_DVB_S2X
+    signature = (unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbs2_status.num_is
+              + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbs2_status.ccm_vcm     <<  8)
+              + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbs2_status.sis_mis     <<  9)
+              + ((unsigned long)directory->front_end->Si2183_FE->demod->rsp->dvbs2_status.stream_type << 10);
+#endif /* DEMOD_DVB_S2X */
+  }
+#endif /* Si2183_COMPATIBLE */
+  return signature;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Fill function
+  Use:      Stream directory reading
+            Reads the signalling status and all ISI information of the current transponder from the demodulator.
+            1 DVBS2_STATUS + 1 DVBS2_STREAM_INFO per ISI (none in single stream)
+  Parameter: directory, a pointer to the stream directory
+  Returns:  the number of stored ISIs, -1 if not locked in DVB-S2 or in case of an error
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Fill            (SILABS_Stream_Directory *directory) {
+  SILABS_FE_Context   *front_end;
+  SILABS_Stream_Entry *entry;
+  signed   int         start_ms;
+  signed   int         supported;
+  signed   int         i;
+  front_end = directory->front_end;
+  SiLabs_Stream_Directory_Invalidate(directory);
+  directory->num_is = 0;
+  start_ms  = system_time();
+  supported = 0;
+  entry     = NULL;
+  i         = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+#ifdef    DEMOD_DVB_S2X
+    if (front_end->Si2183_FE->demod->rsp->dd_status.modulation == Si2183_DD_STATUS_RESPONSE_MODULATION_DVBS2) {
+      supported = 1;
+      if (Si2183_L1_DVBS2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBS2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) {
+        SiERROR("Si2183_L1_DVBS2_STATUS error when filling the stream directory!\n");
+        return -1;
+      }
+      if (front_end->Si2183_FE->demod->rsp->dvbs2_status.sis_mis == Si2183_DVBS2_STATUS_RESPONSE_SIS_MIS_MIS) {
+        directory->num_is = front_end->Si2183_FE->demod->rsp->dvbs2_status.num_is;
+      }
+      for (i=0; (i<directory->num_is) && (i<STREAM_DIRECTORY_MAX_ISI); i++) {
+        if (Si2183_L1_DVBS2_STREAM_INFO(front_end->Si2183_FE->demod, i) != NO_Si2183_ERROR) {
+          SiTRACE("Si2183_L1_DVBS2_STREAM_INFO error when checking ISI index %d!\n", i);
+          SiERROR("Si2183_L1_DVBS2_STREAM_INFO error when filling the stream directory!\n");
+          return -1;
+        }
+        entry = &(directory->isi[i]);
+        entry->isi_id        = front_end->Si2183_FE->demod->rsp->dvbs2_stream_info.isi_id;
+        entry->isi_index     = (unsigned char)i;
+        entry->constellation = Custom_constelCode (front_end, front_end->Si2183_FE->demod->rsp->dvbs2_stream_info.isi_constellation);
+        entry->code_rate     = Custom_coderateCode(front_end, front_end->Si2183_FE->demod->rsp->dvbs2_stream_info.isi_code_rate);
+        entry->gold_index    = directory->gold_index;
+        entry->pls_init      = directory->pls_init;
+      }
+      directory->nb_isi = i;
+    }
+#endif /* DEMOD_DVB_S2X */
+  }
+#endif /* Si2183_COMPATIBLE */
+  entry = entry; /* To avoid compiler warning if not used */
+  i     = i;     /* To avoid compiler warning if not used */
+  if (!supported) {
+    SiTRACE("Stream directory: not locked in DVB-S2\n");
+    return -1;
+  }
+  if (directory->num_is > directory->nb_isi) {
+    SiTRACE("Stream directory: only %d ISIs stored out of %d\n", directory->nb_isi, directory->num_is);
+  }
+  directory->signature = SiLabs_Stream_Directory_Signature(directory);
+  directory->fill_ms   = system_time() - start_ms;
+  directory->valid     = 1;
+  directory->fills++;
+  SiTRACE("Stream directory filled in %d ms: %d ISIs\n", directory->fill_ms, directory->nb_isi);
+  return directory->nb_isi;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Check function
+  Use:      Stream directory validation
+            Compares the signalling fields with those read when the directory was filled, and fills it again if required.
+  Parameter: directory, a pointer to the stream directory
+  Parameter: refresh, 1 to read the signalling fields from the demodulator first (1 command),
+                      0 to use the last values read by the application (no i2c traffic)
+  Returns:  1 if the directory is valid, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Check           (SILABS_Stream_Directory *directory, signed   int refresh) {
+  SILABS_FE_Context *front_end;
+  front_end = directory->front_end;
+  if (directory->valid) {
+#ifdef    Si2183_COMPATIBLE
+#ifdef    DEMOD_DVB_S2X
+    if ( (refresh) && (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) ) { Si2183_L1_DVBS2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBS2_STATUS_CMD_INTACK_OK); }
+#endif /* DEMOD_DVB_S2X */
+#endif /* Si2183_COMPATIBLE */
+    if (SiLabs_Stream_Directory_Signature(directory) == directory->signature) {
+      directory->hits++;
+      return 1;
+    }
+    SiTRACE("Stream directory: signalling change detected\n");
+  }
+  front_end = front_end; /* To avoid compiler warning if not used */
+  refresh   = refresh;   /* To avoid compiler warning if not used */
+  return (SiLabs_Stream_Directory_Fill(directory) >= 0);
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Find function
+  Use:      ISI search by id
+  Parameter: directory, a pointer to the stream directory
+  Parameter: isi_id, the ISI id
+  Returns:  a pointer to the ISI entry, NULL if the ISI is not in the current transponder
+************************************************************************************************************************/
+SILABS_Stream_Entry *SiLabs_Stream_Directory_Find      (SILABS_Stream_Directory *directory, signed   int isi_id) {
+  signed   int i;
+  if (!SiLabs_Stream_Directory_Check(directory, 0)) { return NULL; }
+  for (i=0; i<directory->nb_isi; i++) {
+    if (directory->isi[i].isi_id == isi_id) { return &(directory->isi[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Lookup function
+  Use:      ISI search by index
+            Used by SiLabs_API_Get_Stream_Info.
+  Parameter: directory, a pointer to the stream directory
+  Parameter: isi_index, the ISI index in the transponder
+  Returns:  a pointer to the ISI entry, NULL if not stored in the directory
+************************************************************************************************************************/
+SILABS_Stream_Entry *SiLabs_Stream_Directory_Lookup    (SILABS_Stream_Directory *directory, signed   int isi_index) {
+  if (!SiLabs_Stream_Directory_Check(directory, 0)) { return NULL; }
+  if ( (isi_index < 0) || (isi_index >= directory->nb_isi) ) { return NULL; }
+  return &(directory->isi[isi_index]);
+}
+#ifdef    Si2183_DVBS2_PLS_INIT_CMD
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_PLS function
+  Use:      PLS scrambling selection
+            Applies the PLS initialization value using SiLabs_API_SAT_PLS_Init and records it in the directory.
+            The directory is invalidated, as the ISIs received depend on the scrambling code.
+  Parameter: directory, a pointer to the stream directory
+  Parameter: gold_index, the Gold sequence index, used to compute pls_init using SiLabs_API_SAT_Gold_Sequence_Init
+              Use '-1' to directly use pls_init
+  Parameter: pls_init, the PLS initialization value (only used if gold_index is '-1'). Use '-1' for auto detection.
+  Returns:  1 if applied, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_PLS             (SILABS_Stream_Directory *directory, signed   int gold_index, signed   int pls_init) {
+  SiTRACE("API CALL LOCK  : SiLabs_Stream_Directory_PLS (directory, %d, %d);\n", gold_index, pls_init);
+  if (gold_index >= 0) { pls_init = SiLabs_API_SAT_Gold_Sequence_Init(gold_index); }
+  if ( (gold_index == directory->gold_index) && (pls_init == directory->pls_init) ) { return 1; }
+  if (!SiLabs_API_SAT_PLS_Init(directory->front_end, pls_init)) { return 0; }
+  directory->gold_index = gold_index;
+  directory->pls_init   = pls_init;
+  SiLabs_Stream_Directory_Invalidate(directory);
+  return 1;
+}
+#endif /* Si2183_DVBS2_PLS_INIT_CMD */
+/************************************************************************************************************************
+  SiLabs_Stream_Switch function
+  Use:      ISI change on the current transponder
+            Selects the ISI with a single STREAM_SELECT command, without re-tuning and without DD_RESTART,
+             then polls the DVBS2_STATUS until the new ISI is delivered.
+  Parameter: directory, a pointer to the stream directory
+  Parameter: isi_id, the ISI id
+  Parameter: timeout_ms, the maximum time to wait for the new ISI
+  Returns:  1 if locked on the new ISI, 0 in case of timeout,
+            -1 if the ISI can not be reached without lock_to_carrier (not in the transponder)
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Switch                    (SILABS_Stream_Directory *directory, signed   int isi_id, signed   int timeout_ms) {
+  SILABS_FE_Context   *front_end;
+  SILABS_Stream_Entry *entry;
+  signed   int         start_ms;
+  signed   int         locked;
+  front_end = directory->front_end;
+  SiTRACE("API CALL LOCK  : SiLabs_Stream_Switch (directory, %d, %d);\n", isi_id, timeout_ms);
+  entry = SiLabs_Stream_Directory_Find(directory, isi_id);
+  if (entry == NULL) {
+    SiTRACE("ISI %d is not in the current transponder, lock_to_carrier is required\n", isi_id);
+    return -1;
+  }
+  start_ms = system_time();
+  locked   = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) {
+#ifdef    DEMOD_DVB_S2X
+    front_end->Si2183_FE->demod->cmd->dvbs2_stream_select.stream_sel_mode = Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_SEL_MODE_MANUAL;
+    front_end->Si2183_FE->demod->cmd->dvbs2_stream_select.stream_id       = entry->isi_id;
+    if (Si2183_L1_DVBS2_STREAM_SELECT(front_end->Si2183_FE->demod, entry->isi_id, Si2183_DVBS2_STREAM_SELECT_CMD_STREAM_SEL_MODE_MANUAL) != NO_Si2183_ERROR) {
+      SiERROR("Si2183_L1_DVBS2_STREAM_SELECT error during stream switch!\n");
+      return 0;
+    }
+    while (system_time() - start_ms < timeout_ms) {
+      if (Si2183_L1_DVBS2_STATUS(front_end->Si2183_FE->demod, Si2183_DVBS2_STATUS_CMD_INTACK_OK) != NO_Si2183_ERROR) { break; }
+      if ( (front_end->Si2183_FE->demod->rsp->dvbs2_status.isi_id == entry->isi_id)
+        && (front_end->Si2183_FE->demod->rsp->dvbs2_status.dl     == Si2183_DVBS2_STATUS_RESPONSE_DL_LOCKED) ) { locked = 1; break; }
+      system_wait(STREAM_SWITCH_POLL_MS);
+    }
+#endif /* DEMOD_DVB_S2X */
+  }
+#endif /* Si2183_COMPATIBLE */
+  directory->switch_ms = system_time() - start_ms;
+  directory->switches++;
+  if (locked) {
+    directory->switch_total_ms = directory->switch_total_ms + directory->switch_ms;
+    if ( (directory->switch_min_ms < 0) || (directory->switch_ms < directory->switch_min_ms) ) { directory->switch_min_ms = directory->switch_ms; }
+    if (                                   directory->switch_ms > directory->switch_max_ms  ) { directory->switch_max_ms = directory->switch_ms; }
+    SiLabs_API_Reset_Uncorrs(front_end);
+    SiTRACE("Stream switch to ISI %d done in %d ms\n", isi_id, directory->switch_ms);
+  } else {
+    directory->timeouts++;
+    SiTRACE("Stream switch to ISI %d: no lock after %d ms\n", isi_id, directory->switch_ms);
+  }
+  return locked;
+}
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Text function
+  Use:      Stream directory display
+  Parameter: directory, a pointer to the stream directory
+  Parameter: text, the output buffer
+  Parameter: size, the output buffer size
+  Returns:  the number of ISIs listed
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Text            (SILABS_Stream_Directory *directory, char *text, signed   int size) {
+  signed   int i;
+  signed   int pos;
+  signed   int locked;
+  locked = (signed int)(directory->switches - directory->timeouts);
+  pos = snprintf(text, size, "%d ISIs (%d stored), gold %d pls %d, filled in %d ms (%lu fills, %lu hits)\n"
+    , directory->num_is, directory->nb_isi, directory->gold_index, directory->pls_init, directory->fill_ms, directory->fills, directory->hits);
+  pos += snprintf(text + pos, size - pos, "%lu switches (%lu timeouts): last %d ms, min %d ms, max %d ms, avg %d ms\n"
+    , directory->switches, directory->timeouts, directory->switch_ms, directory->switch_min_ms, directory->switch_max_ms, locked ? (signed int)(directory->switch_total_ms/locked) : 0);
+  for (i=0; (i<directory->nb_isi) && (pos < size); i++) {
+    pos += snprintf(text + pos, size - pos, " ISI %3d: index %3d constellation %2d code_rate %2d gold %6d pls %6d\n"
+      , directory->isi[i].isi_id, directory->isi[i].isi_index, directory->isi[i].constellation, directory->isi[i].code_rate, directory->isi[i].gold_index, directory->isi[i].pls_init);
+  }
+  return i;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Stream_Directory_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the stream directory.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Stream_Directory_Test            (SILABS_Stream_Directory *directory, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible stream directory test commands:\n\
+list                              : ISI directory of the current transponder\n\
+fill                              : read the ISI directory again\n\
+check                             : check the signalling and fill the directory if required\n\
+switch             <isi_id>       : change ISI without re-tuning\n\
+gold               <gold_index>   : apply the PLS scrambling for a Gold sequence index (-1: auto)\n\
+pls                <pls_init>     : apply a PLS initialization value (-1: auto)\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "list"               ) == 0) {
+    SiLabs_Stream_Directory_Check(directory, 0);
+    *retdval = SiLabs_Stream_Directory_Text(directory, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "fill"               ) == 0) {
+    *retdval = SiLabs_Stream_Directory_Fill(directory);
+    snprintf(*rettxt, 1000, "%d ISIs read in %d ms\n", (signed int)*retdval, directory->fill_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "check"              ) == 0) {
+    *retdval = SiLabs_Stream_Directory_Check(directory, 1);
+    snprintf(*rettxt, 1000, "Stream directory %s (%lu fills)\n", *retdval ? "valid" : "invalid", directory->fills);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "switch"             ) == 0) {
+    *retdval = SiLabs_Stream_Switch(directory, (signed int)dval, STREAM_SWITCH_TIMEOUT_MS);
+    snprintf(*rettxt, 1000, "Stream switch to ISI %d: %s in %d ms\n", (signed int)dval, (*retdval == 1) ? "locked" : ((*retdval == 0) ? "not locked" : "lock_to_carrier required"), directory->switch_ms);
+    return 1;
+  }
+#ifdef    Si2183_DVBS2_PLS_INIT_CMD
+  else if (strcmp_nocase(cmd, "gold"               ) == 0) {
+    *retdval = SiLabs_Stream_Directory_PLS(directory, (signed int)dval, -1);
+    snprintf(*rettxt, 1000, "Gold sequence %d: pls_init %d %s\n", (signed int)dval, directory->pls_init, *retdval ? "applied" : "error");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "pls"                ) == 0) {
+    *retdval = SiLabs_Stream_Directory_PLS(directory, -1, (signed int)dval);
+    snprintf(*rettxt, 1000, "pls_init %d %s\n", (signed int)dval, *retdval ? "applied" : "error");
+    return 1;
+  }
+#endif /* Si2183_DVBS2_PLS_INIT_CMD */
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* STREAM_DIRECTORY */
@@ -0,0 +1,89 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Stream_Directory_H_
+#define  _SiLabs_API_L3_Wrapper_Stream_Directory_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[S2X/MULTISTREAM] Adding a stream (ISI) directory cache via SiLabs_API_L3_Wrapper_Stream_Directory.c/.h
+        The ISI list of the current transponder is read once after lock, and streams can be changed without re-tuning.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STREAM_DIRECTORY_MAX_ISI      32  /* Maximum number of ISIs stored per transponder (S2 allows 256)     */
+#define STREAM_SWITCH_TIMEOUT_MS    1000  /* Default maximum time to get the demodulator locked on the new ISI */
+#define STREAM_SWITCH_POLL_MS         10  /* Status polling period during a stream switch                      */
+
+/* Structure used to store one ISI of the current transponder */
+typedef struct _SILABS_Stream_Entry               {
+  unsigned char                 isi_id;
+  unsigned char                 isi_index;       /* index of the ISI in the transponder, as used by STREAM_INFO          */
+  signed   int                  constellation;   /* L3 constellation code, as returned by SiLabs_API_Get_Stream_Info     */
+  signed   int                  code_rate;       /* L3 code rate code, as returned by SiLabs_API_Get_Stream_Info         */
+  signed   int                  gold_index;      /* Gold sequence index used to receive the ISI, -1 if not known         */
+  signed   int                  pls_init;        /* PLS initialization value used to receive the ISI, -1 for auto        */
+} SILABS_Stream_Entry;
+
+/* Structure used to store the stream directory of the transponder currently received by one front-end */
+typedef struct _SILABS_Stream_Directory           {
+  SILABS_FE_Context            *front_end;
+  signed   int                  valid;
+  unsigned long                 signature;       /* signalling fields summary, used to detect signalling changes  */
+  signed   int                  num_is;          /* number of ISIs signalled in the transponder                   */
+  signed   int                  nb_isi;          /* number of ISIs stored (limited to STREAM_DIRECTORY_MAX_ISI)   */
+  SILABS_Stream_Entry           isi[STREAM_DIRECTORY_MAX_ISI];
+  signed   int                  gold_index;      /* Gold sequence index applied on the transponder, -1 if none    */
+  signed   int                  pls_init;        /* PLS initialization value applied on the transponder, -1: auto */
+  signed   int                  fill_ms;         /* duration of the last directory read                           */
+  signed   int                  switch_ms;       /* duration of the last stream switch                            */
+  signed   int                  switch_min_ms;
+  signed   int                  switch_max_ms;
+  unsigned long                 switch_total_ms;
+  unsigned long                 fills;
+  unsigned long                 hits;
+  unsigned long                 switches;
+  unsigned long                 timeouts;
+} SILABS_Stream_Directory;
+
+extern SILABS_Stream_Directory  Stream_Directory_Table[FRONT_END_COUNT];
+
+SILABS_Stream_Directory *SiLabs_Stream_Directory_Of    (SILABS_FE_Context *front_end);
+signed   int   SiLabs_Stream_Directory_Init            (SILABS_Stream_Directory *directory, SILABS_FE_Context *front_end);
+signed   int   SiLabs_Stream_Directory_Invalidate      (SILABS_Stream_Directory *directory);
+signed   int   SiLabs_Stream_Directory_Fill            (SILABS_Stream_Directory *directory);
+signed   int   SiLabs_Stream_Directory_Check           (SILABS_Stream_Directory *directory, signed   int refresh);
+SILABS_Stream_Entry *SiLabs_Stream_Directory_Find      (SILABS_Stream_Directory *directory, signed   int isi_id);
+SILABS_Stream_Entry *SiLabs_Stream_Directory_Lookup    (SILABS_Stream_Directory *directory, signed   int isi_index);
+#ifdef    Si2183_DVBS2_PLS_INIT_CMD
+signed   int   SiLabs_Stream_Directory_PLS             (SILABS_Stream_Directory *directory, signed   int gold_index, signed   int pls_init);
+#endif /* Si2183_DVBS2_PLS_INIT_CMD */
+signed   int   SiLabs_Stream_Switch                    (SILABS_Stream_Directory *directory, signed   int isi_id, signed   int timeout_ms);
+signed   int   SiLabs_Stream_Directory_Text            (SILABS_Stream_Directory *directory, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Stream_Directory_Test            (SILABS_Stream_Directory *directory, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Stream_Directory_H_ */
@@ -0,0 +1,381 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Adaptive TS Clock Functions                                   */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code sets the TS clock of the demodulators from their measured TS bitrate                   */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ The TS clock is usually configured once (SiLabs_API_TS_Config), for the highest possible TS bitrate.
+  When many low bitrate multiplexes are captured, most of the TS clock cycles carry no data.
+
+ With ADAPTIVE_TS_CLOCK, each DD_STATUS read by SiLabs_API_Demod_status_selection (FE_LOCK_STATE) is used to
+  update the TS clock of the front-end (when enabled for this front-end):
+    - the required clock is the TS bitrate + 'margin_pct' %, divided by 8 in parallel mode,
+       rounded up to 'step_khz' and at least 'min_khz'.
+    - if less than half the margin is left with the current clock, the clock is raised immediately.
+    - if the required clock is at least 'hysteresis_pct' % lower than the current clock during 'down_polls'
+       consecutive polls, the clock is reduced.
+    - the clock is a MANUAL gapped clock (DD_TS_FREQ), unless the required clock is above 'max_khz'
+       (DD_TS_FREQ_MAX by default), in which case the firmware AUTO_ADAPT continuous clock is used.
+  Only the properties which change are sent (Si2183_L1_SetProperty2), and nothing is sent while unlocked.
+
+ After each clock change, the TS clock dividers (DIV_A/DIV_B) are read with SiLabs_API_Get_TS_Dividers, and
+  the TER tuner tone canceller is refreshed if 'tone_cancel' is set.
+
+ Before each SiLabs_API_lock_to_carrier, the application TS settings are restored, since the new multiplex
+  may need a higher TS clock. The clock is adapted again at the first status poll after lock.
+
+ The TS efficiency (TS bitrate vs. TS clock capacity, using the TS clock reported by DD_STATUS) is reported
+  by SiLabs_TS_Clock_Text.
+
+ Use case:
+    SiLabs_API_TS_Config    (front_end, 1, 0, 0, 0, 0, 0);                   (application settings, restored before each lock)
+    SiLabs_TS_Clock_Config  (SiLabs_TS_Clock_Of(front_end), 1, 10, 20, 3, 500, 0);
+    SiLabs_API_lock_to_carrier     (front_end, ...);
+    SiLabs_API_Demod_status_selection (front_end, &status, FE_LOCK_STATE);   (TS clock adapted)
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[TS/adaptive_clock] Initial version of the adaptive TS clocks
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   ADAPTIVE_TS_CLOCK
+  "If you get a compilation error on this line, it means that you included the TS_Clock code in your project without defining ADAPTIVE_TS_CLOCK.";
+  "Please define ADAPTIVE_TS_CLOCK at project-level, or remove the TS_Clock code from your project";
+#endif /* ADAPTIVE_TS_CLOCK */
+
+#ifdef    ADAPTIVE_TS_CLOCK
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "TS_Clock  "
+#include "SiLabs_API_L3_Wrapper_TS_Clock.h"
+
+SILABS_TS_Clock  TS_Clock_Table[FRONT_END_COUNT];
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Of function
+  Use:      Adaptive TS clock retrieval
+            Returns the adaptive TS clock of a front-end, initializing it if it was used by another front-end so far.
+            Registered front-ends (FRONTEND_REGISTRY) use the one stored in their registry entry.
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  a pointer to the adaptive TS clock
+************************************************************************************************************************/
+SILABS_TS_Clock *SiLabs_TS_Clock_Of                    (SILABS_FE_Context *front_end) {
+  SILABS_TS_Clock *tsc;
+  tsc = &(TS_Clock_Table[front_end->fe_index % FRONT_END_COUNT]);
+#ifdef    FRONTEND_REGISTRY
+  if (front_end->registry != NULL) { tsc = ((SILABS_FE_Registry_Entry *)front_end)->ts_clock; }
+#endif /* FRONTEND_REGISTRY */
+  if (tsc->front_end != front_end) { SiLabs_TS_Clock_Init(tsc, front_end); }
+  return tsc;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Init function
+  Use:      Adaptive TS clock initialization (disabled, with the default configuration)
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Parameter: front_end, a pointer to the SILABS_FE_Context
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Init                    (SILABS_TS_Clock *tsc, SILABS_FE_Context *front_end) {
+  memset(tsc, 0, sizeof(SILABS_TS_Clock));
+  tsc->front_end      = front_end;
+  tsc->margin_pct     = TS_CLOCK_MARGIN_PCT;
+  tsc->hysteresis_pct = TS_CLOCK_HYSTERESIS_PCT;
+  tsc->down_polls     = TS_CLOCK_DOWN_POLLS;
+  tsc->step_khz       = TS_CLOCK_STEP_KHZ;
+  tsc->min_khz        = TS_CLOCK_MIN_KHZ;
+  tsc->mode           = SILABS_TS_CLOCK_DEFAULT;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Config function
+  Use:      Adaptive TS clock configuration
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Parameter: enabled, 1 to adapt the TS clock, 0 to restore the application settings and stop adapting
+  Parameter: margin_pct, the clock margin above the TS bitrate, in percent
+  Parameter: hysteresis_pct, the clock is only reduced if the new clock is at least hysteresis_pct % lower
+  Parameter: down_polls, the number of consecutive polls below the threshold before reducing the clock
+  Parameter: step_khz, the clock granularity, in kHz
+  Parameter: max_khz, the maximum MANUAL clock, in kHz (0 to use DD_TS_FREQ_MAX)
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Config                  (SILABS_TS_Clock *tsc, signed   int enabled, signed   int margin_pct, signed   int hysteresis_pct, signed   int down_polls, signed   int step_khz, signed   int max_khz) {
+  if (margin_pct     <   0) { margin_pct     =   0; }
+  if (hysteresis_pct <   0) { hysteresis_pct =   0; }
+  if (hysteresis_pct >  90) { hysteresis_pct =  90; }
+  if (down_polls     <   1) { down_polls     =   1; }
+  if (step_khz       <  10) { step_khz       =  10; }
+  if (max_khz        <   0) { max_khz        =   0; }
+  tsc->margin_pct     = margin_pct;
+  tsc->hysteresis_pct = hysteresis_pct;
+  tsc->down_polls     = down_polls;
+  tsc->step_khz       = step_khz;
+  tsc->max_khz        = max_khz;
+  if (!enabled) { SiLabs_TS_Clock_Restore(tsc); }
+  tsc->enabled        = enabled;
+  tsc->below          = 0;
+  SiTRACE("SiLabs_TS_Clock_Config %s: enabled %d, margin %d%%, hysteresis %d%%, down_polls %d, step %d kHz, max %d kHz\n"
+    , tsc->front_end->tag, enabled, margin_pct, hysteresis_pct, down_polls, step_khz, max_khz);
+  return 1;
+}
+/* Clock needed to carry payload_kbps with margin_pct % margin, in kHz */
+static signed   int SiLabs_TS_Clock_Needed             (SILABS_TS_Clock *tsc, signed   int payload_kbps, signed   int margin_pct) {
+  signed   int clock_khz;
+  clock_khz = payload_kbps + (payload_kbps*margin_pct)/100;
+  if (tsc->parallel) { clock_khz = (clock_khz + 7)/8; }
+  return clock_khz;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Target function
+  Use:      Adaptive TS clock computation
+            Used to compute the smallest safe MANUAL clock for a given TS bitrate
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Parameter: payload_kbps, the TS bitrate (as reported by DD_STATUS)
+  Returns:  the MANUAL clock in kHz, 0 if above the maximum MANUAL clock (AUTO_ADAPT continuous clock needed)
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Target                  (SILABS_TS_Clock *tsc, signed   int payload_kbps) {
+  signed   int max_khz;
+  signed   int clock_khz;
+  max_khz = tsc->max_khz;
+#ifdef    Si2183_COMPATIBLE
+  if ( (max_khz == 0) && (SILABS_DEMOD_CHIP(tsc->front_end) ==   0x2183) ) {
+    max_khz = tsc->front_end->Si2183_FE->demod->prop->dd_ts_freq_max.req_freq_max_10khz*10;
+  }
+#endif /* Si2183_COMPATIBLE */
+  clock_khz = SiLabs_TS_Clock_Needed(tsc, payload_kbps, tsc->margin_pct);
+  clock_khz = ((clock_khz + tsc->step_khz - 1)/tsc->step_khz)*tsc->step_khz;
+  if (clock_khz < tsc->min_khz) { clock_khz = tsc->min_khz; }
+  if ( (max_khz > 0) && (clock_khz > max_khz) ) { return 0; }
+  return clock_khz;
+}
+/* Storing the application TS settings, in SiLabs_API_TS_Config format, before the first clock change */
+static void    SiLabs_TS_Clock_Save                    (SILABS_TS_Clock *tsc) {
+  if (tsc->saved) { return; }
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(tsc->front_end) ==   0x2183 ) {
+    switch (tsc->front_end->Si2183_FE->demod->prop->dd_ts_mode.clock) {
+      case Si2183_DD_TS_MODE_PROP_CLOCK_AUTO_ADAPT: { tsc->saved_clock = 0; break; }
+      case Si2183_DD_TS_MODE_PROP_CLOCK_AUTO_FIXED: { tsc->saved_clock = 1; break; }
+      default                                     : { tsc->saved_clock = tsc->front_end->Si2183_FE->demod->prop->dd_ts_freq.req_freq_10khz*10; break; }
+    }
+    tsc->saved_gapped = tsc->front_end->Si2183_FE->demod->prop->dd_ts_mode.clk_gapped_en;
+    tsc->saved        = 1;
+  }
+#endif /* Si2183_COMPATIBLE */
+}
+/* Applying a new clock (0 for the AUTO_ADAPT continuous clock), then reading the TS dividers */
+static signed   int SiLabs_TS_Clock_Apply              (SILABS_TS_Clock *tsc, signed   int clock_khz) {
+  signed   int start_ms;
+  SiLabs_TS_Clock_Save(tsc);
+  if (!tsc->saved) { return 0; }
+  start_ms = system_time();
+  if (clock_khz) {
+/*  SiLabs_API_TS_Config   ( front_end,    clock_config, gapped, serial_clk_inv, parallel_clk_inv, ts_err_inv, serial_pin); */
+    SiLabs_API_TS_Config   ( tsc->front_end, clock_khz,       1,              2,                2,          2,          8);
+    tsc->mode      = SILABS_TS_CLOCK_GAPPED;
+  } else {
+    SiLabs_API_TS_Config   ( tsc->front_end,         0,       0,              2,                2,          2,          8);
+    tsc->mode      = SILABS_TS_CLOCK_CONTINUOUS;
+  }
+  tsc->clock_khz = clock_khz;
+  tsc->below     = 0;
+#ifdef    TERRESTRIAL_FRONT_END
+  if (tsc->tone_cancel) { Silabs_API_TS_Tone_Cancel(tsc->front_end, 1); }
+#endif /* TERRESTRIAL_FRONT_END */
+  SiLabs_API_Get_TS_Dividers(tsc->front_end, &(tsc->div_a), &(tsc->div_b));
+  tsc->last_ms = system_time() - start_ms;
+  SiTRACE("SiLabs_TS_Clock %s: %d kbps, clock %s %d kHz (DIV_A %d, DIV_B %d) in %d ms\n", tsc->front_end->tag, tsc->payload_kbps
+    , clock_khz ? "MANUAL gapped" : "AUTO_ADAPT continuous", clock_khz, tsc->div_a, tsc->div_b, tsc->last_ms);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Update function
+  Use:      Adaptive TS clock update
+            Called by SiLabs_API_Demod_status_selection after each DD_STATUS, with the TS values it reports.
+            Raises the clock immediately if needed, reduces it after down_polls polls below the hysteresis threshold.
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Parameter: fec_lock, the fec lock status
+  Parameter: payload_kbps, the TS bitrate (DD_STATUS ts_bit_rate)
+  Parameter: measured_khz, the TS clock (DD_STATUS ts_clk_freq)
+  Returns:  1 if the clock is changed, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Update                  (SILABS_TS_Clock *tsc, signed   int fec_lock, signed   int payload_kbps, signed   int measured_khz) {
+  signed   int target;
+  signed   int capacity;
+  if (!tsc->enabled) { return 0; }
+  tsc->polls++;
+  tsc->payload_kbps = payload_kbps;
+  tsc->measured_khz = measured_khz;
+  tsc->parallel     = 0;
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(tsc->front_end) ==   0x2183 ) {
+    switch (tsc->front_end->Si2183_FE->demod->prop->dd_ts_mode.mode) {
+      case Si2183_DD_TS_MODE_PROP_MODE_SERIAL  : { tsc->parallel = 0; break; }
+      case Si2183_DD_TS_MODE_PROP_MODE_PARALLEL: { tsc->parallel = 1; break; }
+      default                                  : { return 0; break; } /* TS not used, or driven by another interface */
+    }
+  }
+#endif /* Si2183_COMPATIBLE */
+  capacity = (measured_khz > 0) ? measured_khz : tsc->clock_khz;
+  if (tsc->parallel) { capacity = capacity*8; }
+  tsc->efficiency_pct = (capacity > 0) ? (payload_kbps*100)/capacity : 0;
+  if ( (!fec_lock) || (payload_kbps <= 0) ) { tsc->below = 0; return 0; }
+  target = SiLabs_TS_Clock_Target(tsc, payload_kbps);
+  /* Raising the clock when less than half the margin is left (or first adaptation after lock) */
+  if ( (tsc->mode == SILABS_TS_CLOCK_DEFAULT)
+    || ( (target == 0) && (tsc->mode == SILABS_TS_CLOCK_GAPPED) )
+    || ( (target  > 0) && (tsc->mode == SILABS_TS_CLOCK_GAPPED) && (SiLabs_TS_Clock_Needed(tsc, payload_kbps, tsc->margin_pct/2) > tsc->clock_khz) ) ) {
+    tsc->raises++;
+    return SiLabs_TS_Clock_Apply(tsc, target);
+  }
+  /* Reducing the clock, with hysteresis */
+  if ( (target > 0) && ( (tsc->mode == SILABS_TS_CLOCK_CONTINUOUS) || (target*100 <= tsc->clock_khz*(100 - tsc->hysteresis_pct)) ) ) {
+    tsc->below++;
+    if (tsc->below >= tsc->down_polls) {
+      tsc->reductions++;
+      return SiLabs_TS_Clock_Apply(tsc, target);
+    }
+    return 0;
+  }
+  tsc->below = 0;
+  return 0;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Restore function
+  Use:      Adaptive TS clock restore
+            Used to restore the application TS settings (before locking on a new multiplex, or when disabling)
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Returns:  1 if the settings are restored, 0 if there was nothing to restore
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Restore                 (SILABS_TS_Clock *tsc) {
+  tsc->below = 0;
+  if ( (tsc->mode == SILABS_TS_CLOCK_DEFAULT) || (!tsc->saved) ) { return 0; }
+/*SiLabs_API_TS_Config   ( front_end,         clock_config,           gapped, serial_clk_inv, parallel_clk_inv, ts_err_inv, serial_pin); */
+  SiLabs_API_TS_Config   ( tsc->front_end, tsc->saved_clock, tsc->saved_gapped,              2,                2,          2,          8);
+  tsc->mode      = SILABS_TS_CLOCK_DEFAULT;
+  tsc->clock_khz = 0;
+  tsc->restores++;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Text function
+  Use:      Adaptive TS clock status
+            Used to display the current TS clock and the TS efficiency
+  Parameter: tsc, a pointer to the adaptive TS clock
+  Parameter: text, the output buffer
+  Parameter: size, the output buffer size
+  Returns:  the TS efficiency in percent
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Text                    (SILABS_TS_Clock *tsc, char *text, signed   int size) {
+  const char *mode;
+  switch (tsc->mode) {
+    case SILABS_TS_CLOCK_GAPPED    : { mode = "MANUAL gapped"        ; break; }
+    case SILABS_TS_CLOCK_CONTINUOUS: { mode = "AUTO_ADAPT continuous"; break; }
+    default                        : { mode = "application settings" ; break; }
+  }
+  snprintf(text, size, "%s %s: %s %d kHz (DIV_A %d, DIV_B %d)\n payload %d kbps, TS clock %d kHz, efficiency %d%%\n margin %d%%, hysteresis %d%%, down_polls %d, step %d kHz\n %lu polls, %lu raises, %lu reductions, %lu restores, last change %d ms\n"
+    , tsc->front_end->tag, tsc->enabled ? (tsc->parallel ? "PARALLEL" : "SERIAL") : "(disabled)", mode, tsc->clock_khz, tsc->div_a, tsc->div_b
+    , tsc->payload_kbps, tsc->measured_khz, tsc->efficiency_pct
+    , tsc->margin_pct, tsc->hysteresis_pct, tsc->down_polls, tsc->step_khz
+    , tsc->polls, tsc->raises, tsc->reductions, tsc->restores, tsc->last_ms);
+  return tsc->efficiency_pct;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_TS_Clock_Test function
+  Use:      Generic test pipe function
+            Used to send a generic command to the adaptive TS clock.
+  Returns:  0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Clock_Test                    (SILABS_TS_Clock *tsc, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  CUSTOM_Status_Struct status;
+  signed   int margin_pct;
+  signed   int hysteresis_pct;
+  signed   int down_polls;
+  signed   int step_khz;
+  signed   int max_khz;
+  target   = target;   /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible adaptive TS clock test commands:\n\
+status                            : current TS clock and TS efficiency\n\
+enable             <0/1>          : adapt the TS clock, or restore the application settings\n\
+config                            : set the policy (sub_cmd '<margin_pct> <hysteresis_pct> <down_polls> <step_khz> <max_khz>')\n\
+poll                              : read DD_STATUS and adapt the TS clock\n\
+tone_cancel        <0/1>          : refresh the TER tuner tone canceller after each clock change\n\
+restore                           : restore the application settings until the next poll\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = SiLabs_TS_Clock_Text(tsc, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "enable"             ) == 0) {
+    *retdval = SiLabs_TS_Clock_Config(tsc, (signed int)dval, tsc->margin_pct, tsc->hysteresis_pct, tsc->down_polls, tsc->step_khz, tsc->max_khz);
+    SiLabs_TS_Clock_Text(tsc, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "config"             ) == 0) {
+    margin_pct     = TS_CLOCK_MARGIN_PCT;
+    hysteresis_pct = TS_CLOCK_HYSTERESIS_PCT;
+    down_polls     = TS_CLOCK_DOWN_POLLS;
+    step_khz       = TS_CLOCK_STEP_KHZ;
+    max_khz        = 0;
+    sscanf(sub_cmd, "%d %d %d %d %d", &margin_pct, &hysteresis_pct, &down_polls, &step_khz, &max_khz);
+    *retdval = SiLabs_TS_Clock_Config(tsc, tsc->enabled, margin_pct, hysteresis_pct, down_polls, step_khz, max_khz);
+    SiLabs_TS_Clock_Text(tsc, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "poll"               ) == 0) {
+    SiLabs_API_Demod_status_selection(tsc->front_end, &status, FE_LOCK_STATE);
+    *retdval = SiLabs_TS_Clock_Text(tsc, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "tone_cancel"        ) == 0) {
+    tsc->tone_cancel = (signed int)dval;
+    *retdval = tsc->tone_cancel;
+    snprintf(*rettxt, 1000, "tone canceller refresh %s\n", tsc->tone_cancel ? "enabled" : "disabled");
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "restore"            ) == 0) {
+    *retdval = SiLabs_TS_Clock_Restore(tsc);
+    SiLabs_TS_Clock_Text(tsc, *rettxt, 1000);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ADAPTIVE_TS_CLOCK */
@@ -0,0 +1,92 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_TS_Clock_H_
+#define  _SiLabs_API_L3_Wrapper_TS_Clock_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[TS/adaptive_clock] Adding adaptive TS clocks via SiLabs_API_L3_Wrapper_TS_Clock.c/.h
+        The TS clock is set from the TS bitrate measured by DD_STATUS, with hysteresis, and the TS efficiency is reported.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TS_CLOCK_MARGIN_PCT            10  /* Default clock margin above the payload rate, in percent                             */
+#define TS_CLOCK_HYSTERESIS_PCT        20  /* Default: the clock is only reduced if the new clock is at least 20% lower          */
+#define TS_CLOCK_DOWN_POLLS             3  /* Default number of consecutive polls below the threshold before reducing the clock  */
+#define TS_CLOCK_STEP_KHZ             500  /* Default clock granularity, in kHz                                                  */
+#define TS_CLOCK_MIN_KHZ             1000  /* Default minimum clock, in kHz                                                      */
+
+/* possible values for the adaptive TS clock modes */
+typedef enum _SILABS_TS_Clock_Mode                {
+  SILABS_TS_CLOCK_DEFAULT       = 0,  /* application settings (not adapted, or restored)                        */
+  SILABS_TS_CLOCK_GAPPED        = 1,  /* MANUAL clock with gapped clock, set from the measured payload rate      */
+  SILABS_TS_CLOCK_CONTINUOUS    = 2   /* AUTO_ADAPT continuous clock, when the MANUAL clock would be too high    */
+} SILABS_TS_Clock_Mode;
+
+/* Structure used to store the adaptive TS clock information of one front-end */
+typedef struct _SILABS_TS_Clock                   {
+  SILABS_FE_Context            *front_end;
+  signed   int                  enabled;
+  signed   int                  margin_pct;
+  signed   int                  hysteresis_pct;
+  signed   int                  down_polls;
+  signed   int                  step_khz;
+  signed   int                  min_khz;
+  signed   int                  max_khz;         /* maximum MANUAL clock, 0 to use DD_TS_FREQ_MAX                               */
+  signed   int                  tone_cancel;     /* 1 to refresh the TER tuner tone canceller after each clock change           */
+  SILABS_TS_Clock_Mode          mode;
+  signed   int                  clock_khz;       /* MANUAL clock in GAPPED mode                                                 */
+  signed   int                  parallel;        /* 1 for a parallel TS (8 bits per clock cycle)                                */
+  signed   int                  saved;           /* 1 once the application settings are saved                                   */
+  signed   int                  saved_clock;     /* application settings, as used by SiLabs_API_TS_Config                       */
+  signed   int                  saved_gapped;
+  signed   int                  payload_kbps;    /* last TS bitrate reported by DD_STATUS                                       */
+  signed   int                  measured_khz;    /* last TS clock   reported by DD_STATUS                                       */
+  signed   int                  efficiency_pct;  /* payload_kbps vs. TS clock capacity, in percent                              */
+  signed   int                  below;           /* consecutive polls below the hysteresis threshold                            */
+  unsigned int                  div_a;           /* TS clock dividers after the last clock change                               */
+  unsigned int                  div_b;
+  unsigned long                 polls;
+  unsigned long                 raises;
+  unsigned long                 reductions;
+  unsigned long                 restores;
+  signed   int                  last_ms;         /* duration of the last clock change                                           */
+} SILABS_TS_Clock;
+
+extern SILABS_TS_Clock  TS_Clock_Table[FRONT_END_COUNT];
+
+SILABS_TS_Clock *SiLabs_TS_Clock_Of                    (SILABS_FE_Context *front_end);
+signed   int   SiLabs_TS_Clock_Init                    (SILABS_TS_Clock *tsc, SILABS_FE_Context *front_end);
+signed   int   SiLabs_TS_Clock_Config                  (SILABS_TS_Clock *tsc, signed   int enabled, signed   int margin_pct, signed   int hysteresis_pct, signed   int down_polls, signed   int step_khz, signed   int max_khz);
+signed   int   SiLabs_TS_Clock_Target                  (SILABS_TS_Clock *tsc, signed   int payload_kbps);
+signed   int   SiLabs_TS_Clock_Update                  (SILABS_TS_Clock *tsc, signed   int fec_lock, signed   int payload_kbps, signed   int measured_khz);
+signed   int   SiLabs_TS_Clock_Restore                 (SILABS_TS_Clock *tsc);
+signed   int   SiLabs_TS_Clock_Text                    (SILABS_TS_Clock *tsc, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_TS_Clock_Test                    (SILABS_TS_Clock *tsc, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_TS_Clock_H_ */
@@ -23,6 +23,14 @@ limitations under the License.
 /* Change log: */
 /* Last  changes:
 
+  As from V2.8.1:
+   <new_feature>[TS_Crossbar/Router] Adding the TS router, for several duals wired to several TS ports (i.e. FPGA capture ports):
+    SiLabs_TS_Router_Init, SiLabs_TS_Router_Add_Dual, SiLabs_TS_Router_Add_Port and SiLabs_TS_Router_Wire to describe the board.
+    SiLabs_TS_Router_Request and SiLabs_TS_Router_Solve to compute a conflict-free assignment before any i2c traffic,
+     changing the smallest number of current routes.
+    SiLabs_TS_Router_Apply to switch only the front-ends with a new route, in break-before-make order, with timing.
+    SiLabs_TS_Router_Route, SiLabs_TS_Router_Port_Of, SiLabs_TS_Router_Text and SiLabs_TS_Router_Test.
+
   As from V2.5.2:
    <improvement>[comments] In SiLabs_TS_Crossbar_TS1_TS2: comment correction
 
@@ -145,7 +153,7 @@ signed   int   SiLabs_TS_Crossbar_TS_Status       (SILABS_TS_Crossbar *ts_crossb
   signed   int conflicts=0;
   SiTRACE("API CALL XBAR  : SiLabs_TS_Crossbar_TS_Status (ts_crossbar)\n");
 #ifdef    Si2183_COMPATIBLE
-  if (ts_crossbar->fe_A->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(ts_crossbar->fe_A) ==   0x2183 ) {
  #ifdef    Si2183_DD_TS_PINS_CMD
 
     ts_crossbar->fe_A->Si2183_FE->demod->cmd->dd_ts_pins.primary_ts_mode     = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_NO_CHANGE;
@@ -337,7 +345,7 @@ signed   int   SiLabs_TS_Crossbar_TS1_TS2         (SILABS_TS_Crossbar *ts_crossb
   SiTRACE ("TS_2 (%s/%s) -> (%s/%-8s)\n", SiLabs_TS_Crossbar_Signal_Text(ts_crossbar->ts_2_signal), Silabs_TS_Mode_Text(ts_crossbar->ts_2->ts_mode), SiLabs_TS_Crossbar_Signal_Text(ts_2_signal), Silabs_TS_Mode_Text(ts_2_mode) );
 
 #ifdef    Si2183_COMPATIBLE
-  if (ts_crossbar->fe_A->chip ==   0x2183 ) {
+  if (SILABS_DEMOD_CHIP(ts_crossbar->fe_A) ==   0x2183 ) {
  #ifdef    Si2183_DD_TS_PINS_CMD
     if (ts_crossbar->fe_A->Si2183_FE->demod->rsp->get_rev.mcm_die  == Si2183_GET_REV_RESPONSE_MCM_DIE_SINGLE) {
       SiTRACE("Invalid XBAR use: the part is not a dual demodulator. TS Crossbar is only possible with dual demodulators !\n");
@@ -573,6 +581,539 @@ signed   int   SiLabs_TS_Crossbar_TS1_TS2         (SILABS_TS_Crossbar *ts_crossb
   SiERROR ("SiLabs_TS_Crossbar_TS2_Signal not supported by current part!\n");
   return 0;
 }
+/************************************************************************************************************************
+  TS router functions
+  The TS router manages several duals, with their TS1/TS2 pads wired to TS ports (i.e. FPGA capture ports).
+  Each demodulator can drive a single pad at a time, using its primary or secondary output:
+    demod A (die 2n)   primary drives TS1 (pad 2n),   secondary drives TS2 (pad 2n+1)
+    demod B (die 2n+1) primary drives TS2 (pad 2n+1), secondary drives TS1 (pad 2n)
+  Several pads wired to the same port form a shared bus, driven by a single pad at a time.
+************************************************************************************************************************/
+SILABS_TS_Router  TS_Router_Context;
+
+/* Structure used during the route search */
+typedef struct _SILABS_TS_Router_Search       {
+  signed   int        die        [TS_ROUTER_MAX_DIES];
+  signed   int        nb_dies;
+  unsigned char       pad_used   [TS_ROUTER_MAX_PADS];
+  unsigned char       port_used  [TS_ROUTER_MAX_PORTS];
+  signed   int        port       [TS_ROUTER_MAX_DIES];
+  signed   int        output     [TS_ROUTER_MAX_DIES];
+  signed   int        best_port  [TS_ROUTER_MAX_DIES];
+  signed   int        best_output[TS_ROUTER_MAX_DIES];
+  signed   int        best_cost;
+} SILABS_TS_Router_Search;
+
+static signed   int   SiLabs_TS_Router_Pad           (signed   int die, signed   int output) {
+  return 2*(die/2) + ((die%2) ^ output);
+}
+static signed   int   SiLabs_TS_Router_Die_Of        (SILABS_TS_Router *router, SILABS_FE_Context *fe) {
+  signed   int d;
+  if (fe == NULL) { return -1; }
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    if (router->die[d].fe == fe) { return d; }
+  }
+  return -1;
+}
+static signed   int   SiLabs_TS_Router_Config_Differs(SILABS_TS_Config *a, SILABS_TS_Config *b) {
+  if (a->ts_mode                   != b->ts_mode                  ) { return 1; }
+  if (a->ts_mode == SILABS_TS_SERIAL) {
+    if (a->ts_serial_data_strength != b->ts_serial_data_strength  ) { return 1; }
+    if (a->ts_serial_data_shape    != b->ts_serial_data_shape     ) { return 1; }
+    if (a->ts_serial_clk_strength  != b->ts_serial_clk_strength   ) { return 1; }
+    if (a->ts_serial_clk_shape     != b->ts_serial_clk_shape      ) { return 1; }
+    if (a->ts_serial_slr_enable    != b->ts_serial_slr_enable     ) { return 1; }
+    if (a->ts_serial_clk_slr       != b->ts_serial_clk_slr        ) { return 1; }
+    if (a->ts_serial_data_slr      != b->ts_serial_data_slr       ) { return 1; }
+  } else {
+    if (a->ts_parallel_data_strength != b->ts_parallel_data_strength) { return 1; }
+    if (a->ts_parallel_data_shape    != b->ts_parallel_data_shape   ) { return 1; }
+    if (a->ts_parallel_clk_strength  != b->ts_parallel_clk_strength ) { return 1; }
+    if (a->ts_parallel_clk_shape     != b->ts_parallel_clk_shape    ) { return 1; }
+  }
+  return 0;
+}
+/* Sending DD_TS_PINS to a demodulator, with each output driving (1) or not used (0) */
+static signed   int   SiLabs_TS_Router_Pins          (SILABS_FE_Context *fe, signed   int primary, signed   int secondary) {
+  primary   = primary;   /* To avoid compiler warning if not used */
+  secondary = secondary; /* To avoid compiler warning if not used */
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(fe) ==   0x2183 ) {
+ #ifdef    Si2183_DD_TS_PINS_CMD
+    fe->Si2183_FE->demod->cmd->dd_ts_pins.primary_ts_mode   = primary   ? Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_DRIVE_TS   : Si2183_DD_TS_PINS_CMD_PRIMARY_TS_MODE_NOT_USED;
+    fe->Si2183_FE->demod->cmd->dd_ts_pins.secondary_ts_mode = secondary ? Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_DRIVE_TS : Si2183_DD_TS_PINS_CMD_SECONDARY_TS_MODE_NOT_USED;
+    if (Si2183_L1_SendCommand2 (fe->Si2183_FE->demod, Si2183_DD_TS_PINS_CMD_CODE ) != NO_Si2183_ERROR) {
+      SiTRACE ("TS Router ERROR when changing %s DD_TS_PINS!\n", fe->tag);
+      SiERROR ("TS Router ERROR when changing DD_TS_PINS!\n");
+      return 0;
+    }
+    return 1;
+ #endif /* Si2183_DD_TS_PINS_CMD */
+  }
+#endif /* Si2183_COMPATIBLE */
+  SiERROR ("SiLabs_TS_Router_Pins not supported by current part!\n");
+  return 0;
+}
+/* Setting the TS mode, strengths and shapes of a demodulator output (only the properties with new values are sent) */
+static signed   int   SiLabs_TS_Router_Setup         (SILABS_FE_Context *fe, signed   int output, SILABS_TS_Config *config) {
+  output = output; /* To avoid compiler warning if not used */
+  config = config; /* To avoid compiler warning if not used */
+#ifdef    Si2183_COMPATIBLE
+  if (SILABS_DEMOD_CHIP(fe) ==   0x2183 ) {
+ #ifdef    Si2183_DD_TS_PINS_CMD
+    if (config->ts_mode == SILABS_TS_SERIAL  ) {
+      if (output == TS_ROUTER_PRIMARY) {
+        fe->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_data_strength     = config->ts_serial_data_strength;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_data_shape        = config->ts_serial_data_shape;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_clk_strength      = config->ts_serial_clk_strength;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_ser.ts_clk_shape         = config->ts_serial_clk_shape;
+        Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_TS_SETUP_SER_PROP_CODE );
+      } else {
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_ser.ts_data_strength = config->ts_serial_data_strength;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_ser.ts_data_shape    = config->ts_serial_data_shape;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_ser.ts_clk_strength  = config->ts_serial_clk_strength;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_ser.ts_clk_shape     = config->ts_serial_clk_shape;
+        Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_SEC_TS_SETUP_SER_PROP_CODE );
+      }
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data_slr     = config->ts_serial_data_slr;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data_slr_on  = config->ts_serial_slr_enable;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data1_slr    = config->ts_serial_data_slr;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data1_slr_on = config->ts_serial_slr_enable;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data2_slr    = config->ts_serial_data_slr;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_data2_slr_on = config->ts_serial_slr_enable;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_clk_slr      = config->ts_serial_clk_slr;
+      fe->Si2183_FE->demod->prop->dd_ts_slr_serial.ts_clk_slr_on   = config->ts_serial_slr_enable;
+      Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_TS_SLR_SERIAL_PROP_CODE );
+      fe->Si2183_FE->demod->prop->dd_ts_mode.mode = Si2183_DD_TS_MODE_PROP_MODE_SERIAL;
+    } else {
+      if (output == TS_ROUTER_PRIMARY) {
+        fe->Si2183_FE->demod->prop->dd_ts_setup_par.ts_data_strength     = config->ts_parallel_data_strength;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_par.ts_data_shape        = config->ts_parallel_data_shape;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_par.ts_clk_strength      = config->ts_parallel_clk_strength;
+        fe->Si2183_FE->demod->prop->dd_ts_setup_par.ts_clk_shape         = config->ts_parallel_clk_shape;
+        Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_TS_SETUP_PAR_PROP_CODE );
+      } else {
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_par.ts_data_strength = config->ts_parallel_data_strength;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_par.ts_data_shape    = config->ts_parallel_data_shape;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_par.ts_clk_strength  = config->ts_parallel_clk_strength;
+        fe->Si2183_FE->demod->prop->dd_sec_ts_setup_par.ts_clk_shape     = config->ts_parallel_clk_shape;
+        Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_SEC_TS_SETUP_PAR_PROP_CODE );
+      }
+      fe->Si2183_FE->demod->prop->dd_ts_mode.mode = Si2183_DD_TS_MODE_PROP_MODE_PARALLEL;
+    }
+    Si2183_L1_SetProperty2(fe->Si2183_FE->demod, Si2183_DD_TS_MODE_PROP_CODE );
+    return 1;
+ #endif /* Si2183_DD_TS_PINS_CMD */
+  }
+#endif /* Si2183_COMPATIBLE */
+  SiERROR ("SiLabs_TS_Router_Setup not supported by current part!\n");
+  return 0;
+}
+/* Depth-first search of the routes, keeping the assignment with the smallest number of changed routes */
+static void           SiLabs_TS_Router_Search_Level  (SILABS_TS_Router *router, SILABS_TS_Router_Search *search, signed   int level, signed   int cost) {
+  SILABS_TS_Router_Die *die;
+  signed   int d;
+  signed   int k;
+  signed   int i;
+  signed   int output;
+  signed   int pad;
+  signed   int p;
+  if (cost >= search->best_cost) { return; }
+  if (level == search->nb_dies) {
+    for (i = 0; i < search->nb_dies; i++) {
+      search->best_port  [i] = search->port  [i];
+      search->best_output[i] = search->output[i];
+    }
+    search->best_cost = cost;
+    return;
+  }
+  d   = search->die[level];
+  die = &(router->die[d]);
+  for (k = 0; k < 2; k++) {
+    /* Trying the current output first, to keep the current route when possible */
+    output = (die->port >= 0) ? (die->output ^ k) : k;
+    /* A single demodulator only drives its primary output */
+    if ( (output == TS_ROUTER_SECONDARY) & (router->die[d^1].fe == NULL) ) { continue; }
+    pad = SiLabs_TS_Router_Pad(d, output);
+    p   = router->pad_port[pad];
+    if (p < 0                                         ) { continue; }
+    if ( (die->request >= 0) & (die->request != p)    ) { continue; }
+    if (search->pad_used[pad] | search->port_used[p]  ) { continue; }
+    if ( (router->port[p].config.ts_mode != SILABS_TS_SERIAL) & (router->port[p].config.ts_mode != SILABS_TS_PARALLEL) ) { continue; }
+    router->searched++;
+    search->pad_used [pad] = 1;
+    search->port_used[p]   = 1;
+    search->port  [level]  = p;
+    search->output[level]  = output;
+    SiLabs_TS_Router_Search_Level (router, search, level + 1, cost + ( ( (p != die->port) | (output != die->output) ) ? 1 : 0 ) );
+    search->pad_used [pad] = 0;
+    search->port_used[p]   = 0;
+  }
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Init function
+  Use:      TS router initialization function
+            Used to clear all duals, ports and routes. There is no i2c traffic.
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Init              (SILABS_TS_Router *router) {
+  signed   int i;
+  SiTRACE("API CALL ROUTER: SiLabs_TS_Router_Init (router)\n");
+  memset(router, 0, sizeof(SILABS_TS_Router));
+  for (i = 0; i < TS_ROUTER_MAX_DIES;  i++) {
+    router->die[i].request = TS_ROUTER_NO_ROUTE;
+    router->die[i].port    = -1;
+    router->die[i].next_port = -1;
+  }
+  for (i = 0; i < TS_ROUTER_MAX_PADS;  i++) { router->pad_port[i] = -1; }
+  for (i = 0; i < TS_ROUTER_MAX_PORTS; i++) { router->port[i].die = -1; }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Add_Dual function
+  Use:      TS router dual declaration function
+            Used to add a dual demodulator (or a single demodulator, with fe_B NULL) to the router
+  Returns:  the index of the dual, -1 if error
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Add_Dual          (SILABS_TS_Router *router, SILABS_FE_Context *fe_A, SILABS_FE_Context *fe_B) {
+  signed   int dual;
+  signed   int d;
+  SILABS_FE_Context *fe;
+  if (fe_A == NULL) { SiERROR ("no fe_A pointer!\n"); return -1; }
+  if (router->nb_duals >= TS_ROUTER_MAX_DUALS) { SiERROR ("TS router: too many duals!\n"); return -1; }
+  dual = router->nb_duals;
+  SiTRACE("API CALL ROUTER: SiLabs_TS_Router_Add_Dual (router, %s, %s) dual %d\n", fe_A->tag, (fe_B == NULL) ? "none" : fe_B->tag, dual);
+  router->die[2*dual  ].fe = fe_A;
+  router->die[2*dual+1].fe = fe_B;
+  for (d = 2*dual; d < 2*dual + 2; d++) {
+    fe = router->die[d].fe;
+    if (fe == NULL) { continue; }
+#ifdef    Si2183_COMPATIBLE
+    if (SILABS_DEMOD_CHIP(fe) ==   0x2183 ) {
+      /* Set DD_TS_PINS 'activity' fields to 'CLEAR' */
+      fe->Si2183_FE->demod->cmd->dd_ts_pins.primary_ts_activity   = Si2183_DD_TS_PINS_CMD_PRIMARY_TS_ACTIVITY_CLEAR;
+      fe->Si2183_FE->demod->cmd->dd_ts_pins.secondary_ts_activity = Si2183_DD_TS_PINS_CMD_SECONDARY_TS_ACTIVITY_CLEAR;
+    }
+#endif /* Si2183_COMPATIBLE */
+  }
+  router->nb_duals++;
+  router->solved = 0;
+  return dual;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Add_Port function
+  Use:      TS router port declaration function
+            Used to add a TS port, with the TS mode, strengths and shapes to use on this port
+  Parameter: config, the port configuration (a SILABS_TS_Config filled using SiLabs_TS_Crossbar_TS_Mode,
+              SiLabs_TS_Crossbar_Serial_Config and SiLabs_TS_Crossbar_Parallel_Config)
+  Returns:  the index of the port, -1 if error
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Add_Port          (SILABS_TS_Router *router, SILABS_TS_Config *config) {
+  signed   int port;
+  if (config == NULL) { SiERROR ("no config pointer!\n"); return -1; }
+  if (router->nb_ports >= TS_ROUTER_MAX_PORTS) { SiERROR ("TS router: too many ports!\n"); return -1; }
+  port = router->nb_ports;
+  SiTRACE("API CALL ROUTER: SiLabs_TS_Router_Add_Port (router, %s) port %d\n", Silabs_TS_Mode_Text(config->ts_mode), port);
+  router->port[port].config   = *config;
+  router->port[port].nb_pads  = 0;
+  router->port[port].die      = -1;
+  router->port[port].reroutes = 0;
+  router->nb_ports++;
+  router->solved = 0;
+  return port;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Wire function
+  Use:      TS router wiring function
+            Used to declare that the TS1 or TS2 pad of a dual is wired to a TS port
+  Parameter: port, the index of the port
+  Parameter: dual, the index of the dual
+  Parameter: ts,   1 for TS1, 2 for TS2
+  Returns:  1 if successful, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Wire              (SILABS_TS_Router *router, signed   int port, signed   int dual, signed   int ts) {
+  signed   int pad;
+  SiTRACE("API CALL ROUTER: SiLabs_TS_Router_Wire (router, port %d, dual %d, TS%d)\n", port, dual, ts);
+  if ( (port < 0) | (port >= router->nb_ports) ) { SiERROR ("TS router: invalid port!\n"); return 0; }
+  if ( (dual < 0) | (dual >= router->nb_duals) ) { SiERROR ("TS router: invalid dual!\n"); return 0; }
+  if ( (ts   < 1) | (ts   > 2)                 ) { SiERROR ("TS router: invalid TS pad!\n"); return 0; }
+  pad = 2*dual + ts - 1;
+  if (router->pad_port[pad] >= 0) { router->port[router->pad_port[pad]].nb_pads--; }
+  router->pad_port[pad] = port;
+  router->port[port].nb_pads++;
+  router->solved = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Request function
+  Use:      TS router route request function
+            Used to store the route request of a front-end, applied at the next SiLabs_TS_Router_Apply
+  Parameter: fe,   the front-end
+  Parameter: port, the requested port, TS_ROUTER_ANY_PORT for any port wired to the front-end, or TS_ROUTER_NO_ROUTE
+  Returns:  1 if successful, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Request           (SILABS_TS_Router *router, SILABS_FE_Context *fe, signed   int port) {
+  signed   int d;
+  d = SiLabs_TS_Router_Die_Of(router, fe);
+  if (d < 0) { SiERROR ("TS router: front-end not declared!\n"); return 0; }
+  if ( (port >= router->nb_ports) | (port < TS_ROUTER_NO_ROUTE) ) { SiERROR ("TS router: invalid port!\n"); return 0; }
+  SiTRACE("API CALL ROUTER: SiLabs_TS_Router_Request (router, %s, %d)\n", fe->tag, port);
+  if (router->die[d].request != port) {
+    router->die[d].request = port;
+    router->solved = 0;
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Solve function
+  Use:      TS router solver
+            Used to compute a conflict-free route for all requests, without any i2c traffic:
+              each demodulator drives a single pad, with its primary or secondary output,
+              each pad is driven by a single demodulator,
+              each port (including shared buses) is driven by a single pad.
+            Among the possible solutions, the one changing the smallest number of current routes is selected,
+             such that routing a front-end doesn't move the other ones unless this is the only possible solution.
+  Returns:  1 if a solution is found, 0 otherwise (the routes are then not changed)
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Solve             (SILABS_TS_Router *router) {
+  SILABS_TS_Router_Search  search;
+  SILABS_TS_Router_Die    *die;
+  signed   int d;
+  signed   int i;
+  memset(&search, 0, sizeof(search));
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    router->die[d].next_port   = -1;
+    router->die[d].next_output = TS_ROUTER_PRIMARY;
+    if (router->die[d].fe == NULL                     ) { continue; }
+    if (router->die[d].request == TS_ROUTER_NO_ROUTE  ) { continue; }
+    search.die[search.nb_dies++] = d;
+  }
+  search.best_cost = search.nb_dies + 1;
+  router->searched = 0;
+  SiLabs_TS_Router_Search_Level (router, &search, 0, 0);
+  if (search.best_cost > search.nb_dies) {
+    SiTRACE("TS router: no conflict-free route for the current requests (%d candidates tried):\n", router->searched);
+    for (i = 0; i < search.nb_dies; i++) {
+      die = &(router->die[search.die[i]]);
+      SiTRACE("TS router:   %s requests port %d (TS%d wired to port %d, TS%d wired to port %d)\n", die->fe->tag, die->request,
+        SiLabs_TS_Router_Pad(search.die[i], TS_ROUTER_PRIMARY  )%2 + 1, router->pad_port[SiLabs_TS_Router_Pad(search.die[i], TS_ROUTER_PRIMARY  )],
+        SiLabs_TS_Router_Pad(search.die[i], TS_ROUTER_SECONDARY)%2 + 1, router->pad_port[SiLabs_TS_Router_Pad(search.die[i], TS_ROUTER_SECONDARY)]);
+    }
+    SiERROR("TS router: route conflict!\n");
+    router->solved = 0;
+    return 0;
+  }
+  for (i = 0; i < search.nb_dies; i++) {
+    router->die[search.die[i]].next_port   = search.best_port  [i];
+    router->die[search.die[i]].next_output = search.best_output[i];
+  }
+  router->changes = 0;
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    die = &(router->die[d]);
+    if (die->fe == NULL) { continue; }
+    if ( (die->pins_known == 0) | (die->next_port != die->port) | (die->next_output != die->output) ) { router->changes++; continue; }
+    if (die->next_port >= 0) {
+      if (SiLabs_TS_Router_Config_Differs(&(die->applied), &(router->port[die->next_port].config))) { router->changes++; }
+    }
+  }
+  SiTRACE("TS router: solved with %d changes (%d candidates tried)\n", router->changes, router->searched);
+  router->solved = 1;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Apply function
+  Use:      TS router apply function
+            Used to apply the solved routes, only on the demodulators with a new route (or a new port configuration):
+              1- disable the outputs of all these demodulators
+              2- set the TS mode, strengths and shapes for the new routes
+              3- enable the new outputs
+            Since all outputs to move are disabled before enabling any new output, two pads never drive the same port,
+             and the demodulators not moving are not accessed.
+            On the first apply, the outputs of all demodulators are disabled, since their initial state is unknown.
+  Returns:  1 if successful, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Apply             (SILABS_TS_Router *router) {
+  SILABS_TS_Router_Die *die;
+  unsigned char move[TS_ROUTER_MAX_DIES];
+  signed   int start_ms;
+  signed   int errors;
+  signed   int d;
+  if (router->solved == 0) {
+    if (SiLabs_TS_Router_Solve(router) == 0) { return 0; }
+  }
+  start_ms = system_time();
+  router->commands = 0;
+  errors = 0;
+  /* Finding the demodulators to move */
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    die = &(router->die[d]);
+    move[d] = 0;
+    if (die->fe == NULL) { continue; }
+    if ( (die->pins_known == 0) | (die->next_port != die->port) | (die->next_output != die->output) ) { move[d] = 1; continue; }
+    if (die->next_port >= 0) {
+      if (SiLabs_TS_Router_Config_Differs(&(die->applied), &(router->port[die->next_port].config))) { move[d] = 1; }
+    }
+  }
+  /* 1- break: disabling the outputs to move */
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    die = &(router->die[d]);
+    if (move[d] == 0) { continue; }
+    if ( (die->pins_known == 0) | (die->port >= 0) ) {
+      SiTRACE("TS router: disabling %s outputs\n", die->fe->tag);
+      if (SiLabs_TS_Router_Pins(die->fe, 0, 0) == 0) { errors++; }
+      router->commands++;
+    }
+    if (die->port >= 0) { router->port[die->port].die = -1; }
+    die->port       = -1;
+    die->pins_known = 1;
+  }
+  /* 2- configure: setting the TS mode, strengths and shapes of the new routes */
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    die = &(router->die[d]);
+    if ( (move[d] == 0) | (die->next_port < 0) ) { continue; }
+    SiLabs_TS_Router_Setup(die->fe, die->next_output, &(router->port[die->next_port].config));
+  }
+  /* 3- make: enabling the new outputs */
+  for (d = 0; d < 2*router->nb_duals; d++) {
+    die = &(router->die[d]);
+    if ( (move[d] == 0) | (die->next_port < 0) ) { continue; }
+    SiTRACE("TS router: enabling %s %s output on port %d\n", die->fe->tag, (die->next_output == TS_ROUTER_PRIMARY) ? "primary" : "secondary", die->next_port);
+    router->commands++;
+    if (SiLabs_TS_Router_Pins(die->fe, die->next_output == TS_ROUTER_PRIMARY, die->next_output == TS_ROUTER_SECONDARY) == 0) {
+      errors++;
+      die->pins_known = 0;
+      continue;
+    }
+    die->port    = die->next_port;
+    die->output  = die->next_output;
+    die->applied = router->port[die->port].config;
+    router->port[die->port].die = d;
+    router->port[die->port].reroutes++;
+  }
+  router->last_ms   = system_time() - start_ms;
+  router->total_ms += router->last_ms;
+  if (router->last_ms > router->max_ms) { router->max_ms = router->last_ms; }
+  router->applies++;
+  SiTRACE("TS router: %d changes applied in %d ms (%d DD_TS_PINS commands)\n", router->changes, router->last_ms, router->commands);
+  if (errors) {
+    router->solved = 0;
+    SiERROR("TS router: errors while applying the routes!\n");
+    return 0;
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Route function
+  Use:      TS router single route function
+            Used to change the route of a front-end, without disturbing the other front-ends if possible
+  Parameter: fe,   the front-end
+  Parameter: port, the requested port, TS_ROUTER_ANY_PORT or TS_ROUTER_NO_ROUTE
+  Returns:  1 if successful, 0 otherwise (in case of conflict, the previous request is restored and nothing is changed)
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Route             (SILABS_TS_Router *router, SILABS_FE_Context *fe, signed   int port) {
+  signed   int d;
+  signed   int previous;
+  d = SiLabs_TS_Router_Die_Of(router, fe);
+  if (d < 0) { SiERROR ("TS router: front-end not declared!\n"); return 0; }
+  previous = router->die[d].request;
+  if (SiLabs_TS_Router_Request(router, fe, port) == 0) { return 0; }
+  if (SiLabs_TS_Router_Solve(router) == 0) {
+    router->die[d].request = previous;
+    return 0;
+  }
+  return SiLabs_TS_Router_Apply(router);
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Port_Of function
+  Use:      TS router route retrieval function
+  Returns:  the port currently driven by the front-end, -1 if none
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Port_Of           (SILABS_TS_Router *router, SILABS_FE_Context *fe) {
+  signed   int d;
+  d = SiLabs_TS_Router_Die_Of(router, fe);
+  if (d < 0) { return -1; }
+  return router->die[d].port;
+}
+/************************************************************************************************************************
+  SiLabs_TS_Router_Text function
+  Use:      TS router status function
+            Used to list the ports with their current source
+  Returns:  the number of ports
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Text              (SILABS_TS_Router *router, char *text, signed   int size) {
+  SILABS_TS_Router_Die *die;
+  signed   int p;
+  signed   int n;
+  n = snprintf(text, size, "%d duals, %d ports, last apply %d ms (%d commands), max %d ms, %d applies\n", router->nb_duals, router->nb_ports, router->last_ms, router->commands, router->max_ms, router->applies);
+  for (p = 0; p < router->nb_ports; p++) {
+    if ( (n < 0) | (n >= size) ) { break; }
+    if (router->port[p].die >= 0) {
+      die = &(router->die[router->port[p].die]);
+      n += snprintf(text + n, size - n, "port %2d %-8s %d pads: %-10s %-9s (%d reroutes)\n", p, Silabs_TS_Mode_Text(router->port[p].config.ts_mode), router->port[p].nb_pads
+        , die->fe->tag, (die->output == TS_ROUTER_PRIMARY) ? "primary" : "secondary", router->port[p].reroutes);
+    } else {
+      n += snprintf(text + n, size - n, "port %2d %-8s %d pads: %-10s %-9s (%d reroutes)\n", p, Silabs_TS_Mode_Text(router->port[p].config.ts_mode), router->port[p].nb_pads
+        , "none", "", router->port[p].reroutes);
+    }
+  }
+  return router->nb_ports;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_TS_Router_Test function
+  Use:      Generic test pipe function
+            Used to send a generic command to the TS router.
+  Returns:  0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_TS_Router_Test              (SILABS_TS_Router *router, SILABS_FE_Context *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  SILABS_TS_Config config;
+  signed   int dual;
+  signed   int ts;
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible TS router test commands:\n\
+setup              <mode>         : add all front-end pairs as duals, with one port per pad (mode 1 serial, 2 parallel)\n\
+route              <port>         : route the current front-end to a port (-1 any port, -2 no route)\n\
+port                              : return the port driven by the current front-end\n\
+status                            : list the ports with their current source\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "setup"              ) == 0) {
+    SiLabs_TS_Router_Init(router);
+    memset(&config, 0, sizeof(config));
+    SiLabs_TS_Crossbar_TS_Mode         (&config, ((signed int)dval == 2) ? SILABS_TS_PARALLEL : SILABS_TS_SERIAL);
+    SiLabs_TS_Crossbar_Serial_Config   (&config, 7, 0, 7, 0, 0, 0, 0);
+    SiLabs_TS_Crossbar_Parallel_Config (&config, 3, 2, 4, 3);
+    for (dual = 0; 2*dual + 1 < FRONT_END_COUNT; dual++) {
+      if (SiLabs_TS_Router_Add_Dual(router, &(FrontEnd_Table[2*dual]), &(FrontEnd_Table[2*dual+1])) < 0) { break; }
+      for (ts = 1; ts <= 2; ts++) {
+        SiLabs_TS_Router_Wire(router, SiLabs_TS_Router_Add_Port(router, &config), dual, ts);
+      }
+    }
+    *retdval = router->nb_ports;
+    SiLabs_TS_Router_Text(router, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "route"              ) == 0) {
+    *retdval = SiLabs_TS_Router_Route(router, front_end, (signed int)dval);
+    SiLabs_TS_Router_Text(router, *rettxt, 1000);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "port"               ) == 0) {
+    *retdval = SiLabs_TS_Router_Port_Of(router, front_end);
+    snprintf(*rettxt, 1000, "%s port %d\n", front_end->tag, (signed int)*retdval);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "status"             ) == 0) {
+    *retdval = SiLabs_TS_Router_Text(router, *rettxt, 1000);
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
 
 #ifdef    __cplusplus
 }
@@ -17,6 +17,11 @@ limitations under the License.
 #define  _SiLabs_API_L3_Wrapper_TS_Crossbar_H_
 /* Change log:
 
+  As from V2.8.1:
+  <new_feature>[TS_Crossbar/Router] Adding a TS router for several duals wired to several TS ports (SiLabs_TS_Router_xxx functions).
+        A conflict-free assignment of the front-ends to the TS ports is computed before any i2c traffic,
+         and only the front-ends with a new route are switched, in break-before-make order.
+
   As from V2.4.0:
   <new_feature>[TS_Crossbar/Duals] Adding TS Crossbar capability via SiLabs_API_L3_TS_Crossbar.c/.h
         This is only valid for dual demodulators with the TS crossbar feature.
@@ -86,6 +91,69 @@ signed   int   SiLabs_TS_Crossbar_TS1_TS2         (SILABS_TS_Crossbar *ts_crossb
                                                    CUSTOM_TS_Mode_Enum      ts_1_mode  ,
                                                    CUSTOM_TS_Crossbar_Enum  ts_2_signal,
                                                    CUSTOM_TS_Mode_Enum      ts_2_mode );
+
+#define TS_ROUTER_MAX_DUALS          8                           /* Maximum number of dual demodulators in a TS router          */
+#define TS_ROUTER_MAX_DIES          (2*TS_ROUTER_MAX_DUALS)      /* Maximum number of demodulators (2 per dual)                 */
+#define TS_ROUTER_MAX_PADS          (2*TS_ROUTER_MAX_DUALS)      /* Maximum number of TS output pads (TS1/TS2 of each dual)     */
+#define TS_ROUTER_MAX_PORTS         16                           /* Maximum number of TS ports (i.e. FPGA capture ports)        */
+#define TS_ROUTER_ANY_PORT          -1                           /* Route request value: any port wired to the front-end        */
+#define TS_ROUTER_NO_ROUTE          -2                           /* Route request value: no route (the outputs are disabled)    */
+#define TS_ROUTER_PRIMARY            0                           /* Front-end output: primary   TS (TS1 for demod A, TS2 for B) */
+#define TS_ROUTER_SECONDARY          1                           /* Front-end output: secondary TS (TS2 for demod A, TS1 for B) */
+
+/* Structure used to store one TS port. Several pads wired to the same port form a shared bus, driven by a single pad at a time */
+typedef struct _SILABS_TS_Router_Port         {
+      SILABS_TS_Config    config;     /* TS mode, strengths and shapes used on this port        */
+      signed   int        nb_pads;    /* number of pads wired to this port                      */
+      signed   int        die;        /* index of the demodulator driving this port, -1 if none */
+      signed   int        reroutes;   /* number of changes of the demodulator driving this port */
+} SILABS_TS_Router_Port;
+
+/* Structure used to store one demodulator of a TS router. Demod A of dual 'n' is die 2n, demod B is die 2n+1 */
+typedef struct _SILABS_TS_Router_Die          {
+      SILABS_FE_Context  *fe;         /* NULL for the missing die of a single demodulator       */
+      signed   int        request;    /* requested port, TS_ROUTER_ANY_PORT or TS_ROUTER_NO_ROUTE */
+      signed   int        port;       /* port currently driven, -1 if none                      */
+      signed   int        output;     /* output currently driven (TS_ROUTER_PRIMARY/SECONDARY)  */
+      SILABS_TS_Config    applied;    /* configuration currently applied                        */
+      unsigned char       pins_known; /* 0 until the outputs have been set once by the router   */
+      signed   int        next_port;  /* route computed by SiLabs_TS_Router_Solve               */
+      signed   int        next_output;
+} SILABS_TS_Router_Die;
+
+/* Structure used to store all TS router information */
+typedef struct _SILABS_TS_Router              {
+      SILABS_TS_Router_Die  die [TS_ROUTER_MAX_DIES];
+      signed   int          nb_duals;
+      SILABS_TS_Router_Port port[TS_ROUTER_MAX_PORTS];
+      signed   int          nb_ports;
+      signed   int          pad_port[TS_ROUTER_MAX_PADS]; /* port wired to each pad, -1 if not wired  */
+      signed   int          solved;        /* 1 when next_port/next_output match the requests   */
+      signed   int          changes;       /* number of demodulators with a new route           */
+      signed   int          searched;      /* number of candidates tried by the last solve      */
+      signed   int          applies;
+      signed   int          commands;      /* DD_TS_PINS commands sent by the last apply        */
+      signed   int          last_ms;       /* duration of the last apply                        */
+      signed   int          max_ms;
+      signed   int          total_ms;
+} SILABS_TS_Router;
+
+extern SILABS_TS_Router  TS_Router_Context;
+
+signed   int   SiLabs_TS_Router_Init              (SILABS_TS_Router   *router);
+signed   int   SiLabs_TS_Router_Add_Dual          (SILABS_TS_Router   *router, SILABS_FE_Context  *fe_A, SILABS_FE_Context  *fe_B);
+signed   int   SiLabs_TS_Router_Add_Port          (SILABS_TS_Router   *router, SILABS_TS_Config   *config);
+signed   int   SiLabs_TS_Router_Wire              (SILABS_TS_Router   *router, signed   int port, signed   int dual, signed   int ts);
+signed   int   SiLabs_TS_Router_Request           (SILABS_TS_Router   *router, SILABS_FE_Context  *fe, signed   int port);
+signed   int   SiLabs_TS_Router_Solve             (SILABS_TS_Router   *router);
+signed   int   SiLabs_TS_Router_Apply             (SILABS_TS_Router   *router);
+signed   int   SiLabs_TS_Router_Route             (SILABS_TS_Router   *router, SILABS_FE_Context  *fe, signed   int port);
+signed   int   SiLabs_TS_Router_Port_Of           (SILABS_TS_Router   *router, SILABS_FE_Context  *fe);
+signed   int   SiLabs_TS_Router_Text              (SILABS_TS_Router   *router, char *text, signed   int size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_TS_Router_Test              (SILABS_TS_Router   *router, SILABS_FE_Context  *front_end, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
 #if defined( __cplusplus )
 }
 #endif
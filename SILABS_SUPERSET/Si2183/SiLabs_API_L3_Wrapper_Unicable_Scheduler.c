@@ -0,0 +1,645 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs API Unicable Scheduler Functions                                  */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains the Unicable user band scheduler, used when several receivers share a cable   */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ With several receivers on the same Unicable/JESS cable, each ODU_ChannelChange message is sent on the
+  same wire. Two messages sent at the same time are corrupted and ignored by the ODU, and the receivers
+  only see it as a lock failure.
+ The scheduler:
+  - allocates one user band (UB) to each receiver,
+  - queues the zap requests and sends only one ODU message at a time on the cable,
+  - re-sends after a random delay when the lock fails (EN50494 'Traffic collision management rules'),
+     the random delay being generated using the same PRBS as SiLabs_API_SAT_Random_Delay_Init/Shift,
+  - measures the zap latency (from request to lock) for each UB.
+ Messages from receivers not controlled by the scheduler (other STBs on the same cable) can still collide,
+  hence the backoff.
+
+ The scheduler never blocks for more than one ODU message: zaps are started and then checked using the lock
+  handshake, so SiLabs_Unicable_Scheduler_Process needs to be called periodically by the application.
+
+ Use case with 4 front-ends sharing a JESS cable:
+    SiLabs_Unicable_Scheduler_Init         ( scheduler, 0);
+    SiLabs_Unicable_Scheduler_Add_UB       ( scheduler, 0, 1210000);
+    SiLabs_Unicable_Scheduler_Add_UB       ( scheduler, 1, 1420000);
+    SiLabs_Unicable_Scheduler_Add_UB       ( scheduler, 2, 1680000);
+    SiLabs_Unicable_Scheduler_Add_UB       ( scheduler, 3, 2040000);
+    for (i=0; i<4; i++) { SiLabs_Unicable_Scheduler_Add_Receiver ( scheduler, &(FrontEnd_Table[i]) ); }
+    SiLabs_Unicable_Scheduler_Zap          ( scheduler, 0, SILABS_DVB_S2, 11778000, 27500000, SILABS_POLARIZATION_VERTICAL  , SILABS_BAND_HIGH);
+    SiLabs_Unicable_Scheduler_Zap          ( scheduler, 1, SILABS_DVB_S , 11953000, 27500000, SILABS_POLARIZATION_HORIZONTAL, SILABS_BAND_HIGH);
+    while (SiLabs_Unicable_Scheduler_Process(scheduler) > 0) { (other application tasks) }
+
+ Simulated cable (no HW required):
+    SiLabs_Unicable_Scheduler_Init         ( scheduler, 1);
+    SiLabs_Unicable_Scheduler_Simu_Config  ( scheduler, 350, 1000, 2000);
+    (add UBs and receivers with a NULL front_end, then zap and run as above)
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[Unicable/Multi_receivers] Initial version of the Unicable user band scheduler
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   UNICABLE_SCHEDULER
+  "If you get a compilation error on this line, it means that you included the Unicable_Scheduler code in your project without defining UNICABLE_SCHEDULER.";
+  "Please define UNICABLE_SCHEDULER at project-level, or remove the Unicable_Scheduler code from your project";
+#endif /* UNICABLE_SCHEDULER */
+
+#ifdef    UNICABLE_SCHEDULER
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          4
+#define   SiTAG            "UB_Sched "
+#include "SiLabs_API_L3_Wrapper_Unicable_Scheduler.h"
+
+SILABS_Unicable_Scheduler  Unicable_Scheduler_Context;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Time function
+  Use:      Scheduler time reference
+            Returns system_time() with real front-ends, or the simulated clock when using the simulated cable.
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Time          (SILABS_Unicable_Scheduler *scheduler) {
+  if (scheduler->simulated) { return scheduler->simu_time_ms; }
+  return system_time();
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_PRBS_Init function
+  Use:      PRBS sequence init for the random backoff, identical to SiLabs_API_SAT_Random_Delay_Init
+            Stored per receiver, such that simulated receivers (without front-end) can also use it.
+  Returns:  the final value on 10 bits
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_PRBS_Init     (unsigned char *PRBS, unsigned char UB) {
+  unsigned int   i;
+  signed   int   x;
+  for (i=0; i<10; i++) { PRBS[i] = 0; }
+  for (i=0; i<=3; i++) { PRBS[9-i] = PRBS[4-i] = (UB>>(3-i))&0x1; }
+  x = 0; for (i=0; i<10; i++) {  x = x + (PRBS[i]<<i); }
+  return x;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_PRBS_Shift function
+  Use:      PRBS sequence shift for the random backoff, identical to SiLabs_API_SAT_Random_Delay_Shift
+  Returns:  the final value on 10 bits
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_PRBS_Shift    (unsigned char *PRBS, signed   int shift) {
+  unsigned int   i;
+  signed   int   s;
+  signed   int   x;
+  unsigned char  P10;
+  for (s=0; s<shift; s++) {
+    P10 = (PRBS[7] + PRBS[0] + 1 )%2;
+    for (i=0; i< 9; i++) { PRBS[i] = PRBS[i+1]; }
+    PRBS[9] = P10;
+  }
+  x = 0; for (i=0; i<10; i++) {  x = x + (PRBS[i]<<i); }
+  return x;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_FE_Zap function
+  Use:      Default zap function, used with real front-ends
+            With new_zap = 1, selects the allocated UB and calls SiLabs_API_lock_to_carrier. This sends the ODU message,
+              tunes and returns after the first handshake period.
+            With new_zap = 0, calls SiLabs_API_lock_to_carrier again to continue checking the lock (handshake mode).
+  Returns:  1 if locked, 0 if failed, >1 while the lock is in progress
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_FE_Zap        (void *callback, SILABS_Unicable_Receiver *rx, signed   int new_zap) {
+  SILABS_Unicable_Scheduler *scheduler;
+  SILABS_FE_Context         *front_end;
+  scheduler = (SILABS_Unicable_Scheduler *)callback;
+  front_end = rx->front_end;
+  if (front_end == NULL) { return 0; }
+  if (new_zap) {
+    front_end->unicable->ub      = scheduler->ub[rx->ub].number;
+    front_end->unicable->Fub_kHz = scheduler->ub[rx->ub].Fub_kHz;
+#ifdef    Si2183_COMPATIBLE
+    if (SILABS_DEMOD_CHIP(front_end) ==   0x2183 ) { front_end->Si2183_FE->handshakeOn = 0; }
+#endif /* Si2183_COMPATIBLE */
+  }
+  return SiLabs_API_lock_to_carrier (front_end, rx->standard, rx->freq_kHz, 0, 0, rx->symbol_rate_bps, 0, rx->polarization, rx->band, 0, -1, 0);
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Simu_Foreign function
+  Use:      Simulated cable: traffic from receivers not controlled by the scheduler
+            Generates foreign ODU messages at random times (mean period simu_foreign_period_ms).
+            Any scheduler message on the cable at the same time is corrupted.
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Simu_Foreign  (SILABS_Unicable_Scheduler *scheduler) {
+  signed   int  i;
+  signed   int  start_ms;
+  signed   int  x;
+  SILABS_Unicable_Receiver *rx;
+  if (scheduler->simu_foreign_period_ms <= 0) { return 0; }
+  while (scheduler->simu_time_ms >= scheduler->simu_foreign_next_ms) {
+    start_ms = scheduler->simu_foreign_next_ms;
+    scheduler->simu_foreign_end_ms = start_ms + scheduler->message_ms;
+    for (i=0; i<scheduler->nbReceivers; i++) {
+      rx = &(scheduler->rx[i]);
+      if ( (rx->state == UNICABLE_RX_WAIT_LOCK) && (rx->simu_send_ms < scheduler->simu_foreign_end_ms) && (rx->simu_end_ms > start_ms) ) {
+        SiTRACE("simu: foreign message at %d ms corrupts rx %d message\n", start_ms, i);
+        rx->simu_corrupted = 1;
+      }
+    }
+    x = SiLabs_Unicable_Scheduler_PRBS_Shift(scheduler->simu_PRBS, 1);
+    scheduler->simu_foreign_next_ms = scheduler->simu_foreign_end_ms + ((x*2*scheduler->simu_foreign_period_ms)>>10);
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Simu_Zap function
+  Use:      Zap function used with the simulated cable
+            A message is corrupted if it overlaps with another message (from the scheduler or foreign) on the cable.
+            A clean message locks after simu_lock_ms, a corrupted message fails after simu_timeout_ms.
+  Returns:  1 if locked, 0 if failed, >1 while the lock is in progress
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Simu_Zap      (void *callback, SILABS_Unicable_Receiver *rx, signed   int new_zap) {
+  SILABS_Unicable_Scheduler *scheduler;
+  SILABS_Unicable_Receiver  *other;
+  signed   int  i;
+  signed   int  now;
+  scheduler = (SILABS_Unicable_Scheduler *)callback;
+  now = scheduler->simu_time_ms;
+  if (new_zap) {
+    rx->simu_send_ms   = now;
+    rx->simu_end_ms    = now + scheduler->message_ms;
+    rx->simu_corrupted = 0;
+    if (now < scheduler->simu_foreign_end_ms) { rx->simu_corrupted = 1; }
+    for (i=0; i<scheduler->nbReceivers; i++) {
+      other = &(scheduler->rx[i]);
+      if ( (other != rx) && (other->state == UNICABLE_RX_WAIT_LOCK) && (other->simu_end_ms > now) ) {
+        other->simu_corrupted = 1;
+        rx->simu_corrupted    = 1;
+      }
+    }
+    return 2;
+  }
+  if (rx->simu_corrupted) {
+    if (now < rx->simu_end_ms + scheduler->simu_timeout_ms) { return 2; }
+    return 0;
+  }
+  if (now < rx->simu_end_ms + scheduler->simu_lock_ms) { return 2; }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Init function
+  Use:      Scheduler initialization function
+            Used to clear the scheduler context and select real front-ends or the simulated cable
+  Parameter: scheduler, the SILABS_Unicable_Scheduler structure to fill
+  Parameter: simulated, 0 to use real front-ends, 1 to use the simulated cable
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Init          (SILABS_Unicable_Scheduler *scheduler, signed   int simulated) {
+  SiTRACE("SiLabs_Unicable_Scheduler_Init simulated %d\n", simulated);
+  if (scheduler == NULL) {
+    SiERROR ("no scheduler pointer!\n"); return 0;
+  }
+  memset(scheduler, 0, sizeof(SILABS_Unicable_Scheduler));
+  scheduler->serialize   = 1;
+  scheduler->gap_ms      = UNICABLE_SCHEDULER_GAP_MS;
+  scheduler->max_retries = UNICABLE_SCHEDULER_MAX_RETRIES;
+  /* EN50494: 18V signalling + 5 bytes at 13.5 ms + T4/T5 margin, as done in SiLabs_Unicable_API_send_message */
+  scheduler->message_ms  = 5 + 14*5 + 30;
+  scheduler->simulated   = (unsigned char)simulated;
+  scheduler->callback    = scheduler;
+  if (simulated) {
+    scheduler->f_zap     = SiLabs_Unicable_Scheduler_Simu_Zap;
+    SiLabs_Unicable_Scheduler_Simu_Config (scheduler, 350, 1000, 0);
+  } else {
+    scheduler->f_zap     = SiLabs_Unicable_Scheduler_FE_Zap;
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Simu_Config function
+  Use:      Simulated cable configuration function
+  Parameter: lock_ms,           time between the end of a clean ODU message and the lock
+  Parameter: timeout_ms,        time between the end of a corrupted ODU message and the lock failure
+  Parameter: foreign_period_ms, mean period of foreign ODU messages (0: no foreign traffic)
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Simu_Config   (SILABS_Unicable_Scheduler *scheduler, signed   int lock_ms, signed   int timeout_ms, signed   int foreign_period_ms) {
+  SiTRACE("SiLabs_Unicable_Scheduler_Simu_Config lock_ms %d timeout_ms %d foreign_period_ms %d\n", lock_ms, timeout_ms, foreign_period_ms);
+  scheduler->simu_lock_ms           = lock_ms;
+  scheduler->simu_timeout_ms        = timeout_ms;
+  scheduler->simu_foreign_period_ms = foreign_period_ms;
+  scheduler->simu_foreign_end_ms    = 0;
+  SiLabs_Unicable_Scheduler_PRBS_Init(scheduler->simu_PRBS, 0x0F);
+  scheduler->simu_foreign_next_ms   = scheduler->simu_time_ms + foreign_period_ms;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Add_UB function
+  Use:      Declares a user band available on the cable
+  Parameter: ub_number, the UB number used in the ODU message
+  Parameter: Fub_kHz,   the UB frequency
+  Returns:  the UB index in the scheduler, -1 if the table is full
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Add_UB        (SILABS_Unicable_Scheduler *scheduler, unsigned char ub_number, signed   int Fub_kHz) {
+  SILABS_Unicable_UB *ub;
+  if (scheduler->nbUBs >= UNICABLE_SCHEDULER_MAX_UBS) {
+    SiERROR("SiLabs_Unicable_Scheduler_Add_UB: UB table full!\n"); return -1;
+  }
+  ub = &(scheduler->ub[scheduler->nbUBs]);
+  memset(ub, 0, sizeof(SILABS_Unicable_UB));
+  ub->number  = ub_number;
+  ub->Fub_kHz = Fub_kHz;
+  ub->owner   = -1;
+  SiTRACE("SiLabs_Unicable_Scheduler_Add_UB ub[%d]: number %d, Fub_kHz %d\n", scheduler->nbUBs, ub_number, Fub_kHz);
+  return scheduler->nbUBs++;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Allocate_UB function
+  Use:      Allocates the first free UB to a receiver
+  Returns:  the UB index, -1 if all UBs are in use
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Allocate_UB   (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index) {
+  signed   int i;
+  for (i=0; i<scheduler->nbUBs; i++) {
+    if (scheduler->ub[i].owner == -1) {
+      scheduler->ub[i].owner = rx_index;
+      scheduler->rx[rx_index].ub = i;
+      SiTRACE("SiLabs_Unicable_Scheduler_Allocate_UB rx %d -> ub[%d] (number %d, %d kHz)\n", rx_index, i, scheduler->ub[i].number, scheduler->ub[i].Fub_kHz);
+      return i;
+    }
+  }
+  SiTRACE("SiLabs_Unicable_Scheduler_Allocate_UB rx %d: no free UB!\n", rx_index);
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Add_Receiver function
+  Use:      Declares a receiver on the cable and allocates a UB to it
+  Parameter: front_end, the receiver's front-end (NULL for a simulated receiver)
+  Returns:  the receiver index in the scheduler, -1 if the table is full
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Add_Receiver  (SILABS_Unicable_Scheduler *scheduler, SILABS_FE_Context *front_end) {
+  signed   int rx_index;
+  SILABS_Unicable_Receiver *rx;
+  if (scheduler->nbReceivers >= UNICABLE_SCHEDULER_MAX_RECEIVERS) {
+    SiERROR("SiLabs_Unicable_Scheduler_Add_Receiver: receiver table full!\n"); return -1;
+  }
+  rx_index = scheduler->nbReceivers++;
+  rx = &(scheduler->rx[rx_index]);
+  memset(rx, 0, sizeof(SILABS_Unicable_Receiver));
+  rx->front_end = front_end;
+  rx->ub        = -1;
+  rx->state     = UNICABLE_RX_IDLE;
+  SiLabs_Unicable_Scheduler_Allocate_UB(scheduler, rx_index);
+  if (front_end != NULL) {
+    /* Lock using the handshake, such that SiLabs_Unicable_Scheduler_Process doesn't block during the lock */
+    SiLabs_API_Handshake_Setup(front_end, 1, UNICABLE_SCHEDULER_HANDSHAKE_MS);
+  }
+  return rx_index;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Dequeue function
+  Use:      Removes a receiver from the message queue (if present)
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Dequeue       (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index) {
+  signed   int i;
+  signed   int j;
+  signed   int count;
+  count = 0;
+  for (i=0; i<scheduler->queue_count; i++) {
+    j = scheduler->queue[(scheduler->queue_head + i)%UNICABLE_SCHEDULER_MAX_RECEIVERS];
+    if (j != rx_index) {
+      scheduler->queue[(scheduler->queue_head + count)%UNICABLE_SCHEDULER_MAX_RECEIVERS] = j;
+      count++;
+    }
+  }
+  scheduler->queue_count = count;
+  return count;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Enqueue function
+  Use:      Adds a receiver at the end of the message queue
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Enqueue       (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index) {
+  SiLabs_Unicable_Scheduler_Dequeue(scheduler, rx_index);
+  scheduler->queue[(scheduler->queue_head + scheduler->queue_count)%UNICABLE_SCHEDULER_MAX_RECEIVERS] = rx_index;
+  scheduler->queue_count++;
+  scheduler->rx[rx_index].state = UNICABLE_RX_QUEUED;
+  return scheduler->queue_count;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Release function
+  Use:      Frees the UB used by a receiver and cancels its pending zap (if any)
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Release       (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index) {
+  SILABS_Unicable_Receiver *rx;
+  if ( (rx_index < 0) || (rx_index >= scheduler->nbReceivers) ) { return 0; }
+  rx = &(scheduler->rx[rx_index]);
+  SiLabs_Unicable_Scheduler_Dequeue(scheduler, rx_index);
+  if (rx->ub >= 0) { scheduler->ub[rx->ub].owner = -1; }
+  rx->ub    = -1;
+  rx->state = UNICABLE_RX_IDLE;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Zap function
+  Use:      Zap request function
+            Queues the zap. The ODU message will be sent by SiLabs_Unicable_Scheduler_Process when the cable is free.
+            A new request for a receiver already zapping replaces the previous one.
+  Parameter: rx_index, the receiver index returned by SiLabs_Unicable_Scheduler_Add_Receiver
+  Parameter: standard, freq_kHz, symbol_rate_bps, polarization, band: as for SiLabs_API_lock_to_carrier
+  Returns:  1 if the zap is queued, 0 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Zap           (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index, signed   int standard, signed   int freq_kHz, unsigned int symbol_rate_bps, unsigned int polarization, unsigned int band) {
+  SILABS_Unicable_Receiver *rx;
+  if ( (rx_index < 0) || (rx_index >= scheduler->nbReceivers) ) {
+    SiERROR("SiLabs_Unicable_Scheduler_Zap: invalid receiver index!\n"); return 0;
+  }
+  rx = &(scheduler->rx[rx_index]);
+  if (rx->ub < 0) {
+    if (SiLabs_Unicable_Scheduler_Allocate_UB(scheduler, rx_index) < 0) {
+      SiERROR("SiLabs_Unicable_Scheduler_Zap: no UB available!\n"); return 0;
+    }
+  }
+  rx->standard        = standard;
+  rx->freq_kHz        = freq_kHz;
+  rx->symbol_rate_bps = symbol_rate_bps;
+  rx->polarization    = polarization;
+  rx->band            = band;
+  rx->retries         = 0;
+  rx->latency_ms      = 0;
+  rx->request_ms      = SiLabs_Unicable_Scheduler_Time(scheduler);
+  SiLabs_Unicable_Scheduler_PRBS_Init(rx->PRBS, scheduler->ub[rx->ub].number);
+  scheduler->ub[rx->ub].zaps++;
+  SiTRACE("SiLabs_Unicable_Scheduler_Zap rx %d (ub %d) at %d kHz, queue %d\n", rx_index, scheduler->ub[rx->ub].number, freq_kHz, scheduler->queue_count);
+  SiLabs_Unicable_Scheduler_Enqueue(scheduler, rx_index);
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Zap_Result function
+  Use:      Updates the receiver state and UB statistics depending on the zap function result
+            On lock failure, the message is considered as corrupted by a collision. The receiver waits for a random
+             delay before being queued again. The backoff window is doubled after each collision.
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Zap_Result    (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index, signed   int result, signed   int now) {
+  SILABS_Unicable_Receiver *rx;
+  SILABS_Unicable_UB       *ub;
+  signed   int  window;
+  signed   int  x;
+  rx = &(scheduler->rx[rx_index]);
+  ub = &(scheduler->ub[rx->ub]);
+  if (result == 1) {
+    rx->state      = UNICABLE_RX_LOCKED;
+    rx->latency_ms = now - rx->request_ms;
+    ub->locks++;
+    ub->latency_sum_ms = ub->latency_sum_ms + rx->latency_ms;
+    if ( (ub->latency_min_ms == 0) || (rx->latency_ms < ub->latency_min_ms) ) { ub->latency_min_ms = rx->latency_ms; }
+    if (rx->latency_ms > ub->latency_max_ms) { ub->latency_max_ms = rx->latency_ms; }
+    SiTRACE("rx %d locked   after %5d ms (%d retries)\n", rx_index, rx->latency_ms, rx->retries);
+    return 1;
+  }
+  if (result == 0) {
+    ub->collisions++;
+    scheduler->collisions++;
+    rx->retries++;
+    if (rx->retries > scheduler->max_retries) {
+      rx->state      = UNICABLE_RX_FAILED;
+      rx->latency_ms = now - rx->request_ms;
+      ub->failures++;
+      SiTRACE("rx %d failed   after %5d ms (%d retries)\n", rx_index, rx->latency_ms, rx->retries);
+      return 0;
+    }
+    window = UNICABLE_SCHEDULER_BACKOFF_MIN_MS<<(rx->retries - 1);
+    if (window > UNICABLE_SCHEDULER_BACKOFF_MAX_MS) { window = UNICABLE_SCHEDULER_BACKOFF_MAX_MS; }
+    x = SiLabs_Unicable_Scheduler_PRBS_Shift(rx->PRBS, 1);
+    rx->next_action_ms = now + ((x*window)>>10);
+    rx->state          = UNICABLE_RX_BACKOFF;
+    SiTRACE("rx %d no lock, backoff %4d ms (retry %d)\n", rx_index, rx->next_action_ms - now, rx->retries);
+    return 0;
+  }
+  rx->state = UNICABLE_RX_WAIT_LOCK;
+  return result;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Process function
+  Use:      Scheduler processing function, to call periodically
+            - re-queues receivers at the end of their backoff delay
+            - checks the lock of receivers for which the ODU message has been sent
+            - sends the next queued ODU message if the cable is free
+            When using the simulated cable, each call advances the simulated clock by UNICABLE_SCHEDULER_TICK_MS.
+  Returns:  the number of receivers still zapping
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Process       (SILABS_Unicable_Scheduler *scheduler) {
+  signed   int  i;
+  signed   int  now;
+  signed   int  result;
+  signed   int  busy;
+  SILABS_Unicable_Receiver *rx;
+
+  now = SiLabs_Unicable_Scheduler_Time(scheduler);
+  if (scheduler->simulated) { SiLabs_Unicable_Scheduler_Simu_Foreign(scheduler); }
+
+  for (i=0; i<scheduler->nbReceivers; i++) {
+    rx = &(scheduler->rx[i]);
+    if ( (rx->state == UNICABLE_RX_BACKOFF  ) && (now >= rx->next_action_ms) ) {
+      SiLabs_Unicable_Scheduler_Enqueue(scheduler, i);
+    }
+    if   (rx->state == UNICABLE_RX_WAIT_LOCK) {
+      result = scheduler->f_zap(scheduler->callback, rx, 0);
+      SiLabs_Unicable_Scheduler_Zap_Result(scheduler, i, result, SiLabs_Unicable_Scheduler_Time(scheduler));
+    }
+  }
+
+  while (scheduler->queue_count > 0) {
+    now = SiLabs_Unicable_Scheduler_Time(scheduler);
+    if ( (scheduler->serialize) && (now < scheduler->cable_busy_until_ms) ) { break; }
+    i = scheduler->queue[scheduler->queue_head];
+    scheduler->queue_head = (scheduler->queue_head + 1)%UNICABLE_SCHEDULER_MAX_RECEIVERS;
+    scheduler->queue_count--;
+    scheduler->messages++;
+    result = scheduler->f_zap(scheduler->callback, &(scheduler->rx[i]), 1);
+    /* With real front-ends, the ODU message is complete when the zap function returns */
+    scheduler->cable_busy_until_ms = SiLabs_Unicable_Scheduler_Time(scheduler);
+    if (scheduler->cable_busy_until_ms < now + scheduler->message_ms) { scheduler->cable_busy_until_ms = now + scheduler->message_ms; }
+    scheduler->cable_busy_until_ms = scheduler->cable_busy_until_ms + scheduler->gap_ms;
+    SiLabs_Unicable_Scheduler_Zap_Result(scheduler, i, result, SiLabs_Unicable_Scheduler_Time(scheduler));
+  }
+
+  busy = 0;
+  for (i=0; i<scheduler->nbReceivers; i++) {
+    switch (scheduler->rx[i].state) {
+      case UNICABLE_RX_QUEUED   :
+      case UNICABLE_RX_BACKOFF  :
+      case UNICABLE_RX_WAIT_LOCK: { busy++; break; }
+      default                   : { break; }
+    }
+  }
+  if (scheduler->simulated) { scheduler->simu_time_ms = scheduler->simu_time_ms + UNICABLE_SCHEDULER_TICK_MS; }
+  return busy;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Run function
+  Use:      Calls SiLabs_Unicable_Scheduler_Process until all zaps are complete or until timeout_ms
+  Returns:  the number of receivers still zapping
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Run           (SILABS_Unicable_Scheduler *scheduler, signed   int timeout_ms) {
+  signed   int start_ms;
+  signed   int busy;
+  start_ms = SiLabs_Unicable_Scheduler_Time(scheduler);
+  while ( (busy = SiLabs_Unicable_Scheduler_Process(scheduler)) > 0 ) {
+    if (SiLabs_Unicable_Scheduler_Time(scheduler) - start_ms > timeout_ms) {
+      SiTRACE("SiLabs_Unicable_Scheduler_Run timeout with %d receivers zapping\n", busy);
+      break;
+    }
+    if (!scheduler->simulated) { system_wait(UNICABLE_SCHEDULER_TICK_MS); }
+  }
+  return busy;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Reset_Stats function
+  Use:      Clears the UB statistics
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Reset_Stats   (SILABS_Unicable_Scheduler *scheduler) {
+  signed   int i;
+  for (i=0; i<scheduler->nbUBs; i++) {
+    scheduler->ub[i].zaps           = 0;
+    scheduler->ub[i].locks          = 0;
+    scheduler->ub[i].failures       = 0;
+    scheduler->ub[i].collisions     = 0;
+    scheduler->ub[i].latency_min_ms = 0;
+    scheduler->ub[i].latency_max_ms = 0;
+    scheduler->ub[i].latency_sum_ms = 0;
+  }
+  scheduler->messages   = 0;
+  scheduler->collisions = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Stats_Text function
+  Use:      Fills textBuffer with the zap latency statistics for each UB in use
+************************************************************************************************************************/
+char          *SiLabs_Unicable_Scheduler_Stats_Text    (SILABS_Unicable_Scheduler *scheduler, char *textBuffer, signed   int max_size) {
+  signed   int i;
+  SILABS_Unicable_UB *ub;
+  snprintf(textBuffer, max_size, "Unicable scheduler: %d UBs, %d receivers, %d messages, %d collisions\n", scheduler->nbUBs, scheduler->nbReceivers, scheduler->messages, scheduler->collisions);
+  STRING_APPEND_SAFE(textBuffer, max_size, " ub Fub_kHz  rx  zaps locks fails colls  min_ms  avg_ms  max_ms\n");
+  for (i=0; i<scheduler->nbUBs; i++) {
+    ub = &(scheduler->ub[i]);
+    if ( (ub->owner == -1) && (ub->zaps == 0) ) { continue; }
+    STRING_APPEND_SAFE(textBuffer, max_size, " %2d %7d %3d %5d %5d %5d %5d  %6d  %6d  %6d\n"
+      , ub->number, ub->Fub_kHz, ub->owner, ub->zaps, ub->locks, ub->failures, ub->collisions
+      , ub->latency_min_ms, ub->locks ? (signed int)(ub->latency_sum_ms/ub->locks) : 0, ub->latency_max_ms);
+  }
+  return textBuffer;
+}
+#ifdef    SILABS_API_TEST_PIPE
+/************************************************************************************************************************
+  SiLabs_Unicable_Scheduler_Test function
+  Use:        Generic test pipe function
+              Used to send a generic command to the Unicable scheduler.
+              'simu <n>' runs n simulated receivers zapping at the same time on a simulated cable.
+  Returns:    0 if the command is unknow, 1 otherwise
+************************************************************************************************************************/
+signed   int   SiLabs_Unicable_Scheduler_Test          (SILABS_Unicable_Scheduler *scheduler, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt) {
+  signed   int i;
+  signed   int n;
+  signed   int busy;
+  unsigned int sum;
+  unsigned int locks;
+  char         statsBuffer[4000];
+  target   = target;   /* To avoid compiler warning if not used */
+  sub_cmd  = sub_cmd;  /* To avoid compiler warning if not used */
+  *retdval = 0;
+       if (strcmp_nocase(cmd, "help"               ) == 0) {
+    snprintf(*rettxt, 1000, "\n Possible Unicable scheduler test commands:\n\
+simu               <nb_receivers> : run all receivers zapping at once on the simulated cable\n\
+serialize          <0,1>          : 0 to send ODU messages without coordination (for comparison)\n\
+foreign_period_ms  <ms>           : mean period of foreign ODU messages in simulation (0: none)\n\
+max_retries        <n>\n\
+stats\n\
+reset_stats\n\
+"); return 1;
+  }
+  else if (strcmp_nocase(cmd, "simu"               ) == 0) {
+    n = (signed int)dval;
+    if (n < 1                               ) { n = 1; }
+    if (n > UNICABLE_SCHEDULER_MAX_RECEIVERS) { n = UNICABLE_SCHEDULER_MAX_RECEIVERS; }
+    i = scheduler->serialize;
+    busy = scheduler->simu_foreign_period_ms;
+    SiLabs_Unicable_Scheduler_Init        (scheduler, 1);
+    SiLabs_Unicable_Scheduler_Simu_Config (scheduler, 350, 1000, busy);
+    scheduler->serialize = (unsigned char)i;
+    for (i=0; i<n; i++) {
+      SiLabs_Unicable_Scheduler_Add_UB      (scheduler, (unsigned char)i, 975000 + 35000*i);
+      SiLabs_Unicable_Scheduler_Add_Receiver(scheduler, NULL);
+    }
+    for (i=0; i<n; i++) {
+      SiLabs_Unicable_Scheduler_Zap(scheduler, i, SILABS_DVB_S2, 11778000 + 1000*i, 27500000, SILABS_POLARIZATION_VERTICAL, SILABS_BAND_HIGH);
+    }
+    busy = SiLabs_Unicable_Scheduler_Run(scheduler, 60000);
+    sum = locks = 0;
+    for (i=0; i<n; i++) {
+      if (scheduler->rx[i].state == UNICABLE_RX_LOCKED) { sum = sum + scheduler->rx[i].latency_ms; locks++; }
+    }
+    printf("%s", SiLabs_Unicable_Scheduler_Stats_Text(scheduler, statsBuffer, 4000));
+    *retdval = locks ? (double)sum/locks : 0;
+    snprintf(*rettxt, 1000, "%d receivers (serialize %d): %d locked, %d failed, %d pending, mean zap latency %.0f ms, %d collisions\n"
+                          , n, scheduler->serialize, locks, n - locks - busy, busy, *retdval, scheduler->collisions);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "serialize"          ) == 0) {
+    scheduler->serialize = (unsigned char)dval;
+    *retdval = scheduler->serialize;
+    snprintf(*rettxt, 1000, "serialize %d\n", scheduler->serialize);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "foreign_period_ms"  ) == 0) {
+    SiLabs_Unicable_Scheduler_Simu_Config (scheduler, scheduler->simu_lock_ms, scheduler->simu_timeout_ms, (signed int)dval);
+    *retdval = scheduler->simu_foreign_period_ms;
+    snprintf(*rettxt, 1000, "foreign_period_ms %d\n", scheduler->simu_foreign_period_ms);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "max_retries"        ) == 0) {
+    scheduler->max_retries = (signed int)dval;
+    *retdval = scheduler->max_retries;
+    snprintf(*rettxt, 1000, "max_retries %d\n", scheduler->max_retries);
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "stats"              ) == 0) {
+    SiLabs_Unicable_Scheduler_Stats_Text(scheduler, *rettxt, 1000);
+    *retdval = scheduler->collisions;
+    return 1;
+  }
+  else if (strcmp_nocase(cmd, "reset_stats"        ) == 0) {
+    SiLabs_Unicable_Scheduler_Reset_Stats(scheduler);
+    snprintf(*rettxt, 1000, "Unicable scheduler stats cleared\n");
+    return 1;
+  }
+  return 0;
+}
+#endif /* SILABS_API_TEST_PIPE */
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* UNICABLE_SCHEDULER */
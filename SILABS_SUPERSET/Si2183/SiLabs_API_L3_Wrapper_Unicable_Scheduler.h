@@ -0,0 +1,137 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_API_L3_Wrapper_Unicable_Scheduler_H_
+#define  _SiLabs_API_L3_Wrapper_Unicable_Scheduler_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[Unicable/Multi_receivers] Adding a Unicable user band scheduler via SiLabs_API_L3_Wrapper_Unicable_Scheduler.c/.h
+        Used when several receivers share the same Unicable (EN50494) or JESS (EN50607) cable.
+
+ *************************************************************************************************************/
+
+#include "SiLabs_API_L3_Wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UNICABLE_SCHEDULER_MAX_UBS         32
+#define UNICABLE_SCHEDULER_MAX_RECEIVERS   32
+
+#define UNICABLE_SCHEDULER_GAP_MS          10  /* Minimum idle time on the cable between two ODU messages            */
+#define UNICABLE_SCHEDULER_MAX_RETRIES      8  /* Number of re-sends after a lock failure before declaring a failure */
+#define UNICABLE_SCHEDULER_BACKOFF_MIN_MS 256  /* Initial random backoff window, doubled after each collision       */
+#define UNICABLE_SCHEDULER_BACKOFF_MAX_MS 1024 /* Maximum random backoff window                                     */
+#define UNICABLE_SCHEDULER_HANDSHAKE_MS    20  /* Period used for the lock handshake with real front-ends            */
+#define UNICABLE_SCHEDULER_TICK_MS          5  /* Step of the simulated clock                                        */
+
+/* possible values for the receiver state */
+typedef enum  _SILABS_Unicable_Rx_State           {
+  UNICABLE_RX_IDLE      = 0,
+  UNICABLE_RX_QUEUED    = 1,
+  UNICABLE_RX_BACKOFF   = 2,
+  UNICABLE_RX_WAIT_LOCK = 3,
+  UNICABLE_RX_LOCKED    = 4,
+  UNICABLE_RX_FAILED    = 5
+} SILABS_Unicable_Rx_State;
+
+/* Structure used to store the user band allocation and statistics */
+typedef struct _SILABS_Unicable_UB                {
+  unsigned char                 number;          /* UB number as used in the ODU message (0 to 7 for EN50494, 0 to 31 for EN50607) */
+  signed   int                  Fub_kHz;
+  signed   int                  owner;           /* index of the receiver using this UB, -1 if free */
+  unsigned int                  zaps;
+  unsigned int                  locks;
+  unsigned int                  failures;
+  unsigned int                  collisions;
+  signed   int                  latency_min_ms;
+  signed   int                  latency_max_ms;
+  unsigned int                  latency_sum_ms;
+} SILABS_Unicable_UB;
+
+/* Structure used to store the state of each receiver on the cable */
+typedef struct _SILABS_Unicable_Receiver          {
+  SILABS_FE_Context            *front_end;       /* NULL for simulated receivers */
+  signed   int                  ub;              /* index in the UB table, -1 if none allocated */
+  SILABS_Unicable_Rx_State      state;
+  signed   int                  standard;
+  signed   int                  freq_kHz;
+  unsigned int                  symbol_rate_bps;
+  unsigned int                  polarization;
+  unsigned int                  band;
+  signed   int                  retries;
+  signed   int                  request_ms;
+  signed   int                  next_action_ms;
+  signed   int                  latency_ms;
+  unsigned char                 PRBS[10];
+  signed   int                  simu_send_ms;
+  signed   int                  simu_end_ms;
+  unsigned char                 simu_corrupted;
+} SILABS_Unicable_Receiver;
+
+/* type pointer to function starting (new_zap = 1) or continuing (new_zap = 0) a zap. Returns 1 if locked, 0 if failed, >1 if in progress */
+typedef signed int  (*UNICABLE_SCHEDULER_ZAP_FUNC) (void*, SILABS_Unicable_Receiver *rx, signed int new_zap);
+
+/* Structure used to store all scheduler-related information for one cable */
+typedef struct _SILABS_Unicable_Scheduler         {
+  signed   int                  nbUBs;
+  SILABS_Unicable_UB            ub[UNICABLE_SCHEDULER_MAX_UBS];
+  signed   int                  nbReceivers;
+  SILABS_Unicable_Receiver      rx[UNICABLE_SCHEDULER_MAX_RECEIVERS];
+  signed   int                  queue[UNICABLE_SCHEDULER_MAX_RECEIVERS];
+  signed   int                  queue_head;
+  signed   int                  queue_count;
+  signed   int                  cable_busy_until_ms;
+  signed   int                  message_ms;      /* Duration of an ODU message on the cable (18V period)   */
+  signed   int                  gap_ms;
+  signed   int                  max_retries;
+  unsigned char                 serialize;       /* 0: send as soon as requested (uncoordinated, for comparison) */
+  unsigned char                 simulated;
+  signed   int                  simu_time_ms;
+  signed   int                  simu_lock_ms;    /* ODU reaction + demod lock time on a clean message      */
+  signed   int                  simu_timeout_ms; /* time before reporting a failure on a corrupted message */
+  signed   int                  simu_foreign_period_ms;
+  signed   int                  simu_foreign_next_ms;
+  signed   int                  simu_foreign_end_ms;
+  unsigned char                 simu_PRBS[10];
+  unsigned int                  messages;
+  unsigned int                  collisions;
+  void                         *callback;
+  UNICABLE_SCHEDULER_ZAP_FUNC   f_zap;
+} SILABS_Unicable_Scheduler;
+
+extern SILABS_Unicable_Scheduler  Unicable_Scheduler_Context;
+
+signed   int   SiLabs_Unicable_Scheduler_Init          (SILABS_Unicable_Scheduler *scheduler, signed   int simulated);
+signed   int   SiLabs_Unicable_Scheduler_Simu_Config   (SILABS_Unicable_Scheduler *scheduler, signed   int lock_ms, signed   int timeout_ms, signed   int foreign_period_ms);
+signed   int   SiLabs_Unicable_Scheduler_Add_UB        (SILABS_Unicable_Scheduler *scheduler, unsigned char ub_number, signed   int Fub_kHz);
+signed   int   SiLabs_Unicable_Scheduler_Add_Receiver  (SILABS_Unicable_Scheduler *scheduler, SILABS_FE_Context *front_end);
+signed   int   SiLabs_Unicable_Scheduler_Release       (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index);
+signed   int   SiLabs_Unicable_Scheduler_Zap           (SILABS_Unicable_Scheduler *scheduler, signed   int rx_index, signed   int standard, signed   int freq_kHz, unsigned int symbol_rate_bps, unsigned int polarization, unsigned int band);
+signed   int   SiLabs_Unicable_Scheduler_Process       (SILABS_Unicable_Scheduler *scheduler);
+signed   int   SiLabs_Unicable_Scheduler_Run           (SILABS_Unicable_Scheduler *scheduler, signed   int timeout_ms);
+signed   int   SiLabs_Unicable_Scheduler_Reset_Stats   (SILABS_Unicable_Scheduler *scheduler);
+char          *SiLabs_Unicable_Scheduler_Stats_Text    (SILABS_Unicable_Scheduler *scheduler, char *textBuffer, signed   int max_size);
+#ifdef    SILABS_API_TEST_PIPE
+signed   int   SiLabs_Unicable_Scheduler_Test          (SILABS_Unicable_Scheduler *scheduler, const char *target, const char *cmd, const char *sub_cmd, double dval, double *retdval, char **rettxt);
+#endif /* SILABS_API_TEST_PIPE */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_API_L3_Wrapper_Unicable_Scheduler_H_ */
@@ -0,0 +1,483 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                                  SiLabs Firmware Container Functions                                      */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains the functions used to read firmware images from an external container file   */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*************************************************************************************************************
+ The firmware and patch tables (Si2183_ROM2_Patch16_6_0b13.h, ...) are generally compiled in the application.
+  As all images compatible with the build flags are included, this adds several hundreds of kB to the binary,
+  while a given board only needs one or two of them.
+
+ A firmware container is a single file holding several images, indexed by the PART_INFO values of the parts
+  they apply to. It is mapped in memory (read-only, shared), such that:
+  - only the pages of the image actually downloaded are read from storage,
+  - several processes controlling different front-ends share the same physical pages,
+  - patches can be updated by replacing the container file, without rebuilding the application.
+
+ File format (all values little-endian):
+  header (FW_CONTAINER_HEADER_SIZE bytes):
+    [ 0.. 3] magic 'SiFW'
+    [ 4.. 5] version
+    [ 6.. 7] number of entries
+    [ 8..11] header + entry table size
+    [12..15] file size
+    [16..19] checksum of the entry table
+  entry table (FW_CONTAINER_ENTRY_SIZE bytes per entry):
+    [ 0..15] name (zero-padded)
+    [16]     part    (83 for Si2183, FW_CONTAINER_ANY for all parts)
+    [17]     chiprev ('A', 'B', ..., FW_CONTAINER_ANY for all revisions)
+    [18..21] romid, pmajor, pminor, pbuild
+    [22]     format  (FW_CONTAINER_FORMAT_I2C_8, FW_CONTAINER_FORMAT_I2C_16 or FW_CONTAINER_FORMAT_SPI)
+    [23]     flags   (FW_CONTAINER_FLAG_MIS)
+    [24..25] spi_key, spi_num
+    [26..27] number of SPI split points
+    [28..31] image offset
+    [32..35] image size (bytes)
+    [36..39] lines (I2C formats) or bytes (SPI format)
+    [40..43] SPI split list offset (num_split 32 bits values)
+    [44..47] image checksum (CRC-32)
+  images, aligned on FW_CONTAINER_ALIGN bytes.
+   In FW_CONTAINER_FORMAT_I2C_16, each line is stored as a firmware_struct (1 length byte + 16 data bytes),
+    such that the mapped image is used as a firmware_struct table without any copy.
+
+ The image checksum is only verified when the image is selected for the first time, to avoid reading all images.
+
+ Containers are built from the compiled-in tables using SiLabs_FW_Container_Write
+  (see Si2183_FW_Container_Build in Si2183_L2_API.c).
+
+**************************************************************************************************************/
+/* Change log: */
+/* Last  changes:
+
+  As from V2.8.1:
+   <new_feature>[FW/container] Initial version of the firmware container
+   <correction>[FW/container] In SiLabs_FW_Container_Parse: entry bounds checks which can not wrap with 32-bit unsigned long values.
+
+*/
+/* Older changes:
+ *************************************************************************************************************/
+/* TAG V2.8.1 */
+
+#ifndef   FW_CONTAINER
+  "If you get a compilation error on this line, it means that you included the FW_Container code in your project without defining FW_CONTAINER.";
+  "Please define FW_CONTAINER at project-level, or remove the FW_Container code from your project";
+#endif /* FW_CONTAINER */
+
+#ifdef    FW_CONTAINER
+
+/* Before including the headers, define SiLevel and SiTAG */
+#define   SiLEVEL          2
+#define   SiTAG            "FW_Cont "
+#include "SiLabs_FW_Container.h"
+
+#ifdef    NO_WIN32
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif /* NO_WIN32 */
+
+SILABS_FW_Container  FW_Container_Context;
+
+#ifdef    __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/************************************************************************************************************************
+  SiLabs_FW_Container_Get32 function
+  Use:      little-endian 32 bits reading
+  Returns:  the 32 bits value
+************************************************************************************************************************/
+unsigned long  SiLabs_FW_Container_Get32               (const unsigned char *p) {
+  return (unsigned long)p[0] + ((unsigned long)p[1]<<8) + ((unsigned long)p[2]<<16) + ((unsigned long)p[3]<<24);
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Put32 function
+  Use:      little-endian 32 bits writing
+  Returns:  void
+************************************************************************************************************************/
+void           SiLabs_FW_Container_Put32               (unsigned char *p, unsigned long value) {
+  p[0] = (unsigned char)( value      & 0xff);
+  p[1] = (unsigned char)((value>> 8) & 0xff);
+  p[2] = (unsigned char)((value>>16) & 0xff);
+  p[3] = (unsigned char)((value>>24) & 0xff);
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Checksum function
+  Use:      CRC-32 (IEEE 802.3) computation
+  Parameter: data, a pointer to the data
+  Parameter: size, the number of bytes
+  Returns:  the CRC-32 value
+************************************************************************************************************************/
+unsigned long  SiLabs_FW_Container_Checksum            (const unsigned char *data, unsigned long size) {
+  unsigned long crc;
+  unsigned long i;
+  signed   int  bit;
+  crc = 0xffffffff;
+  for (i=0; i<size; i++) {
+    crc = crc ^ data[i];
+    for (bit=0; bit<8; bit++) {
+      if (crc & 1) { crc = (crc >> 1) ^ 0xedb88320; } else { crc = crc >> 1; }
+    }
+  }
+  return (crc ^ 0xffffffff) & 0xffffffff;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Parse function
+  Use:      Container header and entry table decoding
+  Parameter: container, a pointer to the container, with base and size set
+  Returns:  the number of entries, -1 if the container is invalid
+************************************************************************************************************************/
+signed   int   SiLabs_FW_Container_Parse               (SILABS_FW_Container *container) {
+  const unsigned char *p;
+  SILABS_FW_Entry     *entry;
+  unsigned long        table_size;
+  signed   int         nb_entries;
+  signed   int         i;
+  p = container->base;
+  if ( (container->size < FW_CONTAINER_HEADER_SIZE) || (memcmp(p, FW_CONTAINER_MAGIC, 4) != 0) ) {
+    SiERROR("FW container: invalid magic\n");
+    return -1;
+  }
+  if (p[4] + (p[5]<<8) != FW_CONTAINER_VERSION) {
+    SiTRACE("FW container: unsupported version %d\n", p[4] + (p[5]<<8));
+    SiERROR("FW container: unsupported version\n");
+    return -1;
+  }
+  nb_entries = p[6] + (p[7]<<8);
+  table_size = SiLabs_FW_Container_Get32(p + 8);
+  if ( (nb_entries > FW_CONTAINER_MAX_ENTRIES)
+    || (table_size != FW_CONTAINER_HEADER_SIZE + (unsigned long)nb_entries*FW_CONTAINER_ENTRY_SIZE)
+    || (table_size > container->size)
+    || (SiLabs_FW_Container_Get32(p + 12) != container->size) ) {
+    SiERROR("FW container: inconsistent header\n");
+    return -1;
+  }
+  if (SiLabs_FW_Container_Checksum(p + FW_CONTAINER_HEADER_SIZE, table_size - FW_CONTAINER_HEADER_SIZE) != SiLabs_FW_Container_Get32(p + 16)) {
+    SiERROR("FW container: entry table checksum error\n");
+    return -1;
+  }
+  for (i=0; i<nb_entries; i++) {
+    p     = container->base + FW_CONTAINER_HEADER_SIZE + i*FW_CONTAINER_ENTRY_SIZE;
+    entry = &(container->entry[i]);
+    memcpy(entry->name, p, FW_CONTAINER_NAME_SIZE);
+    entry->name[FW_CONTAINER_NAME_SIZE] = 0;
+    entry->part         = p[16];
+    entry->chiprev      = p[17];
+    entry->romid        = p[18];
+    entry->pmajor       = p[19];
+    entry->pminor       = p[20];
+    entry->pbuild       = p[21];
+    entry->format       = p[22];
+    entry->flags        = p[23];
+    entry->spi_key      = p[24];
+    entry->spi_num      = p[25];
+    entry->num_split    = p[26] + (p[27]<<8);
+    entry->offset       = SiLabs_FW_Container_Get32(p + 28);
+    entry->size         = SiLabs_FW_Container_Get32(p + 32);
+    entry->lines        = SiLabs_FW_Container_Get32(p + 36);
+    entry->split_offset = SiLabs_FW_Container_Get32(p + 40);
+    entry->checksum     = SiLabs_FW_Container_Get32(p + 44);
+    entry->verified     = 0;
+    /* The checks are written as subtractions and divisions, so that they can not wrap with 32-bit unsigned long values */
+    if ( (entry->offset > container->size) || (entry->size > container->size - entry->offset)
+      || (entry->num_split > FW_CONTAINER_MAX_SPLITS)
+      || (entry->split_offset > container->size) || (entry->num_split > (container->size - entry->split_offset)/4)
+      || ( (entry->format == FW_CONTAINER_FORMAT_I2C_8 ) && ( (entry->lines > entry->size/8                      ) || (entry->size != entry->lines*8                      ) ) )
+      || ( (entry->format == FW_CONTAINER_FORMAT_I2C_16) && ( (entry->lines > entry->size/sizeof(firmware_struct)) || (entry->size != entry->lines*sizeof(firmware_struct)) ) )
+      || ( (entry->format == FW_CONTAINER_FORMAT_SPI   ) && (entry->size != entry->lines                        ) ) ) {
+      SiTRACE("FW container: entry %d ('%s') is inconsistent\n", i, entry->name);
+      SiERROR("FW container: inconsistent entry\n");
+      return -1;
+    }
+  }
+  return nb_entries;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Open function
+  Use:      Container mapping
+            Maps the container file in memory (read-only, shared between processes) and decodes its entry table.
+  Parameter: container, a pointer to the container
+  Parameter: path, the container file path
+  Returns:  the number of images in the container, 0 if the file can not be used
+************************************************************************************************************************/
+signed   int   SiLabs_FW_Container_Open                (SILABS_FW_Container *container, const char *path) {
+#ifdef    NO_WIN32
+  struct stat  st;
+  void        *map;
+#else  /* NO_WIN32 */
+  DWORD        size_high;
+#endif /* NO_WIN32 */
+  SiLabs_FW_Container_Close(container);
+  snprintf(container->path, sizeof(container->path), "%s", path);
+  container->attempted = 1;
+#ifdef    NO_WIN32
+  container->fd = open(path, O_RDONLY);
+  if (container->fd < 0) {
+    SiTRACE("FW container: can not open '%s'\n", path);
+    return 0;
+  }
+  if ( (fstat(container->fd, &st) != 0) || (st.st_size <= 0) ) {
+    SiERROR("FW container: fstat failed\n");
+    close(container->fd); container->fd = -1;
+    return 0;
+  }
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, container->fd, 0);
+  if (map == MAP_FAILED) {
+    SiERROR("FW container: mmap failed\n");
+    close(container->fd); container->fd = -1;
+    return 0;
+  }
+  container->base = (const unsigned char*)map;
+  container->size = (unsigned long)st.st_size;
+#else  /* NO_WIN32 */
+  container->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (container->file == INVALID_HANDLE_VALUE) {
+    SiTRACE("FW container: can not open '%s'\n", path);
+    container->file = NULL;
+    return 0;
+  }
+  container->size   = GetFileSize(container->file, &size_high);
+  container->handle = CreateFileMappingA(container->file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (container->handle == NULL) {
+    SiERROR("FW container: CreateFileMapping failed\n");
+    CloseHandle(container->file); container->file = NULL;
+    return 0;
+  }
+  container->base = (const unsigned char*)MapViewOfFile(container->handle, FILE_MAP_READ, 0, 0, 0);
+  if (container->base == NULL) {
+    SiERROR("FW container: MapViewOfFile failed\n");
+    CloseHandle(container->handle); container->handle = NULL;
+    CloseHandle(container->file);   container->file   = NULL;
+    return 0;
+  }
+#endif /* NO_WIN32 */
+  container->nb_entries = SiLabs_FW_Container_Parse(container);
+  if (container->nb_entries < 0) {
+    SiLabs_FW_Container_Close(container);
+    container->attempted = 1;
+    return 0;
+  }
+  SiTRACE("FW container: '%s' mapped, %d images in %lu bytes\n", path, container->nb_entries, container->size);
+  return container->nb_entries;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Close function
+  Use:      Container unmapping
+  Parameter: container, a pointer to the container
+  Returns:  1
+************************************************************************************************************************/
+signed   int   SiLabs_FW_Container_Close               (SILABS_FW_Container *container) {
+  if (container->base != NULL) {
+#ifdef    NO_WIN32
+    munmap((void*)container->base, (size_t)container->size);
+    close(container->fd);
+#else  /* NO_WIN32 */
+    UnmapViewOfFile((void*)container->base);
+    CloseHandle(container->handle);
+    CloseHandle(container->file);
+#endif /* NO_WIN32 */
+  }
+  memset(container, 0, sizeof(SILABS_FW_Container));
+#ifdef    NO_WIN32
+  container->fd = -1;
+#endif /* NO_WIN32 */
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Find function
+  Use:      Image selection
+            Selects the image matching the PART_INFO values. Entries with an explicit part or chiprev are preferred
+             over entries using FW_CONTAINER_ANY. The image checksum is verified on first selection.
+  Parameter: container, a pointer to the container
+  Parameter: part, chiprev ('A', 'B', ...), romid, pmajor, pminor, pbuild: the PART_INFO values
+  Parameter: format, the required image format
+  Returns:  a pointer to the entry, NULL if no valid image matches
+************************************************************************************************************************/
+SILABS_FW_Entry *SiLabs_FW_Container_Find              (SILABS_FW_Container *container, unsigned char part, unsigned char chiprev, unsigned char romid, unsigned char pmajor, unsigned char pminor, unsigned char pbuild, unsigned char format) {
+  SILABS_FW_Entry *entry;
+  SILABS_FW_Entry *best;
+  signed   int     score;
+  signed   int     best_score;
+  signed   int     i;
+  best       = NULL;
+  best_score = -1;
+  if (container->base == NULL) { return NULL; }
+  for (i=0; i<container->nb_entries; i++) {
+    entry = &(container->entry[i]);
+    if ( (entry->format != format) || (entry->romid  != romid ) || (entry->verified < 0)
+      || (entry->pmajor != pmajor) || (entry->pminor != pminor) || (entry->pbuild != pbuild) ) { continue; }
+    if ( (entry->part    != FW_CONTAINER_ANY) && (entry->part    != part   ) ) { continue; }
+    if ( (entry->chiprev != FW_CONTAINER_ANY) && (entry->chiprev != chiprev) ) { continue; }
+    score = (entry->part != FW_CONTAINER_ANY)*2 + (entry->chiprev != FW_CONTAINER_ANY);
+    if (score > best_score) { best = entry; best_score = score; }
+  }
+  if (best == NULL) { return NULL; }
+  if (best->verified == 0) {
+    if (SiLabs_FW_Container_Checksum(container->base + best->offset, best->size) == best->checksum) {
+      best->verified =  1;
+    } else {
+      best->verified = -1;
+      SiTRACE("FW container: checksum error in image '%s'\n", best->name);
+      SiERROR("FW container: image checksum error\n");
+      return SiLabs_FW_Container_Find(container, part, chiprev, romid, pmajor, pminor, pbuild, format);
+    }
+  }
+  return best;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Data function
+  Use:      Image data access
+  Parameter: container, a pointer to the container
+  Parameter: entry, a pointer to the entry
+  Returns:  a pointer to the mapped image
+************************************************************************************************************************/
+const unsigned char *SiLabs_FW_Container_Data          (SILABS_FW_Container *container, SILABS_FW_Entry *entry) {
+  container->loads++;
+  return container->base + entry->offset;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Splits function
+  Use:      SPI split list decoding
+  Parameter: container, a pointer to the container
+  Parameter: entry, a pointer to the entry
+  Parameter: split_list, the output split list
+  Parameter: max_split, the split_list size
+  Returns:  the number of split points
+************************************************************************************************************************/
+unsigned int   SiLabs_FW_Container_Splits              (SILABS_FW_Container *container, SILABS_FW_Entry *entry, unsigned int *split_list, unsigned int max_split) {
+  unsigned int i;
+  for (i=0; (i<entry->num_split) && (i<max_split); i++) {
+    split_list[i] = (unsigned int)SiLabs_FW_Container_Get32(container->base + entry->split_offset + i*4);
+  }
+  return i;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Write function
+  Use:      Container creation
+            Writes a container file with the given images.
+  Parameter: path, the container file path
+  Parameter: images, the table of images
+  Parameter: nb_images, the number of images
+  Returns:  the number of bytes written, 0 in case of an error
+************************************************************************************************************************/
+signed   int   SiLabs_FW_Container_Write               (const char *path, SILABS_FW_Image images[], signed   int nb_images) {
+  unsigned char  table[FW_CONTAINER_HEADER_SIZE + FW_CONTAINER_MAX_ENTRIES*FW_CONTAINER_ENTRY_SIZE];
+  unsigned char  padding[FW_CONTAINER_ALIGN];
+  unsigned char  value[4];
+  unsigned char *p;
+  unsigned long  table_size;
+  unsigned long  offset;
+  unsigned long  split_offset;
+  unsigned int   s;
+  signed   int   i;
+  FILE          *file;
+  if ( (nb_images < 1) || (nb_images > FW_CONTAINER_MAX_ENTRIES) ) { return 0; }
+  memset(table,   0, sizeof(table));
+  memset(padding, 0, sizeof(padding));
+  table_size = FW_CONTAINER_HEADER_SIZE + (unsigned long)nb_images*FW_CONTAINER_ENTRY_SIZE;
+  offset     = (table_size + FW_CONTAINER_ALIGN - 1) & ~(unsigned long)(FW_CONTAINER_ALIGN - 1);
+  for (i=0; i<nb_images; i++) {
+    if (images[i].num_split > FW_CONTAINER_MAX_SPLITS) { return 0; }
+    p = table + FW_CONTAINER_HEADER_SIZE + i*FW_CONTAINER_ENTRY_SIZE;
+    strncpy((char*)p, images[i].name, FW_CONTAINER_NAME_SIZE);
+    p[16] = images[i].part;
+    p[17] = images[i].chiprev;
+    p[18] = images[i].romid;
+    p[19] = images[i].pmajor;
+    p[20] = images[i].pminor;
+    p[21] = images[i].pbuild;
+    p[22] = images[i].format;
+    p[23] = images[i].flags;
+    p[24] = images[i].spi_key;
+    p[25] = images[i].spi_num;
+    p[26] = (unsigned char)( images[i].num_split       & 0xff);
+    p[27] = (unsigned char)((images[i].num_split >> 8) & 0xff);
+    split_offset = offset + images[i].size;
+    SiLabs_FW_Container_Put32(p + 28, offset);
+    SiLabs_FW_Container_Put32(p + 32, images[i].size);
+    SiLabs_FW_Container_Put32(p + 36, images[i].lines);
+    SiLabs_FW_Container_Put32(p + 40, split_offset);
+    SiLabs_FW_Container_Put32(p + 44, SiLabs_FW_Container_Checksum(images[i].data, images[i].size));
+    offset = (split_offset + images[i].num_split*4 + FW_CONTAINER_ALIGN - 1) & ~(unsigned long)(FW_CONTAINER_ALIGN - 1);
+  }
+  memcpy(table, FW_CONTAINER_MAGIC, 4);
+  table[4] = (unsigned char)( FW_CONTAINER_VERSION       & 0xff);
+  table[5] = (unsigned char)((FW_CONTAINER_VERSION >> 8) & 0xff);
+  table[6] = (unsigned char)( nb_images       & 0xff);
+  table[7] = (unsigned char)((nb_images >> 8) & 0xff);
+  SiLabs_FW_Container_Put32(table +  8, table_size);
+  SiLabs_FW_Container_Put32(table + 12, offset);
+  SiLabs_FW_Container_Put32(table + 16, SiLabs_FW_Container_Checksum(table + FW_CONTAINER_HEADER_SIZE, table_size - FW_CONTAINER_HEADER_SIZE));
+  file = fopen(path, "wb");
+  if (file == NULL) {
+    SiTRACE("FW container: can not create '%s'\n", path);
+    return 0;
+  }
+  fwrite(table, 1, table_size, file);
+  offset = table_size;
+  for (i=0; i<nb_images; i++) {
+    p = table + FW_CONTAINER_HEADER_SIZE + i*FW_CONTAINER_ENTRY_SIZE;
+    fwrite(padding, 1, SiLabs_FW_Container_Get32(p + 28) - offset, file);
+    fwrite(images[i].data, 1, images[i].size, file);
+    for (s=0; s<images[i].num_split; s++) {
+      SiLabs_FW_Container_Put32(value, images[i].split_list[s]);
+      fwrite(value, 1, 4, file);
+    }
+    offset = SiLabs_FW_Container_Get32(p + 40) + images[i].num_split*4;
+  }
+  fwrite(padding, 1, SiLabs_FW_Container_Get32(table + 12) - offset, file);
+  offset = SiLabs_FW_Container_Get32(table + 12);
+  if (fclose(file) != 0) { return 0; }
+  SiTRACE("FW container: '%s' written, %d images in %lu bytes\n", path, nb_images, offset);
+  return (signed int)offset;
+}
+/************************************************************************************************************************
+  SiLabs_FW_Container_Text function
+  Use:      Container display
+  Parameter: container, a pointer to the container
+  Parameter: text, the output buffer
+  Parameter: size, the output buffer size
+  Returns:  the number of images listed
+************************************************************************************************************************/
+signed   int   SiLabs_FW_Container_Text                (SILABS_FW_Container *container, char *text, signed   int size) {
+  SILABS_FW_Entry *entry;
+  signed   int     i;
+  signed   int     pos;
+  if (container->base == NULL) {
+    snprintf(text, size, "no FW container mapped\n");
+    return 0;
+  }
+  pos = snprintf(text, size, "'%s': %d images, %lu bytes, %lu loads\n", container->path, container->nb_entries, container->size, container->loads);
+  for (i=0; (i<container->nb_entries) && (pos < size); i++) {
+    entry = &(container->entry[i]);
+    pos += snprintf(text + pos, size - pos, " %-16s part %3d rev %c ROM%d NVM%c_%cb%d %-6s %7lu bytes%s%s\n"
+      , entry->name, entry->part, (entry->chiprev == FW_CONTAINER_ANY) ? '*' : entry->chiprev, entry->romid, entry->pmajor, entry->pminor, entry->pbuild
+      , (entry->format == FW_CONTAINER_FORMAT_SPI) ? "SPI" : ((entry->format == FW_CONTAINER_FORMAT_I2C_16) ? "I2C_16" : "I2C_8")
+      , entry->size, (entry->flags & FW_CONTAINER_FLAG_MIS) ? " MIS" : "", (entry->verified < 0) ? " CHECKSUM_ERROR" : "");
+  }
+  return i;
+}
+
+#ifdef    __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* FW_CONTAINER */
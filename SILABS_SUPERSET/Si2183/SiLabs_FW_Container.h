@@ -0,0 +1,132 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+#ifndef  _SiLabs_FW_Container_H_
+#define  _SiLabs_FW_Container_H_
+/* Change log:
+
+  As from V2.8.1:
+  <new_feature>[FW/container] Adding an external firmware container via SiLabs_FW_Container.c/.h
+        Firmware images are read from a file mapped in memory, instead of being compiled in the application.
+
+ *************************************************************************************************************/
+
+#include "Silabs_L0_API.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* firmware_struct needs to be declared to allow using 16 bytes mode images directly from the container */
+#ifndef __FIRMWARE_STRUCT__
+#define __FIRMWARE_STRUCT__
+typedef struct firmware_struct {
+  unsigned char firmware_len;
+  unsigned char firmware_table[16];
+} firmware_struct;
+#endif /* __FIRMWARE_STRUCT__ */
+
+#define FW_CONTAINER_MAGIC             "SiFW"
+#define FW_CONTAINER_VERSION            1
+#define FW_CONTAINER_HEADER_SIZE       32  /* bytes, followed by the entry table                                  */
+#define FW_CONTAINER_ENTRY_SIZE        48  /* bytes per entry in the entry table                                  */
+#define FW_CONTAINER_ALIGN             16  /* image alignment in the file                                         */
+#define FW_CONTAINER_MAX_ENTRIES       32  /* maximum number of images per container                              */
+#define FW_CONTAINER_MAX_SPLITS        64  /* maximum number of SPI split points per image                        */
+#define FW_CONTAINER_NAME_SIZE         16
+
+#define FW_CONTAINER_ANY             0xff  /* 'part' or 'chiprev' key matching all parts or revisions             */
+
+#define FW_CONTAINER_FORMAT_I2C_8       0  /* 8 bytes per line, as used by LoadFirmware                           */
+#define FW_CONTAINER_FORMAT_I2C_16      1  /* firmware_struct lines (17 bytes), as used by LoadFirmware_16        */
+#define FW_CONTAINER_FORMAT_SPI         2  /* SPI byte stream, with key/num and optional split list               */
+
+#define FW_CONTAINER_FLAG_MIS        0x01  /* image with DVB-S2 multiple input stream capability                  */
+
+/* Structure used to describe one image, when building a container from compiled-in tables */
+typedef struct _SILABS_FW_Image                   {
+  const char                   *name;
+  unsigned char                 part;            /* 83 for Si2183, FW_CONTAINER_ANY for all parts                */
+  unsigned char                 chiprev;         /* 'A', 'B', ..., FW_CONTAINER_ANY for all revisions            */
+  unsigned char                 romid;
+  unsigned char                 pmajor;          /* PART_INFO values of the part to patch ('6', '0', 1 for 6_0b1) */
+  unsigned char                 pminor;
+  unsigned char                 pbuild;
+  unsigned char                 format;
+  unsigned char                 flags;
+  unsigned char                 spi_key;
+  unsigned char                 spi_num;
+  const unsigned char          *data;
+  unsigned long                 size;            /* bytes                                                        */
+  unsigned long                 lines;           /* lines in I2C formats, bytes in SPI format                    */
+  const unsigned int           *split_list;
+  unsigned int                  num_split;
+} SILABS_FW_Image;
+
+/* Structure used to store one decoded entry of a mapped container */
+typedef struct _SILABS_FW_Entry                   {
+  char                          name[FW_CONTAINER_NAME_SIZE + 1];
+  unsigned char                 part;
+  unsigned char                 chiprev;
+  unsigned char                 romid;
+  unsigned char                 pmajor;
+  unsigned char                 pminor;
+  unsigned char                 pbuild;
+  unsigned char                 format;
+  unsigned char                 flags;
+  unsigned char                 spi_key;
+  unsigned char                 spi_num;
+  unsigned int                  num_split;
+  unsigned long                 offset;
+  unsigned long                 size;
+  unsigned long                 lines;
+  unsigned long                 split_offset;
+  unsigned long                 checksum;
+  signed   int                  verified;        /* 0: not checked yet, 1: checksum ok, -1: checksum error        */
+} SILABS_FW_Entry;
+
+/* Structure used to store a mapped container */
+typedef struct _SILABS_FW_Container               {
+  char                          path[256];
+  const unsigned char          *base;
+  unsigned long                 size;
+  signed   int                  nb_entries;
+  SILABS_FW_Entry               entry[FW_CONTAINER_MAX_ENTRIES];
+  signed   int                  attempted;       /* set after the first automatic opening attempt                 */
+  unsigned long                 loads;
+#ifdef    NO_WIN32
+  signed   int                  fd;
+#else  /* NO_WIN32 */
+  HANDLE                        file;
+  HANDLE                        handle;
+#endif /* NO_WIN32 */
+} SILABS_FW_Container;
+
+extern SILABS_FW_Container  FW_Container_Context;
+
+unsigned long  SiLabs_FW_Container_Checksum            (const unsigned char *data, unsigned long size);
+signed   int   SiLabs_FW_Container_Open                (SILABS_FW_Container *container, const char *path);
+signed   int   SiLabs_FW_Container_Close               (SILABS_FW_Container *container);
+SILABS_FW_Entry *SiLabs_FW_Container_Find              (SILABS_FW_Container *container, unsigned char part, unsigned char chiprev, unsigned char romid, unsigned char pmajor, unsigned char pminor, unsigned char pbuild, unsigned char format);
+const unsigned char *SiLabs_FW_Container_Data          (SILABS_FW_Container *container, SILABS_FW_Entry *entry);
+unsigned int   SiLabs_FW_Container_Splits              (SILABS_FW_Container *container, SILABS_FW_Entry *entry, unsigned int *split_list, unsigned int max_split);
+signed   int   SiLabs_FW_Container_Write               (const char *path, SILABS_FW_Image images[], signed   int nb_images);
+signed   int   SiLabs_FW_Container_Text                (SILABS_FW_Container *container, char *text, signed   int size);
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* _SiLabs_FW_Container_H_ */
@@ -19,6 +19,23 @@ limitations under the License.
 ****************************************************************************************
  Change log:
 
+ As from V5.1.1
+ <new_feature>[command/engine] Adding the command engine functions (implemented in Silabs_L0_Command.c), shared by all command-mode parts
+   (Si2183 demodulator and SiXXXX TER tuners): L0_PollForCTS, L0_PollForResponse, L0_SendCommand, L0_Patch, L0_LoadFirmware and L0_LoadFirmware_16.
+   Adding the L0_COMMAND_xxx error codes (identical to the parts' error codes), cmd_error in L0_Context and the firmware_struct definition.
+
+ As from V5.1.0
+ <new_feature>[SPI/spidev] Adding LINUX_SPIDEV_Capability: SPI FW download using the Linux spidev driver,
+   L0_SPI_CONFIG_xxx values for L0_EnableSPI, L0_SPIDEV_Setup and L0_SPI_Stats.
+
+ As from V5.0.9
+ <new_feature>[I2C/statistics] Adding L0_Stats_Category, L0_Stats_Counters and L0_Stats_Device, and stats_category/stats_index in L0_Context,
+   to count the i2c transactions, bytes and errors with log-scale latency histograms, per bus, per i2c address and per caller category.
+
+ As from V5.0.8
+ <new_feature>[SIMU/benchmark] Adding L0_Simu_Stats, L0_SIMU_READ_FUNC and L0_SIMU_WRITE_FUNC, to plug device models on the SIMU connection,
+   emulate the bus latency and count the I2C transactions and the time spent in system_wait.
+
  As from V3.4.5
  Adding STRING_APPEND_SAFE to replace snprintf, since this function behaves differently
    between platforms when called with snprintf(msg, 1000, "%s%d", msg, value);
@@ -65,6 +82,14 @@ limitations under the License.
     int Linux_I2C_readByte  (signed   int adapter_nr, unsigned char address, unsigned char indexSize, unsigned char * pucAddressBuffer, signed   int iNbBytes, unsigned char * pucDataBuffer);
     int Linux_I2C_writeByte (signed   int adapter_nr, unsigned char address                                                           , signed   int iNbBytes, unsigned char * pucBuffer);
   #endif /* LINUX_I2C_Capability */
+/* <porting> Un-comment the line below (or define it at project level) to use the Linux spidev driver for SPI FW download */
+/*  #define   LINUX_SPIDEV_Capability */
+  #ifdef    LINUX_SPIDEV_Capability
+    #include <linux/spi/spidev.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+  #endif /* LINUX_SPIDEV_Capability */
 #endif /* LINUX_ST_SDK2_I2C */
 
 #endif /* NO_WIN32 */
@@ -172,6 +197,16 @@ typedef enum _CONNECTION_TYPE
     none
 }  CONNECTION_TYPE;
 
+/* i2c statistics: caller categories */
+typedef enum _L0_Stats_Category
+{
+    L0_STATS_COMMAND = 0,  /* command writes (and register accesses)                */
+    L0_STATS_RESPONSE,     /* response reads (CTS polling and responses)            */
+    L0_STATS_FIRMWARE,     /* firmware download, including the related CTS polling  */
+    L0_STATS_TUNER,        /* all tuner transactions                                */
+    L0_STATS_CATEGORIES
+}  L0_Stats_Category;
+
 typedef struct _L0_Context
 {
     unsigned char   address;
@@ -182,6 +217,9 @@ typedef struct _L0_Context
     signed   int    mustReadWithoutStop;
     unsigned char   tag_index;
              char   tag[SILABS_TAG_SIZE];
+    L0_Stats_Category stats_category; /* L0_STATS_COMMAND: writes counted as commands and reads as responses. Otherwise all transactions in this category */
+    signed   int    stats_index;      /* cached index in the statistics table, -1 if not known yet                                                     */
+    unsigned char   cmd_error;        /* error byte of the last command response with the err bit set (0x10 = BAD_COMMAND, ...), 0 if none              */
 #ifdef    LINUX_I2C_Capability
     signed   int     adapter_nr;
 #endif /* LINUX_I2C_Capability */
@@ -193,6 +231,28 @@ typedef struct _L0_Context
 #endif /* LINUX_KERNEL_DRIVER */
 } L0_Context;
 
+/* command engine error codes, identical to the NO_SiXXXX_ERROR/ERROR_SiXXXX_xxx values of all command-mode parts */
+#define   L0_COMMAND_NO_ERROR                0x00
+#define   L0_COMMAND_SENDING_COMMAND         0x03
+#define   L0_COMMAND_CTS_TIMEOUT             0x04
+#define   L0_COMMAND_ERR                     0x05
+#define   L0_COMMAND_POLLING_CTS             0x06
+#define   L0_COMMAND_POLLING_RESPONSE        0x07
+#define   L0_COMMAND_LOADING_FIRMWARE        0x08
+
+#ifndef   L0_COMMAND_TIMEOUT_MS
+  #define L0_COMMAND_TIMEOUT_MS              1000 /* maximum CTS wait, for CTS and response polling */
+#endif /* L0_COMMAND_TIMEOUT_MS */
+
+/* firmware_struct needs to be declared to allow loading the FW in 16 bytes mode */
+#ifndef __FIRMWARE_STRUCT__
+#define __FIRMWARE_STRUCT__
+typedef struct firmware_struct {
+  unsigned char firmware_len;
+  unsigned char firmware_table[16];
+} firmware_struct;
+#endif /* __FIRMWARE_STRUCT__ */
+
 /* Layer 1 core types definitions */
 typedef enum _ErrorCode
 {
@@ -220,6 +280,81 @@ typedef struct L1_Context {
   void       *specific;
 } L1_Context;
 
+/* SIMU connection: device models and statistics */
+#ifndef   L0_SIMU_MAX_DEVICES
+  #define L0_SIMU_MAX_DEVICES  32
+#endif /* L0_SIMU_MAX_DEVICES */
+
+/* type pointers to device model functions. Both return the number of bytes read or written (0 for a NACK) */
+typedef signed int  (*L0_SIMU_READ_FUNC ) (void *device, unsigned char address, signed int indexSize, unsigned char *index, signed int iNbBytes, unsigned char *pucDataBuffer);
+typedef signed int  (*L0_SIMU_WRITE_FUNC) (void *device, unsigned char address, signed int indexSize, unsigned char *index, signed int iNbBytes, unsigned char *pucDataBuffer);
+
+typedef struct _L0_Simu_Stats {
+  unsigned long   reads;
+  unsigned long   writes;
+  unsigned long   bytes_read;
+  unsigned long   bytes_written;
+  unsigned long   nacks;
+  unsigned long   bus_time_us;
+  unsigned long   wait_ms;      /* time spent in system_wait (busy loop outside of LINUX_KERNEL_DRIVER), only with SILABS_BENCHMARK */
+} L0_Simu_Stats;
+
+/* i2c statistics: log2 latency histogram, bucket 0 for < 1 us, bucket n for [2^(n-1), 2^n[ us, the last bucket is open-ended */
+#ifndef   L0_STATS_MAX_DEVICES
+  #define L0_STATS_MAX_DEVICES  32
+#endif /* L0_STATS_MAX_DEVICES */
+#define   L0_STATS_BUCKETS      16
+
+typedef struct _L0_Stats_Counters {
+  unsigned long   reads;
+  unsigned long   writes;
+  unsigned long   bytes_read;
+  unsigned long   bytes_written;
+  unsigned long   errors;       /* NACKs and failed transactions */
+  unsigned long   time_us;
+  unsigned long   max_us;
+  unsigned long   histogram[L0_STATS_BUCKETS];
+} L0_Stats_Counters;
+
+/* SPI configuration bits for L0_EnableSPI, matching the way the part samples the SPI signals */
+#define   L0_SPI_CONFIG_CLK_FALLING  0x01  /* data sampled on the falling edge of spi_clk (rising edge otherwise) */
+#define   L0_SPI_CONFIG_LSB_FIRST    0x02  /* bytes sent LSB first (MSB first otherwise)                          */
+
+#ifdef    LINUX_SPIDEV_Capability
+#ifndef   L0_SPIDEV_DEVICE
+  #define L0_SPIDEV_DEVICE       "/dev/spidev0.0"
+#endif /* L0_SPIDEV_DEVICE */
+#ifndef   L0_SPIDEV_SPEED_HZ
+  #define L0_SPIDEV_SPEED_HZ     10000000
+#endif /* L0_SPIDEV_SPEED_HZ */
+#ifndef   L0_SPIDEV_TRANSFER_SIZE
+  #define L0_SPIDEV_TRANSFER_SIZE    4096  /* bytes per spi_ioc_transfer, limited by the spidev 'bufsiz' module parameter (default 4096) */
+#endif /* L0_SPIDEV_TRANSFER_SIZE */
+#ifndef   L0_SPIDEV_TRANSFERS
+  #define L0_SPIDEV_TRANSFERS          16  /* spi_ioc_transfers per SPI_IOC_MESSAGE ioctl */
+#endif /* L0_SPIDEV_TRANSFERS */
+#define   L0_SPIDEV_MESSAGE_SIZE     (L0_SPIDEV_TRANSFER_SIZE*L0_SPIDEV_TRANSFERS)
+
+/* type pointer to the ioctl function used by the spidev backend (ioctl by default, or a user-space mock) */
+typedef int (*L0_SPIDEV_IOCTL_FUNC) (int fd, unsigned long request, void *arg);
+
+typedef struct _L0_SPI_Stats {
+  unsigned long   messages;     /* SPI_IOC_MESSAGE ioctls */
+  unsigned long   transfers;
+  unsigned long   bytes;
+  unsigned long   errors;
+  unsigned long   time_us;
+  signed   int    bit_reversal; /* 1 if the controller can not send LSB first and bytes are reversed by SW */
+} L0_SPI_Stats;
+#endif /* LINUX_SPIDEV_Capability */
+
+typedef struct _L0_Stats_Device {
+  CONNECTION_TYPE    connectionType;
+  signed   int       bus;          /* adapter_nr with LINUX_I2C_Capability, 0 otherwise */
+  unsigned char      address;
+  L0_Stats_Counters  category[L0_STATS_CATEGORIES];
+} L0_Stats_Device;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -260,6 +395,24 @@ extern "C" {
     signed   int     L0_ReadCommandBytes  (L0_Context* i2c, int iNbBytes, unsigned char *pucDataBuffer);
     signed   int     L0_WriteCommandBytes (L0_Context* i2c, int iNbBytes, unsigned char *pucDataBuffer);
 
+    unsigned char    L0_PollForCTS        (L0_Context* i2c);
+    unsigned char    L0_PollForResponse   (L0_Context* i2c, unsigned int nbBytes, unsigned char *pByteBuffer);
+    unsigned char    L0_SendCommand       (L0_Context* i2c, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
+    unsigned char    L0_Patch             (L0_Context* i2c, signed   int iNbBytes, unsigned char *pucDataBuffer);
+    signed   int     L0_LoadFirmware      (L0_Context* i2c, unsigned char fw_table[], signed   int bytes_per_line, signed   int nbLines);
+    signed   int     L0_LoadFirmware_16   (L0_Context* i2c, firmware_struct fw_table[], signed   int nbLines);
+
+    signed   int     L0_SimulatorDevice   (unsigned char address, void *device, L0_SIMU_READ_FUNC f_read, L0_SIMU_WRITE_FUNC f_write);
+    signed   int     L0_SimulatorLatency  (signed   int transaction_us, signed   int byte_us);
+    void             L0_SimulatorStats    (L0_Simu_Stats *stats, signed   int reset);
+
+    L0_Stats_Category L0_StatsCategory    (L0_Context* i2c, L0_Stats_Category category);
+    signed   int     L0_StatsCount        (void);
+    signed   int     L0_StatsRead         (signed   int index, L0_Stats_Device *device);
+    void             L0_StatsReset        (void);
+    signed   int     L0_StatsText         (char *txt, signed   int size);
+    const    char*   L0_StatsCategoryText (L0_Stats_Category category);
+
     signed   long    L0_ReadRegister      (L0_Context *i2c,                           unsigned int iI2CIndex, unsigned char offset, unsigned char nbbit, unsigned int isSigned);
     signed   long    L0_ReadRegisterTrace (L0_Context *i2c, char* name,               unsigned int iI2CIndex, unsigned char offset, unsigned char nbbit, unsigned int isSigned);
     signed   long    L0_WriteRegister     (L0_Context *i2c,                           unsigned int iI2CIndex, unsigned char offset, unsigned char nbbit, unsigned char alone, long Value);
@@ -275,6 +428,10 @@ extern "C" {
     signed   int     L0_LoadSPIoverPortA  (unsigned char *SPI_data, unsigned char  length, unsigned short index);
     signed   int     L0_LoadSPIoverGPIF   (unsigned char *SPI_data, int  length);
     signed   int     L0_DisableSPI        (void);
+#ifdef    LINUX_SPIDEV_Capability
+    signed   int     L0_SPIDEV_Setup      (const char *device, unsigned int speed_hz, L0_SPIDEV_IOCTL_FUNC ioctl_func);
+    void             L0_SPIStats          (L0_SPI_Stats *stats, signed   int reset);
+#endif /* LINUX_SPIDEV_Capability */
 
 #ifdef    USB_Capability
     signed   int     L0_Cypress_Process   (const char *cmd, const char *text, double dval, double *retdval, char **rettxt);
@@ -0,0 +1,282 @@
+/*************************************************************************************************************
+Copyright 2015-2019, Silicon Laboratories, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+ *************************************************************************************************************/
+/*************************************************************************************************************/
+/*                                  Silicon Laboratories                                                     */
+/*                                  Broadcast Video Group                                                    */
+/*                     Layer 0      Command Engine Functions                                                 */
+/*-----------------------------------------------------------------------------------------------------------*/
+/*-----------------------------------------------------------------------------------------------------------*/
+/*   This source code contains the command transport shared by all 'command mode' parts                      */
+/*    (Si2183 demodulator and SiXXXX TER tuners):                                                             */
+/*     - command write and CTS/response polling                                                               */
+/*     - error byte retrieval when the response err bit is set                                                */
+/*     - patch and firmware download                                                                          */
+/*   The parts' L1 pollForCTS/pollForResponse/sendCommand/L1_API_Patch and L2 LoadFirmware functions are      */
+/*    thin wrappers around these functions, only adding their own status decoding.                           */
+/*   All functions are declared in Silabs_L0_API.h                                                            */
+/*************************************************************************************************************/
+/* Change log:
+
+ As from V5.1.1:
+  <new_feature>[command/engine] Initial version, with the command transport previously duplicated in each part's L1/L2 code:
+    L0_PollForCTS:      waits for CTS, with a L0_COMMAND_TIMEOUT_MS timeout.
+    L0_PollForResponse: reads the response once CTS is set. If the err bit is set, the error byte is stored in i2c->cmd_error
+                         and traced, with its meaning.
+    L0_SendCommand:     writes a command and reads its response.
+    L0_Patch:           writes a patch line and checks the response.
+    L0_LoadFirmware, L0_LoadFirmware_16: download a firmware table, with the traces suspended after 4 lines and the
+                         i2c transactions counted in the L0_STATS_FIRMWARE category.
+
+ *************************************************************************************************************/
+ /* TAG V5.1.1 */
+
+#define   SiLEVEL          0
+#include "Silabs_L0_API.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/************************************************************************************************************************
+  L0_PollForCTS function
+  Use:        CTS checking function
+              Used to check the CTS bit until it is set before sending the next command
+  Comments:   max timeout = L0_COMMAND_TIMEOUT_MS
+  Parameter:  i2c, a pointer to the part's L0 context
+  Returns:    L0_COMMAND_NO_ERROR if the CTS bit is set, an error code otherwise
+************************************************************************************************************************/
+unsigned char L0_PollForCTS        (L0_Context* i2c)
+{
+  unsigned char rspByteBuffer[1];
+  signed   int  start_time;
+
+  start_time = system_time();
+
+  while (system_time() - start_time < L0_COMMAND_TIMEOUT_MS)  {
+    if (L0_ReadCommandBytes(i2c, 1, rspByteBuffer) != 1) {
+      SiTRACE("L0_PollForCTS ERROR reading byte 0 at 0x%02x!\n", i2c->address);
+      return L0_COMMAND_POLLING_CTS;
+    }
+    /* return OK if CTS set */
+    if (rspByteBuffer[0] & 0x80) {
+      return L0_COMMAND_NO_ERROR;
+    }
+  }
+
+  SiTRACE("L0_PollForCTS ERROR CTS Timeout at 0x%02x!\n", i2c->address);
+  return L0_COMMAND_CTS_TIMEOUT;
+}
+/************************************************************************************************************************
+  L0_PollForResponse function
+  Use:        command response retrieval function
+              Used to retrieve the command response in the provided buffer
+  Comments:   max timeout = L0_COMMAND_TIMEOUT_MS
+              If the err bit is set, the 7 first response bytes are read again to retrieve the error byte (byte 1),
+               which is stored in i2c->cmd_error.
+               This is done whatever nbBytes, since most commands only read the status byte.
+  Parameter:  i2c, a pointer to the part's L0 context
+  Parameter:  nbBytes          the number of response bytes to read
+  Parameter:  pByteBuffer      a buffer into which bytes will be stored
+  Returns:    L0_COMMAND_NO_ERROR if the response is ok, L0_COMMAND_ERR if the err bit is set, an error code otherwise.
+              With L0_COMMAND_NO_ERROR and L0_COMMAND_ERR, pByteBuffer[0] contains the status byte.
+************************************************************************************************************************/
+unsigned char L0_PollForResponse   (L0_Context* i2c, unsigned int nbBytes, unsigned char *pByteBuffer)
+{
+  unsigned char debugBuffer[7];
+  signed   int  start_time;
+
+  start_time = system_time();
+
+  while (system_time() - start_time < L0_COMMAND_TIMEOUT_MS)  {
+    if ((unsigned int)L0_ReadCommandBytes(i2c, nbBytes, pByteBuffer) != nbBytes) {
+      SiTRACE("L0_PollForResponse ERROR reading byte 0 at 0x%02x!\n", i2c->address);
+      return L0_COMMAND_POLLING_RESPONSE;
+    }
+    /* return response err flag if CTS set */
+    if (pByteBuffer[0] & 0x80)  {
+      if (!(pByteBuffer[0] & 0x40)) {
+        return L0_COMMAND_NO_ERROR;
+      }
+      /* for debug purpose, read the error byte and trace the debug bytes */
+      i2c->cmd_error = 0;
+      if (L0_ReadCommandBytes(i2c, 7, debugBuffer) == 7) {
+        i2c->cmd_error = debugBuffer[1];
+      }
+  #ifdef    SiTRACES
+      SiTRACE("0x%02x debug bytes 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x 0x%02x\n", i2c->address, debugBuffer[0], debugBuffer[1], debugBuffer[2], debugBuffer[3], debugBuffer[4], debugBuffer[5], debugBuffer[6]);
+      if   ( i2c->cmd_error == 0x10)                              { SiTRACE("BAD_COMMAND\n");                          }
+      if ( ( i2c->cmd_error >= 0x11) && (i2c->cmd_error <= 0x17) ) { SiTRACE("BAD_ARG%d\n", i2c->cmd_error & 0x0f);      }
+      if   ( i2c->cmd_error == 0x18)                              { SiTRACE("BAD_STANDARD (not supported by the part)\n"); }
+      if   ( i2c->cmd_error == 0x20)                              { SiTRACE("BAD_PROPERTY\n");                         }
+      if   ( i2c->cmd_error == 0x30)                              { SiTRACE("BAD_BOOTMODE\n");                         }
+      if   ( i2c->cmd_error == 0x31)                              { SiTRACE("BAD_PATCH\n");                            }
+      if   ( i2c->cmd_error == 0x32)                              { SiTRACE("BAD_NVM\n");                              }
+  #endif /* SiTRACES */
+      return L0_COMMAND_ERR;
+    }
+  }
+
+  SiTRACE("L0_PollForResponse ERROR CTS Timeout at 0x%02x!\n", i2c->address);
+  return L0_COMMAND_CTS_TIMEOUT;
+}
+/************************************************************************************************************************
+  L0_SendCommand function
+  Use:        command sending function
+              Used to write a command and retrieve its response
+  Parameter:  i2c, a pointer to the part's L0 context
+  Parameter:  nbCmdBytes       the number of command bytes
+  Parameter:  cmdByteBuffer    the command bytes
+  Parameter:  nbRspBytes       the number of response bytes to read
+  Parameter:  rspByteBuffer    a buffer into which the response bytes will be stored
+  Returns:    L0_COMMAND_SENDING_COMMAND if the command can't be written, the L0_PollForResponse return value otherwise
+************************************************************************************************************************/
+unsigned char L0_SendCommand       (L0_Context* i2c, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer)
+{
+  if ((unsigned int)L0_WriteCommandBytes(i2c, nbCmdBytes, cmdByteBuffer) != nbCmdBytes) {
+    SiTRACE("L0_SendCommand ERROR writing %d bytes at 0x%02x!\n", nbCmdBytes, i2c->address);
+    return L0_COMMAND_SENDING_COMMAND;
+  }
+  return L0_PollForResponse(i2c, nbRspBytes, rspByteBuffer);
+}
+/************************************************************************************************************************
+  L0_Patch function
+  Use:        Patch download function
+              Used to send a number of bytes to a part in bootloader mode. Useful to download the firmware.
+  Parameter:  i2c, a pointer to the part's L0 context
+  Parameter:  iNbBytes         the number of bytes to write
+  Parameter:  pucDataBuffer    the bytes to write
+  Returns:    L0_COMMAND_NO_ERROR if no error,
+              L0_COMMAND_LOADING_FIRMWARE if the bytes can't be written,
+              L0_COMMAND_POLLING_RESPONSE if the response can't be read or has its err bit set
+************************************************************************************************************************/
+unsigned char L0_Patch             (L0_Context* i2c, signed   int iNbBytes, unsigned char *pucDataBuffer)
+{
+  unsigned char rspByteBuffer[1];
+  unsigned char res;
+
+  if (L0_WriteCommandBytes(i2c, iNbBytes, pucDataBuffer) != iNbBytes) {
+    SiTRACE("L0_Patch ERROR writing %d bytes at 0x%02x!\n", iNbBytes, i2c->address);
+    return L0_COMMAND_LOADING_FIRMWARE;
+  }
+
+  res = L0_PollForResponse(i2c, 1, rspByteBuffer);
+  if (res != L0_COMMAND_NO_ERROR) {
+    SiTRACE("L0_Patch ERROR 0x%02x polling response at 0x%02x!\n", res, i2c->address);
+    return L0_COMMAND_POLLING_RESPONSE;
+  }
+
+  return L0_COMMAND_NO_ERROR;
+}
+/************************************************************************************************************************
+  L0_LoadFirmware function
+  Use:        Firmware download function
+              Used to download a firmware table with a fixed number of bytes per line
+              Requires the part to be in bootloader mode after PowerUp
+  Comments:   The traces are suspended after 4 lines and resumed at the end.
+              The transactions are counted in the L0_STATS_FIRMWARE category.
+  Parameter:  i2c, a pointer to the part's L0 context
+  Parameter:  fw_table         pointer to firmware table array
+  Parameter:  bytes_per_line   the number of bytes per line (SiXXXX_BYTES_PER_LINE)
+  Parameter:  nbLines          number of lines in firmware table array
+  Returns:    L0_COMMAND_NO_ERROR if successful, L0_COMMAND_LOADING_FIRMWARE otherwise
+************************************************************************************************************************/
+signed   int  L0_LoadFirmware      (L0_Context* i2c, unsigned char fw_table[], signed   int bytes_per_line, signed   int nbLines)
+{
+  L0_Stats_Category stats_category;
+  signed   int      load_start_ms;
+  signed   int      line;
+  unsigned char     res;
+
+  stats_category = L0_StatsCategory(i2c, L0_STATS_FIRMWARE);
+  SiTRACE("L0_LoadFirmware nbLines %d at 0x%02x\n", nbLines, i2c->address);
+  load_start_ms = system_time();
+  /* for each line in fw_table */
+  for (line = 0; line < nbLines; line++) {
+    /* send bytes_per_line fw bytes */
+    if ((res = L0_Patch(i2c, bytes_per_line, fw_table + bytes_per_line*line)) != L0_COMMAND_NO_ERROR) {
+      SiTraceConfiguration((char*)"traces resume");
+      SiTRACE("L0_LoadFirmware error 0x%02x patching line %d\n", res, line);
+      if (line == 0) {
+        SiTRACE("The firmware is incompatible with the part!\n");
+      }
+      L0_StatsCategory(i2c, stats_category);
+      return L0_COMMAND_LOADING_FIRMWARE;
+    }
+    if (line == 0) {
+      if (system_time() - load_start_ms > 200) {
+        SiERROR ("L0_LoadFirmware line 1 took too much time!\n");
+      }
+      SiTRACE ("L0_LoadFirmware line 1 took %4d ms\n", system_time() - load_start_ms);
+    }
+    if (line == 3) { SiTraceConfiguration((char*)"traces suspend"); }
+  }
+  SiTraceConfiguration((char*)"traces resume");
+  L0_StatsCategory(i2c, stats_category);
+  return L0_COMMAND_NO_ERROR;
+}
+/************************************************************************************************************************
+  L0_LoadFirmware_16 function
+  Use:        Firmware download function
+              Used to download a firmware_struct table (up to 16 bytes per line)
+              Requires the part to be in bootloader mode after PowerUp
+  Comments:   Lines with a 0 length (i.e. dummy firmware) are skipped.
+              The traces are suspended after 4 lines and resumed at the end.
+              The transactions are counted in the L0_STATS_FIRMWARE category.
+  Parameter:  i2c, a pointer to the part's L0 context
+  Parameter:  fw_table         pointer to firmware_struct array
+  Parameter:  nbLines          number of lines in firmware table array
+  Returns:    L0_COMMAND_NO_ERROR if successful, L0_COMMAND_LOADING_FIRMWARE otherwise
+************************************************************************************************************************/
+signed   int  L0_LoadFirmware_16   (L0_Context* i2c, firmware_struct fw_table[], signed   int nbLines)
+{
+  L0_Stats_Category stats_category;
+  signed   int      load_start_ms;
+  signed   int      line;
+  unsigned char     res;
+
+  stats_category = L0_StatsCategory(i2c, L0_STATS_FIRMWARE);
+  SiTRACE("L0_LoadFirmware_16 nbLines %d at 0x%02x\n", nbLines, i2c->address);
+  load_start_ms = system_time();
+  /* for each line in fw_table */
+  for (line = 0; line < nbLines; line++) {
+    if (fw_table[line].firmware_len > 0) { /* don't download if length is 0 , e.g. dummy firmware */
+      /* send firmware_len bytes (up to 16) */
+      if ((res = L0_Patch(i2c, fw_table[line].firmware_len, fw_table[line].firmware_table)) != L0_COMMAND_NO_ERROR) {
+        SiTraceConfiguration((char*)"traces resume");
+        SiTRACE("L0_LoadFirmware_16 error 0x%02x patching line %d\n", res, line);
+        if (line == 0) {
+          SiTRACE("The firmware is incompatible with the part!\n");
+        }
+        L0_StatsCategory(i2c, stats_category);
+        return L0_COMMAND_LOADING_FIRMWARE;
+      }
+      if (line == 0) {
+        if (system_time() - load_start_ms > 200) {
+          SiERROR ("L0_LoadFirmware_16 line 1 took too much time!\n");
+        }
+        SiTRACE ("L0_LoadFirmware_16 line 1 took %4d ms\n", system_time() - load_start_ms);
+      }
+      if (line == 3) { SiTraceConfiguration((char*)"traces suspend"); }
+    }
+  }
+  SiTraceConfiguration((char*)"traces resume");
+  L0_StatsCategory(i2c, stats_category);
+  return L0_COMMAND_NO_ERROR;
+}
+
+#ifdef __cplusplus
+}
+#endif
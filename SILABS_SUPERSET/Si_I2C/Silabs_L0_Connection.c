@@ -24,6 +24,35 @@ limitations under the License.
 /*************************************************************************************************************/
 /* Change log:
 
+ As from V5.1.1:
+  <new_feature>[command/engine] The command engine (CTS/response polling, command sending, patch and firmware download)
+    shared by all command-mode parts is in Silabs_L0_Command.c, which needs to be added to all projects.
+  In L0_Init: initializing cmd_error.
+
+ As from V5.1.0:
+  <new_feature>[SPI/spidev] Linux spidev backend for SPI FW download (if LINUX_SPIDEV_Capability):
+    L0_EnableSPI:       opens and configures the spidev device (SPI mode from L0_SPI_CONFIG_CLK_FALLING,
+                         bit order from L0_SPI_CONFIG_LSB_FIRST, with SW bit reversal if the controller can't send LSB first).
+    L0_LoadSPIoverGPIF: sends the bytes using SPI_IOC_MESSAGE ioctls of L0_SPIDEV_TRANSFERS x L0_SPIDEV_TRANSFER_SIZE bytes.
+    L0_DisableSPI:      closes the spidev device.
+    L0_SPIDEV_Setup:    selects the device, the SPI clock and the ioctl function (allowing a user-space spidev mock).
+    L0_SPIStats:        retrieves/resets the number of ioctls, transfers, bytes and errors and the SPI download time.
+
+ As from V5.0.9:
+  <new_feature>[I2C/statistics] Always-on i2c statistics, collected in L0_ReadBytes and L0_WriteBytes:
+    number of reads/writes, bytes, errors, total/max time and log2 latency histogram, per bus, per i2c address and per caller category
+    (command, response, firmware, tuner). The category is selected using L0_StatsCategory.
+    L0_StatsCount/L0_StatsRead/L0_StatsReset/L0_StatsText: retrieve/reset/display the statistics.
+    The statistics are not locked: they are exact for single-threaded L0 use, approximate with concurrent transactions.
+    In SIMU mode, the latency is the emulated bus time.
+
+ As from V5.0.8:
+  <new_feature>[SIMU/benchmark] SIMU connection improvements, used to measure the SW cost without HW:
+    L0_SimulatorDevice:  plugs a device model at a given i2c address (other addresses still use the Byte[] memory).
+    L0_SimulatorLatency: emulates the bus latency (per transaction and per byte), using system_wait.
+    L0_SimulatorStats:   retrieves/resets the number of transactions, bytes and NACKs, the emulated bus time and the time spent in system_wait.
+     (The time spent in system_wait is only counted when SILABS_BENCHMARK is defined, to leave system_wait unchanged otherwise.)
+
  As from V5.0.7:
   In L0_WriteRegister (legacy function for register access): Typo corrected in L0_WriteRegister. This only had an impact on register-based parts.
 
@@ -152,7 +181,7 @@ limitations under the License.
  Correction on last character when changing traces file name
  Correction in traces file name management
  *************************************************************************************************************/
- /* TAG V5.0.7 */
+ /* TAG V5.1.1 */
 
 #define   SiLEVEL          0
 #include "Silabs_L0_API.h"
@@ -186,6 +215,32 @@ L0_Context *rawI2C;
 
 #define  SIMULATOR_SCOPE 0xffff
 int      Byte[SIMULATOR_SCOPE];
+
+typedef struct _L0_Simu_Device {
+  unsigned char       address;
+  void               *device;
+  L0_SIMU_READ_FUNC   f_read;
+  L0_SIMU_WRITE_FUNC  f_write;
+} L0_Simu_Device;
+
+L0_Simu_Device  L0_Simu_Devices[L0_SIMU_MAX_DEVICES];
+signed   int    L0_Simu_nbDevices;
+L0_Simu_Stats   L0_Simu_Statistics;
+signed   int    L0_Simu_transaction_us;
+signed   int    L0_Simu_byte_us;
+signed   int    L0_Simu_debt_us;
+L0_Stats_Device L0_Stats_Devices[L0_STATS_MAX_DEVICES];
+signed   int    L0_Stats_nbDevices;
+unsigned long   L0_Stats_lost;
+#ifdef    LINUX_SPIDEV_Capability
+char                  L0_SPIDEV_device[64];
+unsigned int          L0_SPIDEV_speed_hz;
+signed   int          L0_SPIDEV_fd = -1;
+signed   int          L0_SPIDEV_configured;
+L0_SPIDEV_IOCTL_FUNC  L0_SPIDEV_ioctl;
+L0_SPI_Stats          L0_SPI_Statistics;
+unsigned char         L0_SPIDEV_buffer[L0_SPIDEV_MESSAGE_SIZE];
+#endif /* LINUX_SPIDEV_Capability */
 char           L0_error_buffer_0[ERROR_MESSAGE_MAX_LENGH];
 char           L0_error_buffer_1[ERROR_MESSAGE_MAX_LENGH];
 
@@ -976,16 +1031,22 @@ int  L0_ErrorMessage (void) {
   Porting:    Needs to use the final system call for time retrieval
 ************************************************************************************************************************/
 int     system_wait          (int time_ms) {
-#if LINUX_KERNEL_DRIVER
-  msleep(time_ms);
-  return system_time();
-#else /* LINUX_KERNEL_DRIVER */
+#if LINUX_KERNEL_DRIVER
+  msleep(time_ms);
+#ifdef    SILABS_BENCHMARK
+  L0_Simu_Statistics.wait_ms += time_ms;
+#endif /* SILABS_BENCHMARK */
+  return system_time();
+#else /* LINUX_KERNEL_DRIVER */
   unsigned long ticks1, ticks2;
   ticks1=system_time() + time_ms;
   ticks2=ticks1;
   while (ticks2<=ticks1) {ticks2=system_time();}
+#ifdef    SILABS_BENCHMARK
+  L0_Simu_Statistics.wait_ms += time_ms;
+#endif /* SILABS_BENCHMARK */
   return (int)ticks2;
-#endif /* LINUX_KERNEL_DRIVER */
+#endif /* LINUX_KERNEL_DRIVER */
 }
 /************************************************************************************************************************
   system_time function
@@ -1012,13 +1073,13 @@ int     system_time          (void)        {
   getnstimeofday(&tv);
   time_in_mill = (tv.tv_sec) * 1000 + (tv.tv_nsec) / 1000000 ; // convert tv_sec & tv_usec to millisecond
 #else  /* LINUX_ST_SDK2_I2C */
-#ifdef LINUX_KERNEL_DRIVER
-  return jiffies_to_msecs(jiffies);
-#else /* LINUX_KERNEL_DRIVER */
+#ifdef LINUX_KERNEL_DRIVER
+  return jiffies_to_msecs(jiffies);
+#else /* LINUX_KERNEL_DRIVER */
   struct timeval  tv;
   gettimeofday(&tv, NULL);
   time_in_mill = (tv.tv_sec) * 1000 + (tv.tv_usec) / 1000 ; // convert tv_sec & tv_usec to millisecond
-#endif /* LINUX_KERNEL_DRIVER */
+#endif /* LINUX_KERNEL_DRIVER */
 #endif /* LINUX_ST_SDK2_I2C */
   return (unsigned long) time_in_mill;
 #endif /* NO_WIN32 */
@@ -1053,6 +1114,294 @@ int     L0_SimulatorWrite    (int AdrSize, int BufSize, unsigned char * Buffer){
   }
   return BufSize;
 }
+/************************************************************************************************************************
+  L0_SimulatorDevice function
+  Use:        SIMU device model selection function
+              Used to plug a device model at a given i2c address when using the SIMU connection.
+              Transactions to addresses without model still use the Byte[] memory.
+  Parameters: address, the i2c address (8 bit format, as in i2c->address)
+              device,  a pointer to the model's context. NULL to remove the model.
+              f_read,  the model's read  function
+              f_write, the model's write function
+  Returns:    1 if ok, 0 if the device table is full
+************************************************************************************************************************/
+int     L0_SimulatorDevice   (unsigned char address, void *device, L0_SIMU_READ_FUNC f_read, L0_SIMU_WRITE_FUNC f_write) {
+  int i;
+  for (i=0; i<L0_Simu_nbDevices; i++) {
+    if (L0_Simu_Devices[i].address == address) { break; }
+  }
+  if (device == NULL) {
+    if (i < L0_Simu_nbDevices) {
+      L0_Simu_nbDevices--;
+      L0_Simu_Devices[i] = L0_Simu_Devices[L0_Simu_nbDevices];
+    }
+    return 1;
+  }
+  if (i >= L0_SIMU_MAX_DEVICES) { return 0; }
+  L0_Simu_Devices[i].address = address;
+  L0_Simu_Devices[i].device  = device;
+  L0_Simu_Devices[i].f_read  = f_read;
+  L0_Simu_Devices[i].f_write = f_write;
+  if (i == L0_Simu_nbDevices) { L0_Simu_nbDevices++; }
+  return 1;
+}
+/************************************************************************************************************************
+  L0_SimulatorLatency function
+  Use:        SIMU bus latency selection function
+              Used to emulate the bus duration of each transaction (i.e. 100 us + 23 us per byte for a 400 kHz bus with USB bridge)
+              The latency is accumulated and applied using system_wait as soon as it reaches 1 ms.
+  Returns:    1
+************************************************************************************************************************/
+int     L0_SimulatorLatency  (int transaction_us, int byte_us) {
+  L0_Simu_transaction_us = transaction_us;
+  L0_Simu_byte_us        = byte_us;
+  L0_Simu_debt_us        = 0;
+  return 1;
+}
+/************************************************************************************************************************
+  L0_SimulatorStats function
+  Use:        SIMU statistics retrieval function
+  Parameters: stats, a pointer to a L0_Simu_Stats structure to fill (can be NULL)
+              reset, 1 to clear the statistics after reading them
+************************************************************************************************************************/
+void    L0_SimulatorStats    (L0_Simu_Stats *stats, int reset) {
+  if (stats != NULL) { *stats = L0_Simu_Statistics; }
+  if (reset) {
+    L0_Simu_Statistics.reads         = 0;
+    L0_Simu_Statistics.writes        = 0;
+    L0_Simu_Statistics.bytes_read    = 0;
+    L0_Simu_Statistics.bytes_written = 0;
+    L0_Simu_Statistics.nacks         = 0;
+    L0_Simu_Statistics.bus_time_us   = 0;
+    L0_Simu_Statistics.wait_ms       = 0;
+  }
+}
+/************************************************************************************************************************
+  L0_SimulatorFind function
+  Use:        SIMU device model lookup
+  Returns:    a pointer to the device model at the given address, NULL if none
+************************************************************************************************************************/
+L0_Simu_Device *L0_SimulatorFind  (unsigned char address) {
+  int i;
+  for (i=0; i<L0_Simu_nbDevices; i++) {
+    if (L0_Simu_Devices[i].address == address) { return &(L0_Simu_Devices[i]); }
+  }
+  return NULL;
+}
+/************************************************************************************************************************
+  L0_SimulatorAccount function
+  Use:        SIMU transaction accounting and latency emulation
+  Parameters: read, 1 for a read transaction, 0 for a write transaction
+              nbBytes, the number of bytes on the bus (index and data bytes)
+              ok, 0 if the transaction failed
+************************************************************************************************************************/
+int     L0_SimulatorAccount  (int read, int nbBytes, int ok) {
+  int cost_us;
+  if (read) {
+    L0_Simu_Statistics.reads++;
+    L0_Simu_Statistics.bytes_read    += nbBytes;
+  } else {
+    L0_Simu_Statistics.writes++;
+    L0_Simu_Statistics.bytes_written += nbBytes;
+  }
+  if (!ok) { L0_Simu_Statistics.nacks++; }
+  /* The address byte is always sent */
+  cost_us = L0_Simu_transaction_us + (nbBytes + 1)*L0_Simu_byte_us;
+  L0_Simu_Statistics.bus_time_us += cost_us;
+  L0_Simu_debt_us = L0_Simu_debt_us + cost_us;
+  if (L0_Simu_debt_us >= 1000) {
+    system_wait(L0_Simu_debt_us/1000);
+    L0_Simu_debt_us = L0_Simu_debt_us%1000;
+  }
+  return cost_us;
+}
+/************************************************************************************************************************
+  L0_StatsTime_us function
+  Use:        i2c statistics time base
+  Returns:    a time in microseconds, only used to compute durations
+  Porting:    Replace by the most precise time function available on your platform
+************************************************************************************************************************/
+unsigned long L0_StatsTime_us    (void) {
+#ifndef   NO_WIN32
+  LARGE_INTEGER counter;
+  LARGE_INTEGER frequency;
+  if ( (!QueryPerformanceFrequency(&frequency)) || (frequency.QuadPart == 0) ) { return (unsigned long)system_time()*1000; }
+  QueryPerformanceCounter(&counter);
+  return (unsigned long)((counter.QuadPart*1000000)/frequency.QuadPart);
+#else  /* NO_WIN32 */
+#ifdef    LINUX_ST_SDK2_I2C
+  struct timespec  tv;
+  getnstimeofday(&tv);
+  return (unsigned long)(tv.tv_sec*1000000 + tv.tv_nsec/1000);
+#else  /* LINUX_ST_SDK2_I2C */
+#ifdef    LINUX_KERNEL_DRIVER
+  return jiffies_to_usecs(jiffies);
+#else  /* LINUX_KERNEL_DRIVER */
+  struct timeval  tv;
+  gettimeofday(&tv, NULL);
+  return (unsigned long)(tv.tv_sec*1000000 + tv.tv_usec);
+#endif /* LINUX_KERNEL_DRIVER */
+#endif /* LINUX_ST_SDK2_I2C */
+#endif /* NO_WIN32 */
+}
+/************************************************************************************************************************
+  L0_StatsAccount function
+  Use:        i2c statistics update, called at the end of L0_ReadBytes and L0_WriteBytes
+              The statistics entry matching the bus and i2c address is cached in i2c->stats_index.
+  Behavior:   The statistics table is global and updated without any lock (L0 has no mutex, and a lock per transaction
+               would cost more than the counting). The counters are exact when a single thread does i2c transactions
+               (or when the application serializes its L0 calls, as needed anyway for a shared bus).
+              With several threads doing concurrent transactions, the counters are only approximate: increments can be
+               lost, and 2 threads seeing a new device at the same time can create 2 entries for it.
+  Parameters: i2c, a pointer to the Layer 0 context.
+              read, 1 for a read transaction, 0 for a write transaction
+              nbBytes, the number of bytes on the bus (index and data bytes)
+              ok, 0 if the transaction failed
+              elapsed_us, the transaction duration
+************************************************************************************************************************/
+void    L0_StatsAccount      (L0_Context* i2c, int read, int nbBytes, int ok, unsigned long elapsed_us) {
+  L0_Stats_Device   *device;
+  L0_Stats_Counters *counters;
+  int                bus;
+  int                i;
+#ifdef    LINUX_I2C_Capability
+  bus = i2c->adapter_nr;
+#else  /* LINUX_I2C_Capability */
+  bus = 0;
+#endif /* LINUX_I2C_Capability */
+  i = i2c->stats_index;
+  if ( (i < 0) || (i >= L0_Stats_nbDevices)
+    || (L0_Stats_Devices[i].address != i2c->address) || (L0_Stats_Devices[i].bus != bus) || (L0_Stats_Devices[i].connectionType != i2c->connectionType) ) {
+    for (i=0; i<L0_Stats_nbDevices; i++) {
+      if ( (L0_Stats_Devices[i].address == i2c->address) && (L0_Stats_Devices[i].bus == bus) && (L0_Stats_Devices[i].connectionType == i2c->connectionType) ) { break; }
+    }
+    if (i == L0_Stats_nbDevices) {
+      if (L0_Stats_nbDevices >= L0_STATS_MAX_DEVICES) { L0_Stats_lost++; return; }
+      memset(&(L0_Stats_Devices[i]), 0, sizeof(L0_Stats_Device));
+      L0_Stats_Devices[i].connectionType = i2c->connectionType;
+      L0_Stats_Devices[i].bus            = bus;
+      L0_Stats_Devices[i].address        = i2c->address;
+      L0_Stats_nbDevices++;
+    }
+    i2c->stats_index = i;
+  }
+  device = &(L0_Stats_Devices[i]);
+  if ( (i2c->stats_category == L0_STATS_COMMAND) && (read) ) {
+    counters = &(device->category[L0_STATS_RESPONSE]);
+  } else {
+    counters = &(device->category[i2c->stats_category]);
+  }
+  if (read) {
+    counters->reads++;
+    counters->bytes_read    += nbBytes;
+  } else {
+    counters->writes++;
+    counters->bytes_written += nbBytes;
+  }
+  if (!ok) { counters->errors++; }
+  counters->time_us += elapsed_us;
+  if (elapsed_us > counters->max_us) { counters->max_us = elapsed_us; }
+  for (i=0; (elapsed_us > 0) && (i < L0_STATS_BUCKETS-1); i++) { elapsed_us = elapsed_us >> 1; }
+  counters->histogram[i]++;
+}
+/************************************************************************************************************************
+  L0_StatsCategory function
+  Use:        i2c statistics category selection
+              Used to count all transactions of a L0 context in a given category, i.e. L0_STATS_TUNER for tuners
+              or L0_STATS_FIRMWARE during a firmware download.
+              With L0_STATS_COMMAND (default), writes are counted as commands and reads as responses.
+  Returns:    the previous category, to restore it when needed
+************************************************************************************************************************/
+L0_Stats_Category L0_StatsCategory   (L0_Context* i2c, L0_Stats_Category category) {
+  L0_Stats_Category previous;
+  previous = i2c->stats_category;
+  if ( (category >= L0_STATS_COMMAND) && (category < L0_STATS_CATEGORIES) && (category != L0_STATS_RESPONSE) ) {
+    i2c->stats_category = category;
+  }
+  return previous;
+}
+/************************************************************************************************************************
+  L0_StatsCount function
+  Use:        i2c statistics retrieval
+  Returns:    the number of devices (bus + i2c address) in the statistics table
+************************************************************************************************************************/
+int     L0_StatsCount        (void) {
+  return L0_Stats_nbDevices;
+}
+/************************************************************************************************************************
+  L0_StatsRead function
+  Use:        i2c statistics retrieval
+  Parameters: index, the device index (0 to L0_StatsCount()-1)
+              device, a pointer to a L0_Stats_Device structure to fill
+  Returns:    1 if ok, 0 if index is out of range
+************************************************************************************************************************/
+int     L0_StatsRead         (int index, L0_Stats_Device *device) {
+  if ( (index < 0) || (index >= L0_Stats_nbDevices) ) { return 0; }
+  *device = L0_Stats_Devices[index];
+  return 1;
+}
+/************************************************************************************************************************
+  L0_StatsReset function
+  Use:        i2c statistics reset
+              The devices are kept in the table (the cached indexes remain valid), only the counters are cleared.
+************************************************************************************************************************/
+void    L0_StatsReset        (void) {
+  int i;
+  for (i=0; i<L0_Stats_nbDevices; i++) {
+    memset(L0_Stats_Devices[i].category, 0, sizeof(L0_Stats_Devices[i].category));
+  }
+  L0_Stats_lost = 0;
+}
+/************************************************************************************************************************
+  L0_StatsCategoryText function
+  Use:        i2c statistics category name
+************************************************************************************************************************/
+const char *L0_StatsCategoryText (L0_Stats_Category category) {
+  switch (category) {
+    case L0_STATS_COMMAND : return "command" ; break;
+    case L0_STATS_RESPONSE: return "response"; break;
+    case L0_STATS_FIRMWARE: return "firmware"; break;
+    case L0_STATS_TUNER   : return "tuner"   ; break;
+    default               : break;
+  }
+  return "unknown";
+}
+/************************************************************************************************************************
+  L0_StatsText function
+  Use:        i2c statistics display
+              One line per device and per category with at least one transaction.
+              The histogram columns are the number of transactions with a duration below 1, 2, 4, ... us.
+  Parameters: txt, a buffer for the text
+              size, the size of the buffer
+  Returns:    the number of displayed lines
+************************************************************************************************************************/
+int     L0_StatsText         (char *txt, int size) {
+  L0_Stats_Device   *device;
+  L0_Stats_Counters *counters;
+  int                i, c, b, last, lines;
+  unsigned long      transactions;
+  lines  = 0;
+  txt[0] = 0;
+  STRING_APPEND_SAFE(txt, size, "bus  addr category       reads   writes  bytes_rd  bytes_wr errors    time_ms  max_us  avg_us | log2 latency histogram (<1us 1 2 4 8 ... us)\n");
+  for (i=0; i<L0_Stats_nbDevices; i++) {
+    device = &(L0_Stats_Devices[i]);
+    for (c=0; c<L0_STATS_CATEGORIES; c++) {
+      counters     = &(device->category[c]);
+      transactions = counters->reads + counters->writes;
+      if (transactions == 0) { continue; }
+      STRING_APPEND_SAFE(txt, size, "%d-%-2d 0x%02x %-8s %8lu %8lu %9lu %9lu %6lu %10lu %7lu %7lu |"
+        , device->connectionType, device->bus, device->address, L0_StatsCategoryText((L0_Stats_Category)c)
+        , counters->reads, counters->writes, counters->bytes_read, counters->bytes_written, counters->errors
+        , counters->time_us/1000, counters->max_us, counters->time_us/transactions);
+      for (last=L0_STATS_BUCKETS-1; (last > 0) && (counters->histogram[last] == 0); last--) {}
+      for (b=0; b<=last; b++) { STRING_APPEND_SAFE(txt, size, " %lu", counters->histogram[b]); }
+      STRING_APPEND_SAFE(txt, size, "\n");
+      lines++;
+    }
+  }
+  if (L0_Stats_lost) { STRING_APPEND_SAFE(txt, size, "%lu transactions not counted (more than %d devices)\n", L0_Stats_lost, L0_STATS_MAX_DEVICES); }
+  return lines;
+}
 
 /* Re-definition of SiTRACE for L0_Context */
 #ifdef    SiTRACES
@@ -1161,6 +1510,9 @@ void    L0_Init              (L0_Context *i2c) {
   i2c->trackRead           = 0;
   i2c->mustReadWithoutStop = 0;
   i2c->tag_index           = 0;
+  i2c->stats_category      = L0_STATS_COMMAND;
+  i2c->stats_index         = -1;
+  i2c->cmd_error           = 0;
   for (i=0; i<SIMULATOR_SCOPE; i++) {Byte[i]=0x00;}
   rawI2C = &rawI2C_context;
   rawI2C->indexSize = 0;
@@ -1346,6 +1698,9 @@ void    L0_TrackWrite        (L0_Context* i2c, unsigned int track) {
 ************************************************************************************************************************/
 int     L0_ReadBytes         (L0_Context* i2c, unsigned int iI2CIndex, int iNbBytes, unsigned char *pucDataBuffer) {
   int r,i,nbReadBytes;
+  unsigned long start_us;
+  unsigned long elapsed_us;
+  L0_Simu_Device *simu_device;
   unsigned char  ucAddressBuffer[4];
   unsigned char *pucAddressBuffer;
 #ifdef    USB_Capability
@@ -1356,6 +1711,8 @@ int     L0_ReadBytes         (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
   pucAddressBuffer = (unsigned char *)&ucAddressBuffer;
 
   nbReadBytes = 0;
+  start_us    = L0_StatsTime_us();
+  elapsed_us  = 0;
   for (i=0;i<i2c->indexSize;i++) {
       r = 8*(i2c->indexSize -1 -i);
     pucAddressBuffer[i] = (unsigned char)((iI2CIndex & (0xff<<r) ) >> r);
@@ -1412,23 +1769,30 @@ int     L0_ReadBytes         (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
       and on failure nbReadBytes = 0.
       data bytes will be stored in pucDataBuffer.
       */
-#ifdef LINUX_KERNEL_DRIVER
-      if ((i2c->mustReadWithoutStop == 0)
-            && (I2CRead(i2c->user, i2c->address>>1, pucDataBuffer, iNbBytes) == iNbBytes))
-          nbReadBytes = iNbBytes;
-      else if ((i2c->mustReadWithoutStop == 1)
-            && (I2CReadIndex(i2c->user, i2c->address>>1, pucAddressBuffer, i2c->indexSize, pucDataBuffer, iNbBytes) == iNbBytes))
-          nbReadBytes = iNbBytes;
-      else
-          nbReadBytes = 0;
-#endif /* LINUX_KERNEL_DRIVER */
+#ifdef LINUX_KERNEL_DRIVER
+      if ((i2c->mustReadWithoutStop == 0)
+            && (I2CRead(i2c->user, i2c->address>>1, pucDataBuffer, iNbBytes) == iNbBytes))
+          nbReadBytes = iNbBytes;
+      else if ((i2c->mustReadWithoutStop == 1)
+            && (I2CReadIndex(i2c->user, i2c->address>>1, pucAddressBuffer, i2c->indexSize, pucDataBuffer, iNbBytes) == iNbBytes))
+          nbReadBytes = iNbBytes;
+      else
+          nbReadBytes = 0;
+#endif /* LINUX_KERNEL_DRIVER */
       break;
     case SIMU:
-      nbReadBytes = L0_SimulatorRead (i2c->indexSize, pucAddressBuffer, iNbBytes, pucDataBuffer);
+      if ((simu_device = L0_SimulatorFind(i2c->address)) != NULL) {
+        nbReadBytes = simu_device->f_read (simu_device->device, i2c->address, i2c->indexSize, pucAddressBuffer, iNbBytes, pucDataBuffer);
+      } else {
+        nbReadBytes = L0_SimulatorRead (i2c->indexSize, pucAddressBuffer, iNbBytes, pucDataBuffer);
+      }
+      elapsed_us = L0_SimulatorAccount(1, i2c->indexSize + iNbBytes, nbReadBytes == iNbBytes);
       break;
     default:
       break;
   }
+  if (i2c->connectionType != SIMU) { elapsed_us = L0_StatsTime_us() - start_us; }
+  L0_StatsAccount(i2c, 1, i2c->indexSize + iNbBytes, nbReadBytes == iNbBytes, elapsed_us);
 #ifdef    SiTRACES
   trace_skip_info = 1;
     if (i2c->trackRead==1) {
@@ -1462,6 +1826,9 @@ int     L0_ReadBytes         (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
 ************************************************************************************************************************/
 int     L0_WriteBytes        (L0_Context* i2c, unsigned int iI2CIndex, int iNbBytes, unsigned char *pucDataBuffer) {
   int r, i, nbWrittenBytes, write_error;
+  unsigned long start_us;
+  unsigned long elapsed_us;
+  L0_Simu_Device *simu_device;
   unsigned char  ucBuffer[100];
   unsigned char  ucAddressBuffer[4];
   unsigned char *pucAddressBuffer;
@@ -1472,6 +1839,8 @@ int     L0_WriteBytes        (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
 
   nbWrittenBytes = 0;
   write_error    = 0;
+  start_us       = L0_StatsTime_us();
+  elapsed_us     = 0;
   for (i=0; i <i2c->indexSize;i++) {
     r = 8*(i2c->indexSize -1 -i);
     pucBuffer[i] = (unsigned char)((iI2CIndex & (0xff<<r) ) >> r);
@@ -1532,13 +1901,13 @@ int     L0_WriteBytes        (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
         and on failure write_error is incremented.
         */
 
-#ifdef LINUX_KERNEL_DRIVER
-      if (I2CWrite(i2c->user, i2c->address>>1, pucDataBuffer, iNbBytes + i2c->indexSize)
-            != (iNbBytes + i2c->indexSize))
-          write_error++;
-      else
-          nbWrittenBytes = iNbBytes + i2c->indexSize;
-#endif /* LINUX_KERNEL_DRIVER */
+#ifdef LINUX_KERNEL_DRIVER
+      if (I2CWrite(i2c->user, i2c->address>>1, pucDataBuffer, iNbBytes + i2c->indexSize)
+            != (iNbBytes + i2c->indexSize))
+          write_error++;
+      else
+          nbWrittenBytes = iNbBytes + i2c->indexSize;
+#endif /* LINUX_KERNEL_DRIVER */
         break;
     case LINUX_I2C:
         #ifdef    LINUX_I2C_Capability
@@ -1553,11 +1922,22 @@ int     L0_WriteBytes        (L0_Context* i2c, unsigned int iI2CIndex, int iNbBy
         #endif /* LINUX_I2C_Capability */
         break;
     case SIMU:
-      nbWrittenBytes = L0_SimulatorWrite(i2c->indexSize, (iNbBytes + i2c->indexSize), pucBuffer);
+      if ((simu_device = L0_SimulatorFind(i2c->address)) != NULL) {
+        if (simu_device->f_write(simu_device->device, i2c->address, i2c->indexSize, pucAddressBuffer, iNbBytes, &pucBuffer[i2c->indexSize]) == iNbBytes) {
+          nbWrittenBytes = iNbBytes + i2c->indexSize;
+        } else {
+          write_error++;
+        }
+      } else {
+        nbWrittenBytes = L0_SimulatorWrite(i2c->indexSize, (iNbBytes + i2c->indexSize), pucBuffer);
+      }
+      elapsed_us = L0_SimulatorAccount(0, i2c->indexSize + iNbBytes, write_error == 0);
       break;
     default:
       break;
   }
+  if (i2c->connectionType != SIMU) { elapsed_us = L0_StatsTime_us() - start_us; }
+  L0_StatsAccount(i2c, 0, i2c->indexSize + iNbBytes, (write_error == 0) && (nbWrittenBytes != 0), elapsed_us);
 #ifdef    SiTRACES
   trace_skip_info = 1;
   if (i2c->trackWrite     == 1) {
@@ -1901,7 +2281,7 @@ int     L0_ReadString        (L0_Context* i2c, char *readString, unsigned char *
     input = readString;
 
     /* strtok splitting input and storing all items, returning first item */
-#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
+#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
     array[0] = strsep(&input," ");
 #else  /* LINUX_ST_SDK2_I2C */
     array[0] = strtok(input," ");
@@ -1909,7 +2289,7 @@ int     L0_ReadString        (L0_Context* i2c, char *readString, unsigned char *
     if(array[0]==NULL) {return 0;}
     /* retrieving all remaining items */
     for(loop=1;loop<50;loop++) {
-#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
+#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
         array[loop] = strsep(&input," ");
 #else  /* LINUX_ST_SDK2_I2C */
         array[loop] = strtok(NULL," ");
@@ -1953,7 +2333,7 @@ int     L0_ReadString        (L0_Context* i2c, char *readString, unsigned char *
   Returns:    The number of bytes written
 ************************************************************************************************************************/
 int     L0_WriteString       (L0_Context* i2c, char *writeString) {
-#if !defined(LINUX_ST_SDK2_I2C) && !defined(LINUX_KERNEL_DRIVER)
+#if !defined(LINUX_ST_SDK2_I2C) && !defined(LINUX_KERNEL_DRIVER)
     int i;
 #endif /* LINUX_ST_SDK2_I2C */
     int writeBytes;
@@ -1976,7 +2356,7 @@ int     L0_WriteString       (L0_Context* i2c, char *writeString) {
     input = writeString;
 
     /* strtok splitting input and storing all items, returning first item */
-#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
+#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
     array[0] = strsep(&input," ");
 #else  /* LINUX_ST_SDK2_I2C */
     array[0] = strtok(input," ");
@@ -1984,7 +2364,7 @@ int     L0_WriteString       (L0_Context* i2c, char *writeString) {
     if(array[0]==NULL) {return 0;}
     /* retrieving all remaining items */
     for(loop=1;loop<50;loop++) {
-#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
+#if defined(LINUX_ST_SDK2_I2C) || defined(LINUX_KERNEL_DRIVER)
         array[loop] = strsep(&input," ");
 #else  /* LINUX_ST_SDK2_I2C */
         array[loop] = strtok(NULL," ");
@@ -2004,7 +2384,7 @@ int     L0_WriteString       (L0_Context* i2c, char *writeString) {
     indexSize = 0;
     iI2CIndex = 0;
     iNbBytes  = nbArgs-1;
-#if !defined(LINUX_ST_SDK2_I2C) && !defined(LINUX_KERNEL_DRIVER)
+#if !defined(LINUX_ST_SDK2_I2C) && !defined(LINUX_KERNEL_DRIVER)
     pbtDataBuffer = (unsigned char*)malloc(sizeof(unsigned char)*iNbBytes);
     for (i=0; i<iNbBytes; i++) { pbtDataBuffer[i] = bytes[i+1]; }
     L0_SetAddress   (i2c, address, indexSize);
@@ -2012,7 +2392,7 @@ int     L0_WriteString       (L0_Context* i2c, char *writeString) {
 #endif /* LINUX_ST_SDK2_I2C */
     return writeBytes;
 }
-const char*   Si_I2C_TAG_TEXT      (void) { return (char *)"V5.0.7"; }
+const char*   Si_I2C_TAG_TEXT      (void) { return (char *)"V5.1.1"; }
 /************************************************************************************************************************
   L0_FastI2C  function
   Use:        function to set the i2c speed
@@ -2047,14 +2427,168 @@ int     L0_SlowI2C           (void) {
 #endif /* USB_Capability */
   return 1;
 }
+#ifdef    LINUX_SPIDEV_Capability
+/* Re-definition of SiTRACE for the spidev functions */
+#ifdef    SiTRACES
+  #undef  SiTRACE
+  #define SiTRACE(...)        SiTraceFunction(SiLEVEL, "spidev", __FILE__, __LINE__, __func__     ,__VA_ARGS__)
+#endif /* SiTRACES */
+/************************************************************************************************************************
+  L0_SPIDEV_ioctl_default function
+  Use:        default spidev ioctl function
+  Returns:    the ioctl return value
+************************************************************************************************************************/
+int     L0_SPIDEV_ioctl_default (int fd, unsigned long request, void *arg) {
+  return ioctl(fd, request, arg);
+}
+/************************************************************************************************************************
+  L0_SPIDEV_Setup function
+  Use:        spidev backend configuration
+              Used to select the spidev device, the SPI clock frequency and the ioctl function.
+              If device is NULL, no device is opened and all requests are sent to ioctl_func with fd = -1.
+              This allows testing the SPI download with a user-space spidev mock.
+  Parameters: device,     the spidev device path (i.e. "/dev/spidev0.0"), or NULL to only use ioctl_func
+              speed_hz,   the SPI clock frequency
+              ioctl_func, the ioctl function, NULL to use the system ioctl
+  Returns:    1
+************************************************************************************************************************/
+int     L0_SPIDEV_Setup      (const char *device, unsigned int speed_hz, L0_SPIDEV_IOCTL_FUNC ioctl_func) {
+  if ( (L0_SPIDEV_fd >= 0) && (L0_SPIDEV_device[0] != 0x00) ) { close(L0_SPIDEV_fd); }
+  L0_SPIDEV_fd = -1;
+  if (device != NULL) {
+    snprintf(L0_SPIDEV_device, sizeof(L0_SPIDEV_device), "%s", device);
+  } else {
+    L0_SPIDEV_device[0] = 0x00;
+  }
+  L0_SPIDEV_speed_hz   = speed_hz;
+  L0_SPIDEV_ioctl      = (ioctl_func != NULL) ? ioctl_func : L0_SPIDEV_ioctl_default;
+  L0_SPIDEV_configured = 1;
+  return 1;
+}
+/************************************************************************************************************************
+  L0_SPIStats function
+  Use:        spidev statistics retrieval function
+  Parameters: stats, a pointer to a L0_SPI_Stats structure to fill (can be NULL)
+              reset, 1 to clear the statistics after reading them
+************************************************************************************************************************/
+void    L0_SPIStats          (L0_SPI_Stats *stats, int reset) {
+  signed   int bit_reversal;
+  if (stats != NULL) { *stats = L0_SPI_Statistics; }
+  if (reset) {
+    bit_reversal = L0_SPI_Statistics.bit_reversal;
+    memset(&L0_SPI_Statistics, 0, sizeof(L0_SPI_Statistics));
+    L0_SPI_Statistics.bit_reversal = bit_reversal;
+  }
+}
+/************************************************************************************************************************
+  L0_SPIDEV_Enable function
+  Use:        spidev opening and configuration
+              The SPI mode and bit order are selected to match the way the part samples the SPI signals:
+               - L0_SPI_CONFIG_CLK_FALLING: SPI mode 1 (data sampled on the falling edge), mode 0 otherwise
+               - L0_SPI_CONFIG_LSB_FIRST:   LSB first. If the controller doesn't support it, the bytes are bit-reversed by SW.
+  Parameters: SPI_config, a combination of L0_SPI_CONFIG_xxx values
+  Returns:    1 if OK, 0 if the device can not be used
+************************************************************************************************************************/
+int     L0_SPIDEV_Enable     (unsigned char SPI_config) {
+  unsigned char mode;
+  unsigned char lsb_first;
+  unsigned char bits;
+  unsigned int  speed_hz;
+  if (!L0_SPIDEV_configured) { L0_SPIDEV_Setup(L0_SPIDEV_DEVICE, L0_SPIDEV_SPEED_HZ, NULL); }
+  if ( (L0_SPIDEV_fd < 0) && (L0_SPIDEV_device[0] != 0x00) ) {
+    L0_SPIDEV_fd = open(L0_SPIDEV_device, O_RDWR);
+    if (L0_SPIDEV_fd < 0) {
+      SiTRACE("can not open '%s'\n", L0_SPIDEV_device);
+      return 0;
+    }
+  }
+  mode      = (SPI_config & L0_SPI_CONFIG_CLK_FALLING) ? SPI_MODE_1 : SPI_MODE_0;
+  bits      = 8;
+  speed_hz  = L0_SPIDEV_speed_hz;
+  lsb_first = (SPI_config & L0_SPI_CONFIG_LSB_FIRST) ? 1 : 0;
+  if ( (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_WR_MODE         , &mode    ) < 0)
+    || (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_WR_BITS_PER_WORD, &bits    ) < 0)
+    || (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_WR_MAX_SPEED_HZ , &speed_hz) < 0) ) {
+    SiTRACE("can not configure '%s' (mode %d, %d Hz)\n", L0_SPIDEV_device, mode, speed_hz);
+    return 0;
+  }
+  L0_SPI_Statistics.bit_reversal = 0;
+  if (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_WR_LSB_FIRST, &lsb_first) < 0) {
+    if (!lsb_first) { return 0; }
+    /* LSB first not supported by the controller: sending MSB first with bit-reversed bytes */
+    lsb_first = 0;
+    if (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_WR_LSB_FIRST, &lsb_first) < 0) { return 0; }
+    L0_SPI_Statistics.bit_reversal = 1;
+  }
+  SiTRACE("'%s' mode %d, %s first%s, %d Hz\n", L0_SPIDEV_device, mode, (SPI_config & L0_SPI_CONFIG_LSB_FIRST) ? "LSB" : "MSB", L0_SPI_Statistics.bit_reversal ? " (SW bit reversal)" : "", speed_hz);
+  return 1;
+}
+/************************************************************************************************************************
+  L0_SPIDEV_Send function
+  Use:        spidev download function
+              Used to send a series of bytes using SPI_IOC_MESSAGE ioctls of up to L0_SPIDEV_TRANSFERS transfers
+              of L0_SPIDEV_TRANSFER_SIZE bytes each (L0_SPIDEV_MESSAGE_SIZE bytes per ioctl).
+              The chip select is kept active between the transfers of a message.
+  Parameters: SPI_data, the buffer containing the SPI bytes to send.
+              length, the number of bytes to send
+  Returns:    0 if OK, 1 in case of an error
+************************************************************************************************************************/
+int     L0_SPIDEV_Send       (unsigned char *SPI_data, int  length) {
+  struct spi_ioc_transfer  xfer[L0_SPIDEV_TRANSFERS];
+  unsigned char           *data;
+  unsigned long            start_us;
+  int                      n;
+  int                      size;
+  int                      message_size;
+  int                      i;
+  int                      b;
+  unsigned char            byte;
+  start_us = L0_StatsTime_us();
+  while (length > 0) {
+    message_size = (length > L0_SPIDEV_MESSAGE_SIZE) ? L0_SPIDEV_MESSAGE_SIZE : length;
+    data = SPI_data;
+    if (L0_SPI_Statistics.bit_reversal) {
+      for (i = 0; i < message_size; i++) {
+        byte = 0;
+        for (b = 0; b < 8; b++) { if (SPI_data[i] & (1<<b)) { byte = byte | (0x80>>b); } }
+        L0_SPIDEV_buffer[i] = byte;
+      }
+      data = L0_SPIDEV_buffer;
+    }
+    memset(xfer, 0, sizeof(xfer));
+    for (n = 0, i = 0; i < message_size; n++, i = i + size) {
+      size = ((message_size - i) > L0_SPIDEV_TRANSFER_SIZE) ? L0_SPIDEV_TRANSFER_SIZE : (message_size - i);
+      xfer[n].tx_buf        = (unsigned long)(data + i);
+      xfer[n].len           = size;
+      xfer[n].speed_hz      = L0_SPIDEV_speed_hz;
+      xfer[n].bits_per_word = 8;
+    }
+    if (L0_SPIDEV_ioctl(L0_SPIDEV_fd, SPI_IOC_MESSAGE(n), xfer) < message_size) {
+      SiTRACE("SPI_IOC_MESSAGE(%d) error sending %d bytes\n", n, message_size);
+      L0_SPI_Statistics.errors++;
+      L0_SPI_Statistics.time_us += L0_StatsTime_us() - start_us;
+      return 1;
+    }
+    L0_SPI_Statistics.messages++;
+    L0_SPI_Statistics.transfers += n;
+    L0_SPI_Statistics.bytes     += message_size;
+    SPI_data = SPI_data + message_size;
+    length   = length   - message_size;
+  }
+  L0_SPI_Statistics.time_us += L0_StatsTime_us() - start_us;
+  return 0;
+}
+#endif /* LINUX_SPIDEV_Capability */
 /************************************************************************************************************************
   L0_EnableSPI function
   Use:        SPI enable function
               Used to allow sending a series of bytes over SPI
 
   Porting:Needs to be completed to match the SPI HW. Initially suppoting only the Cypress chip.
+          With LINUX_SPIDEV_Capability, the Linux spidev driver is used.
 
   Parameters: SPI_config. One byte used to select with the cypress chip the initial port A (OEA) enable configuration
+              With LINUX_SPIDEV_Capability, a combination of L0_SPI_CONFIG_xxx values.
 
   Returns:    1 if OK, 0 if SPI is not available
 ************************************************************************************************************************/
@@ -2065,6 +2599,9 @@ int     L0_EnableSPI         (unsigned char SPI_config) {
     return 1;
   #endif /* CYPRESS_SPI_Capability */
 #endif /* USB_Capability */
+#ifdef    LINUX_SPIDEV_Capability
+  return L0_SPIDEV_Enable(SPI_config);
+#endif /* LINUX_SPIDEV_Capability */
   SPI_config = SPI_config;
   res = 0;
   /* <porting> Insert here whatever is needed to
@@ -2116,6 +2653,7 @@ int     L0_LoadSPIoverPortA  (unsigned char *SPI_data, unsigned char  length, un
               Used to send a series of bytes over SPI on the GPIF pins
 
   Porting:Needs to be completed to match the SPI HW. Initially supporting only the Cypress chip.
+          With LINUX_SPIDEV_Capability, the Linux spidev driver is used.
 
   Parameters:   SPI_data, the buffer containing the SPI bytes to send.
                 length, the number of bytes to send
@@ -2141,6 +2679,9 @@ int     L0_LoadSPIoverGPIF   (unsigned char *SPI_data, int  length) {
              Cypress_USB_LoadSPIwaitDONE(10000);
   #endif /* CYPRESS_SPI_Capability */
 #endif /* USB_Capability */
+#ifdef    LINUX_SPIDEV_Capability
+  res = L0_SPIDEV_Send(SPI_data, length);
+#endif /* LINUX_SPIDEV_Capability */
   return res;
 }
 /* Re-definition of SiTRACE for L0_Context */
@@ -2161,6 +2702,11 @@ int     L0_LoadSPIoverGPIF   (unsigned char *SPI_data, int  length) {
 int     L0_DisableSPI        (void) {
   int res;
   res = 0;
+#ifdef    LINUX_SPIDEV_Capability
+  if ( (L0_SPIDEV_fd >= 0) && (L0_SPIDEV_device[0] != 0x00) ) { close(L0_SPIDEV_fd); }
+  L0_SPIDEV_fd = -1;
+  res = 1;
+#endif /* LINUX_SPIDEV_Capability */
   return res;
 }
 
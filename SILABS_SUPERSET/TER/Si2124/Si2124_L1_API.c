@@ -81,24 +81,16 @@ unsigned char    Si2124_L1_API_Init      (L1_Si2124_Context *api, signed   int a
   Returns:    0 if no error
  ***********************************************************************************************************************/
 unsigned char    Si2124_L1_API_Patch     (L1_Si2124_Context *api, signed   int iNbBytes, unsigned char *pucDataBuffer) {
-    signed   int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2124 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2124_L1_API_Patch error writing bytes: %s\n", Si2124_L1_API_ERROR_TEXT(ERROR_Si2124_LOADING_FIRMWARE) );
-      return ERROR_Si2124_LOADING_FIRMWARE;
-    }
-
-    res = Si2124_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2124_ERROR) {
-      SiTRACE("Si2124_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2124_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2124_POLLING_RESPONSE;
+      SiTRACE("Si2124_L1_API_Patch error 0x%02x: %s\n", res, Si2124_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2124_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2124_L1_CheckStatus function
@@ -32,6 +32,7 @@ unsigned char Si2141_pollForResetState     (L1_Si2141_Context *api);
 unsigned char Si2141_GetStatus             (L1_Si2141_Context *api);
 unsigned char Si2141_pollForCTS            (L1_Si2141_Context *api);
 unsigned char Si2141_pollForResponse       (L1_Si2141_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer);
+unsigned char Si2141_sendCommand           (L1_Si2141_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
 unsigned char Si2141_L1_SendCommand2       (L1_Si2141_Context *api, unsigned int cmd_code);
 unsigned char Si2141_L1_SetProperty        (L1_Si2141_Context *api, unsigned int prop_code, int  data);
 unsigned char Si2141_L1_GetProperty        (L1_Si2141_Context *api, unsigned int prop_code, int *data);
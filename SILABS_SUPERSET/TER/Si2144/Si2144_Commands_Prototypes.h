@@ -31,6 +31,7 @@ unsigned char Si2144_CurrentResponseStatus (L1_Si2144_Context *api, unsigned cha
 unsigned char Si2144_pollForResetState     (L1_Si2144_Context *api);
 unsigned char Si2144_pollForCTS            (L1_Si2144_Context *api);
 unsigned char Si2144_pollForResponse       (L1_Si2144_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer);
+unsigned char Si2144_sendCommand           (L1_Si2144_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
 unsigned char Si2144_GetStatus             (L1_Si2144_Context *api);
 unsigned char Si2144_L1_SendCommand2       (L1_Si2144_Context *api, unsigned int cmd_code);
 unsigned char Si2144_L1_SetProperty        (L1_Si2144_Context *api, unsigned int prop_code, signed int  data);
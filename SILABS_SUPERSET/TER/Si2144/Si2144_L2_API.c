@@ -447,31 +447,16 @@ signed   int Si2144_PowerUpUsingBroadcastI2C   (L1_Si2144_Context *tuners[], sig
 signed   int Si2144_LoadFirmware_16            (L1_Si2144_Context *api, firmware_struct fw_table[], signed   int nbLines)
 {
     signed   int return_code;
-    signed   int line;
     return_code = NO_Si2144_ERROR;
 
     SiTRACE ("Si2144_LoadFirmware_16 starting...\n");
     SiTRACE ("Si2144_LoadFirmware_16 nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-      if (fw_table[line].firmware_len > 0)  /* don't download if length is 0 , e.g. dummy firmware */
-      {
-        /* send firmware_len bytes (up to 16) to Si2144 */
-        if ((return_code = Si2144_L1_API_Patch(api, fw_table[line].firmware_len, fw_table[line].firmware_table)) != NO_Si2144_ERROR)
-        {
-          SiTRACE("Si2144_LoadFirmware_16 error 0x%02x patching line %d: %s\n", return_code, line, Si2144_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          SiTraceConfiguration((char*)"traces resume");
-          return ERROR_Si2144_LOADING_FIRMWARE;
-        }
-        if (line==3) SiTraceConfiguration("traces suspend");
-      }
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware_16(api->i2c, fw_table, nbLines)) != NO_Si2144_ERROR) {
+      SiTRACE("Si2144_LoadFirmware_16 error 0x%02x: %s\n", return_code, Si2144_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2144_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces resume");
     /* Storing Properties startup configuration in propShadow                              */
     /* !! Do NOT change the content of Si2144_storePropertiesDefaults                   !! */
     /* !! It should reflect the part internal property settings after firmware download !! */
@@ -494,28 +479,16 @@ signed   int Si2144_LoadFirmware_16            (L1_Si2144_Context *api, firmware
 signed   int Si2144_LoadFirmware               (L1_Si2144_Context *api, unsigned char fw_table[], signed   int nbLines)
 {
     signed   int return_code;
-    signed   int line;
     return_code = NO_Si2144_ERROR;
 
     SiTRACE ("Si2144_LoadFirmware starting...\n");
     SiTRACE ("Si2144_LoadFirmware nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2144_BYTES_PER_LINE fw bytes to Si2144 */
-        if ((return_code = Si2144_L1_API_Patch(api, Si2144_BYTES_PER_LINE, fw_table + Si2144_BYTES_PER_LINE*line)) != NO_Si2144_ERROR)
-        {
-          SiTRACE("Si2144_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2144_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          SiTraceConfiguration((char*)"traces resume");
-          return ERROR_Si2144_LOADING_FIRMWARE;
-        }
-        if (line==3) {SiTraceConfiguration("traces suspend");}
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2144_BYTES_PER_LINE, nbLines)) != NO_Si2144_ERROR) {
+      SiTRACE("Si2144_LoadFirmware error 0x%02x: %s\n", return_code, Si2144_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2144_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces resume");
 
     /* Storing Properties startup configuration in propShadow                              */
     /* !! Do NOT change the content of Si2144_storePropertiesDefaults                   !! */
@@ -519,27 +519,16 @@ int Si2146_PowerUpWithPatch    (L1_Si2146_Context *api)
 int Si2146_LoadFirmware        (L1_Si2146_Context *api, unsigned char fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2146_ERROR;
 
     SiTRACE ("Si2146_LoadFirmware starting...\n");
     SiTRACE ("Si2146_LoadFirmware nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2146_BYTES_PER_LINE fw bytes to Si2146 */
-        if ((return_code = Si2146_L1_API_Patch(api, Si2146_BYTES_PER_LINE, fw_table + Si2146_BYTES_PER_LINE*line)) != NO_Si2146_ERROR)
-        {
-          SiTRACE("Si2146_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2146_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          return ERROR_Si2146_LOADING_FIRMWARE;
-        }
-        if (line==3) SiTraceConfiguration("traces -output none");
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2146_BYTES_PER_LINE, nbLines)) != NO_Si2146_ERROR) {
+      SiTRACE("Si2146_LoadFirmware error 0x%02x: %s\n", return_code, Si2146_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2146_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces -output file");
     SiTRACE ("Si2146_LoadFirmware complete...\n");
     return NO_Si2146_ERROR;
 }
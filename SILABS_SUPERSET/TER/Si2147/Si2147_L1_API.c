@@ -67,24 +67,16 @@ unsigned char    Si2147_L1_API_Init      (L1_Si2147_Context *api, int add) {
   Porting:    May not be required for the final application, can be removed if not used.
  ***********************************************************************************************************************/
 unsigned char    Si2147_L1_API_Patch     (L1_Si2147_Context *api, int iNbBytes, unsigned char *pucDataBuffer) {
-    int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2147 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2147_L1_API_Patch error writing bytes: %s\n", Si2147_L1_API_ERROR_TEXT(ERROR_Si2147_LOADING_FIRMWARE) );
-      return ERROR_Si2147_LOADING_FIRMWARE;
-    }
-
-    res = Si2147_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2147_ERROR) {
-      SiTRACE("Si2147_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2147_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2147_POLLING_RESPONSE;
+      SiTRACE("Si2147_L1_API_Patch error 0x%02x: %s\n", res, Si2147_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2147_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2147_L1_CheckStatus function
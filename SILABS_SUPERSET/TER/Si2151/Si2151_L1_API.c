@@ -78,24 +78,16 @@ unsigned char    Si2151_L1_API_Init      (L1_Si2151_Context *api, int add) {
   Returns:    0 if no error
  ***********************************************************************************************************************/
 unsigned char    Si2151_L1_API_Patch     (L1_Si2151_Context *api, int iNbBytes, unsigned char *pucDataBuffer) {
-    int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2151 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2151_L1_API_Patch error writing bytes: %s\n", Si2151_L1_API_ERROR_TEXT(ERROR_Si2151_LOADING_FIRMWARE) );
-      return ERROR_Si2151_LOADING_FIRMWARE;
-    }
-
-    res = Si2151_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2151_ERROR) {
-      SiTRACE("Si2151_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2151_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2151_POLLING_RESPONSE;
+      SiTRACE("Si2151_L1_API_Patch error 0x%02x: %s\n", res, Si2151_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2151_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2151_L1_CheckStatus function
@@ -28,6 +28,7 @@ limitations under the License.
 unsigned char Si2156_CurrentResponseStatus (L1_Si2156_Context *api, unsigned char ptDataBuffer);
 unsigned char Si2156_pollForCTS            (L1_Si2156_Context *api);
 unsigned char Si2156_pollForResponse       (L1_Si2156_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer);
+unsigned char Si2156_sendCommand           (L1_Si2156_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
 unsigned char Si2156_L1_SendCommand2       (L1_Si2156_Context *api, unsigned int cmd_code);
 unsigned char Si2156_L1_SetProperty        (L1_Si2156_Context *api, unsigned int prop, int  data);
 unsigned char Si2156_L1_GetProperty        (L1_Si2156_Context *api, unsigned int prop, int *data);
@@ -77,23 +77,15 @@ unsigned char    Si2156_L1_API_Init      (L1_Si2156_Context *api, int add) {
  ***********************************************************************************************************************/
 unsigned char    Si2156_L1_API_Patch     (L1_Si2156_Context *api, int iNbBytes, unsigned char *pucDataBuffer) {
     unsigned char res;
-    unsigned char rspByteBuffer[1];
 
     SiTRACE("Si2156 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2156_L1_API_Patch error 0x%02x writing bytes: %s\n", res, Si2156_L1_API_ERROR_TEXT(res) );
-      return res;
-    }
-
-    res = Si2156_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2156_ERROR) {
-      SiTRACE("Si2156_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2156_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2156_POLLING_RESPONSE;
+      SiTRACE("Si2156_L1_API_Patch error 0x%02x: %s\n", res, Si2156_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2156_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2156_L1_CheckStatus function
@@ -269,30 +269,16 @@ int Si2157_PowerUpUsingBroadcastI2C    (L1_Si2157_Context *tuners[], int tuner_c
 int Si2157_LoadFirmware_16        (L1_Si2157_Context *api, firmware_struct fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2157_ERROR;
 
     SiTRACE ("Si2157_LoadFirmware_16 starting...\n");
     SiTRACE ("Si2157_LoadFirmware_16 nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-    if (fw_table[line].firmware_len > 0)  /* don't download if length is 0 , e.g. dummy firmware */
-    {
-      /* send firmware_len bytes (up to 16) to Si2157 */
-      if ((return_code = Si2157_L1_API_Patch(api, fw_table[line].firmware_len, fw_table[line].firmware_table)) != NO_Si2157_ERROR)
-      {
-        SiTRACE("Si2157_LoadFirmware_16 error 0x%02x patching line %d: %s\n", return_code, line, Si2157_L1_API_ERROR_TEXT(return_code) );
-        if (line == 0) {
-        SiTRACE("The firmware is incompatible with the part!\n");
-        }
-        return ERROR_Si2157_LOADING_FIRMWARE;
-      }
-      if (line==3) SiTraceConfiguration("traces suspend");
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware_16(api->i2c, fw_table, nbLines)) != NO_Si2157_ERROR) {
+      SiTRACE("Si2157_LoadFirmware_16 error 0x%02x: %s\n", return_code, Si2157_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2157_LOADING_FIRMWARE;
     }
-    }
-    SiTraceConfiguration("traces resume");
     SiTRACE ("Si2157_LoadFirmware_16 complete...\n");
     return NO_Si2157_ERROR;
 }
@@ -312,27 +298,16 @@ int Si2157_LoadFirmware_16        (L1_Si2157_Context *api, firmware_struct fw_ta
 int Si2157_LoadFirmware        (L1_Si2157_Context *api, unsigned char fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2157_ERROR;
 
     SiTRACE ("Si2157_LoadFirmware starting...\n");
     SiTRACE ("Si2157_LoadFirmware nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2157_BYTES_PER_LINE fw bytes to Si2157 */
-        if ((return_code = Si2157_L1_API_Patch(api, Si2157_BYTES_PER_LINE, fw_table + Si2157_BYTES_PER_LINE*line)) != NO_Si2157_ERROR)
-        {
-          SiTRACE("Si2157_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2157_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          return ERROR_Si2157_LOADING_FIRMWARE;
-        }
-        if (line==3) {SiTraceConfiguration("traces suspend");}
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2157_BYTES_PER_LINE, nbLines)) != NO_Si2157_ERROR) {
+      SiTRACE("Si2157_LoadFirmware error 0x%02x: %s\n", return_code, Si2157_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2157_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces resume");
     SiTRACE ("Si2157_LoadFirmware complete...\n");
     return NO_Si2157_ERROR;
 }
@@ -68,24 +68,16 @@ unsigned char    Si2158B_L1_API_Init      (L1_Si2158B_Context *api, int add) {
   Porting:    May not be required for the final application, can be removed if not used.
  ***********************************************************************************************************************/
 unsigned char    Si2158B_L1_API_Patch     (L1_Si2158B_Context *api, int iNbBytes, unsigned char *pucDataBuffer) {
-    int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2158B Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2158B_L1_API_Patch error writing bytes: %s\n", Si2158B_L1_API_ERROR_TEXT(ERROR_Si2158B_LOADING_FIRMWARE) );
-      return ERROR_Si2158B_LOADING_FIRMWARE;
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
+    if (res != NO_Si2158B_ERROR) {
+      SiTRACE("Si2158B_L1_API_Patch error 0x%02x: %s\n", res, Si2158B_L1_API_ERROR_TEXT(res) );
     }
 
-        res = Si2158B_pollForResponse(api, 1, rspByteBuffer);
-        if (res != NO_Si2158B_ERROR) {
-          SiTRACE("Si2158B_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2158B_L1_API_ERROR_TEXT(res) );
-          return ERROR_Si2158B_POLLING_RESPONSE;
-        }
-
-    return NO_Si2158B_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2158B_L1_CheckStatus function
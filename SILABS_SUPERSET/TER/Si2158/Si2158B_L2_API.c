@@ -283,31 +283,16 @@ int Si2158B_PowerUpUsingBroadcastI2C    (L1_Si2158B_Context *tuners[], int tuner
 int Si2158B_LoadFirmware_16        (L1_Si2158B_Context *api, firmware_struct fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2158B_ERROR;
 
     SiTRACE ("Si2158B_LoadFirmware_16 starting...\n");
     SiTRACE ("Si2158B_LoadFirmware_16 nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-		if (fw_table[line].firmware_len > 0)  /* don't download if length is 0 , e.g. dummy firmware */
-		{
-			/* send firmware_len bytes (up to 16) to Si2158B */
-			if ((return_code = Si2158B_L1_API_Patch(api, fw_table[line].firmware_len, fw_table[line].firmware_table)) != NO_Si2158B_ERROR)
-			{
-			  SiTRACE("Si2158B_LoadFirmware_16 error 0x%02x patching line %d: %s\n", return_code, line, Si2158B_L1_API_ERROR_TEXT(return_code) );
-			  if (line == 0) {
-			  SiTRACE("The firmware is incompatible with the part!\n");
-			  }
-          SiTraceConfiguration((char*)"traces resume");
-			  return ERROR_Si2158B_LOADING_FIRMWARE;
-			}
-      if (line==3) SiTraceConfiguration("traces suspend");
-		}
-    }
-    SiTraceConfiguration("traces resume");
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware_16(api->i2c, fw_table, nbLines)) != NO_Si2158B_ERROR) {
+      SiTRACE("Si2158B_LoadFirmware_16 error 0x%02x: %s\n", return_code, Si2158B_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2158B_LOADING_FIRMWARE;
+    }
     SiTRACE ("Si2158B_LoadFirmware_16 complete...\n");
     return NO_Si2158B_ERROR;
 }
@@ -327,28 +312,16 @@ int Si2158B_LoadFirmware_16        (L1_Si2158B_Context *api, firmware_struct fw_
 int Si2158B_LoadFirmware        (L1_Si2158B_Context *api, unsigned char fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2158B_ERROR;
 
     SiTRACE ("Si2158B_LoadFirmware starting...\n");
     SiTRACE ("Si2158B_LoadFirmware nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2158B_BYTES_PER_LINE fw bytes to Si2158B */
-        if ((return_code = Si2158B_L1_API_Patch(api, Si2158B_BYTES_PER_LINE, fw_table + Si2158B_BYTES_PER_LINE*line)) != NO_Si2158B_ERROR)
-        {
-          SiTRACE("Si2158B_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2158B_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          SiTraceConfiguration((char*)"traces resume");
-          return ERROR_Si2158B_LOADING_FIRMWARE;
-        }
-        if (line==3) {SiTraceConfiguration("traces suspend");}
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2158B_BYTES_PER_LINE, nbLines)) != NO_Si2158B_ERROR) {
+      SiTRACE("Si2158B_LoadFirmware error 0x%02x: %s\n", return_code, Si2158B_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2158B_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces resume");
     SiTRACE ("Si2158B_LoadFirmware complete...\n");
     return NO_Si2158B_ERROR;
 }
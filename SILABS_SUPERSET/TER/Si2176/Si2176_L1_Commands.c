@@ -27,6 +27,17 @@ limitations under the License.
 
 #include "Si2176_L1_API.h"
 
+/* The L0 command engine return values are returned unchanged as Si2176 error codes: the values must match */
+#if    (NO_Si2176_ERROR               != L0_COMMAND_NO_ERROR) \
+   || (ERROR_Si2176_SENDING_COMMAND  != L0_COMMAND_SENDING_COMMAND) \
+   || (ERROR_Si2176_CTS_TIMEOUT      != L0_COMMAND_CTS_TIMEOUT) \
+   || (ERROR_Si2176_ERR              != L0_COMMAND_ERR) \
+   || (ERROR_Si2176_POLLING_CTS      != L0_COMMAND_POLLING_CTS) \
+   || (ERROR_Si2176_POLLING_RESPONSE != L0_COMMAND_POLLING_RESPONSE) \
+   || (ERROR_Si2176_LOADING_FIRMWARE != L0_COMMAND_LOADING_FIRMWARE)
+  "If you get a compilation error on this line, it means that the Si2176 error codes no longer match the L0_COMMAND_xxx codes of Silabs_L0_API.h. Please map the L0_COMMAND_xxx codes in Si2176_pollForResponse, Si2176_sendCommand, Si2176_L1_API_Patch and Si2176_LoadFirmware!";
+#endif
+
 /***********************************************************************************************************************
   Si2176_CurrentResponseStatus function
   Use:        status checking function
@@ -54,30 +65,13 @@ unsigned char Si2176_CurrentResponseStatus (L1_Si2176_Context *api, unsigned cha
               Used to check the CTS bit until it is set before sending the next command
   Comments:   The status byte definition being identical for all commands,
               using this function to fill the status structure helps reducing the code size
-              max timeout = 1000 ms
+              polled by the L0 command engine (L0_PollForCTS), max timeout = L0_COMMAND_TIMEOUT_MS
 
   Returns:   1 if the CTS bit is set, 0 otherwise
  ***********************************************************************************************************************/
 unsigned char Si2176_pollForCTS (L1_Si2176_Context *api)
 {
-  unsigned char rspByteBuffer[1];
-  unsigned int start_time;
-
-  start_time = system_time();
-
-  while (system_time() - start_time <1000)  { /* wait a maximum of 1000ms */
-    if (L0_ReadCommandBytes(api->i2c, 1, rspByteBuffer) != 1) {
-      SiTRACE("Si2176_pollForCTS ERROR reading byte 0!\n");
-      return ERROR_Si2176_POLLING_CTS;
-    }
-    /* return OK if CTS set */
-    if (rspByteBuffer[0] & 0x80) {
-      return NO_Si2176_ERROR;
-    }
-  }
-
-  SiTRACE("Si2176_pollForCTS ERROR CTS Timeout!\n");
-  return ERROR_Si2176_CTS_TIMEOUT;
+  return L0_PollForCTS(api->i2c);
 }
 
 /***********************************************************************************************************************
@@ -86,7 +80,7 @@ unsigned char Si2176_pollForCTS (L1_Si2176_Context *api)
               Used to retrieve the command response in the provided buffer
   Comments:   The status byte definition being identical for all commands,
               using this function to fill the status structure helps reducing the code size
-              max timeout = 1000 ms
+              polled by the L0 command engine (L0_PollForResponse), max timeout = L0_COMMAND_TIMEOUT_MS
 
   Parameter:  nbBytes          the number of response bytes to read
   Parameter:  pByteBuffer      a buffer into which bytes will be stored
@@ -94,23 +88,36 @@ unsigned char Si2176_pollForCTS (L1_Si2176_Context *api)
  ***********************************************************************************************************************/
 unsigned char Si2176_pollForResponse (L1_Si2176_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer)
 {
-  unsigned int start_time;
+  unsigned char error_code;
 
-  start_time = system_time();
-
-  while (system_time() - start_time <1000)  { /* wait a maximum of 1000ms */
-    if ((unsigned int)L0_ReadCommandBytes(api->i2c, nbBytes, pByteBuffer) != nbBytes) {
-      SiTRACE("Si2176_pollForResponse ERROR reading byte 0!\n");
-      return ERROR_Si2176_POLLING_RESPONSE;
-    }
-    /* return response err flag if CTS set */
-    if (pByteBuffer[0] & 0x80)  {
-      return Si2176_CurrentResponseStatus(api, pByteBuffer[0]);
-    }
+  error_code = L0_PollForResponse(api->i2c, nbBytes, pByteBuffer);
+  if ((error_code != NO_Si2176_ERROR) && (error_code != ERROR_Si2176_ERR)) {
+    return error_code;
   }
+  return Si2176_CurrentResponseStatus(api, pByteBuffer[0]);
+}
+/***********************************************************************************************************************
+  Si2176_sendCommand function
+  Use:        command sending function
+              Used to send a command and retrieve its response in the provided buffer
+  Comments:   The command is written and its response polled by the L0 command engine (L0_SendCommand),
+              max timeout = L0_COMMAND_TIMEOUT_MS
+
+  Parameter:  nbCmdBytes       the number of command bytes
+  Parameter:  cmdByteBuffer    a buffer containing the command bytes
+  Parameter:  nbRspBytes       the number of response bytes to read
+  Parameter:  rspByteBuffer    a buffer into which response bytes will be stored
+  Returns:    0 if no error, an error code otherwise
+ ***********************************************************************************************************************/
+unsigned char Si2176_sendCommand (L1_Si2176_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer)
+{
+  unsigned char error_code;
 
-  SiTRACE("Si2176_pollForResponse ERROR CTS Timeout!\n");
-  return ERROR_Si2176_CTS_TIMEOUT;
+  error_code = L0_SendCommand(api->i2c, nbCmdBytes, cmdByteBuffer, nbRspBytes, rspByteBuffer);
+  if ((error_code != NO_Si2176_ERROR) && (error_code != ERROR_Si2176_ERR)) {
+    return error_code;
+  }
+  return Si2176_CurrentResponseStatus(api, rspByteBuffer[0]);
 }
 
 /* _commands_insertion_start */
@@ -142,14 +149,9 @@ unsigned char Si2176_L1_AGC_OVERRIDE    (L1_Si2176_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( force_max_gain & Si2176_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_MASK ) << Si2176_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_LSB|
                                          ( force_top_gain & Si2176_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_MASK ) << Si2176_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing AGC_OVERRIDE bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling AGC_OVERRIDE response\n");
+      SiTRACE("Error sending AGC_OVERRIDE command\n");
       return error_code;
     }
 
@@ -182,14 +184,9 @@ unsigned char Si2176_L1_ATV_RESTART     (L1_Si2176_Context *api,
     cmdByteBuffer[0] = Si2176_ATV_RESTART_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( mode & Si2176_ATV_RESTART_CMD_MODE_MASK ) << Si2176_ATV_RESTART_CMD_MODE_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing ATV_RESTART bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling ATV_RESTART response\n");
+      SiTRACE("Error sending ATV_RESTART command\n");
       return error_code;
     }
 
@@ -222,14 +219,9 @@ unsigned char Si2176_L1_ATV_STATUS      (L1_Si2176_Context *api,
     cmdByteBuffer[0] = Si2176_ATV_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2176_ATV_STATUS_CMD_INTACK_MASK ) << Si2176_ATV_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing ATV_STATUS bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 11, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 11, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling ATV_STATUS response\n");
+      SiTRACE("Error sending ATV_STATUS command\n");
       return error_code;
     }
 
@@ -305,14 +297,9 @@ unsigned char Si2176_L1_CONFIG_PINS     (L1_Si2176_Context *api,
                                          ( bclk1_read & Si2176_CONFIG_PINS_CMD_BCLK1_READ_MASK ) << Si2176_CONFIG_PINS_CMD_BCLK1_READ_LSB);
     cmdByteBuffer[5] = (unsigned char) ( ( xout_mode  & Si2176_CONFIG_PINS_CMD_XOUT_MODE_MASK  ) << Si2176_CONFIG_PINS_CMD_XOUT_MODE_LSB );
 
-    if (L0_WriteCommandBytes(api->i2c, 6, cmdByteBuffer) != 6) {
-      SiTRACE("Error writing CONFIG_PINS bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 6, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 6, cmdByteBuffer, 6, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling CONFIG_PINS response\n");
+      SiTRACE("Error sending CONFIG_PINS command\n");
       return error_code;
     }
 
@@ -344,14 +331,9 @@ unsigned char Si2176_L1_DTV_RESTART     (L1_Si2176_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2176_DTV_RESTART_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing DTV_RESTART bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 1, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DTV_RESTART response\n");
+      SiTRACE("Error sending DTV_RESTART command\n");
       return error_code;
     }
 
@@ -384,14 +366,9 @@ unsigned char Si2176_L1_DTV_STATUS      (L1_Si2176_Context *api,
     cmdByteBuffer[0] = Si2176_DTV_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2176_DTV_STATUS_CMD_INTACK_MASK ) << Si2176_DTV_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing DTV_STATUS bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling DTV_STATUS response\n");
+      SiTRACE("Error sending DTV_STATUS command\n");
       return error_code;
     }
 
@@ -431,14 +408,9 @@ unsigned char Si2176_L1_EXIT_BOOTLOADER (L1_Si2176_Context *api,
     cmdByteBuffer[1] = (unsigned char) ( ( func   & Si2176_EXIT_BOOTLOADER_CMD_FUNC_MASK   ) << Si2176_EXIT_BOOTLOADER_CMD_FUNC_LSB  |
                                          ( ctsien & Si2176_EXIT_BOOTLOADER_CMD_CTSIEN_MASK ) << Si2176_EXIT_BOOTLOADER_CMD_CTSIEN_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing EXIT_BOOTLOADER bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling EXIT_BOOTLOADER response\n");
+      SiTRACE("Error sending EXIT_BOOTLOADER command\n");
       return error_code;
     }
 
@@ -475,14 +447,9 @@ unsigned char Si2176_L1_FINE_TUNE       (L1_Si2176_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( offset_500hz & Si2176_FINE_TUNE_CMD_OFFSET_500HZ_MASK ) << Si2176_FINE_TUNE_CMD_OFFSET_500HZ_LSB);
     cmdByteBuffer[3] = (unsigned char) ((( offset_500hz & Si2176_FINE_TUNE_CMD_OFFSET_500HZ_MASK ) << Si2176_FINE_TUNE_CMD_OFFSET_500HZ_LSB)>>8);
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing FINE_TUNE bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 4, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling FINE_TUNE response\n");
+      SiTRACE("Error sending FINE_TUNE command\n");
       return error_code;
     }
 
@@ -519,14 +486,9 @@ unsigned char Si2176_L1_GET_PROPERTY    (L1_Si2176_Context *api,
     cmdByteBuffer[2] = (unsigned char) ( ( prop     & Si2176_GET_PROPERTY_CMD_PROP_MASK     ) << Si2176_GET_PROPERTY_CMD_PROP_LSB    );
     cmdByteBuffer[3] = (unsigned char) ((( prop     & Si2176_GET_PROPERTY_CMD_PROP_MASK     ) << Si2176_GET_PROPERTY_CMD_PROP_LSB    )>>8);
 
-    if (L0_WriteCommandBytes(api->i2c, 4, cmdByteBuffer) != 4) {
-      SiTRACE("Error writing GET_PROPERTY bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 4, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling GET_PROPERTY response\n");
+      SiTRACE("Error sending GET_PROPERTY command\n");
       return error_code;
     }
 
@@ -551,14 +513,9 @@ unsigned char Si2176_L1_GET_REV         (L1_Si2176_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2176_GET_REV_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing GET_REV bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 10, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 1, cmdByteBuffer, 10, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling GET_REV response\n");
+      SiTRACE("Error sending GET_REV command\n");
       return error_code;
     }
 
@@ -589,14 +546,9 @@ unsigned char Si2176_L1_PART_INFO       (L1_Si2176_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2176_PART_INFO_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing PART_INFO bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 13, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 1, cmdByteBuffer, 13, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling PART_INFO response\n");
+      SiTRACE("Error sending PART_INFO command\n");
       return error_code;
     }
 
@@ -627,14 +579,9 @@ unsigned char Si2176_L1_POWER_DOWN      (L1_Si2176_Context *api)
     SiTRACE("\n");
     cmdByteBuffer[0] = Si2176_POWER_DOWN_CMD;
 
-    if (L0_WriteCommandBytes(api->i2c, 1, cmdByteBuffer) != 1) {
-      SiTRACE("Error writing POWER_DOWN bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 1, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling POWER_DOWN response\n");
+      SiTRACE("Error sending POWER_DOWN command\n");
       return error_code;
     }
 
@@ -694,14 +641,9 @@ unsigned char Si2176_L1_POWER_UP        (L1_Si2176_Context *api,
                                          ( ctsien     & Si2176_POWER_UP_CMD_CTSIEN_MASK     ) << Si2176_POWER_UP_CMD_CTSIEN_LSB    );
     cmdByteBuffer[8] = (unsigned char) ( ( wake_up    & Si2176_POWER_UP_CMD_WAKE_UP_MASK    ) << Si2176_POWER_UP_CMD_WAKE_UP_LSB   );
 
-    if (L0_WriteCommandBytes(api->i2c, 9, cmdByteBuffer) != 9) {
-      SiTRACE("Error writing POWER_UP bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 9, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling POWER_UP response\n");
+      SiTRACE("Error sending POWER_UP command\n");
       return error_code;
     }
 
@@ -742,14 +684,9 @@ unsigned char Si2176_L1_SET_PROPERTY    (L1_Si2176_Context *api,
     cmdByteBuffer[4] = (unsigned char) ( ( data     & Si2176_SET_PROPERTY_CMD_DATA_MASK     ) << Si2176_SET_PROPERTY_CMD_DATA_LSB    );
     cmdByteBuffer[5] = (unsigned char) ((( data     & Si2176_SET_PROPERTY_CMD_DATA_MASK     ) << Si2176_SET_PROPERTY_CMD_DATA_LSB    )>>8);
 
-    if (L0_WriteCommandBytes(api->i2c, 6, cmdByteBuffer) != 6) {
-      SiTRACE("Error writing SET_PROPERTY bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 4, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 6, cmdByteBuffer, 4, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling SET_PROPERTY response\n");
+      SiTRACE("Error sending SET_PROPERTY command\n");
       return error_code;
     }
 
@@ -784,14 +721,9 @@ unsigned char Si2176_L1_STANDBY         (L1_Si2176_Context *api,
     cmdByteBuffer[0] = Si2176_STANDBY_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( type & Si2176_STANDBY_CMD_TYPE_MASK ) << Si2176_STANDBY_CMD_TYPE_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing STANDBY bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling STANDBY response\n");
+      SiTRACE("Error sending STANDBY command\n");
       return error_code;
     }
 
@@ -824,14 +756,9 @@ unsigned char Si2176_L1_TUNER_STATUS    (L1_Si2176_Context *api,
     cmdByteBuffer[0] = Si2176_TUNER_STATUS_CMD;
     cmdByteBuffer[1] = (unsigned char) ( ( intack & Si2176_TUNER_STATUS_CMD_INTACK_MASK ) << Si2176_TUNER_STATUS_CMD_INTACK_LSB);
 
-    if (L0_WriteCommandBytes(api->i2c, 2, cmdByteBuffer) != 2) {
-      SiTRACE("Error writing TUNER_STATUS bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 12, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 2, cmdByteBuffer, 12, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling TUNER_STATUS response\n");
+      SiTRACE("Error sending TUNER_STATUS command\n");
       return error_code;
     }
 
@@ -882,14 +809,9 @@ unsigned char Si2176_L1_TUNER_TUNE_FREQ (L1_Si2176_Context *api,
     cmdByteBuffer[6] = (unsigned char) ((( freq & Si2176_TUNER_TUNE_FREQ_CMD_FREQ_MASK ) << Si2176_TUNER_TUNE_FREQ_CMD_FREQ_LSB)>>16);
     cmdByteBuffer[7] = (unsigned char) ((( freq & Si2176_TUNER_TUNE_FREQ_CMD_FREQ_MASK ) << Si2176_TUNER_TUNE_FREQ_CMD_FREQ_LSB)>>24);
 
-    if (L0_WriteCommandBytes(api->i2c, 8, cmdByteBuffer) != 8) {
-      SiTRACE("Error writing TUNER_TUNE_FREQ bytes!\n");
-      return ERROR_Si2176_SENDING_COMMAND;
-    }
-
-    error_code = Si2176_pollForResponse(api, 1, rspByteBuffer);
+    error_code = Si2176_sendCommand(api, 8, cmdByteBuffer, 1, rspByteBuffer);
     if (error_code) {
-      SiTRACE("Error polling TUNER_TUNE_FREQ response\n");
+      SiTRACE("Error sending TUNER_TUNE_FREQ command\n");
       return error_code;
     }
 
@@ -367,27 +367,16 @@ int Si2176_PowerUpWithPatch    (L1_Si2176_Context *api)
 int Si2176_LoadFirmware        (L1_Si2176_Context *api, unsigned char fw_table[], int nbLines)
 {
     int return_code;
-    int line;
     return_code = NO_Si2176_ERROR;
 
     SiTRACE ("Si2176_LoadFirmware starting...\n");
     SiTRACE ("Si2176_LoadFirmware nbLines %d\n", nbLines);
 
-    /* for each line in fw_table */
-    for (line = 0; line < nbLines; line++)
-    {
-        /* send Si2176_BYTES_PER_LINE fw bytes to Si2176 */
-        if ((return_code = Si2176_L1_API_Patch(api, Si2176_BYTES_PER_LINE, fw_table + Si2176_BYTES_PER_LINE*line)) != NO_Si2176_ERROR)
-        {
-          SiTRACE("Si2176_LoadFirmware error 0x%02x patching line %d: %s\n", return_code, line, Si2176_L1_API_ERROR_TEXT(return_code) );
-          if (line == 0) {
-          SiTRACE("The firmware is incompatible with the part!\n");
-          }
-          return ERROR_Si2176_LOADING_FIRMWARE;
-        }
-        if (line==3) SiTraceConfiguration("traces -output none");
+    /* download all lines using the L0 command engine */
+    if ((return_code = L0_LoadFirmware(api->i2c, fw_table, Si2176_BYTES_PER_LINE, nbLines)) != NO_Si2176_ERROR) {
+      SiTRACE("Si2176_LoadFirmware error 0x%02x: %s\n", return_code, Si2176_L1_API_ERROR_TEXT(return_code) );
+      return ERROR_Si2176_LOADING_FIRMWARE;
     }
-    SiTraceConfiguration("traces -output file");
     SiTRACE ("Si2176_LoadFirmware complete...\n");
     return NO_Si2176_ERROR;
 }
@@ -31,6 +31,7 @@ unsigned char Si2177_CurrentResponseStatus (L1_Si2177_Context *api, unsigned cha
 unsigned char Si2177_pollForResetState     (L1_Si2177_Context *api);
 unsigned char Si2177_pollForCTS            (L1_Si2177_Context *api);
 unsigned char Si2177_pollForResponse       (L1_Si2177_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer);
+unsigned char Si2177_sendCommand           (L1_Si2177_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
 unsigned char Si2177_L1_SendCommand2       (L1_Si2177_Context *api, unsigned int cmd_code);
 unsigned char Si2177_L1_SetProperty        (L1_Si2177_Context *api, unsigned int prop_code, int  data);
 unsigned char Si2177_L1_GetProperty        (L1_Si2177_Context *api, unsigned int prop_code, int *data);
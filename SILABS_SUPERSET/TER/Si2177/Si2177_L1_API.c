@@ -68,24 +68,16 @@ unsigned char    Si2177_L1_API_Init      (L1_Si2177_Context *api, int add) {
   Porting:    May not be required for the final application, can be removed if not used.
  ***********************************************************************************************************************/
 unsigned char    Si2177_L1_API_Patch     (L1_Si2177_Context *api, int iNbBytes, unsigned char *pucDataBuffer) {
-    int res;
-    unsigned char rspByteBuffer[1];
+    unsigned char res;
 
     SiTRACE("Si2177 Patch %d bytes\n",iNbBytes);
 
-    res = L0_WriteCommandBytes(api->i2c, iNbBytes, pucDataBuffer);
-    if (res!=iNbBytes) {
-      SiTRACE("Si2177_L1_API_Patch error writing bytes: %s\n", Si2177_L1_API_ERROR_TEXT(ERROR_Si2177_LOADING_FIRMWARE) );
-      return ERROR_Si2177_LOADING_FIRMWARE;
-    }
-
-    res = Si2177_pollForResponse(api, 1, rspByteBuffer);
+    res = L0_Patch(api->i2c, iNbBytes, pucDataBuffer);
     if (res != NO_Si2177_ERROR) {
-      SiTRACE("Si2177_L1_API_Patch error 0x%02x polling response: %s\n", res, Si2177_L1_API_ERROR_TEXT(res) );
-      return ERROR_Si2177_POLLING_RESPONSE;
+      SiTRACE("Si2177_L1_API_Patch error 0x%02x: %s\n", res, Si2177_L1_API_ERROR_TEXT(res) );
     }
 
-    return NO_Si2177_ERROR;
+    return res;
 }
 /***********************************************************************************************************************
   Si2177_L1_CheckStatus function
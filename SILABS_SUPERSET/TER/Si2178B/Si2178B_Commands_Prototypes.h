@@ -31,6 +31,7 @@ unsigned char Si2178B_CurrentResponseStatus (L1_Si2178B_Context *api, unsigned c
 unsigned char Si2178B_pollForResetState     (L1_Si2178B_Context *api);
 unsigned char Si2178B_pollForCTS            (L1_Si2178B_Context *api);
 unsigned char Si2178B_pollForResponse       (L1_Si2178B_Context *api, unsigned int nbBytes, unsigned char *pByteBuffer);
+unsigned char Si2178B_sendCommand           (L1_Si2178B_Context *api, unsigned int nbCmdBytes, unsigned char *cmdByteBuffer, unsigned int nbRspBytes, unsigned char *rspByteBuffer);
 unsigned char Si2178B_L1_SendCommand2       (L1_Si2178B_Context *api, unsigned int cmd_code);
 unsigned char Si2178B_L1_SetProperty        (L1_Si2178B_Context *api, unsigned int prop_code, int  data);
 unsigned char Si2178B_L1_GetProperty        (L1_Si2178B_Context *api, unsigned int prop_code, int *data);
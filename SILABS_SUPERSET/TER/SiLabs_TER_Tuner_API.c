@@ -101,6 +101,46 @@ limitations under the License.
 /* Change log: */
 /* Last changes:
 
+ As from 0.7.2:
+  In SiLabs_TER_Tuner_SW_Init: TER_tuners is no longer silently capped at FRONT_END_COUNT tuners.
+   When FRONTEND_REGISTRY is defined, TER_tuners is a pointer to a table re-allocated (doubled) when full, since the number
+    of front-ends is then only known at run time.
+   Otherwise, an error is traced when FRONT_END_COUNT is too small to store all TER tuners used for VCO blocking.
+
+ As from 0.7.1:
+  In SiLabs_TER_Tuner_SW_Init: not storing the same tuner context twice in TER_tuners when SW init is called again.
+   (With repeated SW init, TER_tuners filled up with copies of the first tuners, and the tuners initialized later were not stored.)
+
+ As from 0.7.0:
+  Testing the tuner code with SILABS_TER_TUNER_CODE in all wrapper functions.
+   When SINGLE_CHIP_TER_TUNER is defined, this is a compile-time constant and the other tuners are not tested at run time.
+  In SiLabs_TER_Tuner_SW_Init: selecting SINGLE_CHIP_TER_TUNER by default.
+  In SiLabs_TER_Tuner_Select_Tuner: refusing any tuner other than SINGLE_CHIP_TER_TUNER.
+  SILABS_TER_TUNER_CODE evaluates silabs_tuner, to avoid unused parameter warnings in single-chip builds.
+
+ As from 0.6.9:
+  In SiLabs_TER_Tuner_VCO_Blocking_PostTune: replacing the 1 to 4 tuners VCO blocking by a VCO planner supporting any number of tuners:
+   - the VCO code of each tuner is only read after its own tune, and kept in the tuner context (no status request to the other tuners),
+   - each tuner blocks the VCO codes of its nearest tuners in TER_tuners, as many as it has blocking slots (SiLabs_TER_Tuner_VCO_Slots),
+   - a slot is only written when the tuner or the VCO code it has to block changes.
+  Adding SiLabs_TER_Tuner_VCO_Slots and SiLabs_TER_Tuner_VCO_Neighbour.
+  In SiLabs_TER_Tuner_SW_Init: clearing the VCO planner values.
+
+ As from 0.6.8:
+  Adding SiLabs_TER_Tuner_ATV_Scan_Setup, SiLabs_TER_Tuner_ATV_Scan_Tune and SiLabs_TER_Tuner_ATV_Scan_Check (when ATV_PARALLEL_SCAN is defined):
+   non-blocking ATV scan steps for Si2157, Si2176, Si2177 and Si2178B, allowing to interleave the scans of several tuners.
+   The tuner-level ATV scans (SiLabs_ATV_Channel_Scan_M/PAL) are unchanged.
+
+ As from 0.6.7:
+  Adding SiLabs_TER_Tuner_Warm_Attach (when WARM_ATTACH is defined): in SiLabs_TER_Tuner_HW_Init, if warm_attach is set and
+   the tuner already runs the firmware started during the last full init (warm_rev), only the tuner configuration is applied.
+  In SiLabs_TER_Tuner_Get_Rev: returning the GET_REV error code (it always returned -1 before).
+
+ As from 0.6.6:
+  In SiLabs_TER_Tuner_Select_Tuner: counting all transactions of the selected tuner in the L0_STATS_TUNER i2c statistics category.
+  In SiLabs_TER_Tuner_VCO_Blocking_PostTune: limiting vco_dest, vco_fn and the VCO blocking function index to their size
+   when FRONT_END_COUNT is above 4 (tuners above the 4th share the VCO3 blocking property).
+
  As from 0.6.5:
   Adding SiLabs_TER_Tuner_DTVTune, to allow testing ISDB-T reception on cable networks
   Adding SiLabs_TER_Tuner_Set_Property for test purpose
@@ -331,7 +371,15 @@ limitations under the License.
 #include "SiLabs_TER_Tuner_API.h"
 /* Re-definition of SiTRACE for SILABS_TER_TUNER_Context */
 signed   int TER_Tuner_count = 0;
+#ifdef    FRONTEND_REGISTRY
+#include <stdlib.h>
+/* TER_tuners starts with TER_tuners_Table, and is re-allocated when more TER tuners are registered */
+static SILABS_TER_TUNER_Context  *TER_tuners_Table[FRONT_END_COUNT];
+static signed   int               TER_Tuner_capacity = FRONT_END_COUNT;
+SILABS_TER_TUNER_Context        **TER_tuners = TER_tuners_Table;
+#else  /* FRONTEND_REGISTRY */
 SILABS_TER_TUNER_Context *TER_tuners[FRONT_END_COUNT];
+#endif /* FRONTEND_REGISTRY */
 
 #ifdef    SiTRACES
   #undef  SiTRACE
@@ -341,6 +389,9 @@ SILABS_TER_TUNER_Context *TER_tuners[FRONT_END_COUNT];
 signed   int   SiLabs_TER_Tuner_SW_Init              (SILABS_TER_TUNER_Context *silabs_tuner, signed   int add) {
   signed   int i;
   signed   int ter_tuner_code;
+#ifdef    FRONTEND_REGISTRY
+  SILABS_TER_TUNER_Context **tuners;
+#endif /* FRONTEND_REGISTRY */
   #ifdef    SiTRACES
     char possible[1000];
     SiTRACE("SiLabs_TER_Tuner_SW_Init add 0x%02x\n", add);
@@ -507,13 +558,39 @@ signed   int   SiLabs_TER_Tuner_SW_Init              (SILABS_TER_TUNER_Context *
     Si2196_L1_API_Init               (silabs_tuner->Si2196_Tuner[i], add);
   }
 #endif /* TER_TUNER_Si2196 */
+#ifdef    SINGLE_CHIP_TER_TUNER
+  ter_tuner_code = SINGLE_CHIP_TER_TUNER;
+#endif /* SINGLE_CHIP_TER_TUNER */
   if (ter_tuner_code != 0) {
     SiLabs_TER_Tuner_Select_Tuner  (silabs_tuner, ter_tuner_code, 0);
-    if (TER_Tuner_count < FRONT_END_COUNT) {
+    for (i=0; i<TER_Tuner_count; i++) {
+      if (TER_tuners[i] == silabs_tuner) { break; }
+    }
+#ifdef    FRONTEND_REGISTRY
+    if ( (i == TER_Tuner_count) && (TER_Tuner_count == TER_Tuner_capacity) ) {
+      tuners = (SILABS_TER_TUNER_Context **)malloc(sizeof(SILABS_TER_TUNER_Context *)*TER_Tuner_capacity*2);
+      if (tuners != NULL) {
+        memcpy(tuners, TER_tuners, sizeof(SILABS_TER_TUNER_Context *)*TER_Tuner_count);
+        if (TER_tuners != TER_tuners_Table) { free(TER_tuners); }
+        TER_tuners         = tuners;
+        TER_Tuner_capacity = TER_Tuner_capacity*2;
+      }
+    }
+    if ( (i == TER_Tuner_count) && (TER_Tuner_count < TER_Tuner_capacity) ) {
+#else  /* FRONTEND_REGISTRY */
+    if ( (i == TER_Tuner_count) && (TER_Tuner_count < FRONT_END_COUNT) ) {
+#endif /* FRONTEND_REGISTRY */
       TER_tuners[TER_Tuner_count++] = silabs_tuner;
+    } else if (i == TER_Tuner_count) {
+      SiERROR("SiLabs_TER_Tuner_SW_Init: TER_tuners full, this tuner will not be used for VCO blocking!\n");
     }
     SiTRACE("SiLabs_TER_Tuner_SW_Init TER_Tuner_count %d\n", TER_Tuner_count);
     silabs_tuner->fef_freeze_pin = 1;
+    silabs_tuner->vco_known      = 0;
+    for (i=0; i<TER_TUNER_VCO_SLOTS; i++) {
+      silabs_tuner->vco_blocked_tuner[i] = -1;
+      silabs_tuner->vco_blocked      [i] =  0;
+    }
   } else {
   #ifdef    SiTRACES
     i = SiLabs_TER_Tuner_Possible_Tuners(silabs_tuner, possible);
@@ -524,6 +601,12 @@ signed   int   SiLabs_TER_Tuner_SW_Init              (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Select_Tuner         (SILABS_TER_TUNER_Context *silabs_tuner, signed   int ter_tuner_code, signed   int tuner_index) {
   SiTRACE_X("Select TER Tuner selecting Si%04x_Tuner[%d]\n", ter_tuner_code, tuner_index);
+#ifdef    SINGLE_CHIP_TER_TUNER
+  if (ter_tuner_code != SINGLE_CHIP_TER_TUNER) {
+    SiERROR("SiLabs_TER_Tuner_Select_Tuner: tuner not matching SINGLE_CHIP_TER_TUNER !\n");
+    return (silabs_tuner->ter_tuner_code<<8)+silabs_tuner->tuner_index;
+  }
+#endif /* SINGLE_CHIP_TER_TUNER */
 #ifdef    TER_TUNER_CUSTOMTER
   if (ter_tuner_code               == CUSTOMTER_CODE ) {
     silabs_tuner->ter_tuner_code = ter_tuner_code;
@@ -709,6 +792,7 @@ signed   int   SiLabs_TER_Tuner_Select_Tuner         (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2196 */
   SiTRACE("Select_Tuner     selected  Si%04x_Tuner[%d] (i2c address 0x%02x)\n", silabs_tuner->ter_tuner_code, silabs_tuner->tuner_index, silabs_tuner->i2c->address);
+  L0_StatsCategory(silabs_tuner->i2c, L0_STATS_TUNER);
   return (silabs_tuner->ter_tuner_code<<8)+silabs_tuner->tuner_index;
 }
 signed   int   SiLabs_TER_Tuner_Set_Address          (SILABS_TER_TUNER_Context *silabs_tuner, signed   int add) {
@@ -718,7 +802,7 @@ signed   int   SiLabs_TER_Tuner_Set_Address          (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Store_FW             (SILABS_TER_TUNER_Context *silabs_tuner, firmware_struct fw_table[], signed   int nbLines) {
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_Store_FW(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], fw_table, nbLines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_Store_FW(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], fw_table, nbLines); }
 #endif /* TER_TUNER_Si2141 */
   return -1;
 }
@@ -730,7 +814,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   SiTRACE_X("SiLabs_TER_Tuner_Broadcast_I2C tuner_count %d\n", tuner_count);
   SiTRACE_X("SiLabs_TER_Tuner_Broadcast_I2C silabs_tuners[0]->ter_tuner_code 0x%x\n", silabs_tuners[0]->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuners[0]->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2124) {
     L1_Si2124_Context *Si2124_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2124_tuners[i] = silabs_tuners[i]->Si2124_Tuner[silabs_tuners[i]->tuner_index];
@@ -739,7 +823,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuners[0]->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2141) {
     L1_Si2141_Context *Si2141_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2141_tuners[i] = silabs_tuners[i]->Si2141_Tuner[silabs_tuners[i]->tuner_index];
@@ -748,7 +832,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuners[0]->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2144) {
     L1_Si2144_Context *Si2144_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2144_tuners[i] = silabs_tuners[i]->Si2144_Tuner[silabs_tuners[i]->tuner_index];
@@ -757,7 +841,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuners[0]->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2148B) {
     L1_Si2148B_Context *Si2148B_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2148B_tuners[i] = silabs_tuners[i]->Si2148B_Tuner[silabs_tuners[i]->tuner_index];
@@ -766,7 +850,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuners[0]->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2151) {
     L1_Si2151_Context *Si2151_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2151_tuners[i] = silabs_tuners[i]->Si2151_Tuner[silabs_tuners[i]->tuner_index];
@@ -775,7 +859,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuners[0]->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2158B) {
     L1_Si2158B_Context *Si2158B_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2158B_tuners[i] = silabs_tuners[i]->Si2158B_Tuner[silabs_tuners[i]->tuner_index];
@@ -784,7 +868,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuners[0]->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2178B) {
     L1_Si2178B_Context *Si2178B_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2178B_tuners[i] = silabs_tuners[i]->Si2178B_Tuner[silabs_tuners[i]->tuner_index];
@@ -793,7 +877,7 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuners[0]->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuners[0]) == 0x2191B) {
     L1_Si2191B_Context *Si2191B_tuners[tuner_count];
     for (i = 0; i < tuner_count; i++) {
       Si2191B_tuners[i] = silabs_tuners[i]->Si2191B_Tuner[silabs_tuners[i]->tuner_index];
@@ -805,224 +889,373 @@ signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *
   return_code = i = 0;
   return return_code;
 }
+#ifdef    WARM_ATTACH
+signed   int   SiLabs_TER_Tuner_Warm_Attach          (SILABS_TER_TUNER_Context *silabs_tuner) {
+  /* Warm-attach: if the tuner already runs the firmware started during the last full init (warm_rev, from GET_REV),   */
+  /*  only the configuration is applied (no reset nor firmware download). Properties differing from the defaults are sent again. */
+  signed   int return_code;
+  silabs_tuner->warm_attached = 0;
+  if (silabs_tuner->warm_rev.major == 0) { return -1; }
+  if (SiLabs_TER_Tuner_Get_Rev(silabs_tuner) != 0) {
+    SiTRACE("SiLabs_TER_Tuner_Warm_Attach: GET_REV failed, the tuner is not running\n");
+    return -1;
+  }
+  if ( (silabs_tuner->get_rev.major   != silabs_tuner->warm_rev.major  )
+     | (silabs_tuner->get_rev.minor   != silabs_tuner->warm_rev.minor  )
+     | (silabs_tuner->get_rev.build   != silabs_tuner->warm_rev.build  )
+     | (silabs_tuner->get_rev.chiprev != silabs_tuner->warm_rev.chiprev) ) {
+    SiTRACE("SiLabs_TER_Tuner_Warm_Attach: running 'FW_%c_%cb%d', expected 'FW_%c_%cb%d'\n", silabs_tuner->get_rev.major, silabs_tuner->get_rev.minor, silabs_tuner->get_rev.build, silabs_tuner->warm_rev.major, silabs_tuner->warm_rev.minor, silabs_tuner->warm_rev.build);
+    return -1;
+  }
+  return_code = -1;
+#ifdef    TER_TUNER_Si2124
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
+    return_code = Si2124_Configure(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2124 */
+#ifdef    TER_TUNER_Si2141
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
+    return_code = Si2141_Configure(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2141 */
+#ifdef    TER_TUNER_Si2144
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
+    return_code = Si2144_Configure(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2144 */
+#ifdef    TER_TUNER_Si2146
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
+    return_code = Si2146_Configure(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2146 */
+#ifdef    TER_TUNER_Si2147
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
+    return_code = Si2147_Configure(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2147 */
+#ifdef    TER_TUNER_Si2148
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
+    return_code = Si2148_Configure(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2148 */
+#ifdef    TER_TUNER_Si2148B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
+    return_code = Si2148B_Configure(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2148B */
+#ifdef    TER_TUNER_Si2151
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
+    return_code = Si2151_Configure(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2151 */
+#ifdef    TER_TUNER_Si2156
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
+    return_code = Si2156_Configure(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2156 */
+#ifdef    TER_TUNER_Si2157
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
+    return_code = Si2157_Configure(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2157 */
+#ifdef    TER_TUNER_Si2158
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
+    return_code = Si2158_Configure(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2158 */
+#ifdef    TER_TUNER_Si2158B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
+    return_code = Si2158B_Configure(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2158B */
+#ifdef    TER_TUNER_Si2173
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
+    return_code = Si2173_Configure(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2173 */
+#ifdef    TER_TUNER_Si2176
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
+    return_code = Si2176_Configure(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2176 */
+#ifdef    TER_TUNER_Si2177
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
+    return_code = Si2177_Configure(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2177 */
+#ifdef    TER_TUNER_Si2178
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
+    return_code = Si2178_Configure(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2178 */
+#ifdef    TER_TUNER_Si2178B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
+    return_code = Si2178B_Configure(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2178B */
+#ifdef    TER_TUNER_Si2190
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
+    return_code = Si2190_Configure(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2190 */
+#ifdef    TER_TUNER_Si2190B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
+    return_code = Si2190B_Configure(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2190B */
+#ifdef    TER_TUNER_Si2191
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
+    return_code = Si2191_Configure(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2191 */
+#ifdef    TER_TUNER_Si2191B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
+    return_code = Si2191B_Configure(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2191B */
+#ifdef    TER_TUNER_Si2196
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
+    return_code = Si2196_Configure(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]);
+  }
+#endif /* TER_TUNER_Si2196 */
+  if (return_code == 0) {
+    silabs_tuner->warm_attached = 1;
+    SiTRACE("SiLabs_TER_Tuner_Warm_Attach: attached to the tuner running 'FW_%c_%cb%d'\n", silabs_tuner->get_rev.major, silabs_tuner->get_rev.minor, silabs_tuner->get_rev.build);
+  }
+  return return_code;
+}
+#endif /* WARM_ATTACH */
 signed   int   SiLabs_TER_Tuner_HW_Init              (SILABS_TER_TUNER_Context *silabs_tuner) {
   signed   int return_code;
   return_code = -1;
+#ifdef    WARM_ATTACH
+  if (silabs_tuner->warm_attach) {
+    if (SiLabs_TER_Tuner_Warm_Attach(silabs_tuner) == 0) { return 0; }
+    SiTRACE("SiLabs_TER_Tuner_HW_Init: warm-attach not possible, doing a full init\n");
+  }
+#endif /* WARM_ATTACH */
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for CUSTOMTER at i2c 0x%02x\n", silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = L1_RF_CUSTOMTER_InitAfterReset(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2124 at i2c 0x%02x\n", silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2124_Init(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2141 at i2c 0x%02x\n", silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2141_Init(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2144 at i2c 0x%02x\n", silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2144_Init(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2146 at i2c 0x%02x\n", silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2146_Init(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2147 at i2c 0x%02x\n", silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2147_Init(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2148 at i2c 0x%02x\n", silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2148_Init(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2148B at i2c 0x%02x\n", silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2148B_Init(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2151 at i2c 0x%02x\n", silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2151_Init(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2156 at i2c 0x%02x\n", silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2156_Init(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2157 at i2c 0x%02x\n", silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2157_Init(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2158 at i2c 0x%02x\n", silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2158_Init(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2158B at i2c 0x%02x\n", silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2158B_Init(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2173 at i2c 0x%02x\n", silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2173_Init(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2176 at i2c 0x%02x\n", silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2176_Init(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2177 at i2c 0x%02x\n", silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2177_Init(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2178 at i2c 0x%02x\n", silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2178_Init(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2178B at i2c 0x%02x\n", silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2178B_Init(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2190 at i2c 0x%02x\n", silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2190_Init(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2190B at i2c 0x%02x\n", silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2190B_Init(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2191 at i2c 0x%02x\n", silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2191_Init(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2191B at i2c 0x%02x\n", silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2191B_Init(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     SiTRACE("SiLabs_TER_Tuner_HW_Init for Si2196 at i2c 0x%02x\n", silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c->address);
     return_code = Si2196_Init(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_Si2196 */
+#ifdef    WARM_ATTACH
+  /* Storing the revision of the running firmware, for the next warm-attach */
+  if ( (return_code == 0) && (silabs_tuner->warm_attach) ) {
+    SiLabs_TER_Tuner_Get_Rev(silabs_tuner);
+    silabs_tuner->warm_rev = silabs_tuner->get_rev;
+  }
+#endif /* WARM_ATTACH */
   return return_code;
 }
 signed   int   SiLabs_TER_Tuner_Tuner_kickstart      (SILABS_TER_TUNER_Context *silabs_tuner) {
   SiTRACE_X("API CALL INIT : SiLabs_TER_Tuner_Tuner_kickstart (silabs_tuner)\n" );
   SiTRACE_X("silabs_tuner->ter_tuner_code   = 0x%x\n",  silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code ==   0x2178 ) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) ==   0x2178 ) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code ==   0x2178B ) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) ==   0x2178B ) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     SiLabs_TER_Tuner_PowerUp (silabs_tuner, silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode,   silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.en_xout);
   }
 #endif /* TER_TUNER_Si2191B */
@@ -1030,145 +1263,145 @@ signed   int   SiLabs_TER_Tuner_Tuner_kickstart      (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_HW_Connect           (SILABS_TER_TUNER_Context *silabs_tuner, CONNECTION_TYPE connection_mode) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L0_Connect(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L0_Connect(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return L0_Connect(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return L0_Connect(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return L0_Connect(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return L0_Connect(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return L0_Connect(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return L0_Connect(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return L0_Connect(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return L0_Connect(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return L0_Connect(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return L0_Connect(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return L0_Connect(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return L0_Connect(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return L0_Connect(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return L0_Connect(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return L0_Connect(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return L0_Connect(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return L0_Connect(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return L0_Connect(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return L0_Connect(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return L0_Connect(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return L0_Connect(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return L0_Connect(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return L0_Connect(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return L0_Connect(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return L0_Connect(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return L0_Connect(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return L0_Connect(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return L0_Connect(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return L0_Connect(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return L0_Connect(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return L0_Connect(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return L0_Connect(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return L0_Connect(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return L0_Connect(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return L0_Connect(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return L0_Connect(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return L0_Connect(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return L0_Connect(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return L0_Connect(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return L0_Connect(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return L0_Connect(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return L0_Connect(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return L0_Connect(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return L0_Connect(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c, connection_mode); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_bytes_trace          (SILABS_TER_TUNER_Context *silabs_tuner, unsigned char track_mode) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c->trackWrite = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->i2c->trackRead = track_mode; }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -1176,7 +1409,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   signed   int return_code;
   return_code = -1;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->part              = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1186,7 +1419,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->part              = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1196,7 +1429,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->part              = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1206,7 +1439,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->part              = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1216,7 +1449,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->part              = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1226,7 +1459,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->part              = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1236,7 +1469,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->part              = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1246,7 +1479,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->part              = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1256,7 +1489,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->part              = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1266,7 +1499,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->part              = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1276,7 +1509,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->part              = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1286,7 +1519,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->part              = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1296,7 +1529,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->part              = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1306,7 +1539,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->part              = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1316,7 +1549,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->part              = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1326,7 +1559,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->part              = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1336,7 +1569,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->part              = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1346,7 +1579,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->part              = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1356,7 +1589,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->part              = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1366,7 +1599,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->part              = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1376,7 +1609,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->part              = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1386,7 +1619,7 @@ signed   int   SiLabs_TER_Tuner_Part_Info            (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->part              = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->part_info.part;
     silabs_tuner->romid             = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->part_info.romid;
     silabs_tuner->part_info.chiprev = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->part_info.chiprev;
@@ -1401,8 +1634,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   signed   int return_code;
   return_code = -1;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
-    Si2124_L1_GET_REV(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
+    return_code = Si2124_L1_GET_REV(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1410,8 +1643,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
-    Si2141_L1_GET_REV(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
+    return_code = Si2141_L1_GET_REV(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1419,8 +1652,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
-    Si2144_L1_GET_REV(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
+    return_code = Si2144_L1_GET_REV(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1428,8 +1661,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
-    Si2146_L1_GET_REV(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
+    return_code = Si2146_L1_GET_REV(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1437,8 +1670,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
-    Si2147_L1_GET_REV(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
+    return_code = Si2147_L1_GET_REV(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1446,8 +1679,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
-    Si2148_L1_GET_REV(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
+    return_code = Si2148_L1_GET_REV(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1455,8 +1688,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
-    Si2148B_L1_GET_REV(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
+    return_code = Si2148B_L1_GET_REV(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1464,8 +1697,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
-    Si2151_L1_GET_REV(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
+    return_code = Si2151_L1_GET_REV(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1473,8 +1706,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
-    Si2156_L1_GET_REV(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
+    return_code = Si2156_L1_GET_REV(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1482,8 +1715,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
-    Si2157_L1_GET_REV(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
+    return_code = Si2157_L1_GET_REV(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1491,8 +1724,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
-    Si2158_L1_GET_REV(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
+    return_code = Si2158_L1_GET_REV(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1500,8 +1733,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
-    Si2158B_L1_GET_REV(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
+    return_code = Si2158B_L1_GET_REV(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1509,8 +1742,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
-    Si2173_L1_GET_REV(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
+    return_code = Si2173_L1_GET_REV(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1518,8 +1751,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
-    Si2176_L1_GET_REV(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
+    return_code = Si2176_L1_GET_REV(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1527,8 +1760,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
-    Si2177_L1_GET_REV(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
+    return_code = Si2177_L1_GET_REV(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1536,8 +1769,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
-    Si2178_L1_GET_REV(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
+    return_code = Si2178_L1_GET_REV(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1545,8 +1778,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
-    Si2178B_L1_GET_REV(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
+    return_code = Si2178B_L1_GET_REV(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1554,8 +1787,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
-    Si2190_L1_GET_REV(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
+    return_code = Si2190_L1_GET_REV(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1563,8 +1796,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
-    Si2190B_L1_GET_REV(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
+    return_code = Si2190B_L1_GET_REV(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1572,8 +1805,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
-    Si2191_L1_GET_REV(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
+    return_code = Si2191_L1_GET_REV(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1581,8 +1814,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
-    Si2191B_L1_GET_REV(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
+    return_code = Si2191B_L1_GET_REV(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1590,8 +1823,8 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
-    Si2196_L1_GET_REV(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]);
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
+    return_code = Si2196_L1_GET_REV(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->get_rev.chiprev = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.chiprev;
     silabs_tuner->get_rev.major   = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpmajor;
     silabs_tuner->get_rev.minor   = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.cmpminor;
@@ -1602,73 +1835,73 @@ signed   int   SiLabs_TER_Tuner_Get_Rev              (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Wakeup               (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Wakeup(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Wakeup(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_pollForCTS(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_pollForCTS(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_pollForCTS(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_pollForCTS(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_pollForCTS(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_pollForCTS(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_pollForCTS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_pollForCTS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_pollForCTS(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_pollForCTS(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_pollForCTS(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_pollForCTS(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_pollForCTS(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_pollForCTS(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_pollForCTS(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_pollForCTS(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_pollForCTS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_pollForCTS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_pollForCTS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_pollForCTS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_pollForCTS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_pollForCTS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_pollForCTS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_pollForCTS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_pollForCTS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_pollForCTS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_pollForCTS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_pollForCTS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_pollForCTS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_pollForCTS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_pollForCTS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_pollForCTS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_pollForCTS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_pollForCTS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_pollForCTS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_pollForCTS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_pollForCTS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_pollForCTS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_pollForCTS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_pollForCTS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_pollForCTS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_pollForCTS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_pollForCTS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_pollForCTS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -1676,7 +1909,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
   clock_mode = clock_mode;
   en_xout    = en_xout;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     return Si2124_L1_POWER_UP (silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index],
                                 Si2124_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
@@ -1690,7 +1923,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2124_POWER_UP_CMD_RESERVED8_RESERVED);}
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     return Si2141_L1_POWER_UP (silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index],
                                 Si2141_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
@@ -1704,7 +1937,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2141_POWER_UP_CMD_RESERVED8_RESERVED);}
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     return Si2144_L1_POWER_UP (silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index],
                                 Si2144_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
@@ -1718,7 +1951,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2144_POWER_UP_CMD_RESERVED8_RESERVED);}
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     return Si2147_L1_POWER_UP (silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index],
                                 Si2147_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
@@ -1739,7 +1972,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2147_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     return Si2148B_L1_POWER_UP (silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index],
                                 Si2148B_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
@@ -1759,7 +1992,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2148B_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     return Si2151_L1_POWER_UP (silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1772,7 +2005,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2151_POWER_UP_CMD_RESERVED8_RESERVED);}
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return Si2157_L1_POWER_UP (silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1792,7 +2025,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2157_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return Si2158B_L1_POWER_UP (silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1811,7 +2044,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2158B_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return Si2177_L1_POWER_UP (silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1831,7 +2064,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2177_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     return Si2178_L1_POWER_UP (silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1850,7 +2083,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2178_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return Si2178B_L1_POWER_UP (silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1869,7 +2102,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2178B_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     return Si2190_L1_POWER_UP (silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1888,7 +2121,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2190_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return Si2190B_L1_POWER_UP (silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1907,7 +2140,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2190B_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     return Si2191_L1_POWER_UP (silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1926,7 +2159,7 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
                                 Si2191_POWER_UP_CMD_WAKE_UP_WAKE_UP);}
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return Si2191B_L1_POWER_UP (silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_POWER_UP_CMD_SUBCODE_CODE,
                                 clock_mode,
                                 en_xout,
@@ -1948,153 +2181,153 @@ signed   int   SiLabs_TER_Tuner_PowerUp              (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Standby              (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Standby(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Standby(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_Standby(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_Standby(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_Standby(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_Standby(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_Standby(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_Standby(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_L1_STANDBY(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_L1_STANDBY(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_Standby(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_Standby(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_Standby(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_Standby(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_Standby(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_Standby(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_Standby(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_Standby(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_L1_STANDBY(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_STANDBY_CMD_TYPE_NORMAL); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_L1_STANDBY(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_STANDBY_CMD_TYPE_NORMAL); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_Standby(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_Standby(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_Standby(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_Standby(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_Standby(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_Standby(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { SiERROR("SiLabs_TER_Tuner_Standby not supported by Si2173!\n"); return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { SiERROR("SiLabs_TER_Tuner_Standby not supported by Si2173!\n"); return 0; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_Standby(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_Standby(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_Standby(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_Standby(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_Standby(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_Standby(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_Standby(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_Standby(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_Standby(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_Standby(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_Standby(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_Standby(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_Standby(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_Standby(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_Standby(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_Standby(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_Standby(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_Standby(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_StandbyWithClk       (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_CUSTOMTER
  /* <porting> Call SiLabs_TER_Tuner_Standby here only if the TER tuner will keep its clock ON while set to Standby mode. Otherwise, return -1 */
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return -1; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return -1; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return SiLabs_TER_Tuner_Standby(silabs_tuner); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *silabs_tuner, signed   int xtal, signed   int xout) {
   SiTRACE("SiLabs_TER_Tuner_ClockConfig 0x%x  xtal %d xout %d\n", silabs_tuner->ter_tuner_code, xtal, xout);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     if (xtal == 1) { silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2124_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2124_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2124_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2104,7 +2337,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     if (xtal == 1) { silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2141_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2141_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2141_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2114,7 +2347,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     if (xtal == 1) { silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2144_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2144_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2144_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2124,7 +2357,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     if (xtal == 1) { silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2146_POWER_UP_CMD_CLOCK_MODE_XTAL;      }
     else           { silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2146_POWER_UP_CMD_CLOCK_MODE_EXTCLK;    }
     if (xout == 1) { silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.xout_mode    = Si2146_CONFIG_PINS_CMD_XOUT_MODE_XOUT;    }
@@ -2132,7 +2365,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     if (xtal == 1) { silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2147_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2147_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2147_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2142,7 +2375,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     if (xtal == 1) { silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2148_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2148_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2148_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2152,7 +2385,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     if (xtal == 1) { silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2148B_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2148B_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2148B_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2162,7 +2395,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     if (xtal == 1) { silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2151_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2151_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2151_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2172,7 +2405,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     if (xtal == 1) { silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2156_POWER_UP_CMD_CLOCK_MODE_XTAL;      }
     else           { silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2156_POWER_UP_CMD_CLOCK_MODE_EXTCLK;    }
     if (xout == 1) { silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.xout_mode    = Si2156_CONFIG_PINS_CMD_XOUT_MODE_XOUT;    }
@@ -2180,7 +2413,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     if (xtal == 1) { silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2157_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2157_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2157_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2190,7 +2423,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     if (xtal == 1) { silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2158_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2158_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2158_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2200,7 +2433,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     if (xtal == 1) { silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2158B_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2158B_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2158B_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2210,7 +2443,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     if (xtal == 1) { silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2173_POWER_UP_CMD_CLOCK_MODE_XTAL;      }
     else           { silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2173_POWER_UP_CMD_CLOCK_MODE_EXTCLK;    }
     if (xout == 1) { silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.xout_mode    = Si2173_CONFIG_PINS_CMD_XOUT_MODE_XOUT;    }
@@ -2218,7 +2451,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     if (xtal == 1) { silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2176_POWER_UP_CMD_CLOCK_MODE_XTAL;      }
     else           { silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2176_POWER_UP_CMD_CLOCK_MODE_EXTCLK;    }
     if (xout == 1) { silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.xout_mode    = Si2176_CONFIG_PINS_CMD_XOUT_MODE_XOUT;    }
@@ -2226,7 +2459,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     if (xtal == 1) { silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2177_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2177_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2177_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2236,7 +2469,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     if (xtal == 1) { silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2178_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2178_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2178_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2246,7 +2479,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     if (xtal == 1) { silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2178B_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2178B_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2178B_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2256,7 +2489,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     if (xtal == 1) { silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2190_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2190_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2190_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2266,7 +2499,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     if (xtal == 1) { silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2190B_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2190B_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2190B_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2276,7 +2509,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     if (xtal == 1) { silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2191_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2191_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2191_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2286,7 +2519,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     if (xtal == 1) { silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2191B_POWER_UP_CMD_CLOCK_MODE_XTAL;
                      silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_clocks.clock_mode = Si2191B_CONFIG_CLOCKS_CMD_CLOCK_MODE_XTAL;   }
     else           { silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2191B_POWER_UP_CMD_CLOCK_MODE_EXTCLK;
@@ -2296,7 +2529,7 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
     return silabs_tuner->ter_tuner_code; }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     if (xtal == 1) { silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2196_POWER_UP_CMD_CLOCK_MODE_XTAL;      }
     else           { silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->power_up.clock_mode      = Si2196_POWER_UP_CMD_CLOCK_MODE_EXTCLK;    }
     if (xout == 1) { silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.xout_mode    = Si2196_CONFIG_PINS_CMD_XOUT_MODE_XOUT;    }
@@ -2308,218 +2541,218 @@ signed   int   SiLabs_TER_Tuner_ClockConfig          (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_ClockOff             (SILABS_TER_TUNER_Context *silabs_tuner) {
   SiTRACE("SiLabs_TER_Tuner_ClockOff\n");
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_ClockOff(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_ClockOff(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_XoutOff(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_XoutOff(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_XoutOff(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_XoutOff(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_XoutOff(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_XoutOff(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_ClockOff(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_ClockOff(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_XoutOff(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_XoutOff(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_XoutOff(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_XoutOff(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_XoutOff(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_XoutOff(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_XoutOff(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_XoutOff(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_ClockOff(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_ClockOff(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_XoutOff(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_XoutOff(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_XoutOff(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_XoutOff(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_XoutOff(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_XoutOff(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_ClockOff(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_ClockOff(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_ClockOff(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_ClockOff(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_XoutOff(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_XoutOff(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_XoutOff(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_XoutOff(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_XoutOff(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_XoutOff(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_XoutOff(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_XoutOff(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_XoutOff(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_XoutOff(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_XoutOff(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_XoutOff(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_XoutOff(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_XoutOff(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_XoutOff(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_XoutOff(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_ClockOn              (SILABS_TER_TUNER_Context *silabs_tuner) {
   SiTRACE("SiLabs_TER_Tuner_ClockOn\n");
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_ClockOn(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_ClockOn(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_XoutOn(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_XoutOn(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_XoutOn(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_XoutOn(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_XoutOn(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_XoutOn(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_ClockOn(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_ClockOn(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_XoutOn(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_XoutOn(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_XoutOn(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_XoutOn(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_XoutOn(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_XoutOn(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_XoutOn(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_XoutOn(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_ClockOn(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_ClockOn(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_XoutOn(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_XoutOn(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_XoutOn(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_XoutOn(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_XoutOn(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_XoutOn(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_ClockOn(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_ClockOn(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_ClockOn(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_ClockOn(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_XoutOn(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_XoutOn(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_XoutOn(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_XoutOn(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_XoutOn(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_XoutOn(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_XoutOn(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_XoutOn(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_XoutOn(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_XoutOn(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_XoutOn(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_XoutOn(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_XoutOn(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_XoutOn(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_XoutOn(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_XoutOn(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_PowerDown            (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Standby(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Standby(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_Powerdown(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_Powerdown(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_Powerdown(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_Powerdown(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_Powerdown(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_Powerdown(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_L1_POWER_DOWN(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_L1_POWER_DOWN(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_Powerdown(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_Powerdown(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_Powerdown(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_Powerdown(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_Powerdown(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_Powerdown(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_Powerdown(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_Powerdown(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_L1_POWER_DOWN(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_L1_POWER_DOWN(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_Powerdown(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_Powerdown(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_Powerdown(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_Powerdown(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_Powerdown(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_Powerdown(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { SiERROR("SiLabs_TER_Tuner_PowerDown not sopported by Si2173!\n");return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { SiERROR("SiLabs_TER_Tuner_PowerDown not sopported by Si2173!\n");return 0; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_Powerdown(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_Powerdown(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_Powerdown(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_Powerdown(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_Powerdown(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_Powerdown(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_Powerdown(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_Powerdown(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_Powerdown(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_Powerdown(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_Powerdown(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_Powerdown(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_Powerdown(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_Powerdown(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_Powerdown(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_Powerdown(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_Powerdown(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_Powerdown(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -2601,70 +2834,70 @@ signed   int   SiLabs_TER_Tuner_Possible_Tuners      (SILABS_TER_TUNER_Context *
 }
 const    char *SiLabs_TER_Tuner_ERROR_TEXT           (SILABS_TER_TUNER_Context *silabs_tuner, unsigned char _error_code) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_L1_API_ERROR_TEXT(_error_code); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_L1_API_ERROR_TEXT(_error_code); }
 #endif /* TER_TUNER_Si2196 */
   return "Unknown tuner code 0x%04x";
 }
@@ -2676,67 +2909,67 @@ signed   int   SiLabs_TER_Tuner_ATVTune              (SILABS_TER_TUNER_Context *
   invert_signal = invert_signal ; /* To avoid compiler warnings when not used */
   SiTRACE("SiLabs_TER_Tuner_ATVTune %ld Hz, video_sys %d, trans %d (ter_tuner_code %d/0x%x)\n", freq, video_sys, trans, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return -1; /* No ATV support in Si2141    */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return -1; /* No ATV support in Si2141    */ }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return -1; /* No ATV support with Si2144  */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return -1; /* No ATV support with Si2144  */ }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return -1; /* No ATV support with Si2146  */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return -1; /* No ATV support with Si2146  */ }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return -1; /* No ATV support with Si2147  */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return -1; /* No ATV support with Si2147  */ }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return -1; /* No ATV support with Si2148  */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return -1; /* No ATV support with Si2148  */ }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return -1; /* No ATV support with Si2148B */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return -1; /* No ATV support with Si2148B */ }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_Tune(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_Tune(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_Tune(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_Tune(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_Tune(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_Tune(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_Tune(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_Tune(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_Tune(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_Tune(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_Tune(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_Tune(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_Tune(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_Tune(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_Tune(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_Tune(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_Tune(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_Tune(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_Tune(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_Tune(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_Tune(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_Tune(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_Tune(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq, 1, 500); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_Tune(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq, 1, 500); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_Tune(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq, 1); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_Tune(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq, 1); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_Tune(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_Tune(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_ATVTune(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], freq, video_sys, trans, color, invert_signal); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_ATVTune(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], freq, video_sys, trans, color, invert_signal); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -2746,150 +2979,150 @@ signed   int   SiLabs_TER_Tuner_DTVTune              (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_DTVTune %ld Hz, bw %d, modulation %d (ter_tuner_code %d/0x%x)\n", freq, bw, modulation, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     return_code = Si2124_DTVTune(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2124_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     return_code = Si2141_DTVTune(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2141_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     return_code = Si2144_DTVTune(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2144_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2146_DTVTune(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2146_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(139);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     return_code = Si2147_DTVTune(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2147_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2148_DTVTune(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2148_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     return_code = Si2148B_DTVTune(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2148B_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     return_code = Si2151_DTVTune(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2151_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2156_DTVTune(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2156_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(169);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return_code = Si2157_DTVTune(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2157_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2158_DTVTune(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2158_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return_code = Si2158B_DTVTune(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2158B_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2173_DTVTune(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2173_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(169);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2176_DTVTune(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2176_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(169);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return_code = Si2177_DTVTune(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2177_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2178_DTVTune(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2178_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return_code = Si2178B_DTVTune(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2178B_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2190_DTVTune(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2190_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2190B_DTVTune(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2190B_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2191_DTVTune(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2191_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return_code = Si2191B_DTVTune(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2191B_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(85);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     return_code = Si2196_DTVTune(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], freq, bw, modulation, Si2196_DTV_MODE_PROP_INVERT_SPECTRUM_NORMAL);
     system_wait(149);
   }
 #endif /* TER_TUNER_Si2196 */
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     if ((bw == BW_1P7MHZ) | (bw == BW_6P1MHZ)) {bw = 6;}
     L1_RF_CUSTOMTER_Saw(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index], bw);
     return_code = L1_RF_CUSTOMTER_Tune(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index], freq);
@@ -2909,139 +3142,139 @@ signed   int   SiLabs_TER_Tuner_DTV_Bandwidth        (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_DTV_Bandwidth bw %d (ter_tuner_code %d/0x%x)\n", bw, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2124_L1_SetProperty2(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2141_L1_SetProperty2(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2144_L1_SetProperty2(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2151_L1_SetProperty2(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_mode.bw = bw;
     return Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_MODE_PROP);
   }
 #endif /* TER_TUNER_Si2196 */
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) {
   }
 #endif /* TER_TUNER_CUSTOMTER */
   return return_code;
@@ -3051,70 +3284,70 @@ signed   int   SiLabs_TER_Tuner_Fine_Tune            (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_Fine_Tune offset %d Hz (ter_tuner_code %d/0x%x)\n", offset_500hz, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return_code = Si2124_L1_FINE_TUNE(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return_code = Si2124_L1_FINE_TUNE(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return_code = Si2141_L1_FINE_TUNE(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return_code = Si2141_L1_FINE_TUNE(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return_code = Si2144_L1_FINE_TUNE(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return_code = Si2144_L1_FINE_TUNE(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return_code = Si2146_L1_FINE_TUNE(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return_code = Si2146_L1_FINE_TUNE(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return_code = Si2147_L1_FINE_TUNE(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return_code = Si2147_L1_FINE_TUNE(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return_code = Si2148_L1_FINE_TUNE(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return_code = Si2148_L1_FINE_TUNE(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return_code = Si2148B_L1_FINE_TUNE(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return_code = Si2148B_L1_FINE_TUNE(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return_code = Si2151_L1_FINE_TUNE(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return_code = Si2151_L1_FINE_TUNE(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return_code = Si2156_L1_FINE_TUNE(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return_code = Si2156_L1_FINE_TUNE(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return_code = Si2157_L1_FINE_TUNE(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return_code = Si2157_L1_FINE_TUNE(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return_code = Si2158_L1_FINE_TUNE(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return_code = Si2158_L1_FINE_TUNE(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return_code = Si2158B_L1_FINE_TUNE(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return_code = Si2158B_L1_FINE_TUNE(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return_code = Si2173_L1_FINE_TUNE(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return_code = Si2173_L1_FINE_TUNE(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return_code = Si2176_L1_FINE_TUNE(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return_code = Si2176_L1_FINE_TUNE(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return_code = Si2177_L1_FINE_TUNE(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return_code = Si2177_L1_FINE_TUNE(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return_code = Si2178_L1_FINE_TUNE(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return_code = Si2178_L1_FINE_TUNE(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return_code = Si2178B_L1_FINE_TUNE(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return_code = Si2178B_L1_FINE_TUNE(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return_code = Si2190_L1_FINE_TUNE(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return_code = Si2190_L1_FINE_TUNE(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return_code = Si2190B_L1_FINE_TUNE(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return_code = Si2190B_L1_FINE_TUNE(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return_code = Si2191_L1_FINE_TUNE(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return_code = Si2191_L1_FINE_TUNE(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return_code = Si2191B_L1_FINE_TUNE(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return_code = Si2191B_L1_FINE_TUNE(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], persistence, apply_to_lif, offset_500hz); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return_code = Si2196_L1_FINE_TUNE(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return_code = Si2196_L1_FINE_TUNE(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], persistence, offset_500hz); }
 #endif /* TER_TUNER_Si2196 */
   return return_code;
 }
@@ -3123,22 +3356,22 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_Block_VCO_Code %d (ter_tuner_code %d/0x%x)\n", vco_code, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_TUNER_BLOCKED_VCO_PROP);
@@ -3146,7 +3379,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_TUNER_BLOCKED_VCO_PROP);
@@ -3154,7 +3387,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_TUNER_BLOCKED_VCO_PROP);
@@ -3162,7 +3395,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_TUNER_BLOCKED_VCO_PROP);
@@ -3170,12 +3403,12 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_BLOCKED_VCO_PROP);
@@ -3183,7 +3416,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_BLOCKED_VCO_PROP);
@@ -3191,7 +3424,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_BLOCKED_VCO_PROP);
@@ -3199,7 +3432,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_BLOCKED_VCO_PROP);
@@ -3207,7 +3440,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_BLOCKED_VCO_PROP);
@@ -3215,7 +3448,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_BLOCKED_VCO_PROP);
@@ -3223,7 +3456,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_BLOCKED_VCO_PROP);
@@ -3231,7 +3464,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_BLOCKED_VCO_PROP);
@@ -3239,7 +3472,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_BLOCKED_VCO_PROP);
@@ -3247,7 +3480,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_BLOCKED_VCO_PROP);
@@ -3255,7 +3488,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_BLOCKED_VCO_PROP);
@@ -3263,7 +3496,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_BLOCKED_VCO_PROP);
@@ -3271,7 +3504,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_BLOCKED_VCO_PROP);
@@ -3279,7 +3512,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco.vco_code = vco_code;
     if (silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_TUNER_BLOCKED_VCO_PROP);
@@ -3293,27 +3526,27 @@ signed   int   SiLabs_TER_Tuner_Block_VCO2_Code      (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_Block_VCO2_Code %d (ter_tuner_code %d/0x%x)\n", vco_code, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code= vco_code;
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code = vco_code;
     if (silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_BLOCKED_VCO2_PROP);
@@ -3321,7 +3554,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO2_Code      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco2.vco_code = vco_code;
     if (silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_BLOCKED_VCO2_PROP);
@@ -3335,27 +3568,27 @@ signed   int   SiLabs_TER_Tuner_Block_VCO3_Code      (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_Block_VCO3_Code %d (ter_tuner_code %d/0x%x)\n", vco_code, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code = vco_code;
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code= vco_code;
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code = vco_code;
     if (silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_BLOCKED_VCO3_PROP);
@@ -3363,7 +3596,7 @@ signed   int   SiLabs_TER_Tuner_Block_VCO3_Code      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_blocked_vco3.vco_code = vco_code;
     if (silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->get_rev.pn != 0) {
       return_code = Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_BLOCKED_VCO3_PROP);
@@ -3372,71 +3605,92 @@ signed   int   SiLabs_TER_Tuner_Block_VCO3_Code      (SILABS_TER_TUNER_Context *
 #endif /* TER_TUNER_Si2191B */
   return return_code;
 }
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_VCO_Slots function
+  Use:      VCO planner, blocking capability
+            Used to know how many TUNER_BLOCKED_VCO properties the tuner supports
+  Returns:  the number of VCO blocking slots (TUNER_BLOCKED_VCO, then VCO2 and VCO3)
+************************************************************************************************************************/
+signed   int   SiLabs_TER_Tuner_VCO_Slots            (SILABS_TER_TUNER_Context *silabs_tuner) {
+  switch (silabs_tuner->ter_tuner_code) {
+    case 0x2124 :
+    case 0x2141 :
+    case 0x2144 :
+    case 0x2151 :
+    case 0x2190B:
+    case 0x2191B: { return 3; }
+    default     : { break;    }
+  }
+  return 1;
+}
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_VCO_Neighbour function
+  Use:      VCO planner, slot assignment
+            Used to know which tuner's VCO code a tuner blocks in a given slot.
+            The tuners are ranked by their distance in TER_tuners (i.e. in SW init order, normally the board layout),
+             on a ring: tuner_num+1, tuner_num-1, tuner_num+2, tuner_num-2, ...
+            With up to 4 tuners, a tuner with 3 slots blocks all other tuners.
+  Parameter:  tuner_num, the index of the tuner in TER_tuners
+  Parameter:  rank, the slot index
+  Parameter:  tuner_count, the number of tuners in TER_tuners
+  Returns:  the index in TER_tuners of the tuner to block in the slot, -1 if none
+************************************************************************************************************************/
+signed   int   SiLabs_TER_Tuner_VCO_Neighbour        (signed   int tuner_num, signed   int rank, signed   int tuner_count) {
+  signed   int d;
+  for (d = 1; 2*d <= tuner_count; d++) {
+    if (rank-- == 0) { return (tuner_num + d) % tuner_count; }
+    if (2*d == tuner_count) { break; } /* tuner_num+d and tuner_num-d are the same tuner */
+    if (rank-- == 0) { return (tuner_num + tuner_count - d) % tuner_count; }
+  }
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_VCO_Blocking_PostTune function
+  Use:      VCO planner
+            Called after each tune of tuners[tuner_num], to block its VCO code in the tuners using it as a neighbour.
+            The VCO code is read from the tuned tuner only, the VCO codes of the other tuners are those read after their own tune.
+            The slots of all tuners are checked against SiLabs_TER_Tuner_VCO_Neighbour, such that a change in the tuner count
+             is also taken into account, but a slot is only written when its neighbour or the neighbour's VCO code changed.
+            Depending on the tuner, the new value is either sent immediately or with the next tune (when DOWNLOAD_ON_CHANGE applies).
+  Returns:  0 if ok, the error code of the first failing status or property write otherwise
+************************************************************************************************************************/
 signed   int   SiLabs_TER_Tuner_VCO_Blocking_PostTune(SILABS_TER_TUNER_Context *tuners[], signed   int tuner_num, signed   int tuner_count) {
   signed   int errcode;
-  signed   int vco_code;
-  signed   int vco_dest[]={0,0,0};
-  signed   int vco_fn  []={0,0,0,0};
-  signed   int i;
-  signed   int c;
-  signed   int  (*Tuner_Block_VCO_ptr[3])(SILABS_TER_TUNER_Context *silabs_tuner, signed   int vco_code) = {SiLabs_TER_Tuner_Block_VCO_Code, SiLabs_TER_Tuner_Block_VCO2_Code, SiLabs_TER_Tuner_Block_VCO3_Code};
+  signed   int t;
+  signed   int slot;
+  signed   int slots;
+  signed   int n;
+  signed   int  (*Tuner_Block_VCO_ptr[TER_TUNER_VCO_SLOTS])(SILABS_TER_TUNER_Context *silabs_tuner, signed   int vco_code) = {SiLabs_TER_Tuner_Block_VCO_Code, SiLabs_TER_Tuner_Block_VCO2_Code, SiLabs_TER_Tuner_Block_VCO3_Code};
   SILABS_TER_TUNER_Context *silabs_tuner;
 
   silabs_tuner = tuners[tuner_num];
-  c = 0;
 
-  if ((errcode = SiLabs_TER_Tuner_Status (tuners[tuner_num])) != 0)
+  if (tuner_count < 2) { return 0; }
+
+  if ((errcode = SiLabs_TER_Tuner_Status (silabs_tuner)) != 0)
   {
     SiTRACE ("Error returned from TunerStatus error = %d\n", errcode);
+    silabs_tuner->vco_known = 0;
     return errcode;
   }
+  silabs_tuner->vco_known = 1;
+  SiTRACE("SiLabs_TER_Tuner_VCO_Blocking_PostTune tuner_num %d vco_code %d\n", tuner_num, silabs_tuner->vco_code);
 
-  vco_code = tuners[tuner_num]->vco_code;
-  SiTRACE("SiLabs_TER_Tuner_VCO_Blocking_PostTune vco_code %d\n", vco_code);
-
-  for ( i = 0 ; i < tuner_count; i++ ) {
-    if (i != tuner_num ) { vco_dest[c++] = i; }
-  }
-  SiTRACE("SiLabs_TER_Tuner_VCO_Blocking_PostTune tuner_num %d ==> vco_dest[0] = %d,  vco_dest[1] = %d,  vco_dest[2] = %d \n", tuner_num, vco_dest[0], vco_dest[1], vco_dest[2]);
-
-  for (i=0; i< tuner_count; i++)
-  {
-    if (tuner_num==0)
-    {
-      vco_fn[i]=i;
-    }
-    else
-    {
-      vco_fn[i]=tuner_num-1;
-    }
-  }
-
-  if (tuner_count == 1)
-  {
-    return 0;
-  }
-  if (tuner_count > 1) {
-    SiTRACE ("blocking VCO code %d in TER_tuners[%d]\n", vco_code, vco_dest[0]);
-    if ((errcode=Tuner_Block_VCO_ptr[vco_fn[0]]  (tuners[vco_dest[0]], vco_code)) != 0)
-    {
-      SiTRACE ("Error returned from SiLabs_TER_Tuner_Block_VCO_Code error = %d\n", errcode);
-      return errcode;
-    }
-  }
-  if (tuner_count > 2) {
-    SiTRACE ("blocking VCO code %d in TER_tuners[%d]\n", vco_code, vco_dest[1]);
-    if ((errcode=Tuner_Block_VCO_ptr[vco_fn[1]] (tuners[vco_dest[1]], vco_code)) != 0)
-    {
-      SiTRACE ("Error returned from SiLabs_TER_Tuner_Block_VCO2_Code error = %d\n", errcode);
-      return errcode;
-    }
-  }
-  if (tuner_count > 3) {
-    SiTRACE ("blocking VCO code %d in TER_tuners[%d]\n", vco_code, vco_dest[2]);
-    if ((errcode=Tuner_Block_VCO_ptr[vco_fn[2]] (tuners[vco_dest[2]], vco_code)) != 0)
-    {
-      SiTRACE ("Error returned from SiLabs_TER_Tuner_Block_VCO3_Code error = %d\n", errcode);
-      return errcode;
+  for (t = 0; t < tuner_count; t++) {
+    slots = SiLabs_TER_Tuner_VCO_Slots(tuners[t]);
+    for (slot = 0; slot < slots; slot++) {
+      n = SiLabs_TER_Tuner_VCO_Neighbour(t, slot, tuner_count);
+      if ( (n < 0) || (!tuners[n]->vco_known) ) { continue; }
+      if ( (tuners[t]->vco_blocked_tuner[slot] == n) && (tuners[t]->vco_blocked[slot] == tuners[n]->vco_code) ) { continue; }
+      SiTRACE ("blocking VCO code %d (TER_tuners[%d]) in TER_tuners[%d] slot %d\n", tuners[n]->vco_code, n, t, slot);
+      if ((errcode = Tuner_Block_VCO_ptr[slot] (tuners[t], tuners[n]->vco_code)) != 0)
+      {
+        SiTRACE ("Error returned from SiLabs_TER_Tuner_Block_VCO%d_Code error = %d\n", slot + 1, errcode);
+        tuners[t]->vco_blocked_tuner[slot] = -1;
+        return errcode;
+      }
+      tuners[t]->vco_blocked_tuner[slot] = n;
+      tuners[t]->vco_blocked      [slot] = tuners[n]->vco_code;
     }
   }
   return 0;
@@ -3447,7 +3701,7 @@ signed   int   SiLabs_TER_Tuner_Tone_Cancel          (SILABS_TER_TUNER_Context *
   return_code = 0;
   SiTRACE("SiLabs_TER_Tuner_Tone_Cancel %d  %d (ter_tuner_code %d/0x%x)\n", div_a, div_b, silabs_tuner->ter_tuner_code, silabs_tuner->ter_tuner_code);
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return Si2190B_L1_TUNER_CANCEL_TONE(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], div_a, div_b);
   }
 #endif /* TER_TUNER_Si2190B */
@@ -3455,79 +3709,79 @@ signed   int   SiLabs_TER_Tuner_Tone_Cancel          (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Get_RF               (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Get_RF(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) { return L1_RF_CUSTOMTER_Get_RF(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_GetRF(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_GetRF(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_GetRF(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_GetRF(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_GetRF(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_GetRF(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_GetRF(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_GetRF(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_GetRF(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_GetRF(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     Si2148_L1_TUNER_STATUS (silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_TUNER_STATUS_CMD_INTACK_OK);
     return silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.freq;
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_GetRF(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_GetRF(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_GetRF(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_GetRF(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     Si2156_L1_TUNER_STATUS (silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_STATUS_CMD_INTACK_OK);
     return silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.freq;
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_GetRF(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_GetRF(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_GetRF(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_GetRF(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_GetRF(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_GetRF(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_GetRF(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_GetRF(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_GetRF(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_GetRF(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_GetRF(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_GetRF(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_GetRF(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_GetRF(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_GetRF(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_GetRF(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_GetRF(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_GetRF(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_GetRF(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_GetRF(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_GetRF(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_GetRF(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_GetRF(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_GetRF(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_GetRF(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_GetRF(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -3536,13 +3790,13 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   SiTRACE("SiLabs_TER_Tuner_Status\n");
   return_code = -1;
 #ifdef    TER_TUNER_CUSTOMTER
-  if (silabs_tuner->ter_tuner_code == CUSTOMTER_CODE) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == CUSTOMTER_CODE) {
     silabs_tuner->rssi     = L1_RF_CUSTOMTER_Get_RSSI(silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->freq     = L1_RF_CUSTOMTER_Get_RF  (silabs_tuner->CUSTOMTER_Tuner[silabs_tuner->tuner_index]);
   }
 #endif /* TER_TUNER_CUSTOMTER */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     return_code = Si2124_L1_TUNER_STATUS(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->vco_code = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->rssi     = silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.rssi;
@@ -3551,7 +3805,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     return_code = Si2141_L1_TUNER_STATUS(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->vco_code = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->rssi     = silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.rssi;
@@ -3560,7 +3814,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     return_code = Si2144_L1_TUNER_STATUS(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->vco_code = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->rssi     = silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.rssi;
@@ -3569,7 +3823,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     return_code = Si2146_L1_TUNER_STATUS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3579,7 +3833,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     return_code = Si2147_L1_TUNER_STATUS(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3589,7 +3843,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     return_code = Si2148_L1_TUNER_STATUS(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3599,7 +3853,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     return_code = Si2148B_L1_TUNER_STATUS(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3609,7 +3863,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     return_code = Si2151_L1_TUNER_STATUS(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
     silabs_tuner->vco_code = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->rssi     = silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.rssi;
@@ -3618,7 +3872,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     return_code = Si2156_L1_TUNER_STATUS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3628,7 +3882,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return_code = Si2157_L1_TUNER_STATUS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3638,7 +3892,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     return_code = Si2158_L1_TUNER_STATUS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3648,7 +3902,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return_code = Si2158B_L1_TUNER_STATUS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3658,7 +3912,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     return_code = Si2173_L1_TUNER_STATUS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3668,7 +3922,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     return_code = Si2176_L1_TUNER_STATUS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3678,7 +3932,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return_code = Si2177_L1_TUNER_STATUS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3688,7 +3942,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     return_code = Si2178_L1_TUNER_STATUS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3698,7 +3952,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return_code = Si2178B_L1_TUNER_STATUS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3714,7 +3968,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     return_code = Si2190_L1_TUNER_STATUS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3724,7 +3978,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return_code = Si2190B_L1_TUNER_STATUS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3734,7 +3988,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     return_code = Si2191_L1_TUNER_STATUS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3744,7 +3998,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return_code = Si2191B_L1_TUNER_STATUS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3754,7 +4008,7 @@ signed   int   SiLabs_TER_Tuner_Status               (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     return_code = Si2196_L1_TUNER_STATUS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_TUNER_STATUS_CMD_INTACK_OK);
     silabs_tuner->vco_code = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.vco_code;
     silabs_tuner->tc       = silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->rsp->tuner_status.tc;
@@ -3774,133 +4028,133 @@ signed   int   SiLabs_TER_Tuner_Text_STATUS          (SILABS_TER_TUNER_Context *
   snprintf(msg, 1000, "SiLabs_TER_Tuner_Text_STATUS: unknown tuner_code 0x%04x\n", silabs_tuner->ter_tuner_code);
   return_code = -1;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     return_code = Si2124_L1_TUNER_STATUS(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]);
     Si2124_L1_GetCommandResponseString  (silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     return_code = Si2141_L1_TUNER_STATUS(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]);
     Si2141_L1_GetCommandResponseString  (silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     return_code = Si2144_L1_TUNER_STATUS(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]);
     Si2144_L1_GetCommandResponseString  (silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     return_code = Si2146_L1_TUNER_STATUS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_TUNER_STATUS_CMD_INTACK_OK);
     Si2146_L1_GetCommandResponseString  (silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     return_code = Si2147_L1_TUNER_STATUS(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_TUNER_STATUS_CMD_INTACK_OK);
     Si2147_L1_GetCommandResponseString  (silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     return_code = Si2148_L1_TUNER_STATUS(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_TUNER_STATUS_CMD_INTACK_OK);
     Si2148_L1_GetCommandResponseString  (silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     return_code = Si2148B_L1_TUNER_STATUS(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_TUNER_STATUS_CMD_INTACK_OK);
     Si2148B_L1_GetCommandResponseString  (silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     return_code = Si2151_L1_TUNER_STATUS(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]);
     Si2151_L1_GetCommandResponseString  (silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     return_code = Si2156_L1_TUNER_STATUS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_STATUS_CMD_INTACK_OK);
     Si2156_L1_GetCommandResponseString  (silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return_code = Si2157_L1_TUNER_STATUS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_STATUS_CMD_INTACK_OK);
     Si2157_L1_GetCommandResponseString  (silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     return_code = Si2158_L1_TUNER_STATUS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_STATUS_CMD_INTACK_OK);
     Si2158_L1_GetCommandResponseString  (silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return_code = Si2158B_L1_TUNER_STATUS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_STATUS_CMD_INTACK_OK);
     Si2158B_L1_GetCommandResponseString  (silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     return_code = Si2173_L1_TUNER_STATUS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_STATUS_CMD_INTACK_OK);
     Si2173_L1_GetCommandResponseString  (silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     return_code = Si2176_L1_TUNER_STATUS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_STATUS_CMD_INTACK_OK);
     Si2176_L1_GetCommandResponseString  (silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return_code = Si2177_L1_TUNER_STATUS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_STATUS_CMD_INTACK_OK);
     Si2177_L1_GetCommandResponseString  (silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     return_code = Si2178_L1_TUNER_STATUS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_STATUS_CMD_INTACK_OK);
     Si2178_L1_GetCommandResponseString  (silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return_code = Si2178B_L1_TUNER_STATUS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_STATUS_CMD_INTACK_OK);
     Si2178B_L1_GetCommandResponseString  (silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     return_code = Si2190_L1_TUNER_STATUS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_STATUS_CMD_INTACK_OK);
     Si2190_L1_GetCommandResponseString  (silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return_code = Si2190B_L1_TUNER_STATUS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_STATUS_CMD_INTACK_OK);
     Si2190B_L1_GetCommandResponseString  (silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     return_code = Si2191_L1_TUNER_STATUS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_STATUS_CMD_INTACK_OK);
     Si2191_L1_GetCommandResponseString  (silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return_code = Si2191B_L1_TUNER_STATUS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_STATUS_CMD_INTACK_OK);
     Si2191B_L1_GetCommandResponseString  (silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_TUNER_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     return_code = Si2196_L1_TUNER_STATUS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_TUNER_STATUS_CMD_INTACK_OK);
     Si2196_L1_GetCommandResponseString  (silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_TUNER_STATUS_CMD_CODE, separator, msg);
   }
@@ -3912,19 +4166,19 @@ signed   int   SiLabs_TER_Tuner_ATV_Text_STATUS      (SILABS_TER_TUNER_Context *
   SiTRACE("SiLabs_TER_Tuner_ATV_Text_STATUS\n");
   return_code = -1;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     return_code = Si2146_L1_ATV_STATUS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_ATV_STATUS_CMD_INTACK_OK);
     Si2146_L1_GetCommandResponseString(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_ATV_STATUS_CMD_CODE, separator, msg);
   }
@@ -3932,97 +4186,97 @@ signed   int   SiLabs_TER_Tuner_ATV_Text_STATUS      (SILABS_TER_TUNER_Context *
 #ifdef    TER_TUNER_Si2147
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     return_code = Si2156_L1_ATV_STATUS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_ATV_STATUS_CMD_INTACK_OK);
     Si2156_L1_GetCommandResponseString(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return_code = Si2157_L1_ATV_STATUS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_ATV_STATUS_CMD_INTACK_OK);
     Si2157_L1_GetCommandResponseString(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     return_code = Si2158_L1_ATV_STATUS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_ATV_STATUS_CMD_INTACK_OK);
     Si2158_L1_GetCommandResponseString(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return_code = Si2158B_L1_ATV_STATUS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_ATV_STATUS_CMD_INTACK_OK);
     Si2158B_L1_GetCommandResponseString(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     return_code = Si2173_L1_ATV_STATUS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_ATV_STATUS_CMD_INTACK_OK);
     Si2173_L1_GetCommandResponseString(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     return_code = Si2176_L1_ATV_STATUS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_ATV_STATUS_CMD_INTACK_OK);
     Si2176_L1_GetCommandResponseString(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return_code = Si2177_L1_ATV_STATUS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_ATV_STATUS_CMD_INTACK_OK);
     Si2177_L1_GetCommandResponseString(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     return_code = Si2178_L1_ATV_STATUS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_ATV_STATUS_CMD_INTACK_OK);
     Si2178_L1_GetCommandResponseString(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return_code = Si2178B_L1_ATV_STATUS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_ATV_STATUS_CMD_INTACK_OK);
     Si2178B_L1_GetCommandResponseString(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     return_code = Si2190_L1_ATV_STATUS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_ATV_STATUS_CMD_INTACK_OK);
     Si2190_L1_GetCommandResponseString(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return_code = Si2190B_L1_ATV_STATUS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_ATV_STATUS_CMD_INTACK_OK);
     Si2190B_L1_GetCommandResponseString(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     return_code = Si2191_L1_ATV_STATUS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_ATV_STATUS_CMD_INTACK_OK);
     Si2191_L1_GetCommandResponseString(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return_code = Si2191B_L1_ATV_STATUS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_ATV_STATUS_CMD_INTACK_OK);
     Si2191B_L1_GetCommandResponseString(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_ATV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     return_code = Si2196_L1_ATV_STATUS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_ATV_STATUS_CMD_INTACK_OK);
     Si2196_L1_GetCommandResponseString(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_ATV_STATUS_CMD_CODE, separator, msg);
   }
@@ -4038,125 +4292,125 @@ signed   int   SiLabs_TER_Tuner_DTV_Text_STATUS      (SILABS_TER_TUNER_Context *
   SiTRACE("SiLabs_TER_Tuner_DTV_Text_STATUS\n");
   return_code = -1;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     return_code = Si2146_L1_DTV_STATUS(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_STATUS_CMD_INTACK_OK);
     Si2146_L1_GetCommandResponseString(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     return_code = Si2147_L1_DTV_STATUS(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_STATUS_CMD_INTACK_OK);
     Si2147_L1_GetCommandResponseString(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     return_code = Si2148_L1_DTV_STATUS(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_STATUS_CMD_INTACK_OK);
     Si2148_L1_GetCommandResponseString(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     return_code = Si2148B_L1_DTV_STATUS(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_STATUS_CMD_INTACK_OK);
     Si2148B_L1_GetCommandResponseString(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     return_code = Si2156_L1_DTV_STATUS(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_STATUS_CMD_INTACK_OK);
     Si2156_L1_GetCommandResponseString(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     return_code = Si2157_L1_DTV_STATUS(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_STATUS_CMD_INTACK_OK);
     Si2157_L1_GetCommandResponseString(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     return_code = Si2158_L1_DTV_STATUS(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_STATUS_CMD_INTACK_OK);
     Si2158_L1_GetCommandResponseString(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     return_code = Si2158B_L1_DTV_STATUS(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_STATUS_CMD_INTACK_OK);
     Si2158B_L1_GetCommandResponseString(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     return_code = Si2173_L1_DTV_STATUS(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_STATUS_CMD_INTACK_OK);
     Si2173_L1_GetCommandResponseString(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     return_code = Si2176_L1_DTV_STATUS(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_STATUS_CMD_INTACK_OK);
     Si2176_L1_GetCommandResponseString(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     return_code = Si2177_L1_DTV_STATUS(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_STATUS_CMD_INTACK_OK);
     Si2177_L1_GetCommandResponseString(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     return_code = Si2178_L1_DTV_STATUS(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_STATUS_CMD_INTACK_OK);
     Si2178_L1_GetCommandResponseString(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     return_code = Si2178B_L1_DTV_STATUS(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_STATUS_CMD_INTACK_OK);
     Si2178B_L1_GetCommandResponseString(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     return_code = Si2190_L1_DTV_STATUS(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_STATUS_CMD_INTACK_OK);
     Si2190_L1_GetCommandResponseString(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     return_code = Si2190B_L1_DTV_STATUS(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_STATUS_CMD_INTACK_OK);
     Si2190B_L1_GetCommandResponseString(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     return_code = Si2191_L1_DTV_STATUS(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_STATUS_CMD_INTACK_OK);
     Si2191_L1_GetCommandResponseString(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     return_code = Si2191B_L1_DTV_STATUS(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_STATUS_CMD_INTACK_OK);
     Si2191B_L1_GetCommandResponseString(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_STATUS_CMD_CODE, separator, msg);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     return_code = Si2196_L1_DTV_STATUS(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_STATUS_CMD_INTACK_OK);
     Si2196_L1_GetCommandResponseString(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_STATUS_CMD_CODE, separator, msg);
   }
@@ -4170,7 +4424,7 @@ signed   int   SiLabs_TER_Tuner_DTV_Text_STATUS      (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_DTV_AGC_SOURCE       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int dtv_agc_source) {
   SiTRACE("SiLabs_TER_Tuner_DTV_AGC_SOURCE %d\n", dtv_agc_source);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2124_CONFIG_PINS_CMD_AGC1_MODE_DISABLE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc2_mode = Si2124_CONFIG_PINS_CMD_AGC2_MODE_DISABLE;
     if (dtv_agc_source == 1) { silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2124_CONFIG_PINS_CMD_AGC1_MODE_DTV_AGC; }
@@ -4188,7 +4442,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_SOURCE       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2141_CONFIG_PINS_CMD_AGC1_MODE_DISABLE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc2_mode = Si2141_CONFIG_PINS_CMD_AGC2_MODE_DISABLE;
     if (dtv_agc_source == 1) { silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2141_CONFIG_PINS_CMD_AGC1_MODE_DTV_AGC; }
@@ -4206,7 +4460,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_SOURCE       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2144_CONFIG_PINS_CMD_AGC1_MODE_DISABLE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc2_mode = Si2144_CONFIG_PINS_CMD_AGC2_MODE_DISABLE;
     if (dtv_agc_source == 1) { silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2144_CONFIG_PINS_CMD_AGC1_MODE_DTV_AGC; }
@@ -4224,31 +4478,31 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_SOURCE       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
       silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc1_mode = Si2151_CONFIG_PINS_CMD_AGC1_MODE_DISABLE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.agc2_mode = Si2151_CONFIG_PINS_CMD_AGC2_MODE_DISABLE;
     if (dtv_agc_source == 1) {
@@ -4270,85 +4524,85 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_SOURCE       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source    = dtv_agc_source;
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_CONFIG_IF_PORT_PROP_CODE);;
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = dtv_agc_source;
     return Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
@@ -4363,7 +4617,7 @@ signed   int   SiLabs_TER_Tuner_DTV_FEF_SOURCE       (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_ACTIVE_LOOP_THROUGH  (SILABS_TER_TUNER_Context *silabs_tuner, signed   int enable ) {
   SiTRACE("SiLabs_TER_Tuner_ACTIVE_LOOP_THROUGH %d\n", enable);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     if (enable == 1) {
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->standby.type = Si2124_STANDBY_CMD_TYPE_LNA_ON;
     } else {
@@ -4374,7 +4628,7 @@ signed   int   SiLabs_TER_Tuner_ACTIVE_LOOP_THROUGH  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     if (enable == 1) {
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->standby.type = Si2144_STANDBY_CMD_TYPE_LNA_ON;
     } else {
@@ -4390,133 +4644,133 @@ signed   int   SiLabs_TER_Tuner_ACTIVE_LOOP_THROUGH  (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_DTV_OUT_TYPE         (SILABS_TER_TUNER_Context *silabs_tuner, signed   int dtv_out_type  ) {
   SiTRACE("SiLabs_TER_Tuner_DTV_OUT_TYPE %d\n", dtv_out_type);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2124_L1_SetProperty2(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2141_L1_SetProperty2(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2144_L1_SetProperty2(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type   = dtv_out_type;
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2151_L1_SetProperty2(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type  = dtv_out_type;
     return Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type     = dtv_out_type;
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type   = dtv_out_type;
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = dtv_out_type;
     return Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
@@ -4525,7 +4779,7 @@ signed   int   SiLabs_TER_Tuner_DTV_OUT_TYPE         (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2124_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF;
     Si2124_L1_SetProperty2(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_DTV_CONFIG_IF_PORT_PROP_CODE);
     return Si2124_L1_CONFIG_PINS (silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]
@@ -4541,7 +4795,7 @@ signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2141_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF;
     Si2141_L1_SetProperty2(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_DTV_CONFIG_IF_PORT_PROP_CODE);
     return Si2141_L1_CONFIG_PINS (silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]
@@ -4557,7 +4811,7 @@ signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2144_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF;
     Si2144_L1_SetProperty2(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_DTV_CONFIG_IF_PORT_PROP_CODE);
     return Si2144_L1_CONFIG_PINS (silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]
@@ -4573,35 +4827,35 @@ signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
       silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2146_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
       silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2146_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_DLIF_AGC_3DB;
     return Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2147_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2147_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2148_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2148_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2148B_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2148B_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2151_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF;
     Si2151_L1_SetProperty2(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_DTV_CONFIG_IF_PORT_PROP_CODE);
     return Si2151_L1_CONFIG_PINS (silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]
@@ -4617,98 +4871,98 @@ signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
       silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2156_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
       silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2156_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_DLIF_AGC_3DB;
     return Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2157_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2157_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2158_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2158_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2158B_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2158B_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2173_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2173_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_DLIF_AGC_3DB;
     return Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2176_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2176_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_DLIF_AGC_3DB;
     return Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2177_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2177_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2178_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2178_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2178B_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2178B_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2190_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2190_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2190B_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2190B_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2191_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2191_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2191B_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF1;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2191B_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_AGC1_3DB;
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_CONFIG_IF_PORT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_out_type    = Si2196_DTV_CONFIG_IF_PORT_PROP_DTV_OUT_TYPE_LIF_IF2;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_config_if_port.dtv_agc_source  = Si2196_DTV_CONFIG_IF_PORT_PROP_DTV_AGC_SOURCE_DLIF_AGC_3DB;
     return Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_CONFIG_IF_PORT_PROP_CODE);
@@ -4718,154 +4972,154 @@ signed   int   SiLabs_TER_Tuner_AGC_External         (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_DTV_LIF_OUT          (SILABS_TER_TUNER_Context *silabs_tuner, signed   int amp, signed   int offset) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2124_L1_SetProperty2(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2141_L1_SetProperty2(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2144_L1_SetProperty2(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2146_L1_SetProperty2(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], Si2146_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2148_L1_SetProperty2(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], Si2148_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2151_L1_SetProperty2(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2156_L1_SetProperty2(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2158_L1_SetProperty2(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], Si2158_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2173_L1_SetProperty2(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2176_L1_SetProperty2(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2178_L1_SetProperty2(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], Si2178_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_LIF_OUT_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.amp = amp;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_lif_out.offset = offset;
     return Si2196_L1_SetProperty2(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_DTV_LIF_OUT_PROP_CODE);
@@ -4893,70 +5147,70 @@ signed   int   SiLabs_TER_Tuner_DTV_LIF_OUT_amp      (SILABS_TER_TUNER_Context *
   signed   int amp[DTV_LIF_OUT_TABLES];
   if (amp_index > DTV_LIF_OUT_TABLES - 1) {amp_index = 0;}
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { amp[NEW_DEMOD_OFDM] = 23; amp[NEW_DEMOD_QAM] = 32; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { amp[NEW_DEMOD_OFDM] = 23; amp[NEW_DEMOD_QAM] = 32; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 25; amp[OLD_DEMOD_QAM] = 37; }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { amp[NEW_DEMOD_OFDM] = 32; amp[NEW_DEMOD_QAM] = 43; amp[OLD_DEMOD_OFDM] = 24; amp[OLD_DEMOD_QAM] = 34; }
 #endif /* TER_TUNER_Si2196 */
   return SiLabs_TER_Tuner_DTV_LIF_OUT(silabs_tuner, amp[amp_index], 148);
 }
@@ -4968,98 +5222,98 @@ signed   int   SiLabs_TER_Tuner_DTV_INTERNAL_ZIF_DVBT(SILABS_TER_TUNER_Context *
   - DVBC2              : prop->dtv_internal_zif.dvbt LIF
 */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     if (zif_lif == 0) { silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2124_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2124_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2124_L1_SetProperty2(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], Si2124_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     if (zif_lif == 0) { silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2141_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2141_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2141_L1_SetProperty2(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], Si2141_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     if (zif_lif == 0) { silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2144_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2144_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2144_L1_SetProperty2(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], Si2144_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     if (zif_lif == 0) { silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2147_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2147_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2147_L1_SetProperty2(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], Si2147_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     if (zif_lif == 0) { silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2148B_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2148B_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2148B_L1_SetProperty2(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], Si2148B_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     if (zif_lif == 0) { silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2151_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2151_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2151_L1_SetProperty2(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], Si2151_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     if (zif_lif == 0) { silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2157_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2157_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2157_L1_SetProperty2(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], Si2157_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     if (zif_lif == 0) { silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2158B_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2158B_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2158B_L1_SetProperty2(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], Si2158B_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     if (zif_lif == 0) { silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2177_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2177_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2177_L1_SetProperty2(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], Si2177_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     if (zif_lif == 0) { silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2178B_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2178B_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2178B_L1_SetProperty2(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], Si2178B_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     if (zif_lif == 0) { silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2190_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2190_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2190_L1_SetProperty2(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], Si2190_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     if (zif_lif == 0) { silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2190B_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2190B_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2190B_L1_SetProperty2(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], Si2190B_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     if (zif_lif == 0) { silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2191_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2191_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2191_L1_SetProperty2(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], Si2191_DTV_INTERNAL_ZIF_PROP_CODE);
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     if (zif_lif == 0) { silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2191B_DTV_INTERNAL_ZIF_PROP_DVBT_ZIF;
     } else            { silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_internal_zif.dvbt  = Si2191B_DTV_INTERNAL_ZIF_PROP_DVBT_LIF; }
     return Si2191B_L1_SetProperty2(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], Si2191B_DTV_INTERNAL_ZIF_PROP_CODE);
@@ -5069,7 +5323,7 @@ signed   int   SiLabs_TER_Tuner_DTV_INTERNAL_ZIF_DVBT(SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2124_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2124_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2124_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5077,7 +5331,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2141_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2141_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2141_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5085,7 +5339,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2144_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2144_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2144_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5093,7 +5347,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2146_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2146_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2146_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5101,7 +5355,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2147_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2147_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2147_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5109,7 +5363,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2148_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2148_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2148_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5117,7 +5371,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5125,7 +5379,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2151_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2151_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2151_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5133,7 +5387,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2156_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2156_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2156_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5143,7 +5397,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2157_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2157_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2157_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5151,7 +5405,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2158_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2158_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2158_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5159,7 +5413,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5167,7 +5421,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2173_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2173_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2173_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5177,7 +5431,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2176_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2176_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2176_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5187,7 +5441,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2177_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2177_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2177_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5195,7 +5449,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2178_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2178_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2178_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5203,7 +5457,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5211,7 +5465,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2190_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2190_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2190_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5219,7 +5473,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5227,7 +5481,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2191_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2191_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2191_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5235,7 +5489,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5243,7 +5497,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2196_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2196_TUNER_LO_INJECTION_PROP_BAND_2_LOW_SIDE;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2196_TUNER_LO_INJECTION_PROP_BAND_3_LOW_SIDE;
@@ -5256,7 +5510,7 @@ signed   int   SiLabs_TER_Tuner_DTV_LOInjection      (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *silabs_tuner) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2124_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2124_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2124_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5264,7 +5518,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2141_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2141_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2141_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5272,7 +5526,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2144_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2144_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2144_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5280,7 +5534,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2146_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2146_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2146_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5290,7 +5544,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2147_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2147_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2147_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5298,7 +5552,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2148_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2148_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2148_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5306,7 +5560,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2148B_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5314,7 +5568,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2151_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2151_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2151_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5322,7 +5576,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2156_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2156_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2156_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5332,7 +5586,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2157_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2157_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2157_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5340,7 +5594,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2158_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2158_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2158_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5348,7 +5602,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2158B_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5356,7 +5610,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2173_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2173_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2173_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5366,7 +5620,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2176_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2176_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2176_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5376,7 +5630,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2177_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2177_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2177_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5384,7 +5638,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2178_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2178_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2178_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5392,7 +5646,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2178B_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5400,7 +5654,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2190_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2190_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2190_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5408,7 +5662,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2190B_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5416,7 +5670,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2191_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2191_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2191_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5424,7 +5678,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2191B_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5432,7 +5686,7 @@ signed   int   SiLabs_TER_Tuner_ATV_LOInjection      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_1 = Si2196_TUNER_LO_INJECTION_PROP_BAND_1_HIGH_SIDE;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_2 = Si2196_TUNER_LO_INJECTION_PROP_BAND_2_HIGH_SIDE;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->tuner_lo_injection.band_3 = Si2196_TUNER_LO_INJECTION_PROP_BAND_3_HIGH_SIDE;
@@ -5449,7 +5703,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   /* fef_level will be used during SiLabs_TER_Tuner_FEF_FREEZE_PIN to set the dtv_agc_freeze_input.level */
   if (fef_level) {silabs_tuner->fef_level = 1;} else {silabs_tuner->fef_level = 0;}
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     if (silabs_tuner->fef_freeze_pin == 1) {
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2124_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2124_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5475,7 +5729,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     if (silabs_tuner->fef_freeze_pin == 1) {
       silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2141_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2141_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5501,7 +5755,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     if (silabs_tuner->fef_freeze_pin == 1) {
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2144_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2144_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5527,7 +5781,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
   #ifdef    Si2146_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_HIGH
     if (silabs_tuner->fef_freeze_pin == Si2146_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2146_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
@@ -5555,7 +5809,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     if (silabs_tuner->fef_freeze_pin == Si2147_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2147_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2147_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5579,7 +5833,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     if (silabs_tuner->fef_freeze_pin == Si2148_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2148_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2148_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5603,7 +5857,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     if (silabs_tuner->fef_freeze_pin == Si2148B_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2148B_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2148B_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5627,7 +5881,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     if (silabs_tuner->fef_freeze_pin == 1) {
       silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2151_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2151_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5653,7 +5907,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
   #ifdef    Si2156_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_HIGH
     if (silabs_tuner->fef_freeze_pin == Si2156_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2156_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
@@ -5681,7 +5935,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     if (silabs_tuner->fef_freeze_pin == Si2157_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2157_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2157_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5705,7 +5959,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     if (silabs_tuner->fef_freeze_pin == Si2158_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2158_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2158_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5729,7 +5983,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     if (silabs_tuner->fef_freeze_pin == Si2158B_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2158B_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2158B_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5753,13 +6007,13 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     SiERROR("SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP not supported by Si2173!\n");
     return 0;
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     if (silabs_tuner->fef_freeze_pin == Si2176_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2176_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2176_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5785,7 +6039,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     if (silabs_tuner->fef_freeze_pin == Si2177_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2177_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2177_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5809,7 +6063,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     if (silabs_tuner->fef_freeze_pin == Si2178_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2178_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2178_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5833,7 +6087,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     if (silabs_tuner->fef_freeze_pin == Si2178B_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2178B_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2178B_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5857,7 +6111,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     if (silabs_tuner->fef_freeze_pin == Si2190_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2190_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2190_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5881,7 +6135,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     if (silabs_tuner->fef_freeze_pin == Si2190B_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2190B_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2190B_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5905,7 +6159,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     if (silabs_tuner->fef_freeze_pin == Si2191_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2191_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2191_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5929,7 +6183,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     if (silabs_tuner->fef_freeze_pin == Si2191B_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2191B_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2191B_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5953,7 +6207,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     if (silabs_tuner->fef_freeze_pin == Si2196_DTV_AGC_FREEZE_INPUT_PROP_PIN_GPIO1) {
       silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2196_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2196_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
@@ -5978,7 +6232,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int fef) {
   SiTRACE("SiLabs_TER_Tuner_FEF_FREEZE_PIN       silabs_tuner->ter_tuner_code 0x%x, fef %d\n", (signed   int)silabs_tuner->ter_tuner_code, fef);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2124_CONFIG_PINS_CMD_GPIO1_MODE_NO_CHANGE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2124_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2124_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -6013,7 +6267,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2141_CONFIG_PINS_CMD_GPIO1_MODE_NO_CHANGE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2141_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2141_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -6048,7 +6302,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2144_CONFIG_PINS_CMD_GPIO1_MODE_NO_CHANGE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2144_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2144_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -6083,7 +6337,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2147_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6098,7 +6352,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2148_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6113,7 +6367,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2148B_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6128,7 +6382,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2151_CONFIG_PINS_CMD_GPIO1_MODE_NO_CHANGE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2151_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2151_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -6163,7 +6417,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2157_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6178,7 +6432,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2158_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6193,7 +6447,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2158B_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6208,13 +6462,13 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     SiERROR("SiLabs_TER_Tuner_FEF_FREEZE_PIN not supported by Si2173!\n");
     return 0;
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level        = Si2176_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6229,7 +6483,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2177_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6244,7 +6498,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2178_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6259,7 +6513,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2178B_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6274,7 +6528,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2190_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6289,7 +6543,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2190B_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6304,7 +6558,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2191_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6319,7 +6573,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2191B_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6334,7 +6588,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2196_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
     } else {
@@ -6349,7 +6603,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2196 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
   #ifdef    Si2146_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_HIGH
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2146_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
@@ -6366,7 +6620,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
   #ifdef    Si2156_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_HIGH
     if (silabs_tuner->fef_level == 0) {
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_freeze_input.level      = Si2156_DTV_AGC_FREEZE_INPUT_PROP_LEVEL_LOW;
@@ -6386,7 +6640,7 @@ signed   int   SiLabs_TER_Tuner_FEF_FREEZE_PIN       (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *silabs_tuner, signed   int fef) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
       if (fef == 0) {
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2124_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2124_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6405,7 +6659,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
       if (fef == 0) {
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2141_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2141_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6424,7 +6678,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
       if (fef == 0) {
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2144_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2144_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6443,7 +6697,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
       if (fef == 0) {
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2146_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2146_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6462,7 +6716,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
       if (fef == 0) {
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2147_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2147_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6481,7 +6735,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
       if (fef == 0) {
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2148_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2148_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6500,7 +6754,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
       if (fef == 0) {
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2148B_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2148B_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6519,7 +6773,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
       if (fef == 0) {
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2151_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2151_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6538,7 +6792,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
       if (fef == 0) {
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2156_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2156_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6557,7 +6811,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
       if (fef == 0) {
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2157_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2157_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6576,7 +6830,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
       if (fef == 0) {
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2158_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2158_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6595,7 +6849,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
       if (fef == 0) {
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2158B_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2158B_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6614,13 +6868,13 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
       SiERROR("SiLabs_TER_Tuner_SLOW_INITIAL_AGC not supported by Si2173!\n");
       return 0;
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
       if (fef == 0) {
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2176_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2176_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6639,7 +6893,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
       if (fef == 0) {
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2177_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2177_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6658,7 +6912,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
       if (fef == 0) {
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2178_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2178_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6677,7 +6931,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
       if (fef == 0) {
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2178B_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2178B_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6696,7 +6950,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
       if (fef == 0) {
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2190_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2190_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6715,7 +6969,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
       if (fef == 0) {
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2190B_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2190B_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6734,7 +6988,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
       if (fef == 0) {
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2191_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2191_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6753,7 +7007,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
       if (fef == 0) {
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2191B_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2191B_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6772,7 +7026,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
       if (fef == 0) {
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.agc_decim     = Si2196_DTV_INITIAL_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed.if_agc_speed  = Si2196_DTV_INITIAL_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6794,7 +7048,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_INITIAL_AGC     (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *silabs_tuner, signed   int fef) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2124_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6808,7 +7062,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
       silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2141_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6822,7 +7076,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2144_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6836,7 +7090,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
       silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2146_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6850,7 +7104,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
       silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2147_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6864,7 +7118,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
       silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2148_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6878,7 +7132,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
       silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2148B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6892,7 +7146,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
       silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2151_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6906,7 +7160,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
       silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2156_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6920,7 +7174,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
       silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2157_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6934,7 +7188,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
       silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2158_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6948,7 +7202,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
       silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2158B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6962,7 +7216,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
       if (fef == 0) {
         silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2173_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2173_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -6974,7 +7228,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
       silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2176_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -6988,7 +7242,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
       silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2177_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7002,7 +7256,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
       silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2178_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7016,7 +7270,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
       silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2178B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7030,7 +7284,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
       silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2190_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7044,7 +7298,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
       silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2190B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7058,7 +7312,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
       silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2191_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7072,7 +7326,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
       silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2191B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7086,7 +7340,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
       silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_initial_agc_speed_period.period = 0;
       if (fef == 0) {
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2196_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
@@ -7103,7 +7357,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC_SETUP(SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *silabs_tuner, signed   int fef) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
       if (fef == 0) {
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2124_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2124_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7115,7 +7369,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
       if (fef == 0) {
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2141_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2141_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7127,7 +7381,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
       if (fef == 0) {
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2144_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2144_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7139,7 +7393,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
       if (fef == 0) {
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2146_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2146_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7151,7 +7405,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
       if (fef == 0) {
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2147_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2147_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7163,7 +7417,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
       if (fef == 0) {
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2148_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2148_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7175,7 +7429,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
       if (fef == 0) {
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2148B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2148B_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7187,7 +7441,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
       if (fef == 0) {
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2151_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2151_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7199,7 +7453,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
       if (fef == 0) {
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2156_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2156_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7211,7 +7465,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
       if (fef == 0) {
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2157_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2157_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7223,7 +7477,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
       if (fef == 0) {
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2158_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2158_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7235,7 +7489,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
       if (fef == 0) {
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2158B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2158B_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7247,7 +7501,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
       if (fef == 0) {
         silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2173_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2173_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7259,7 +7513,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
       if (fef == 0) {
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2176_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2176_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7271,7 +7525,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
       if (fef == 0) {
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2177_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2177_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7283,7 +7537,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
       if (fef == 0) {
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2178_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2178_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7295,7 +7549,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
       if (fef == 0) {
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2178B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2178B_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7307,7 +7561,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
       if (fef == 0) {
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2190_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2190_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7319,7 +7573,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
       if (fef == 0) {
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2190B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2190B_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7331,7 +7585,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
       if (fef == 0) {
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2191_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2191_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7343,7 +7597,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
       if (fef == 0) {
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2191B_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2191B_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7355,7 +7609,7 @@ signed   int   SiLabs_TER_Tuner_SLOW_NORMAL_AGC      (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
       if (fef == 0) {
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.agc_decim             = Si2196_DTV_AGC_SPEED_PROP_AGC_DECIM_OFF;
         silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_speed.if_agc_speed          = Si2196_DTV_AGC_SPEED_PROP_IF_AGC_SPEED_AUTO;
@@ -7372,7 +7626,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   silabs_tuner = silabs_tuner;
   fef          = fef;
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
       if (fef == 0) {
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7384,7 +7638,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
       if (fef == 0) {
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7396,7 +7650,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
       if (fef == 0) {
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7408,7 +7662,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     #ifdef    Si2147_DTV_AGC_AUTO_FREEZE_PROP_CODE
       if (fef == 0) {
         silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
@@ -7422,7 +7676,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
       if (fef == 0) {
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7434,7 +7688,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
       if (fef == 0) {
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7446,7 +7700,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     #ifdef    Si2157_DTV_AGC_AUTO_FREEZE_PROP_CODE
       if (fef == 0) {
         silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
@@ -7460,7 +7714,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
       if (fef == 0) {
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7472,7 +7726,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     #ifdef    Si2177_DTV_AGC_AUTO_FREEZE_PROP_CODE
       if (fef == 0) {
         silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
@@ -7486,7 +7740,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
       if (fef == 0) {
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7498,7 +7752,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
       if (fef == 0) {
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.thld          = 255;
         silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->prop->dtv_agc_auto_freeze.timeout       = 1;
@@ -7515,7 +7769,7 @@ signed   int   SiLabs_TER_Tuner_DTV_AGC_AUTO_FREEZE  (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *silabs_tuner, signed   int gpio1_mode, signed   int gpio2_mode) {
   SiTRACE("SiLabs_TER_Tuner_GPIOS (silabs_tuner, %d, %d);\n" , gpio1_mode, gpio2_mode);
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) {
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2124_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2124_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2124_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7529,7 +7783,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) {
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2141_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7543,7 +7797,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) {
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = Si2144_CONFIG_PINS_CMD_GPIO1_MODE_DISABLE;
       silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = Si2144_CONFIG_PINS_CMD_GPIO2_MODE_NO_CHANGE;
     silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2144_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7557,7 +7811,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) {
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2146_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7571,7 +7825,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) {
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2147_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7583,7 +7837,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) {
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2148_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7595,7 +7849,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) {
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2148B_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7607,7 +7861,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) {
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2151_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7621,7 +7875,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2156_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7635,7 +7889,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2157_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7647,7 +7901,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) {
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2158_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7659,7 +7913,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) {
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2158B_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7671,13 +7925,13 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     SiERROR("SiLabs_TER_Tuner_FEF_FREEZE_PIN_SETUP not supported by Si2173!\n");
     return 0;
   }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2176_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7691,7 +7945,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2177_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7703,7 +7957,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) {
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2178_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7715,7 +7969,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2178B_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7727,7 +7981,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) {
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2190_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7739,7 +7993,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) {
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2190B_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7749,7 +8003,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) {
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2191_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7761,7 +8015,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) {
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2191B_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7773,7 +8027,7 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_mode               = gpio1_mode;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio2_mode               = gpio2_mode;
     silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index]->cmd->config_pins.gpio1_read               = Si2196_CONFIG_PINS_CMD_GPIO1_READ_READ;
@@ -7785,70 +8039,70 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_LoadVideofilter                (SILABS_TER_TUNER_Context *silabs_tuner, vid_filt_struct *vidFiltTable, signed   int lines) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_LoadVideofilter(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_LoadVideofilter(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_LoadVideofilter(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_LoadVideofilter(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_LoadVideofilter(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_LoadVideofilter(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_LoadVideofilter(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_LoadVideofilter(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_LoadVideofilter(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_LoadVideofilter(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return -1; /* Si2148_LoadVideofilter is not declared in Si2148_L2_API.h */ }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return -1; /* Si2148_LoadVideofilter is not declared in Si2148_L2_API.h */ }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_LoadVideofilter(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_LoadVideofilter(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_LoadVideofilter(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_LoadVideofilter(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return 0; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_LoadVideofilter(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_LoadVideofilter(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_LoadVideofilter(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_LoadVideofilter(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_LoadVideofilter(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_LoadVideofilter(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_LoadVideofilter(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_LoadVideofilter(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_LoadVideofilter(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_LoadVideofilter(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_LoadVideofilter(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_LoadVideofilter(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_LoadVideofilter(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_LoadVideofilter(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_LoadVideofilter(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_LoadVideofilter(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_LoadVideofilter(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_LoadVideofilter(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_LoadVideofilter(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_LoadVideofilter(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_LoadVideofilter(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_LoadVideofilter(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_LoadVideofilter(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_LoadVideofilter(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], vidFiltTable, lines); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_LoadVideofilter(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_LoadVideofilter(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], vidFiltTable->vid_filt_table, lines); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -7856,70 +8110,70 @@ signed   int   SiLabs_ATV_Channel_Scan_M             (SILABS_TER_TUNER_Context *
   minSNRHalfdB = minSNRHalfdB; /* To avoid compilation warnings */
   maxSNRHalfdB = maxSNRHalfdB; /* To avoid compilation warnings */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return 0; }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return 0; }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return 0; }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return 0; }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return 0; }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return 0; }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return 0; }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return 0; }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return 0; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_ATV_Channel_Scan_M(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_ATV_Channel_Scan_M(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_ATV_Channel_Scan_M(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_ATV_Channel_Scan_M(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return 0; }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_ATV_Channel_Scan_M(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_ATV_Channel_Scan_M(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_ATV_Channel_Scan_M(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_ATV_Channel_Scan_M(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_ATV_Channel_Scan_M(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_ATV_Channel_Scan_M(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_ATV_Channel_Scan_M(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_ATV_Channel_Scan_M(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_ATV_Channel_Scan_M(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_ATV_Channel_Scan_M(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_ATV_Channel_Scan_M(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_ATV_Channel_Scan_M(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return -1; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return -1; }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_ATV_Channel_Scan_M(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_ATV_Channel_Scan_M(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_ATV_Channel_Scan_M(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_ATV_Channel_Scan_M(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_ATV_Channel_Scan_M(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_ATV_Channel_Scan_M(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -7927,103 +8181,327 @@ signed   int   SiLabs_ATV_Channel_Scan_PAL           (SILABS_TER_TUNER_Context *
   minSNRHalfdB = minSNRHalfdB; /* To avoid compilation warnings */
   maxSNRHalfdB = maxSNRHalfdB; /* To avoid compilation warnings */
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return 0; }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return 0; }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return 0; }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return 0; }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return 0; }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return 0; }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return 0; }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return 0; }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return 0; }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_ATV_Channel_Scan_PAL(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_ATV_Channel_Scan_PAL(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_ATV_Channel_Scan_PAL(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_ATV_Channel_Scan_PAL(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return 0; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return 0; }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_ATV_Channel_Scan_PAL(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_ATV_Channel_Scan_PAL(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_ATV_Channel_Scan_PAL(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_ATV_Channel_Scan_PAL(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_ATV_Channel_Scan_PAL(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_ATV_Channel_Scan_PAL(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_ATV_Channel_Scan_PAL(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_ATV_Channel_Scan_PAL(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_ATV_Channel_Scan_PAL(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_ATV_Channel_Scan_PAL(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_ATV_Channel_Scan_PAL(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_ATV_Channel_Scan_PAL(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return -1; }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return -1; }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_ATV_Channel_Scan_PAL(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_ATV_Channel_Scan_PAL(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_ATV_Channel_Scan_PAL(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_ATV_Channel_Scan_PAL(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_ATV_Channel_Scan_PAL(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_ATV_Channel_Scan_PAL(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], rangeMinHz, rangeMaxHz, minRSSIdBm, maxRSSIdBm, minSNRHalfdB, maxSNRHalfdB); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
+#ifdef    ATV_PARALLEL_SCAN
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_ATV_Scan_Setup function
+  Use:      ATV scan non-blocking steps, scan configuration
+            Used to set the RSSI/SNR thresholds, the audio scan mode (if any) and a 1.5 MHz AFC range,
+             as done at the start of SiLabs_ATV_Channel_Scan_M and SiLabs_ATV_Channel_Scan_PAL
+  Returns:  0 if ok, -1 if the tuner is not ATV capable or in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Setup       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int minRSSIdBm, signed   int maxRSSIdBm, signed   int minSNRHalfdB, signed   int maxSNRHalfdB) {
+  minSNRHalfdB = minSNRHalfdB; /* To avoid compilation warnings */
+  maxSNRHalfdB = maxSNRHalfdB; /* To avoid compilation warnings */
+#ifdef    TER_TUNER_Si2157
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
+    L1_Si2157_Context *api;
+    api = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index];
+    api->prop->atv_rsq_rssi_threshold.lo = minRSSIdBm;
+    api->prop->atv_rsq_rssi_threshold.hi = maxRSSIdBm;
+    if (Si2157_L1_SetProperty2(api, Si2157_ATV_RSQ_RSSI_THRESHOLD_PROP) != NO_Si2157_ERROR) { return -1; }
+    api->prop->atv_afc_range.range_khz   = 1500;
+    if (Si2157_L1_SetProperty2(api, Si2157_ATV_AFC_RANGE_PROP         ) != NO_Si2157_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2157 */
+#ifdef    TER_TUNER_Si2176
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
+    L1_Si2176_Context *api;
+    api = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index];
+    api->prop->atv_rsq_rssi_threshold.lo = minRSSIdBm;
+    api->prop->atv_rsq_rssi_threshold.hi = maxRSSIdBm;
+    if (Si2176_L1_SetProperty2(api, Si2176_ATV_RSQ_RSSI_THRESHOLD_PROP) != NO_Si2176_ERROR) { return -1; }
+    api->prop->atv_rsq_snr_threshold.lo  = minSNRHalfdB;
+    api->prop->atv_rsq_snr_threshold.hi  = maxSNRHalfdB;
+    if (Si2176_L1_SetProperty2(api, Si2176_ATV_RSQ_SNR_THRESHOLD_PROP ) != NO_Si2176_ERROR) { return -1; }
+    api->prop->tuner_ien.tcien           = Si2176_TUNER_IEN_PROP_TCIEN_ENABLE;
+    api->prop->tuner_ien.rssilien        = Si2176_TUNER_IEN_PROP_RSSILIEN_DISABLE;
+    api->prop->tuner_ien.rssihien        = Si2176_TUNER_IEN_PROP_RSSIHIEN_DISABLE;
+    if (Si2176_L1_SetProperty2(api, Si2176_TUNER_IEN_PROP              ) != NO_Si2176_ERROR) { return -1; }
+    api->prop->atv_ien.chlien            = Si2176_ATV_IEN_PROP_CHLIEN_ENABLE;
+    api->prop->atv_ien.pclien            = Si2176_ATV_IEN_PROP_PCLIEN_DISABLE;
+    api->prop->atv_ien.dlien             = Si2176_ATV_IEN_PROP_DLIEN_DISABLE;
+    api->prop->atv_ien.snrlien           = Si2176_ATV_IEN_PROP_SNRLIEN_DISABLE;
+    api->prop->atv_ien.snrhien           = Si2176_ATV_IEN_PROP_SNRHIEN_DISABLE;
+    if (Si2176_L1_SetProperty2(api, Si2176_ATV_IEN_PROP                ) != NO_Si2176_ERROR) { return -1; }
+    api->prop->atv_audio_mode.audio_sys  = Si2176_ATV_AUDIO_MODE_PROP_AUDIO_SYS_DEFAULT;
+    api->prop->atv_audio_mode.chan_bw    = Si2176_ATV_AUDIO_MODE_PROP_CHAN_BW_DEFAULT;
+    api->prop->atv_audio_mode.demod_mode = Si2176_ATV_AUDIO_MODE_PROP_DEMOD_MODE_SIF;
+    if (Si2176_L1_SetProperty2(api, Si2176_ATV_AUDIO_MODE_PROP         ) != NO_Si2176_ERROR) { return -1; }
+    api->prop->atv_afc_range.range_khz   = 1500;
+    if (Si2176_L1_SetProperty2(api, Si2176_ATV_AFC_RANGE_PROP         ) != NO_Si2176_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2176 */
+#ifdef    TER_TUNER_Si2177
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
+    L1_Si2177_Context *api;
+    api = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index];
+    api->prop->atv_rsq_rssi_threshold.lo = minRSSIdBm;
+    api->prop->atv_rsq_rssi_threshold.hi = maxRSSIdBm;
+    if (Si2177_L1_SetProperty2(api, Si2177_ATV_RSQ_RSSI_THRESHOLD_PROP) != NO_Si2177_ERROR) { return -1; }
+    api->prop->atv_rsq_snr_threshold.lo  = minSNRHalfdB;
+    api->prop->atv_rsq_snr_threshold.hi  = maxSNRHalfdB;
+    if (Si2177_L1_SetProperty2(api, Si2177_ATV_RSQ_SNR_THRESHOLD_PROP ) != NO_Si2177_ERROR) { return -1; }
+    api->prop->atv_audio_mode.audio_sys  = Si2177_ATV_AUDIO_MODE_PROP_AUDIO_SYS_SCAN;
+    api->prop->atv_audio_mode.chan_bw    = Si2177_ATV_AUDIO_MODE_PROP_CHAN_BW_DEFAULT;
+    if (Si2177_L1_SetProperty2(api, Si2177_ATV_AUDIO_MODE_PROP        ) != NO_Si2177_ERROR) { return -1; }
+    api->prop->atv_afc_range.range_khz   = 1500;
+    if (Si2177_L1_SetProperty2(api, Si2177_ATV_AFC_RANGE_PROP         ) != NO_Si2177_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2177 */
+#ifdef    TER_TUNER_Si2178B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
+    L1_Si2178B_Context *api;
+    api = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index];
+    api->prop->atv_rsq_rssi_threshold.lo = minRSSIdBm;
+    api->prop->atv_rsq_rssi_threshold.hi = maxRSSIdBm;
+    if (Si2178B_L1_SetProperty2(api, Si2178B_ATV_RSQ_RSSI_THRESHOLD_PROP) != NO_Si2178B_ERROR) { return -1; }
+    api->prop->atv_rsq_snr_threshold.lo  = minSNRHalfdB;
+    api->prop->atv_rsq_snr_threshold.hi  = maxSNRHalfdB;
+    if (Si2178B_L1_SetProperty2(api, Si2178B_ATV_RSQ_SNR_THRESHOLD_PROP ) != NO_Si2178B_ERROR) { return -1; }
+    api->prop->atv_audio_mode.audio_sys  = Si2178B_ATV_AUDIO_MODE_PROP_AUDIO_SYS_SCAN;
+    api->prop->atv_audio_mode.chan_bw    = Si2178B_ATV_AUDIO_MODE_PROP_CHAN_BW_DEFAULT;
+    if (Si2178B_L1_SetProperty2(api, Si2178B_ATV_AUDIO_MODE_PROP        ) != NO_Si2178B_ERROR) { return -1; }
+    api->prop->atv_afc_range.range_khz   = 1500;
+    if (Si2178B_L1_SetProperty2(api, Si2178B_ATV_AFC_RANGE_PROP         ) != NO_Si2178B_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2178B */
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_ATV_Scan_Tune function
+  Use:      ATV scan non-blocking steps, tune request
+            Used to select the video system to try (L1_RF_TER_TUNER_ATV_SCAN_M/DK/L) and to send TUNER_TUNE_FREQ in ATV mode
+             without waiting for TUNINT/ATVINT. SiLabs_TER_Tuner_ATV_Scan_Check is then used to check the result.
+  Returns:  0 if ok, -1 if the tuner is not ATV capable or in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Tune        (SILABS_TER_TUNER_Context *silabs_tuner, unsigned long freq, signed   int system) {
+#ifdef    TER_TUNER_Si2157
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
+    L1_Si2157_Context *api;
+    api = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index];
+    switch (system) {
+      case L1_RF_TER_TUNER_ATV_SCAN_DK: { api->prop->atv_video_mode.video_sys = Si2157_ATV_VIDEO_MODE_PROP_VIDEO_SYS_DK; api->prop->atv_video_mode.color = Si2157_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+      case L1_RF_TER_TUNER_ATV_SCAN_L : { api->prop->atv_video_mode.video_sys = Si2157_ATV_VIDEO_MODE_PROP_VIDEO_SYS_L ; api->prop->atv_video_mode.color = Si2157_ATV_VIDEO_MODE_PROP_COLOR_SECAM   ; break; }
+      default                         : { api->prop->atv_video_mode.video_sys = Si2157_ATV_VIDEO_MODE_PROP_VIDEO_SYS_M ; api->prop->atv_video_mode.color = Si2157_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+    }
+    if (Si2157_L1_SetProperty2   (api, Si2157_ATV_VIDEO_MODE_PROP) != NO_Si2157_ERROR) { return -1; }
+    if (Si2157_L1_TUNER_TUNE_FREQ(api, Si2157_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq) != NO_Si2157_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2157 */
+#ifdef    TER_TUNER_Si2176
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
+    L1_Si2176_Context *api;
+    api = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index];
+    switch (system) {
+      case L1_RF_TER_TUNER_ATV_SCAN_DK: { api->prop->atv_video_mode.video_sys = Si2176_ATV_VIDEO_MODE_PROP_VIDEO_SYS_DK; api->prop->atv_video_mode.color = Si2176_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+      case L1_RF_TER_TUNER_ATV_SCAN_L : { api->prop->atv_video_mode.video_sys = Si2176_ATV_VIDEO_MODE_PROP_VIDEO_SYS_L ; api->prop->atv_video_mode.color = Si2176_ATV_VIDEO_MODE_PROP_COLOR_SECAM   ; break; }
+      default                         : { api->prop->atv_video_mode.video_sys = Si2176_ATV_VIDEO_MODE_PROP_VIDEO_SYS_M ; api->prop->atv_video_mode.color = Si2176_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+    }
+    api->prop->atv_video_mode.trans = Si2176_ATV_VIDEO_MODE_PROP_TRANS_TERRESTRIAL;
+    if (Si2176_L1_SetProperty2   (api, Si2176_ATV_VIDEO_MODE_PROP) != NO_Si2176_ERROR) { return -1; }
+    if (Si2176_L1_TUNER_TUNE_FREQ(api, Si2176_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq) != NO_Si2176_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2176 */
+#ifdef    TER_TUNER_Si2177
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
+    L1_Si2177_Context *api;
+    api = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index];
+    switch (system) {
+      case L1_RF_TER_TUNER_ATV_SCAN_DK: { api->prop->atv_video_mode.video_sys = Si2177_ATV_VIDEO_MODE_PROP_VIDEO_SYS_DK; api->prop->atv_video_mode.color = Si2177_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+      case L1_RF_TER_TUNER_ATV_SCAN_L : { api->prop->atv_video_mode.video_sys = Si2177_ATV_VIDEO_MODE_PROP_VIDEO_SYS_L ; api->prop->atv_video_mode.color = Si2177_ATV_VIDEO_MODE_PROP_COLOR_SECAM   ; break; }
+      default                         : { api->prop->atv_video_mode.video_sys = Si2177_ATV_VIDEO_MODE_PROP_VIDEO_SYS_M ; api->prop->atv_video_mode.color = Si2177_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+    }
+    if (Si2177_L1_SetProperty2   (api, Si2177_ATV_VIDEO_MODE_PROP) != NO_Si2177_ERROR) { return -1; }
+    if (Si2177_L1_TUNER_TUNE_FREQ(api, Si2177_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq) != NO_Si2177_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2177 */
+#ifdef    TER_TUNER_Si2178B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
+    L1_Si2178B_Context *api;
+    api = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index];
+    switch (system) {
+      case L1_RF_TER_TUNER_ATV_SCAN_DK: { api->prop->atv_video_mode.video_sys = Si2178B_ATV_VIDEO_MODE_PROP_VIDEO_SYS_DK; api->prop->atv_video_mode.color = Si2178B_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+      case L1_RF_TER_TUNER_ATV_SCAN_L : { api->prop->atv_video_mode.video_sys = Si2178B_ATV_VIDEO_MODE_PROP_VIDEO_SYS_L ; api->prop->atv_video_mode.color = Si2178B_ATV_VIDEO_MODE_PROP_COLOR_SECAM   ; break; }
+      default                         : { api->prop->atv_video_mode.video_sys = Si2178B_ATV_VIDEO_MODE_PROP_VIDEO_SYS_M ; api->prop->atv_video_mode.color = Si2178B_ATV_VIDEO_MODE_PROP_COLOR_PAL_NTSC; break; }
+    }
+    if (Si2178B_L1_SetProperty2   (api, Si2178B_ATV_VIDEO_MODE_PROP) != NO_Si2178B_ERROR) { return -1; }
+    if (Si2178B_L1_TUNER_TUNE_FREQ(api, Si2178B_TUNER_TUNE_FREQ_CMD_MODE_ATV, freq) != NO_Si2178B_ERROR) { return -1; }
+    return 0;
+  }
+#endif /* TER_TUNER_Si2178B */
+  freq   = freq;   /* To avoid compilation warnings */
+  system = system; /* To avoid compilation warnings */
+  return -1;
+}
+/************************************************************************************************************************
+  SiLabs_TER_Tuner_ATV_Scan_Check function
+  Use:      ATV scan non-blocking steps, tune result check
+            Used to read the tuner status once after SiLabs_TER_Tuner_ATV_Scan_Tune.
+            When ATVINT is set (an analog channel is detected), ATV_STATUS is read to return the AFC offset in kHz.
+            The caller is in charge of the TUNINT (36 ms) and ATVINT (110 ms) timeouts, as done in SiXXXX_Tune.
+  Returns:  2 if ATVINT is set, 1 if only TUNINT is set, 0 if none, -1 if the tuner is not ATV capable or in case of error
+************************************************************************************************************************/
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Check       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int *afc_khz) {
+#ifdef    TER_TUNER_Si2157
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) {
+    L1_Si2157_Context *api;
+    api = silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index];
+    if (Si2157_L1_CheckStatus(api) != NO_Si2157_ERROR) { return -1; }
+    if (api->status->atvint) {
+      if (Si2157_L1_ATV_STATUS(api, Si2157_ATV_STATUS_CMD_INTACK_OK) != NO_Si2157_ERROR) { return -1; }
+      *afc_khz = api->rsp->atv_status.afc_freq;
+      return 2;
+    }
+    return api->status->tunint ? 1 : 0;
+  }
+#endif /* TER_TUNER_Si2157 */
+#ifdef    TER_TUNER_Si2176
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
+    L1_Si2176_Context *api;
+    api = silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index];
+    if (Si2176_L1_CheckStatus(api) != NO_Si2176_ERROR) { return -1; }
+    if (api->status->atvint) {
+      if (Si2176_L1_ATV_STATUS(api, Si2176_ATV_STATUS_CMD_INTACK_OK) != NO_Si2176_ERROR) { return -1; }
+      *afc_khz = api->rsp->atv_status.afc_freq;
+      return 2;
+    }
+    return api->status->tunint ? 1 : 0;
+  }
+#endif /* TER_TUNER_Si2176 */
+#ifdef    TER_TUNER_Si2177
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) {
+    L1_Si2177_Context *api;
+    api = silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index];
+    if (Si2177_L1_CheckStatus(api) != NO_Si2177_ERROR) { return -1; }
+    if (api->status->atvint) {
+      if (Si2177_L1_ATV_STATUS(api, Si2177_ATV_STATUS_CMD_INTACK_OK) != NO_Si2177_ERROR) { return -1; }
+      *afc_khz = api->rsp->atv_status.afc_freq;
+      return 2;
+    }
+    return api->status->tunint ? 1 : 0;
+  }
+#endif /* TER_TUNER_Si2177 */
+#ifdef    TER_TUNER_Si2178B
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) {
+    L1_Si2178B_Context *api;
+    api = silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index];
+    if (Si2178B_L1_CheckStatus(api) != NO_Si2178B_ERROR) { return -1; }
+    if (api->status->atvint) {
+      if (Si2178B_L1_ATV_STATUS(api, Si2178B_ATV_STATUS_CMD_INTACK_OK) != NO_Si2178B_ERROR) { return -1; }
+      *afc_khz = api->rsp->atv_status.afc_freq;
+      return 2;
+    }
+    return api->status->tunint ? 1 : 0;
+  }
+#endif /* TER_TUNER_Si2178B */
+  afc_khz = afc_khz; /* To avoid compilation warnings */
+  return -1;
+}
+#endif /* ATV_PARALLEL_SCAN */
 signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *silabs_tuner, unsigned char mode ) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_AGC_Override(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_AGC_Override(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_AGC_Override(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_AGC_Override(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_AGC_Override(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_AGC_Override(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_AGC_Override(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_AGC_Override(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_AGC_Override(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_AGC_Override(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_AGC_Override(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_AGC_Override(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_AGC_Override(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_AGC_Override(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_AGC_Override(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_AGC_Override(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
   #define Si2156_FORCE_NORMAL_AGC       0
   #define Si2156_FORCE_MAX_AGC          1
   #define Si2156_FORCE_TOP_AGC          2
-  if (silabs_tuner->ter_tuner_code == 0x2156) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) {
     switch (mode) {
         case  Si2156_FORCE_NORMAL_AGC: return Si2156_L1_AGC_OVERRIDE (silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_DISABLE,Si2156_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
         case  Si2156_FORCE_MAX_AGC   : return Si2156_L1_AGC_OVERRIDE (silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], Si2156_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_ENABLE ,Si2156_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
@@ -8033,19 +8511,19 @@ signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_AGC_Override(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_AGC_Override(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_AGC_Override(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_AGC_Override(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_AGC_Override(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_AGC_Override(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
   #define Si2173_FORCE_NORMAL_AGC       0
   #define Si2173_FORCE_MAX_AGC          1
   #define Si2173_FORCE_TOP_AGC          2
-  if (silabs_tuner->ter_tuner_code == 0x2173) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) {
     switch (mode) {
         case  Si2173_FORCE_NORMAL_AGC: return Si2173_L1_AGC_OVERRIDE (silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_DISABLE,Si2173_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
         case  Si2173_FORCE_MAX_AGC   : return Si2173_L1_AGC_OVERRIDE (silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], Si2173_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_ENABLE ,Si2173_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
@@ -8058,7 +8536,7 @@ signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *
   #define Si2176_FORCE_NORMAL_AGC       0
   #define Si2176_FORCE_MAX_AGC          1
   #define Si2176_FORCE_TOP_AGC          2
-  if (silabs_tuner->ter_tuner_code == 0x2176) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) {
     switch (mode) {
         case  Si2176_FORCE_NORMAL_AGC: return Si2176_L1_AGC_OVERRIDE (silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_DISABLE,Si2176_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
         case  Si2176_FORCE_MAX_AGC   : return Si2176_L1_AGC_OVERRIDE (silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], Si2176_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_ENABLE ,Si2176_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
@@ -8068,31 +8546,31 @@ signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *
   }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_AGC_Override(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_AGC_Override(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_AGC_Override(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_AGC_Override(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_AGC_Override(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_AGC_Override(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_AGC_Override(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_AGC_Override(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_AGC_Override(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_AGC_Override(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_AGC_Override(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_AGC_Override(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_AGC_Override(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], mode); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_AGC_Override(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], mode); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
   #define Si2196_FORCE_NORMAL_AGC       0
   #define Si2196_FORCE_MAX_AGC          1
   #define Si2196_FORCE_TOP_AGC          2
-  if (silabs_tuner->ter_tuner_code == 0x2196) {
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) {
     switch (mode) {
         case  Si2196_FORCE_NORMAL_AGC: return Si2196_L1_AGC_OVERRIDE (silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_DISABLE,Si2196_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
         case  Si2196_FORCE_MAX_AGC   : return Si2196_L1_AGC_OVERRIDE (silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], Si2196_AGC_OVERRIDE_CMD_FORCE_MAX_GAIN_ENABLE ,Si2196_AGC_OVERRIDE_CMD_FORCE_TOP_GAIN_DISABLE); break;
@@ -8105,139 +8583,139 @@ signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *
 }
 signed   int   SiLabs_TER_Tuner_Set_Property         (SILABS_TER_TUNER_Context *silabs_tuner, unsigned int prop_code, int   data) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_L1_SetProperty(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_L1_SetProperty(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_L1_SetProperty(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_L1_SetProperty(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_L1_SetProperty(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_L1_SetProperty(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_L1_SetProperty(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_L1_SetProperty(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_L1_SetProperty(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_L1_SetProperty(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_L1_SetProperty(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_L1_SetProperty(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_L1_SetProperty(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_L1_SetProperty(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_L1_SetProperty(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_L1_SetProperty(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_L1_SetProperty(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_L1_SetProperty(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_L1_SetProperty(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_L1_SetProperty(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_L1_SetProperty(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_L1_SetProperty(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_L1_SetProperty(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_L1_SetProperty(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_L1_SetProperty(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_L1_SetProperty(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_L1_SetProperty(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_L1_SetProperty(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_L1_SetProperty(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_L1_SetProperty(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_L1_SetProperty(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_L1_SetProperty(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_L1_SetProperty(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_L1_SetProperty(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_L1_SetProperty(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_L1_SetProperty(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_L1_SetProperty(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_L1_SetProperty(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_L1_SetProperty(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_L1_SetProperty(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_L1_SetProperty(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_L1_SetProperty(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_L1_SetProperty(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_L1_SetProperty(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
 signed   int   SiLabs_TER_Tuner_Get_Property         (SILABS_TER_TUNER_Context *silabs_tuner, unsigned int prop_code, int  *data) {
 #ifdef    TER_TUNER_Si2124
-  if (silabs_tuner->ter_tuner_code == 0x2124) { return Si2124_L1_GetProperty(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2124) { return Si2124_L1_GetProperty(silabs_tuner->Si2124_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2124 */
 #ifdef    TER_TUNER_Si2141
-  if (silabs_tuner->ter_tuner_code == 0x2141) { return Si2141_L1_GetProperty(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2141) { return Si2141_L1_GetProperty(silabs_tuner->Si2141_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2141 */
 #ifdef    TER_TUNER_Si2144
-  if (silabs_tuner->ter_tuner_code == 0x2144) { return Si2144_L1_GetProperty(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2144) { return Si2144_L1_GetProperty(silabs_tuner->Si2144_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2144 */
 #ifdef    TER_TUNER_Si2146
-  if (silabs_tuner->ter_tuner_code == 0x2146) { return Si2146_L1_GetProperty(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2146) { return Si2146_L1_GetProperty(silabs_tuner->Si2146_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2146 */
 #ifdef    TER_TUNER_Si2147
-  if (silabs_tuner->ter_tuner_code == 0x2147) { return Si2147_L1_GetProperty(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2147) { return Si2147_L1_GetProperty(silabs_tuner->Si2147_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2147 */
 #ifdef    TER_TUNER_Si2148
-  if (silabs_tuner->ter_tuner_code == 0x2148) { return Si2148_L1_GetProperty(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148) { return Si2148_L1_GetProperty(silabs_tuner->Si2148_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2148 */
 #ifdef    TER_TUNER_Si2148B
-  if (silabs_tuner->ter_tuner_code == 0x2148B) { return Si2148B_L1_GetProperty(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2148B) { return Si2148B_L1_GetProperty(silabs_tuner->Si2148B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2148B */
 #ifdef    TER_TUNER_Si2151
-  if (silabs_tuner->ter_tuner_code == 0x2151) { return Si2151_L1_GetProperty(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2151) { return Si2151_L1_GetProperty(silabs_tuner->Si2151_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2151 */
 #ifdef    TER_TUNER_Si2156
-  if (silabs_tuner->ter_tuner_code == 0x2156) { return Si2156_L1_GetProperty(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2156) { return Si2156_L1_GetProperty(silabs_tuner->Si2156_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2156 */
 #ifdef    TER_TUNER_Si2157
-  if (silabs_tuner->ter_tuner_code == 0x2157) { return Si2157_L1_GetProperty(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2157) { return Si2157_L1_GetProperty(silabs_tuner->Si2157_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2157 */
 #ifdef    TER_TUNER_Si2158
-  if (silabs_tuner->ter_tuner_code == 0x2158) { return Si2158_L1_GetProperty(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158) { return Si2158_L1_GetProperty(silabs_tuner->Si2158_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2158 */
 #ifdef    TER_TUNER_Si2158B
-  if (silabs_tuner->ter_tuner_code == 0x2158B) { return Si2158B_L1_GetProperty(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2158B) { return Si2158B_L1_GetProperty(silabs_tuner->Si2158B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2158B */
 #ifdef    TER_TUNER_Si2173
-  if (silabs_tuner->ter_tuner_code == 0x2173) { return Si2173_L1_GetProperty(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2173) { return Si2173_L1_GetProperty(silabs_tuner->Si2173_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2173 */
 #ifdef    TER_TUNER_Si2176
-  if (silabs_tuner->ter_tuner_code == 0x2176) { return Si2176_L1_GetProperty(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2176) { return Si2176_L1_GetProperty(silabs_tuner->Si2176_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2176 */
 #ifdef    TER_TUNER_Si2177
-  if (silabs_tuner->ter_tuner_code == 0x2177) { return Si2177_L1_GetProperty(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2177) { return Si2177_L1_GetProperty(silabs_tuner->Si2177_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2177 */
 #ifdef    TER_TUNER_Si2178
-  if (silabs_tuner->ter_tuner_code == 0x2178) { return Si2178_L1_GetProperty(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178) { return Si2178_L1_GetProperty(silabs_tuner->Si2178_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2178 */
 #ifdef    TER_TUNER_Si2178B
-  if (silabs_tuner->ter_tuner_code == 0x2178B) { return Si2178B_L1_GetProperty(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2178B) { return Si2178B_L1_GetProperty(silabs_tuner->Si2178B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2178B */
 #ifdef    TER_TUNER_Si2190
-  if (silabs_tuner->ter_tuner_code == 0x2190) { return Si2190_L1_GetProperty(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190) { return Si2190_L1_GetProperty(silabs_tuner->Si2190_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2190 */
 #ifdef    TER_TUNER_Si2190B
-  if (silabs_tuner->ter_tuner_code == 0x2190B) { return Si2190B_L1_GetProperty(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2190B) { return Si2190B_L1_GetProperty(silabs_tuner->Si2190B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2190B */
 #ifdef    TER_TUNER_Si2191
-  if (silabs_tuner->ter_tuner_code == 0x2191) { return Si2191_L1_GetProperty(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191) { return Si2191_L1_GetProperty(silabs_tuner->Si2191_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2191 */
 #ifdef    TER_TUNER_Si2191B
-  if (silabs_tuner->ter_tuner_code == 0x2191B) { return Si2191B_L1_GetProperty(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2191B) { return Si2191B_L1_GetProperty(silabs_tuner->Si2191B_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2191B */
 #ifdef    TER_TUNER_Si2196
-  if (silabs_tuner->ter_tuner_code == 0x2196) { return Si2196_L1_GetProperty(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], prop_code, data); }
+  if (SILABS_TER_TUNER_CODE(silabs_tuner) == 0x2196) { return Si2196_L1_GetProperty(silabs_tuner->Si2196_Tuner[silabs_tuner->tuner_index], prop_code, data); }
 #endif /* TER_TUNER_Si2196 */
   return -1;
 }
@@ -17,6 +17,15 @@ limitations under the License.
 #define _SiLabs_TER_Tuner_API_H_
 
 /* Change log:
+ As from V0.7.0: Adding SILABS_TER_TUNER_CODE, returning SINGLE_CHIP_TER_TUNER when defined (single-chip specialization).
+
+ As from V0.6.9: Adding vco_known, vco_blocked_tuner and vco_blocked in SILABS_TER_TUNER_Context, used by the VCO planner in SiLabs_TER_Tuner_VCO_Blocking_PostTune,
+        and SiLabs_TER_Tuner_VCO_Slots / SiLabs_TER_Tuner_VCO_Neighbour.
+
+ As from V0.6.8: Adding L1_RF_TER_TUNER_ATV_SCAN_M/DK/L and SiLabs_TER_Tuner_ATV_Scan_Setup/Tune/Check (when ATV_PARALLEL_SCAN is defined)
+
+ As from V0.6.7: Adding warm_attach, warm_attached and warm_rev in SILABS_TER_TUNER_Context, and SiLabs_TER_Tuner_Warm_Attach (when WARM_ATTACH is defined)
+
  As from V0.6.6: '#define L1_RF_TER_TUNER_MODULATION_ISDBT 4' added, for explicit ISDB-T support (previous code used DVB-T modulation settings for ISDB-T).
         This only has an impact on the AUTO settings for DTV_RF_TOP.
         DVB-T uses P5DB while ISDB-T uses P4DB in AUTO mode.
@@ -86,6 +95,15 @@ limitations under the License.
  #endif /* TER_TUNER_Si2124 */
 #endif /* TER_TUNER_SILABS */
 
+/* Single-chip specialization: when SINGLE_CHIP_TER_TUNER is defined at project level with the TER tuner code  */
+/*  (i.e. -DSINGLE_CHIP_TER_TUNER=0x2157), the tuner code tests are compile-time constants, and each wrapper    */
+/*  function only keeps the calls to the selected tuner.                                                       */
+#ifdef    SINGLE_CHIP_TER_TUNER
+ #define SILABS_TER_TUNER_CODE(silabs_tuner)   ((void)(silabs_tuner), (SINGLE_CHIP_TER_TUNER)) /* silabs_tuner evaluated to avoid unused parameter warnings */
+#else  /* SINGLE_CHIP_TER_TUNER */
+ #define SILABS_TER_TUNER_CODE(silabs_tuner)   ((silabs_tuner)->ter_tuner_code)
+#endif /* SINGLE_CHIP_TER_TUNER */
+
 #include "Silabs_L0_API.h"
 
 #ifndef __VID_FILT_STRUCT__
@@ -218,6 +236,13 @@ typedef struct  {
 #define L1_RF_TER_TUNER_MODULATION_DVBT2 L1_RF_TER_TUNER_MODULATION_DVBT
 #define L1_RF_TER_TUNER_MODULATION_ISDBT 4
 
+#ifdef    ATV_PARALLEL_SCAN
+/* video systems tried by SiLabs_TER_Tuner_ATV_Scan_Tune */
+#define L1_RF_TER_TUNER_ATV_SCAN_M       0 /* negative modulation, system M , PAL/NTSC color */
+#define L1_RF_TER_TUNER_ATV_SCAN_DK      1 /* negative modulation, system DK, PAL/NTSC color */
+#define L1_RF_TER_TUNER_ATV_SCAN_L       2 /* positive modulation, system L , SECAM color    */
+#endif /* ATV_PARALLEL_SCAN */
+
 typedef enum  _SILABS_BW {
     BW_6MHZ   =  6,
     BW_7MHZ   =  7,
@@ -226,6 +251,8 @@ typedef enum  _SILABS_BW {
     BW_6P1MHZ = 10
 } SILABS_BW;
 
+#define TER_TUNER_VCO_SLOTS  3 /* TUNER_BLOCKED_VCO, TUNER_BLOCKED_VCO2 and TUNER_BLOCKED_VCO3 */
+
 typedef struct _SILABS_TER_TUNER_version_info {
   unsigned char   major;
   unsigned char   minor;
@@ -392,6 +419,9 @@ typedef struct _SILABS_TER_TUNER_Context      {
  L1_Si2196_Context  Si2196_TunerObj[Si2196_TUNER_COUNT];
 #endif /* TER_TUNER_Si2196  */
            signed   int    vco_code;
+           signed   int    vco_known;                              /* 1 once vco_code has been read after a tune of this tuner (VCO planner)        */
+           signed   int    vco_blocked_tuner[TER_TUNER_VCO_SLOTS]; /* index in TER_tuners of the tuner whose VCO code is blocked in each slot, -1 if none */
+           signed   int    vco_blocked      [TER_TUNER_VCO_SLOTS]; /* VCO code currently blocked in each slot                                        */
            signed   int    fef_level;
            signed   int    fef_freeze_pin;
   unsigned char   tc;
@@ -402,6 +432,11 @@ typedef struct _SILABS_TER_TUNER_Context      {
   SILABS_TER_TUNER_version_info get_rev;
   unsigned char   romid;
   unsigned char   part;
+#ifdef    WARM_ATTACH
+  signed   int    warm_attach;   /* if set, SiLabs_TER_Tuner_HW_Init attaches to a tuner already running the warm_rev firmware */
+  signed   int    warm_attached; /* 1 if the last SiLabs_TER_Tuner_HW_Init attached to the running firmware                   */
+  SILABS_TER_TUNER_version_info warm_rev; /* GET_REV values after the last full init, to be restored after a restart       */
+#endif /* WARM_ATTACH */
 } SILABS_TER_TUNER_Context;
 
 /* define how many front-ends will be used at project level. Otherwise, this piece of code will set it to 4, but it may not be as expected */
@@ -409,7 +444,11 @@ typedef struct _SILABS_TER_TUNER_Context      {
   #define FRONT_END_COUNT  4
 #endif /* FRONT_END_COUNT */
 extern signed   int TER_Tuner_count;
+#ifdef    FRONTEND_REGISTRY
+extern SILABS_TER_TUNER_Context **TER_tuners;
+#else  /* FRONTEND_REGISTRY */
 extern SILABS_TER_TUNER_Context *TER_tuners[FRONT_END_COUNT];
+#endif /* FRONTEND_REGISTRY */
 
 /* SiLabs TER Tuner API function prototypes */
 signed   int   SiLabs_TER_Tuner_SW_Init              (SILABS_TER_TUNER_Context *silabs_tuner, signed   int add);
@@ -418,6 +457,9 @@ signed   int   SiLabs_TER_Tuner_Set_Address          (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_Store_FW             (SILABS_TER_TUNER_Context *silabs_tuner, firmware_struct fw_table[], signed   int nbLines);
 signed   int   SiLabs_TER_Tuner_Broadcast_I2C        (SILABS_TER_TUNER_Context *silabs_tuners[], signed   int tuner_count);
 signed   int   SiLabs_TER_Tuner_HW_Init              (SILABS_TER_TUNER_Context *silabs_tuner);
+#ifdef    WARM_ATTACH
+signed   int   SiLabs_TER_Tuner_Warm_Attach          (SILABS_TER_TUNER_Context *silabs_tuner);
+#endif /* WARM_ATTACH */
 signed   int   SiLabs_TER_Tuner_Tuner_kickstart      (SILABS_TER_TUNER_Context *silabs_tuner);
 signed   int   SiLabs_TER_Tuner_HW_Connect           (SILABS_TER_TUNER_Context *silabs_tuner, CONNECTION_TYPE connection_mode);
 signed   int   SiLabs_TER_Tuner_bytes_trace          (SILABS_TER_TUNER_Context *silabs_tuner, unsigned char track_mode);
@@ -440,6 +482,8 @@ signed   int   SiLabs_TER_Tuner_DTV_Bandwidth        (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_TER_Tuner_Block_VCO_Code       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int vco_code);
 signed   int   SiLabs_TER_Tuner_Block_VCO2_Code      (SILABS_TER_TUNER_Context *silabs_tuner, signed   int vco_code);
 signed   int   SiLabs_TER_Tuner_Block_VCO3_Code      (SILABS_TER_TUNER_Context *silabs_tuner, signed   int vco_code);
+signed   int   SiLabs_TER_Tuner_VCO_Slots            (SILABS_TER_TUNER_Context *silabs_tuner);
+signed   int   SiLabs_TER_Tuner_VCO_Neighbour        (signed   int tuner_num, signed   int rank, signed   int tuner_count);
 signed   int   SiLabs_TER_Tuner_VCO_Blocking_PostTune(SILABS_TER_TUNER_Context *tuners[], signed   int tuner_num, signed   int tuner_count);
 signed   int   SiLabs_TER_Tuner_Tone_Cancel          (SILABS_TER_TUNER_Context *silabs_tuner, unsigned   int div_a, unsigned   int div_b);
 signed   int   SiLabs_TER_Tuner_Get_RF               (SILABS_TER_TUNER_Context *silabs_tuner);
@@ -467,6 +511,11 @@ signed   int   SiLabs_TER_Tuner_GPIOS                (SILABS_TER_TUNER_Context *
 signed   int   SiLabs_LoadVideofilter                (SILABS_TER_TUNER_Context *silabs_tuner, vid_filt_struct vidFiltTable[], signed   int lines);
 signed   int   SiLabs_ATV_Channel_Scan_M             (SILABS_TER_TUNER_Context *silabs_tuner, unsigned long rangeMinHz, unsigned long rangeMaxHz, signed   int minRSSIdBm, signed   int maxRSSIdBm, signed   int minSNRHalfdB, signed   int maxSNRHalfdB);
 signed   int   SiLabs_ATV_Channel_Scan_PAL           (SILABS_TER_TUNER_Context *silabs_tuner, unsigned long rangeMinHz, unsigned long rangeMaxHz, signed   int minRSSIdBm, signed   int maxRSSIdBm, signed   int minSNRHalfdB, signed   int maxSNRHalfdB);
+#ifdef    ATV_PARALLEL_SCAN
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Setup       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int minRSSIdBm, signed   int maxRSSIdBm, signed   int minSNRHalfdB, signed   int maxSNRHalfdB);
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Tune        (SILABS_TER_TUNER_Context *silabs_tuner, unsigned long freq, signed   int system);
+signed   int   SiLabs_TER_Tuner_ATV_Scan_Check       (SILABS_TER_TUNER_Context *silabs_tuner, signed   int *afc_khz);
+#endif /* ATV_PARALLEL_SCAN */
 signed   int   SiLabs_AGC_Override                   (SILABS_TER_TUNER_Context *silabs_tuner, unsigned char mode );
 signed   int   SiLabs_TER_Tuner_Set_Property         (SILABS_TER_TUNER_Context *silabs_tuner, unsigned int prop_code, int   data);
 signed   int   SiLabs_TER_Tuner_Get_Property         (SILABS_TER_TUNER_Context *silabs_tuner, unsigned int prop_code, int  *data);